@@ -19,6 +19,11 @@ export class ClientMessage extends jspb.Message {
   getFindSource(): FindSourceRequest | undefined;
   setFindSource(value?: FindSourceRequest): void;
 
+  hasUpdateBatch(): boolean;
+  clearUpdateBatch(): void;
+  getUpdateBatch(): UpdateBatch | undefined;
+  setUpdateBatch(value?: UpdateBatch): void;
+
   getMessageCase(): ClientMessage.MessageCase;
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): ClientMessage.AsObject;
@@ -35,6 +40,7 @@ export namespace ClientMessage {
     initRequest?: InitRequest.AsObject,
     applyUpdate?: ApplyUpdate.AsObject,
     findSource?: FindSourceRequest.AsObject,
+    updateBatch?: UpdateBatch.AsObject,
   }
 
   export enum MessageCase {
@@ -42,6 +48,7 @@ export namespace ClientMessage {
     INIT_REQUEST = 1,
     APPLY_UPDATE = 2,
     FIND_SOURCE = 3,
+    UPDATE_BATCH = 4,
   }
 }
 
@@ -51,6 +58,11 @@ export class ServerMessage extends jspb.Message {
   getResponse(): Response | undefined;
   setResponse(value?: Response): void;
 
+  hasUpdateCredits(): boolean;
+  clearUpdateCredits(): void;
+  getUpdateCredits(): UpdateCredits | undefined;
+  setUpdateCredits(value?: UpdateCredits): void;
+
   getMessageCase(): ServerMessage.MessageCase;
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): ServerMessage.AsObject;
@@ -65,11 +77,13 @@ export class ServerMessage extends jspb.Message {
 export namespace ServerMessage {
   export type AsObject = {
     response?: Response.AsObject,
+    updateCredits?: UpdateCredits.AsObject,
   }
 
   export enum MessageCase {
     MESSAGE_NOT_SET = 0,
     RESPONSE = 1,
+    UPDATE_CREDITS = 2,
   }
 }
 
@@ -80,6 +94,15 @@ export class InitRequest extends jspb.Message {
   getClientId(): string;
   setClientId(value: string): void;
 
+  getSharedMemoryRingSize(): number;
+  setSharedMemoryRingSize(value: number): void;
+
+  getFlowControl(): boolean;
+  setFlowControl(value: boolean): void;
+
+  getCompression(): CompressionMap[keyof CompressionMap];
+  setCompression(value: CompressionMap[keyof CompressionMap]): void;
+
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): InitRequest.AsObject;
   static toObject(includeInstance: boolean, msg: InitRequest): InitRequest.AsObject;
@@ -94,6 +117,9 @@ export namespace InitRequest {
   export type AsObject = {
     requestId: string,
     clientId: string,
+    sharedMemoryRingSize: number,
+    flowControl: boolean,
+    compression: CompressionMap[keyof CompressionMap],
   }
 }
 
@@ -148,6 +174,36 @@ export class ApplyUpdate extends jspb.Message {
   getCommitUpdates(): CommitUpdates | undefined;
   setCommitUpdates(value?: CommitUpdates): void;
 
+  hasDefineKey(): boolean;
+  clearDefineKey(): void;
+  getDefineKey(): DefineKey | undefined;
+  setDefineKey(value?: DefineKey): void;
+
+  hasDefineString(): boolean;
+  clearDefineString(): void;
+  getDefineString(): DefineString | undefined;
+  setDefineString(value?: DefineString): void;
+
+  hasSetLayoutValues(): boolean;
+  clearSetLayoutValues(): void;
+  getSetLayoutValues(): SetLayoutValues | undefined;
+  setSetLayoutValues(value?: SetLayoutValues): void;
+
+  hasInsertBefore(): boolean;
+  clearInsertBefore(): void;
+  getInsertBefore(): InsertBefore | undefined;
+  setInsertBefore(value?: InsertBefore): void;
+
+  hasMoveChild(): boolean;
+  clearMoveChild(): void;
+  getMoveChild(): MoveChild | undefined;
+  setMoveChild(value?: MoveChild): void;
+
+  hasCreateTree(): boolean;
+  clearCreateTree(): void;
+  getCreateTree(): CreateTree | undefined;
+  setCreateTree(value?: CreateTree): void;
+
   getChangeCase(): ApplyUpdate.ChangeCase;
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): ApplyUpdate.AsObject;
@@ -167,6 +223,12 @@ export namespace ApplyUpdate {
     appendChild?: AppendChild.AsObject,
     removeChild?: RemoveChild.AsObject,
     commitUpdates?: CommitUpdates.AsObject,
+    defineKey?: DefineKey.AsObject,
+    defineString?: DefineString.AsObject,
+    setLayoutValues?: SetLayoutValues.AsObject,
+    insertBefore?: InsertBefore.AsObject,
+    moveChild?: MoveChild.AsObject,
+    createTree?: CreateTree.AsObject,
   }
 
   export enum ChangeCase {
@@ -177,6 +239,34 @@ export namespace ApplyUpdate {
     APPEND_CHILD = 2,
     REMOVE_CHILD = 4,
     COMMIT_UPDATES = 6,
+    DEFINE_KEY = 7,
+    DEFINE_STRING = 8,
+    SET_LAYOUT_VALUES = 9,
+    INSERT_BEFORE = 10,
+    MOVE_CHILD = 11,
+    CREATE_TREE = 12,
+  }
+}
+
+export class UpdateBatch extends jspb.Message {
+  clearUpdatesList(): void;
+  getUpdatesList(): Array<ApplyUpdate>;
+  setUpdatesList(value: Array<ApplyUpdate>): void;
+  addUpdates(value?: ApplyUpdate, index?: number): ApplyUpdate;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): UpdateBatch.AsObject;
+  static toObject(includeInstance: boolean, msg: UpdateBatch): UpdateBatch.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: UpdateBatch, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): UpdateBatch;
+  static deserializeBinaryFromReader(message: UpdateBatch, reader: jspb.BinaryReader): UpdateBatch;
+}
+
+export namespace UpdateBatch {
+  export type AsObject = {
+    updatesList: Array<ApplyUpdate.AsObject>,
   }
 }
 
@@ -190,6 +280,9 @@ export class FindSourceRequest extends jspb.Message {
   getName(): string;
   setName(value: string): void;
 
+  getHandle(): number;
+  setHandle(value: number): void;
+
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): FindSourceRequest.AsObject;
   static toObject(includeInstance: boolean, msg: FindSourceRequest): FindSourceRequest.AsObject;
@@ -205,6 +298,7 @@ export namespace FindSourceRequest {
     requestId: string,
     uid: string,
     name: string,
+    handle: number,
   }
 }
 
@@ -215,6 +309,22 @@ export class Response extends jspb.Message {
   getSuccess(): boolean;
   setSuccess(value: boolean): void;
 
+  hasSharedMemory(): boolean;
+  clearSharedMemory(): void;
+  getSharedMemory(): SharedMemoryTransport | undefined;
+  setSharedMemory(value?: SharedMemoryTransport): void;
+
+  getUpdateCredits(): number;
+  setUpdateCredits(value: number): void;
+
+  hasCompression(): boolean;
+  clearCompression(): void;
+  getCompression(): FrameCompression | undefined;
+  setCompression(value?: FrameCompression): void;
+
+  getSessionResumed(): boolean;
+  setSessionResumed(value: boolean): void;
+
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): Response.AsObject;
   static toObject(includeInstance: boolean, msg: Response): Response.AsObject;
@@ -229,6 +339,80 @@ export namespace Response {
   export type AsObject = {
     requestId: string,
     success: boolean,
+    sharedMemory?: SharedMemoryTransport.AsObject,
+    updateCredits: number,
+    compression?: FrameCompression.AsObject,
+    sessionResumed: boolean,
+  }
+}
+
+export class SharedMemoryTransport extends jspb.Message {
+  getRingSize(): number;
+  setRingSize(value: number): void;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): SharedMemoryTransport.AsObject;
+  static toObject(includeInstance: boolean, msg: SharedMemoryTransport): SharedMemoryTransport.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: SharedMemoryTransport, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): SharedMemoryTransport;
+  static deserializeBinaryFromReader(message: SharedMemoryTransport, reader: jspb.BinaryReader): SharedMemoryTransport;
+}
+
+export namespace SharedMemoryTransport {
+  export type AsObject = {
+    ringSize: number,
+  }
+}
+
+export class FrameCompression extends jspb.Message {
+  getAlgorithm(): CompressionMap[keyof CompressionMap];
+  setAlgorithm(value: CompressionMap[keyof CompressionMap]): void;
+
+  getThreshold(): number;
+  setThreshold(value: number): void;
+
+  getDictionary(): Uint8Array | string;
+  getDictionary_asU8(): Uint8Array;
+  getDictionary_asB64(): string;
+  setDictionary(value: Uint8Array | string): void;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): FrameCompression.AsObject;
+  static toObject(includeInstance: boolean, msg: FrameCompression): FrameCompression.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: FrameCompression, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): FrameCompression;
+  static deserializeBinaryFromReader(message: FrameCompression, reader: jspb.BinaryReader): FrameCompression;
+}
+
+export namespace FrameCompression {
+  export type AsObject = {
+    algorithm: CompressionMap[keyof CompressionMap],
+    threshold: number,
+    dictionary: Uint8Array | string,
+  }
+}
+
+export class UpdateCredits extends jspb.Message {
+  getCredits(): number;
+  setCredits(value: number): void;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): UpdateCredits.AsObject;
+  static toObject(includeInstance: boolean, msg: UpdateCredits): UpdateCredits.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: UpdateCredits, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): UpdateCredits;
+  static deserializeBinaryFromReader(message: UpdateCredits, reader: jspb.BinaryReader): UpdateCredits;
+}
+
+export namespace UpdateCredits {
+  export type AsObject = {
+    credits: number,
   }
 }
 
@@ -250,6 +434,17 @@ export class CreateSource extends jspb.Message {
   getSettings(): ObjectValue | undefined;
   setSettings(value?: ObjectValue): void;
 
+  getHandle(): number;
+  setHandle(value: number): void;
+
+  getContainerHandle(): number;
+  setContainerHandle(value: number): void;
+
+  hasStyle(): boolean;
+  clearStyle(): void;
+  getStyle(): Style | undefined;
+  setStyle(value?: Style): void;
+
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): CreateSource.AsObject;
   static toObject(includeInstance: boolean, msg: CreateSource): CreateSource.AsObject;
@@ -267,6 +462,9 @@ export namespace CreateSource {
     id: string,
     name: string,
     settings?: ObjectValue.AsObject,
+    handle: number,
+    containerHandle: number,
+    style?: Style.AsObject,
   }
 }
 
@@ -279,6 +477,14 @@ export class UpdateSource extends jspb.Message {
   getChangedProps(): ObjectValue | undefined;
   setChangedProps(value?: ObjectValue): void;
 
+  getHandle(): number;
+  setHandle(value: number): void;
+
+  hasStyle(): boolean;
+  clearStyle(): void;
+  getStyle(): Style | undefined;
+  setStyle(value?: Style): void;
+
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): UpdateSource.AsObject;
   static toObject(includeInstance: boolean, msg: UpdateSource): UpdateSource.AsObject;
@@ -293,6 +499,8 @@ export namespace UpdateSource {
   export type AsObject = {
     uid: string,
     changedProps?: ObjectValue.AsObject,
+    handle: number,
+    style?: Style.AsObject,
   }
 }
 
@@ -311,6 +519,17 @@ export class CreateScene extends jspb.Message {
   getProps(): ObjectValue | undefined;
   setProps(value?: ObjectValue): void;
 
+  getHandle(): number;
+  setHandle(value: number): void;
+
+  getContainerHandle(): number;
+  setContainerHandle(value: number): void;
+
+  hasStyle(): boolean;
+  clearStyle(): void;
+  getStyle(): Style | undefined;
+  setStyle(value?: Style): void;
+
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): CreateScene.AsObject;
   static toObject(includeInstance: boolean, msg: CreateScene): CreateScene.AsObject;
@@ -327,6 +546,9 @@ export namespace CreateScene {
     containerUid: string,
     name: string,
     props?: ObjectValue.AsObject,
+    handle: number,
+    containerHandle: number,
+    style?: Style.AsObject,
   }
 }
 
@@ -337,6 +559,12 @@ export class AppendChild extends jspb.Message {
   getChildUid(): string;
   setChildUid(value: string): void;
 
+  getParentHandle(): number;
+  setParentHandle(value: number): void;
+
+  getChildHandle(): number;
+  setChildHandle(value: number): void;
+
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): AppendChild.AsObject;
   static toObject(includeInstance: boolean, msg: AppendChild): AppendChild.AsObject;
@@ -351,6 +579,8 @@ export namespace AppendChild {
   export type AsObject = {
     parentUid: string,
     childUid: string,
+    parentHandle: number,
+    childHandle: number,
   }
 }
 
@@ -361,6 +591,12 @@ export class RemoveChild extends jspb.Message {
   getChildUid(): string;
   setChildUid(value: string): void;
 
+  getParentHandle(): number;
+  setParentHandle(value: number): void;
+
+  getChildHandle(): number;
+  setChildHandle(value: number): void;
+
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): RemoveChild.AsObject;
   static toObject(includeInstance: boolean, msg: RemoveChild): RemoveChild.AsObject;
@@ -375,6 +611,131 @@ export namespace RemoveChild {
   export type AsObject = {
     parentUid: string,
     childUid: string,
+    parentHandle: number,
+    childHandle: number,
+  }
+}
+
+export class CreateTree extends jspb.Message {
+  getParentHandle(): number;
+  setParentHandle(value: number): void;
+
+  clearRootsList(): void;
+  getRootsList(): Array<TreeNode>;
+  setRootsList(value: Array<TreeNode>): void;
+  addRoots(value?: TreeNode, index?: number): TreeNode;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): CreateTree.AsObject;
+  static toObject(includeInstance: boolean, msg: CreateTree): CreateTree.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: CreateTree, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): CreateTree;
+  static deserializeBinaryFromReader(message: CreateTree, reader: jspb.BinaryReader): CreateTree;
+}
+
+export namespace CreateTree {
+  export type AsObject = {
+    parentHandle: number,
+    rootsList: Array<TreeNode.AsObject>,
+  }
+}
+
+export class TreeNode extends jspb.Message {
+  hasSource(): boolean;
+  clearSource(): void;
+  getSource(): CreateSource | undefined;
+  setSource(value?: CreateSource): void;
+
+  hasScene(): boolean;
+  clearScene(): void;
+  getScene(): CreateScene | undefined;
+  setScene(value?: CreateScene): void;
+
+  clearChildrenList(): void;
+  getChildrenList(): Array<TreeNode>;
+  setChildrenList(value: Array<TreeNode>): void;
+  addChildren(value?: TreeNode, index?: number): TreeNode;
+
+  getNodeCase(): TreeNode.NodeCase;
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): TreeNode.AsObject;
+  static toObject(includeInstance: boolean, msg: TreeNode): TreeNode.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: TreeNode, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): TreeNode;
+  static deserializeBinaryFromReader(message: TreeNode, reader: jspb.BinaryReader): TreeNode;
+}
+
+export namespace TreeNode {
+  export type AsObject = {
+    source?: CreateSource.AsObject,
+    scene?: CreateScene.AsObject,
+    childrenList: Array<TreeNode.AsObject>,
+  }
+
+  export enum NodeCase {
+    NODE_NOT_SET = 0,
+    SOURCE = 1,
+    SCENE = 2,
+  }
+}
+
+export class InsertBefore extends jspb.Message {
+  getParentHandle(): number;
+  setParentHandle(value: number): void;
+
+  getChildHandle(): number;
+  setChildHandle(value: number): void;
+
+  getBeforeHandle(): number;
+  setBeforeHandle(value: number): void;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): InsertBefore.AsObject;
+  static toObject(includeInstance: boolean, msg: InsertBefore): InsertBefore.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: InsertBefore, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): InsertBefore;
+  static deserializeBinaryFromReader(message: InsertBefore, reader: jspb.BinaryReader): InsertBefore;
+}
+
+export namespace InsertBefore {
+  export type AsObject = {
+    parentHandle: number,
+    childHandle: number,
+    beforeHandle: number,
+  }
+}
+
+export class MoveChild extends jspb.Message {
+  getParentHandle(): number;
+  setParentHandle(value: number): void;
+
+  getChildHandle(): number;
+  setChildHandle(value: number): void;
+
+  getBeforeHandle(): number;
+  setBeforeHandle(value: number): void;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): MoveChild.AsObject;
+  static toObject(includeInstance: boolean, msg: MoveChild): MoveChild.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: MoveChild, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): MoveChild;
+  static deserializeBinaryFromReader(message: MoveChild, reader: jspb.BinaryReader): MoveChild;
+}
+
+export namespace MoveChild {
+  export type AsObject = {
+    parentHandle: number,
+    childHandle: number,
+    beforeHandle: number,
   }
 }
 
@@ -382,6 +743,9 @@ export class CommitUpdates extends jspb.Message {
   getContainerUid(): string;
   setContainerUid(value: string): void;
 
+  getContainerHandle(): number;
+  setContainerHandle(value: number): void;
+
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): CommitUpdates.AsObject;
   static toObject(includeInstance: boolean, msg: CommitUpdates): CommitUpdates.AsObject;
@@ -395,6 +759,311 @@ export class CommitUpdates extends jspb.Message {
 export namespace CommitUpdates {
   export type AsObject = {
     containerUid: string,
+    containerHandle: number,
+  }
+}
+
+export class DefineKey extends jspb.Message {
+  getId(): number;
+  setId(value: number): void;
+
+  getKey(): string;
+  setKey(value: string): void;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): DefineKey.AsObject;
+  static toObject(includeInstance: boolean, msg: DefineKey): DefineKey.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: DefineKey, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): DefineKey;
+  static deserializeBinaryFromReader(message: DefineKey, reader: jspb.BinaryReader): DefineKey;
+}
+
+export namespace DefineKey {
+  export type AsObject = {
+    id: number,
+    key: string,
+  }
+}
+
+export class DefineString extends jspb.Message {
+  getId(): number;
+  setId(value: number): void;
+
+  getValue(): string;
+  setValue(value: string): void;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): DefineString.AsObject;
+  static toObject(includeInstance: boolean, msg: DefineString): DefineString.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: DefineString, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): DefineString;
+  static deserializeBinaryFromReader(message: DefineString, reader: jspb.BinaryReader): DefineString;
+}
+
+export namespace DefineString {
+  export type AsObject = {
+    id: number,
+    value: string,
+  }
+}
+
+export class Style extends jspb.Message {
+  getPresent(): number;
+  setPresent(value: number): void;
+
+  getPatch(): boolean;
+  setPatch(value: boolean): void;
+
+  getUnset(): number;
+  setUnset(value: number): void;
+
+  getFlexDirection(): FlexDirectionMap[keyof FlexDirectionMap];
+  setFlexDirection(value: FlexDirectionMap[keyof FlexDirectionMap]): void;
+
+  getDirection(): DirectionMap[keyof DirectionMap];
+  setDirection(value: DirectionMap[keyof DirectionMap]): void;
+
+  getJustifyContent(): JustifyMap[keyof JustifyMap];
+  setJustifyContent(value: JustifyMap[keyof JustifyMap]): void;
+
+  getAlignContent(): AlignMap[keyof AlignMap];
+  setAlignContent(value: AlignMap[keyof AlignMap]): void;
+
+  getAlignItems(): AlignMap[keyof AlignMap];
+  setAlignItems(value: AlignMap[keyof AlignMap]): void;
+
+  getAlignSelf(): AlignMap[keyof AlignMap];
+  setAlignSelf(value: AlignMap[keyof AlignMap]): void;
+
+  getPosition(): PositionTypeMap[keyof PositionTypeMap];
+  setPosition(value: PositionTypeMap[keyof PositionTypeMap]): void;
+
+  getFlexWrap(): WrapMap[keyof WrapMap];
+  setFlexWrap(value: WrapMap[keyof WrapMap]): void;
+
+  getOverflow(): OverflowMap[keyof OverflowMap];
+  setOverflow(value: OverflowMap[keyof OverflowMap]): void;
+
+  getDisplay(): DisplayMap[keyof DisplayMap];
+  setDisplay(value: DisplayMap[keyof DisplayMap]): void;
+
+  getFlexGrow(): number;
+  setFlexGrow(value: number): void;
+
+  getFlexShrink(): number;
+  setFlexShrink(value: number): void;
+
+  hasFlexBasis(): boolean;
+  clearFlexBasis(): void;
+  getFlexBasis(): Dimension | undefined;
+  setFlexBasis(value?: Dimension): void;
+
+  hasTop(): boolean;
+  clearTop(): void;
+  getTop(): Dimension | undefined;
+  setTop(value?: Dimension): void;
+
+  hasLeft(): boolean;
+  clearLeft(): void;
+  getLeft(): Dimension | undefined;
+  setLeft(value?: Dimension): void;
+
+  hasRight(): boolean;
+  clearRight(): void;
+  getRight(): Dimension | undefined;
+  setRight(value?: Dimension): void;
+
+  hasBottom(): boolean;
+  clearBottom(): void;
+  getBottom(): Dimension | undefined;
+  setBottom(value?: Dimension): void;
+
+  hasMarginTop(): boolean;
+  clearMarginTop(): void;
+  getMarginTop(): Dimension | undefined;
+  setMarginTop(value?: Dimension): void;
+
+  hasMarginLeft(): boolean;
+  clearMarginLeft(): void;
+  getMarginLeft(): Dimension | undefined;
+  setMarginLeft(value?: Dimension): void;
+
+  hasMarginRight(): boolean;
+  clearMarginRight(): void;
+  getMarginRight(): Dimension | undefined;
+  setMarginRight(value?: Dimension): void;
+
+  hasMarginBottom(): boolean;
+  clearMarginBottom(): void;
+  getMarginBottom(): Dimension | undefined;
+  setMarginBottom(value?: Dimension): void;
+
+  hasPaddingTop(): boolean;
+  clearPaddingTop(): void;
+  getPaddingTop(): Dimension | undefined;
+  setPaddingTop(value?: Dimension): void;
+
+  hasPaddingLeft(): boolean;
+  clearPaddingLeft(): void;
+  getPaddingLeft(): Dimension | undefined;
+  setPaddingLeft(value?: Dimension): void;
+
+  hasPaddingRight(): boolean;
+  clearPaddingRight(): void;
+  getPaddingRight(): Dimension | undefined;
+  setPaddingRight(value?: Dimension): void;
+
+  hasPaddingBottom(): boolean;
+  clearPaddingBottom(): void;
+  getPaddingBottom(): Dimension | undefined;
+  setPaddingBottom(value?: Dimension): void;
+
+  getAspectRatio(): number;
+  setAspectRatio(value: number): void;
+
+  hasWidth(): boolean;
+  clearWidth(): void;
+  getWidth(): Dimension | undefined;
+  setWidth(value?: Dimension): void;
+
+  hasHeight(): boolean;
+  clearHeight(): void;
+  getHeight(): Dimension | undefined;
+  setHeight(value?: Dimension): void;
+
+  hasMinWidth(): boolean;
+  clearMinWidth(): void;
+  getMinWidth(): Dimension | undefined;
+  setMinWidth(value?: Dimension): void;
+
+  hasMaxWidth(): boolean;
+  clearMaxWidth(): void;
+  getMaxWidth(): Dimension | undefined;
+  setMaxWidth(value?: Dimension): void;
+
+  hasMinHeight(): boolean;
+  clearMinHeight(): void;
+  getMinHeight(): Dimension | undefined;
+  setMinHeight(value?: Dimension): void;
+
+  hasMaxHeight(): boolean;
+  clearMaxHeight(): void;
+  getMaxHeight(): Dimension | undefined;
+  setMaxHeight(value?: Dimension): void;
+
+  getZIndex(): number;
+  setZIndex(value: number): void;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): Style.AsObject;
+  static toObject(includeInstance: boolean, msg: Style): Style.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: Style, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): Style;
+  static deserializeBinaryFromReader(message: Style, reader: jspb.BinaryReader): Style;
+}
+
+export namespace Style {
+  export type AsObject = {
+    present: number,
+    patch: boolean,
+    unset: number,
+    flexDirection: FlexDirectionMap[keyof FlexDirectionMap],
+    direction: DirectionMap[keyof DirectionMap],
+    justifyContent: JustifyMap[keyof JustifyMap],
+    alignContent: AlignMap[keyof AlignMap],
+    alignItems: AlignMap[keyof AlignMap],
+    alignSelf: AlignMap[keyof AlignMap],
+    position: PositionTypeMap[keyof PositionTypeMap],
+    flexWrap: WrapMap[keyof WrapMap],
+    overflow: OverflowMap[keyof OverflowMap],
+    display: DisplayMap[keyof DisplayMap],
+    flexGrow: number,
+    flexShrink: number,
+    flexBasis?: Dimension.AsObject,
+    top?: Dimension.AsObject,
+    left?: Dimension.AsObject,
+    right?: Dimension.AsObject,
+    bottom?: Dimension.AsObject,
+    marginTop?: Dimension.AsObject,
+    marginLeft?: Dimension.AsObject,
+    marginRight?: Dimension.AsObject,
+    marginBottom?: Dimension.AsObject,
+    paddingTop?: Dimension.AsObject,
+    paddingLeft?: Dimension.AsObject,
+    paddingRight?: Dimension.AsObject,
+    paddingBottom?: Dimension.AsObject,
+    aspectRatio: number,
+    width?: Dimension.AsObject,
+    height?: Dimension.AsObject,
+    minWidth?: Dimension.AsObject,
+    maxWidth?: Dimension.AsObject,
+    minHeight?: Dimension.AsObject,
+    maxHeight?: Dimension.AsObject,
+    zIndex: number,
+  }
+}
+
+export class SetLayoutValues extends jspb.Message {
+  clearHandlesList(): void;
+  getHandlesList(): Array<number>;
+  setHandlesList(value: Array<number>): void;
+  addHandles(value: number, index?: number): number;
+
+  clearPropIdsList(): void;
+  getPropIdsList(): Array<number>;
+  setPropIdsList(value: Array<number>): void;
+  addPropIds(value: number, index?: number): number;
+
+  clearValuesList(): void;
+  getValuesList(): Array<number>;
+  setValuesList(value: Array<number>): void;
+  addValues(value: number, index?: number): number;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): SetLayoutValues.AsObject;
+  static toObject(includeInstance: boolean, msg: SetLayoutValues): SetLayoutValues.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: SetLayoutValues, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): SetLayoutValues;
+  static deserializeBinaryFromReader(message: SetLayoutValues, reader: jspb.BinaryReader): SetLayoutValues;
+}
+
+export namespace SetLayoutValues {
+  export type AsObject = {
+    handlesList: Array<number>,
+    propIdsList: Array<number>,
+    valuesList: Array<number>,
+  }
+}
+
+export class Dimension extends jspb.Message {
+  getValue(): number;
+  setValue(value: number): void;
+
+  getUnit(): UnitMap[keyof UnitMap];
+  setUnit(value: UnitMap[keyof UnitMap]): void;
+
+  serializeBinary(): Uint8Array;
+  toObject(includeInstance?: boolean): Dimension.AsObject;
+  static toObject(includeInstance: boolean, msg: Dimension): Dimension.AsObject;
+  static extensions: {[key: number]: jspb.ExtensionFieldInfo<jspb.Message>};
+  static extensionsBinary: {[key: number]: jspb.ExtensionFieldBinaryInfo<jspb.Message>};
+  static serializeBinaryToWriter(message: Dimension, writer: jspb.BinaryWriter): void;
+  static deserializeBinary(bytes: Uint8Array): Dimension;
+  static deserializeBinaryFromReader(message: Dimension, reader: jspb.BinaryReader): Dimension;
+}
+
+export namespace Dimension {
+  export type AsObject = {
+    value: number,
+    unit: UnitMap[keyof UnitMap],
   }
 }
 
@@ -402,6 +1071,9 @@ export class Prop extends jspb.Message {
   getKey(): string;
   setKey(value: string): void;
 
+  getKeyId(): number;
+  setKeyId(value: number): void;
+
   hasStringValue(): boolean;
   clearStringValue(): void;
   getStringValue(): string;
@@ -432,6 +1104,11 @@ export class Prop extends jspb.Message {
   getUndefined(): boolean;
   setUndefined(value: boolean): void;
 
+  hasStringId(): boolean;
+  clearStringId(): void;
+  getStringId(): number;
+  setStringId(value: number): void;
+
   getValueCase(): Prop.ValueCase;
   serializeBinary(): Uint8Array;
   toObject(includeInstance?: boolean): Prop.AsObject;
@@ -446,12 +1123,14 @@ export class Prop extends jspb.Message {
 export namespace Prop {
   export type AsObject = {
     key: string,
+    keyId: number,
     stringValue: string,
     intValue: number,
     floatValue: number,
     boolValue: boolean,
     objectValue?: ObjectValue.AsObject,
     undefined: boolean,
+    stringId: number,
   }
 
   export enum ValueCase {
@@ -462,6 +1141,7 @@ export namespace Prop {
     BOOL_VALUE = 5,
     OBJECT_VALUE = 6,
     UNDEFINED = 7,
+    STRING_ID = 9,
   }
 }
 
@@ -487,3 +1167,97 @@ export namespace ObjectValue {
   }
 }
 
+export interface CompressionMap {
+  COMPRESSION_NONE: 0;
+  COMPRESSION_DEFLATE: 1;
+}
+
+export const Compression: CompressionMap;
+
+export interface LayoutValueFlagsMap {
+  LAYOUT_VALUE_POINT: 0;
+  LAYOUT_VALUE_PERCENT: 256;
+}
+
+export const LayoutValueFlags: LayoutValueFlagsMap;
+
+export interface UnitMap {
+  UNIT_POINT: 0;
+  UNIT_PERCENT: 1;
+  UNIT_AUTO: 2;
+}
+
+export const Unit: UnitMap;
+
+export interface FlexDirectionMap {
+  FLEX_DIRECTION_COLUMN: 0;
+  FLEX_DIRECTION_COLUMN_REVERSE: 1;
+  FLEX_DIRECTION_ROW: 2;
+  FLEX_DIRECTION_ROW_REVERSE: 3;
+}
+
+export const FlexDirection: FlexDirectionMap;
+
+export interface DirectionMap {
+  DIRECTION_INHERIT: 0;
+  DIRECTION_LTR: 1;
+  DIRECTION_RTL: 2;
+}
+
+export const Direction: DirectionMap;
+
+export interface JustifyMap {
+  JUSTIFY_FLEX_START: 0;
+  JUSTIFY_CENTER: 1;
+  JUSTIFY_FLEX_END: 2;
+  JUSTIFY_SPACE_BETWEEN: 3;
+  JUSTIFY_SPACE_AROUND: 4;
+  JUSTIFY_SPACE_EVENLY: 5;
+}
+
+export const Justify: JustifyMap;
+
+export interface AlignMap {
+  ALIGN_AUTO: 0;
+  ALIGN_FLEX_START: 1;
+  ALIGN_CENTER: 2;
+  ALIGN_FLEX_END: 3;
+  ALIGN_STRETCH: 4;
+  ALIGN_BASELINE: 5;
+  ALIGN_SPACE_BETWEEN: 6;
+  ALIGN_SPACE_AROUND: 7;
+}
+
+export const Align: AlignMap;
+
+export interface PositionTypeMap {
+  POSITION_TYPE_STATIC: 0;
+  POSITION_TYPE_RELATIVE: 1;
+  POSITION_TYPE_ABSOLUTE: 2;
+}
+
+export const PositionType: PositionTypeMap;
+
+export interface WrapMap {
+  WRAP_NO_WRAP: 0;
+  WRAP_WRAP: 1;
+  WRAP_WRAP_REVERSE: 2;
+}
+
+export const Wrap: WrapMap;
+
+export interface OverflowMap {
+  OVERFLOW_VISIBLE: 0;
+  OVERFLOW_HIDDEN: 1;
+  OVERFLOW_SCROLL: 2;
+}
+
+export const Overflow: OverflowMap;
+
+export interface DisplayMap {
+  DISPLAY_FLEX: 0;
+  DISPLAY_NONE: 1;
+}
+
+export const Display: DisplayMap;
+
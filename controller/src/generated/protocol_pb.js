@@ -12,17 +12,33 @@ var jspb = require('google-protobuf');
 var goog = jspb;
 var global = Function('return this')();
 
+goog.exportSymbol('proto.protocol.Align', null, global);
 goog.exportSymbol('proto.protocol.AppendChild', null, global);
 goog.exportSymbol('proto.protocol.ApplyUpdate', null, global);
 goog.exportSymbol('proto.protocol.ApplyUpdate.ChangeCase', null, global);
 goog.exportSymbol('proto.protocol.ClientMessage', null, global);
 goog.exportSymbol('proto.protocol.ClientMessage.MessageCase', null, global);
 goog.exportSymbol('proto.protocol.CommitUpdates', null, global);
+goog.exportSymbol('proto.protocol.Compression', null, global);
 goog.exportSymbol('proto.protocol.CreateScene', null, global);
 goog.exportSymbol('proto.protocol.CreateSource', null, global);
+goog.exportSymbol('proto.protocol.CreateTree', null, global);
+goog.exportSymbol('proto.protocol.DefineKey', null, global);
+goog.exportSymbol('proto.protocol.DefineString', null, global);
+goog.exportSymbol('proto.protocol.Dimension', null, global);
+goog.exportSymbol('proto.protocol.Direction', null, global);
+goog.exportSymbol('proto.protocol.Display', null, global);
 goog.exportSymbol('proto.protocol.FindSourceRequest', null, global);
+goog.exportSymbol('proto.protocol.FlexDirection', null, global);
+goog.exportSymbol('proto.protocol.FrameCompression', null, global);
 goog.exportSymbol('proto.protocol.InitRequest', null, global);
+goog.exportSymbol('proto.protocol.InsertBefore', null, global);
+goog.exportSymbol('proto.protocol.Justify', null, global);
+goog.exportSymbol('proto.protocol.LayoutValueFlags', null, global);
+goog.exportSymbol('proto.protocol.MoveChild', null, global);
 goog.exportSymbol('proto.protocol.ObjectValue', null, global);
+goog.exportSymbol('proto.protocol.Overflow', null, global);
+goog.exportSymbol('proto.protocol.PositionType', null, global);
 goog.exportSymbol('proto.protocol.Prop', null, global);
 goog.exportSymbol('proto.protocol.Prop.ValueCase', null, global);
 goog.exportSymbol('proto.protocol.RemoveChild', null, global);
@@ -30,7 +46,16 @@ goog.exportSymbol('proto.protocol.Response', null, global);
 goog.exportSymbol('proto.protocol.Scene', null, global);
 goog.exportSymbol('proto.protocol.ServerMessage', null, global);
 goog.exportSymbol('proto.protocol.ServerMessage.MessageCase', null, global);
+goog.exportSymbol('proto.protocol.SetLayoutValues', null, global);
+goog.exportSymbol('proto.protocol.SharedMemoryTransport', null, global);
+goog.exportSymbol('proto.protocol.Style', null, global);
+goog.exportSymbol('proto.protocol.TreeNode', null, global);
+goog.exportSymbol('proto.protocol.TreeNode.NodeCase', null, global);
+goog.exportSymbol('proto.protocol.Unit', null, global);
+goog.exportSymbol('proto.protocol.UpdateBatch', null, global);
+goog.exportSymbol('proto.protocol.UpdateCredits', null, global);
 goog.exportSymbol('proto.protocol.UpdateSource', null, global);
+goog.exportSymbol('proto.protocol.Wrap', null, global);
 /**
  * Generated by JsPbCodeGenerator.
  * @param {Array=} opt_data Optional initial data array, typically from a
@@ -136,6 +161,27 @@ if (goog.DEBUG && !COMPILED) {
    */
   proto.protocol.ApplyUpdate.displayName = 'proto.protocol.ApplyUpdate';
 }
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.UpdateBatch = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.protocol.UpdateBatch.repeatedFields_, null);
+};
+goog.inherits(proto.protocol.UpdateBatch, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.UpdateBatch.displayName = 'proto.protocol.UpdateBatch';
+}
 /**
  * Generated by JsPbCodeGenerator.
  * @param {Array=} opt_data Optional initial data array, typically from a
@@ -178,6 +224,69 @@ if (goog.DEBUG && !COMPILED) {
    */
   proto.protocol.Response.displayName = 'proto.protocol.Response';
 }
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.SharedMemoryTransport = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.protocol.SharedMemoryTransport, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.SharedMemoryTransport.displayName = 'proto.protocol.SharedMemoryTransport';
+}
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.FrameCompression = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.protocol.FrameCompression, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.FrameCompression.displayName = 'proto.protocol.FrameCompression';
+}
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.UpdateCredits = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.protocol.UpdateCredits, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.UpdateCredits.displayName = 'proto.protocol.UpdateCredits';
+}
 /**
  * Generated by JsPbCodeGenerator.
  * @param {Array=} opt_data Optional initial data array, typically from a
@@ -283,6 +392,90 @@ if (goog.DEBUG && !COMPILED) {
    */
   proto.protocol.RemoveChild.displayName = 'proto.protocol.RemoveChild';
 }
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.CreateTree = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.protocol.CreateTree.repeatedFields_, null);
+};
+goog.inherits(proto.protocol.CreateTree, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.CreateTree.displayName = 'proto.protocol.CreateTree';
+}
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.TreeNode = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.protocol.TreeNode.repeatedFields_, proto.protocol.TreeNode.oneofGroups_);
+};
+goog.inherits(proto.protocol.TreeNode, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.TreeNode.displayName = 'proto.protocol.TreeNode';
+}
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.InsertBefore = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.protocol.InsertBefore, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.InsertBefore.displayName = 'proto.protocol.InsertBefore';
+}
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.MoveChild = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.protocol.MoveChild, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.MoveChild.displayName = 'proto.protocol.MoveChild';
+}
 /**
  * Generated by JsPbCodeGenerator.
  * @param {Array=} opt_data Optional initial data array, typically from a
@@ -304,6 +497,111 @@ if (goog.DEBUG && !COMPILED) {
    */
   proto.protocol.CommitUpdates.displayName = 'proto.protocol.CommitUpdates';
 }
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.DefineKey = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.protocol.DefineKey, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.DefineKey.displayName = 'proto.protocol.DefineKey';
+}
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.DefineString = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.protocol.DefineString, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.DefineString.displayName = 'proto.protocol.DefineString';
+}
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.Style = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.protocol.Style, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.Style.displayName = 'proto.protocol.Style';
+}
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.SetLayoutValues = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, proto.protocol.SetLayoutValues.repeatedFields_, null);
+};
+goog.inherits(proto.protocol.SetLayoutValues, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.SetLayoutValues.displayName = 'proto.protocol.SetLayoutValues';
+}
+/**
+ * Generated by JsPbCodeGenerator.
+ * @param {Array=} opt_data Optional initial data array, typically from a
+ * server response, or constructed directly in Javascript. The array is used
+ * in place and becomes part of the constructed object. It is not cloned.
+ * If no data is provided, the constructed object will be empty, but still
+ * valid.
+ * @extends {jspb.Message}
+ * @constructor
+ */
+proto.protocol.Dimension = function(opt_data) {
+  jspb.Message.initialize(this, opt_data, 0, -1, null, null);
+};
+goog.inherits(proto.protocol.Dimension, jspb.Message);
+if (goog.DEBUG && !COMPILED) {
+  /**
+   * @public
+   * @override
+   */
+  proto.protocol.Dimension.displayName = 'proto.protocol.Dimension';
+}
 /**
  * Generated by JsPbCodeGenerator.
  * @param {Array=} opt_data Optional initial data array, typically from a
@@ -355,7 +653,7 @@ if (goog.DEBUG && !COMPILED) {
  * @private {!Array<!Array<number>>}
  * @const
  */
-proto.protocol.ClientMessage.oneofGroups_ = [[1,2,3]];
+proto.protocol.ClientMessage.oneofGroups_ = [[1,2,3,4]];
 
 /**
  * @enum {number}
@@ -364,7 +662,8 @@ proto.protocol.ClientMessage.MessageCase = {
   MESSAGE_NOT_SET: 0,
   INIT_REQUEST: 1,
   APPLY_UPDATE: 2,
-  FIND_SOURCE: 3
+  FIND_SOURCE: 3,
+  UPDATE_BATCH: 4
 };
 
 /**
@@ -407,7 +706,8 @@ proto.protocol.ClientMessage.toObject = function(includeInstance, msg) {
   var f, obj = {
     initRequest: (f = msg.getInitRequest()) && proto.protocol.InitRequest.toObject(includeInstance, f),
     applyUpdate: (f = msg.getApplyUpdate()) && proto.protocol.ApplyUpdate.toObject(includeInstance, f),
-    findSource: (f = msg.getFindSource()) && proto.protocol.FindSourceRequest.toObject(includeInstance, f)
+    findSource: (f = msg.getFindSource()) && proto.protocol.FindSourceRequest.toObject(includeInstance, f),
+    updateBatch: (f = msg.getUpdateBatch()) && proto.protocol.UpdateBatch.toObject(includeInstance, f)
   };
 
   if (includeInstance) {
@@ -459,6 +759,11 @@ proto.protocol.ClientMessage.deserializeBinaryFromReader = function(msg, reader)
       reader.readMessage(value,proto.protocol.FindSourceRequest.deserializeBinaryFromReader);
       msg.setFindSource(value);
       break;
+    case 4:
+      var value = new proto.protocol.UpdateBatch;
+      reader.readMessage(value,proto.protocol.UpdateBatch.deserializeBinaryFromReader);
+      msg.setUpdateBatch(value);
+      break;
     default:
       reader.skipField();
       break;
@@ -512,6 +817,14 @@ proto.protocol.ClientMessage.serializeBinaryToWriter = function(message, writer)
       proto.protocol.FindSourceRequest.serializeBinaryToWriter
     );
   }
+  f = message.getUpdateBatch();
+  if (f != null) {
+    writer.writeMessage(
+      4,
+      f,
+      proto.protocol.UpdateBatch.serializeBinaryToWriter
+    );
+  }
 };
 
 
@@ -626,28 +939,66 @@ proto.protocol.ClientMessage.prototype.hasFindSource = function() {
 };
 
 
-
 /**
- * Oneof group definitions for this message. Each group defines the field
- * numbers belonging to that group. When of these fields' value is set, all
- * other fields in the group are cleared. During deserialization, if multiple
- * fields are encountered for a group, only the last value seen will be kept.
- * @private {!Array<!Array<number>>}
- * @const
+ * optional UpdateBatch update_batch = 4;
+ * @return {?proto.protocol.UpdateBatch}
  */
-proto.protocol.ServerMessage.oneofGroups_ = [[1]];
+proto.protocol.ClientMessage.prototype.getUpdateBatch = function() {
+  return /** @type{?proto.protocol.UpdateBatch} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.UpdateBatch, 4));
+};
+
 
 /**
- * @enum {number}
- */
-proto.protocol.ServerMessage.MessageCase = {
-  MESSAGE_NOT_SET: 0,
-  RESPONSE: 1
+ * @param {?proto.protocol.UpdateBatch|undefined} value
+ * @return {!proto.protocol.ClientMessage} returns this
+*/
+proto.protocol.ClientMessage.prototype.setUpdateBatch = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 4, proto.protocol.ClientMessage.oneofGroups_[0], value);
 };
 
+
 /**
- * @return {proto.protocol.ServerMessage.MessageCase}
- */
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.ClientMessage} returns this
+ */
+proto.protocol.ClientMessage.prototype.clearUpdateBatch = function() {
+  return this.setUpdateBatch(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.ClientMessage.prototype.hasUpdateBatch = function() {
+  return jspb.Message.getField(this, 4) != null;
+};
+
+
+
+/**
+ * Oneof group definitions for this message. Each group defines the field
+ * numbers belonging to that group. When of these fields' value is set, all
+ * other fields in the group are cleared. During deserialization, if multiple
+ * fields are encountered for a group, only the last value seen will be kept.
+ * @private {!Array<!Array<number>>}
+ * @const
+ */
+proto.protocol.ServerMessage.oneofGroups_ = [[1,2]];
+
+/**
+ * @enum {number}
+ */
+proto.protocol.ServerMessage.MessageCase = {
+  MESSAGE_NOT_SET: 0,
+  RESPONSE: 1,
+  UPDATE_CREDITS: 2
+};
+
+/**
+ * @return {proto.protocol.ServerMessage.MessageCase}
+ */
 proto.protocol.ServerMessage.prototype.getMessageCase = function() {
   return /** @type {proto.protocol.ServerMessage.MessageCase} */(jspb.Message.computeOneofCase(this, proto.protocol.ServerMessage.oneofGroups_[0]));
 };
@@ -683,7 +1034,8 @@ proto.protocol.ServerMessage.prototype.toObject = function(opt_includeInstance)
  */
 proto.protocol.ServerMessage.toObject = function(includeInstance, msg) {
   var f, obj = {
-    response: (f = msg.getResponse()) && proto.protocol.Response.toObject(includeInstance, f)
+    response: (f = msg.getResponse()) && proto.protocol.Response.toObject(includeInstance, f),
+    updateCredits: (f = msg.getUpdateCredits()) && proto.protocol.UpdateCredits.toObject(includeInstance, f)
   };
 
   if (includeInstance) {
@@ -725,6 +1077,11 @@ proto.protocol.ServerMessage.deserializeBinaryFromReader = function(msg, reader)
       reader.readMessage(value,proto.protocol.Response.deserializeBinaryFromReader);
       msg.setResponse(value);
       break;
+    case 2:
+      var value = new proto.protocol.UpdateCredits;
+      reader.readMessage(value,proto.protocol.UpdateCredits.deserializeBinaryFromReader);
+      msg.setUpdateCredits(value);
+      break;
     default:
       reader.skipField();
       break;
@@ -762,6 +1119,14 @@ proto.protocol.ServerMessage.serializeBinaryToWriter = function(message, writer)
       proto.protocol.Response.serializeBinaryToWriter
     );
   }
+  f = message.getUpdateCredits();
+  if (f != null) {
+    writer.writeMessage(
+      2,
+      f,
+      proto.protocol.UpdateCredits.serializeBinaryToWriter
+    );
+  }
 };
 
 
@@ -802,6 +1167,43 @@ proto.protocol.ServerMessage.prototype.hasResponse = function() {
 };
 
 
+/**
+ * optional UpdateCredits update_credits = 2;
+ * @return {?proto.protocol.UpdateCredits}
+ */
+proto.protocol.ServerMessage.prototype.getUpdateCredits = function() {
+  return /** @type{?proto.protocol.UpdateCredits} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.UpdateCredits, 2));
+};
+
+
+/**
+ * @param {?proto.protocol.UpdateCredits|undefined} value
+ * @return {!proto.protocol.ServerMessage} returns this
+*/
+proto.protocol.ServerMessage.prototype.setUpdateCredits = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 2, proto.protocol.ServerMessage.oneofGroups_[0], value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.ServerMessage} returns this
+ */
+proto.protocol.ServerMessage.prototype.clearUpdateCredits = function() {
+  return this.setUpdateCredits(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.ServerMessage.prototype.hasUpdateCredits = function() {
+  return jspb.Message.getField(this, 2) != null;
+};
+
+
 
 
 
@@ -835,7 +1237,10 @@ proto.protocol.InitRequest.prototype.toObject = function(opt_includeInstance) {
 proto.protocol.InitRequest.toObject = function(includeInstance, msg) {
   var f, obj = {
     requestId: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    clientId: jspb.Message.getFieldWithDefault(msg, 2, "")
+    clientId: jspb.Message.getFieldWithDefault(msg, 2, ""),
+    sharedMemoryRingSize: jspb.Message.getFieldWithDefault(msg, 3, 0),
+    flowControl: jspb.Message.getBooleanFieldWithDefault(msg, 4, false),
+    compression: jspb.Message.getFieldWithDefault(msg, 5, 0)
   };
 
   if (includeInstance) {
@@ -880,6 +1285,18 @@ proto.protocol.InitRequest.deserializeBinaryFromReader = function(msg, reader) {
       var value = /** @type {string} */ (reader.readString());
       msg.setClientId(value);
       break;
+    case 3:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setSharedMemoryRingSize(value);
+      break;
+    case 4:
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setFlowControl(value);
+      break;
+    case 5:
+      var value = /** @type {!proto.protocol.Compression} */ (reader.readEnum());
+      msg.setCompression(value);
+      break;
     default:
       reader.skipField();
       break;
@@ -923,6 +1340,27 @@ proto.protocol.InitRequest.serializeBinaryToWriter = function(message, writer) {
       f
     );
   }
+  f = message.getSharedMemoryRingSize();
+  if (f !== 0) {
+    writer.writeUint32(
+      3,
+      f
+    );
+  }
+  f = message.getFlowControl();
+  if (f) {
+    writer.writeBool(
+      4,
+      f
+    );
+  }
+  f = message.getCompression();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      5,
+      f
+    );
+  }
 };
 
 
@@ -962,6 +1400,60 @@ proto.protocol.InitRequest.prototype.setClientId = function(value) {
 };
 
 
+/**
+ * optional uint32 shared_memory_ring_size = 3;
+ * @return {number}
+ */
+proto.protocol.InitRequest.prototype.getSharedMemoryRingSize = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.InitRequest} returns this
+ */
+proto.protocol.InitRequest.prototype.setSharedMemoryRingSize = function(value) {
+  return jspb.Message.setProto3IntField(this, 3, value);
+};
+
+
+/**
+ * optional bool flow_control = 4;
+ * @return {boolean}
+ */
+proto.protocol.InitRequest.prototype.getFlowControl = function() {
+  return /** @type {boolean} */ (jspb.Message.getBooleanFieldWithDefault(this, 4, false));
+};
+
+
+/**
+ * @param {boolean} value
+ * @return {!proto.protocol.InitRequest} returns this
+ */
+proto.protocol.InitRequest.prototype.setFlowControl = function(value) {
+  return jspb.Message.setProto3BooleanField(this, 4, value);
+};
+
+
+/**
+ * optional Compression compression = 5;
+ * @return {!proto.protocol.Compression}
+ */
+proto.protocol.InitRequest.prototype.getCompression = function() {
+  return /** @type {!proto.protocol.Compression} */ (jspb.Message.getFieldWithDefault(this, 5, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Compression} value
+ * @return {!proto.protocol.InitRequest} returns this
+ */
+proto.protocol.InitRequest.prototype.setCompression = function(value) {
+  return jspb.Message.setProto3EnumField(this, 5, value);
+};
+
+
 
 
 
@@ -1101,7 +1593,7 @@ proto.protocol.Scene.prototype.setName = function(value) {
  * @private {!Array<!Array<number>>}
  * @const
  */
-proto.protocol.ApplyUpdate.oneofGroups_ = [[1,3,5,2,4,6]];
+proto.protocol.ApplyUpdate.oneofGroups_ = [[1,3,5,2,4,6,7,8,9,10,11,12]];
 
 /**
  * @enum {number}
@@ -1113,7 +1605,13 @@ proto.protocol.ApplyUpdate.ChangeCase = {
   CREATE_SCENE: 5,
   APPEND_CHILD: 2,
   REMOVE_CHILD: 4,
-  COMMIT_UPDATES: 6
+  COMMIT_UPDATES: 6,
+  DEFINE_KEY: 7,
+  DEFINE_STRING: 8,
+  SET_LAYOUT_VALUES: 9,
+  INSERT_BEFORE: 10,
+  MOVE_CHILD: 11,
+  CREATE_TREE: 12
 };
 
 /**
@@ -1159,7 +1657,13 @@ proto.protocol.ApplyUpdate.toObject = function(includeInstance, msg) {
     createScene: (f = msg.getCreateScene()) && proto.protocol.CreateScene.toObject(includeInstance, f),
     appendChild: (f = msg.getAppendChild()) && proto.protocol.AppendChild.toObject(includeInstance, f),
     removeChild: (f = msg.getRemoveChild()) && proto.protocol.RemoveChild.toObject(includeInstance, f),
-    commitUpdates: (f = msg.getCommitUpdates()) && proto.protocol.CommitUpdates.toObject(includeInstance, f)
+    commitUpdates: (f = msg.getCommitUpdates()) && proto.protocol.CommitUpdates.toObject(includeInstance, f),
+    defineKey: (f = msg.getDefineKey()) && proto.protocol.DefineKey.toObject(includeInstance, f),
+    defineString: (f = msg.getDefineString()) && proto.protocol.DefineString.toObject(includeInstance, f),
+    setLayoutValues: (f = msg.getSetLayoutValues()) && proto.protocol.SetLayoutValues.toObject(includeInstance, f),
+    insertBefore: (f = msg.getInsertBefore()) && proto.protocol.InsertBefore.toObject(includeInstance, f),
+    moveChild: (f = msg.getMoveChild()) && proto.protocol.MoveChild.toObject(includeInstance, f),
+    createTree: (f = msg.getCreateTree()) && proto.protocol.CreateTree.toObject(includeInstance, f)
   };
 
   if (includeInstance) {
@@ -1226,6 +1730,36 @@ proto.protocol.ApplyUpdate.deserializeBinaryFromReader = function(msg, reader) {
       reader.readMessage(value,proto.protocol.CommitUpdates.deserializeBinaryFromReader);
       msg.setCommitUpdates(value);
       break;
+    case 7:
+      var value = new proto.protocol.DefineKey;
+      reader.readMessage(value,proto.protocol.DefineKey.deserializeBinaryFromReader);
+      msg.setDefineKey(value);
+      break;
+    case 8:
+      var value = new proto.protocol.DefineString;
+      reader.readMessage(value,proto.protocol.DefineString.deserializeBinaryFromReader);
+      msg.setDefineString(value);
+      break;
+    case 9:
+      var value = new proto.protocol.SetLayoutValues;
+      reader.readMessage(value,proto.protocol.SetLayoutValues.deserializeBinaryFromReader);
+      msg.setSetLayoutValues(value);
+      break;
+    case 10:
+      var value = new proto.protocol.InsertBefore;
+      reader.readMessage(value,proto.protocol.InsertBefore.deserializeBinaryFromReader);
+      msg.setInsertBefore(value);
+      break;
+    case 11:
+      var value = new proto.protocol.MoveChild;
+      reader.readMessage(value,proto.protocol.MoveChild.deserializeBinaryFromReader);
+      msg.setMoveChild(value);
+      break;
+    case 12:
+      var value = new proto.protocol.CreateTree;
+      reader.readMessage(value,proto.protocol.CreateTree.deserializeBinaryFromReader);
+      msg.setCreateTree(value);
+      break;
     default:
       reader.skipField();
       break;
@@ -1303,6 +1837,54 @@ proto.protocol.ApplyUpdate.serializeBinaryToWriter = function(message, writer) {
       proto.protocol.CommitUpdates.serializeBinaryToWriter
     );
   }
+  f = message.getDefineKey();
+  if (f != null) {
+    writer.writeMessage(
+      7,
+      f,
+      proto.protocol.DefineKey.serializeBinaryToWriter
+    );
+  }
+  f = message.getDefineString();
+  if (f != null) {
+    writer.writeMessage(
+      8,
+      f,
+      proto.protocol.DefineString.serializeBinaryToWriter
+    );
+  }
+  f = message.getSetLayoutValues();
+  if (f != null) {
+    writer.writeMessage(
+      9,
+      f,
+      proto.protocol.SetLayoutValues.serializeBinaryToWriter
+    );
+  }
+  f = message.getInsertBefore();
+  if (f != null) {
+    writer.writeMessage(
+      10,
+      f,
+      proto.protocol.InsertBefore.serializeBinaryToWriter
+    );
+  }
+  f = message.getMoveChild();
+  if (f != null) {
+    writer.writeMessage(
+      11,
+      f,
+      proto.protocol.MoveChild.serializeBinaryToWriter
+    );
+  }
+  f = message.getCreateTree();
+  if (f != null) {
+    writer.writeMessage(
+      12,
+      f,
+      proto.protocol.CreateTree.serializeBinaryToWriter
+    );
+  }
 };
 
 
@@ -1528,197 +2110,236 @@ proto.protocol.ApplyUpdate.prototype.hasCommitUpdates = function() {
 };
 
 
+/**
+ * optional DefineKey define_key = 7;
+ * @return {?proto.protocol.DefineKey}
+ */
+proto.protocol.ApplyUpdate.prototype.getDefineKey = function() {
+  return /** @type{?proto.protocol.DefineKey} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.DefineKey, 7));
+};
 
 
-
-if (jspb.Message.GENERATE_TO_OBJECT) {
 /**
- * Creates an object representation of this proto.
- * Field names that are reserved in JavaScript and will be renamed to pb_name.
- * Optional fields that are not set will be set to undefined.
- * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
- * For the list of reserved names please see:
- *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
- * @param {boolean=} opt_includeInstance Deprecated. whether to include the
- *     JSPB instance for transitional soy proto support:
- *     http://goto/soy-param-migration
- * @return {!Object}
- */
-proto.protocol.FindSourceRequest.prototype.toObject = function(opt_includeInstance) {
-  return proto.protocol.FindSourceRequest.toObject(opt_includeInstance, this);
+ * @param {?proto.protocol.DefineKey|undefined} value
+ * @return {!proto.protocol.ApplyUpdate} returns this
+*/
+proto.protocol.ApplyUpdate.prototype.setDefineKey = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 7, proto.protocol.ApplyUpdate.oneofGroups_[0], value);
 };
 
 
 /**
- * Static version of the {@see toObject} method.
- * @param {boolean|undefined} includeInstance Deprecated. Whether to include
- *     the JSPB instance for transitional soy proto support:
- *     http://goto/soy-param-migration
- * @param {!proto.protocol.FindSourceRequest} msg The msg instance to transform.
- * @return {!Object}
- * @suppress {unusedLocalVariables} f is only used for nested messages
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.ApplyUpdate} returns this
  */
-proto.protocol.FindSourceRequest.toObject = function(includeInstance, msg) {
-  var f, obj = {
-    requestId: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    uid: jspb.Message.getFieldWithDefault(msg, 2, ""),
-    name: jspb.Message.getFieldWithDefault(msg, 3, "")
-  };
-
-  if (includeInstance) {
-    obj.$jspbMessageInstance = msg;
-  }
-  return obj;
+proto.protocol.ApplyUpdate.prototype.clearDefineKey = function() {
+  return this.setDefineKey(undefined);
 };
-}
 
 
 /**
- * Deserializes binary data (in protobuf wire format).
- * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.protocol.FindSourceRequest}
+ * Returns whether this field is set.
+ * @return {boolean}
  */
-proto.protocol.FindSourceRequest.deserializeBinary = function(bytes) {
-  var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.protocol.FindSourceRequest;
-  return proto.protocol.FindSourceRequest.deserializeBinaryFromReader(msg, reader);
+proto.protocol.ApplyUpdate.prototype.hasDefineKey = function() {
+  return jspb.Message.getField(this, 7) != null;
 };
 
 
 /**
- * Deserializes binary data (in protobuf wire format) from the
- * given reader into the given message object.
- * @param {!proto.protocol.FindSourceRequest} msg The message object to deserialize into.
- * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.protocol.FindSourceRequest}
+ * optional DefineString define_string = 8;
+ * @return {?proto.protocol.DefineString}
  */
-proto.protocol.FindSourceRequest.deserializeBinaryFromReader = function(msg, reader) {
-  while (reader.nextField()) {
-    if (reader.isEndGroup()) {
-      break;
-    }
-    var field = reader.getFieldNumber();
-    switch (field) {
-    case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setRequestId(value);
-      break;
-    case 2:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setUid(value);
-      break;
-    case 3:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setName(value);
-      break;
-    default:
-      reader.skipField();
-      break;
-    }
-  }
-  return msg;
+proto.protocol.ApplyUpdate.prototype.getDefineString = function() {
+  return /** @type{?proto.protocol.DefineString} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.DefineString, 8));
 };
 
 
 /**
- * Serializes the message to binary data (in protobuf wire format).
- * @return {!Uint8Array}
- */
-proto.protocol.FindSourceRequest.prototype.serializeBinary = function() {
-  var writer = new jspb.BinaryWriter();
-  proto.protocol.FindSourceRequest.serializeBinaryToWriter(this, writer);
-  return writer.getResultBuffer();
+ * @param {?proto.protocol.DefineString|undefined} value
+ * @return {!proto.protocol.ApplyUpdate} returns this
+*/
+proto.protocol.ApplyUpdate.prototype.setDefineString = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 8, proto.protocol.ApplyUpdate.oneofGroups_[0], value);
 };
 
 
 /**
- * Serializes the given message to binary data (in protobuf wire
- * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.FindSourceRequest} message
- * @param {!jspb.BinaryWriter} writer
- * @suppress {unusedLocalVariables} f is only used for nested messages
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.ApplyUpdate} returns this
  */
-proto.protocol.FindSourceRequest.serializeBinaryToWriter = function(message, writer) {
-  var f = undefined;
-  f = message.getRequestId();
-  if (f.length > 0) {
-    writer.writeString(
-      1,
-      f
-    );
-  }
-  f = message.getUid();
-  if (f.length > 0) {
-    writer.writeString(
-      2,
-      f
-    );
-  }
-  f = message.getName();
-  if (f.length > 0) {
-    writer.writeString(
-      3,
-      f
-    );
-  }
+proto.protocol.ApplyUpdate.prototype.clearDefineString = function() {
+  return this.setDefineString(undefined);
 };
 
 
 /**
- * optional string request_id = 1;
- * @return {string}
+ * Returns whether this field is set.
+ * @return {boolean}
  */
-proto.protocol.FindSourceRequest.prototype.getRequestId = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.protocol.ApplyUpdate.prototype.hasDefineString = function() {
+  return jspb.Message.getField(this, 8) != null;
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.FindSourceRequest} returns this
+ * optional SetLayoutValues set_layout_values = 9;
+ * @return {?proto.protocol.SetLayoutValues}
  */
-proto.protocol.FindSourceRequest.prototype.setRequestId = function(value) {
-  return jspb.Message.setProto3StringField(this, 1, value);
+proto.protocol.ApplyUpdate.prototype.getSetLayoutValues = function() {
+  return /** @type{?proto.protocol.SetLayoutValues} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.SetLayoutValues, 9));
 };
 
 
 /**
- * optional string uid = 2;
- * @return {string}
+ * @param {?proto.protocol.SetLayoutValues|undefined} value
+ * @return {!proto.protocol.ApplyUpdate} returns this
+*/
+proto.protocol.ApplyUpdate.prototype.setSetLayoutValues = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 9, proto.protocol.ApplyUpdate.oneofGroups_[0], value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.ApplyUpdate} returns this
  */
-proto.protocol.FindSourceRequest.prototype.getUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+proto.protocol.ApplyUpdate.prototype.clearSetLayoutValues = function() {
+  return this.setSetLayoutValues(undefined);
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.FindSourceRequest} returns this
+ * Returns whether this field is set.
+ * @return {boolean}
  */
-proto.protocol.FindSourceRequest.prototype.setUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 2, value);
+proto.protocol.ApplyUpdate.prototype.hasSetLayoutValues = function() {
+  return jspb.Message.getField(this, 9) != null;
 };
 
 
 /**
- * optional string name = 3;
- * @return {string}
+ * optional InsertBefore insert_before = 10;
+ * @return {?proto.protocol.InsertBefore}
  */
-proto.protocol.FindSourceRequest.prototype.getName = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 3, ""));
+proto.protocol.ApplyUpdate.prototype.getInsertBefore = function() {
+  return /** @type{?proto.protocol.InsertBefore} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.InsertBefore, 10));
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.FindSourceRequest} returns this
+ * @param {?proto.protocol.InsertBefore|undefined} value
+ * @return {!proto.protocol.ApplyUpdate} returns this
+*/
+proto.protocol.ApplyUpdate.prototype.setInsertBefore = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 10, proto.protocol.ApplyUpdate.oneofGroups_[0], value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.ApplyUpdate} returns this
  */
-proto.protocol.FindSourceRequest.prototype.setName = function(value) {
-  return jspb.Message.setProto3StringField(this, 3, value);
+proto.protocol.ApplyUpdate.prototype.clearInsertBefore = function() {
+  return this.setInsertBefore(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.ApplyUpdate.prototype.hasInsertBefore = function() {
+  return jspb.Message.getField(this, 10) != null;
+};
+
+
+/**
+ * optional MoveChild move_child = 11;
+ * @return {?proto.protocol.MoveChild}
+ */
+proto.protocol.ApplyUpdate.prototype.getMoveChild = function() {
+  return /** @type{?proto.protocol.MoveChild} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.MoveChild, 11));
+};
+
+
+/**
+ * @param {?proto.protocol.MoveChild|undefined} value
+ * @return {!proto.protocol.ApplyUpdate} returns this
+*/
+proto.protocol.ApplyUpdate.prototype.setMoveChild = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 11, proto.protocol.ApplyUpdate.oneofGroups_[0], value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.ApplyUpdate} returns this
+ */
+proto.protocol.ApplyUpdate.prototype.clearMoveChild = function() {
+  return this.setMoveChild(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.ApplyUpdate.prototype.hasMoveChild = function() {
+  return jspb.Message.getField(this, 11) != null;
+};
+
+
+/**
+ * optional CreateTree create_tree = 12;
+ * @return {?proto.protocol.CreateTree}
+ */
+proto.protocol.ApplyUpdate.prototype.getCreateTree = function() {
+  return /** @type{?proto.protocol.CreateTree} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.CreateTree, 12));
+};
+
+
+/**
+ * @param {?proto.protocol.CreateTree|undefined} value
+ * @return {!proto.protocol.ApplyUpdate} returns this
+*/
+proto.protocol.ApplyUpdate.prototype.setCreateTree = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 12, proto.protocol.ApplyUpdate.oneofGroups_[0], value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.ApplyUpdate} returns this
+ */
+proto.protocol.ApplyUpdate.prototype.clearCreateTree = function() {
+  return this.setCreateTree(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.ApplyUpdate.prototype.hasCreateTree = function() {
+  return jspb.Message.getField(this, 12) != null;
 };
 
 
 
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.protocol.UpdateBatch.repeatedFields_ = [1];
+
 
 
 if (jspb.Message.GENERATE_TO_OBJECT) {
@@ -1734,8 +2355,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.protocol.Response.prototype.toObject = function(opt_includeInstance) {
-  return proto.protocol.Response.toObject(opt_includeInstance, this);
+proto.protocol.UpdateBatch.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.UpdateBatch.toObject(opt_includeInstance, this);
 };
 
 
@@ -1744,14 +2365,14 @@ proto.protocol.Response.prototype.toObject = function(opt_includeInstance) {
  * @param {boolean|undefined} includeInstance Deprecated. Whether to include
  *     the JSPB instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.protocol.Response} msg The msg instance to transform.
+ * @param {!proto.protocol.UpdateBatch} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.Response.toObject = function(includeInstance, msg) {
+proto.protocol.UpdateBatch.toObject = function(includeInstance, msg) {
   var f, obj = {
-    requestId: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    success: jspb.Message.getBooleanFieldWithDefault(msg, 2, false)
+    updatesList: jspb.Message.toObjectList(msg.getUpdatesList(),
+    proto.protocol.ApplyUpdate.toObject, includeInstance)
   };
 
   if (includeInstance) {
@@ -1765,23 +2386,23 @@ proto.protocol.Response.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.protocol.Response}
+ * @return {!proto.protocol.UpdateBatch}
  */
-proto.protocol.Response.deserializeBinary = function(bytes) {
+proto.protocol.UpdateBatch.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.protocol.Response;
-  return proto.protocol.Response.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.protocol.UpdateBatch;
+  return proto.protocol.UpdateBatch.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.protocol.Response} msg The message object to deserialize into.
+ * @param {!proto.protocol.UpdateBatch} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.protocol.Response}
+ * @return {!proto.protocol.UpdateBatch}
  */
-proto.protocol.Response.deserializeBinaryFromReader = function(msg, reader) {
+proto.protocol.UpdateBatch.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -1789,12 +2410,9 @@ proto.protocol.Response.deserializeBinaryFromReader = function(msg, reader) {
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setRequestId(value);
-      break;
-    case 2:
-      var value = /** @type {boolean} */ (reader.readBool());
-      msg.setSuccess(value);
+      var value = new proto.protocol.ApplyUpdate;
+      reader.readMessage(value,proto.protocol.ApplyUpdate.deserializeBinaryFromReader);
+      msg.addUpdates(value);
       break;
     default:
       reader.skipField();
@@ -1809,9 +2427,9 @@ proto.protocol.Response.deserializeBinaryFromReader = function(msg, reader) {
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.protocol.Response.prototype.serializeBinary = function() {
+proto.protocol.UpdateBatch.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.Response.serializeBinaryToWriter(this, writer);
+  proto.protocol.UpdateBatch.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -1819,62 +2437,58 @@ proto.protocol.Response.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.Response} message
+ * @param {!proto.protocol.UpdateBatch} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.Response.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.UpdateBatch.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getRequestId();
+  f = message.getUpdatesList();
   if (f.length > 0) {
-    writer.writeString(
+    writer.writeRepeatedMessage(
       1,
-      f
-    );
-  }
-  f = message.getSuccess();
-  if (f) {
-    writer.writeBool(
-      2,
-      f
+      f,
+      proto.protocol.ApplyUpdate.serializeBinaryToWriter
     );
   }
 };
 
 
 /**
- * optional string request_id = 1;
- * @return {string}
+ * repeated ApplyUpdate updates = 1;
+ * @return {!Array<!proto.protocol.ApplyUpdate>}
  */
-proto.protocol.Response.prototype.getRequestId = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.protocol.UpdateBatch.prototype.getUpdatesList = function() {
+  return /** @type{!Array<!proto.protocol.ApplyUpdate>} */ (
+    jspb.Message.getRepeatedWrapperField(this, proto.protocol.ApplyUpdate, 1));
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.Response} returns this
- */
-proto.protocol.Response.prototype.setRequestId = function(value) {
-  return jspb.Message.setProto3StringField(this, 1, value);
+ * @param {!Array<!proto.protocol.ApplyUpdate>} value
+ * @return {!proto.protocol.UpdateBatch} returns this
+*/
+proto.protocol.UpdateBatch.prototype.setUpdatesList = function(value) {
+  return jspb.Message.setRepeatedWrapperField(this, 1, value);
 };
 
 
 /**
- * optional bool success = 2;
- * @return {boolean}
+ * @param {!proto.protocol.ApplyUpdate=} opt_value
+ * @param {number=} opt_index
+ * @return {!proto.protocol.ApplyUpdate}
  */
-proto.protocol.Response.prototype.getSuccess = function() {
-  return /** @type {boolean} */ (jspb.Message.getBooleanFieldWithDefault(this, 2, false));
+proto.protocol.UpdateBatch.prototype.addUpdates = function(opt_value, opt_index) {
+  return jspb.Message.addToRepeatedWrapperField(this, 1, opt_value, proto.protocol.ApplyUpdate, opt_index);
 };
 
 
 /**
- * @param {boolean} value
- * @return {!proto.protocol.Response} returns this
+ * Clears the list making it empty but non-null.
+ * @return {!proto.protocol.UpdateBatch} returns this
  */
-proto.protocol.Response.prototype.setSuccess = function(value) {
-  return jspb.Message.setProto3BooleanField(this, 2, value);
+proto.protocol.UpdateBatch.prototype.clearUpdatesList = function() {
+  return this.setUpdatesList([]);
 };
 
 
@@ -1894,8 +2508,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.protocol.CreateSource.prototype.toObject = function(opt_includeInstance) {
-  return proto.protocol.CreateSource.toObject(opt_includeInstance, this);
+proto.protocol.FindSourceRequest.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.FindSourceRequest.toObject(opt_includeInstance, this);
 };
 
 
@@ -1904,17 +2518,16 @@ proto.protocol.CreateSource.prototype.toObject = function(opt_includeInstance) {
  * @param {boolean|undefined} includeInstance Deprecated. Whether to include
  *     the JSPB instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.protocol.CreateSource} msg The msg instance to transform.
+ * @param {!proto.protocol.FindSourceRequest} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.CreateSource.toObject = function(includeInstance, msg) {
+proto.protocol.FindSourceRequest.toObject = function(includeInstance, msg) {
   var f, obj = {
-    uid: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    containerUid: jspb.Message.getFieldWithDefault(msg, 5, ""),
-    id: jspb.Message.getFieldWithDefault(msg, 2, ""),
+    requestId: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    uid: jspb.Message.getFieldWithDefault(msg, 2, ""),
     name: jspb.Message.getFieldWithDefault(msg, 3, ""),
-    settings: (f = msg.getSettings()) && proto.protocol.ObjectValue.toObject(includeInstance, f)
+    handle: jspb.Message.getFieldWithDefault(msg, 4, 0)
   };
 
   if (includeInstance) {
@@ -1928,23 +2541,23 @@ proto.protocol.CreateSource.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.protocol.CreateSource}
+ * @return {!proto.protocol.FindSourceRequest}
  */
-proto.protocol.CreateSource.deserializeBinary = function(bytes) {
+proto.protocol.FindSourceRequest.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.protocol.CreateSource;
-  return proto.protocol.CreateSource.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.protocol.FindSourceRequest;
+  return proto.protocol.FindSourceRequest.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.protocol.CreateSource} msg The message object to deserialize into.
+ * @param {!proto.protocol.FindSourceRequest} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.protocol.CreateSource}
+ * @return {!proto.protocol.FindSourceRequest}
  */
-proto.protocol.CreateSource.deserializeBinaryFromReader = function(msg, reader) {
+proto.protocol.FindSourceRequest.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -1953,24 +2566,19 @@ proto.protocol.CreateSource.deserializeBinaryFromReader = function(msg, reader)
     switch (field) {
     case 1:
       var value = /** @type {string} */ (reader.readString());
-      msg.setUid(value);
-      break;
-    case 5:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setContainerUid(value);
+      msg.setRequestId(value);
       break;
     case 2:
       var value = /** @type {string} */ (reader.readString());
-      msg.setId(value);
+      msg.setUid(value);
       break;
     case 3:
       var value = /** @type {string} */ (reader.readString());
       msg.setName(value);
       break;
     case 4:
-      var value = new proto.protocol.ObjectValue;
-      reader.readMessage(value,proto.protocol.ObjectValue.deserializeBinaryFromReader);
-      msg.setSettings(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setHandle(value);
       break;
     default:
       reader.skipField();
@@ -1985,9 +2593,9 @@ proto.protocol.CreateSource.deserializeBinaryFromReader = function(msg, reader)
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.protocol.CreateSource.prototype.serializeBinary = function() {
+proto.protocol.FindSourceRequest.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.CreateSource.serializeBinaryToWriter(this, writer);
+  proto.protocol.FindSourceRequest.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -1995,27 +2603,20 @@ proto.protocol.CreateSource.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.CreateSource} message
+ * @param {!proto.protocol.FindSourceRequest} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.CreateSource.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.FindSourceRequest.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getUid();
+  f = message.getRequestId();
   if (f.length > 0) {
     writer.writeString(
       1,
       f
     );
   }
-  f = message.getContainerUid();
-  if (f.length > 0) {
-    writer.writeString(
-      5,
-      f
-    );
-  }
-  f = message.getId();
+  f = message.getUid();
   if (f.length > 0) {
     writer.writeString(
       2,
@@ -2029,67 +2630,48 @@ proto.protocol.CreateSource.serializeBinaryToWriter = function(message, writer)
       f
     );
   }
-  f = message.getSettings();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getHandle();
+  if (f !== 0) {
+    writer.writeUint32(
       4,
-      f,
-      proto.protocol.ObjectValue.serializeBinaryToWriter
+      f
     );
   }
 };
 
 
 /**
- * optional string uid = 1;
+ * optional string request_id = 1;
  * @return {string}
  */
-proto.protocol.CreateSource.prototype.getUid = function() {
+proto.protocol.FindSourceRequest.prototype.getRequestId = function() {
   return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
 };
 
 
 /**
  * @param {string} value
- * @return {!proto.protocol.CreateSource} returns this
+ * @return {!proto.protocol.FindSourceRequest} returns this
  */
-proto.protocol.CreateSource.prototype.setUid = function(value) {
+proto.protocol.FindSourceRequest.prototype.setRequestId = function(value) {
   return jspb.Message.setProto3StringField(this, 1, value);
 };
 
 
 /**
- * optional string container_uid = 5;
- * @return {string}
- */
-proto.protocol.CreateSource.prototype.getContainerUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 5, ""));
-};
-
-
-/**
- * @param {string} value
- * @return {!proto.protocol.CreateSource} returns this
- */
-proto.protocol.CreateSource.prototype.setContainerUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 5, value);
-};
-
-
-/**
- * optional string id = 2;
+ * optional string uid = 2;
  * @return {string}
  */
-proto.protocol.CreateSource.prototype.getId = function() {
+proto.protocol.FindSourceRequest.prototype.getUid = function() {
   return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
 };
 
 
 /**
  * @param {string} value
- * @return {!proto.protocol.CreateSource} returns this
+ * @return {!proto.protocol.FindSourceRequest} returns this
  */
-proto.protocol.CreateSource.prototype.setId = function(value) {
+proto.protocol.FindSourceRequest.prototype.setUid = function(value) {
   return jspb.Message.setProto3StringField(this, 2, value);
 };
 
@@ -2098,54 +2680,35 @@ proto.protocol.CreateSource.prototype.setId = function(value) {
  * optional string name = 3;
  * @return {string}
  */
-proto.protocol.CreateSource.prototype.getName = function() {
+proto.protocol.FindSourceRequest.prototype.getName = function() {
   return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 3, ""));
 };
 
 
 /**
  * @param {string} value
- * @return {!proto.protocol.CreateSource} returns this
+ * @return {!proto.protocol.FindSourceRequest} returns this
  */
-proto.protocol.CreateSource.prototype.setName = function(value) {
+proto.protocol.FindSourceRequest.prototype.setName = function(value) {
   return jspb.Message.setProto3StringField(this, 3, value);
 };
 
 
 /**
- * optional ObjectValue settings = 4;
- * @return {?proto.protocol.ObjectValue}
- */
-proto.protocol.CreateSource.prototype.getSettings = function() {
-  return /** @type{?proto.protocol.ObjectValue} */ (
-    jspb.Message.getWrapperField(this, proto.protocol.ObjectValue, 4));
-};
-
-
-/**
- * @param {?proto.protocol.ObjectValue|undefined} value
- * @return {!proto.protocol.CreateSource} returns this
-*/
-proto.protocol.CreateSource.prototype.setSettings = function(value) {
-  return jspb.Message.setWrapperField(this, 4, value);
-};
-
-
-/**
- * Clears the message field making it undefined.
- * @return {!proto.protocol.CreateSource} returns this
+ * optional uint32 handle = 4;
+ * @return {number}
  */
-proto.protocol.CreateSource.prototype.clearSettings = function() {
-  return this.setSettings(undefined);
+proto.protocol.FindSourceRequest.prototype.getHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 4, 0));
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {boolean}
+ * @param {number} value
+ * @return {!proto.protocol.FindSourceRequest} returns this
  */
-proto.protocol.CreateSource.prototype.hasSettings = function() {
-  return jspb.Message.getField(this, 4) != null;
+proto.protocol.FindSourceRequest.prototype.setHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 4, value);
 };
 
 
@@ -2165,8 +2728,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.protocol.UpdateSource.prototype.toObject = function(opt_includeInstance) {
-  return proto.protocol.UpdateSource.toObject(opt_includeInstance, this);
+proto.protocol.Response.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.Response.toObject(opt_includeInstance, this);
 };
 
 
@@ -2175,14 +2738,18 @@ proto.protocol.UpdateSource.prototype.toObject = function(opt_includeInstance) {
  * @param {boolean|undefined} includeInstance Deprecated. Whether to include
  *     the JSPB instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.protocol.UpdateSource} msg The msg instance to transform.
+ * @param {!proto.protocol.Response} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.UpdateSource.toObject = function(includeInstance, msg) {
+proto.protocol.Response.toObject = function(includeInstance, msg) {
   var f, obj = {
-    uid: jspb.Message.getFieldWithDefault(msg, 2, ""),
-    changedProps: (f = msg.getChangedProps()) && proto.protocol.ObjectValue.toObject(includeInstance, f)
+    requestId: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    success: jspb.Message.getBooleanFieldWithDefault(msg, 2, false),
+    sharedMemory: (f = msg.getSharedMemory()) && proto.protocol.SharedMemoryTransport.toObject(includeInstance, f),
+    updateCredits: jspb.Message.getFieldWithDefault(msg, 4, 0),
+    compression: (f = msg.getCompression()) && proto.protocol.FrameCompression.toObject(includeInstance, f),
+    sessionResumed: jspb.Message.getBooleanFieldWithDefault(msg, 6, false)
   };
 
   if (includeInstance) {
@@ -2196,37 +2763,54 @@ proto.protocol.UpdateSource.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.protocol.UpdateSource}
+ * @return {!proto.protocol.Response}
  */
-proto.protocol.UpdateSource.deserializeBinary = function(bytes) {
+proto.protocol.Response.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.protocol.UpdateSource;
-  return proto.protocol.UpdateSource.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.protocol.Response;
+  return proto.protocol.Response.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.protocol.UpdateSource} msg The message object to deserialize into.
+ * @param {!proto.protocol.Response} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.protocol.UpdateSource}
+ * @return {!proto.protocol.Response}
  */
-proto.protocol.UpdateSource.deserializeBinaryFromReader = function(msg, reader) {
+proto.protocol.Response.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
     }
     var field = reader.getFieldNumber();
     switch (field) {
-    case 2:
+    case 1:
       var value = /** @type {string} */ (reader.readString());
-      msg.setUid(value);
+      msg.setRequestId(value);
+      break;
+    case 2:
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setSuccess(value);
       break;
     case 3:
-      var value = new proto.protocol.ObjectValue;
-      reader.readMessage(value,proto.protocol.ObjectValue.deserializeBinaryFromReader);
-      msg.setChangedProps(value);
+      var value = new proto.protocol.SharedMemoryTransport;
+      reader.readMessage(value,proto.protocol.SharedMemoryTransport.deserializeBinaryFromReader);
+      msg.setSharedMemory(value);
+      break;
+    case 4:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setUpdateCredits(value);
+      break;
+    case 5:
+      var value = new proto.protocol.FrameCompression;
+      reader.readMessage(value,proto.protocol.FrameCompression.deserializeBinaryFromReader);
+      msg.setCompression(value);
+      break;
+    case 6:
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setSessionResumed(value);
       break;
     default:
       reader.skipField();
@@ -2241,9 +2825,9 @@ proto.protocol.UpdateSource.deserializeBinaryFromReader = function(msg, reader)
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.protocol.UpdateSource.prototype.serializeBinary = function() {
+proto.protocol.Response.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.UpdateSource.serializeBinaryToWriter(this, writer);
+  proto.protocol.Response.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -2251,73 +2835,120 @@ proto.protocol.UpdateSource.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.UpdateSource} message
+ * @param {!proto.protocol.Response} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.UpdateSource.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.Response.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getUid();
+  f = message.getRequestId();
   if (f.length > 0) {
     writer.writeString(
+      1,
+      f
+    );
+  }
+  f = message.getSuccess();
+  if (f) {
+    writer.writeBool(
       2,
       f
     );
   }
-  f = message.getChangedProps();
+  f = message.getSharedMemory();
   if (f != null) {
     writer.writeMessage(
       3,
       f,
-      proto.protocol.ObjectValue.serializeBinaryToWriter
+      proto.protocol.SharedMemoryTransport.serializeBinaryToWriter
+    );
+  }
+  f = message.getUpdateCredits();
+  if (f !== 0) {
+    writer.writeUint32(
+      4,
+      f
+    );
+  }
+  f = message.getCompression();
+  if (f != null) {
+    writer.writeMessage(
+      5,
+      f,
+      proto.protocol.FrameCompression.serializeBinaryToWriter
+    );
+  }
+  f = message.getSessionResumed();
+  if (f) {
+    writer.writeBool(
+      6,
+      f
     );
   }
 };
 
 
 /**
- * optional string uid = 2;
+ * optional string request_id = 1;
  * @return {string}
  */
-proto.protocol.UpdateSource.prototype.getUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+proto.protocol.Response.prototype.getRequestId = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
 };
 
 
 /**
  * @param {string} value
- * @return {!proto.protocol.UpdateSource} returns this
+ * @return {!proto.protocol.Response} returns this
  */
-proto.protocol.UpdateSource.prototype.setUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 2, value);
+proto.protocol.Response.prototype.setRequestId = function(value) {
+  return jspb.Message.setProto3StringField(this, 1, value);
 };
 
 
 /**
- * optional ObjectValue changed_props = 3;
- * @return {?proto.protocol.ObjectValue}
+ * optional bool success = 2;
+ * @return {boolean}
  */
-proto.protocol.UpdateSource.prototype.getChangedProps = function() {
-  return /** @type{?proto.protocol.ObjectValue} */ (
-    jspb.Message.getWrapperField(this, proto.protocol.ObjectValue, 3));
+proto.protocol.Response.prototype.getSuccess = function() {
+  return /** @type {boolean} */ (jspb.Message.getBooleanFieldWithDefault(this, 2, false));
 };
 
 
 /**
- * @param {?proto.protocol.ObjectValue|undefined} value
- * @return {!proto.protocol.UpdateSource} returns this
+ * @param {boolean} value
+ * @return {!proto.protocol.Response} returns this
+ */
+proto.protocol.Response.prototype.setSuccess = function(value) {
+  return jspb.Message.setProto3BooleanField(this, 2, value);
+};
+
+
+/**
+ * optional SharedMemoryTransport shared_memory = 3;
+ * @return {?proto.protocol.SharedMemoryTransport}
+ */
+proto.protocol.Response.prototype.getSharedMemory = function() {
+  return /** @type{?proto.protocol.SharedMemoryTransport} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.SharedMemoryTransport, 3));
+};
+
+
+/**
+ * @param {?proto.protocol.SharedMemoryTransport|undefined} value
+ * @return {!proto.protocol.Response} returns this
 */
-proto.protocol.UpdateSource.prototype.setChangedProps = function(value) {
+proto.protocol.Response.prototype.setSharedMemory = function(value) {
   return jspb.Message.setWrapperField(this, 3, value);
 };
 
 
 /**
  * Clears the message field making it undefined.
- * @return {!proto.protocol.UpdateSource} returns this
+ * @return {!proto.protocol.Response} returns this
  */
-proto.protocol.UpdateSource.prototype.clearChangedProps = function() {
-  return this.setChangedProps(undefined);
+proto.protocol.Response.prototype.clearSharedMemory = function() {
+  return this.setSharedMemory(undefined);
 };
 
 
@@ -2325,11 +2956,84 @@ proto.protocol.UpdateSource.prototype.clearChangedProps = function() {
  * Returns whether this field is set.
  * @return {boolean}
  */
-proto.protocol.UpdateSource.prototype.hasChangedProps = function() {
+proto.protocol.Response.prototype.hasSharedMemory = function() {
   return jspb.Message.getField(this, 3) != null;
 };
 
 
+/**
+ * optional uint32 update_credits = 4;
+ * @return {number}
+ */
+proto.protocol.Response.prototype.getUpdateCredits = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 4, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.Response} returns this
+ */
+proto.protocol.Response.prototype.setUpdateCredits = function(value) {
+  return jspb.Message.setProto3IntField(this, 4, value);
+};
+
+
+/**
+ * optional FrameCompression compression = 5;
+ * @return {?proto.protocol.FrameCompression}
+ */
+proto.protocol.Response.prototype.getCompression = function() {
+  return /** @type{?proto.protocol.FrameCompression} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.FrameCompression, 5));
+};
+
+
+/**
+ * @param {?proto.protocol.FrameCompression|undefined} value
+ * @return {!proto.protocol.Response} returns this
+*/
+proto.protocol.Response.prototype.setCompression = function(value) {
+  return jspb.Message.setWrapperField(this, 5, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Response} returns this
+ */
+proto.protocol.Response.prototype.clearCompression = function() {
+  return this.setCompression(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Response.prototype.hasCompression = function() {
+  return jspb.Message.getField(this, 5) != null;
+};
+
+
+/**
+ * optional bool session_resumed = 6;
+ * @return {boolean}
+ */
+proto.protocol.Response.prototype.getSessionResumed = function() {
+  return /** @type {boolean} */ (jspb.Message.getBooleanFieldWithDefault(this, 6, false));
+};
+
+
+/**
+ * @param {boolean} value
+ * @return {!proto.protocol.Response} returns this
+ */
+proto.protocol.Response.prototype.setSessionResumed = function(value) {
+  return jspb.Message.setProto3BooleanField(this, 6, value);
+};
+
+
 
 
 
@@ -2346,8 +3050,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.protocol.CreateScene.prototype.toObject = function(opt_includeInstance) {
-  return proto.protocol.CreateScene.toObject(opt_includeInstance, this);
+proto.protocol.SharedMemoryTransport.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.SharedMemoryTransport.toObject(opt_includeInstance, this);
 };
 
 
@@ -2356,16 +3060,13 @@ proto.protocol.CreateScene.prototype.toObject = function(opt_includeInstance) {
  * @param {boolean|undefined} includeInstance Deprecated. Whether to include
  *     the JSPB instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.protocol.CreateScene} msg The msg instance to transform.
+ * @param {!proto.protocol.SharedMemoryTransport} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.CreateScene.toObject = function(includeInstance, msg) {
+proto.protocol.SharedMemoryTransport.toObject = function(includeInstance, msg) {
   var f, obj = {
-    uid: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    containerUid: jspb.Message.getFieldWithDefault(msg, 4, ""),
-    name: jspb.Message.getFieldWithDefault(msg, 2, ""),
-    props: (f = msg.getProps()) && proto.protocol.ObjectValue.toObject(includeInstance, f)
+    ringSize: jspb.Message.getFieldWithDefault(msg, 1, 0)
   };
 
   if (includeInstance) {
@@ -2379,23 +3080,23 @@ proto.protocol.CreateScene.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.protocol.CreateScene}
+ * @return {!proto.protocol.SharedMemoryTransport}
  */
-proto.protocol.CreateScene.deserializeBinary = function(bytes) {
+proto.protocol.SharedMemoryTransport.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.protocol.CreateScene;
-  return proto.protocol.CreateScene.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.protocol.SharedMemoryTransport;
+  return proto.protocol.SharedMemoryTransport.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.protocol.CreateScene} msg The message object to deserialize into.
+ * @param {!proto.protocol.SharedMemoryTransport} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.protocol.CreateScene}
+ * @return {!proto.protocol.SharedMemoryTransport}
  */
-proto.protocol.CreateScene.deserializeBinaryFromReader = function(msg, reader) {
+proto.protocol.SharedMemoryTransport.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -2403,21 +3104,148 @@ proto.protocol.CreateScene.deserializeBinaryFromReader = function(msg, reader) {
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setUid(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setRingSize(value);
       break;
-    case 4:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setContainerUid(value);
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.SharedMemoryTransport.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.SharedMemoryTransport.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.SharedMemoryTransport} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.SharedMemoryTransport.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getRingSize();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint32 ring_size = 1;
+ * @return {number}
+ */
+proto.protocol.SharedMemoryTransport.prototype.getRingSize = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.SharedMemoryTransport} returns this
+ */
+proto.protocol.SharedMemoryTransport.prototype.setRingSize = function(value) {
+  return jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.FrameCompression.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.FrameCompression.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.FrameCompression} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.FrameCompression.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    algorithm: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    threshold: jspb.Message.getFieldWithDefault(msg, 2, 0),
+    dictionary: msg.getDictionary_asB64()
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.FrameCompression}
+ */
+proto.protocol.FrameCompression.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.FrameCompression;
+  return proto.protocol.FrameCompression.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.FrameCompression} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.FrameCompression}
+ */
+proto.protocol.FrameCompression.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {!proto.protocol.Compression} */ (reader.readEnum());
+      msg.setAlgorithm(value);
       break;
     case 2:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setName(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setThreshold(value);
       break;
     case 3:
-      var value = new proto.protocol.ObjectValue;
-      reader.readMessage(value,proto.protocol.ObjectValue.deserializeBinaryFromReader);
-      msg.setProps(value);
+      var value = /** @type {!Uint8Array} */ (reader.readBytes());
+      msg.setDictionary(value);
       break;
     default:
       reader.skipField();
@@ -2432,9 +3260,9 @@ proto.protocol.CreateScene.deserializeBinaryFromReader = function(msg, reader) {
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.protocol.CreateScene.prototype.serializeBinary = function() {
+proto.protocol.FrameCompression.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.CreateScene.serializeBinaryToWriter(this, writer);
+  proto.protocol.FrameCompression.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -2442,132 +3270,111 @@ proto.protocol.CreateScene.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.CreateScene} message
+ * @param {!proto.protocol.FrameCompression} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.CreateScene.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.FrameCompression.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getUid();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getAlgorithm();
+  if (f !== 0.0) {
+    writer.writeEnum(
       1,
       f
     );
   }
-  f = message.getContainerUid();
-  if (f.length > 0) {
-    writer.writeString(
-      4,
-      f
-    );
-  }
-  f = message.getName();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getThreshold();
+  if (f !== 0) {
+    writer.writeUint32(
       2,
       f
     );
   }
-  f = message.getProps();
-  if (f != null) {
-    writer.writeMessage(
+  f = message.getDictionary_asU8();
+  if (f.length > 0) {
+    writer.writeBytes(
       3,
-      f,
-      proto.protocol.ObjectValue.serializeBinaryToWriter
+      f
     );
   }
 };
 
 
 /**
- * optional string uid = 1;
- * @return {string}
- */
-proto.protocol.CreateScene.prototype.getUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
-};
-
-
-/**
- * @param {string} value
- * @return {!proto.protocol.CreateScene} returns this
+ * optional Compression algorithm = 1;
+ * @return {!proto.protocol.Compression}
  */
-proto.protocol.CreateScene.prototype.setUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 1, value);
+proto.protocol.FrameCompression.prototype.getAlgorithm = function() {
+  return /** @type {!proto.protocol.Compression} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
 };
 
 
 /**
- * optional string container_uid = 4;
- * @return {string}
+ * @param {!proto.protocol.Compression} value
+ * @return {!proto.protocol.FrameCompression} returns this
  */
-proto.protocol.CreateScene.prototype.getContainerUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 4, ""));
+proto.protocol.FrameCompression.prototype.setAlgorithm = function(value) {
+  return jspb.Message.setProto3EnumField(this, 1, value);
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.CreateScene} returns this
+ * optional uint32 threshold = 2;
+ * @return {number}
  */
-proto.protocol.CreateScene.prototype.setContainerUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 4, value);
+proto.protocol.FrameCompression.prototype.getThreshold = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
 };
 
 
 /**
- * optional string name = 2;
- * @return {string}
+ * @param {number} value
+ * @return {!proto.protocol.FrameCompression} returns this
  */
-proto.protocol.CreateScene.prototype.getName = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+proto.protocol.FrameCompression.prototype.setThreshold = function(value) {
+  return jspb.Message.setProto3IntField(this, 2, value);
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.CreateScene} returns this
+ * optional bytes dictionary = 3;
+ * @return {!(string|Uint8Array)}
  */
-proto.protocol.CreateScene.prototype.setName = function(value) {
-  return jspb.Message.setProto3StringField(this, 2, value);
+proto.protocol.FrameCompression.prototype.getDictionary = function() {
+  return /** @type {!(string|Uint8Array)} */ (jspb.Message.getFieldWithDefault(this, 3, ""));
 };
 
 
 /**
- * optional ObjectValue props = 3;
- * @return {?proto.protocol.ObjectValue}
+ * optional bytes dictionary = 3;
+ * This is a type-conversion wrapper around `getDictionary()`
+ * @return {string}
  */
-proto.protocol.CreateScene.prototype.getProps = function() {
-  return /** @type{?proto.protocol.ObjectValue} */ (
-    jspb.Message.getWrapperField(this, proto.protocol.ObjectValue, 3));
-};
-
-
-/**
- * @param {?proto.protocol.ObjectValue|undefined} value
- * @return {!proto.protocol.CreateScene} returns this
-*/
-proto.protocol.CreateScene.prototype.setProps = function(value) {
-  return jspb.Message.setWrapperField(this, 3, value);
+proto.protocol.FrameCompression.prototype.getDictionary_asB64 = function() {
+  return /** @type {string} */ (jspb.Message.bytesAsB64(
+      this.getDictionary()));
 };
 
 
 /**
- * Clears the message field making it undefined.
- * @return {!proto.protocol.CreateScene} returns this
+ * optional bytes dictionary = 3;
+ * Note that Uint8Array is not supported on all browsers.
+ * @see http://caniuse.com/Uint8Array
+ * This is a type-conversion wrapper around `getDictionary()`
+ * @return {!Uint8Array}
  */
-proto.protocol.CreateScene.prototype.clearProps = function() {
-  return this.setProps(undefined);
+proto.protocol.FrameCompression.prototype.getDictionary_asU8 = function() {
+  return /** @type {!Uint8Array} */ (jspb.Message.bytesAsU8(
+      this.getDictionary()));
 };
 
 
 /**
- * Returns whether this field is set.
- * @return {boolean}
+ * @param {!(string|Uint8Array)} value
+ * @return {!proto.protocol.FrameCompression} returns this
  */
-proto.protocol.CreateScene.prototype.hasProps = function() {
-  return jspb.Message.getField(this, 3) != null;
+proto.protocol.FrameCompression.prototype.setDictionary = function(value) {
+  return jspb.Message.setProto3BytesField(this, 3, value);
 };
 
 
@@ -2587,8 +3394,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.protocol.AppendChild.prototype.toObject = function(opt_includeInstance) {
-  return proto.protocol.AppendChild.toObject(opt_includeInstance, this);
+proto.protocol.UpdateCredits.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.UpdateCredits.toObject(opt_includeInstance, this);
 };
 
 
@@ -2597,14 +3404,13 @@ proto.protocol.AppendChild.prototype.toObject = function(opt_includeInstance) {
  * @param {boolean|undefined} includeInstance Deprecated. Whether to include
  *     the JSPB instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.protocol.AppendChild} msg The msg instance to transform.
+ * @param {!proto.protocol.UpdateCredits} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.AppendChild.toObject = function(includeInstance, msg) {
+proto.protocol.UpdateCredits.toObject = function(includeInstance, msg) {
   var f, obj = {
-    parentUid: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    childUid: jspb.Message.getFieldWithDefault(msg, 2, "")
+    credits: jspb.Message.getFieldWithDefault(msg, 1, 0)
   };
 
   if (includeInstance) {
@@ -2618,23 +3424,23 @@ proto.protocol.AppendChild.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.protocol.AppendChild}
+ * @return {!proto.protocol.UpdateCredits}
  */
-proto.protocol.AppendChild.deserializeBinary = function(bytes) {
+proto.protocol.UpdateCredits.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.protocol.AppendChild;
-  return proto.protocol.AppendChild.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.protocol.UpdateCredits;
+  return proto.protocol.UpdateCredits.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.protocol.AppendChild} msg The message object to deserialize into.
+ * @param {!proto.protocol.UpdateCredits} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.protocol.AppendChild}
+ * @return {!proto.protocol.UpdateCredits}
  */
-proto.protocol.AppendChild.deserializeBinaryFromReader = function(msg, reader) {
+proto.protocol.UpdateCredits.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -2642,12 +3448,8 @@ proto.protocol.AppendChild.deserializeBinaryFromReader = function(msg, reader) {
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setParentUid(value);
-      break;
-    case 2:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setChildUid(value);
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setCredits(value);
       break;
     default:
       reader.skipField();
@@ -2662,9 +3464,9 @@ proto.protocol.AppendChild.deserializeBinaryFromReader = function(msg, reader) {
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.protocol.AppendChild.prototype.serializeBinary = function() {
+proto.protocol.UpdateCredits.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.AppendChild.serializeBinaryToWriter(this, writer);
+  proto.protocol.UpdateCredits.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -2672,66 +3474,4401 @@ proto.protocol.AppendChild.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.AppendChild} message
+ * @param {!proto.protocol.UpdateCredits} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.AppendChild.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.UpdateCredits.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getParentUid();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getCredits();
+  if (f !== 0) {
+    writer.writeUint32(
       1,
       f
     );
   }
-  f = message.getChildUid();
-  if (f.length > 0) {
-    writer.writeString(
-      2,
-      f
-    );
-  }
 };
 
 
 /**
- * optional string parent_uid = 1;
- * @return {string}
+ * optional uint32 credits = 1;
+ * @return {number}
  */
-proto.protocol.AppendChild.prototype.getParentUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.protocol.UpdateCredits.prototype.getCredits = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.AppendChild} returns this
+ * @param {number} value
+ * @return {!proto.protocol.UpdateCredits} returns this
  */
-proto.protocol.AppendChild.prototype.setParentUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 1, value);
+proto.protocol.UpdateCredits.prototype.setCredits = function(value) {
+  return jspb.Message.setProto3IntField(this, 1, value);
 };
 
 
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
 /**
- * optional string child_uid = 2;
- * @return {string}
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
  */
-proto.protocol.AppendChild.prototype.getChildUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+proto.protocol.CreateSource.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.CreateSource.toObject(opt_includeInstance, this);
 };
 
 
 /**
- * @param {string} value
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.CreateSource} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.CreateSource.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    uid: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    containerUid: jspb.Message.getFieldWithDefault(msg, 5, ""),
+    id: jspb.Message.getFieldWithDefault(msg, 2, ""),
+    name: jspb.Message.getFieldWithDefault(msg, 3, ""),
+    settings: (f = msg.getSettings()) && proto.protocol.ObjectValue.toObject(includeInstance, f),
+    handle: jspb.Message.getFieldWithDefault(msg, 6, 0),
+    containerHandle: jspb.Message.getFieldWithDefault(msg, 7, 0),
+    style: (f = msg.getStyle()) && proto.protocol.Style.toObject(includeInstance, f)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.CreateSource}
+ */
+proto.protocol.CreateSource.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.CreateSource;
+  return proto.protocol.CreateSource.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.CreateSource} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.CreateSource}
+ */
+proto.protocol.CreateSource.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setUid(value);
+      break;
+    case 5:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setContainerUid(value);
+      break;
+    case 2:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setId(value);
+      break;
+    case 3:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setName(value);
+      break;
+    case 4:
+      var value = new proto.protocol.ObjectValue;
+      reader.readMessage(value,proto.protocol.ObjectValue.deserializeBinaryFromReader);
+      msg.setSettings(value);
+      break;
+    case 6:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setHandle(value);
+      break;
+    case 7:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setContainerHandle(value);
+      break;
+    case 8:
+      var value = new proto.protocol.Style;
+      reader.readMessage(value,proto.protocol.Style.deserializeBinaryFromReader);
+      msg.setStyle(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.CreateSource.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.CreateSource.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.CreateSource} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.CreateSource.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getUid();
+  if (f.length > 0) {
+    writer.writeString(
+      1,
+      f
+    );
+  }
+  f = message.getContainerUid();
+  if (f.length > 0) {
+    writer.writeString(
+      5,
+      f
+    );
+  }
+  f = message.getId();
+  if (f.length > 0) {
+    writer.writeString(
+      2,
+      f
+    );
+  }
+  f = message.getName();
+  if (f.length > 0) {
+    writer.writeString(
+      3,
+      f
+    );
+  }
+  f = message.getSettings();
+  if (f != null) {
+    writer.writeMessage(
+      4,
+      f,
+      proto.protocol.ObjectValue.serializeBinaryToWriter
+    );
+  }
+  f = message.getHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      6,
+      f
+    );
+  }
+  f = message.getContainerHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      7,
+      f
+    );
+  }
+  f = message.getStyle();
+  if (f != null) {
+    writer.writeMessage(
+      8,
+      f,
+      proto.protocol.Style.serializeBinaryToWriter
+    );
+  }
+};
+
+
+/**
+ * optional string uid = 1;
+ * @return {string}
+ */
+proto.protocol.CreateSource.prototype.getUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.CreateSource} returns this
+ */
+proto.protocol.CreateSource.prototype.setUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 1, value);
+};
+
+
+/**
+ * optional string container_uid = 5;
+ * @return {string}
+ */
+proto.protocol.CreateSource.prototype.getContainerUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 5, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.CreateSource} returns this
+ */
+proto.protocol.CreateSource.prototype.setContainerUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 5, value);
+};
+
+
+/**
+ * optional string id = 2;
+ * @return {string}
+ */
+proto.protocol.CreateSource.prototype.getId = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.CreateSource} returns this
+ */
+proto.protocol.CreateSource.prototype.setId = function(value) {
+  return jspb.Message.setProto3StringField(this, 2, value);
+};
+
+
+/**
+ * optional string name = 3;
+ * @return {string}
+ */
+proto.protocol.CreateSource.prototype.getName = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 3, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.CreateSource} returns this
+ */
+proto.protocol.CreateSource.prototype.setName = function(value) {
+  return jspb.Message.setProto3StringField(this, 3, value);
+};
+
+
+/**
+ * optional ObjectValue settings = 4;
+ * @return {?proto.protocol.ObjectValue}
+ */
+proto.protocol.CreateSource.prototype.getSettings = function() {
+  return /** @type{?proto.protocol.ObjectValue} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.ObjectValue, 4));
+};
+
+
+/**
+ * @param {?proto.protocol.ObjectValue|undefined} value
+ * @return {!proto.protocol.CreateSource} returns this
+*/
+proto.protocol.CreateSource.prototype.setSettings = function(value) {
+  return jspb.Message.setWrapperField(this, 4, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.CreateSource} returns this
+ */
+proto.protocol.CreateSource.prototype.clearSettings = function() {
+  return this.setSettings(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.CreateSource.prototype.hasSettings = function() {
+  return jspb.Message.getField(this, 4) != null;
+};
+
+
+/**
+ * optional uint32 handle = 6;
+ * @return {number}
+ */
+proto.protocol.CreateSource.prototype.getHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 6, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.CreateSource} returns this
+ */
+proto.protocol.CreateSource.prototype.setHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 6, value);
+};
+
+
+/**
+ * optional uint32 container_handle = 7;
+ * @return {number}
+ */
+proto.protocol.CreateSource.prototype.getContainerHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 7, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.CreateSource} returns this
+ */
+proto.protocol.CreateSource.prototype.setContainerHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 7, value);
+};
+
+
+/**
+ * optional Style style = 8;
+ * @return {?proto.protocol.Style}
+ */
+proto.protocol.CreateSource.prototype.getStyle = function() {
+  return /** @type{?proto.protocol.Style} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Style, 8));
+};
+
+
+/**
+ * @param {?proto.protocol.Style|undefined} value
+ * @return {!proto.protocol.CreateSource} returns this
+*/
+proto.protocol.CreateSource.prototype.setStyle = function(value) {
+  return jspb.Message.setWrapperField(this, 8, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.CreateSource} returns this
+ */
+proto.protocol.CreateSource.prototype.clearStyle = function() {
+  return this.setStyle(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.CreateSource.prototype.hasStyle = function() {
+  return jspb.Message.getField(this, 8) != null;
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.UpdateSource.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.UpdateSource.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.UpdateSource} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.UpdateSource.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    uid: jspb.Message.getFieldWithDefault(msg, 2, ""),
+    changedProps: (f = msg.getChangedProps()) && proto.protocol.ObjectValue.toObject(includeInstance, f),
+    handle: jspb.Message.getFieldWithDefault(msg, 4, 0),
+    style: (f = msg.getStyle()) && proto.protocol.Style.toObject(includeInstance, f)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.UpdateSource}
+ */
+proto.protocol.UpdateSource.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.UpdateSource;
+  return proto.protocol.UpdateSource.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.UpdateSource} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.UpdateSource}
+ */
+proto.protocol.UpdateSource.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 2:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setUid(value);
+      break;
+    case 3:
+      var value = new proto.protocol.ObjectValue;
+      reader.readMessage(value,proto.protocol.ObjectValue.deserializeBinaryFromReader);
+      msg.setChangedProps(value);
+      break;
+    case 4:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setHandle(value);
+      break;
+    case 5:
+      var value = new proto.protocol.Style;
+      reader.readMessage(value,proto.protocol.Style.deserializeBinaryFromReader);
+      msg.setStyle(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.UpdateSource.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.UpdateSource.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.UpdateSource} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.UpdateSource.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getUid();
+  if (f.length > 0) {
+    writer.writeString(
+      2,
+      f
+    );
+  }
+  f = message.getChangedProps();
+  if (f != null) {
+    writer.writeMessage(
+      3,
+      f,
+      proto.protocol.ObjectValue.serializeBinaryToWriter
+    );
+  }
+  f = message.getHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      4,
+      f
+    );
+  }
+  f = message.getStyle();
+  if (f != null) {
+    writer.writeMessage(
+      5,
+      f,
+      proto.protocol.Style.serializeBinaryToWriter
+    );
+  }
+};
+
+
+/**
+ * optional string uid = 2;
+ * @return {string}
+ */
+proto.protocol.UpdateSource.prototype.getUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.UpdateSource} returns this
+ */
+proto.protocol.UpdateSource.prototype.setUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 2, value);
+};
+
+
+/**
+ * optional ObjectValue changed_props = 3;
+ * @return {?proto.protocol.ObjectValue}
+ */
+proto.protocol.UpdateSource.prototype.getChangedProps = function() {
+  return /** @type{?proto.protocol.ObjectValue} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.ObjectValue, 3));
+};
+
+
+/**
+ * @param {?proto.protocol.ObjectValue|undefined} value
+ * @return {!proto.protocol.UpdateSource} returns this
+*/
+proto.protocol.UpdateSource.prototype.setChangedProps = function(value) {
+  return jspb.Message.setWrapperField(this, 3, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.UpdateSource} returns this
+ */
+proto.protocol.UpdateSource.prototype.clearChangedProps = function() {
+  return this.setChangedProps(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.UpdateSource.prototype.hasChangedProps = function() {
+  return jspb.Message.getField(this, 3) != null;
+};
+
+
+/**
+ * optional uint32 handle = 4;
+ * @return {number}
+ */
+proto.protocol.UpdateSource.prototype.getHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 4, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.UpdateSource} returns this
+ */
+proto.protocol.UpdateSource.prototype.setHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 4, value);
+};
+
+
+/**
+ * optional Style style = 5;
+ * @return {?proto.protocol.Style}
+ */
+proto.protocol.UpdateSource.prototype.getStyle = function() {
+  return /** @type{?proto.protocol.Style} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Style, 5));
+};
+
+
+/**
+ * @param {?proto.protocol.Style|undefined} value
+ * @return {!proto.protocol.UpdateSource} returns this
+*/
+proto.protocol.UpdateSource.prototype.setStyle = function(value) {
+  return jspb.Message.setWrapperField(this, 5, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.UpdateSource} returns this
+ */
+proto.protocol.UpdateSource.prototype.clearStyle = function() {
+  return this.setStyle(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.UpdateSource.prototype.hasStyle = function() {
+  return jspb.Message.getField(this, 5) != null;
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.CreateScene.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.CreateScene.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.CreateScene} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.CreateScene.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    uid: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    containerUid: jspb.Message.getFieldWithDefault(msg, 4, ""),
+    name: jspb.Message.getFieldWithDefault(msg, 2, ""),
+    props: (f = msg.getProps()) && proto.protocol.ObjectValue.toObject(includeInstance, f),
+    handle: jspb.Message.getFieldWithDefault(msg, 5, 0),
+    containerHandle: jspb.Message.getFieldWithDefault(msg, 6, 0),
+    style: (f = msg.getStyle()) && proto.protocol.Style.toObject(includeInstance, f)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.CreateScene}
+ */
+proto.protocol.CreateScene.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.CreateScene;
+  return proto.protocol.CreateScene.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.CreateScene} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.CreateScene}
+ */
+proto.protocol.CreateScene.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setUid(value);
+      break;
+    case 4:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setContainerUid(value);
+      break;
+    case 2:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setName(value);
+      break;
+    case 3:
+      var value = new proto.protocol.ObjectValue;
+      reader.readMessage(value,proto.protocol.ObjectValue.deserializeBinaryFromReader);
+      msg.setProps(value);
+      break;
+    case 5:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setHandle(value);
+      break;
+    case 6:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setContainerHandle(value);
+      break;
+    case 7:
+      var value = new proto.protocol.Style;
+      reader.readMessage(value,proto.protocol.Style.deserializeBinaryFromReader);
+      msg.setStyle(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.CreateScene.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.CreateScene.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.CreateScene} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.CreateScene.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getUid();
+  if (f.length > 0) {
+    writer.writeString(
+      1,
+      f
+    );
+  }
+  f = message.getContainerUid();
+  if (f.length > 0) {
+    writer.writeString(
+      4,
+      f
+    );
+  }
+  f = message.getName();
+  if (f.length > 0) {
+    writer.writeString(
+      2,
+      f
+    );
+  }
+  f = message.getProps();
+  if (f != null) {
+    writer.writeMessage(
+      3,
+      f,
+      proto.protocol.ObjectValue.serializeBinaryToWriter
+    );
+  }
+  f = message.getHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      5,
+      f
+    );
+  }
+  f = message.getContainerHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      6,
+      f
+    );
+  }
+  f = message.getStyle();
+  if (f != null) {
+    writer.writeMessage(
+      7,
+      f,
+      proto.protocol.Style.serializeBinaryToWriter
+    );
+  }
+};
+
+
+/**
+ * optional string uid = 1;
+ * @return {string}
+ */
+proto.protocol.CreateScene.prototype.getUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.CreateScene} returns this
+ */
+proto.protocol.CreateScene.prototype.setUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 1, value);
+};
+
+
+/**
+ * optional string container_uid = 4;
+ * @return {string}
+ */
+proto.protocol.CreateScene.prototype.getContainerUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 4, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.CreateScene} returns this
+ */
+proto.protocol.CreateScene.prototype.setContainerUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 4, value);
+};
+
+
+/**
+ * optional string name = 2;
+ * @return {string}
+ */
+proto.protocol.CreateScene.prototype.getName = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.CreateScene} returns this
+ */
+proto.protocol.CreateScene.prototype.setName = function(value) {
+  return jspb.Message.setProto3StringField(this, 2, value);
+};
+
+
+/**
+ * optional ObjectValue props = 3;
+ * @return {?proto.protocol.ObjectValue}
+ */
+proto.protocol.CreateScene.prototype.getProps = function() {
+  return /** @type{?proto.protocol.ObjectValue} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.ObjectValue, 3));
+};
+
+
+/**
+ * @param {?proto.protocol.ObjectValue|undefined} value
+ * @return {!proto.protocol.CreateScene} returns this
+*/
+proto.protocol.CreateScene.prototype.setProps = function(value) {
+  return jspb.Message.setWrapperField(this, 3, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.CreateScene} returns this
+ */
+proto.protocol.CreateScene.prototype.clearProps = function() {
+  return this.setProps(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.CreateScene.prototype.hasProps = function() {
+  return jspb.Message.getField(this, 3) != null;
+};
+
+
+/**
+ * optional uint32 handle = 5;
+ * @return {number}
+ */
+proto.protocol.CreateScene.prototype.getHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 5, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.CreateScene} returns this
+ */
+proto.protocol.CreateScene.prototype.setHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 5, value);
+};
+
+
+/**
+ * optional uint32 container_handle = 6;
+ * @return {number}
+ */
+proto.protocol.CreateScene.prototype.getContainerHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 6, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.CreateScene} returns this
+ */
+proto.protocol.CreateScene.prototype.setContainerHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 6, value);
+};
+
+
+/**
+ * optional Style style = 7;
+ * @return {?proto.protocol.Style}
+ */
+proto.protocol.CreateScene.prototype.getStyle = function() {
+  return /** @type{?proto.protocol.Style} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Style, 7));
+};
+
+
+/**
+ * @param {?proto.protocol.Style|undefined} value
+ * @return {!proto.protocol.CreateScene} returns this
+*/
+proto.protocol.CreateScene.prototype.setStyle = function(value) {
+  return jspb.Message.setWrapperField(this, 7, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.CreateScene} returns this
+ */
+proto.protocol.CreateScene.prototype.clearStyle = function() {
+  return this.setStyle(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.CreateScene.prototype.hasStyle = function() {
+  return jspb.Message.getField(this, 7) != null;
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.AppendChild.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.AppendChild.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.AppendChild} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.AppendChild.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    parentUid: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    childUid: jspb.Message.getFieldWithDefault(msg, 2, ""),
+    parentHandle: jspb.Message.getFieldWithDefault(msg, 3, 0),
+    childHandle: jspb.Message.getFieldWithDefault(msg, 4, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.AppendChild}
+ */
+proto.protocol.AppendChild.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.AppendChild;
+  return proto.protocol.AppendChild.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.AppendChild} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.AppendChild}
+ */
+proto.protocol.AppendChild.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setParentUid(value);
+      break;
+    case 2:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setChildUid(value);
+      break;
+    case 3:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setParentHandle(value);
+      break;
+    case 4:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setChildHandle(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.AppendChild.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.AppendChild.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.AppendChild} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.AppendChild.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getParentUid();
+  if (f.length > 0) {
+    writer.writeString(
+      1,
+      f
+    );
+  }
+  f = message.getChildUid();
+  if (f.length > 0) {
+    writer.writeString(
+      2,
+      f
+    );
+  }
+  f = message.getParentHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      3,
+      f
+    );
+  }
+  f = message.getChildHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      4,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional string parent_uid = 1;
+ * @return {string}
+ */
+proto.protocol.AppendChild.prototype.getParentUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.AppendChild} returns this
+ */
+proto.protocol.AppendChild.prototype.setParentUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 1, value);
+};
+
+
+/**
+ * optional string child_uid = 2;
+ * @return {string}
+ */
+proto.protocol.AppendChild.prototype.getChildUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.AppendChild} returns this
+ */
+proto.protocol.AppendChild.prototype.setChildUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 2, value);
+};
+
+
+/**
+ * optional uint32 parent_handle = 3;
+ * @return {number}
+ */
+proto.protocol.AppendChild.prototype.getParentHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.AppendChild} returns this
+ */
+proto.protocol.AppendChild.prototype.setParentHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 3, value);
+};
+
+
+/**
+ * optional uint32 child_handle = 4;
+ * @return {number}
+ */
+proto.protocol.AppendChild.prototype.getChildHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 4, 0));
+};
+
+
+/**
+ * @param {number} value
  * @return {!proto.protocol.AppendChild} returns this
  */
-proto.protocol.AppendChild.prototype.setChildUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 2, value);
+proto.protocol.AppendChild.prototype.setChildHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 4, value);
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.RemoveChild.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.RemoveChild.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.RemoveChild} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.RemoveChild.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    parentUid: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    childUid: jspb.Message.getFieldWithDefault(msg, 2, ""),
+    parentHandle: jspb.Message.getFieldWithDefault(msg, 3, 0),
+    childHandle: jspb.Message.getFieldWithDefault(msg, 4, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.RemoveChild}
+ */
+proto.protocol.RemoveChild.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.RemoveChild;
+  return proto.protocol.RemoveChild.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.RemoveChild} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.RemoveChild}
+ */
+proto.protocol.RemoveChild.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setParentUid(value);
+      break;
+    case 2:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setChildUid(value);
+      break;
+    case 3:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setParentHandle(value);
+      break;
+    case 4:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setChildHandle(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.RemoveChild.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.RemoveChild.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.RemoveChild} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.RemoveChild.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getParentUid();
+  if (f.length > 0) {
+    writer.writeString(
+      1,
+      f
+    );
+  }
+  f = message.getChildUid();
+  if (f.length > 0) {
+    writer.writeString(
+      2,
+      f
+    );
+  }
+  f = message.getParentHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      3,
+      f
+    );
+  }
+  f = message.getChildHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      4,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional string parent_uid = 1;
+ * @return {string}
+ */
+proto.protocol.RemoveChild.prototype.getParentUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.RemoveChild} returns this
+ */
+proto.protocol.RemoveChild.prototype.setParentUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 1, value);
+};
+
+
+/**
+ * optional string child_uid = 2;
+ * @return {string}
+ */
+proto.protocol.RemoveChild.prototype.getChildUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.RemoveChild} returns this
+ */
+proto.protocol.RemoveChild.prototype.setChildUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 2, value);
+};
+
+
+/**
+ * optional uint32 parent_handle = 3;
+ * @return {number}
+ */
+proto.protocol.RemoveChild.prototype.getParentHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.RemoveChild} returns this
+ */
+proto.protocol.RemoveChild.prototype.setParentHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 3, value);
+};
+
+
+/**
+ * optional uint32 child_handle = 4;
+ * @return {number}
+ */
+proto.protocol.RemoveChild.prototype.getChildHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 4, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.RemoveChild} returns this
+ */
+proto.protocol.RemoveChild.prototype.setChildHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 4, value);
+};
+
+
+
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.protocol.CreateTree.repeatedFields_ = [2];
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.CreateTree.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.CreateTree.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.CreateTree} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.CreateTree.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    parentHandle: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    rootsList: jspb.Message.toObjectList(msg.getRootsList(),
+    proto.protocol.TreeNode.toObject, includeInstance)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.CreateTree}
+ */
+proto.protocol.CreateTree.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.CreateTree;
+  return proto.protocol.CreateTree.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.CreateTree} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.CreateTree}
+ */
+proto.protocol.CreateTree.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setParentHandle(value);
+      break;
+    case 2:
+      var value = new proto.protocol.TreeNode;
+      reader.readMessage(value,proto.protocol.TreeNode.deserializeBinaryFromReader);
+      msg.addRoots(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.CreateTree.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.CreateTree.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.CreateTree} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.CreateTree.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getParentHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getRootsList();
+  if (f.length > 0) {
+    writer.writeRepeatedMessage(
+      2,
+      f,
+      proto.protocol.TreeNode.serializeBinaryToWriter
+    );
+  }
+};
+
+
+/**
+ * optional uint32 parent_handle = 1;
+ * @return {number}
+ */
+proto.protocol.CreateTree.prototype.getParentHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.CreateTree} returns this
+ */
+proto.protocol.CreateTree.prototype.setParentHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * repeated TreeNode roots = 2;
+ * @return {!Array<!proto.protocol.TreeNode>}
+ */
+proto.protocol.CreateTree.prototype.getRootsList = function() {
+  return /** @type{!Array<!proto.protocol.TreeNode>} */ (
+    jspb.Message.getRepeatedWrapperField(this, proto.protocol.TreeNode, 2));
+};
+
+
+/**
+ * @param {!Array<!proto.protocol.TreeNode>} value
+ * @return {!proto.protocol.CreateTree} returns this
+*/
+proto.protocol.CreateTree.prototype.setRootsList = function(value) {
+  return jspb.Message.setRepeatedWrapperField(this, 2, value);
+};
+
+
+/**
+ * @param {!proto.protocol.TreeNode=} opt_value
+ * @param {number=} opt_index
+ * @return {!proto.protocol.TreeNode}
+ */
+proto.protocol.CreateTree.prototype.addRoots = function(opt_value, opt_index) {
+  return jspb.Message.addToRepeatedWrapperField(this, 2, opt_value, proto.protocol.TreeNode, opt_index);
+};
+
+
+/**
+ * Clears the list making it empty but non-null.
+ * @return {!proto.protocol.CreateTree} returns this
+ */
+proto.protocol.CreateTree.prototype.clearRootsList = function() {
+  return this.setRootsList([]);
+};
+
+
+
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.protocol.TreeNode.repeatedFields_ = [3];
+
+/**
+ * Oneof group definitions for this message. Each group defines the field
+ * numbers belonging to that group. When of these fields' value is set, all
+ * other fields in the group are cleared. During deserialization, if multiple
+ * fields are encountered for a group, only the last value seen will be kept.
+ * @private {!Array<!Array<number>>}
+ * @const
+ */
+proto.protocol.TreeNode.oneofGroups_ = [[1,2]];
+
+/**
+ * @enum {number}
+ */
+proto.protocol.TreeNode.NodeCase = {
+  NODE_NOT_SET: 0,
+  SOURCE: 1,
+  SCENE: 2
+};
+
+/**
+ * @return {proto.protocol.TreeNode.NodeCase}
+ */
+proto.protocol.TreeNode.prototype.getNodeCase = function() {
+  return /** @type {proto.protocol.TreeNode.NodeCase} */(jspb.Message.computeOneofCase(this, proto.protocol.TreeNode.oneofGroups_[0]));
+};
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.TreeNode.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.TreeNode.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.TreeNode} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.TreeNode.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    source: (f = msg.getSource()) && proto.protocol.CreateSource.toObject(includeInstance, f),
+    scene: (f = msg.getScene()) && proto.protocol.CreateScene.toObject(includeInstance, f),
+    childrenList: jspb.Message.toObjectList(msg.getChildrenList(),
+    proto.protocol.TreeNode.toObject, includeInstance)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.TreeNode}
+ */
+proto.protocol.TreeNode.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.TreeNode;
+  return proto.protocol.TreeNode.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.TreeNode} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.TreeNode}
+ */
+proto.protocol.TreeNode.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = new proto.protocol.CreateSource;
+      reader.readMessage(value,proto.protocol.CreateSource.deserializeBinaryFromReader);
+      msg.setSource(value);
+      break;
+    case 2:
+      var value = new proto.protocol.CreateScene;
+      reader.readMessage(value,proto.protocol.CreateScene.deserializeBinaryFromReader);
+      msg.setScene(value);
+      break;
+    case 3:
+      var value = new proto.protocol.TreeNode;
+      reader.readMessage(value,proto.protocol.TreeNode.deserializeBinaryFromReader);
+      msg.addChildren(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.TreeNode.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.TreeNode.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.TreeNode} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.TreeNode.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getSource();
+  if (f != null) {
+    writer.writeMessage(
+      1,
+      f,
+      proto.protocol.CreateSource.serializeBinaryToWriter
+    );
+  }
+  f = message.getScene();
+  if (f != null) {
+    writer.writeMessage(
+      2,
+      f,
+      proto.protocol.CreateScene.serializeBinaryToWriter
+    );
+  }
+  f = message.getChildrenList();
+  if (f.length > 0) {
+    writer.writeRepeatedMessage(
+      3,
+      f,
+      proto.protocol.TreeNode.serializeBinaryToWriter
+    );
+  }
+};
+
+
+/**
+ * optional CreateSource source = 1;
+ * @return {?proto.protocol.CreateSource}
+ */
+proto.protocol.TreeNode.prototype.getSource = function() {
+  return /** @type{?proto.protocol.CreateSource} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.CreateSource, 1));
+};
+
+
+/**
+ * @param {?proto.protocol.CreateSource|undefined} value
+ * @return {!proto.protocol.TreeNode} returns this
+*/
+proto.protocol.TreeNode.prototype.setSource = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 1, proto.protocol.TreeNode.oneofGroups_[0], value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.TreeNode} returns this
+ */
+proto.protocol.TreeNode.prototype.clearSource = function() {
+  return this.setSource(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.TreeNode.prototype.hasSource = function() {
+  return jspb.Message.getField(this, 1) != null;
+};
+
+
+/**
+ * optional CreateScene scene = 2;
+ * @return {?proto.protocol.CreateScene}
+ */
+proto.protocol.TreeNode.prototype.getScene = function() {
+  return /** @type{?proto.protocol.CreateScene} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.CreateScene, 2));
+};
+
+
+/**
+ * @param {?proto.protocol.CreateScene|undefined} value
+ * @return {!proto.protocol.TreeNode} returns this
+*/
+proto.protocol.TreeNode.prototype.setScene = function(value) {
+  return jspb.Message.setOneofWrapperField(this, 2, proto.protocol.TreeNode.oneofGroups_[0], value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.TreeNode} returns this
+ */
+proto.protocol.TreeNode.prototype.clearScene = function() {
+  return this.setScene(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.TreeNode.prototype.hasScene = function() {
+  return jspb.Message.getField(this, 2) != null;
+};
+
+
+/**
+ * repeated TreeNode children = 3;
+ * @return {!Array<!proto.protocol.TreeNode>}
+ */
+proto.protocol.TreeNode.prototype.getChildrenList = function() {
+  return /** @type{!Array<!proto.protocol.TreeNode>} */ (
+    jspb.Message.getRepeatedWrapperField(this, proto.protocol.TreeNode, 3));
+};
+
+
+/**
+ * @param {!Array<!proto.protocol.TreeNode>} value
+ * @return {!proto.protocol.TreeNode} returns this
+*/
+proto.protocol.TreeNode.prototype.setChildrenList = function(value) {
+  return jspb.Message.setRepeatedWrapperField(this, 3, value);
+};
+
+
+/**
+ * @param {!proto.protocol.TreeNode=} opt_value
+ * @param {number=} opt_index
+ * @return {!proto.protocol.TreeNode}
+ */
+proto.protocol.TreeNode.prototype.addChildren = function(opt_value, opt_index) {
+  return jspb.Message.addToRepeatedWrapperField(this, 3, opt_value, proto.protocol.TreeNode, opt_index);
+};
+
+
+/**
+ * Clears the list making it empty but non-null.
+ * @return {!proto.protocol.TreeNode} returns this
+ */
+proto.protocol.TreeNode.prototype.clearChildrenList = function() {
+  return this.setChildrenList([]);
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.InsertBefore.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.InsertBefore.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.InsertBefore} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.InsertBefore.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    parentHandle: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    childHandle: jspb.Message.getFieldWithDefault(msg, 2, 0),
+    beforeHandle: jspb.Message.getFieldWithDefault(msg, 3, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.InsertBefore}
+ */
+proto.protocol.InsertBefore.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.InsertBefore;
+  return proto.protocol.InsertBefore.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.InsertBefore} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.InsertBefore}
+ */
+proto.protocol.InsertBefore.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setParentHandle(value);
+      break;
+    case 2:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setChildHandle(value);
+      break;
+    case 3:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setBeforeHandle(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.InsertBefore.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.InsertBefore.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.InsertBefore} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.InsertBefore.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getParentHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getChildHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      2,
+      f
+    );
+  }
+  f = message.getBeforeHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      3,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint32 parent_handle = 1;
+ * @return {number}
+ */
+proto.protocol.InsertBefore.prototype.getParentHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.InsertBefore} returns this
+ */
+proto.protocol.InsertBefore.prototype.setParentHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional uint32 child_handle = 2;
+ * @return {number}
+ */
+proto.protocol.InsertBefore.prototype.getChildHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.InsertBefore} returns this
+ */
+proto.protocol.InsertBefore.prototype.setChildHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 2, value);
+};
+
+
+/**
+ * optional uint32 before_handle = 3;
+ * @return {number}
+ */
+proto.protocol.InsertBefore.prototype.getBeforeHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.InsertBefore} returns this
+ */
+proto.protocol.InsertBefore.prototype.setBeforeHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 3, value);
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.MoveChild.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.MoveChild.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.MoveChild} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.MoveChild.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    parentHandle: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    childHandle: jspb.Message.getFieldWithDefault(msg, 2, 0),
+    beforeHandle: jspb.Message.getFieldWithDefault(msg, 3, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.MoveChild}
+ */
+proto.protocol.MoveChild.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.MoveChild;
+  return proto.protocol.MoveChild.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.MoveChild} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.MoveChild}
+ */
+proto.protocol.MoveChild.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setParentHandle(value);
+      break;
+    case 2:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setChildHandle(value);
+      break;
+    case 3:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setBeforeHandle(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.MoveChild.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.MoveChild.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.MoveChild} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.MoveChild.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getParentHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getChildHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      2,
+      f
+    );
+  }
+  f = message.getBeforeHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      3,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint32 parent_handle = 1;
+ * @return {number}
+ */
+proto.protocol.MoveChild.prototype.getParentHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.MoveChild} returns this
+ */
+proto.protocol.MoveChild.prototype.setParentHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional uint32 child_handle = 2;
+ * @return {number}
+ */
+proto.protocol.MoveChild.prototype.getChildHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.MoveChild} returns this
+ */
+proto.protocol.MoveChild.prototype.setChildHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 2, value);
+};
+
+
+/**
+ * optional uint32 before_handle = 3;
+ * @return {number}
+ */
+proto.protocol.MoveChild.prototype.getBeforeHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.MoveChild} returns this
+ */
+proto.protocol.MoveChild.prototype.setBeforeHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 3, value);
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.CommitUpdates.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.CommitUpdates.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.CommitUpdates} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.CommitUpdates.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    containerUid: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    containerHandle: jspb.Message.getFieldWithDefault(msg, 2, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.CommitUpdates}
+ */
+proto.protocol.CommitUpdates.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.CommitUpdates;
+  return proto.protocol.CommitUpdates.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.CommitUpdates} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.CommitUpdates}
+ */
+proto.protocol.CommitUpdates.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setContainerUid(value);
+      break;
+    case 2:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setContainerHandle(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.CommitUpdates.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.CommitUpdates.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.CommitUpdates} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.CommitUpdates.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getContainerUid();
+  if (f.length > 0) {
+    writer.writeString(
+      1,
+      f
+    );
+  }
+  f = message.getContainerHandle();
+  if (f !== 0) {
+    writer.writeUint32(
+      2,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional string container_uid = 1;
+ * @return {string}
+ */
+proto.protocol.CommitUpdates.prototype.getContainerUid = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.CommitUpdates} returns this
+ */
+proto.protocol.CommitUpdates.prototype.setContainerUid = function(value) {
+  return jspb.Message.setProto3StringField(this, 1, value);
+};
+
+
+/**
+ * optional uint32 container_handle = 2;
+ * @return {number}
+ */
+proto.protocol.CommitUpdates.prototype.getContainerHandle = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.CommitUpdates} returns this
+ */
+proto.protocol.CommitUpdates.prototype.setContainerHandle = function(value) {
+  return jspb.Message.setProto3IntField(this, 2, value);
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.DefineKey.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.DefineKey.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.DefineKey} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.DefineKey.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    id: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    key: jspb.Message.getFieldWithDefault(msg, 2, "")
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.DefineKey}
+ */
+proto.protocol.DefineKey.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.DefineKey;
+  return proto.protocol.DefineKey.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.DefineKey} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.DefineKey}
+ */
+proto.protocol.DefineKey.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setId(value);
+      break;
+    case 2:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setKey(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.DefineKey.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.DefineKey.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.DefineKey} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.DefineKey.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getId();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getKey();
+  if (f.length > 0) {
+    writer.writeString(
+      2,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint32 id = 1;
+ * @return {number}
+ */
+proto.protocol.DefineKey.prototype.getId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.DefineKey} returns this
+ */
+proto.protocol.DefineKey.prototype.setId = function(value) {
+  return jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional string key = 2;
+ * @return {string}
+ */
+proto.protocol.DefineKey.prototype.getKey = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.DefineKey} returns this
+ */
+proto.protocol.DefineKey.prototype.setKey = function(value) {
+  return jspb.Message.setProto3StringField(this, 2, value);
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.DefineString.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.DefineString.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.DefineString} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.DefineString.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    id: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    value: jspb.Message.getFieldWithDefault(msg, 2, "")
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.DefineString}
+ */
+proto.protocol.DefineString.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.DefineString;
+  return proto.protocol.DefineString.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.DefineString} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.DefineString}
+ */
+proto.protocol.DefineString.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setId(value);
+      break;
+    case 2:
+      var value = /** @type {string} */ (reader.readString());
+      msg.setValue(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.DefineString.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.DefineString.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.DefineString} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.DefineString.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getId();
+  if (f !== 0) {
+    writer.writeUint32(
+      1,
+      f
+    );
+  }
+  f = message.getValue();
+  if (f.length > 0) {
+    writer.writeString(
+      2,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint32 id = 1;
+ * @return {number}
+ */
+proto.protocol.DefineString.prototype.getId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.DefineString} returns this
+ */
+proto.protocol.DefineString.prototype.setId = function(value) {
+  return jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional string value = 2;
+ * @return {string}
+ */
+proto.protocol.DefineString.prototype.getValue = function() {
+  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+};
+
+
+/**
+ * @param {string} value
+ * @return {!proto.protocol.DefineString} returns this
+ */
+proto.protocol.DefineString.prototype.setValue = function(value) {
+  return jspb.Message.setProto3StringField(this, 2, value);
+};
+
+
+
+
+
+if (jspb.Message.GENERATE_TO_OBJECT) {
+/**
+ * Creates an object representation of this proto.
+ * Field names that are reserved in JavaScript and will be renamed to pb_name.
+ * Optional fields that are not set will be set to undefined.
+ * To access a reserved field use, foo.pb_<name>, eg, foo.pb_default.
+ * For the list of reserved names please see:
+ *     net/proto2/compiler/js/internal/generator.cc#kKeyword.
+ * @param {boolean=} opt_includeInstance Deprecated. whether to include the
+ *     JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @return {!Object}
+ */
+proto.protocol.Style.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.Style.toObject(opt_includeInstance, this);
+};
+
+
+/**
+ * Static version of the {@see toObject} method.
+ * @param {boolean|undefined} includeInstance Deprecated. Whether to include
+ *     the JSPB instance for transitional soy proto support:
+ *     http://goto/soy-param-migration
+ * @param {!proto.protocol.Style} msg The msg instance to transform.
+ * @return {!Object}
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.Style.toObject = function(includeInstance, msg) {
+  var f, obj = {
+    present: jspb.Message.getFieldWithDefault(msg, 1, 0),
+    patch: jspb.Message.getBooleanFieldWithDefault(msg, 34, false),
+    unset: jspb.Message.getFieldWithDefault(msg, 35, 0),
+    flexDirection: jspb.Message.getFieldWithDefault(msg, 2, 0),
+    direction: jspb.Message.getFieldWithDefault(msg, 3, 0),
+    justifyContent: jspb.Message.getFieldWithDefault(msg, 4, 0),
+    alignContent: jspb.Message.getFieldWithDefault(msg, 5, 0),
+    alignItems: jspb.Message.getFieldWithDefault(msg, 6, 0),
+    alignSelf: jspb.Message.getFieldWithDefault(msg, 7, 0),
+    position: jspb.Message.getFieldWithDefault(msg, 8, 0),
+    flexWrap: jspb.Message.getFieldWithDefault(msg, 9, 0),
+    overflow: jspb.Message.getFieldWithDefault(msg, 10, 0),
+    display: jspb.Message.getFieldWithDefault(msg, 11, 0),
+    flexGrow: jspb.Message.getFloatingPointFieldWithDefault(msg, 12, 0.0),
+    flexShrink: jspb.Message.getFloatingPointFieldWithDefault(msg, 13, 0.0),
+    flexBasis: (f = msg.getFlexBasis()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    top: (f = msg.getTop()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    left: (f = msg.getLeft()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    right: (f = msg.getRight()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    bottom: (f = msg.getBottom()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    marginTop: (f = msg.getMarginTop()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    marginLeft: (f = msg.getMarginLeft()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    marginRight: (f = msg.getMarginRight()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    marginBottom: (f = msg.getMarginBottom()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    paddingTop: (f = msg.getPaddingTop()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    paddingLeft: (f = msg.getPaddingLeft()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    paddingRight: (f = msg.getPaddingRight()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    paddingBottom: (f = msg.getPaddingBottom()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    aspectRatio: jspb.Message.getFloatingPointFieldWithDefault(msg, 27, 0.0),
+    width: (f = msg.getWidth()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    height: (f = msg.getHeight()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    minWidth: (f = msg.getMinWidth()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    maxWidth: (f = msg.getMaxWidth()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    minHeight: (f = msg.getMinHeight()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    maxHeight: (f = msg.getMaxHeight()) && proto.protocol.Dimension.toObject(includeInstance, f),
+    zIndex: jspb.Message.getFieldWithDefault(msg, 36, 0)
+  };
+
+  if (includeInstance) {
+    obj.$jspbMessageInstance = msg;
+  }
+  return obj;
+};
+}
+
+
+/**
+ * Deserializes binary data (in protobuf wire format).
+ * @param {jspb.ByteSource} bytes The bytes to deserialize.
+ * @return {!proto.protocol.Style}
+ */
+proto.protocol.Style.deserializeBinary = function(bytes) {
+  var reader = new jspb.BinaryReader(bytes);
+  var msg = new proto.protocol.Style;
+  return proto.protocol.Style.deserializeBinaryFromReader(msg, reader);
+};
+
+
+/**
+ * Deserializes binary data (in protobuf wire format) from the
+ * given reader into the given message object.
+ * @param {!proto.protocol.Style} msg The message object to deserialize into.
+ * @param {!jspb.BinaryReader} reader The BinaryReader to use.
+ * @return {!proto.protocol.Style}
+ */
+proto.protocol.Style.deserializeBinaryFromReader = function(msg, reader) {
+  while (reader.nextField()) {
+    if (reader.isEndGroup()) {
+      break;
+    }
+    var field = reader.getFieldNumber();
+    switch (field) {
+    case 1:
+      var value = /** @type {number} */ (reader.readUint64());
+      msg.setPresent(value);
+      break;
+    case 34:
+      var value = /** @type {boolean} */ (reader.readBool());
+      msg.setPatch(value);
+      break;
+    case 35:
+      var value = /** @type {number} */ (reader.readUint64());
+      msg.setUnset(value);
+      break;
+    case 2:
+      var value = /** @type {!proto.protocol.FlexDirection} */ (reader.readEnum());
+      msg.setFlexDirection(value);
+      break;
+    case 3:
+      var value = /** @type {!proto.protocol.Direction} */ (reader.readEnum());
+      msg.setDirection(value);
+      break;
+    case 4:
+      var value = /** @type {!proto.protocol.Justify} */ (reader.readEnum());
+      msg.setJustifyContent(value);
+      break;
+    case 5:
+      var value = /** @type {!proto.protocol.Align} */ (reader.readEnum());
+      msg.setAlignContent(value);
+      break;
+    case 6:
+      var value = /** @type {!proto.protocol.Align} */ (reader.readEnum());
+      msg.setAlignItems(value);
+      break;
+    case 7:
+      var value = /** @type {!proto.protocol.Align} */ (reader.readEnum());
+      msg.setAlignSelf(value);
+      break;
+    case 8:
+      var value = /** @type {!proto.protocol.PositionType} */ (reader.readEnum());
+      msg.setPosition(value);
+      break;
+    case 9:
+      var value = /** @type {!proto.protocol.Wrap} */ (reader.readEnum());
+      msg.setFlexWrap(value);
+      break;
+    case 10:
+      var value = /** @type {!proto.protocol.Overflow} */ (reader.readEnum());
+      msg.setOverflow(value);
+      break;
+    case 11:
+      var value = /** @type {!proto.protocol.Display} */ (reader.readEnum());
+      msg.setDisplay(value);
+      break;
+    case 12:
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setFlexGrow(value);
+      break;
+    case 13:
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setFlexShrink(value);
+      break;
+    case 14:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setFlexBasis(value);
+      break;
+    case 15:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setTop(value);
+      break;
+    case 16:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setLeft(value);
+      break;
+    case 17:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setRight(value);
+      break;
+    case 18:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setBottom(value);
+      break;
+    case 19:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setMarginTop(value);
+      break;
+    case 20:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setMarginLeft(value);
+      break;
+    case 21:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setMarginRight(value);
+      break;
+    case 22:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setMarginBottom(value);
+      break;
+    case 23:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setPaddingTop(value);
+      break;
+    case 24:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setPaddingLeft(value);
+      break;
+    case 25:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setPaddingRight(value);
+      break;
+    case 26:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setPaddingBottom(value);
+      break;
+    case 27:
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setAspectRatio(value);
+      break;
+    case 28:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setWidth(value);
+      break;
+    case 29:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setHeight(value);
+      break;
+    case 30:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setMinWidth(value);
+      break;
+    case 31:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setMaxWidth(value);
+      break;
+    case 32:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setMinHeight(value);
+      break;
+    case 33:
+      var value = new proto.protocol.Dimension;
+      reader.readMessage(value,proto.protocol.Dimension.deserializeBinaryFromReader);
+      msg.setMaxHeight(value);
+      break;
+    case 36:
+      var value = /** @type {number} */ (reader.readInt32());
+      msg.setZIndex(value);
+      break;
+    default:
+      reader.skipField();
+      break;
+    }
+  }
+  return msg;
+};
+
+
+/**
+ * Serializes the message to binary data (in protobuf wire format).
+ * @return {!Uint8Array}
+ */
+proto.protocol.Style.prototype.serializeBinary = function() {
+  var writer = new jspb.BinaryWriter();
+  proto.protocol.Style.serializeBinaryToWriter(this, writer);
+  return writer.getResultBuffer();
+};
+
+
+/**
+ * Serializes the given message to binary data (in protobuf wire
+ * format), writing to the given BinaryWriter.
+ * @param {!proto.protocol.Style} message
+ * @param {!jspb.BinaryWriter} writer
+ * @suppress {unusedLocalVariables} f is only used for nested messages
+ */
+proto.protocol.Style.serializeBinaryToWriter = function(message, writer) {
+  var f = undefined;
+  f = message.getPresent();
+  if (f !== 0) {
+    writer.writeUint64(
+      1,
+      f
+    );
+  }
+  f = message.getPatch();
+  if (f) {
+    writer.writeBool(
+      34,
+      f
+    );
+  }
+  f = message.getUnset();
+  if (f !== 0) {
+    writer.writeUint64(
+      35,
+      f
+    );
+  }
+  f = message.getFlexDirection();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      2,
+      f
+    );
+  }
+  f = message.getDirection();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      3,
+      f
+    );
+  }
+  f = message.getJustifyContent();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      4,
+      f
+    );
+  }
+  f = message.getAlignContent();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      5,
+      f
+    );
+  }
+  f = message.getAlignItems();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      6,
+      f
+    );
+  }
+  f = message.getAlignSelf();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      7,
+      f
+    );
+  }
+  f = message.getPosition();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      8,
+      f
+    );
+  }
+  f = message.getFlexWrap();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      9,
+      f
+    );
+  }
+  f = message.getOverflow();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      10,
+      f
+    );
+  }
+  f = message.getDisplay();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      11,
+      f
+    );
+  }
+  f = message.getFlexGrow();
+  if (f !== 0.0) {
+    writer.writeFloat(
+      12,
+      f
+    );
+  }
+  f = message.getFlexShrink();
+  if (f !== 0.0) {
+    writer.writeFloat(
+      13,
+      f
+    );
+  }
+  f = message.getFlexBasis();
+  if (f != null) {
+    writer.writeMessage(
+      14,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getTop();
+  if (f != null) {
+    writer.writeMessage(
+      15,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getLeft();
+  if (f != null) {
+    writer.writeMessage(
+      16,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getRight();
+  if (f != null) {
+    writer.writeMessage(
+      17,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getBottom();
+  if (f != null) {
+    writer.writeMessage(
+      18,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getMarginTop();
+  if (f != null) {
+    writer.writeMessage(
+      19,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getMarginLeft();
+  if (f != null) {
+    writer.writeMessage(
+      20,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getMarginRight();
+  if (f != null) {
+    writer.writeMessage(
+      21,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getMarginBottom();
+  if (f != null) {
+    writer.writeMessage(
+      22,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getPaddingTop();
+  if (f != null) {
+    writer.writeMessage(
+      23,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getPaddingLeft();
+  if (f != null) {
+    writer.writeMessage(
+      24,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getPaddingRight();
+  if (f != null) {
+    writer.writeMessage(
+      25,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getPaddingBottom();
+  if (f != null) {
+    writer.writeMessage(
+      26,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getAspectRatio();
+  if (f !== 0.0) {
+    writer.writeFloat(
+      27,
+      f
+    );
+  }
+  f = message.getWidth();
+  if (f != null) {
+    writer.writeMessage(
+      28,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getHeight();
+  if (f != null) {
+    writer.writeMessage(
+      29,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getMinWidth();
+  if (f != null) {
+    writer.writeMessage(
+      30,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getMaxWidth();
+  if (f != null) {
+    writer.writeMessage(
+      31,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getMinHeight();
+  if (f != null) {
+    writer.writeMessage(
+      32,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getMaxHeight();
+  if (f != null) {
+    writer.writeMessage(
+      33,
+      f,
+      proto.protocol.Dimension.serializeBinaryToWriter
+    );
+  }
+  f = message.getZIndex();
+  if (f !== 0) {
+    writer.writeInt32(
+      36,
+      f
+    );
+  }
+};
+
+
+/**
+ * optional uint64 present = 1;
+ * @return {number}
+ */
+proto.protocol.Style.prototype.getPresent = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 1, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setPresent = function(value) {
+  return jspb.Message.setProto3IntField(this, 1, value);
+};
+
+
+/**
+ * optional bool patch = 34;
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.getPatch = function() {
+  return /** @type {boolean} */ (jspb.Message.getBooleanFieldWithDefault(this, 34, false));
+};
+
+
+/**
+ * @param {boolean} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setPatch = function(value) {
+  return jspb.Message.setProto3BooleanField(this, 34, value);
+};
+
+
+/**
+ * optional uint64 unset = 35;
+ * @return {number}
+ */
+proto.protocol.Style.prototype.getUnset = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 35, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setUnset = function(value) {
+  return jspb.Message.setProto3IntField(this, 35, value);
+};
+
+
+/**
+ * optional FlexDirection flex_direction = 2;
+ * @return {!proto.protocol.FlexDirection}
+ */
+proto.protocol.Style.prototype.getFlexDirection = function() {
+  return /** @type {!proto.protocol.FlexDirection} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.FlexDirection} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setFlexDirection = function(value) {
+  return jspb.Message.setProto3EnumField(this, 2, value);
+};
+
+
+/**
+ * optional Direction direction = 3;
+ * @return {!proto.protocol.Direction}
+ */
+proto.protocol.Style.prototype.getDirection = function() {
+  return /** @type {!proto.protocol.Direction} */ (jspb.Message.getFieldWithDefault(this, 3, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Direction} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setDirection = function(value) {
+  return jspb.Message.setProto3EnumField(this, 3, value);
+};
+
+
+/**
+ * optional Justify justify_content = 4;
+ * @return {!proto.protocol.Justify}
+ */
+proto.protocol.Style.prototype.getJustifyContent = function() {
+  return /** @type {!proto.protocol.Justify} */ (jspb.Message.getFieldWithDefault(this, 4, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Justify} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setJustifyContent = function(value) {
+  return jspb.Message.setProto3EnumField(this, 4, value);
+};
+
+
+/**
+ * optional Align align_content = 5;
+ * @return {!proto.protocol.Align}
+ */
+proto.protocol.Style.prototype.getAlignContent = function() {
+  return /** @type {!proto.protocol.Align} */ (jspb.Message.getFieldWithDefault(this, 5, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Align} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setAlignContent = function(value) {
+  return jspb.Message.setProto3EnumField(this, 5, value);
+};
+
+
+/**
+ * optional Align align_items = 6;
+ * @return {!proto.protocol.Align}
+ */
+proto.protocol.Style.prototype.getAlignItems = function() {
+  return /** @type {!proto.protocol.Align} */ (jspb.Message.getFieldWithDefault(this, 6, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Align} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setAlignItems = function(value) {
+  return jspb.Message.setProto3EnumField(this, 6, value);
+};
+
+
+/**
+ * optional Align align_self = 7;
+ * @return {!proto.protocol.Align}
+ */
+proto.protocol.Style.prototype.getAlignSelf = function() {
+  return /** @type {!proto.protocol.Align} */ (jspb.Message.getFieldWithDefault(this, 7, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Align} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setAlignSelf = function(value) {
+  return jspb.Message.setProto3EnumField(this, 7, value);
+};
+
+
+/**
+ * optional PositionType position = 8;
+ * @return {!proto.protocol.PositionType}
+ */
+proto.protocol.Style.prototype.getPosition = function() {
+  return /** @type {!proto.protocol.PositionType} */ (jspb.Message.getFieldWithDefault(this, 8, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.PositionType} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setPosition = function(value) {
+  return jspb.Message.setProto3EnumField(this, 8, value);
+};
+
+
+/**
+ * optional Wrap flex_wrap = 9;
+ * @return {!proto.protocol.Wrap}
+ */
+proto.protocol.Style.prototype.getFlexWrap = function() {
+  return /** @type {!proto.protocol.Wrap} */ (jspb.Message.getFieldWithDefault(this, 9, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Wrap} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setFlexWrap = function(value) {
+  return jspb.Message.setProto3EnumField(this, 9, value);
+};
+
+
+/**
+ * optional Overflow overflow = 10;
+ * @return {!proto.protocol.Overflow}
+ */
+proto.protocol.Style.prototype.getOverflow = function() {
+  return /** @type {!proto.protocol.Overflow} */ (jspb.Message.getFieldWithDefault(this, 10, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Overflow} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setOverflow = function(value) {
+  return jspb.Message.setProto3EnumField(this, 10, value);
+};
+
+
+/**
+ * optional Display display = 11;
+ * @return {!proto.protocol.Display}
+ */
+proto.protocol.Style.prototype.getDisplay = function() {
+  return /** @type {!proto.protocol.Display} */ (jspb.Message.getFieldWithDefault(this, 11, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Display} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setDisplay = function(value) {
+  return jspb.Message.setProto3EnumField(this, 11, value);
+};
+
+
+/**
+ * optional float flex_grow = 12;
+ * @return {number}
+ */
+proto.protocol.Style.prototype.getFlexGrow = function() {
+  return /** @type {number} */ (jspb.Message.getFloatingPointFieldWithDefault(this, 12, 0.0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setFlexGrow = function(value) {
+  return jspb.Message.setProto3FloatField(this, 12, value);
+};
+
+
+/**
+ * optional float flex_shrink = 13;
+ * @return {number}
+ */
+proto.protocol.Style.prototype.getFlexShrink = function() {
+  return /** @type {number} */ (jspb.Message.getFloatingPointFieldWithDefault(this, 13, 0.0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setFlexShrink = function(value) {
+  return jspb.Message.setProto3FloatField(this, 13, value);
+};
+
+
+/**
+ * optional Dimension flex_basis = 14;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getFlexBasis = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 14));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setFlexBasis = function(value) {
+  return jspb.Message.setWrapperField(this, 14, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearFlexBasis = function() {
+  return this.setFlexBasis(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasFlexBasis = function() {
+  return jspb.Message.getField(this, 14) != null;
+};
+
+
+/**
+ * optional Dimension top = 15;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getTop = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 15));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setTop = function(value) {
+  return jspb.Message.setWrapperField(this, 15, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearTop = function() {
+  return this.setTop(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasTop = function() {
+  return jspb.Message.getField(this, 15) != null;
+};
+
+
+/**
+ * optional Dimension left = 16;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getLeft = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 16));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setLeft = function(value) {
+  return jspb.Message.setWrapperField(this, 16, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearLeft = function() {
+  return this.setLeft(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasLeft = function() {
+  return jspb.Message.getField(this, 16) != null;
+};
+
+
+/**
+ * optional Dimension right = 17;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getRight = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 17));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setRight = function(value) {
+  return jspb.Message.setWrapperField(this, 17, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearRight = function() {
+  return this.setRight(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasRight = function() {
+  return jspb.Message.getField(this, 17) != null;
+};
+
+
+/**
+ * optional Dimension bottom = 18;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getBottom = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 18));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setBottom = function(value) {
+  return jspb.Message.setWrapperField(this, 18, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearBottom = function() {
+  return this.setBottom(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasBottom = function() {
+  return jspb.Message.getField(this, 18) != null;
+};
+
+
+/**
+ * optional Dimension margin_top = 19;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getMarginTop = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 19));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setMarginTop = function(value) {
+  return jspb.Message.setWrapperField(this, 19, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearMarginTop = function() {
+  return this.setMarginTop(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasMarginTop = function() {
+  return jspb.Message.getField(this, 19) != null;
+};
+
+
+/**
+ * optional Dimension margin_left = 20;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getMarginLeft = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 20));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setMarginLeft = function(value) {
+  return jspb.Message.setWrapperField(this, 20, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearMarginLeft = function() {
+  return this.setMarginLeft(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasMarginLeft = function() {
+  return jspb.Message.getField(this, 20) != null;
+};
+
+
+/**
+ * optional Dimension margin_right = 21;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getMarginRight = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 21));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setMarginRight = function(value) {
+  return jspb.Message.setWrapperField(this, 21, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearMarginRight = function() {
+  return this.setMarginRight(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasMarginRight = function() {
+  return jspb.Message.getField(this, 21) != null;
+};
+
+
+/**
+ * optional Dimension margin_bottom = 22;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getMarginBottom = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 22));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setMarginBottom = function(value) {
+  return jspb.Message.setWrapperField(this, 22, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearMarginBottom = function() {
+  return this.setMarginBottom(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasMarginBottom = function() {
+  return jspb.Message.getField(this, 22) != null;
+};
+
+
+/**
+ * optional Dimension padding_top = 23;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getPaddingTop = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 23));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setPaddingTop = function(value) {
+  return jspb.Message.setWrapperField(this, 23, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearPaddingTop = function() {
+  return this.setPaddingTop(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasPaddingTop = function() {
+  return jspb.Message.getField(this, 23) != null;
+};
+
+
+/**
+ * optional Dimension padding_left = 24;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getPaddingLeft = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 24));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setPaddingLeft = function(value) {
+  return jspb.Message.setWrapperField(this, 24, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearPaddingLeft = function() {
+  return this.setPaddingLeft(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasPaddingLeft = function() {
+  return jspb.Message.getField(this, 24) != null;
+};
+
+
+/**
+ * optional Dimension padding_right = 25;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getPaddingRight = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 25));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setPaddingRight = function(value) {
+  return jspb.Message.setWrapperField(this, 25, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearPaddingRight = function() {
+  return this.setPaddingRight(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasPaddingRight = function() {
+  return jspb.Message.getField(this, 25) != null;
+};
+
+
+/**
+ * optional Dimension padding_bottom = 26;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getPaddingBottom = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 26));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setPaddingBottom = function(value) {
+  return jspb.Message.setWrapperField(this, 26, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearPaddingBottom = function() {
+  return this.setPaddingBottom(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasPaddingBottom = function() {
+  return jspb.Message.getField(this, 26) != null;
+};
+
+
+/**
+ * optional float aspect_ratio = 27;
+ * @return {number}
+ */
+proto.protocol.Style.prototype.getAspectRatio = function() {
+  return /** @type {number} */ (jspb.Message.getFloatingPointFieldWithDefault(this, 27, 0.0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setAspectRatio = function(value) {
+  return jspb.Message.setProto3FloatField(this, 27, value);
+};
+
+
+/**
+ * optional Dimension width = 28;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getWidth = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 28));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setWidth = function(value) {
+  return jspb.Message.setWrapperField(this, 28, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearWidth = function() {
+  return this.setWidth(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasWidth = function() {
+  return jspb.Message.getField(this, 28) != null;
+};
+
+
+/**
+ * optional Dimension height = 29;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getHeight = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 29));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setHeight = function(value) {
+  return jspb.Message.setWrapperField(this, 29, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearHeight = function() {
+  return this.setHeight(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasHeight = function() {
+  return jspb.Message.getField(this, 29) != null;
+};
+
+
+/**
+ * optional Dimension min_width = 30;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getMinWidth = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 30));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setMinWidth = function(value) {
+  return jspb.Message.setWrapperField(this, 30, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearMinWidth = function() {
+  return this.setMinWidth(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasMinWidth = function() {
+  return jspb.Message.getField(this, 30) != null;
+};
+
+
+/**
+ * optional Dimension max_width = 31;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getMaxWidth = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 31));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setMaxWidth = function(value) {
+  return jspb.Message.setWrapperField(this, 31, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearMaxWidth = function() {
+  return this.setMaxWidth(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasMaxWidth = function() {
+  return jspb.Message.getField(this, 31) != null;
+};
+
+
+/**
+ * optional Dimension min_height = 32;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getMinHeight = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 32));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setMinHeight = function(value) {
+  return jspb.Message.setWrapperField(this, 32, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearMinHeight = function() {
+  return this.setMinHeight(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasMinHeight = function() {
+  return jspb.Message.getField(this, 32) != null;
+};
+
+
+/**
+ * optional Dimension max_height = 33;
+ * @return {?proto.protocol.Dimension}
+ */
+proto.protocol.Style.prototype.getMaxHeight = function() {
+  return /** @type{?proto.protocol.Dimension} */ (
+    jspb.Message.getWrapperField(this, proto.protocol.Dimension, 33));
+};
+
+
+/**
+ * @param {?proto.protocol.Dimension|undefined} value
+ * @return {!proto.protocol.Style} returns this
+*/
+proto.protocol.Style.prototype.setMaxHeight = function(value) {
+  return jspb.Message.setWrapperField(this, 33, value);
+};
+
+
+/**
+ * Clears the message field making it undefined.
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.clearMaxHeight = function() {
+  return this.setMaxHeight(undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Style.prototype.hasMaxHeight = function() {
+  return jspb.Message.getField(this, 33) != null;
+};
+
+
+/**
+ * optional int32 z_index = 36;
+ * @return {number}
+ */
+proto.protocol.Style.prototype.getZIndex = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 36, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.Style} returns this
+ */
+proto.protocol.Style.prototype.setZIndex = function(value) {
+  return jspb.Message.setProto3IntField(this, 36, value);
 };
 
 
 
+/**
+ * List of repeated fields within this message type.
+ * @private {!Array<number>}
+ * @const
+ */
+proto.protocol.SetLayoutValues.repeatedFields_ = [1,2,3];
+
 
 
 if (jspb.Message.GENERATE_TO_OBJECT) {
@@ -2747,8 +7884,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.protocol.RemoveChild.prototype.toObject = function(opt_includeInstance) {
-  return proto.protocol.RemoveChild.toObject(opt_includeInstance, this);
+proto.protocol.SetLayoutValues.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.SetLayoutValues.toObject(opt_includeInstance, this);
 };
 
 
@@ -2757,14 +7894,15 @@ proto.protocol.RemoveChild.prototype.toObject = function(opt_includeInstance) {
  * @param {boolean|undefined} includeInstance Deprecated. Whether to include
  *     the JSPB instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.protocol.RemoveChild} msg The msg instance to transform.
+ * @param {!proto.protocol.SetLayoutValues} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.RemoveChild.toObject = function(includeInstance, msg) {
+proto.protocol.SetLayoutValues.toObject = function(includeInstance, msg) {
   var f, obj = {
-    parentUid: jspb.Message.getFieldWithDefault(msg, 1, ""),
-    childUid: jspb.Message.getFieldWithDefault(msg, 2, "")
+    handlesList: (f = jspb.Message.getRepeatedField(msg, 1)) == null ? undefined : f,
+    propIdsList: (f = jspb.Message.getRepeatedField(msg, 2)) == null ? undefined : f,
+    valuesList: (f = jspb.Message.getRepeatedFloatingPointField(msg, 3)) == null ? undefined : f
   };
 
   if (includeInstance) {
@@ -2778,23 +7916,23 @@ proto.protocol.RemoveChild.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.protocol.RemoveChild}
+ * @return {!proto.protocol.SetLayoutValues}
  */
-proto.protocol.RemoveChild.deserializeBinary = function(bytes) {
+proto.protocol.SetLayoutValues.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.protocol.RemoveChild;
-  return proto.protocol.RemoveChild.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.protocol.SetLayoutValues;
+  return proto.protocol.SetLayoutValues.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.protocol.RemoveChild} msg The message object to deserialize into.
+ * @param {!proto.protocol.SetLayoutValues} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.protocol.RemoveChild}
+ * @return {!proto.protocol.SetLayoutValues}
  */
-proto.protocol.RemoveChild.deserializeBinaryFromReader = function(msg, reader) {
+proto.protocol.SetLayoutValues.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -2802,12 +7940,16 @@ proto.protocol.RemoveChild.deserializeBinaryFromReader = function(msg, reader) {
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setParentUid(value);
+      var value = /** @type {!Array<number>} */ (reader.readPackedUint32());
+      msg.setHandlesList(value);
       break;
     case 2:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setChildUid(value);
+      var value = /** @type {!Array<number>} */ (reader.readPackedUint32());
+      msg.setPropIdsList(value);
+      break;
+    case 3:
+      var value = /** @type {!Array<number>} */ (reader.readPackedFloat());
+      msg.setValuesList(value);
       break;
     default:
       reader.skipField();
@@ -2822,9 +7964,9 @@ proto.protocol.RemoveChild.deserializeBinaryFromReader = function(msg, reader) {
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.protocol.RemoveChild.prototype.serializeBinary = function() {
+proto.protocol.SetLayoutValues.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.RemoveChild.serializeBinaryToWriter(this, writer);
+  proto.protocol.SetLayoutValues.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -2832,62 +7974,144 @@ proto.protocol.RemoveChild.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.RemoveChild} message
+ * @param {!proto.protocol.SetLayoutValues} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.RemoveChild.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.SetLayoutValues.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getParentUid();
+  f = message.getHandlesList();
   if (f.length > 0) {
-    writer.writeString(
+    writer.writePackedUint32(
       1,
       f
     );
   }
-  f = message.getChildUid();
+  f = message.getPropIdsList();
   if (f.length > 0) {
-    writer.writeString(
+    writer.writePackedUint32(
       2,
       f
     );
   }
+  f = message.getValuesList();
+  if (f.length > 0) {
+    writer.writePackedFloat(
+      3,
+      f
+    );
+  }
 };
 
 
 /**
- * optional string parent_uid = 1;
- * @return {string}
+ * repeated uint32 handles = 1;
+ * @return {!Array<number>}
  */
-proto.protocol.RemoveChild.prototype.getParentUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.protocol.SetLayoutValues.prototype.getHandlesList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 1));
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.RemoveChild} returns this
+ * @param {!Array<number>} value
+ * @return {!proto.protocol.SetLayoutValues} returns this
  */
-proto.protocol.RemoveChild.prototype.setParentUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 1, value);
+proto.protocol.SetLayoutValues.prototype.setHandlesList = function(value) {
+  return jspb.Message.setField(this, 1, value || []);
 };
 
 
 /**
- * optional string child_uid = 2;
- * @return {string}
+ * @param {number} value
+ * @param {number=} opt_index
+ * @return {!proto.protocol.SetLayoutValues} returns this
  */
-proto.protocol.RemoveChild.prototype.getChildUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 2, ""));
+proto.protocol.SetLayoutValues.prototype.addHandles = function(value, opt_index) {
+  return jspb.Message.addToRepeatedField(this, 1, value, opt_index);
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.RemoveChild} returns this
+ * Clears the list making it empty but non-null.
+ * @return {!proto.protocol.SetLayoutValues} returns this
  */
-proto.protocol.RemoveChild.prototype.setChildUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 2, value);
+proto.protocol.SetLayoutValues.prototype.clearHandlesList = function() {
+  return this.setHandlesList([]);
+};
+
+
+/**
+ * repeated uint32 prop_ids = 2;
+ * @return {!Array<number>}
+ */
+proto.protocol.SetLayoutValues.prototype.getPropIdsList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedField(this, 2));
+};
+
+
+/**
+ * @param {!Array<number>} value
+ * @return {!proto.protocol.SetLayoutValues} returns this
+ */
+proto.protocol.SetLayoutValues.prototype.setPropIdsList = function(value) {
+  return jspb.Message.setField(this, 2, value || []);
+};
+
+
+/**
+ * @param {number} value
+ * @param {number=} opt_index
+ * @return {!proto.protocol.SetLayoutValues} returns this
+ */
+proto.protocol.SetLayoutValues.prototype.addPropIds = function(value, opt_index) {
+  return jspb.Message.addToRepeatedField(this, 2, value, opt_index);
+};
+
+
+/**
+ * Clears the list making it empty but non-null.
+ * @return {!proto.protocol.SetLayoutValues} returns this
+ */
+proto.protocol.SetLayoutValues.prototype.clearPropIdsList = function() {
+  return this.setPropIdsList([]);
+};
+
+
+/**
+ * repeated float values = 3;
+ * @return {!Array<number>}
+ */
+proto.protocol.SetLayoutValues.prototype.getValuesList = function() {
+  return /** @type {!Array<number>} */ (jspb.Message.getRepeatedFloatingPointField(this, 3));
+};
+
+
+/**
+ * @param {!Array<number>} value
+ * @return {!proto.protocol.SetLayoutValues} returns this
+ */
+proto.protocol.SetLayoutValues.prototype.setValuesList = function(value) {
+  return jspb.Message.setField(this, 3, value || []);
+};
+
+
+/**
+ * @param {number} value
+ * @param {number=} opt_index
+ * @return {!proto.protocol.SetLayoutValues} returns this
+ */
+proto.protocol.SetLayoutValues.prototype.addValues = function(value, opt_index) {
+  return jspb.Message.addToRepeatedField(this, 3, value, opt_index);
+};
+
+
+/**
+ * Clears the list making it empty but non-null.
+ * @return {!proto.protocol.SetLayoutValues} returns this
+ */
+proto.protocol.SetLayoutValues.prototype.clearValuesList = function() {
+  return this.setValuesList([]);
 };
 
 
@@ -2907,8 +8131,8 @@ if (jspb.Message.GENERATE_TO_OBJECT) {
  *     http://goto/soy-param-migration
  * @return {!Object}
  */
-proto.protocol.CommitUpdates.prototype.toObject = function(opt_includeInstance) {
-  return proto.protocol.CommitUpdates.toObject(opt_includeInstance, this);
+proto.protocol.Dimension.prototype.toObject = function(opt_includeInstance) {
+  return proto.protocol.Dimension.toObject(opt_includeInstance, this);
 };
 
 
@@ -2917,13 +8141,14 @@ proto.protocol.CommitUpdates.prototype.toObject = function(opt_includeInstance)
  * @param {boolean|undefined} includeInstance Deprecated. Whether to include
  *     the JSPB instance for transitional soy proto support:
  *     http://goto/soy-param-migration
- * @param {!proto.protocol.CommitUpdates} msg The msg instance to transform.
+ * @param {!proto.protocol.Dimension} msg The msg instance to transform.
  * @return {!Object}
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.CommitUpdates.toObject = function(includeInstance, msg) {
+proto.protocol.Dimension.toObject = function(includeInstance, msg) {
   var f, obj = {
-    containerUid: jspb.Message.getFieldWithDefault(msg, 1, "")
+    value: jspb.Message.getFloatingPointFieldWithDefault(msg, 1, 0.0),
+    unit: jspb.Message.getFieldWithDefault(msg, 2, 0)
   };
 
   if (includeInstance) {
@@ -2937,23 +8162,23 @@ proto.protocol.CommitUpdates.toObject = function(includeInstance, msg) {
 /**
  * Deserializes binary data (in protobuf wire format).
  * @param {jspb.ByteSource} bytes The bytes to deserialize.
- * @return {!proto.protocol.CommitUpdates}
+ * @return {!proto.protocol.Dimension}
  */
-proto.protocol.CommitUpdates.deserializeBinary = function(bytes) {
+proto.protocol.Dimension.deserializeBinary = function(bytes) {
   var reader = new jspb.BinaryReader(bytes);
-  var msg = new proto.protocol.CommitUpdates;
-  return proto.protocol.CommitUpdates.deserializeBinaryFromReader(msg, reader);
+  var msg = new proto.protocol.Dimension;
+  return proto.protocol.Dimension.deserializeBinaryFromReader(msg, reader);
 };
 
 
 /**
  * Deserializes binary data (in protobuf wire format) from the
  * given reader into the given message object.
- * @param {!proto.protocol.CommitUpdates} msg The message object to deserialize into.
+ * @param {!proto.protocol.Dimension} msg The message object to deserialize into.
  * @param {!jspb.BinaryReader} reader The BinaryReader to use.
- * @return {!proto.protocol.CommitUpdates}
+ * @return {!proto.protocol.Dimension}
  */
-proto.protocol.CommitUpdates.deserializeBinaryFromReader = function(msg, reader) {
+proto.protocol.Dimension.deserializeBinaryFromReader = function(msg, reader) {
   while (reader.nextField()) {
     if (reader.isEndGroup()) {
       break;
@@ -2961,8 +8186,12 @@ proto.protocol.CommitUpdates.deserializeBinaryFromReader = function(msg, reader)
     var field = reader.getFieldNumber();
     switch (field) {
     case 1:
-      var value = /** @type {string} */ (reader.readString());
-      msg.setContainerUid(value);
+      var value = /** @type {number} */ (reader.readFloat());
+      msg.setValue(value);
+      break;
+    case 2:
+      var value = /** @type {!proto.protocol.Unit} */ (reader.readEnum());
+      msg.setUnit(value);
       break;
     default:
       reader.skipField();
@@ -2977,9 +8206,9 @@ proto.protocol.CommitUpdates.deserializeBinaryFromReader = function(msg, reader)
  * Serializes the message to binary data (in protobuf wire format).
  * @return {!Uint8Array}
  */
-proto.protocol.CommitUpdates.prototype.serializeBinary = function() {
+proto.protocol.Dimension.prototype.serializeBinary = function() {
   var writer = new jspb.BinaryWriter();
-  proto.protocol.CommitUpdates.serializeBinaryToWriter(this, writer);
+  proto.protocol.Dimension.serializeBinaryToWriter(this, writer);
   return writer.getResultBuffer();
 };
 
@@ -2987,37 +8216,62 @@ proto.protocol.CommitUpdates.prototype.serializeBinary = function() {
 /**
  * Serializes the given message to binary data (in protobuf wire
  * format), writing to the given BinaryWriter.
- * @param {!proto.protocol.CommitUpdates} message
+ * @param {!proto.protocol.Dimension} message
  * @param {!jspb.BinaryWriter} writer
  * @suppress {unusedLocalVariables} f is only used for nested messages
  */
-proto.protocol.CommitUpdates.serializeBinaryToWriter = function(message, writer) {
+proto.protocol.Dimension.serializeBinaryToWriter = function(message, writer) {
   var f = undefined;
-  f = message.getContainerUid();
-  if (f.length > 0) {
-    writer.writeString(
+  f = message.getValue();
+  if (f !== 0.0) {
+    writer.writeFloat(
       1,
       f
     );
   }
+  f = message.getUnit();
+  if (f !== 0.0) {
+    writer.writeEnum(
+      2,
+      f
+    );
+  }
 };
 
 
 /**
- * optional string container_uid = 1;
- * @return {string}
+ * optional float value = 1;
+ * @return {number}
  */
-proto.protocol.CommitUpdates.prototype.getContainerUid = function() {
-  return /** @type {string} */ (jspb.Message.getFieldWithDefault(this, 1, ""));
+proto.protocol.Dimension.prototype.getValue = function() {
+  return /** @type {number} */ (jspb.Message.getFloatingPointFieldWithDefault(this, 1, 0.0));
 };
 
 
 /**
- * @param {string} value
- * @return {!proto.protocol.CommitUpdates} returns this
+ * @param {number} value
+ * @return {!proto.protocol.Dimension} returns this
  */
-proto.protocol.CommitUpdates.prototype.setContainerUid = function(value) {
-  return jspb.Message.setProto3StringField(this, 1, value);
+proto.protocol.Dimension.prototype.setValue = function(value) {
+  return jspb.Message.setProto3FloatField(this, 1, value);
+};
+
+
+/**
+ * optional Unit unit = 2;
+ * @return {!proto.protocol.Unit}
+ */
+proto.protocol.Dimension.prototype.getUnit = function() {
+  return /** @type {!proto.protocol.Unit} */ (jspb.Message.getFieldWithDefault(this, 2, 0));
+};
+
+
+/**
+ * @param {!proto.protocol.Unit} value
+ * @return {!proto.protocol.Dimension} returns this
+ */
+proto.protocol.Dimension.prototype.setUnit = function(value) {
+  return jspb.Message.setProto3EnumField(this, 2, value);
 };
 
 
@@ -3030,7 +8284,7 @@ proto.protocol.CommitUpdates.prototype.setContainerUid = function(value) {
  * @private {!Array<!Array<number>>}
  * @const
  */
-proto.protocol.Prop.oneofGroups_ = [[2,3,4,5,6,7]];
+proto.protocol.Prop.oneofGroups_ = [[2,3,4,5,6,7,9]];
 
 /**
  * @enum {number}
@@ -3042,7 +8296,8 @@ proto.protocol.Prop.ValueCase = {
   FLOAT_VALUE: 4,
   BOOL_VALUE: 5,
   OBJECT_VALUE: 6,
-  UNDEFINED: 7
+  UNDEFINED: 7,
+  STRING_ID: 9
 };
 
 /**
@@ -3084,12 +8339,14 @@ proto.protocol.Prop.prototype.toObject = function(opt_includeInstance) {
 proto.protocol.Prop.toObject = function(includeInstance, msg) {
   var f, obj = {
     key: jspb.Message.getFieldWithDefault(msg, 1, ""),
+    keyId: jspb.Message.getFieldWithDefault(msg, 8, 0),
     stringValue: jspb.Message.getFieldWithDefault(msg, 2, ""),
     intValue: jspb.Message.getFieldWithDefault(msg, 3, 0),
     floatValue: jspb.Message.getFloatingPointFieldWithDefault(msg, 4, 0.0),
     boolValue: jspb.Message.getBooleanFieldWithDefault(msg, 5, false),
     objectValue: (f = msg.getObjectValue()) && proto.protocol.ObjectValue.toObject(includeInstance, f),
-    undefined: jspb.Message.getBooleanFieldWithDefault(msg, 7, false)
+    undefined: jspb.Message.getBooleanFieldWithDefault(msg, 7, false),
+    stringId: jspb.Message.getFieldWithDefault(msg, 9, 0)
   };
 
   if (includeInstance) {
@@ -3130,6 +8387,10 @@ proto.protocol.Prop.deserializeBinaryFromReader = function(msg, reader) {
       var value = /** @type {string} */ (reader.readString());
       msg.setKey(value);
       break;
+    case 8:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setKeyId(value);
+      break;
     case 2:
       var value = /** @type {string} */ (reader.readString());
       msg.setStringValue(value);
@@ -3155,6 +8416,10 @@ proto.protocol.Prop.deserializeBinaryFromReader = function(msg, reader) {
       var value = /** @type {boolean} */ (reader.readBool());
       msg.setUndefined(value);
       break;
+    case 9:
+      var value = /** @type {number} */ (reader.readUint32());
+      msg.setStringId(value);
+      break;
     default:
       reader.skipField();
       break;
@@ -3191,6 +8456,13 @@ proto.protocol.Prop.serializeBinaryToWriter = function(message, writer) {
       f
     );
   }
+  f = message.getKeyId();
+  if (f !== 0) {
+    writer.writeUint32(
+      8,
+      f
+    );
+  }
   f = /** @type {string} */ (jspb.Message.getField(message, 2));
   if (f != null) {
     writer.writeString(
@@ -3234,6 +8506,13 @@ proto.protocol.Prop.serializeBinaryToWriter = function(message, writer) {
       f
     );
   }
+  f = /** @type {number} */ (jspb.Message.getField(message, 9));
+  if (f != null) {
+    writer.writeUint32(
+      9,
+      f
+    );
+  }
 };
 
 
@@ -3255,6 +8534,24 @@ proto.protocol.Prop.prototype.setKey = function(value) {
 };
 
 
+/**
+ * optional uint32 key_id = 8;
+ * @return {number}
+ */
+proto.protocol.Prop.prototype.getKeyId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 8, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.Prop} returns this
+ */
+proto.protocol.Prop.prototype.setKeyId = function(value) {
+  return jspb.Message.setProto3IntField(this, 8, value);
+};
+
+
 /**
  * optional string string_value = 2;
  * @return {string}
@@ -3472,6 +8769,42 @@ proto.protocol.Prop.prototype.hasUndefined = function() {
 };
 
 
+/**
+ * optional uint32 string_id = 9;
+ * @return {number}
+ */
+proto.protocol.Prop.prototype.getStringId = function() {
+  return /** @type {number} */ (jspb.Message.getFieldWithDefault(this, 9, 0));
+};
+
+
+/**
+ * @param {number} value
+ * @return {!proto.protocol.Prop} returns this
+ */
+proto.protocol.Prop.prototype.setStringId = function(value) {
+  return jspb.Message.setOneofField(this, 9, proto.protocol.Prop.oneofGroups_[0], value);
+};
+
+
+/**
+ * Clears the field making it undefined.
+ * @return {!proto.protocol.Prop} returns this
+ */
+proto.protocol.Prop.prototype.clearStringId = function() {
+  return jspb.Message.setOneofField(this, 9, proto.protocol.Prop.oneofGroups_[0], undefined);
+};
+
+
+/**
+ * Returns whether this field is set.
+ * @return {boolean}
+ */
+proto.protocol.Prop.prototype.hasStringId = function() {
+  return jspb.Message.getField(this, 9) != null;
+};
+
+
 
 /**
  * List of repeated fields within this message type.
@@ -3632,4 +8965,109 @@ proto.protocol.ObjectValue.prototype.clearPropsList = function() {
 };
 
 
+/**
+ * @enum {number}
+ */
+proto.protocol.Compression = {
+  COMPRESSION_NONE: 0,
+  COMPRESSION_DEFLATE: 1
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.LayoutValueFlags = {
+  LAYOUT_VALUE_POINT: 0,
+  LAYOUT_VALUE_PERCENT: 256
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.Unit = {
+  UNIT_POINT: 0,
+  UNIT_PERCENT: 1,
+  UNIT_AUTO: 2
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.FlexDirection = {
+  FLEX_DIRECTION_COLUMN: 0,
+  FLEX_DIRECTION_COLUMN_REVERSE: 1,
+  FLEX_DIRECTION_ROW: 2,
+  FLEX_DIRECTION_ROW_REVERSE: 3
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.Direction = {
+  DIRECTION_INHERIT: 0,
+  DIRECTION_LTR: 1,
+  DIRECTION_RTL: 2
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.Justify = {
+  JUSTIFY_FLEX_START: 0,
+  JUSTIFY_CENTER: 1,
+  JUSTIFY_FLEX_END: 2,
+  JUSTIFY_SPACE_BETWEEN: 3,
+  JUSTIFY_SPACE_AROUND: 4,
+  JUSTIFY_SPACE_EVENLY: 5
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.Align = {
+  ALIGN_AUTO: 0,
+  ALIGN_FLEX_START: 1,
+  ALIGN_CENTER: 2,
+  ALIGN_FLEX_END: 3,
+  ALIGN_STRETCH: 4,
+  ALIGN_BASELINE: 5,
+  ALIGN_SPACE_BETWEEN: 6,
+  ALIGN_SPACE_AROUND: 7
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.PositionType = {
+  POSITION_TYPE_STATIC: 0,
+  POSITION_TYPE_RELATIVE: 1,
+  POSITION_TYPE_ABSOLUTE: 2
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.Wrap = {
+  WRAP_NO_WRAP: 0,
+  WRAP_WRAP: 1,
+  WRAP_WRAP_REVERSE: 2
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.Overflow = {
+  OVERFLOW_VISIBLE: 0,
+  OVERFLOW_HIDDEN: 1,
+  OVERFLOW_SCROLL: 2
+};
+
+/**
+ * @enum {number}
+ */
+proto.protocol.Display = {
+  DISPLAY_FLEX: 0,
+  DISPLAY_NONE: 1
+};
+
 goog.object.extend(exports, proto.protocol);
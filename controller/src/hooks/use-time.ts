@@ -1,17 +1,38 @@
 import { performance } from "perf_hooks";
-import { useEffect, useState } from "react";
+import { useContext, useEffect, useState } from "react";
+import { WhenReadyContext } from "../lib/when-ready";
 
-// TODO: This is inadequate
+const FRAME_INTERVAL_MS = 8;
+
+// Advances at most every 8 ms, and only once OBS has caught up with the last
+// frame, so an animation renders at the rate OBS does instead of queueing
+// frames behind it
 export function useTime() {
+  const whenReady = useContext(WhenReadyContext);
   const [time, setTime] = useState<number>(() => performance.now());
 
   useEffect(() => {
-    const interval = setInterval(() => {
+    let stopped = false;
+    let timeout: NodeJS.Timeout;
+
+    const tick = async () => {
+      await whenReady();
+
+      if (stopped) {
+        return;
+      }
+
       setTime(performance.now());
-    }, 8);
+      timeout = setTimeout(tick, FRAME_INTERVAL_MS);
+    };
+
+    timeout = setTimeout(tick, FRAME_INTERVAL_MS);
 
-    return () => clearInterval(interval);
-  }, []);
+    return () => {
+      stopped = true;
+      clearTimeout(timeout);
+    };
+  }, [whenReady]);
 
   return time;
 }
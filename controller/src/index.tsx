@@ -1,26 +1,26 @@
-import { ReactNode } from 'react';
-import { createConnection, Socket } from 'net';
-import { ServerAPI } from './server-api';
+import React, { ReactNode } from 'react';
+import { createConnection, NetConnectOpts } from 'net';
+import { ServerAPI, ServerAPIOptions } from './server-api';
 import { reconciler } from './react-reconciler';
 import { Container } from './types';
+import { WhenReadyContext } from './lib/when-ready';
 
 export class ReactOBS {
-  static connect(host: string, port: number): Promise<ReactOBS> {
-    return new Promise((resolve, reject) => {
-      const socket: Socket = createConnection({ host, port }, async () => {
-        try {
-          await api.initialize();
-        } catch (error) {
-          reject(error);
-          return;
-        }
-
-        resolve(new ReactOBS(api));
-      });
-      const api = new ServerAPI(socket);
-
-      socket.once('error', reject);
-    });
+  static connect(host: string, port: number, options: ServerAPIOptions = {}): Promise<ReactOBS> {
+    return ReactOBS.connectTo({ host, port }, options);
+  }
+
+  // Same-host connection over the plugin's Unix domain socket
+  static connectUnix(path: string = '/tmp/react-obs.sock', options: ServerAPIOptions = {}): Promise<ReactOBS> {
+    return ReactOBS.connectTo({ path }, options);
+  }
+
+  private static async connectTo(options: NetConnectOpts, apiOptions: ServerAPIOptions = {}): Promise<ReactOBS> {
+    const api = new ServerAPI(() => createConnection(options), apiOptions);
+
+    await api.connect();
+
+    return new ReactOBS(api);
   }
 
   private reconciler = reconciler(this.api);
@@ -31,11 +31,21 @@ export class ReactOBS {
     return new Promise((resolve, _reject) => {
       const root = this.reconciler.createContainer(container, false, false);
 
-      this.reconciler.updateContainer(element, root, null, resolve);
+      this.reconciler.updateContainer(
+        <WhenReadyContext.Provider value={this.whenReady}>{element}</WhenReadyContext.Provider>,
+        root,
+        null,
+        resolve
+      );
     });
   }
 
   findScene(name: string): Promise<Container> {
     return this.api.findContainer(name);
   }
+
+  // Resolves once OBS has caught up with the updates sent so far
+  whenReady = (): Promise<void> => {
+    return this.api.whenReady();
+  }
 }
@@ -0,0 +1,295 @@
+import { Align, Dimension, Direction, Display, FlexDirection, Justify, Overflow, PositionType, Style, Unit, Wrap } from '../generated/protocol_pb';
+
+// Converts a style prop into a typed Style message, so the plugin does not
+// have to parse any strings
+
+const ALIGN: { [name: string]: number } = {
+  'auto': Align.ALIGN_AUTO,
+  'flex-start': Align.ALIGN_FLEX_START,
+  'center': Align.ALIGN_CENTER,
+  'flex-end': Align.ALIGN_FLEX_END,
+  'stretch': Align.ALIGN_STRETCH,
+  'baseline': Align.ALIGN_BASELINE,
+  'space-between': Align.ALIGN_SPACE_BETWEEN,
+  'space-around': Align.ALIGN_SPACE_AROUND,
+};
+
+const FLEX_DIRECTION: { [name: string]: number } = {
+  'column': FlexDirection.FLEX_DIRECTION_COLUMN,
+  'column-reverse': FlexDirection.FLEX_DIRECTION_COLUMN_REVERSE,
+  'row': FlexDirection.FLEX_DIRECTION_ROW,
+  'row-reverse': FlexDirection.FLEX_DIRECTION_ROW_REVERSE,
+};
+
+const DIRECTION: { [name: string]: number } = {
+  'inherit': Direction.DIRECTION_INHERIT,
+  'ltr': Direction.DIRECTION_LTR,
+  'rtl': Direction.DIRECTION_RTL,
+};
+
+const JUSTIFY: { [name: string]: number } = {
+  'flex-start': Justify.JUSTIFY_FLEX_START,
+  'center': Justify.JUSTIFY_CENTER,
+  'flex-end': Justify.JUSTIFY_FLEX_END,
+  'space-between': Justify.JUSTIFY_SPACE_BETWEEN,
+  'space-around': Justify.JUSTIFY_SPACE_AROUND,
+  'space-evenly': Justify.JUSTIFY_SPACE_EVENLY,
+};
+
+const POSITION_TYPE: { [name: string]: number } = {
+  'static': PositionType.POSITION_TYPE_STATIC,
+  'relative': PositionType.POSITION_TYPE_RELATIVE,
+  'absolute': PositionType.POSITION_TYPE_ABSOLUTE,
+};
+
+const WRAP: { [name: string]: number } = {
+  'no-wrap': Wrap.WRAP_NO_WRAP,
+  'wrap': Wrap.WRAP_WRAP,
+  'wrap-reverse': Wrap.WRAP_WRAP_REVERSE,
+};
+
+const OVERFLOW: { [name: string]: number } = {
+  'visible': Overflow.OVERFLOW_VISIBLE,
+  'hidden': Overflow.OVERFLOW_HIDDEN,
+  'scroll': Overflow.OVERFLOW_SCROLL,
+};
+
+const DISPLAY: { [name: string]: number } = {
+  'flex': Display.DISPLAY_FLEX,
+  'none': Display.DISPLAY_NONE,
+};
+
+// `XXXpx`, `XXX%`, `auto` or a number of pixels
+function asDimension(value: string | number): Dimension | undefined {
+  const dimension = new Dimension();
+
+  if (typeof value === 'number') {
+    dimension.setValue(value);
+    return dimension;
+  }
+
+  if (value === 'auto') {
+    dimension.setUnit(Unit.UNIT_AUTO);
+    return dimension;
+  }
+
+  const match = /^\s*(-?[\d.]+)\s*(px|%)\s*$/.exec(value);
+  if (!match) {
+    return undefined;
+  }
+
+  dimension.setValue(parseFloat(match[1]));
+  dimension.setUnit(match[2] === '%' ? Unit.UNIT_PERCENT : Unit.UNIT_POINT);
+
+  return dimension;
+}
+
+type FieldSetter = (style: Style, value: any) => boolean;
+
+function enumField(values: { [name: string]: number }, set: (style: Style, value: any) => void): FieldSetter {
+  return (style, value) => {
+    if (!(value in values)) {
+      return false;
+    }
+
+    set(style, values[value]);
+    return true;
+  };
+}
+
+function numberField(set: (style: Style, value: number) => void): FieldSetter {
+  return (style, value) => {
+    if (typeof value !== 'number') {
+      return false;
+    }
+
+    set(style, value);
+    return true;
+  };
+}
+
+function dimensionField(set: (style: Style, value: Dimension) => void): FieldSetter {
+  return (style, value) => {
+    const dimension = asDimension(value);
+    if (!dimension) {
+      return false;
+    }
+
+    set(style, dimension);
+    return true;
+  };
+}
+
+// Style props by name, with the number of their field in the Style message
+const STYLE_FIELDS: { [name: string]: [number, FieldSetter] } = {
+  flexDirection: [2, enumField(FLEX_DIRECTION, (s, v) => s.setFlexDirection(v))],
+  direction: [3, enumField(DIRECTION, (s, v) => s.setDirection(v))],
+  justifyContent: [4, enumField(JUSTIFY, (s, v) => s.setJustifyContent(v))],
+  alignContent: [5, enumField(ALIGN, (s, v) => s.setAlignContent(v))],
+  alignItems: [6, enumField(ALIGN, (s, v) => s.setAlignItems(v))],
+  alignSelf: [7, enumField(ALIGN, (s, v) => s.setAlignSelf(v))],
+  position: [8, enumField(POSITION_TYPE, (s, v) => s.setPosition(v))],
+  flexWrap: [9, enumField(WRAP, (s, v) => s.setFlexWrap(v))],
+  overflow: [10, enumField(OVERFLOW, (s, v) => s.setOverflow(v))],
+  display: [11, enumField(DISPLAY, (s, v) => s.setDisplay(v))],
+
+  flexGrow: [12, numberField((s, v) => s.setFlexGrow(v))],
+  flexShrink: [13, numberField((s, v) => s.setFlexShrink(v))],
+  flexBasis: [14, dimensionField((s, v) => s.setFlexBasis(v))],
+
+  top: [15, dimensionField((s, v) => s.setTop(v))],
+  left: [16, dimensionField((s, v) => s.setLeft(v))],
+  right: [17, dimensionField((s, v) => s.setRight(v))],
+  bottom: [18, dimensionField((s, v) => s.setBottom(v))],
+
+  marginTop: [19, dimensionField((s, v) => s.setMarginTop(v))],
+  marginLeft: [20, dimensionField((s, v) => s.setMarginLeft(v))],
+  marginRight: [21, dimensionField((s, v) => s.setMarginRight(v))],
+  marginBottom: [22, dimensionField((s, v) => s.setMarginBottom(v))],
+
+  paddingTop: [23, dimensionField((s, v) => s.setPaddingTop(v))],
+  paddingLeft: [24, dimensionField((s, v) => s.setPaddingLeft(v))],
+  paddingRight: [25, dimensionField((s, v) => s.setPaddingRight(v))],
+  paddingBottom: [26, dimensionField((s, v) => s.setPaddingBottom(v))],
+
+  aspectRatio: [27, numberField((s, v) => s.setAspectRatio(v))],
+
+  width: [28, dimensionField((s, v) => s.setWidth(v))],
+  height: [29, dimensionField((s, v) => s.setHeight(v))],
+  minWidth: [30, dimensionField((s, v) => s.setMinWidth(v))],
+  maxWidth: [31, dimensionField((s, v) => s.setMaxWidth(v))],
+  minHeight: [32, dimensionField((s, v) => s.setMinHeight(v))],
+  maxHeight: [33, dimensionField((s, v) => s.setMaxHeight(v))],
+
+  zIndex: [36, numberField((s, v) => s.setZIndex(Math.round(v)))],
+};
+
+// Sets a field of the message, returning its bit in `present`, or 0 for
+// unknown props and invalid values
+function setStyleField(message: Style, key: string, value: any): number {
+  const field = STYLE_FIELDS[key];
+
+  if (!field || value === undefined) {
+    return 0;
+  }
+
+  const [fieldNumber, set] = field;
+
+  if (!set(message, value)) {
+    console.warn(`Invalid value for style ${key}: ${value}`);
+    return 0;
+  }
+
+  // Bits above 31 do not fit bitwise operators
+  return 2 ** fieldNumber;
+}
+
+function styleFieldBit(key: string): number {
+  const field = STYLE_FIELDS[key];
+
+  return field ? 2 ** field[0] : 0;
+}
+
+// Unknown props and invalid values are left out, which resets them
+export function asStyle(style: { [key: string]: any } | undefined): Style {
+  const message = new Style();
+  let present = 0;
+
+  Object.entries(style || {}).forEach(([key, value]) => {
+    present += setStyleField(message, key, value);
+  });
+
+  message.setPresent(present);
+
+  return message;
+}
+
+// Only the props which changed between the styles, and the removed ones as
+// unset, so the plugin leaves everything else alone
+export function asStylePatch(
+  oldStyle: { [key: string]: any } | undefined,
+  newStyle: { [key: string]: any } | undefined,
+): Style {
+  const message = new Style();
+  let present = 0;
+  let unset = 0;
+
+  oldStyle = oldStyle || {};
+  newStyle = newStyle || {};
+
+  for (const [key, value] of Object.entries(newStyle)) {
+    // Removed props are unset below
+    if (value === undefined || value === oldStyle[key]) {
+      continue;
+    }
+
+    const bit = setStyleField(message, key, value);
+
+    if (bit) {
+      present += bit;
+    } else {
+      unset += styleFieldBit(key);
+    }
+  }
+
+  for (const key of Object.keys(oldStyle)) {
+    if (newStyle[key] === undefined) {
+      unset += styleFieldBit(key);
+    }
+  }
+
+  message.setPatch(true);
+  message.setPresent(present);
+  message.setUnset(unset);
+
+  return message;
+}
+
+// Style props which can be sent as packed layout values, by their id (the
+// number of their field in the Style message)
+export const LAYOUT_VALUE_IDS: { [name: string]: number } = {};
+
+Object.entries(STYLE_FIELDS).forEach(([name, [fieldNumber]]) => {
+  // Everything between the enums and zIndex takes a number
+  if (fieldNumber >= 12 && fieldNumber <= 33) {
+    LAYOUT_VALUE_IDS[name] = fieldNumber;
+  }
+});
+
+// The changed values if a style only changed in numbers of pixels, which can
+// be sent as packed layout values, or undefined if it needs a full update
+export function layoutValueChanges(
+  oldStyle: { [key: string]: any } | undefined,
+  newStyle: { [key: string]: any } | undefined,
+): { [key: string]: number } | undefined {
+  if (!oldStyle || !newStyle) {
+    return undefined;
+  }
+
+  const oldKeys = Object.keys(oldStyle);
+  if (oldKeys.length !== Object.keys(newStyle).length) {
+    return undefined;
+  }
+
+  const changes: { [key: string]: number } = {};
+
+  for (const key of oldKeys) {
+    const value = newStyle[key];
+
+    if (!(key in newStyle)) {
+      return undefined;
+    }
+
+    if (value === oldStyle[key]) {
+      continue;
+    }
+
+    if (!(key in LAYOUT_VALUE_IDS) || typeof value !== 'number' || typeof oldStyle[key] !== 'number') {
+      return undefined;
+    }
+
+    changes[key] = value;
+  }
+
+  return changes;
+}
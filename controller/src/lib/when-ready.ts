@@ -0,0 +1,5 @@
+import { createContext } from 'react';
+
+// Resolves once OBS has caught up with the updates sent so far (see
+// `ServerAPI.whenReady`). Provided by `ReactOBS.render`.
+export const WhenReadyContext = createContext<() => Promise<void>>(() => Promise.resolve());
@@ -15,6 +15,7 @@ import {
 } from './types';
 import Reconciler, { OpaqueHandle } from 'react-reconciler';
 import { traceWrap } from './lib/trace-wrap';
+import { layoutValueChanges } from './lib/style';
 import { ServerAPI } from './server-api';
 
 const ROOT_CONTEXT = {};
@@ -57,7 +58,7 @@ export const reconciler = (api: ServerAPI) => Reconciler<
   },
 
   resetAfterCommit(container: Container): void {
-    api.commitUpdates(container.uid);
+    api.commitUpdates(container);
   },
 
   createInstance(
@@ -265,7 +266,17 @@ export const reconciler = (api: ServerAPI) => Reconciler<
     // console.log('Update', instance, updatePayload.propChanges);
 
     if (type === 'obs_source') {
-      api.updateSource(instance, updatePayload.propChanges);
+      const changedKeys = Object.keys(updatePayload.propChanges);
+      const layoutValues = changedKeys.length === 1 && changedKeys[0] === 'style' ?
+        layoutValueChanges(oldProps.style as Props, newProps.style as Props) :
+        undefined;
+
+      // Animations usually only move things around
+      if (layoutValues) {
+        api.setLayoutValues(instance, layoutValues);
+      } else {
+        api.updateSource(instance, updatePayload.propChanges, oldProps.style as Props | undefined);
+      }
     } else {
       console.error('Unsupported element for update');
       // throw new Error('Unsupported element type');
@@ -277,8 +288,7 @@ export const reconciler = (api: ServerAPI) => Reconciler<
     child: Instance | TextInstance,
     beforeChild: Instance | TextInstance
   ): void {
-    // TODO
-    throw new Error('Not implemented');
+    api.insertBefore(parentInstance, child, beforeChild);
   },
 
   insertInContainerBefore(
@@ -286,8 +296,7 @@ export const reconciler = (api: ServerAPI) => Reconciler<
     child: Instance | TextInstance,
     beforeChild: Instance | TextInstance,
   ): void {
-    // TODO
-    throw new Error('Not implemented');
+    api.insertBefore(container, child, beforeChild);
   },
 
   removeChild(
@@ -1,19 +1,35 @@
 import { BinaryReader } from 'google-protobuf';
 import { Socket } from 'net';
+import { deflateRawSync, inflateRawSync, ZlibOptions } from 'zlib';
 import { v4 as uuid } from 'uuid';
-import { AppendChild, ApplyUpdate, ClientMessage, InitRequest, Prop, UpdateSource, RemoveChild, CreateSource, ObjectValue, FindSourceRequest, Response, ServerMessage, CreateScene, CommitUpdates } from './generated/protocol_pb';
+import { AppendChild, ApplyUpdate, ClientMessage, InitRequest, Prop, UpdateSource, RemoveChild, CreateSource, ObjectValue, FindSourceRequest, Response, ServerMessage, CreateScene, CommitUpdates, Compression, FrameCompression, UpdateBatch, DefineKey, DefineString, SetLayoutValues, InsertBefore, CreateTree, TreeNode } from './generated/protocol_pb';
 import { Container, Instance, PropChanges, Props } from './types';
+import { asStyle, asStylePatch, LAYOUT_VALUE_IDS } from './lib/style';
+
+// The high bit of the size header marks compressed frames
+const COMPRESSED_FRAME_FLAG = 0x80000000;
+
+// Only string values which look like enum values (e.g. 'center') are
+// interned, other text may change on every update. Keys and strings are sent
+// inline once their table is full, which keeps ids far below the server's cap.
+const INTERNED_STRING_PATTERN = /^[A-Za-z][A-Za-z0-9_-]{0,31}$/;
+const MAX_INTERNED_KEYS = 4096;
+const MAX_INTERNED_STRINGS = 1024;
+
+const RECONNECT_DELAY_MS = 1000;
 
 class PacketReader {
   private readingPacket = false;
   private currentPacketSize = 0;
+  private currentPacketCompressed = false;
   private currentReadSize = 0;
   private buffer = Buffer.alloc(1 * 1024 * 1024);
 
   constructor(
     private socket: Socket,
     private onMessage: (message: ServerMessage) => void,
-    private onDisconnect: () => void
+    private onDisconnect: () => void,
+    private decompress: (payload: Buffer) => Buffer
   ) {}
 
   initialize() {
@@ -27,7 +43,13 @@ class PacketReader {
   }
 
   private readPacketFromBuffer() {
-    const reader = new BinaryReader(this.buffer, 0, this.currentReadSize);
+    let packet = this.buffer.subarray(0, this.currentReadSize);
+
+    if (this.currentPacketCompressed) {
+      packet = this.decompress(packet);
+    }
+
+    const reader = new BinaryReader(packet, 0, packet.byteLength);
     const message = new ServerMessage();
 
     ServerMessage.deserializeBinaryFromReader(message, reader);
@@ -45,8 +67,9 @@ class PacketReader {
         return;
       }
 
-      const currentBuffer = Buffer.from(this.socket.read(4));
-      this.currentPacketSize = currentBuffer.readUInt32BE(0);
+      const header = (this.socket.read(4) as Buffer).readUInt32BE(0);
+      this.currentPacketCompressed = (header & COMPRESSED_FRAME_FLAG) !== 0;
+      this.currentPacketSize = header & ~COMPRESSED_FRAME_FLAG;
       this.currentReadSize = 0;
       this.readingPacket = true;
     }
@@ -60,7 +83,7 @@ class PacketReader {
 
     this.resizeBufferToFit(this.currentReadSize + lengthToRead);
 
-    const currentBuffer = Buffer.from(this.socket.read(lengthToRead));
+    const currentBuffer: Buffer = this.socket.read(lengthToRead);
     currentBuffer.copy(this.buffer, this.currentReadSize);
     this.currentReadSize += lengthToRead;
 
@@ -68,8 +91,6 @@ class PacketReader {
       throw new Error('Error in readSegment(), currentReadSize must not be > currentPacketSize');
     }
 
-    console.log('sizes', this.currentReadSize, this.currentPacketSize)
-
     if (this.currentReadSize === this.currentPacketSize) {
       this.readPacketFromBuffer();
 
@@ -94,34 +115,129 @@ class PacketReader {
   }
 }
 
+export interface ServerAPIOptions {
+  // Asks the server to compress large frames, for remote controllers
+  compression?: boolean;
+
+  // Reconnects when the connection drops. The plugin keeps the session for
+  // its grace period, and the controller carries on where it left off.
+  reconnect?: boolean;
+}
+
 export class ServerAPI {
+  // Kept across connections, along with the handles and interned ids, so
+  // that a reconnect resumes the session
   private clientId: string = uuid();
+
+  // Nodes are referred to by session-local handles, allocated densely so the
+  // plugin can use them as indices
+  private nextHandle = 1;
+
+  // Undefined while disconnected
+  private socket: Socket | undefined = undefined;
+
+  // Set if the plugin released the session while we were disconnected. Our
+  // handles no longer refer to anything, so we stop sending.
+  private sessionLost = false;
+  private reconnecting = false;
+
+  // Prop keys and enum-like string values are sent as ids once defined
+  private internedKeys: Map<string, number> = new Map();
+  private internedStrings: Map<string, number> = new Map();
   private requests: Map<string, (error: any, response?: Response) => void> = new Map();
-  private packetReader = new PacketReader(
-    this.socket,
-    message => this.messageReceived(message),
-    () => this.disconnected()
-  );
 
-  constructor(private socket: Socket) {
-    this.socket.setEncoding('binary');
+  // Flow control: update batches we may still send, undefined if the server
+  // does not support it. Batches beyond that are held until credits return.
+  private updateCredits: number | undefined = undefined;
+  private heldBatches: ClientMessage[] = [];
+  private readyCallbacks: (() => void)[] = [];
+
+  // Nodes which have not been attached to a mounted parent yet, sent as one
+  // CreateTree once their root is
+  private unmountedNodes: Map<number, TreeNode> = new Map();
+  private unmountedParents: Map<number, number> = new Map();
+
+  // Updates since the last commit, sent together as an UpdateBatch
+  private pendingUpdates: ApplyUpdate[] = [];
+
+  // Set once the server has agreed to compression
+  private compression: { threshold: number, options: ZlibOptions } | undefined = undefined;
+
+  constructor(private createSocket: () => Socket, private options: ServerAPIOptions = {}) {}
+
+  // Opens a connection and sends the init request. Resolves to whether the
+  // plugin still had our session.
+  connect(): Promise<boolean> {
+    return new Promise((resolve, reject) => {
+      const socket = this.createSocket();
+
+      socket.once('error', reject);
+      socket.once('connect', async () => {
+        socket.off('error', reject);
+
+        // Followed by 'close', which the packet reader handles
+        socket.on('error', error => console.error('Connection error', error));
+
+        this.socket = socket;
+
+        try {
+          resolve(await this.initialize(socket));
+        } catch (error) {
+          reject(error);
+        }
+      });
+    });
   }
 
-  async initialize(): Promise<void> {
+  private async initialize(socket: Socket): Promise<boolean> {
     console.debug(`Connected to server as ${this.clientId}`);
 
     const initRequest = new InitRequest();
     initRequest.setRequestId(uuid());
     initRequest.setClientId(this.clientId);
+    initRequest.setFlowControl(true);
+
+    if (this.options.compression) {
+      initRequest.setCompression(Compression.COMPRESSION_DEFLATE);
+    }
 
     const packet = new ClientMessage();
     packet.setInitRequest(initRequest);
 
-    this.packetReader.initialize();
+    const packetReader = new PacketReader(
+      socket,
+      message => this.messageReceived(message),
+      () => this.disconnected(),
+      payload => this.decompress(payload)
+    );
+
+    packetReader.initialize();
 
     const response = await this.sendExpectingResponse(initRequest.getRequestId(), packet);
 
     console.log('Received response from server', response.toObject(false));
+
+    this.updateCredits = response.getUpdateCredits() > 0 ? response.getUpdateCredits() : undefined;
+
+    return response.getSessionResumed();
+  }
+
+  // Resolves once a new update batch would be sent right away. Animations can
+  // wait for it to render at the rate OBS does.
+  whenReady(): Promise<void> {
+    if (this.isReady()) {
+      return Promise.resolve();
+    }
+
+    return new Promise(resolve => this.readyCallbacks.push(resolve));
+  }
+
+  private isReady(): boolean {
+    if (!this.socket) {
+      return false;
+    }
+
+    return this.updateCredits === undefined || (this.updateCredits > 0 && this.heldBatches.length === 0);
   }
 
   private messageReceived(message: ServerMessage) {
@@ -131,6 +247,11 @@ export class ServerAPI {
       const response = message.getResponse()!;
       const request = this.requests.get(response.getRequestId());
 
+      // Before any other message is read, the next one may already be compressed
+      if (response.hasCompression()) {
+        this.compressionAccepted(response.getCompression()!);
+      }
+
       if (!request) {
         throw new Error('Received response but request cannot be found');
       }
@@ -140,150 +261,316 @@ export class ServerAPI {
       } else {
         request(new Error('Unsuccessful operation'), undefined);
       }
+    } else if (message.hasUpdateCredits()) {
+      this.creditsReceived(message.getUpdateCredits()!.getCredits());
     }
   }
 
+  private compressionAccepted(compression: FrameCompression) {
+    if (compression.getAlgorithm() !== Compression.COMPRESSION_DEFLATE) {
+      return;
+    }
+
+    const dictionary = compression.getDictionary_asU8();
+
+    this.compression = {
+      threshold: compression.getThreshold(),
+      options: dictionary.byteLength > 0 ? { dictionary } : {}
+    };
+  }
+
+  private decompress(payload: Buffer): Buffer {
+    if (!this.compression) {
+      throw new Error('Received a compressed frame without negotiating compression');
+    }
+
+    return inflateRawSync(payload.subarray(4), this.compression.options);
+  }
+
+  private creditsReceived(credits: number) {
+    if (this.updateCredits === undefined) {
+      return;
+    }
+
+    this.updateCredits += credits;
+    this.sendHeldBatches();
+  }
+
+  private sendHeldBatches() {
+    while (this.socket && this.heldBatches.length > 0 && (this.updateCredits === undefined || this.updateCredits > 0)) {
+      this.send(this.heldBatches.shift()!);
+
+      if (this.updateCredits !== undefined) {
+        this.updateCredits--;
+      }
+    }
+
+    if (this.isReady()) {
+      const callbacks = this.readyCallbacks;
+      this.readyCallbacks = [];
+
+      callbacks.forEach(callback => callback());
+    }
+  }
+
+  // Batches sent before the connection dropped may not have been applied, the
+  // ones committed since are held until we are connected again
   private disconnected() {
     console.log('Disconnected from server');
+
+    this.socket = undefined;
+    this.compression = undefined;
+
+    // Their responses will not arrive anymore
+    const requests = this.requests;
+    this.requests = new Map();
+
+    requests.forEach(request => request(new Error('Disconnected from server')));
+
+    // A connection dropping while reconnecting fails the attempt, which
+    // schedules the next one
+    if (this.options.reconnect && !this.sessionLost && !this.reconnecting) {
+      this.reconnecting = true;
+      setTimeout(() => this.reconnect(), RECONNECT_DELAY_MS);
+    }
+  }
+
+  private async reconnect() {
+    let resumed = false;
+
+    try {
+      resumed = await this.connect();
+    } catch (error) {
+      console.log('Could not reconnect to server', error);
+      setTimeout(() => this.reconnect(), RECONNECT_DELAY_MS);
+      return;
+    }
+
+    this.reconnecting = false;
+
+    if (!resumed) {
+      console.error('The server has released our session, restart the controller to render again');
+
+      this.sessionLost = true;
+      this.heldBatches = [];
+      this.socket!.end();
+      return;
+    }
+
+    console.log('Resumed session after reconnecting');
+    this.sendHeldBatches();
   }
 
   // TODO: Clean up containers which are no longer used
   async findContainer(name: string): Promise<Container> {
-    const uid = uuid();
+    const requestId = uuid();
+    const handle = this.allocateHandle();
 
     const request = new FindSourceRequest();
-    request.setRequestId(uid);
-    request.setUid(uid);
+    request.setRequestId(requestId);
+    request.setHandle(handle);
     request.setName(name);
 
     const packet = new ClientMessage();
     packet.setFindSource(request);
 
-    await this.sendExpectingResponse(uid, packet);
+    await this.sendExpectingResponse(requestId, packet);
 
-    return { uid, container: true };
+    return { handle, container: true };
   }
 
   async findUnmanagedSource(name: string): Promise<Instance> {
-    const uid = uuid();
+    const requestId = uuid();
+    const handle = this.allocateHandle();
 
     const request = new FindSourceRequest();
-    request.setRequestId(uid);
-    request.setUid(uid);
+    request.setRequestId(requestId);
+    request.setHandle(handle);
     request.setName(name);
 
     const packet = new ClientMessage();
     packet.setFindSource(request);
 
-    await this.sendExpectingResponse(uid, packet);
+    await this.sendExpectingResponse(requestId, packet);
 
-    return { uid, unmanaged: true };
+    return { handle, unmanaged: true };
   }
 
-  commitUpdates(containerUid: string) {
+  commitUpdates(container: Container) {
     const commitUpdates = new CommitUpdates();
-    commitUpdates.setContainerUid(containerUid);
+    commitUpdates.setContainerHandle(container.handle);
 
     const applyUpdate = new ApplyUpdate();
     applyUpdate.setCommitUpdates(commitUpdates);
 
-    const message = new ClientMessage();
-    message.setApplyUpdate(applyUpdate);
-
-    this.send(message);
+    this.queueUpdate(applyUpdate);
+    this.flushUpdates();
   }
 
   createSource(container: Container, id: string, name: string, props: Props): Instance {
-    const uid = uuid();
+    const handle = this.allocateHandle();
 
     const createSource = new CreateSource();
-    createSource.setUid(uid);
-    createSource.setContainerUid(container.uid);
+    createSource.setHandle(handle);
+    createSource.setContainerHandle(container.handle);
     createSource.setId(id);
     createSource.setName(name);
-    createSource.setSettings(this.asObject(props));
+    const { style, ...settings } = props;
+    createSource.setSettings(this.asObject(settings));
 
-    const applyUpdate = new ApplyUpdate();
-    applyUpdate.setCreateSource(createSource);
+    if (style !== undefined) {
+      createSource.setStyle(asStyle(style as Props));
+    }
 
-    const message = new ClientMessage();
-    message.setApplyUpdate(applyUpdate);
+    const treeNode = new TreeNode();
+    treeNode.setSource(createSource);
 
-    this.send(message);
+    this.unmountedNodes.set(handle, treeNode);
 
-    return { uid };
+    return { handle };
   }
 
-  updateSource(source: Instance, propChanges: PropChanges) {
+  // Style changes are sent as a patch against `oldStyle`
+  updateSource(source: Instance, propChanges: PropChanges, oldStyle?: Props) {
+    this.mountTree(source, undefined);
+
     const updateSource = new UpdateSource();
-    updateSource.setUid(source.uid);
-    updateSource.setChangedProps(this.asObject(propChanges));
+    updateSource.setHandle(source.handle);
+    const { style, ...changedProps } = propChanges;
+    updateSource.setChangedProps(this.asObject(changedProps));
+
+    if ('style' in propChanges) {
+      updateSource.setStyle(asStylePatch(oldStyle, style as Props | undefined));
+    }
 
     const applyUpdate = new ApplyUpdate();
     applyUpdate.setUpdateSource(updateSource);
 
-    const message = new ClientMessage();
-    message.setApplyUpdate(applyUpdate);
-
-    this.send(message);
+    this.queueUpdate(applyUpdate);
   }
 
   createScene(container: Container, name: string, props: Props): Instance {
-    const uid = uuid();
+    const handle = this.allocateHandle();
 
     const createScene = new CreateScene();
-    createScene.setUid(uid);
-    createScene.setContainerUid(container.uid);
+    createScene.setHandle(handle);
+    createScene.setContainerHandle(container.handle);
     createScene.setName(name);
-    createScene.setProps(this.asObject(props));
+    const { style, ...sceneProps } = props;
+    createScene.setProps(this.asObject(sceneProps));
 
-    const applyUpdate = new ApplyUpdate();
-    applyUpdate.setCreateScene(createScene);
+    if (style !== undefined) {
+      createScene.setStyle(asStyle(style as Props));
+    }
 
-    const message = new ClientMessage();
-    message.setApplyUpdate(applyUpdate);
+    const treeNode = new TreeNode();
+    treeNode.setScene(createScene);
 
-    this.send(message);
+    this.unmountedNodes.set(handle, treeNode);
+
+    return { handle };
+  }
+
+  // Sets numeric style values (in pixels) without a full update. Consecutive
+  // calls share one packed message.
+  setLayoutValues(instance: Instance, values: { [key: string]: number }) {
+    if (Object.keys(values).length === 0) {
+      return;
+    }
+
+    this.mountTree(instance, undefined);
+
+    const lastUpdate = this.pendingUpdates[this.pendingUpdates.length - 1];
+    let layoutValues = lastUpdate && lastUpdate.getSetLayoutValues();
+
+    if (!layoutValues) {
+      layoutValues = new SetLayoutValues();
+
+      const applyUpdate = new ApplyUpdate();
+      applyUpdate.setSetLayoutValues(layoutValues);
+
+      this.queueUpdate(applyUpdate);
+    }
 
-    return { uid };
+    Object.entries(values).forEach(([key, value]) => {
+      layoutValues!.addHandles(instance.handle);
+      layoutValues!.addPropIds(LAYOUT_VALUE_IDS[key]);
+      layoutValues!.addValues(value);
+    });
   }
 
   appendChild(parent: Instance, child: Instance) {
+    const parentNode = this.unmountedNodes.get(parent.handle);
+    const childNode = this.unmountedNodes.get(child.handle);
+
+    // Subtrees are built up before they are mounted
+    if (parentNode && childNode) {
+      parentNode.addChildren(childNode);
+      this.unmountedParents.set(child.handle, parent.handle);
+      return;
+    }
+
+    if (childNode) {
+      this.mountTree(child, parent);
+      return;
+    }
+
     const appendChild = new AppendChild();
-    appendChild.setParentUid(parent.uid);
-    appendChild.setChildUid(child.uid);
+    appendChild.setParentHandle(parent.handle);
+    appendChild.setChildHandle(child.handle);
 
     const applyUpdate = new ApplyUpdate();
     applyUpdate.setAppendChild(appendChild);
 
-    const message = new ClientMessage();
-    message.setApplyUpdate(applyUpdate);
+    this.queueUpdate(applyUpdate);
+  }
 
-    this.send(message);
+  // Also moves a child which is in the parent already, keeping its sceneitem
+  insertBefore(parent: Instance, child: Instance, before: Instance) {
+    this.mountTree(child, undefined);
+
+    const insertBefore = new InsertBefore();
+    insertBefore.setParentHandle(parent.handle);
+    insertBefore.setChildHandle(child.handle);
+    insertBefore.setBeforeHandle(before.handle);
+
+    const applyUpdate = new ApplyUpdate();
+    applyUpdate.setInsertBefore(insertBefore);
+
+    this.queueUpdate(applyUpdate);
   }
 
   removeChild(parent: Instance, child: Instance) {
     const removeChild = new RemoveChild();
-    removeChild.setParentUid(parent.uid);
-    removeChild.setChildUid(child.uid);
+    removeChild.setParentHandle(parent.handle);
+    removeChild.setChildHandle(child.handle);
 
     const applyUpdate = new ApplyUpdate();
     applyUpdate.setRemoveChild(removeChild);
 
-    const message = new ClientMessage();
-    message.setApplyUpdate(applyUpdate);
-
-    this.send(message);
+    this.queueUpdate(applyUpdate);
   }
 
   private asProp(key: string, value: string | boolean | number | object | undefined): Prop {
     const propValue = new Prop();
-    propValue.setKey(key);
+    const keyId = this.internKey(key);
+
+    if (keyId !== undefined) {
+      propValue.setKeyId(keyId);
+    } else {
+      propValue.setKey(key);
+    }
 
     if (typeof value === 'undefined') {
       propValue.setUndefined(true);
     } else if (typeof value === 'string') {
-      propValue.setStringValue(value);
+      const stringId = this.internString(value);
+
+      if (stringId !== undefined) {
+        propValue.setStringId(stringId);
+      } else {
+        propValue.setStringValue(value);
+      }
     } else if (typeof value === 'boolean') {
       propValue.setBoolValue(value);
     } else if (typeof value === 'number') {
@@ -311,19 +598,177 @@ export class ServerAPI {
     return objectValue;
   }
 
+  // Definitions are queued ahead of the update using them
+  private internKey(key: string): number | undefined {
+    let id = this.internedKeys.get(key);
+
+    if (id !== undefined) {
+      return id;
+    }
+
+    if (this.internedKeys.size >= MAX_INTERNED_KEYS) {
+      return undefined;
+    }
+
+    id = this.internedKeys.size + 1;
+    this.internedKeys.set(key, id);
+
+    const defineKey = new DefineKey();
+    defineKey.setId(id);
+    defineKey.setKey(key);
+
+    const applyUpdate = new ApplyUpdate();
+    applyUpdate.setDefineKey(defineKey);
+
+    this.queueUpdate(applyUpdate);
+
+    return id;
+  }
+
+  private internString(value: string): number | undefined {
+    let id = this.internedStrings.get(value);
+
+    if (id !== undefined) {
+      return id;
+    }
+
+    if (!INTERNED_STRING_PATTERN.test(value) || this.internedStrings.size >= MAX_INTERNED_STRINGS) {
+      return undefined;
+    }
+
+    id = this.internedStrings.size + 1;
+    this.internedStrings.set(value, id);
+
+    const defineString = new DefineString();
+    defineString.setId(id);
+    defineString.setValue(value);
+
+    const applyUpdate = new ApplyUpdate();
+    applyUpdate.setDefineString(defineString);
+
+    this.queueUpdate(applyUpdate);
+
+    return id;
+  }
+
+  // Sends the unmounted subtree of `node` (if it has not been sent yet) in one
+  // CreateTree, appending it to `parent` if given
+  private mountTree(node: Instance, parent: Instance | undefined) {
+    let rootHandle = node.handle;
+
+    // A node inside a subtree is sent with the whole subtree, unattached
+    while (this.unmountedParents.has(rootHandle)) {
+      rootHandle = this.unmountedParents.get(rootHandle)!;
+      parent = undefined;
+    }
+
+    const rootNode = this.unmountedNodes.get(rootHandle);
+    if (!rootNode) {
+      return;
+    }
+
+    const forgetSubtree = (treeNode: TreeNode) => {
+      const handle = (treeNode.getSource() || treeNode.getScene())!.getHandle();
+
+      this.unmountedNodes.delete(handle);
+      this.unmountedParents.delete(handle);
+      treeNode.getChildrenList().forEach(forgetSubtree);
+    };
+
+    forgetSubtree(rootNode);
+
+    const createTree = new CreateTree();
+    createTree.addRoots(rootNode);
+
+    if (parent) {
+      createTree.setParentHandle(parent.handle);
+    }
+
+    const applyUpdate = new ApplyUpdate();
+    applyUpdate.setCreateTree(createTree);
+
+    this.queueUpdate(applyUpdate);
+  }
+
+  private allocateHandle(): number {
+    return this.nextHandle++;
+  }
+
+  private queueUpdate(update: ApplyUpdate) {
+    this.pendingUpdates.push(update);
+  }
+
+  // Sends the updates of a commit as one batch, which the server applies in
+  // a single step
+  private flushUpdates() {
+    const batch = new UpdateBatch();
+    batch.setUpdatesList(this.pendingUpdates);
+    this.pendingUpdates = [];
+
+    const message = new ClientMessage();
+    message.setUpdateBatch(batch);
+
+    this.sendBatch(message);
+  }
+
+  // Batches go out right away while we have credits, otherwise they are held
+  // in order
+  private sendBatch(message: ClientMessage) {
+    if (this.sessionLost) {
+      return;
+    }
+
+    if (!this.socket) {
+      this.heldBatches.push(message);
+      return;
+    }
+
+    if (this.updateCredits === undefined) {
+      this.send(message);
+      return;
+    }
+
+    if (this.heldBatches.length > 0 || this.updateCredits === 0) {
+      this.heldBatches.push(message);
+      return;
+    }
+
+    this.send(message);
+    this.updateCredits--;
+  }
+
   private send(message: ClientMessage) {
-    const packetBinary = message.serializeBinary();
+    let packetBinary: Uint8Array = message.serializeBinary();
+    let compressedFlag = 0;
+
+    if (this.compression && packetBinary.byteLength >= this.compression.threshold) {
+      const compressed = deflateRawSync(packetBinary, { ...this.compression.options, level: 1 });
+
+      if (4 + compressed.byteLength < packetBinary.byteLength) {
+        const payload = Buffer.alloc(4 + compressed.byteLength);
+        payload.writeUInt32BE(packetBinary.byteLength, 0);
+        compressed.copy(payload, 4);
+
+        packetBinary = payload;
+        compressedFlag = COMPRESSED_FRAME_FLAG;
+      }
+    }
 
     const sizeHeader = new ArrayBuffer(4);
     const dataView = new DataView(sizeHeader);
-    dataView.setUint32(0, packetBinary.byteLength);
+    dataView.setUint32(0, (compressedFlag | packetBinary.byteLength) >>> 0);
 
-    this.socket.write(new Uint8Array(sizeHeader));
-    this.socket.write(packetBinary);
+    this.socket!.write(new Uint8Array(sizeHeader));
+    this.socket!.write(packetBinary);
   }
 
   private sendExpectingResponse(requestId: string, packet: ClientMessage): Promise<Response> {
     return new Promise((resolve, reject) => {
+      if (!this.socket) {
+        reject(new Error('Not connected to server'));
+        return;
+      }
+
       this.requests.set(requestId, (error, response) => {
         if (error) {
           reject(error);
@@ -9,8 +9,8 @@ declare global {
 
 export type Type = 'obs_source' | 'obs_scene';
 export type Props = { [key: string]: string | number | boolean | Props };
-export type Container = { uid: string, container: true };
-export type Instance = { uid: string, unmanaged?: boolean };
+export type Container = { handle: number, container: true };
+export type Instance = { handle: number, unmanaged?: boolean };
 export type TextInstance = Instance;
 export type HydratableInstance = any;
 export type PublicInstance = Instance;
@@ -77,6 +77,9 @@ interface ItemStyle {
   maxHeight?: string | number;
 
   aspectRatio?: number;
+
+  // Siblings with a higher zIndex are drawn on top, otherwise later ones are
+  zIndex?: number;
 }
 
 export type SceneStyle = ContainerStyle & ItemStyle;
@@ -1,10 +1,26 @@
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <functional>
+#include <netinet/tcp.h>
 
 #include <sockpp/tcp_acceptor.h>
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <sockpp/unix_acceptor.h>
+#endif
 #include "generated/protocol.pb.h"
 
+#include "reactor.hpp"
+#include "worker-pool.hpp"
+#include "compression.hpp"
+#include "frame-reader.hpp"
+#include "outbound-queue.hpp"
+#include "shared-memory-transport.hpp"
+
 enum class ReadPacketResult {
     Success,
     Error,
@@ -14,164 +30,1144 @@ enum class ReadPacketResult {
 class ClientConnection;
 class ApiServer;
 
+// Messages parsed from a single read. They live on an arena which is reset
+// once a worker has handled all of them and no handler has kept any (see
+// `ClientConnection::retain_handled_batch`), and the arena's first block is
+// reused, so steady-state parsing does not touch the heap.
+struct MessageBatch {
+    static constexpr size_t initial_block_size = 64 * 1024;
+
+    std::vector<char> initial_block;
+    google::protobuf::Arena arena;
+    std::vector<protocol::ClientMessage*> messages;
+
+    // Held by the worker handling the batch, and by every handler keeping it
+    std::atomic<uint32_t> references { 0 };
+
+    MessageBatch() : initial_block(initial_block_size), arena(arena_options(initial_block)) {}
+
+    void reset() {
+        messages.clear();
+        arena.Reset();
+    }
+
+private:
+    static google::protobuf::ArenaOptions arena_options(std::vector<char> &block) {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = block.data();
+        options.initial_block_size = block.size();
+
+        return options;
+    }
+};
+
 typedef std::function<void(ClientConnection&, const protocol::ClientMessage&)> MessageReceivedHandler;
+typedef std::function<void(ClientConnection&)> ConnectionClosedHandler;
 
-class ClientConnection {
-    sockpp::tcp_socket socket;
-    MessageReceivedHandler message_handler;
-    bool should_keep_running = true;
+struct ApiServerSettings {
+    bool tcp_enabled;
+    uint16_t tcp_port;
+
+    bool unix_socket_enabled;
+    std::string unix_socket_path;
+
+    // Larger frames are treated as a protocol error and close the connection
+    size_t max_frame_size;
+
+    // Events queued for a client that does not keep up, before `outbound_overflow_policy` applies
+    size_t outbound_queue_capacity;
+    OverflowPolicy outbound_overflow_policy;
+
+    // Whether clients may ask for compression, and the smallest frame worth compressing
+    bool compression_enabled;
+    size_t compression_threshold;
+    bool use_compression_dictionary;
+};
+
+enum class SharedMemoryState {
+    None,
+
+    // Created, but the client has not received the file descriptors yet
+    Offered,
+
+    // The file descriptors are queued with an outbound message
+    Sending,
+
+    // Both sides use the rings instead of the socket
+    Active
+};
+
+enum class CompressionState {
+    None,
+
+    // Incoming frames may be compressed, outgoing ones once the client has
+    // received the response
+    Offered,
+
+    Active
+};
+
+enum class FlushResult {
+    // Everything queued has been written
+    Done,
+
+    // The socket is full, retry once it becomes writable
+    WaitWritable,
+
+    // The shared memory ring is full, retry shortly
+    Retry,
+
+    Error
+};
+
+typedef std::function<void(const std::shared_ptr<ClientConnection>&)> ScheduleWriteHandler;
+
+class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
+    static constexpr size_t read_buffer_size = 64 * 1024;
+
+    size_t id;
+    sockpp::stream_socket socket;
+    std::function<void()> wake_reactor;
+    ScheduleWriteHandler schedule_write;
+    std::atomic<bool> should_keep_running { true };
+
+    // Owned by the message handler, which only uses it on the connection's worker
+    void* context = nullptr;
+
+    size_t max_frame_size;
+    FrameReader input;
+
+    // Filled by any thread, drained by the server's writer thread
+    OutboundQueue outbound;
+    std::atomic<bool> write_scheduled { false };
+
+    // Only accessed on the writer thread
+    OutboundMessage in_flight {};
+    bool has_in_flight = false;
+    size_t in_flight_offset = 0;
+
+    // Batches are parsed on the reactor thread and released by the worker, or
+    // by whoever a handler has passed its messages on to
+    std::mutex batches_mutex;
+    std::vector<std::unique_ptr<MessageBatch>> batches;
+    std::vector<MessageBatch*> free_batches;
+
+    // Only accessed on the connection's worker
+    MessageBatch* handled_batch = nullptr;
+
+    std::atomic<SharedMemoryState> shared_memory_state { SharedMemoryState::None };
+
+    bool compression_enabled;
+    size_t compression_threshold;
+    bool use_compression_dictionary;
+    std::atomic<CompressionState> compression_state { CompressionState::None };
+
+    // Compressing happens on any thread sending, decompressing on the reactor thread
+    std::mutex compressor_mutex;
+    std::unique_ptr<FrameCompressor> compressor;
+    std::vector<unsigned char> compressed_frame;
+    std::unique_ptr<FrameDecompressor> decompressor;
+
+#ifdef REACT_OBS_SHARED_MEMORY
+    std::unique_ptr<SharedMemoryChannel> shared_memory;
+    std::vector<unsigned char> shared_memory_scratch;
+#endif
 
 public:
     ClientConnection(
-        sockpp::tcp_socket _socket,
-        const MessageReceivedHandler& _message_handler
+        size_t _id,
+        sockpp::stream_socket _socket,
+        const ApiServerSettings &settings,
+        const std::function<void()>& _wake_reactor,
+        const ScheduleWriteHandler& _schedule_write
     )
-        : socket(std::move(_socket)), message_handler(_message_handler) {}
+        : id(_id),
+          socket(std::move(_socket)),
+          wake_reactor(_wake_reactor),
+          schedule_write(_schedule_write),
+          max_frame_size(settings.max_frame_size),
+          input(read_buffer_size, settings.max_frame_size),
+          outbound(settings.outbound_queue_capacity, settings.outbound_overflow_policy),
+          compression_enabled(settings.compression_enabled),
+          compression_threshold(settings.compression_threshold),
+          use_compression_dictionary(settings.use_compression_dictionary) {}
+
+    size_t get_id() const {
+        return id;
+    }
+
+    int handle() const {
+        return socket.handle();
+    }
+
+    bool is_running() const {
+        return should_keep_running;
+    }
 
+    void* get_context() const {
+        return context;
+    }
+
+    void set_context(void* _context) {
+        context = _context;
+    }
+
+    // Queues a response. Responses are never dropped, whatever the overflow
+    // policy. Can be called from any thread and never blocks on the client.
     void send(const protocol::ServerMessage &message) {
-        auto size = message.ByteSizeLong();
-        std::vector<unsigned char> buffer(size);
-        buffer.reserve(size);
+        enqueue(message, 0, false);
+    }
 
-        message.SerializeToArray(&buffer[0], size);
+    // Queues a message the client can afford to miss. Once the queue is full,
+    // the overflow policy decides what happens, and under `Coalesce` a newer
+    // event replaces a queued one with the same non-zero `key`.
+    void send_event(const protocol::ServerMessage &message, uint64_t key = 0) {
+        enqueue(message, key, true);
+    }
 
-        uint32_t packet_size = htonl(size);
-        socket.write_n(&packet_size, sizeof(uint32_t));
+    OutboundQueueStats outbound_stats() {
+        return outbound.stats();
+    }
 
-        auto written_size = socket.write_n(&buffer[0], size);
+    // Called by the writer thread before `flush`, so that messages queued
+    // while it is flushing schedule another write
+    void clear_write_scheduled() {
+        write_scheduled.store(false);
+    }
 
-        if (written_size < size) {
-            blog(LOG_ERROR, "[react-obs] Written size of message to socket is less than message size");
-            return;
+    // Writes queued messages until the queue is empty or the transport is
+    // full. Only called from the writer thread.
+    FlushResult flush() {
+        while (should_keep_running) {
+            if (!has_in_flight) {
+                if (!outbound.pop(in_flight)) {
+                    return FlushResult::Done;
+                }
+
+                has_in_flight = true;
+                in_flight_offset = 0;
+            }
+
+            auto result = write_in_flight();
+
+            if (result != FlushResult::Done) {
+                return result;
+            }
+
+            has_in_flight = false;
+            outbound.return_spare_frame(std::move(in_flight.frame));
         }
+
+        return FlushResult::Error;
     }
 
-    // TODO: Disconnect this whenever the server stops
-    void run() {
-        std::vector<unsigned char> buffer;
-        protocol::ClientMessage message;
+    MessageBatch* acquire_batch() {
+        std::lock_guard<std::mutex> lock(batches_mutex);
+        MessageBatch* batch;
 
-        while (should_keep_running) {
-            auto result = read_packet(message, socket, buffer);
+        if (free_batches.empty()) {
+            batches.push_back(std::make_unique<MessageBatch>());
+            batch = batches.back().get();
+        } else {
+            batch = free_batches.back();
+            free_batches.pop_back();
+        }
+
+        batch->references.store(1, std::memory_order_relaxed);
+
+        return batch;
+    }
 
-            if (result != ReadPacketResult::Success) {
+    // Can be called from any thread, the batch is reused once the last
+    // reference to it is released
+    void release_batch(MessageBatch* batch) {
+        if (batch->references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+
+        batch->reset();
+
+        std::lock_guard<std::mutex> lock(batches_mutex);
+        free_batches.push_back(batch);
+    }
+
+    // Called on the connection's worker with every batch read
+    void handle_batch(MessageBatch* batch, const MessageReceivedHandler &handler) {
+        handled_batch = batch;
+
+        for (auto message : batch->messages) {
+            if (!is_running()) {
                 break;
             }
 
-            message_handler(*this, message);
+            handler(*this, *message);
         }
 
-        blog(LOG_INFO, "[react-obs] Stopped client handler");
+        handled_batch = nullptr;
+        release_batch(batch);
     }
 
+    // Keeps the message being handled valid after the handler returns, until
+    // the returned batch is released with `release_batch`. Only called by the
+    // message handler.
+    MessageBatch* retain_handled_batch() {
+        handled_batch->references.fetch_add(1, std::memory_order_relaxed);
+        return handled_batch;
+    }
+
+    // Can be called from any thread, the reactor closes the socket afterwards
     void disconnect() {
-        should_keep_running = false;
+        if (should_keep_running.exchange(false)) {
+            wake_reactor();
+        }
     }
 
-private:
-    ReadPacketResult read_packet(protocol::ClientMessage &message, sockpp::tcp_socket &socket, std::vector<unsigned char> &buffer) {
-        uint32_t packet_size;
-        size_t read_bytes = socket.read_n(&packet_size, sizeof(uint32_t));
+    // Sets up the shared memory transport. It is handed over to the client
+    // with the next message sent, which must be the response to its init
+    // request. Returns the ring size, or 0 if shared memory is not available.
+    uint32_t enable_shared_memory(uint32_t requested_ring_size) {
+#ifdef REACT_OBS_SHARED_MEMORY
+        if (shared_memory_state.load() != SharedMemoryState::None) {
+            return 0;
+        }
+
+        sockaddr_storage address;
+        socklen_t address_size = sizeof(address);
+
+        if (getsockname(socket.handle(), (sockaddr*)&address, &address_size) != 0 || address.ss_family != AF_UNIX) {
+            blog(LOG_INFO, "[react-obs] Shared memory transport is only available over Unix sockets");
+            return 0;
+        }
+
+        shared_memory = SharedMemoryChannel::create(requested_ring_size);
+
+        if (!shared_memory) {
+            return 0;
+        }
+
+        shared_memory_state.store(SharedMemoryState::Offered, std::memory_order_release);
+
+        return shared_memory->get_ring_size();
+#else
+        UNUSED_PARAMETER(requested_ring_size);
+
+        return 0;
+#endif
+    }
+
+    // Sets up compression of large frames in both directions. Like the shared
+    // memory transport, it applies to outgoing frames after the next message
+    // sent, which must be the response to the init request. Returns the
+    // algorithm used, if any.
+    protocol::Compression enable_compression(protocol::Compression requested) {
+        if (requested != protocol::COMPRESSION_DEFLATE || !compression_enabled) {
+            return protocol::COMPRESSION_NONE;
+        }
 
-        packet_size = ntohl(packet_size);
+        // Ring frames are written without their length header, so the flag
+        // marking compressed frames would be lost
+        if (shared_memory_state.load() != SharedMemoryState::None) {
+            blog(LOG_INFO, "[react-obs] Compression is not used with the shared memory transport");
+            return protocol::COMPRESSION_NONE;
+        }
 
-        if (read_bytes <= 0) {
-            return ReadPacketResult::Disconnected;
+        if (compression_state.load() != CompressionState::None) {
+            return protocol::COMPRESSION_NONE;
         }
 
-        buffer.reserve(packet_size);
+        compressor = std::make_unique<FrameCompressor>(use_compression_dictionary);
+        decompressor = std::make_unique<FrameDecompressor>(use_compression_dictionary);
+
+        compression_state.store(CompressionState::Offered, std::memory_order_release);
+
+        return protocol::COMPRESSION_DEFLATE;
+    }
+
+    size_t get_compression_threshold() const {
+        return compression_threshold;
+    }
+
+    bool uses_compression_dictionary() const {
+        return use_compression_dictionary;
+    }
+
+    // The fd the reactor should watch for shared memory messages, or -1
+    int shared_memory_fd() const {
+#ifdef REACT_OBS_SHARED_MEMORY
+        if (shared_memory_state.load(std::memory_order_acquire) == SharedMemoryState::Active) {
+            return shared_memory->inbound_fd();
+        }
+#endif
+
+        return -1;
+    }
+
+    // Parses every message the client has written to the shared memory ring
+    ReadPacketResult read_shared_memory_packets(MessageBatch &batch) {
+#ifdef REACT_OBS_SHARED_MEMORY
+        auto &ring = shared_memory->inbound;
 
-        size_t read_size = 0;
+        ring.clear_event();
 
-        while (read_size < packet_size) {
-            size_t read_now_size = socket.read_n(&buffer[0] + read_size, packet_size - read_size);
-            read_size += read_now_size;
+        do {
+            auto success = ring.read_frames(shared_memory_scratch, max_frame_size, [&batch](const unsigned char* data, uint32_t size) {
+                return parse_message(batch, data, size);
+            });
 
-            if (read_now_size <= 0) {
-                blog(LOG_DEBUG, "[react-obs] Client disconnected mid-packet");
+            if (!success) {
+                return ReadPacketResult::Error;
+            }
+        } while (!ring.prepare_wait());
+#else
+        UNUSED_PARAMETER(batch);
+#endif
+
+        return ReadPacketResult::Success;
+    }
+
+    // Stops both directions without releasing the fd, so that it cannot be
+    // reused while a worker still holds on to this connection
+    void shutdown() {
+        should_keep_running = false;
+        socket.shutdown(SHUT_RDWR);
+    }
+
+    // Reads what is currently available on the (non-blocking) socket in as few
+    // reads as possible and appends each complete packet to `batch`
+    ReadPacketResult read_packets(MessageBatch &batch) {
+        while (true) {
+            auto target = input.prepare_read();
+            auto capacity = input.read_capacity();
+            auto read_size = socket.read(target, capacity);
+
+            if (read_size == 0) {
                 return ReadPacketResult::Disconnected;
             }
+
+            if (read_size < 0) {
+                auto error = socket.last_error();
+
+                if (error == EINTR) {
+                    continue;
+                }
+
+                if (error == EAGAIN || error == EWOULDBLOCK) {
+                    return ReadPacketResult::Success;
+                }
+
+                blog(LOG_DEBUG, "[react-obs] Error reading from client: %s", socket.last_error_str().c_str());
+                return ReadPacketResult::Disconnected;
+            }
+
+            input.commit_read(read_size);
+
+            auto success = input.parse_frames([this, &batch](const unsigned char* data, size_t size, bool compressed) {
+                return parse_frame(batch, data, size, compressed);
+            });
+
+            if (!success) {
+                return ReadPacketResult::Error;
+            }
+
+            // A short read means the socket is drained, the reactor will tell
+            // us when there is more
+            if ((size_t)read_size < capacity) {
+                return ReadPacketResult::Success;
+            }
         }
+    }
 
-        if (!message.ParseFromArray(&buffer[0], packet_size)) {
+private:
+    bool parse_frame(MessageBatch &batch, const unsigned char* data, size_t size, bool compressed) {
+        if (compressed) {
+            if (compression_state.load(std::memory_order_acquire) == CompressionState::None) {
+                blog(LOG_ERROR, "[react-obs] Received a compressed frame without negotiating compression");
+                return false;
+            }
+
+            if (!decompressor->decompress(data, size, max_frame_size, data, size)) {
+                return false;
+            }
+        }
+
+        return parse_message(batch, data, size);
+    }
+
+    static bool parse_message(MessageBatch &batch, const unsigned char* data, size_t size) {
+        auto message = google::protobuf::Arena::CreateMessage<protocol::ClientMessage>(&batch.arena);
+
+        if (!message->ParseFromArray(data, size)) {
             blog(LOG_ERROR, "[react-obs] Could not parse protobuf message");
-            return ReadPacketResult::Error;
+            return false;
         }
 
-        return ReadPacketResult::Success;
+        batch.messages.push_back(message);
+
+        return true;
+    }
+
+    void enqueue(const protocol::ServerMessage &message, uint64_t key, bool is_event) {
+        if (!should_keep_running) {
+            return;
+        }
+
+        auto size = message.ByteSizeLong();
+        auto frame = outbound.take_spare_frame();
+        frame.resize(sizeof(uint32_t) + size);
+
+        uint32_t packet_size = htonl(size);
+        memcpy(&frame[0], &packet_size, sizeof(uint32_t));
+        message.SerializeWithCachedSizesToArray(&frame[sizeof(uint32_t)]);
+
+        auto compression = compression_state.load(std::memory_order_acquire);
+
+        if (compression == CompressionState::Active && size >= compression_threshold) {
+            compress_frame(frame, size);
+        } else if (compression == CompressionState::Offered && !is_event) {
+            compression_state.compare_exchange_strong(compression, CompressionState::Active);
+        }
+
+        // The file descriptors travel with the first response after
+        // `enable_shared_memory`, everything after it goes through the rings
+        auto offered = SharedMemoryState::Offered;
+        auto attach_shared_memory_fds = !is_event && shared_memory_state.compare_exchange_strong(offered, SharedMemoryState::Sending);
+
+        auto result = outbound.push(OutboundMessage {
+            .frame = std::move(frame),
+            .key = key,
+            .is_event = is_event,
+            .attach_shared_memory_fds = attach_shared_memory_fds
+        });
+
+        if (result == OutboundQueue::PushResult::Overflow) {
+            blog(LOG_WARNING, "[react-obs] Outbound queue of client %zu is full, disconnecting", id);
+            disconnect();
+            return;
+        }
+
+        if (!write_scheduled.exchange(true)) {
+            schedule_write(shared_from_this());
+        }
+    }
+
+    // Replaces `frame` with its compressed version, unless that is not smaller
+    void compress_frame(std::vector<unsigned char> &frame, size_t size) {
+        std::lock_guard<std::mutex> lock(compressor_mutex);
+
+        if (compressor->compress(&frame[sizeof(uint32_t)], size, compressed_frame)) {
+            frame.swap(compressed_frame);
+        }
+    }
+
+    FlushResult write_in_flight() {
+        auto &frame = in_flight.frame;
+
+#ifdef REACT_OBS_SHARED_MEMORY
+        if (shared_memory_state.load(std::memory_order_acquire) == SharedMemoryState::Active) {
+            auto &ring = shared_memory->outbound;
+            auto packet_size = frame.size() - sizeof(uint32_t);
+
+            if (packet_size > ring.max_packet_size()) {
+                blog(LOG_ERROR, "[react-obs] Message of %zu bytes does not fit in the shared memory ring", packet_size);
+                return FlushResult::Error;
+            }
+
+            // The client is behind, the writer gives it a moment to catch up
+            if (!ring.write_frame(&frame[sizeof(uint32_t)], packet_size)) {
+                return FlushResult::Retry;
+            }
+
+            return FlushResult::Done;
+        }
+
+        if (in_flight.attach_shared_memory_fds && in_flight_offset == 0) {
+            auto result = write_shared_memory_fds();
+
+            if (result != FlushResult::Done) {
+                return result;
+            }
+        }
+#endif
+
+        while (in_flight_offset < frame.size()) {
+            auto written_size = socket.write(&frame[in_flight_offset], frame.size() - in_flight_offset);
+
+            if (written_size < 0) {
+                auto error = socket.last_error();
+
+                if (error == EINTR) {
+                    continue;
+                }
+
+                if (error == EAGAIN || error == EWOULDBLOCK) {
+                    return FlushResult::WaitWritable;
+                }
+
+                blog(LOG_DEBUG, "[react-obs] Error writing to client: %s", socket.last_error_str().c_str());
+                return FlushResult::Error;
+            }
+
+            in_flight_offset += written_size;
+        }
+
+        if (in_flight.attach_shared_memory_fds) {
+            shared_memory_state.store(SharedMemoryState::Active, std::memory_order_release);
+            wake_reactor();
+        }
+
+        return FlushResult::Done;
+    }
+
+#ifdef REACT_OBS_SHARED_MEMORY
+    // Writes the start of the in-flight frame with the descriptors attached
+    // to its first byte, the rest of the frame goes out as usual
+    FlushResult write_shared_memory_fds() {
+        auto &frame = in_flight.frame;
+        auto fds = shared_memory->client_fds();
+
+        iovec io_vector { frame.data(), frame.size() };
+        char control[CMSG_SPACE(sizeof(fds))] = {};
+
+        msghdr header {};
+        header.msg_iov = &io_vector;
+        header.msg_iovlen = 1;
+        header.msg_control = control;
+        header.msg_controllen = sizeof(control);
+
+        auto control_header = CMSG_FIRSTHDR(&header);
+        control_header->cmsg_level = SOL_SOCKET;
+        control_header->cmsg_type = SCM_RIGHTS;
+        control_header->cmsg_len = CMSG_LEN(sizeof(fds));
+        memcpy(CMSG_DATA(control_header), fds.data(), sizeof(fds));
+
+        while (true) {
+            auto written_size = sendmsg(socket.handle(), &header, MSG_NOSIGNAL);
+
+            if (written_size >= 0) {
+                in_flight_offset = written_size;
+                return FlushResult::Done;
+            }
+
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return FlushResult::WaitWritable;
+            }
+
+            blog(LOG_ERROR, "[react-obs] Could not send shared memory file descriptors");
+            return FlushResult::Error;
+        }
+    }
+#endif
+};
+
+// Drains the outbound queues of all clients on a single thread, so that a
+// slow client never holds up the reactor or the workers. Clients whose socket
+// is full are parked until it becomes writable, clients whose shared memory
+// ring is full are retried every millisecond.
+class OutboundWriter {
+    static constexpr int retry_interval_ms = 1;
+
+    Reactor reactor;
+    std::thread writer_thread;
+    std::atomic<bool> should_keep_running { false };
+
+    std::mutex scheduled_mutex;
+    std::vector<std::shared_ptr<ClientConnection>> scheduled;
+
+    // Only accessed on the writer thread
+    std::unordered_map<int, std::shared_ptr<ClientConnection>> waiting_writable;
+    std::vector<std::shared_ptr<ClientConnection>> retrying;
+
+public:
+    bool start() {
+        if (!reactor.open()) {
+            return false;
+        }
+
+        should_keep_running = true;
+
+        std::thread thread(&OutboundWriter::run, this);
+
+        writer_thread.swap(thread);
+
+        return true;
+    }
+
+    void stop() {
+        if (!writer_thread.joinable()) {
+            return;
+        }
+
+        should_keep_running = false;
+        reactor.wake();
+        writer_thread.join();
+
+        scheduled.clear();
+        waiting_writable.clear();
+        retrying.clear();
+        reactor.close();
+    }
+
+    // Can be called from any thread
+    void schedule(const std::shared_ptr<ClientConnection> &client) {
+        {
+            std::lock_guard<std::mutex> lock(scheduled_mutex);
+            scheduled.push_back(client);
+        }
+
+        reactor.wake();
+    }
+
+private:
+    void run() {
+        std::vector<ReactorEvent> events;
+        std::vector<std::shared_ptr<ClientConnection>> ready;
+
+        while (should_keep_running) {
+            if (!reactor.wait(events, retrying.empty() ? -1 : retry_interval_ms)) {
+                blog(LOG_ERROR, "[react-obs] Waiting for writable sockets failed");
+                break;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(scheduled_mutex);
+                ready.swap(scheduled);
+            }
+
+            ready.insert(ready.end(), retrying.begin(), retrying.end());
+            retrying.clear();
+
+            for (auto &event : events) {
+                auto client_find = waiting_writable.find(event.fd);
+                if (client_find == waiting_writable.end()) {
+                    continue;
+                }
+
+                ready.push_back(client_find->second);
+
+                reactor.remove(event.fd);
+                waiting_writable.erase(client_find);
+            }
+
+            for (auto &client : ready) {
+                flush(client);
+            }
+
+            ready.clear();
+
+            for (auto it = waiting_writable.begin(); it != waiting_writable.end();) {
+                if (it->second->is_running()) {
+                    ++it;
+                    continue;
+                }
+
+                reactor.remove(it->first);
+                it = waiting_writable.erase(it);
+            }
+        }
+    }
+
+    void flush(const std::shared_ptr<ClientConnection> &client) {
+        // Still waiting for room in the socket, the event will flush it
+        if (!client->is_running() || waiting_writable.count(client->handle())) {
+            return;
+        }
+
+        client->clear_write_scheduled();
+
+        switch (client->flush()) {
+            case FlushResult::Done:
+                break;
+
+            case FlushResult::WaitWritable:
+                if (reactor.add(client->handle(), true)) {
+                    waiting_writable[client->handle()] = client;
+                } else {
+                    client->disconnect();
+                }
+                break;
+
+            case FlushResult::Retry:
+                retrying.push_back(client);
+                break;
+
+            case FlushResult::Error:
+                client->disconnect();
+                break;
+        }
     }
 };
 
+// Accepts connections and reads from all of them on a single reactor thread.
+// Complete messages are handled on a small pool of worker threads, with all
+// messages of a given connection (and the notification that it closed)
+// running on the same worker. Outgoing messages are queued per connection and
+// written by a separate writer thread.
+//
+// The same framing and handler are used for every transport (TCP and, where
+// available, Unix domain sockets).
 class ApiServer {
-    int16_t port;
+    struct Listener {
+        std::string name;
+        std::unique_ptr<sockpp::acceptor> acceptor;
+        bool is_tcp;
+    };
+
+    ApiServerSettings settings;
     std::thread server_thread;
-    sockpp::tcp_acceptor server_acceptor;
+    std::vector<Listener> listeners;
 
     MessageReceivedHandler message_handler;
+    ConnectionClosedHandler closed_handler;
+
+    Reactor reactor;
+    WorkerPool workers;
+    OutboundWriter writer;
+    std::atomic<bool> should_keep_running { false };
+
+    // Only accessed on the reactor thread while it is running
+    size_t next_client_id = 0;
+    std::unordered_map<int, std::shared_ptr<ClientConnection>> clients;
 
 public:
-    ApiServer(int16_t _port, const MessageReceivedHandler& _message_handler)
-        : port(_port), message_handler(_message_handler) {}
+    ApiServer(
+        const MessageReceivedHandler& _message_handler,
+        const ConnectionClosedHandler& _closed_handler = nullptr,
+        size_t worker_count = 2
+    )
+        : message_handler(_message_handler), closed_handler(_closed_handler), workers(worker_count) {}
+
+    void start(const ApiServerSettings &_settings) {
+        settings = _settings;
+
+        if (!reactor.open()) {
+            return;
+        }
+
+        if (!writer.start()) {
+            reactor.close();
+            return;
+        }
+
+        should_keep_running = true;
+        workers.start();
 
-    void start() {
         std::thread thread(&ApiServer::run, this);
 
         server_thread.swap(thread);
     }
 
     void stop() {
-        server_acceptor.close();
+        if (!server_thread.joinable()) {
+            return;
+        }
+
+        should_keep_running = false;
+        reactor.wake();
         server_thread.join();
+
+        // No new messages can arrive now, so wait for the in-flight ones
+        // before tearing the connections down
+        for (auto &client : clients) {
+            client.second->shutdown();
+        }
+
+        workers.stop();
+
+        // The reactor is gone, so the handler is called for every client
+        // left here, after all of its messages
+        if (closed_handler) {
+            for (auto &client : clients) {
+                closed_handler(*client.second);
+            }
+        }
+
+        writer.stop();
+        clients.clear();
+        reactor.close();
     }
 
 private:
     void run() {
-        server_acceptor = sockpp::tcp_acceptor(port);
+        if (settings.tcp_enabled) {
+            listen_tcp();
+        }
+
+        if (settings.unix_socket_enabled) {
+            listen_unix();
+        }
+
+        if (listeners.empty()) {
+            blog(LOG_ERROR, "[react-obs] No transports are enabled, not accepting connections");
+        }
+
+        std::vector<ReactorEvent> events;
+
+        while (should_keep_running) {
+            if (!reactor.wait(events)) {
+                blog(LOG_ERROR, "[react-obs] Waiting for socket events failed");
+                break;
+            }
+
+            for (auto &event : events) {
+                auto listener = find_listener(event.fd);
+
+                if (listener) {
+                    accept_clients(*listener);
+                    continue;
+                }
+
+                auto client_find = clients.find(event.fd);
+                if (client_find == clients.end()) {
+                    continue;
+                }
+
+                auto client = client_find->second;
+                auto batch = client->acquire_batch();
+                auto result = ReadPacketResult::Success;
+
+                if (event.fd != client->handle()) {
+                    result = client->read_shared_memory_packets(*batch);
+                } else if (event.readable) {
+                    result = client->read_packets(*batch);
+                } else if (event.closed) {
+                    result = ReadPacketResult::Disconnected;
+                }
+
+                if (batch->messages.empty()) {
+                    client->release_batch(batch);
+                } else {
+                    dispatch(client, batch);
+                }
+
+                if (result != ReadPacketResult::Success) {
+                    client->disconnect();
+                }
+            }
+
+            refresh_clients();
+        }
+
+        bool listened_on_unix_socket = false;
+
+        for (auto &listener : listeners) {
+            reactor.remove(listener.acceptor->handle());
+            listener.acceptor->close();
+
+            listened_on_unix_socket |= !listener.is_tcp;
+        }
+
+        listeners.clear();
 
-        if (!server_acceptor) {
+#ifndef _WIN32
+        if (listened_on_unix_socket) {
+            remove_socket_file(settings.unix_socket_path);
+        }
+#else
+        UNUSED_PARAMETER(listened_on_unix_socket);
+#endif
+
+        blog(LOG_INFO, "[react-obs] Stopped listening for connections");
+    }
+
+    void listen_tcp() {
+        auto acceptor = std::make_unique<sockpp::tcp_acceptor>(settings.tcp_port);
+
+        if (!*acceptor) {
             blog(LOG_ERROR, "[react-obs] Cannot create TCP acceptor");
             return;
         }
 
-        blog(LOG_INFO, "[react-obs] Created TCP acceptor, listening on %i", port);
+        blog(LOG_INFO, "[react-obs] Created TCP acceptor, listening on %i", settings.tcp_port);
 
-        while (true) {
-            sockpp::inet_address peer;
+        add_listener("TCP", std::move(acceptor), true);
+    }
+
+    void listen_unix() {
+#ifndef _WIN32
+        auto &path = settings.unix_socket_path;
+
+        // A previous instance which did not shut down cleanly leaves the
+        // socket file behind, and binding to an existing path fails
+        if (!remove_socket_file(path)) {
+            return;
+        }
+
+        auto acceptor = std::make_unique<sockpp::unix_acceptor>(sockpp::unix_address(path));
+
+        if (!*acceptor) {
+            blog(LOG_ERROR, "[react-obs] Cannot create Unix socket acceptor at %s", path.c_str());
+            return;
+        }
+
+        blog(LOG_INFO, "[react-obs] Created Unix socket acceptor, listening on %s", path.c_str());
+
+        add_listener("Unix socket", std::move(acceptor), false);
+#else
+        blog(LOG_ERROR, "[react-obs] Unix sockets are not supported on this platform");
+#endif
+    }
+
+#ifndef _WIN32
+    // Removes the socket file at `path`, if there is one. Anything else there
+    // is left alone, it is more likely a mistyped setting than ours.
+    static bool remove_socket_file(const std::string &path) {
+        struct stat status;
+
+        if (lstat(path.c_str(), &status) != 0) {
+            return errno == ENOENT;
+        }
+
+        if (!S_ISSOCK(status.st_mode)) {
+            blog(LOG_ERROR, "[react-obs] %s exists and is not a socket, not listening on it", path.c_str());
+            return false;
+        }
+
+        return unlink(path.c_str()) == 0;
+    }
+#endif
+
+    void add_listener(const char* name, std::unique_ptr<sockpp::acceptor> acceptor, bool is_tcp) {
+        acceptor->set_non_blocking();
+
+        if (!reactor.add(acceptor->handle())) {
+            return;
+        }
+
+        listeners.push_back(Listener {
+            .name = name,
+            .acceptor = std::move(acceptor),
+            .is_tcp = is_tcp
+        });
+    }
 
+    Listener* find_listener(int fd) {
+        for (auto &listener : listeners) {
+            if (listener.acceptor->handle() == fd) {
+                return &listener;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void accept_clients(Listener &listener) {
+        while (true) {
             // Accept a new client connection
-            sockpp::tcp_socket socket = server_acceptor.accept(&peer);
+            sockpp::stream_socket socket = listener.acceptor->accept();
 
             if (!socket) {
-                if (!server_acceptor.is_open()) {
-                    // Server stopped, probably due to `server_acceptor.close()`
-                    break;
+                auto error = listener.acceptor->last_error();
+
+                if (error != EAGAIN && error != EWOULDBLOCK) {
+                    blog(
+                        LOG_DEBUG,
+                        "[react-obs] Error accepting incoming connection: %s\n",
+                        listener.acceptor->last_error_str().c_str()
+                    );
                 }
 
-                blog(
-                    LOG_DEBUG,
-                    "[react-obs] Error accepting incoming connection: %s\n",
-                    server_acceptor.last_error_str().c_str()
-                );
-                continue;
+                return;
             }
 
             blog(
                 LOG_DEBUG,
-                "[react-obs] Received a connection request from %s\n",
-                peer.to_string().c_str()
+                "[react-obs] Received a connection request over %s\n",
+                listener.name.c_str()
             );
 
-            // Create a thread and transfer the new stream to it.
-            std::thread client_thread(&ApiServer::client_thread_runner, this, std::move(socket));
-            client_thread.detach();
+            socket.set_non_blocking();
+
+            if (listener.is_tcp) {
+                // Responses are written in one piece, there is nothing to
+                // gain from waiting for more data
+                int no_delay = 1;
+                socket.set_option(IPPROTO_TCP, TCP_NODELAY, no_delay);
+            }
+
+            auto fd = socket.handle();
+            auto client = std::make_shared<ClientConnection>(
+                next_client_id++,
+                std::move(socket),
+                settings,
+                [this]() { reactor.wake(); },
+                [this](const std::shared_ptr<ClientConnection> &client) { writer.schedule(client); }
+            );
+
+            if (!reactor.add(fd)) {
+                continue;
+            }
+
+            clients[fd] = client;
         }
+    }
 
-        blog(LOG_INFO, "[react-obs] Stopped listening for connections");
+    void dispatch(const std::shared_ptr<ClientConnection> &client, MessageBatch* batch) {
+        workers.post(client->get_id(), [this, client, batch]() {
+            client->handle_batch(batch, message_handler);
+        });
     }
 
-    void client_thread_runner(sockpp::tcp_socket socket) {
-        ClientConnection client(std::move(socket), message_handler);
+    // Applies changes requested by the workers since the last wakeup: closes
+    // disconnected clients and starts watching new shared memory channels
+    void refresh_clients() {
+        std::vector<std::shared_ptr<ClientConnection>> upgraded_clients;
+
+        for (auto it = clients.begin(); it != clients.end();) {
+            auto &client = it->second;
+            auto is_socket = it->first == client->handle();
 
-        client.run();
+            if (client->is_running()) {
+                auto shared_memory_fd = client->shared_memory_fd();
+
+                if (is_socket && shared_memory_fd >= 0 && !clients.count(shared_memory_fd)) {
+                    upgraded_clients.push_back(client);
+                }
+
+                ++it;
+                continue;
+            }
+
+            reactor.remove(it->first);
+
+            if (is_socket) {
+                client->shutdown();
+
+                auto stats = client->outbound_stats();
+
+                blog(
+                    LOG_INFO,
+                    "[react-obs] Stopped client handler (outbound queue: max depth %zu, dropped %llu, coalesced %llu)",
+                    stats.max_depth,
+                    (unsigned long long)stats.dropped,
+                    (unsigned long long)stats.coalesced
+                );
+
+                // Runs after the messages already dispatched for this client
+                if (closed_handler) {
+                    workers.post(client->get_id(), [this, client]() {
+                        closed_handler(*client);
+                    });
+                }
+            }
+
+            it = clients.erase(it);
+        }
+
+        for (auto &client : upgraded_clients) {
+            auto fd = client->shared_memory_fd();
+
+            if (!reactor.add(fd)) {
+                client->disconnect();
+                continue;
+            }
+
+            clients[fd] = client;
+
+            blog(LOG_INFO, "[react-obs] Client %zu switched to shared memory transport", client->get_id());
+        }
     }
 };
@@ -0,0 +1,148 @@
+// Measures the sceneitem moves `reconcile_draw_order` plans for reordered
+// lists, against moving every item, on a simulated scene.
+//
+// Usage: react-obs-draw-order-benchmark [item-count]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "draw-order.hpp"
+
+using benchmark_clock = std::chrono::steady_clock;
+
+// Item ids from the bottom of the scene to the top, like the item list of an
+// OBS scene
+typedef std::vector<int> SimulatedScene;
+
+int position_of(const SimulatedScene &scene, int item) {
+    return std::find(scene.begin(), scene.end(), item) - scene.begin();
+}
+
+// Same semantics as `obs_sceneitem_set_order_position`
+void set_order_position(SimulatedScene &scene, int item, int target_position) {
+    scene.erase(scene.begin() + position_of(scene, item));
+    scene.insert(scene.begin() + target_position, item);
+}
+
+// Applies the planned moves like `reconcile_draw_order`, returning how many
+// actually moved an item
+size_t reconcile(SimulatedScene &scene, const std::vector<int> &desired) {
+    std::vector<int> positions(scene.size());
+    std::vector<int> current_positions;
+
+    for (size_t i = 0; i < scene.size(); i++) {
+        positions[scene[i]] = i;
+    }
+
+    for (auto item : desired) {
+        current_positions.push_back(positions[item]);
+    }
+
+    size_t moved = 0;
+
+    for (const auto &move : plan_draw_order(current_positions)) {
+        auto item = desired[move.item];
+        auto position = position_of(scene, item);
+        auto target_position = draw_order_target(position, position_of(scene, desired[move.anchor]), move.above);
+
+        if (position != target_position) {
+            set_order_position(scene, item, target_position);
+            moved++;
+        }
+    }
+
+    return moved;
+}
+
+void run_case(const char* name, int item_count, std::function<void(std::vector<int>&)> reorder) {
+    SimulatedScene scene;
+
+    for (int i = 0; i < item_count; i++) {
+        scene.push_back(i);
+    }
+
+    auto desired = scene;
+    reorder(desired);
+
+    auto result = scene;
+    auto moved = reconcile(result, desired);
+
+    if (result != desired) {
+        printf("%-24s FAILED, draw order does not match\n", name);
+        return;
+    }
+
+    // Planning only, the moves themselves are dominated by OBS
+    static constexpr int iterations = 1000;
+    std::vector<int> positions(item_count);
+
+    for (int i = 0; i < item_count; i++) {
+        positions[i] = position_of(scene, desired[i]);
+    }
+
+    auto start = benchmark_clock::now();
+    size_t planned = 0;
+
+    for (int i = 0; i < iterations; i++) {
+        planned += plan_draw_order(positions).size();
+    }
+
+    auto elapsed_us = std::chrono::duration<double, std::micro>(benchmark_clock::now() - start).count();
+
+    printf("%-24s %6zu moves (every item: %i), planning took %8.1f us\n",
+           name, moved, item_count, elapsed_us / iterations);
+
+    (void)planned;
+}
+
+int main(int argc, char** argv) {
+    int item_count = argc > 1 ? atoi(argv[1]) : 1000;
+
+    if (item_count < 2) {
+        fprintf(stderr, "Usage: %s [item-count]\n", argv[0]);
+        return 1;
+    }
+
+    std::mt19937 random(42);
+
+    printf("%i items\n", item_count);
+
+    run_case("unchanged", item_count, [](std::vector<int>&) {});
+
+    run_case("first to last", item_count, [](std::vector<int> &items) {
+        std::rotate(items.begin(), items.begin() + 1, items.end());
+    });
+
+    run_case("last to first", item_count, [](std::vector<int> &items) {
+        std::rotate(items.begin(), items.end() - 1, items.end());
+    });
+
+    run_case("adjacent swaps", item_count, [](std::vector<int> &items) {
+        for (size_t i = 0; i + 1 < items.size(); i += 10) {
+            std::swap(items[i], items[i + 1]);
+        }
+    });
+
+    run_case("reversed", item_count, [](std::vector<int> &items) {
+        std::reverse(items.begin(), items.end());
+    });
+
+    run_case("shuffled", item_count, [&random](std::vector<int> &items) {
+        std::shuffle(items.begin(), items.end(), random);
+    });
+
+    // Some items raised by a zIndex, like `reconcile_draw_order` sorts them
+    run_case("zIndex on every 100th", item_count, [](std::vector<int> &items) {
+        std::stable_sort(items.begin(), items.end(), [](int a, int b) {
+            return (a % 100 == 0) < (b % 100 == 0);
+        });
+    });
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+// Measures `PropMap::find` on props with inline keys against props with
+// interned keys, after checking that lookups still find the right props when
+// keys are redefined, including a key the client has interned twice.
+//
+// Usage: react-obs-interning-benchmark [lookup-count]
+
+#include <obs-module.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "generated/protocol.pb.h"
+#include "interning.hpp"
+#include "props.hpp"
+
+using benchmark_clock = std::chrono::steady_clock;
+
+// The style props the layout looks up for every source
+static const std::vector<std::string> style_keys = {
+    "position", "top", "left", "width", "height", "flexDirection", "alignItems", "zIndex"
+};
+
+void add_prop(protocol::ObjectValue &object, const std::string &key, double value) {
+    auto prop = object.add_props();
+    prop->set_key(key);
+    prop->set_float_value(value);
+}
+
+void add_prop(protocol::ObjectValue &object, uint32_t key_id, double value) {
+    auto prop = object.add_props();
+    prop->set_key_id(key_id);
+    prop->set_float_value(value);
+}
+
+// Whether `key` resolves to a prop with `value`, or to none if it is not set
+bool finds(const PropMap &props, const char* key, std::optional<double> value) {
+    auto prop = props.find(key);
+
+    if (!prop || !value) {
+        return !prop && !value;
+    }
+
+    return prop->float_value() == *value;
+}
+
+bool check_case(const char* name, bool passed) {
+    printf("%-40s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+bool check_redefinitions() {
+    auto passed = true;
+
+    {
+        InternTable interned;
+        interned.define_key(1, "top");
+        interned.define_key(1, "left");
+
+        protocol::ObjectValue object;
+        add_prop(object, 1, 10);
+
+        auto props = as_prop_map(object.props(), interned);
+        passed &= check_case("redefined key", finds(props, "left", 10) && finds(props, "top", {}));
+    }
+
+    {
+        // "top" under 1 and 2, then 1 is reused. The entry for "top" must not
+        // be left viewing the string of id 1.
+        InternTable interned;
+        interned.define_key(1, "top");
+        interned.define_key(2, "top");
+        interned.define_key(1, "left");
+
+        protocol::ObjectValue object;
+        add_prop(object, 1, 10);
+        add_prop(object, 2, 20);
+
+        auto props = as_prop_map(object.props(), interned);
+        passed &= check_case(
+            "redefined duplicated key",
+            interned.key_id("top") == 2 && interned.key_id("left") == 1 &&
+            finds(props, "left", 10) && finds(props, "top", 20)
+        );
+    }
+
+    {
+        // Props sent with either id of a duplicated key are found
+        InternTable interned;
+        interned.define_key(1, "top");
+        interned.define_key(2, "top");
+
+        protocol::ObjectValue first;
+        add_prop(first, 1, 10);
+
+        protocol::ObjectValue second;
+        add_prop(second, 2, 20);
+
+        passed &= check_case(
+            "duplicated key",
+            finds(as_prop_map(first.props(), interned), "top", 10) &&
+            finds(as_prop_map(second.props(), interned), "top", 20)
+        );
+    }
+
+    {
+        InternTable interned;
+        interned.define_key(1, "top");
+
+        protocol::ObjectValue object;
+        add_prop(object, 1, 10);
+        add_prop(object, "top", 20);
+        add_prop(object, 7, 30);
+
+        auto props = as_prop_map(object.props(), interned);
+        passed &= check_case("inline key after interned key", finds(props, "top", 20));
+    }
+
+    return passed;
+}
+
+void run_case(const char* name, const protocol::ObjectValue &object, const InternTable &interned, int lookup_count) {
+    auto props = as_prop_map(object.props(), interned);
+    size_t found = 0;
+
+    auto start = benchmark_clock::now();
+
+    for (int i = 0; i < lookup_count; i++) {
+        found += props.find(style_keys[i % style_keys.size()]) != nullptr;
+    }
+
+    auto elapsed_ns = std::chrono::duration<double, std::nano>(benchmark_clock::now() - start).count();
+
+    printf("%-40s %6.1f ns per lookup\n", name, elapsed_ns / lookup_count);
+
+    (void)found;
+}
+
+int main(int argc, char** argv) {
+    int lookup_count = argc > 1 ? atoi(argv[1]) : 1000000;
+
+    if (lookup_count <= 0) {
+        fprintf(stderr, "Usage: %s [lookup-count]\n", argv[0]);
+        return 1;
+    }
+
+    if (!check_redefinitions()) {
+        return 1;
+    }
+
+    InternTable interned;
+    protocol::ObjectValue inline_keys;
+    protocol::ObjectValue interned_keys;
+
+    for (size_t i = 0; i < style_keys.size(); i++) {
+        interned.define_key(i + 1, style_keys[i]);
+
+        add_prop(inline_keys, style_keys[i], i);
+        add_prop(interned_keys, i + 1, i);
+    }
+
+    printf("%i lookups of %zu style props\n", lookup_count, style_keys.size());
+
+    run_case("inline keys", inline_keys, interned, lookup_count);
+    run_case("interned keys", interned_keys, interned, lookup_count);
+
+    // Falls back to comparing strings
+    interned.define_key(style_keys.size() + 1, style_keys[0]);
+    run_case("interned keys, one key interned twice", interned_keys, interned, lookup_count);
+
+    return 0;
+}
@@ -0,0 +1,283 @@
+// Runs two controllers sharing a client id against the session handling of
+// the plugin: A starts the session, B takes it over and closes, while A keeps
+// sending updates. Checks that A is disconnected by the takeover and that no
+// update is applied to the session once it has been released, and measures
+// how long the takeover takes to close A.
+//
+// Usage: react-obs-session-benchmark [update-count]
+
+#include <obs-module.h>
+#include <yoga/Yoga.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <sockpp/unix_connector.h>
+
+#define DEBUG_LAYOUT false
+
+#include "api-server.hpp"
+#include "interning.hpp"
+#include "shadow-sources.hpp"
+#include "update-queue.hpp"
+#include "sessions.hpp"
+
+using benchmark_clock = std::chrono::steady_clock;
+
+static const char* benchmark_unix_socket_path = "/tmp/react-obs-session-benchmark.sock";
+static const char* shared_client_id = "shared";
+
+// Defined by layout.hpp in the plugin. No source is created here, so nothing
+// is ever measured.
+YGSize yoga_measure_function(YGNodeRef, float, YGMeasureMode, float, YGMeasureMode) {
+    return YGSize { .width = 0, .height = 0 };
+}
+
+// Same handling as `message_received_from_client`, without the OBS side
+void benchmark_message_received(ClientConnection& client, const protocol::ClientMessage& message) {
+    switch (message.message_case()) {
+        case protocol::ClientMessage::MessageCase::kInitRequest: {
+            bool resumed;
+            attach_session(client, message.init_request().client_id(), resumed);
+
+            protocol::ServerMessage reply;
+            auto response = reply.mutable_response();
+            response->set_request_id(message.init_request().request_id());
+            response->set_success(true);
+            response->set_session_resumed(resumed);
+
+            client.send(reply);
+            break;
+        }
+
+        case protocol::ClientMessage::MessageCase::kApplyUpdate: {
+            auto session = require_session(client);
+
+            if (session) {
+                queue_message(client, session, message);
+            }
+
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void benchmark_connection_closed(ClientConnection& client) {
+    detach_session(client);
+}
+
+// What the video tick saw, only used by the tick thread
+struct TickResults {
+    size_t applied = 0;
+    size_t applied_after_release = 0;
+    size_t released = 0;
+    std::unordered_set<Session*> released_sessions;
+};
+
+// Drains the queue like `drain_update_queue`, without applying anything
+void tick(TickResults &results) {
+    while (auto queued = update_queue.pop()) {
+        if (queued->kind == QueuedUpdate::Kind::ReleaseSession) {
+            results.released_sessions.insert(queued->session);
+            results.released++;
+
+            destroy_session(queued->session);
+        } else if (results.released_sessions.count(queued->session)) {
+            results.applied_after_release++;
+        } else {
+            results.applied++;
+        }
+
+        queued_update_pool.release(queued);
+    }
+}
+
+std::string frame(const protocol::ClientMessage &message) {
+    auto body = message.SerializeAsString();
+    uint32_t packet_size = htonl(body.size());
+
+    return std::string((const char*)&packet_size, sizeof(uint32_t)) + body;
+}
+
+std::string init_frame() {
+    protocol::ClientMessage message;
+    auto init_request = message.mutable_init_request();
+    init_request->set_request_id("init");
+    init_request->set_client_id(shared_client_id);
+
+    return frame(message);
+}
+
+std::string update_frame(int i) {
+    protocol::ClientMessage message;
+    auto update = message.mutable_apply_update()->mutable_update_source();
+    update->set_handle(1);
+
+    auto prop = update->mutable_changed_props()->add_props();
+    prop->set_key("top");
+    prop->set_float_value(i);
+
+    return frame(message);
+}
+
+bool read_message(sockpp::stream_socket &socket, protocol::ServerMessage &message) {
+    uint32_t packet_size;
+
+    if (socket.read_n(&packet_size, sizeof(uint32_t)) != sizeof(uint32_t)) {
+        return false;
+    }
+
+    std::vector<char> buffer(ntohl(packet_size));
+
+    if (socket.read_n(buffer.data(), buffer.size()) != (ssize_t)buffer.size()) {
+        return false;
+    }
+
+    return message.ParseFromArray(buffer.data(), buffer.size());
+}
+
+// Sets `resumed` as the init response does
+bool connect_controller(sockpp::unix_connector &socket, const char* name, bool &resumed) {
+    if (!socket.connect(sockpp::unix_address(benchmark_unix_socket_path))) {
+        fprintf(stderr, "%s cannot connect: %s\n", name, socket.last_error_str().c_str());
+        return false;
+    }
+
+    auto init = init_frame();
+    socket.write_n(init.data(), init.size());
+
+    protocol::ServerMessage response;
+
+    if (!read_message(socket, response)) {
+        fprintf(stderr, "%s got no response to its init request\n", name);
+        return false;
+    }
+
+    resumed = response.response().session_resumed();
+
+    return true;
+}
+
+bool check_case(const char* name, bool passed) {
+    printf("%-40s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+int main(int argc, char** argv) {
+    int update_count = argc > 1 ? atoi(argv[1]) : 10000;
+
+    if (update_count <= 0) {
+        fprintf(stderr, "Usage: %s [update-count]\n", argv[0]);
+        return 1;
+    }
+
+    // A writes until its connection has been closed
+    signal(SIGPIPE, SIG_IGN);
+
+    ApiServer server(benchmark_message_received, benchmark_connection_closed);
+    server.start(ApiServerSettings {
+        .tcp_enabled = false,
+        .tcp_port = 0,
+
+        .unix_socket_enabled = true,
+        .unix_socket_path = benchmark_unix_socket_path,
+
+        .max_frame_size = 16 * 1024 * 1024,
+
+        .outbound_queue_capacity = 256,
+        .outbound_overflow_policy = OverflowPolicy::DropOldest,
+
+        .compression_enabled = false,
+        .compression_threshold = 1024,
+        .use_compression_dictionary = false
+    });
+
+    // Give the reactor thread time to bind its listener
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    TickResults results;
+    std::atomic<bool> ticking = true;
+
+    std::thread ticker([&]() {
+        while (ticking) {
+            tick(results);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+
+    sockpp::unix_connector controller_a;
+    sockpp::unix_connector controller_b;
+
+    bool a_resumed;
+    bool b_resumed;
+
+    if (!connect_controller(controller_a, "A", a_resumed)) {
+        return 1;
+    }
+
+    auto takeover_start = benchmark_clock::now();
+
+    if (!connect_controller(controller_b, "B", b_resumed)) {
+        return 1;
+    }
+
+    for (int i = 0; i < update_count / 2; i++) {
+        auto update = update_frame(i);
+        controller_b.write_n(update.data(), update.size());
+    }
+
+    controller_b.close();
+
+    // A does not know it has been taken over, and sends until the server has
+    // closed its connection
+    int sent_by_a = 0;
+
+    for (int i = 0; i < update_count; i++) {
+        auto update = update_frame(i);
+
+        if (controller_a.write_n(update.data(), update.size()) != (ssize_t)update.size()) {
+            break;
+        }
+
+        sent_by_a++;
+    }
+
+    controller_a.read_timeout(std::chrono::seconds(5));
+
+    char byte;
+    auto result = controller_a.read(&byte, 1);
+    auto a_closed = result == 0 || (result < 0 && controller_a.last_error() != EAGAIN && controller_a.last_error() != EWOULDBLOCK);
+
+    std::chrono::duration<double, std::milli> takeover_time = benchmark_clock::now() - takeover_start;
+
+    controller_a.close();
+
+    // Both connections are detached by now, give the tick time to apply
+    // everything they queued
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    ticking = false;
+    ticker.join();
+
+    server.stop();
+
+    printf("A sent %i updates after B closed, %zu updates applied\n", sent_by_a, results.applied);
+    printf("Takeover closed A after %.1f ms\n", takeover_time.count());
+
+    auto passed = true;
+    passed &= check_case("B continues the session of A", !a_resumed && b_resumed);
+    passed &= check_case("takeover disconnects A", a_closed);
+    passed &= check_case("session released once", results.released == 1);
+    passed &= check_case("no update after release", results.applied_after_release == 0);
+
+    return passed ? 0 : 1;
+}
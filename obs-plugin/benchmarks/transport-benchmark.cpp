@@ -0,0 +1,614 @@
+// Compares per-message latency and throughput of the TCP, Unix socket and
+// shared memory transports, using the stream of `UpdateSource` messages that an animation
+// (e.g. the DVD example) produces. Then runs the animation against a video
+// tick slower than it, with and without pacing it on update credits.
+//
+// Usage: react-obs-transport-benchmark [message-count]
+
+#include <obs-module.h>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+
+#include <sockpp/tcp_connector.h>
+#include <sockpp/unix_connector.h>
+
+#include "api-server.hpp"
+#include "flow-control.hpp"
+
+using benchmark_clock = std::chrono::steady_clock;
+
+static const uint16_t benchmark_tcp_port = 6667;
+static const char* benchmark_unix_socket_path = "/tmp/react-obs-benchmark.sock";
+static const uint32_t benchmark_ring_size = 1024 * 1024;
+
+// The animation renders a frame every 8 ms, the tick only runs at 30 fps
+static const auto animation_frame_interval = std::chrono::milliseconds(8);
+static const auto slow_tick_interval = std::chrono::microseconds(33333);
+static const auto flow_control_duration = std::chrono::seconds(2);
+
+double now_us() {
+    return std::chrono::duration<double, std::micro>(benchmark_clock::now().time_since_epoch()).count();
+}
+
+// Update batches waiting for the simulated video tick
+struct ReceivedFrame {
+    std::shared_ptr<ClientConnection> client;
+    double rendered_at_us;
+};
+
+std::mutex received_frames_mutex;
+std::vector<ReceivedFrame> received_frames;
+
+// Replies to init requests, which the client also uses as a ping, and hands
+// update batches to the simulated video tick. Single updates are dropped.
+void benchmark_message_received(ClientConnection& client, const protocol::ClientMessage& message) {
+    switch (message.message_case()) {
+        case protocol::ClientMessage::MessageCase::kInitRequest: {
+            protocol::ServerMessage reply;
+            auto response = reply.mutable_response();
+            response->set_request_id(message.init_request().request_id());
+            response->set_success(true);
+
+            if (message.init_request().shared_memory_ring_size() > 0) {
+                auto ring_size = client.enable_shared_memory(message.init_request().shared_memory_ring_size());
+
+                if (ring_size > 0) {
+                    response->mutable_shared_memory()->set_ring_size(ring_size);
+                }
+            }
+
+            if (message.init_request().flow_control()) {
+                response->set_update_credits(update_credits.add_client(client));
+            }
+
+            client.send(reply);
+            break;
+        }
+
+        case protocol::ClientMessage::MessageCase::kUpdateBatch: {
+            // See `batch_frame`
+            auto rendered_at_us = message.update_batch().updates(0).update_source().changed_props().props(0).float_value();
+
+            std::lock_guard<std::mutex> lock(received_frames_mutex);
+            received_frames.push_back(ReceivedFrame {
+                .client = client.shared_from_this(),
+                .rendered_at_us = rendered_at_us
+            });
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+void add_prop(protocol::ObjectValue* object, const char* key, const std::string &value) {
+    auto prop = object->add_props();
+    prop->set_key(key);
+    prop->set_string_value(value);
+}
+
+void add_prop(protocol::ObjectValue* object, const char* key, double value) {
+    auto prop = object->add_props();
+    prop->set_key(key);
+    prop->set_float_value(value);
+}
+
+std::string frame(const protocol::ClientMessage &message) {
+    auto body = message.SerializeAsString();
+    uint32_t packet_size = htonl(body.size());
+
+    return std::string((const char*)&packet_size, sizeof(uint32_t)) + body;
+}
+
+// Mirrors what the reconciler sends for one frame of the DVD example
+std::string update_frame(int i) {
+    protocol::ClientMessage message;
+    auto update = message.mutable_apply_update()->mutable_update_source();
+    update->set_uid("6f1d3a52-2b8e-4a4e-9f4c-8d1b2a7c9e10");
+
+    auto props = update->mutable_changed_props();
+    add_prop(props, "name", "DVD Logo");
+    add_prop(props, "path", "/tmp/dvd-logo.jpg");
+
+    auto style_prop = props->add_props();
+    style_prop->set_key("style");
+
+    auto style = style_prop->mutable_object_value();
+    add_prop(style, "position", "absolute");
+    add_prop(style, "top", 3 + i * 0.1);
+    add_prop(style, "left", 20 + i * 0.2);
+    add_prop(style, "width", 289);
+    add_prop(style, "height", 184);
+
+    return frame(message);
+}
+
+// One rendered frame of the animation and its commit, as the controller sends
+// them, stamped with the time it was rendered at
+std::string batch_frame(double rendered_at_us) {
+    protocol::ClientMessage message;
+    auto batch = message.mutable_update_batch();
+
+    auto update = batch->add_updates()->mutable_update_source();
+    update->set_handle(2);
+
+    auto prop = update->mutable_changed_props()->add_props();
+    prop->set_key("top");
+    prop->set_float_value(rendered_at_us);
+
+    batch->add_updates()->mutable_commit_updates()->set_container_handle(1);
+
+    return frame(message);
+}
+
+std::string ping_frame() {
+    protocol::ClientMessage message;
+    auto init_request = message.mutable_init_request();
+    init_request->set_request_id("ping");
+    init_request->set_client_id("benchmark");
+
+    return frame(message);
+}
+
+bool read_message(sockpp::stream_socket &socket, protocol::ServerMessage &message) {
+    uint32_t packet_size;
+
+    if (socket.read_n(&packet_size, sizeof(uint32_t)) != sizeof(uint32_t)) {
+        return false;
+    }
+
+    std::vector<char> buffer(ntohl(packet_size));
+
+    if (socket.read_n(buffer.data(), buffer.size()) != (ssize_t)buffer.size()) {
+        return false;
+    }
+
+    return message.ParseFromArray(buffer.data(), buffer.size());
+}
+
+// Whether the next message is the response to a ping
+bool is_ping_response(const protocol::ServerMessage &message) {
+    return message.has_response() && message.response().request_id() == "ping";
+}
+
+struct SocketTransport {
+    sockpp::stream_socket &socket;
+
+    void send(const std::string &frame) {
+        socket.write_n(frame.data(), frame.size());
+    }
+
+    bool read_response() {
+        protocol::ServerMessage message;
+
+        return read_message(socket, message) && is_ping_response(message);
+    }
+};
+
+#ifdef REACT_OBS_SHARED_MEMORY
+// The client side of the shared memory transport, as a controller would
+// implement it: asks for the rings in its init request over the Unix socket,
+// and receives the memfd and eventfds with the response. Everything after
+// that goes through the rings.
+class SharedMemoryTransport {
+    sockpp::unix_connector socket;
+
+    std::array<int, 3> fds = { -1, -1, -1 };
+    void* memory = MAP_FAILED;
+    size_t memory_size = 0;
+
+    // The server's inbound and outbound rings
+    SharedRing to_server;
+    SharedRing from_server;
+
+    std::vector<unsigned char> scratch;
+
+    // Read from the ring, not returned by `read_response` yet
+    size_t ping_responses = 0;
+
+    // Reads the init response, with the descriptors attached to its first byte
+    bool read_init_response(protocol::ServerMessage &response) {
+        uint32_t packet_size;
+        iovec io_vector { &packet_size, sizeof(uint32_t) };
+        char control[CMSG_SPACE(sizeof(fds))] = {};
+
+        msghdr header {};
+        header.msg_iov = &io_vector;
+        header.msg_iovlen = 1;
+        header.msg_control = control;
+        header.msg_controllen = sizeof(control);
+
+        if (recvmsg(socket.handle(), &header, MSG_WAITALL) != sizeof(uint32_t)) {
+            return false;
+        }
+
+        auto control_header = CMSG_FIRSTHDR(&header);
+
+        if (!control_header || control_header->cmsg_type != SCM_RIGHTS || control_header->cmsg_len != CMSG_LEN(sizeof(fds))) {
+            fprintf(stderr, "Shared memory: the init response carries no descriptors\n");
+            return false;
+        }
+
+        memcpy(fds.data(), CMSG_DATA(control_header), sizeof(fds));
+
+        std::vector<char> buffer(ntohl(packet_size));
+
+        if (socket.read_n(buffer.data(), buffer.size()) != (ssize_t)buffer.size()) {
+            return false;
+        }
+
+        return response.ParseFromArray(buffer.data(), buffer.size());
+    }
+
+public:
+    ~SharedMemoryTransport() {
+        if (memory != MAP_FAILED) {
+            munmap(memory, memory_size);
+        }
+
+        for (auto fd : fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    bool connect() {
+        if (!socket.connect(sockpp::unix_address(benchmark_unix_socket_path))) {
+            fprintf(stderr, "Shared memory: cannot connect: %s\n", socket.last_error_str().c_str());
+            return false;
+        }
+
+        protocol::ClientMessage init;
+        init.mutable_init_request()->set_request_id("init");
+        init.mutable_init_request()->set_client_id("benchmark");
+        init.mutable_init_request()->set_shared_memory_ring_size(benchmark_ring_size);
+
+        auto init_frame = frame(init);
+        socket.write_n(init_frame.data(), init_frame.size());
+
+        protocol::ServerMessage response;
+
+        if (!read_init_response(response)) {
+            fprintf(stderr, "Shared memory: no init response\n");
+            return false;
+        }
+
+        auto ring_size = response.response().shared_memory().ring_size();
+
+        if (ring_size == 0 || (ring_size & (ring_size - 1)) != 0) {
+            fprintf(stderr, "Shared memory: the server did not agree to a ring\n");
+            return false;
+        }
+
+        auto ring_memory_size = SharedRing::memory_size(ring_size);
+        memory_size = ring_memory_size * 2;
+        memory = mmap(nullptr, memory_size, PROT_READ | PROT_WRITE, MAP_SHARED, fds[0], 0);
+
+        if (memory == MAP_FAILED) {
+            fprintf(stderr, "Shared memory: cannot map the rings\n");
+            return false;
+        }
+
+        auto bytes = (unsigned char*)memory;
+
+        to_server = SharedRing(bytes, ring_size, fds[1]);
+        from_server = SharedRing(bytes + ring_memory_size, ring_size, fds[2]);
+
+        return true;
+    }
+
+    // Waits for room in the ring if the server is behind
+    void send(const std::string &frame) {
+        while (!to_server.write_frame(&frame[sizeof(uint32_t)], frame.size() - sizeof(uint32_t))) {
+            std::this_thread::yield();
+        }
+    }
+
+    bool read_response() {
+        auto on_packet = [this](const unsigned char* data, uint32_t size) {
+            protocol::ServerMessage message;
+
+            if (!message.ParseFromArray(data, size)) {
+                return false;
+            }
+
+            ping_responses += is_ping_response(message);
+            return true;
+        };
+
+        while (ping_responses == 0) {
+            if (!from_server.read_frames(scratch, benchmark_ring_size, on_packet)) {
+                return false;
+            }
+
+            // Sleeps on the eventfd until the server has written
+            if (ping_responses == 0 && from_server.prepare_wait()) {
+                pollfd readable = { .fd = fds[2], .events = POLLIN, .revents = 0 };
+
+                if (poll(&readable, 1, 5000) <= 0) {
+                    return false;
+                }
+
+                from_server.clear_event();
+            }
+        }
+
+        ping_responses--;
+        return true;
+    }
+};
+#endif
+
+template <class Transport>
+void run_benchmark(const char* name, Transport &transport, int message_count) {
+    std::vector<std::string> updates;
+    updates.reserve(message_count);
+
+    for (int i = 0; i < message_count; i++) {
+        updates.push_back(update_frame(i));
+    }
+
+    auto ping = ping_frame();
+
+    // Latency: one update followed by a ping, waiting for the reply each time
+    std::vector<double> round_trips;
+    round_trips.reserve(message_count);
+
+    for (auto &update : updates) {
+        auto start = benchmark_clock::now();
+
+        transport.send(update);
+        transport.send(ping);
+
+        if (!transport.read_response()) {
+            printf("%s: connection lost\n", name);
+            return;
+        }
+
+        std::chrono::duration<double, std::micro> elapsed = benchmark_clock::now() - start;
+        round_trips.push_back(elapsed.count());
+    }
+
+    std::sort(round_trips.begin(), round_trips.end());
+
+    // Throughput: all updates back to back, then a single ping
+    size_t total_bytes = 0;
+    auto start = benchmark_clock::now();
+
+    for (auto &update : updates) {
+        transport.send(update);
+        total_bytes += update.size();
+    }
+
+    transport.send(ping);
+
+    if (!transport.read_response()) {
+        printf("%s: connection lost\n", name);
+        return;
+    }
+
+    std::chrono::duration<double> elapsed = benchmark_clock::now() - start;
+
+    printf(
+        "%-12s latency p50 = %7.1f us, p99 = %7.1f us | throughput = %9.0f msg/s, %7.1f MB/s\n",
+        name,
+        round_trips[round_trips.size() / 2],
+        round_trips[round_trips.size() * 99 / 100],
+        message_count / elapsed.count(),
+        total_bytes / elapsed.count() / (1024 * 1024)
+    );
+}
+
+// Renders the animation for a while against a 30 fps tick which applies the
+// received batches and returns their credits, like the plugin's. Unpaced, the
+// controller renders every frame and holds the batches it has no credits for.
+// Paced, it skips rendering until it has credits, like `useTime` waiting on
+// `whenReady`. Reports how old frames are when the tick applies them.
+void run_flow_control_benchmark(const char* name, bool paced) {
+    sockpp::unix_connector socket((sockpp::unix_address(benchmark_unix_socket_path)));
+    if (!socket) {
+        printf("%s: cannot connect: %s\n", name, socket.last_error_str().c_str());
+        return;
+    }
+
+    protocol::ClientMessage init;
+    init.mutable_init_request()->set_request_id("init");
+    init.mutable_init_request()->set_client_id("benchmark");
+    init.mutable_init_request()->set_flow_control(true);
+
+    auto init_frame = frame(init);
+    socket.write_n(init_frame.data(), init_frame.size());
+
+    protocol::ServerMessage response;
+    if (!read_message(socket, response)) {
+        printf("%s: connection lost\n", name);
+        return;
+    }
+
+    int64_t credits = response.response().update_credits();
+    std::deque<std::string> held_batches;
+    size_t max_held_batches = 0;
+
+    // Left over from the previous run
+    {
+        std::lock_guard<std::mutex> lock(received_frames_mutex);
+        received_frames.clear();
+    }
+
+    // Written by the tick thread only, read once it has stopped
+    std::vector<double> latencies;
+    std::atomic<bool> ticking = true;
+
+    std::thread ticker([&]() {
+        while (ticking) {
+            std::this_thread::sleep_for(slow_tick_interval);
+
+            std::vector<ReceivedFrame> frames;
+            {
+                std::lock_guard<std::mutex> lock(received_frames_mutex);
+                frames.swap(received_frames);
+            }
+
+            auto now = now_us();
+
+            for (auto &frame : frames) {
+                latencies.push_back((now - frame.rendered_at_us) / 1000);
+                update_credits.batch_committed(*frame.client);
+            }
+
+            update_credits.replenish();
+        }
+    });
+
+    auto send_held_batches = [&]() {
+        while (credits > 0 && !held_batches.empty()) {
+            socket.write_n(held_batches.front().data(), held_batches.front().size());
+            held_batches.pop_front();
+            credits--;
+        }
+    };
+
+    auto end = benchmark_clock::now() + flow_control_duration;
+    auto next_frame = benchmark_clock::now();
+
+    while (benchmark_clock::now() < end) {
+        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(next_frame - benchmark_clock::now());
+
+        pollfd readable = { .fd = socket.handle(), .events = POLLIN, .revents = 0 };
+
+        if (poll(&readable, 1, std::max<int>(wait.count(), 0)) > 0) {
+            protocol::ServerMessage message;
+
+            if (!read_message(socket, message)) {
+                printf("%s: connection lost\n", name);
+                break;
+            }
+
+            credits += message.update_credits().credits();
+            send_held_batches();
+        }
+
+        if (benchmark_clock::now() < next_frame) {
+            continue;
+        }
+
+        next_frame += animation_frame_interval;
+
+        if (paced && (credits == 0 || !held_batches.empty())) {
+            continue;
+        }
+
+        held_batches.push_back(batch_frame(now_us()));
+        send_held_batches();
+
+        max_held_batches = std::max(max_held_batches, held_batches.size());
+    }
+
+    ticking = false;
+    ticker.join();
+    socket.close();
+
+    if (latencies.empty()) {
+        printf("%s: no batch was applied\n", name);
+        return;
+    }
+
+    auto last = latencies.back();
+    std::sort(latencies.begin(), latencies.end());
+
+    printf(
+        "%-12s %4zu frames applied, age p50 = %6.1f ms, max = %6.1f ms, last = %6.1f ms | max held = %zu\n",
+        name,
+        latencies.size(),
+        latencies[latencies.size() / 2],
+        latencies.back(),
+        last,
+        max_held_batches
+    );
+}
+
+int main(int argc, char** argv) {
+    int message_count = argc > 1 ? atoi(argv[1]) : 10000;
+
+    if (message_count <= 0) {
+        fprintf(stderr, "Usage: %s [message-count]\n", argv[0]);
+        return 1;
+    }
+
+    ApiServer server(benchmark_message_received);
+    server.start(ApiServerSettings {
+        .tcp_enabled = true,
+        .tcp_port = benchmark_tcp_port,
+
+        .unix_socket_enabled = true,
+        .unix_socket_path = benchmark_unix_socket_path,
+
+        .max_frame_size = 16 * 1024 * 1024,
+
+        .outbound_queue_capacity = 256,
+        .outbound_overflow_policy = OverflowPolicy::DropOldest,
+
+        .compression_enabled = false,
+        .compression_threshold = 1024,
+        .use_compression_dictionary = false
+    });
+
+    // Give the reactor thread time to bind its listeners
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    sockpp::tcp_connector tcp_socket(sockpp::inet_address("localhost", benchmark_tcp_port));
+    if (!tcp_socket) {
+        fprintf(stderr, "Cannot connect over TCP: %s\n", tcp_socket.last_error_str().c_str());
+        return 1;
+    }
+
+    // Same setting as a Node.js socket with `setNoDelay(true)`
+    int no_delay = 1;
+    tcp_socket.set_option(IPPROTO_TCP, TCP_NODELAY, no_delay);
+
+    sockpp::unix_address unix_address(benchmark_unix_socket_path);
+    sockpp::unix_connector unix_socket(unix_address);
+    if (!unix_socket) {
+        fprintf(stderr, "Cannot connect over Unix socket: %s\n", unix_socket.last_error_str().c_str());
+        return 1;
+    }
+
+    printf("%i UpdateSource messages of %zu bytes\n", message_count, update_frame(0).size());
+
+    SocketTransport tcp_transport { tcp_socket };
+    SocketTransport unix_transport { unix_socket };
+
+    run_benchmark("TCP", tcp_transport, message_count);
+    run_benchmark("Unix socket", unix_transport, message_count);
+
+#ifdef REACT_OBS_SHARED_MEMORY
+    SharedMemoryTransport shared_memory;
+
+    if (shared_memory.connect()) {
+        run_benchmark("Shared mem", shared_memory, message_count);
+    }
+#endif
+
+    printf("Animation at %lld fps against a 30 fps tick\n", 1000 / (long long)animation_frame_interval.count());
+
+    run_flow_control_benchmark("Unpaced", false);
+    run_flow_control_benchmark("Paced", true);
+
+    tcp_socket.close();
+    unix_socket.close();
+    server.stop();
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+// Optional per-frame compression, negotiated in `InitRequest` (see
+// `Compression` in protocol.proto).
+//
+// A compressed frame has the high bit of its length header set, and its
+// payload is the 4-byte big-endian size of the message followed by the
+// message as a raw deflate stream. Every frame is compressed on its own, with
+// the dictionary below preset, so frames can still be dropped or coalesced
+// in the outbound queue. Frames smaller than the threshold are sent as is.
+
+#include <zlib.h>
+
+static constexpr uint32_t compressed_frame_flag = 0x80000000;
+
+// Strings that appear in most messages. Deflate finds matches more cheaply
+// towards the end of the dictionary, so the most common ones come last.
+static const char compression_dictionary[] =
+    "browser_sourcecolor_source_v3ffmpeg_sourcetext_ft2_source_v2text_ft2_source"
+    "image_sourceunloadfilefontfacesizestyletexturlcolor"
+    "ltrrtlinheritwrapnowrapscrollhiddenvisiblebaselinespace-betweenspace-around"
+    "flex-startflex-endcolumn-reverserow-reverserowcolumnstretchcenterauto"
+    "relativeabsolutedisplaynoneflexoverflowdirectionaspectRatioflexBasis"
+    "flexShrinkflexGrowflexWrapalignContentalignSelfalignItemsjustifyContent"
+    "positiontopleftbottomrightminWidthmaxWidthminHeightmaxHeight"
+    "paddingpaddingToppaddingRightpaddingBottompaddingLeft"
+    "marginmarginTopmarginRightmarginBottommarginLeft"
+    "widthheightflexDirection";
+
+class FrameCompressor {
+    z_stream stream {};
+    bool use_dictionary;
+
+public:
+    FrameCompressor(bool _use_dictionary) : use_dictionary(_use_dictionary) {
+        deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    }
+
+    FrameCompressor(const FrameCompressor&) = delete;
+    FrameCompressor& operator=(const FrameCompressor&) = delete;
+
+    ~FrameCompressor() {
+        deflateEnd(&stream);
+    }
+
+    // Writes the compressed frame for `packet` to `frame`. Returns false if
+    // compression failed or did not make the frame smaller.
+    bool compress(const unsigned char* packet, size_t size, std::vector<unsigned char> &frame) {
+        static constexpr size_t header_size = 2 * sizeof(uint32_t);
+
+        deflateReset(&stream);
+
+        if (use_dictionary) {
+            deflateSetDictionary(&stream, (const Bytef*)compression_dictionary, sizeof(compression_dictionary) - 1);
+        }
+
+        frame.resize(header_size + deflateBound(&stream, size));
+
+        stream.next_in = (Bytef*)packet;
+        stream.avail_in = size;
+        stream.next_out = &frame[header_size];
+        stream.avail_out = frame.size() - header_size;
+
+        if (deflate(&stream, Z_FINISH) != Z_STREAM_END) {
+            return false;
+        }
+
+        auto payload_size = sizeof(uint32_t) + stream.total_out;
+
+        if (payload_size >= size) {
+            return false;
+        }
+
+        uint32_t frame_header = htonl(compressed_frame_flag | payload_size);
+        uint32_t message_size = htonl(size);
+        memcpy(&frame[0], &frame_header, sizeof(uint32_t));
+        memcpy(&frame[sizeof(uint32_t)], &message_size, sizeof(uint32_t));
+
+        frame.resize(sizeof(uint32_t) + payload_size);
+
+        return true;
+    }
+};
+
+class FrameDecompressor {
+    // Kept for the usual messages, larger buffers are given back afterwards
+    static constexpr size_t default_capacity = 64 * 1024;
+
+    z_stream stream {};
+    bool use_dictionary;
+
+    // Holds the last decompressed message
+    std::vector<unsigned char> buffer;
+
+public:
+    FrameDecompressor(bool _use_dictionary) : use_dictionary(_use_dictionary) {
+        inflateInit2(&stream, -MAX_WBITS);
+    }
+
+    FrameDecompressor(const FrameDecompressor&) = delete;
+    FrameDecompressor& operator=(const FrameDecompressor&) = delete;
+
+    ~FrameDecompressor() {
+        inflateEnd(&stream);
+    }
+
+    // Decompresses the payload of a compressed frame. The result stays valid
+    // until the next call.
+    bool decompress(const unsigned char* payload, size_t size, size_t max_size, const unsigned char* &message, size_t &message_size) {
+        if (size < sizeof(uint32_t)) {
+            return false;
+        }
+
+        uint32_t expected_size;
+        memcpy(&expected_size, payload, sizeof(uint32_t));
+        expected_size = ntohl(expected_size);
+
+        if (expected_size > max_size) {
+            blog(LOG_ERROR, "[react-obs] Compressed frame of %u bytes exceeds the maximum of %zu", expected_size, max_size);
+            return false;
+        }
+
+        if (buffer.size() < expected_size) {
+            buffer.resize(expected_size);
+        } else if (buffer.size() > default_capacity && expected_size <= default_capacity) {
+            // The large message has been handled, give the memory back
+            std::vector<unsigned char>(default_capacity).swap(buffer);
+        }
+
+        inflateReset(&stream);
+
+        if (use_dictionary) {
+            inflateSetDictionary(&stream, (const Bytef*)compression_dictionary, sizeof(compression_dictionary) - 1);
+        }
+
+        stream.next_in = (Bytef*)payload + sizeof(uint32_t);
+        stream.avail_in = size - sizeof(uint32_t);
+        stream.next_out = buffer.data();
+        stream.avail_out = expected_size;
+
+        if (inflate(&stream, Z_FINISH) != Z_STREAM_END || stream.total_out != expected_size) {
+            blog(LOG_ERROR, "[react-obs] Could not decompress frame");
+            return false;
+        }
+
+        message = buffer.data();
+        message_size = expected_size;
+
+        return true;
+    }
+};
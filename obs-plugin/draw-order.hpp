@@ -0,0 +1,86 @@
+// Planning of sceneitem moves that bring the draw order of a scene in line with
+// the order of its children (see `reconcile_draw_order` in obs-adapter.hpp).
+//
+// Every move locks the scene and walks its item list, so only the items outside
+// a longest increasing subsequence of the current positions are moved. Does not
+// depend on OBS, so it can be benchmarked on its own.
+
+// Places `item` right above `anchor`, or right below it if `above` is false
+struct DrawOrderMove {
+    size_t item;
+    size_t anchor;
+    bool above;
+};
+
+// Marks the items of a longest strictly increasing subsequence, in O(n log n)
+std::vector<bool> longest_increasing_subsequence(const std::vector<int> &values) {
+    auto count = values.size();
+
+    // Index of the smallest tail of an increasing subsequence of each length
+    std::vector<size_t> tails;
+    std::vector<size_t> previous(count, SIZE_MAX);
+
+    tails.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        auto tail = std::lower_bound(tails.begin(), tails.end(), values[i], [&values](size_t index, int value) {
+            return values[index] < value;
+        });
+
+        if (tail != tails.begin()) {
+            previous[i] = *(tail - 1);
+        }
+
+        if (tail == tails.end()) {
+            tails.push_back(i);
+        } else {
+            *tail = i;
+        }
+    }
+
+    std::vector<bool> in_subsequence(count, false);
+
+    for (auto i = tails.empty() ? SIZE_MAX : tails.back(); i != SIZE_MAX; i = previous[i]) {
+        in_subsequence[i] = true;
+    }
+
+    return in_subsequence;
+}
+
+// Given the current positions of items listed in their desired order, returns
+// the moves to apply in order. Items in the subsequence stay where they are,
+// every other item goes right above the one before it, and a first item which
+// has to move goes right below the first one staying.
+std::vector<DrawOrderMove> plan_draw_order(const std::vector<int> &positions) {
+    std::vector<DrawOrderMove> moves;
+
+    auto in_subsequence = longest_increasing_subsequence(positions);
+
+    for (size_t i = 0; i < positions.size(); i++) {
+        if (in_subsequence[i]) {
+            continue;
+        }
+
+        if (i > 0) {
+            moves.push_back(DrawOrderMove { .item = i, .anchor = i - 1, .above = true });
+            continue;
+        }
+
+        // The subsequence is not empty if any item has to move
+        auto first_staying = std::find(in_subsequence.begin(), in_subsequence.end(), true) - in_subsequence.begin();
+
+        moves.push_back(DrawOrderMove { .item = i, .anchor = (size_t)first_staying, .above = false });
+    }
+
+    return moves;
+}
+
+// Target for `set_order_position` style moves, which take the item out of the
+// list and insert it at the given position
+int draw_order_target(int position, int anchor_position, bool above) {
+    if (above) {
+        return position > anchor_position ? anchor_position + 1 : anchor_position;
+    } else {
+        return position < anchor_position ? anchor_position - 1 : anchor_position;
+    }
+}
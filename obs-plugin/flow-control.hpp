@@ -0,0 +1,108 @@
+// Credit-based flow control for update batches (see `UpdateCredits` in
+// protocol.proto).
+//
+// A client which asks for flow control in its `InitRequest` may have `window`
+// batches in flight. Committing a batch uses up a credit, and the video tick
+// returns the credits for every batch it has applied and laid out. A
+// controller waiting for credits ends up sending at the rate OBS renders,
+// instead of queueing updates in socket buffers.
+class UpdateCreditTracker {
+    struct ClientCredits {
+        std::weak_ptr<ClientConnection> client;
+        uint32_t window;
+
+        // Committed batches whose credits have not been returned yet
+        uint32_t outstanding;
+
+        // Committed since the last tick
+        uint32_t consumed;
+
+        bool warned;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<size_t, ClientCredits> clients;
+    std::atomic<bool> has_consumed = false;
+    uint32_t window = 2;
+
+public:
+    void set_window(uint32_t _window) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        window = std::max<uint32_t>(_window, 1);
+    }
+
+    // Returns the window granted to the client
+    uint32_t add_client(ClientConnection &client) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        clients[client.get_id()] = ClientCredits {
+            .client = client.shared_from_this(),
+            .window = window,
+            .outstanding = 0,
+            .consumed = 0,
+            .warned = false
+        };
+
+        return window;
+    }
+
+    // Must be called under `render_mutex`, after the batch has been applied,
+    // so that the next tick includes it
+    void batch_committed(ClientConnection &client) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto credits_find = clients.find(client.get_id());
+        if (credits_find == clients.end()) {
+            return;
+        }
+
+        auto &credits = credits_find->second;
+
+        if (credits.outstanding >= credits.window && !credits.warned) {
+            blog(LOG_WARNING, "[react-obs] Client %zu sends update batches without waiting for credits", client.get_id());
+            credits.warned = true;
+        }
+
+        credits.outstanding++;
+        credits.consumed++;
+        has_consumed = true;
+    }
+
+    // Called from the video tick, under `render_mutex`. Does not lock when no
+    // batch was committed since the last tick.
+    void replenish() {
+        if (!has_consumed) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        has_consumed = false;
+
+        for (auto it = clients.begin(); it != clients.end();) {
+            auto &credits = it->second;
+            auto client = credits.client.lock();
+
+            if (!client || !client->is_running()) {
+                it = clients.erase(it);
+                continue;
+            }
+
+            if (credits.consumed > 0) {
+                protocol::ServerMessage message;
+                message.mutable_update_credits()->set_credits(credits.consumed);
+
+                // Only queues the message, the writer thread sends it
+                client->send(message);
+
+                credits.outstanding -= std::min(credits.outstanding, credits.consumed);
+                credits.consumed = 0;
+            }
+
+            ++it;
+        }
+    }
+};
+
+UpdateCreditTracker update_credits;
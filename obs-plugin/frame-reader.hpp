@@ -0,0 +1,106 @@
+// Splits a byte stream into length-prefixed frames (4-byte big-endian size
+// followed by the payload). The high bit of the size marks compressed frames
+// (see compression.hpp).
+//
+// Data is read in large chunks straight into the buffer, and every complete
+// frame is handed out in place, so a burst of small messages costs a single
+// read. The buffer grows to fit frames larger than its default capacity and
+// goes back to the default size once such a frame has been consumed.
+class FrameReader {
+    // Compact instead of reading less than this into the end of the buffer
+    static constexpr size_t min_read_size = 4 * 1024;
+
+    size_t default_capacity;
+    size_t max_frame_size;
+
+    std::vector<unsigned char> buffer;
+
+    // Unconsumed data is in [start, end)
+    size_t start = 0;
+    size_t end = 0;
+
+    // Size (including the header) of the incomplete frame at `start`, if known
+    size_t pending_frame_size = 0;
+
+public:
+    FrameReader(size_t _default_capacity, size_t _max_frame_size)
+        : default_capacity(std::max(_default_capacity, min_read_size)),
+          max_frame_size(_max_frame_size),
+          buffer(default_capacity) {}
+
+    // Makes room for the next read and returns where it should go
+    unsigned char* prepare_read() {
+        auto buffered_size = end - start;
+        auto required_size = std::max(pending_frame_size, buffered_size + min_read_size);
+
+        if (buffer.size() > default_capacity && required_size <= default_capacity) {
+            // The large frame has been consumed, give the memory back
+            std::vector<unsigned char> smaller_buffer(default_capacity);
+            memcpy(smaller_buffer.data(), &buffer[start], buffered_size);
+
+            buffer.swap(smaller_buffer);
+            start = 0;
+            end = buffered_size;
+        } else if (buffer.size() - start < required_size || buffer.size() - end < min_read_size) {
+            memmove(buffer.data(), &buffer[start], buffered_size);
+            start = 0;
+            end = buffered_size;
+
+            if (buffer.size() < required_size) {
+                buffer.resize(required_size);
+            }
+        }
+
+        return &buffer[end];
+    }
+
+    size_t read_capacity() const {
+        return buffer.size() - end;
+    }
+
+    void commit_read(size_t size) {
+        end += size;
+    }
+
+    // Calls `on_frame(data, size, compressed)` for every complete frame.
+    // Returns false if a frame is larger than the maximum or `on_frame`
+    // returns false.
+    template <class F>
+    bool parse_frames(F on_frame) {
+        while (end - start >= sizeof(uint32_t)) {
+            uint32_t frame_header;
+            memcpy(&frame_header, &buffer[start], sizeof(uint32_t));
+            frame_header = ntohl(frame_header);
+
+            auto compressed = (frame_header & compressed_frame_flag) != 0;
+            uint32_t packet_size = frame_header & ~compressed_frame_flag;
+
+            if (packet_size > max_frame_size) {
+                blog(LOG_ERROR, "[react-obs] Frame of %u bytes exceeds the maximum of %zu", packet_size, max_frame_size);
+                return false;
+            }
+
+            auto frame_size = sizeof(uint32_t) + packet_size;
+
+            if (end - start < frame_size) {
+                pending_frame_size = frame_size;
+                return true;
+            }
+
+            if (!on_frame(&buffer[start + sizeof(uint32_t)], packet_size, compressed)) {
+                return false;
+            }
+
+            start += frame_size;
+        }
+
+        pending_frame_size = 0;
+
+        if (start == end) {
+            start = 0;
+            end = 0;
+        }
+
+        return true;
+    }
+};
@@ -14,637 +14,1298 @@
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppendChild_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_ApplyUpdate_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_CommitUpdates_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_CreateScene_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_CreateSource_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FindSourceRequest_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InitRequest_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ObjectValue_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RemoveChild_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Response_protocol_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_protocol_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UpdateSource_protocol_2eproto;
-namespace protocol {
-class ClientMessageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ClientMessage> _instance;
-  const ::protocol::InitRequest* init_request_;
-  const ::protocol::ApplyUpdate* apply_update_;
-  const ::protocol::FindSourceRequest* find_source_;
-} _ClientMessage_default_instance_;
-class ServerMessageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ServerMessage> _instance;
-  const ::protocol::Response* response_;
-} _ServerMessage_default_instance_;
-class InitRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<InitRequest> _instance;
-} _InitRequest_default_instance_;
-class SceneDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Scene> _instance;
-} _Scene_default_instance_;
-class ApplyUpdateDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ApplyUpdate> _instance;
-  const ::protocol::CreateSource* create_source_;
-  const ::protocol::UpdateSource* update_source_;
-  const ::protocol::CreateScene* create_scene_;
-  const ::protocol::AppendChild* append_child_;
-  const ::protocol::RemoveChild* remove_child_;
-  const ::protocol::CommitUpdates* commit_updates_;
-} _ApplyUpdate_default_instance_;
-class FindSourceRequestDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<FindSourceRequest> _instance;
-} _FindSourceRequest_default_instance_;
-class ResponseDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Response> _instance;
-} _Response_default_instance_;
-class CreateSourceDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<CreateSource> _instance;
-} _CreateSource_default_instance_;
-class UpdateSourceDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<UpdateSource> _instance;
-} _UpdateSource_default_instance_;
-class CreateSceneDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<CreateScene> _instance;
-} _CreateScene_default_instance_;
-class AppendChildDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AppendChild> _instance;
-} _AppendChild_default_instance_;
-class RemoveChildDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<RemoveChild> _instance;
-} _RemoveChild_default_instance_;
-class CommitUpdatesDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<CommitUpdates> _instance;
-} _CommitUpdates_default_instance_;
-class PropDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Prop> _instance;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_value_;
-  ::PROTOBUF_NAMESPACE_ID::int64 int_value_;
-  double float_value_;
-  bool bool_value_;
-  const ::protocol::ObjectValue* object_value_;
-  bool undefined_;
-} _Prop_default_instance_;
-class ObjectValueDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ObjectValue> _instance;
-} _ObjectValue_default_instance_;
-}  // namespace protocol
-static void InitDefaultsscc_info_AppendChild_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_AppendChild_default_instance_;
-    new (ptr) ::protocol::AppendChild();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::AppendChild::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AppendChild_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AppendChild_protocol_2eproto}, {}};
-
-static void InitDefaultsscc_info_ApplyUpdate_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_ApplyUpdate_default_instance_;
-    new (ptr) ::protocol::ApplyUpdate();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::ApplyUpdate::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<6> scc_info_ApplyUpdate_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 6, 0, InitDefaultsscc_info_ApplyUpdate_protocol_2eproto}, {
-      &scc_info_CreateSource_protocol_2eproto.base,
-      &scc_info_UpdateSource_protocol_2eproto.base,
-      &scc_info_CreateScene_protocol_2eproto.base,
-      &scc_info_AppendChild_protocol_2eproto.base,
-      &scc_info_RemoveChild_protocol_2eproto.base,
-      &scc_info_CommitUpdates_protocol_2eproto.base,}};
-
-static void InitDefaultsscc_info_ClientMessage_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_ClientMessage_default_instance_;
-    new (ptr) ::protocol::ClientMessage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::ClientMessage::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_ClientMessage_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_ClientMessage_protocol_2eproto}, {
-      &scc_info_InitRequest_protocol_2eproto.base,
-      &scc_info_ApplyUpdate_protocol_2eproto.base,
-      &scc_info_FindSourceRequest_protocol_2eproto.base,}};
-
-static void InitDefaultsscc_info_CommitUpdates_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_CommitUpdates_default_instance_;
-    new (ptr) ::protocol::CommitUpdates();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::CommitUpdates::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_CommitUpdates_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_CommitUpdates_protocol_2eproto}, {}};
-
-static void InitDefaultsscc_info_CreateScene_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_CreateScene_default_instance_;
-    new (ptr) ::protocol::CreateScene();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::CreateScene::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_CreateScene_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_CreateScene_protocol_2eproto}, {
-      &scc_info_ObjectValue_protocol_2eproto.base,}};
-
-static void InitDefaultsscc_info_CreateSource_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_CreateSource_default_instance_;
-    new (ptr) ::protocol::CreateSource();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::CreateSource::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_CreateSource_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_CreateSource_protocol_2eproto}, {
-      &scc_info_ObjectValue_protocol_2eproto.base,}};
-
-static void InitDefaultsscc_info_FindSourceRequest_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_FindSourceRequest_default_instance_;
-    new (ptr) ::protocol::FindSourceRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::FindSourceRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FindSourceRequest_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_FindSourceRequest_protocol_2eproto}, {}};
-
-static void InitDefaultsscc_info_InitRequest_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_InitRequest_default_instance_;
-    new (ptr) ::protocol::InitRequest();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::InitRequest::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_InitRequest_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_InitRequest_protocol_2eproto}, {}};
 
-static void InitDefaultsscc_info_ObjectValue_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+PROTOBUF_PRAGMA_INIT_SEG
 
-  {
-    void* ptr = &::protocol::_Prop_default_instance_;
-    new (ptr) ::protocol::Prop();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  {
-    void* ptr = &::protocol::_ObjectValue_default_instance_;
-    new (ptr) ::protocol::ObjectValue();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::Prop::InitAsDefaultInstance();
-  ::protocol::ObjectValue::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ObjectValue_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ObjectValue_protocol_2eproto}, {}};
-
-static void InitDefaultsscc_info_RemoveChild_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_RemoveChild_default_instance_;
-    new (ptr) ::protocol::RemoveChild();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::RemoveChild::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_RemoveChild_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_RemoveChild_protocol_2eproto}, {}};
-
-static void InitDefaultsscc_info_Response_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_Response_default_instance_;
-    new (ptr) ::protocol::Response();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::Response::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Response_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Response_protocol_2eproto}, {}};
-
-static void InitDefaultsscc_info_Scene_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_Scene_default_instance_;
-    new (ptr) ::protocol::Scene();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::Scene::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Scene_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Scene_protocol_2eproto}, {}};
-
-static void InitDefaultsscc_info_ServerMessage_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_ServerMessage_default_instance_;
-    new (ptr) ::protocol::ServerMessage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::ServerMessage::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ServerMessage_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_ServerMessage_protocol_2eproto}, {
-      &scc_info_Response_protocol_2eproto.base,}};
-
-static void InitDefaultsscc_info_UpdateSource_protocol_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::protocol::_UpdateSource_default_instance_;
-    new (ptr) ::protocol::UpdateSource();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::protocol::UpdateSource::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_UpdateSource_protocol_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_UpdateSource_protocol_2eproto}, {
-      &scc_info_ObjectValue_protocol_2eproto.base,}};
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_protocol_2eproto[15];
-static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_protocol_2eproto = nullptr;
-static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_protocol_2eproto = nullptr;
+namespace protocol {
+PROTOBUF_CONSTEXPR ClientMessage::ClientMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ClientMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClientMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClientMessageDefaultTypeInternal() {}
+  union {
+    ClientMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClientMessageDefaultTypeInternal _ClientMessage_default_instance_;
+PROTOBUF_CONSTEXPR ServerMessage::ServerMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ServerMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerMessageDefaultTypeInternal() {}
+  union {
+    ServerMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerMessageDefaultTypeInternal _ServerMessage_default_instance_;
+PROTOBUF_CONSTEXPR InitRequest::InitRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.request_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.client_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shared_memory_ring_size_)*/0u
+  , /*decltype(_impl_.flow_control_)*/false
+  , /*decltype(_impl_.compression_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InitRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InitRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InitRequestDefaultTypeInternal() {}
+  union {
+    InitRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InitRequestDefaultTypeInternal _InitRequest_default_instance_;
+PROTOBUF_CONSTEXPR Scene::Scene(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SceneDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SceneDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SceneDefaultTypeInternal() {}
+  union {
+    Scene _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SceneDefaultTypeInternal _Scene_default_instance_;
+PROTOBUF_CONSTEXPR ApplyUpdate::ApplyUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.change_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ApplyUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ApplyUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ApplyUpdateDefaultTypeInternal() {}
+  union {
+    ApplyUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApplyUpdateDefaultTypeInternal _ApplyUpdate_default_instance_;
+PROTOBUF_CONSTEXPR UpdateBatch::UpdateBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.updates_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateBatchDefaultTypeInternal() {}
+  union {
+    UpdateBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateBatchDefaultTypeInternal _UpdateBatch_default_instance_;
+PROTOBUF_CONSTEXPR FindSourceRequest::FindSourceRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.request_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FindSourceRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FindSourceRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FindSourceRequestDefaultTypeInternal() {}
+  union {
+    FindSourceRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FindSourceRequestDefaultTypeInternal _FindSourceRequest_default_instance_;
+PROTOBUF_CONSTEXPR Response::Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.request_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shared_memory_)*/nullptr
+  , /*decltype(_impl_.compression_)*/nullptr
+  , /*decltype(_impl_.update_credits_)*/0u
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.session_resumed_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseDefaultTypeInternal() {}
+  union {
+    Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseDefaultTypeInternal _Response_default_instance_;
+PROTOBUF_CONSTEXPR SharedMemoryTransport::SharedMemoryTransport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ring_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SharedMemoryTransportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SharedMemoryTransportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SharedMemoryTransportDefaultTypeInternal() {}
+  union {
+    SharedMemoryTransport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SharedMemoryTransportDefaultTypeInternal _SharedMemoryTransport_default_instance_;
+PROTOBUF_CONSTEXPR FrameCompression::FrameCompression(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dictionary_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.algorithm_)*/0
+  , /*decltype(_impl_.threshold_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FrameCompressionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrameCompressionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrameCompressionDefaultTypeInternal() {}
+  union {
+    FrameCompression _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrameCompressionDefaultTypeInternal _FrameCompression_default_instance_;
+PROTOBUF_CONSTEXPR UpdateCredits::UpdateCredits(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.credits_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateCreditsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateCreditsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateCreditsDefaultTypeInternal() {}
+  union {
+    UpdateCredits _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateCreditsDefaultTypeInternal _UpdateCredits_default_instance_;
+PROTOBUF_CONSTEXPR CreateSource::CreateSource(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.container_uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.settings_)*/nullptr
+  , /*decltype(_impl_.style_)*/nullptr
+  , /*decltype(_impl_.handle_)*/0u
+  , /*decltype(_impl_.container_handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CreateSourceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CreateSourceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CreateSourceDefaultTypeInternal() {}
+  union {
+    CreateSource _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateSourceDefaultTypeInternal _CreateSource_default_instance_;
+PROTOBUF_CONSTEXPR UpdateSource::UpdateSource(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.changed_props_)*/nullptr
+  , /*decltype(_impl_.style_)*/nullptr
+  , /*decltype(_impl_.handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateSourceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateSourceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateSourceDefaultTypeInternal() {}
+  union {
+    UpdateSource _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateSourceDefaultTypeInternal _UpdateSource_default_instance_;
+PROTOBUF_CONSTEXPR CreateScene::CreateScene(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.container_uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.props_)*/nullptr
+  , /*decltype(_impl_.style_)*/nullptr
+  , /*decltype(_impl_.handle_)*/0u
+  , /*decltype(_impl_.container_handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CreateSceneDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CreateSceneDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CreateSceneDefaultTypeInternal() {}
+  union {
+    CreateScene _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateSceneDefaultTypeInternal _CreateScene_default_instance_;
+PROTOBUF_CONSTEXPR AppendChild::AppendChild(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.parent_uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.child_uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.parent_handle_)*/0u
+  , /*decltype(_impl_.child_handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AppendChildDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AppendChildDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AppendChildDefaultTypeInternal() {}
+  union {
+    AppendChild _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AppendChildDefaultTypeInternal _AppendChild_default_instance_;
+PROTOBUF_CONSTEXPR RemoveChild::RemoveChild(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.parent_uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.child_uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.parent_handle_)*/0u
+  , /*decltype(_impl_.child_handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RemoveChildDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RemoveChildDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RemoveChildDefaultTypeInternal() {}
+  union {
+    RemoveChild _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RemoveChildDefaultTypeInternal _RemoveChild_default_instance_;
+PROTOBUF_CONSTEXPR CreateTree::CreateTree(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.roots_)*/{}
+  , /*decltype(_impl_.parent_handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CreateTreeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CreateTreeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CreateTreeDefaultTypeInternal() {}
+  union {
+    CreateTree _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateTreeDefaultTypeInternal _CreateTree_default_instance_;
+PROTOBUF_CONSTEXPR TreeNode::TreeNode(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.children_)*/{}
+  , /*decltype(_impl_.node_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct TreeNodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TreeNodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TreeNodeDefaultTypeInternal() {}
+  union {
+    TreeNode _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TreeNodeDefaultTypeInternal _TreeNode_default_instance_;
+PROTOBUF_CONSTEXPR InsertBefore::InsertBefore(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.parent_handle_)*/0u
+  , /*decltype(_impl_.child_handle_)*/0u
+  , /*decltype(_impl_.before_handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InsertBeforeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InsertBeforeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InsertBeforeDefaultTypeInternal() {}
+  union {
+    InsertBefore _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InsertBeforeDefaultTypeInternal _InsertBefore_default_instance_;
+PROTOBUF_CONSTEXPR MoveChild::MoveChild(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.parent_handle_)*/0u
+  , /*decltype(_impl_.child_handle_)*/0u
+  , /*decltype(_impl_.before_handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MoveChildDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MoveChildDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MoveChildDefaultTypeInternal() {}
+  union {
+    MoveChild _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MoveChildDefaultTypeInternal _MoveChild_default_instance_;
+PROTOBUF_CONSTEXPR CommitUpdates::CommitUpdates(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.container_uid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.container_handle_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CommitUpdatesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CommitUpdatesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CommitUpdatesDefaultTypeInternal() {}
+  union {
+    CommitUpdates _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CommitUpdatesDefaultTypeInternal _CommitUpdates_default_instance_;
+PROTOBUF_CONSTEXPR DefineKey::DefineKey(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DefineKeyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DefineKeyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DefineKeyDefaultTypeInternal() {}
+  union {
+    DefineKey _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DefineKeyDefaultTypeInternal _DefineKey_default_instance_;
+PROTOBUF_CONSTEXPR DefineString::DefineString(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DefineStringDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DefineStringDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DefineStringDefaultTypeInternal() {}
+  union {
+    DefineString _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DefineStringDefaultTypeInternal _DefineString_default_instance_;
+PROTOBUF_CONSTEXPR Style::Style(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.flex_basis_)*/nullptr
+  , /*decltype(_impl_.top_)*/nullptr
+  , /*decltype(_impl_.left_)*/nullptr
+  , /*decltype(_impl_.right_)*/nullptr
+  , /*decltype(_impl_.bottom_)*/nullptr
+  , /*decltype(_impl_.margin_top_)*/nullptr
+  , /*decltype(_impl_.margin_left_)*/nullptr
+  , /*decltype(_impl_.margin_right_)*/nullptr
+  , /*decltype(_impl_.margin_bottom_)*/nullptr
+  , /*decltype(_impl_.padding_top_)*/nullptr
+  , /*decltype(_impl_.padding_left_)*/nullptr
+  , /*decltype(_impl_.padding_right_)*/nullptr
+  , /*decltype(_impl_.padding_bottom_)*/nullptr
+  , /*decltype(_impl_.width_)*/nullptr
+  , /*decltype(_impl_.height_)*/nullptr
+  , /*decltype(_impl_.min_width_)*/nullptr
+  , /*decltype(_impl_.max_width_)*/nullptr
+  , /*decltype(_impl_.min_height_)*/nullptr
+  , /*decltype(_impl_.max_height_)*/nullptr
+  , /*decltype(_impl_.present_)*/uint64_t{0u}
+  , /*decltype(_impl_.flex_direction_)*/0
+  , /*decltype(_impl_.direction_)*/0
+  , /*decltype(_impl_.justify_content_)*/0
+  , /*decltype(_impl_.align_content_)*/0
+  , /*decltype(_impl_.align_items_)*/0
+  , /*decltype(_impl_.align_self_)*/0
+  , /*decltype(_impl_.position_)*/0
+  , /*decltype(_impl_.flex_wrap_)*/0
+  , /*decltype(_impl_.overflow_)*/0
+  , /*decltype(_impl_.display_)*/0
+  , /*decltype(_impl_.flex_grow_)*/0
+  , /*decltype(_impl_.flex_shrink_)*/0
+  , /*decltype(_impl_.aspect_ratio_)*/0
+  , /*decltype(_impl_.patch_)*/false
+  , /*decltype(_impl_.unset_)*/uint64_t{0u}
+  , /*decltype(_impl_.z_index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StyleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StyleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StyleDefaultTypeInternal() {}
+  union {
+    Style _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StyleDefaultTypeInternal _Style_default_instance_;
+PROTOBUF_CONSTEXPR SetLayoutValues::SetLayoutValues(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.handles_)*/{}
+  , /*decltype(_impl_._handles_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.prop_ids_)*/{}
+  , /*decltype(_impl_._prop_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.values_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SetLayoutValuesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SetLayoutValuesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SetLayoutValuesDefaultTypeInternal() {}
+  union {
+    SetLayoutValues _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetLayoutValuesDefaultTypeInternal _SetLayoutValues_default_instance_;
+PROTOBUF_CONSTEXPR Dimension::Dimension(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/0
+  , /*decltype(_impl_.unit_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DimensionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DimensionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DimensionDefaultTypeInternal() {}
+  union {
+    Dimension _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DimensionDefaultTypeInternal _Dimension_default_instance_;
+PROTOBUF_CONSTEXPR Prop::Prop(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_id_)*/0u
+  , /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct PropDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PropDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PropDefaultTypeInternal() {}
+  union {
+    Prop _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PropDefaultTypeInternal _Prop_default_instance_;
+PROTOBUF_CONSTEXPR ObjectValue::ObjectValue(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.props_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ObjectValueDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ObjectValueDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ObjectValueDefaultTypeInternal() {}
+  union {
+    ObjectValue _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ObjectValueDefaultTypeInternal _ObjectValue_default_instance_;
+}  // namespace protocol
+static ::_pb::Metadata file_level_metadata_protocol_2eproto[28];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_protocol_2eproto[11];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_protocol_2eproto = nullptr;
 
-const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_protocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_protocol_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::ClientMessage, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::protocol::ClientMessage, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::protocol::ClientMessage, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  offsetof(::protocol::ClientMessageDefaultTypeInternal, init_request_),
-  offsetof(::protocol::ClientMessageDefaultTypeInternal, apply_update_),
-  offsetof(::protocol::ClientMessageDefaultTypeInternal, find_source_),
-  PROTOBUF_FIELD_OFFSET(::protocol::ClientMessage, message_),
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::protocol::ClientMessage, _impl_.message_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::ServerMessage, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::protocol::ServerMessage, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::protocol::ServerMessage, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  offsetof(::protocol::ServerMessageDefaultTypeInternal, response_),
-  PROTOBUF_FIELD_OFFSET(::protocol::ServerMessage, message_),
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::protocol::ServerMessage, _impl_.message_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::InitRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::InitRequest, request_id_),
-  PROTOBUF_FIELD_OFFSET(::protocol::InitRequest, client_id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::InitRequest, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::protocol::InitRequest, _impl_.client_id_),
+  PROTOBUF_FIELD_OFFSET(::protocol::InitRequest, _impl_.shared_memory_ring_size_),
+  PROTOBUF_FIELD_OFFSET(::protocol::InitRequest, _impl_.flow_control_),
+  PROTOBUF_FIELD_OFFSET(::protocol::InitRequest, _impl_.compression_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::Scene, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::Scene, name_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::Scene, _impl_.name_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::ApplyUpdate, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::protocol::ApplyUpdate, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::protocol::ApplyUpdate, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::protocol::ApplyUpdate, _impl_.change_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::UpdateBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  offsetof(::protocol::ApplyUpdateDefaultTypeInternal, create_source_),
-  offsetof(::protocol::ApplyUpdateDefaultTypeInternal, update_source_),
-  offsetof(::protocol::ApplyUpdateDefaultTypeInternal, create_scene_),
-  offsetof(::protocol::ApplyUpdateDefaultTypeInternal, append_child_),
-  offsetof(::protocol::ApplyUpdateDefaultTypeInternal, remove_child_),
-  offsetof(::protocol::ApplyUpdateDefaultTypeInternal, commit_updates_),
-  PROTOBUF_FIELD_OFFSET(::protocol::ApplyUpdate, change_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::UpdateBatch, _impl_.updates_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::FindSourceRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::FindSourceRequest, request_id_),
-  PROTOBUF_FIELD_OFFSET(::protocol::FindSourceRequest, uid_),
-  PROTOBUF_FIELD_OFFSET(::protocol::FindSourceRequest, name_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::FindSourceRequest, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::protocol::FindSourceRequest, _impl_.uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::FindSourceRequest, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::protocol::FindSourceRequest, _impl_.handle_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::Response, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::Response, request_id_),
-  PROTOBUF_FIELD_OFFSET(::protocol::Response, success_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::Response, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Response, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Response, _impl_.shared_memory_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Response, _impl_.update_credits_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Response, _impl_.compression_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Response, _impl_.session_resumed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::SharedMemoryTransport, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::SharedMemoryTransport, _impl_.ring_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::FrameCompression, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::FrameCompression, _impl_.algorithm_),
+  PROTOBUF_FIELD_OFFSET(::protocol::FrameCompression, _impl_.threshold_),
+  PROTOBUF_FIELD_OFFSET(::protocol::FrameCompression, _impl_.dictionary_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::UpdateCredits, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::UpdateCredits, _impl_.credits_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, uid_),
-  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, container_uid_),
-  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, id_),
-  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, name_),
-  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, settings_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, _impl_.uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, _impl_.container_uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, _impl_.settings_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, _impl_.handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, _impl_.container_handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateSource, _impl_.style_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::UpdateSource, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::UpdateSource, uid_),
-  PROTOBUF_FIELD_OFFSET(::protocol::UpdateSource, changed_props_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::UpdateSource, _impl_.uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::UpdateSource, _impl_.changed_props_),
+  PROTOBUF_FIELD_OFFSET(::protocol::UpdateSource, _impl_.handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::UpdateSource, _impl_.style_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, uid_),
-  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, container_uid_),
-  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, name_),
-  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, props_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, _impl_.uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, _impl_.container_uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, _impl_.props_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, _impl_.handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, _impl_.container_handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateScene, _impl_.style_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::AppendChild, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::AppendChild, parent_uid_),
-  PROTOBUF_FIELD_OFFSET(::protocol::AppendChild, child_uid_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::AppendChild, _impl_.parent_uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::AppendChild, _impl_.child_uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::AppendChild, _impl_.parent_handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::AppendChild, _impl_.child_handle_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::RemoveChild, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::RemoveChild, parent_uid_),
-  PROTOBUF_FIELD_OFFSET(::protocol::RemoveChild, child_uid_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::RemoveChild, _impl_.parent_uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::RemoveChild, _impl_.child_uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::RemoveChild, _impl_.parent_handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::RemoveChild, _impl_.child_handle_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateTree, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateTree, _impl_.parent_handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CreateTree, _impl_.roots_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::TreeNode, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::protocol::TreeNode, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::protocol::TreeNode, _impl_.children_),
+  PROTOBUF_FIELD_OFFSET(::protocol::TreeNode, _impl_.node_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::InsertBefore, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::InsertBefore, _impl_.parent_handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::InsertBefore, _impl_.child_handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::InsertBefore, _impl_.before_handle_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::MoveChild, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::MoveChild, _impl_.parent_handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::MoveChild, _impl_.child_handle_),
+  PROTOBUF_FIELD_OFFSET(::protocol::MoveChild, _impl_.before_handle_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::CommitUpdates, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::CommitUpdates, container_uid_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::CommitUpdates, _impl_.container_uid_),
+  PROTOBUF_FIELD_OFFSET(::protocol::CommitUpdates, _impl_.container_handle_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::DefineKey, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::DefineKey, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::protocol::DefineKey, _impl_.key_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::DefineString, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::DefineString, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::protocol::DefineString, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.present_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.patch_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.unset_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.flex_direction_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.direction_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.justify_content_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.align_content_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.align_items_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.align_self_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.position_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.flex_wrap_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.overflow_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.display_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.flex_grow_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.flex_shrink_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.flex_basis_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.top_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.left_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.right_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.bottom_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.margin_top_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.margin_left_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.margin_right_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.margin_bottom_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.padding_top_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.padding_left_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.padding_right_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.padding_bottom_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.aspect_ratio_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.min_width_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.max_width_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.min_height_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.max_height_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Style, _impl_.z_index_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::SetLayoutValues, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::SetLayoutValues, _impl_.handles_),
+  PROTOBUF_FIELD_OFFSET(::protocol::SetLayoutValues, _impl_.prop_ids_),
+  PROTOBUF_FIELD_OFFSET(::protocol::SetLayoutValues, _impl_.values_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::protocol::Dimension, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::Dimension, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Dimension, _impl_.unit_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::Prop, _internal_metadata_),
   ~0u,  // no _extensions_
-  PROTOBUF_FIELD_OFFSET(::protocol::Prop, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::protocol::Prop, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::Prop, key_),
-  offsetof(::protocol::PropDefaultTypeInternal, string_value_),
-  offsetof(::protocol::PropDefaultTypeInternal, int_value_),
-  offsetof(::protocol::PropDefaultTypeInternal, float_value_),
-  offsetof(::protocol::PropDefaultTypeInternal, bool_value_),
-  offsetof(::protocol::PropDefaultTypeInternal, object_value_),
-  offsetof(::protocol::PropDefaultTypeInternal, undefined_),
-  PROTOBUF_FIELD_OFFSET(::protocol::Prop, value_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::Prop, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::protocol::Prop, _impl_.key_id_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::protocol::Prop, _impl_.value_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::protocol::ObjectValue, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::protocol::ObjectValue, props_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::protocol::ObjectValue, _impl_.props_),
 };
-static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::protocol::ClientMessage)},
-  { 9, -1, sizeof(::protocol::ServerMessage)},
-  { 16, -1, sizeof(::protocol::InitRequest)},
-  { 23, -1, sizeof(::protocol::Scene)},
-  { 29, -1, sizeof(::protocol::ApplyUpdate)},
-  { 41, -1, sizeof(::protocol::FindSourceRequest)},
-  { 49, -1, sizeof(::protocol::Response)},
-  { 56, -1, sizeof(::protocol::CreateSource)},
-  { 66, -1, sizeof(::protocol::UpdateSource)},
-  { 73, -1, sizeof(::protocol::CreateScene)},
-  { 82, -1, sizeof(::protocol::AppendChild)},
-  { 89, -1, sizeof(::protocol::RemoveChild)},
-  { 96, -1, sizeof(::protocol::CommitUpdates)},
-  { 102, -1, sizeof(::protocol::Prop)},
-  { 115, -1, sizeof(::protocol::ObjectValue)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::protocol::ClientMessage)},
+  { 11, -1, -1, sizeof(::protocol::ServerMessage)},
+  { 20, -1, -1, sizeof(::protocol::InitRequest)},
+  { 31, -1, -1, sizeof(::protocol::Scene)},
+  { 38, -1, -1, sizeof(::protocol::ApplyUpdate)},
+  { 57, -1, -1, sizeof(::protocol::UpdateBatch)},
+  { 64, -1, -1, sizeof(::protocol::FindSourceRequest)},
+  { 74, -1, -1, sizeof(::protocol::Response)},
+  { 86, -1, -1, sizeof(::protocol::SharedMemoryTransport)},
+  { 93, -1, -1, sizeof(::protocol::FrameCompression)},
+  { 102, -1, -1, sizeof(::protocol::UpdateCredits)},
+  { 109, -1, -1, sizeof(::protocol::CreateSource)},
+  { 123, -1, -1, sizeof(::protocol::UpdateSource)},
+  { 133, -1, -1, sizeof(::protocol::CreateScene)},
+  { 146, -1, -1, sizeof(::protocol::AppendChild)},
+  { 156, -1, -1, sizeof(::protocol::RemoveChild)},
+  { 166, -1, -1, sizeof(::protocol::CreateTree)},
+  { 174, -1, -1, sizeof(::protocol::TreeNode)},
+  { 184, -1, -1, sizeof(::protocol::InsertBefore)},
+  { 193, -1, -1, sizeof(::protocol::MoveChild)},
+  { 202, -1, -1, sizeof(::protocol::CommitUpdates)},
+  { 210, -1, -1, sizeof(::protocol::DefineKey)},
+  { 218, -1, -1, sizeof(::protocol::DefineString)},
+  { 226, -1, -1, sizeof(::protocol::Style)},
+  { 268, -1, -1, sizeof(::protocol::SetLayoutValues)},
+  { 277, -1, -1, sizeof(::protocol::Dimension)},
+  { 285, -1, -1, sizeof(::protocol::Prop)},
+  { 301, -1, -1, sizeof(::protocol::ObjectValue)},
 };
 
-static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_ClientMessage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_ServerMessage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_InitRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_Scene_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_ApplyUpdate_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_FindSourceRequest_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_Response_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_CreateSource_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_UpdateSource_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_CreateScene_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_AppendChild_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_RemoveChild_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_CommitUpdates_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_Prop_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::protocol::_ObjectValue_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::protocol::_ClientMessage_default_instance_._instance,
+  &::protocol::_ServerMessage_default_instance_._instance,
+  &::protocol::_InitRequest_default_instance_._instance,
+  &::protocol::_Scene_default_instance_._instance,
+  &::protocol::_ApplyUpdate_default_instance_._instance,
+  &::protocol::_UpdateBatch_default_instance_._instance,
+  &::protocol::_FindSourceRequest_default_instance_._instance,
+  &::protocol::_Response_default_instance_._instance,
+  &::protocol::_SharedMemoryTransport_default_instance_._instance,
+  &::protocol::_FrameCompression_default_instance_._instance,
+  &::protocol::_UpdateCredits_default_instance_._instance,
+  &::protocol::_CreateSource_default_instance_._instance,
+  &::protocol::_UpdateSource_default_instance_._instance,
+  &::protocol::_CreateScene_default_instance_._instance,
+  &::protocol::_AppendChild_default_instance_._instance,
+  &::protocol::_RemoveChild_default_instance_._instance,
+  &::protocol::_CreateTree_default_instance_._instance,
+  &::protocol::_TreeNode_default_instance_._instance,
+  &::protocol::_InsertBefore_default_instance_._instance,
+  &::protocol::_MoveChild_default_instance_._instance,
+  &::protocol::_CommitUpdates_default_instance_._instance,
+  &::protocol::_DefineKey_default_instance_._instance,
+  &::protocol::_DefineString_default_instance_._instance,
+  &::protocol::_Style_default_instance_._instance,
+  &::protocol::_SetLayoutValues_default_instance_._instance,
+  &::protocol::_Dimension_default_instance_._instance,
+  &::protocol::_Prop_default_instance_._instance,
+  &::protocol::_ObjectValue_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_protocol_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\016protocol.proto\022\010protocol\"\254\001\n\rClientMes"
+  "\n\016protocol.proto\022\010protocol\"\333\001\n\rClientMes"
   "sage\022-\n\014init_request\030\001 \001(\0132\025.protocol.In"
   "itRequestH\000\022-\n\014apply_update\030\002 \001(\0132\025.prot"
   "ocol.ApplyUpdateH\000\0222\n\013find_source\030\003 \001(\0132"
-  "\033.protocol.FindSourceRequestH\000B\t\n\007messag"
-  "e\"B\n\rServerMessage\022&\n\010response\030\001 \001(\0132\022.p"
-  "rotocol.ResponseH\000B\t\n\007message\"4\n\013InitReq"
-  "uest\022\022\n\nrequest_id\030\001 \001(\t\022\021\n\tclient_id\030\002 "
-  "\001(\t\"\025\n\005Scene\022\014\n\004name\030\001 \001(\t\"\271\002\n\013ApplyUpda"
-  "te\022/\n\rcreate_source\030\001 \001(\0132\026.protocol.Cre"
-  "ateSourceH\000\022/\n\rupdate_source\030\003 \001(\0132\026.pro"
-  "tocol.UpdateSourceH\000\022-\n\014create_scene\030\005 \001"
-  "(\0132\025.protocol.CreateSceneH\000\022-\n\014append_ch"
-  "ild\030\002 \001(\0132\025.protocol.AppendChildH\000\022-\n\014re"
-  "move_child\030\004 \001(\0132\025.protocol.RemoveChildH"
-  "\000\0221\n\016commit_updates\030\006 \001(\0132\027.protocol.Com"
-  "mitUpdatesH\000B\010\n\006change\"B\n\021FindSourceRequ"
-  "est\022\022\n\nrequest_id\030\001 \001(\t\022\013\n\003uid\030\002 \001(\t\022\014\n\004"
-  "name\030\003 \001(\t\"/\n\010Response\022\022\n\nrequest_id\030\001 \001"
-  "(\t\022\017\n\007success\030\002 \001(\010\"u\n\014CreateSource\022\013\n\003u"
-  "id\030\001 \001(\t\022\025\n\rcontainer_uid\030\005 \001(\t\022\n\n\002id\030\002 "
-  "\001(\t\022\014\n\004name\030\003 \001(\t\022\'\n\010settings\030\004 \001(\0132\025.pr"
-  "otocol.ObjectValue\"I\n\014UpdateSource\022\013\n\003ui"
-  "d\030\002 \001(\t\022,\n\rchanged_props\030\003 \001(\0132\025.protoco"
-  "l.ObjectValue\"e\n\013CreateScene\022\013\n\003uid\030\001 \001("
-  "\t\022\025\n\rcontainer_uid\030\004 \001(\t\022\014\n\004name\030\002 \001(\t\022$"
-  "\n\005props\030\003 \001(\0132\025.protocol.ObjectValue\"4\n\013"
-  "AppendChild\022\022\n\nparent_uid\030\001 \001(\t\022\021\n\tchild"
-  "_uid\030\002 \001(\t\"4\n\013RemoveChild\022\022\n\nparent_uid\030"
-  "\001 \001(\t\022\021\n\tchild_uid\030\002 \001(\t\"&\n\rCommitUpdate"
-  "s\022\025\n\rcontainer_uid\030\001 \001(\t\"\272\001\n\004Prop\022\013\n\003key"
-  "\030\001 \001(\t\022\026\n\014string_value\030\002 \001(\tH\000\022\023\n\tint_va"
-  "lue\030\003 \001(\003H\000\022\025\n\013float_value\030\004 \001(\001H\000\022\024\n\nbo"
-  "ol_value\030\005 \001(\010H\000\022-\n\014object_value\030\006 \001(\0132\025"
-  ".protocol.ObjectValueH\000\022\023\n\tundefined\030\007 \001"
-  "(\010H\000B\007\n\005value\",\n\013ObjectValue\022\035\n\005props\030\001 "
-  "\003(\0132\016.protocol.Propb\006proto3"
+  "\033.protocol.FindSourceRequestH\000\022-\n\014update"
+  "_batch\030\004 \001(\0132\025.protocol.UpdateBatchH\000B\t\n"
+  "\007message\"u\n\rServerMessage\022&\n\010response\030\001 "
+  "\001(\0132\022.protocol.ResponseH\000\0221\n\016update_cred"
+  "its\030\002 \001(\0132\027.protocol.UpdateCreditsH\000B\t\n\007"
+  "message\"\227\001\n\013InitRequest\022\022\n\nrequest_id\030\001 "
+  "\001(\t\022\021\n\tclient_id\030\002 \001(\t\022\037\n\027shared_memory_"
+  "ring_size\030\003 \001(\r\022\024\n\014flow_control\030\004 \001(\010\022*\n"
+  "\013compression\030\005 \001(\0162\025.protocol.Compressio"
+  "n\"\025\n\005Scene\022\014\n\004name\030\001 \001(\t\"\326\004\n\013ApplyUpdate"
+  "\022/\n\rcreate_source\030\001 \001(\0132\026.protocol.Creat"
+  "eSourceH\000\022/\n\rupdate_source\030\003 \001(\0132\026.proto"
+  "col.UpdateSourceH\000\022-\n\014create_scene\030\005 \001(\013"
+  "2\025.protocol.CreateSceneH\000\022-\n\014append_chil"
+  "d\030\002 \001(\0132\025.protocol.AppendChildH\000\022-\n\014remo"
+  "ve_child\030\004 \001(\0132\025.protocol.RemoveChildH\000\022"
+  "1\n\016commit_updates\030\006 \001(\0132\027.protocol.Commi"
+  "tUpdatesH\000\022)\n\ndefine_key\030\007 \001(\0132\023.protoco"
+  "l.DefineKeyH\000\022/\n\rdefine_string\030\010 \001(\0132\026.p"
+  "rotocol.DefineStringH\000\0226\n\021set_layout_val"
+  "ues\030\t \001(\0132\031.protocol.SetLayoutValuesH\000\022/"
+  "\n\rinsert_before\030\n \001(\0132\026.protocol.InsertB"
+  "eforeH\000\022)\n\nmove_child\030\013 \001(\0132\023.protocol.M"
+  "oveChildH\000\022+\n\013create_tree\030\014 \001(\0132\024.protoc"
+  "ol.CreateTreeH\000B\010\n\006change\"5\n\013UpdateBatch"
+  "\022&\n\007updates\030\001 \003(\0132\025.protocol.ApplyUpdate"
+  "\"R\n\021FindSourceRequest\022\022\n\nrequest_id\030\001 \001("
+  "\t\022\013\n\003uid\030\002 \001(\t\022\014\n\004name\030\003 \001(\t\022\016\n\006handle\030\004"
+  " \001(\r\"\311\001\n\010Response\022\022\n\nrequest_id\030\001 \001(\t\022\017\n"
+  "\007success\030\002 \001(\010\0226\n\rshared_memory\030\003 \001(\0132\037."
+  "protocol.SharedMemoryTransport\022\026\n\016update"
+  "_credits\030\004 \001(\r\022/\n\013compression\030\005 \001(\0132\032.pr"
+  "otocol.FrameCompression\022\027\n\017session_resum"
+  "ed\030\006 \001(\010\"*\n\025SharedMemoryTransport\022\021\n\trin"
+  "g_size\030\001 \001(\r\"c\n\020FrameCompression\022(\n\talgo"
+  "rithm\030\001 \001(\0162\025.protocol.Compression\022\021\n\tth"
+  "reshold\030\002 \001(\r\022\022\n\ndictionary\030\003 \001(\014\" \n\rUpd"
+  "ateCredits\022\017\n\007credits\030\001 \001(\r\"\277\001\n\014CreateSo"
+  "urce\022\013\n\003uid\030\001 \001(\t\022\025\n\rcontainer_uid\030\005 \001(\t"
+  "\022\n\n\002id\030\002 \001(\t\022\014\n\004name\030\003 \001(\t\022\'\n\010settings\030\004"
+  " \001(\0132\025.protocol.ObjectValue\022\016\n\006handle\030\006 "
+  "\001(\r\022\030\n\020container_handle\030\007 \001(\r\022\036\n\005style\030\010"
+  " \001(\0132\017.protocol.Style\"y\n\014UpdateSource\022\013\n"
+  "\003uid\030\002 \001(\t\022,\n\rchanged_props\030\003 \001(\0132\025.prot"
+  "ocol.ObjectValue\022\016\n\006handle\030\004 \001(\r\022\036\n\005styl"
+  "e\030\005 \001(\0132\017.protocol.Style\"\257\001\n\013CreateScene"
+  "\022\013\n\003uid\030\001 \001(\t\022\025\n\rcontainer_uid\030\004 \001(\t\022\014\n\004"
+  "name\030\002 \001(\t\022$\n\005props\030\003 \001(\0132\025.protocol.Obj"
+  "ectValue\022\016\n\006handle\030\005 \001(\r\022\030\n\020container_ha"
+  "ndle\030\006 \001(\r\022\036\n\005style\030\007 \001(\0132\017.protocol.Sty"
+  "le\"a\n\013AppendChild\022\022\n\nparent_uid\030\001 \001(\t\022\021\n"
+  "\tchild_uid\030\002 \001(\t\022\025\n\rparent_handle\030\003 \001(\r\022"
+  "\024\n\014child_handle\030\004 \001(\r\"a\n\013RemoveChild\022\022\n\n"
+  "parent_uid\030\001 \001(\t\022\021\n\tchild_uid\030\002 \001(\t\022\025\n\rp"
+  "arent_handle\030\003 \001(\r\022\024\n\014child_handle\030\004 \001(\r"
+  "\"F\n\nCreateTree\022\025\n\rparent_handle\030\001 \001(\r\022!\n"
+  "\005roots\030\002 \003(\0132\022.protocol.TreeNode\"\212\001\n\010Tre"
+  "eNode\022(\n\006source\030\001 \001(\0132\026.protocol.CreateS"
+  "ourceH\000\022&\n\005scene\030\002 \001(\0132\025.protocol.Create"
+  "SceneH\000\022$\n\010children\030\003 \003(\0132\022.protocol.Tre"
+  "eNodeB\006\n\004node\"R\n\014InsertBefore\022\025\n\rparent_"
+  "handle\030\001 \001(\r\022\024\n\014child_handle\030\002 \001(\r\022\025\n\rbe"
+  "fore_handle\030\003 \001(\r\"O\n\tMoveChild\022\025\n\rparent"
+  "_handle\030\001 \001(\r\022\024\n\014child_handle\030\002 \001(\r\022\025\n\rb"
+  "efore_handle\030\003 \001(\r\"@\n\rCommitUpdates\022\025\n\rc"
+  "ontainer_uid\030\001 \001(\t\022\030\n\020container_handle\030\002"
+  " \001(\r\"$\n\tDefineKey\022\n\n\002id\030\001 \001(\r\022\013\n\003key\030\002 \001"
+  "(\t\")\n\014DefineString\022\n\n\002id\030\001 \001(\r\022\r\n\005value\030"
+  "\002 \001(\t\"\216\n\n\005Style\022\017\n\007present\030\001 \001(\004\022\r\n\005patc"
+  "h\030\" \001(\010\022\r\n\005unset\030# \001(\004\022/\n\016flex_direction"
+  "\030\002 \001(\0162\027.protocol.FlexDirection\022&\n\tdirec"
+  "tion\030\003 \001(\0162\023.protocol.Direction\022*\n\017justi"
+  "fy_content\030\004 \001(\0162\021.protocol.Justify\022&\n\ra"
+  "lign_content\030\005 \001(\0162\017.protocol.Align\022$\n\013a"
+  "lign_items\030\006 \001(\0162\017.protocol.Align\022#\n\nali"
+  "gn_self\030\007 \001(\0162\017.protocol.Align\022(\n\010positi"
+  "on\030\010 \001(\0162\026.protocol.PositionType\022!\n\tflex"
+  "_wrap\030\t \001(\0162\016.protocol.Wrap\022$\n\010overflow\030"
+  "\n \001(\0162\022.protocol.Overflow\022\"\n\007display\030\013 \001"
+  "(\0162\021.protocol.Display\022\021\n\tflex_grow\030\014 \001(\002"
+  "\022\023\n\013flex_shrink\030\r \001(\002\022\'\n\nflex_basis\030\016 \001("
+  "\0132\023.protocol.Dimension\022 \n\003top\030\017 \001(\0132\023.pr"
+  "otocol.Dimension\022!\n\004left\030\020 \001(\0132\023.protoco"
+  "l.Dimension\022\"\n\005right\030\021 \001(\0132\023.protocol.Di"
+  "mension\022#\n\006bottom\030\022 \001(\0132\023.protocol.Dimen"
+  "sion\022\'\n\nmargin_top\030\023 \001(\0132\023.protocol.Dime"
+  "nsion\022(\n\013margin_left\030\024 \001(\0132\023.protocol.Di"
+  "mension\022)\n\014margin_right\030\025 \001(\0132\023.protocol"
+  ".Dimension\022*\n\rmargin_bottom\030\026 \001(\0132\023.prot"
+  "ocol.Dimension\022(\n\013padding_top\030\027 \001(\0132\023.pr"
+  "otocol.Dimension\022)\n\014padding_left\030\030 \001(\0132\023"
+  ".protocol.Dimension\022*\n\rpadding_right\030\031 \001"
+  "(\0132\023.protocol.Dimension\022+\n\016padding_botto"
+  "m\030\032 \001(\0132\023.protocol.Dimension\022\024\n\014aspect_r"
+  "atio\030\033 \001(\002\022\"\n\005width\030\034 \001(\0132\023.protocol.Dim"
+  "ension\022#\n\006height\030\035 \001(\0132\023.protocol.Dimens"
+  "ion\022&\n\tmin_width\030\036 \001(\0132\023.protocol.Dimens"
+  "ion\022&\n\tmax_width\030\037 \001(\0132\023.protocol.Dimens"
+  "ion\022\'\n\nmin_height\030  \001(\0132\023.protocol.Dimen"
+  "sion\022\'\n\nmax_height\030! \001(\0132\023.protocol.Dime"
+  "nsion\022\017\n\007z_index\030$ \001(\005\"D\n\017SetLayoutValue"
+  "s\022\017\n\007handles\030\001 \003(\r\022\020\n\010prop_ids\030\002 \003(\r\022\016\n\006"
+  "values\030\003 \003(\002\"8\n\tDimension\022\r\n\005value\030\001 \001(\002"
+  "\022\034\n\004unit\030\002 \001(\0162\016.protocol.Unit\"\337\001\n\004Prop\022"
+  "\013\n\003key\030\001 \001(\t\022\016\n\006key_id\030\010 \001(\r\022\026\n\014string_v"
+  "alue\030\002 \001(\tH\000\022\023\n\tint_value\030\003 \001(\003H\000\022\025\n\013flo"
+  "at_value\030\004 \001(\001H\000\022\024\n\nbool_value\030\005 \001(\010H\000\022-"
+  "\n\014object_value\030\006 \001(\0132\025.protocol.ObjectVa"
+  "lueH\000\022\023\n\tundefined\030\007 \001(\010H\000\022\023\n\tstring_id\030"
+  "\t \001(\rH\000B\007\n\005value\",\n\013ObjectValue\022\035\n\005props"
+  "\030\001 \003(\0132\016.protocol.Prop*<\n\013Compression\022\024\n"
+  "\020COMPRESSION_NONE\020\000\022\027\n\023COMPRESSION_DEFLA"
+  "TE\020\001*E\n\020LayoutValueFlags\022\026\n\022LAYOUT_VALUE"
+  "_POINT\020\000\022\031\n\024LAYOUT_VALUE_PERCENT\020\200\002*7\n\004U"
+  "nit\022\016\n\nUNIT_POINT\020\000\022\020\n\014UNIT_PERCENT\020\001\022\r\n"
+  "\tUNIT_AUTO\020\002*\205\001\n\rFlexDirection\022\031\n\025FLEX_D"
+  "IRECTION_COLUMN\020\000\022!\n\035FLEX_DIRECTION_COLU"
+  "MN_REVERSE\020\001\022\026\n\022FLEX_DIRECTION_ROW\020\002\022\036\n\032"
+  "FLEX_DIRECTION_ROW_REVERSE\020\003*H\n\tDirectio"
+  "n\022\025\n\021DIRECTION_INHERIT\020\000\022\021\n\rDIRECTION_LT"
+  "R\020\001\022\021\n\rDIRECTION_RTL\020\002*\232\001\n\007Justify\022\026\n\022JU"
+  "STIFY_FLEX_START\020\000\022\022\n\016JUSTIFY_CENTER\020\001\022\024"
+  "\n\020JUSTIFY_FLEX_END\020\002\022\031\n\025JUSTIFY_SPACE_BE"
+  "TWEEN\020\003\022\030\n\024JUSTIFY_SPACE_AROUND\020\004\022\030\n\024JUS"
+  "TIFY_SPACE_EVENLY\020\005*\253\001\n\005Align\022\016\n\nALIGN_A"
+  "UTO\020\000\022\024\n\020ALIGN_FLEX_START\020\001\022\020\n\014ALIGN_CEN"
+  "TER\020\002\022\022\n\016ALIGN_FLEX_END\020\003\022\021\n\rALIGN_STRET"
+  "CH\020\004\022\022\n\016ALIGN_BASELINE\020\005\022\027\n\023ALIGN_SPACE_"
+  "BETWEEN\020\006\022\026\n\022ALIGN_SPACE_AROUND\020\007*`\n\014Pos"
+  "itionType\022\030\n\024POSITION_TYPE_STATIC\020\000\022\032\n\026P"
+  "OSITION_TYPE_RELATIVE\020\001\022\032\n\026POSITION_TYPE"
+  "_ABSOLUTE\020\002*>\n\004Wrap\022\020\n\014WRAP_NO_WRAP\020\000\022\r\n"
+  "\tWRAP_WRAP\020\001\022\025\n\021WRAP_WRAP_REVERSE\020\002*J\n\010O"
+  "verflow\022\024\n\020OVERFLOW_VISIBLE\020\000\022\023\n\017OVERFLO"
+  "W_HIDDEN\020\001\022\023\n\017OVERFLOW_SCROLL\020\002*-\n\007Displ"
+  "ay\022\020\n\014DISPLAY_FLEX\020\000\022\020\n\014DISPLAY_NONE\020\001b\006"
+  "proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_protocol_2eproto_deps[1] = {
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_protocol_2eproto_sccs[14] = {
-  &scc_info_AppendChild_protocol_2eproto.base,
-  &scc_info_ApplyUpdate_protocol_2eproto.base,
-  &scc_info_ClientMessage_protocol_2eproto.base,
-  &scc_info_CommitUpdates_protocol_2eproto.base,
-  &scc_info_CreateScene_protocol_2eproto.base,
-  &scc_info_CreateSource_protocol_2eproto.base,
-  &scc_info_FindSourceRequest_protocol_2eproto.base,
-  &scc_info_InitRequest_protocol_2eproto.base,
-  &scc_info_ObjectValue_protocol_2eproto.base,
-  &scc_info_RemoveChild_protocol_2eproto.base,
-  &scc_info_Response_protocol_2eproto.base,
-  &scc_info_Scene_protocol_2eproto.base,
-  &scc_info_ServerMessage_protocol_2eproto.base,
-  &scc_info_UpdateSource_protocol_2eproto.base,
-};
-static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_protocol_2eproto_once;
-const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_protocol_2eproto = {
-  false, false, descriptor_table_protodef_protocol_2eproto, "protocol.proto", 1467,
-  &descriptor_table_protocol_2eproto_once, descriptor_table_protocol_2eproto_sccs, descriptor_table_protocol_2eproto_deps, 14, 0,
-  schemas, file_default_instances, TableStruct_protocol_2eproto::offsets,
-  file_level_metadata_protocol_2eproto, 15, file_level_enum_descriptors_protocol_2eproto, file_level_service_descriptors_protocol_2eproto,
+static ::_pbi::once_flag descriptor_table_protocol_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_protocol_2eproto = {
+    false, false, 5606, descriptor_table_protodef_protocol_2eproto,
+    "protocol.proto",
+    &descriptor_table_protocol_2eproto_once, nullptr, 0, 28,
+    schemas, file_default_instances, TableStruct_protocol_2eproto::offsets,
+    file_level_metadata_protocol_2eproto, file_level_enum_descriptors_protocol_2eproto,
+    file_level_service_descriptors_protocol_2eproto,
 };
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_protocol_2eproto_getter() {
+  return &descriptor_table_protocol_2eproto;
+}
 
 // Force running AddDescriptors() at dynamic initialization time.
-static bool dynamic_init_dummy_protocol_2eproto = (static_cast<void>(::PROTOBUF_NAMESPACE_ID::internal::AddDescriptors(&descriptor_table_protocol_2eproto)), true);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_protocol_2eproto(&descriptor_table_protocol_2eproto);
 namespace protocol {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Compression_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[0];
+}
+bool Compression_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
 
-// ===================================================================
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LayoutValueFlags_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[1];
+}
+bool LayoutValueFlags_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 256:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Unit_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[2];
+}
+bool Unit_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FlexDirection_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[3];
+}
+bool FlexDirection_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Direction_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[4];
+}
+bool Direction_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Justify_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[5];
+}
+bool Justify_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Align_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[6];
+}
+bool Align_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PositionType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[7];
+}
+bool PositionType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Wrap_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[8];
+}
+bool Wrap_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Overflow_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[9];
+}
+bool Overflow_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
 
-void ClientMessage::InitAsDefaultInstance() {
-  ::protocol::_ClientMessage_default_instance_.init_request_ = const_cast< ::protocol::InitRequest*>(
-      ::protocol::InitRequest::internal_default_instance());
-  ::protocol::_ClientMessage_default_instance_.apply_update_ = const_cast< ::protocol::ApplyUpdate*>(
-      ::protocol::ApplyUpdate::internal_default_instance());
-  ::protocol::_ClientMessage_default_instance_.find_source_ = const_cast< ::protocol::FindSourceRequest*>(
-      ::protocol::FindSourceRequest::internal_default_instance());
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Display_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_protocol_2eproto);
+  return file_level_enum_descriptors_protocol_2eproto[10];
+}
+bool Display_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
 }
+
+
+// ===================================================================
+
 class ClientMessage::_Internal {
  public:
   static const ::protocol::InitRequest& init_request(const ClientMessage* msg);
   static const ::protocol::ApplyUpdate& apply_update(const ClientMessage* msg);
   static const ::protocol::FindSourceRequest& find_source(const ClientMessage* msg);
+  static const ::protocol::UpdateBatch& update_batch(const ClientMessage* msg);
 };
 
 const ::protocol::InitRequest&
 ClientMessage::_Internal::init_request(const ClientMessage* msg) {
-  return *msg->message_.init_request_;
+  return *msg->_impl_.message_.init_request_;
 }
 const ::protocol::ApplyUpdate&
 ClientMessage::_Internal::apply_update(const ClientMessage* msg) {
-  return *msg->message_.apply_update_;
+  return *msg->_impl_.message_.apply_update_;
 }
 const ::protocol::FindSourceRequest&
 ClientMessage::_Internal::find_source(const ClientMessage* msg) {
-  return *msg->message_.find_source_;
+  return *msg->_impl_.message_.find_source_;
+}
+const ::protocol::UpdateBatch&
+ClientMessage::_Internal::update_batch(const ClientMessage* msg) {
+  return *msg->_impl_.message_.update_batch_;
 }
 void ClientMessage::set_allocated_init_request(::protocol::InitRequest* init_request) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message();
   if (init_request) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(init_request);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(init_request);
     if (message_arena != submessage_arena) {
       init_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, init_request, submessage_arena);
     }
     set_has_init_request();
-    message_.init_request_ = init_request;
+    _impl_.message_.init_request_ = init_request;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ClientMessage.init_request)
 }
 void ClientMessage::set_allocated_apply_update(::protocol::ApplyUpdate* apply_update) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message();
   if (apply_update) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(apply_update);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(apply_update);
     if (message_arena != submessage_arena) {
       apply_update = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, apply_update, submessage_arena);
     }
     set_has_apply_update();
-    message_.apply_update_ = apply_update;
+    _impl_.message_.apply_update_ = apply_update;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ClientMessage.apply_update)
 }
 void ClientMessage::set_allocated_find_source(::protocol::FindSourceRequest* find_source) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message();
   if (find_source) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(find_source);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(find_source);
     if (message_arena != submessage_arena) {
       find_source = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, find_source, submessage_arena);
     }
     set_has_find_source();
-    message_.find_source_ = find_source;
+    _impl_.message_.find_source_ = find_source;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ClientMessage.find_source)
 }
-ClientMessage::ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+void ClientMessage::set_allocated_update_batch(::protocol::UpdateBatch* update_batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_message();
+  if (update_batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update_batch);
+    if (message_arena != submessage_arena) {
+      update_batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, update_batch, submessage_arena);
+    }
+    set_has_update_batch();
+    _impl_.message_.update_batch_ = update_batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ClientMessage.update_batch)
+}
+ClientMessage::ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:protocol.ClientMessage)
 }
 ClientMessage::ClientMessage(const ClientMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClientMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_message();
   switch (from.message_case()) {
     case kInitRequest: {
-      _internal_mutable_init_request()->::protocol::InitRequest::MergeFrom(from._internal_init_request());
+      _this->_internal_mutable_init_request()->::protocol::InitRequest::MergeFrom(
+          from._internal_init_request());
       break;
     }
     case kApplyUpdate: {
-      _internal_mutable_apply_update()->::protocol::ApplyUpdate::MergeFrom(from._internal_apply_update());
+      _this->_internal_mutable_apply_update()->::protocol::ApplyUpdate::MergeFrom(
+          from._internal_apply_update());
       break;
     }
     case kFindSource: {
-      _internal_mutable_find_source()->::protocol::FindSourceRequest::MergeFrom(from._internal_find_source());
+      _this->_internal_mutable_find_source()->::protocol::FindSourceRequest::MergeFrom(
+          from._internal_find_source());
+      break;
+    }
+    case kUpdateBatch: {
+      _this->_internal_mutable_update_batch()->::protocol::UpdateBatch::MergeFrom(
+          from._internal_update_batch());
       break;
     }
     case MESSAGE_NOT_SET: {
@@ -654,57 +1315,62 @@ ClientMessage::ClientMessage(const ClientMessage& from)
   // @@protoc_insertion_point(copy_constructor:protocol.ClientMessage)
 }
 
-void ClientMessage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ClientMessage_protocol_2eproto.base);
+inline void ClientMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_message();
 }
 
 ClientMessage::~ClientMessage() {
   // @@protoc_insertion_point(destructor:protocol.ClientMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ClientMessage::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ClientMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_message()) {
     clear_message();
   }
 }
 
-void ClientMessage::ArenaDtor(void* object) {
-  ClientMessage* _this = reinterpret_cast< ClientMessage* >(object);
-  (void)_this;
-}
-void ClientMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ClientMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ClientMessage& ClientMessage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ClientMessage_protocol_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ClientMessage::clear_message() {
 // @@protoc_insertion_point(one_of_clear_start:protocol.ClientMessage)
   switch (message_case()) {
     case kInitRequest: {
-      if (GetArena() == nullptr) {
-        delete message_.init_request_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_.init_request_;
       }
       break;
     }
     case kApplyUpdate: {
-      if (GetArena() == nullptr) {
-        delete message_.apply_update_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_.apply_update_;
       }
       break;
     }
     case kFindSource: {
-      if (GetArena() == nullptr) {
-        delete message_.find_source_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_.find_source_;
+      }
+      break;
+    }
+    case kUpdateBatch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_.update_batch_;
       }
       break;
     }
@@ -712,13 +1378,13 @@ void ClientMessage::clear_message() {
       break;
     }
   }
-  _oneof_case_[0] = MESSAGE_NOT_SET;
+  _impl_._oneof_case_[0] = MESSAGE_NOT_SET;
 }
 
 
 void ClientMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:protocol.ClientMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -726,89 +1392,103 @@ void ClientMessage::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClientMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ClientMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .protocol.InitRequest init_request = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_init_request(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .protocol.ApplyUpdate apply_update = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_apply_update(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .protocol.FindSourceRequest find_source = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_find_source(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .protocol.UpdateBatch update_batch = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_update_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ClientMessage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ClientMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:protocol.ClientMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .protocol.InitRequest init_request = 1;
   if (_internal_has_init_request()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::init_request(this), target, stream);
+      InternalWriteMessage(1, _Internal::init_request(this),
+        _Internal::init_request(this).GetCachedSize(), target, stream);
   }
 
   // .protocol.ApplyUpdate apply_update = 2;
   if (_internal_has_apply_update()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::apply_update(this), target, stream);
+      InternalWriteMessage(2, _Internal::apply_update(this),
+        _Internal::apply_update(this).GetCachedSize(), target, stream);
   }
 
   // .protocol.FindSourceRequest find_source = 3;
   if (_internal_has_find_source()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::find_source(this), target, stream);
+      InternalWriteMessage(3, _Internal::find_source(this),
+        _Internal::find_source(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.UpdateBatch update_batch = 4;
+  if (_internal_has_update_batch()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::update_batch(this),
+        _Internal::update_batch(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:protocol.ClientMessage)
@@ -819,7 +1499,7 @@ size_t ClientMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:protocol.ClientMessage)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -828,82 +1508,78 @@ size_t ClientMessage::ByteSizeLong() const {
     case kInitRequest: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_.init_request_);
+          *_impl_.message_.init_request_);
       break;
     }
     // .protocol.ApplyUpdate apply_update = 2;
     case kApplyUpdate: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_.apply_update_);
+          *_impl_.message_.apply_update_);
       break;
     }
     // .protocol.FindSourceRequest find_source = 3;
     case kFindSource: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_.find_source_);
+          *_impl_.message_.find_source_);
+      break;
+    }
+    // .protocol.UpdateBatch update_batch = 4;
+    case kUpdateBatch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_.update_batch_);
       break;
     }
     case MESSAGE_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ClientMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.ClientMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ClientMessage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ClientMessage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ClientMessage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ClientMessage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClientMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientMessage::GetClassData() const { return &_class_data_; }
 
-void ClientMessage::MergeFrom(const ClientMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ClientMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ClientMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClientMessage*>(&to_msg);
+  auto& from = static_cast<const ClientMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.ClientMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.message_case()) {
     case kInitRequest: {
-      _internal_mutable_init_request()->::protocol::InitRequest::MergeFrom(from._internal_init_request());
+      _this->_internal_mutable_init_request()->::protocol::InitRequest::MergeFrom(
+          from._internal_init_request());
       break;
     }
     case kApplyUpdate: {
-      _internal_mutable_apply_update()->::protocol::ApplyUpdate::MergeFrom(from._internal_apply_update());
+      _this->_internal_mutable_apply_update()->::protocol::ApplyUpdate::MergeFrom(
+          from._internal_apply_update());
       break;
     }
     case kFindSource: {
-      _internal_mutable_find_source()->::protocol::FindSourceRequest::MergeFrom(from._internal_find_source());
+      _this->_internal_mutable_find_source()->::protocol::FindSourceRequest::MergeFrom(
+          from._internal_find_source());
+      break;
+    }
+    case kUpdateBatch: {
+      _this->_internal_mutable_update_batch()->::protocol::UpdateBatch::MergeFrom(
+          from._internal_update_batch());
       break;
     }
     case MESSAGE_NOT_SET: {
       break;
     }
   }
-}
-
-void ClientMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.ClientMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ClientMessage::CopyFrom(const ClientMessage& from) {
@@ -919,59 +1595,88 @@ bool ClientMessage::IsInitialized() const {
 
 void ClientMessage::InternalSwap(ClientMessage* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(message_, other->message_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.message_, other->_impl_.message_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ClientMessage::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void ServerMessage::InitAsDefaultInstance() {
-  ::protocol::_ServerMessage_default_instance_.response_ = const_cast< ::protocol::Response*>(
-      ::protocol::Response::internal_default_instance());
-}
 class ServerMessage::_Internal {
  public:
   static const ::protocol::Response& response(const ServerMessage* msg);
+  static const ::protocol::UpdateCredits& update_credits(const ServerMessage* msg);
 };
 
 const ::protocol::Response&
 ServerMessage::_Internal::response(const ServerMessage* msg) {
-  return *msg->message_.response_;
+  return *msg->_impl_.message_.response_;
+}
+const ::protocol::UpdateCredits&
+ServerMessage::_Internal::update_credits(const ServerMessage* msg) {
+  return *msg->_impl_.message_.update_credits_;
 }
 void ServerMessage::set_allocated_response(::protocol::Response* response) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_message();
   if (response) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(response);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(response);
     if (message_arena != submessage_arena) {
       response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, response, submessage_arena);
     }
     set_has_response();
-    message_.response_ = response;
+    _impl_.message_.response_ = response;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ServerMessage.response)
 }
-ServerMessage::ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+void ServerMessage::set_allocated_update_credits(::protocol::UpdateCredits* update_credits) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_message();
+  if (update_credits) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update_credits);
+    if (message_arena != submessage_arena) {
+      update_credits = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, update_credits, submessage_arena);
+    }
+    set_has_update_credits();
+    _impl_.message_.update_credits_ = update_credits;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ServerMessage.update_credits)
+}
+ServerMessage::ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:protocol.ServerMessage)
 }
 ServerMessage::ServerMessage(const ServerMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_message();
   switch (from.message_case()) {
     case kResponse: {
-      _internal_mutable_response()->::protocol::Response::MergeFrom(from._internal_response());
+      _this->_internal_mutable_response()->::protocol::Response::MergeFrom(
+          from._internal_response());
+      break;
+    }
+    case kUpdateCredits: {
+      _this->_internal_mutable_update_credits()->::protocol::UpdateCredits::MergeFrom(
+          from._internal_update_credits());
       break;
     }
     case MESSAGE_NOT_SET: {
@@ -981,45 +1686,50 @@ ServerMessage::ServerMessage(const ServerMessage& from)
   // @@protoc_insertion_point(copy_constructor:protocol.ServerMessage)
 }
 
-void ServerMessage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ServerMessage_protocol_2eproto.base);
+inline void ServerMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_message();
 }
 
 ServerMessage::~ServerMessage() {
   // @@protoc_insertion_point(destructor:protocol.ServerMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ServerMessage::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ServerMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_message()) {
     clear_message();
   }
 }
 
-void ServerMessage::ArenaDtor(void* object) {
-  ServerMessage* _this = reinterpret_cast< ServerMessage* >(object);
-  (void)_this;
-}
-void ServerMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ServerMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ServerMessage& ServerMessage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ServerMessage_protocol_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ServerMessage::clear_message() {
 // @@protoc_insertion_point(one_of_clear_start:protocol.ServerMessage)
   switch (message_case()) {
     case kResponse: {
-      if (GetArena() == nullptr) {
-        delete message_.response_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_.response_;
+      }
+      break;
+    }
+    case kUpdateCredits: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.message_.update_credits_;
       }
       break;
     }
@@ -1027,13 +1737,13 @@ void ServerMessage::clear_message() {
       break;
     }
   }
-  _oneof_case_[0] = MESSAGE_NOT_SET;
+  _impl_._oneof_case_[0] = MESSAGE_NOT_SET;
 }
 
 
 void ServerMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:protocol.ServerMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -1041,59 +1751,73 @@ void ServerMessage::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ServerMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ServerMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .protocol.Response response = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_response(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .protocol.UpdateCredits update_credits = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_update_credits(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ServerMessage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ServerMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:protocol.ServerMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .protocol.Response response = 1;
   if (_internal_has_response()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::response(this), target, stream);
+      InternalWriteMessage(1, _Internal::response(this),
+        _Internal::response(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.UpdateCredits update_credits = 2;
+  if (_internal_has_update_credits()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::update_credits(this),
+        _Internal::update_credits(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:protocol.ServerMessage)
@@ -1104,7 +1828,7 @@ size_t ServerMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:protocol.ServerMessage)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -1113,60 +1837,54 @@ size_t ServerMessage::ByteSizeLong() const {
     case kResponse: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *message_.response_);
+          *_impl_.message_.response_);
+      break;
+    }
+    // .protocol.UpdateCredits update_credits = 2;
+    case kUpdateCredits: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_.update_credits_);
       break;
     }
     case MESSAGE_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ServerMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.ServerMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ServerMessage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ServerMessage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ServerMessage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ServerMessage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerMessage::GetClassData() const { return &_class_data_; }
 
-void ServerMessage::MergeFrom(const ServerMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ServerMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ServerMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerMessage*>(&to_msg);
+  auto& from = static_cast<const ServerMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.ServerMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.message_case()) {
     case kResponse: {
-      _internal_mutable_response()->::protocol::Response::MergeFrom(from._internal_response());
+      _this->_internal_mutable_response()->::protocol::Response::MergeFrom(
+          from._internal_response());
+      break;
+    }
+    case kUpdateCredits: {
+      _this->_internal_mutable_update_credits()->::protocol::UpdateCredits::MergeFrom(
+          from._internal_update_credits());
       break;
     }
     case MESSAGE_NOT_SET: {
       break;
     }
   }
-}
-
-void ServerMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.ServerMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ServerMessage::CopyFrom(const ServerMessage& from) {
@@ -1182,146 +1900,200 @@ bool ServerMessage::IsInitialized() const {
 
 void ServerMessage::InternalSwap(ServerMessage* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(message_, other->message_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.message_, other->_impl_.message_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ServerMessage::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void InitRequest::InitAsDefaultInstance() {
-}
 class InitRequest::_Internal {
  public:
 };
 
-InitRequest::InitRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+InitRequest::InitRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:protocol.InitRequest)
 }
 InitRequest::InitRequest(const InitRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InitRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_id_){}
+    , decltype(_impl_.client_id_){}
+    , decltype(_impl_.shared_memory_ring_size_){}
+    , decltype(_impl_.flow_control_){}
+    , decltype(_impl_.compression_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  request_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.request_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_request_id().empty()) {
-    request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_request_id(),
-      GetArena());
+    _this->_impl_.request_id_.Set(from._internal_request_id(), 
+      _this->GetArenaForAllocation());
   }
-  client_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.client_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.client_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_client_id().empty()) {
-    client_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_client_id(),
-      GetArena());
+    _this->_impl_.client_id_.Set(from._internal_client_id(), 
+      _this->GetArenaForAllocation());
   }
+  ::memcpy(&_impl_.shared_memory_ring_size_, &from._impl_.shared_memory_ring_size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compression_) -
+    reinterpret_cast<char*>(&_impl_.shared_memory_ring_size_)) + sizeof(_impl_.compression_));
   // @@protoc_insertion_point(copy_constructor:protocol.InitRequest)
 }
 
-void InitRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_InitRequest_protocol_2eproto.base);
-  request_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  client_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void InitRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_id_){}
+    , decltype(_impl_.client_id_){}
+    , decltype(_impl_.shared_memory_ring_size_){0u}
+    , decltype(_impl_.flow_control_){false}
+    , decltype(_impl_.compression_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.request_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.client_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.client_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 InitRequest::~InitRequest() {
   // @@protoc_insertion_point(destructor:protocol.InitRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void InitRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  request_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  client_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void InitRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.request_id_.Destroy();
+  _impl_.client_id_.Destroy();
 }
 
-void InitRequest::ArenaDtor(void* object) {
-  InitRequest* _this = reinterpret_cast< InitRequest* >(object);
-  (void)_this;
-}
-void InitRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void InitRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const InitRequest& InitRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_InitRequest_protocol_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void InitRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:protocol.InitRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  request_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  client_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.request_id_.ClearToEmpty();
+  _impl_.client_id_.ClearToEmpty();
+  ::memset(&_impl_.shared_memory_ring_size_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compression_) -
+      reinterpret_cast<char*>(&_impl_.shared_memory_ring_size_)) + sizeof(_impl_.compression_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* InitRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* InitRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string request_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_request_id();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.InitRequest.request_id"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.InitRequest.request_id"));
+        } else
+          goto handle_unusual;
         continue;
       // string client_id = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_client_id();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.InitRequest.client_id"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.InitRequest.client_id"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint32 shared_memory_ring_size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.shared_memory_ring_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool flow_control = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.flow_control_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Compression compression = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_compression(static_cast<::protocol::Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* InitRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* InitRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:protocol.InitRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string request_id = 1;
-  if (this->request_id().size() > 0) {
+  if (!this->_internal_request_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_request_id().data(), static_cast<int>(this->_internal_request_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1331,7 +2103,7 @@ failure:
   }
 
   // string client_id = 2;
-  if (this->client_id().size() > 0) {
+  if (!this->_internal_client_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_client_id().data(), static_cast<int>(this->_internal_client_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1340,8 +2112,27 @@ failure:
         2, this->_internal_client_id(), target);
   }
 
+  // uint32 shared_memory_ring_size = 3;
+  if (this->_internal_shared_memory_ring_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_shared_memory_ring_size(), target);
+  }
+
+  // bool flow_control = 4;
+  if (this->_internal_flow_control() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_flow_control(), target);
+  }
+
+  // .protocol.Compression compression = 5;
+  if (this->_internal_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_compression(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:protocol.InitRequest)
@@ -1352,68 +2143,74 @@ size_t InitRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:protocol.InitRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string request_id = 1;
-  if (this->request_id().size() > 0) {
+  if (!this->_internal_request_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_request_id());
   }
 
   // string client_id = 2;
-  if (this->client_id().size() > 0) {
+  if (!this->_internal_client_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_client_id());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 shared_memory_ring_size = 3;
+  if (this->_internal_shared_memory_ring_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shared_memory_ring_size());
+  }
+
+  // bool flow_control = 4;
+  if (this->_internal_flow_control() != 0) {
+    total_size += 1 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void InitRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.InitRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const InitRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<InitRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.InitRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.InitRequest)
-    MergeFrom(*source);
+  // .protocol.Compression compression = 5;
+  if (this->_internal_compression() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_compression());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void InitRequest::MergeFrom(const InitRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.InitRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InitRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InitRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InitRequest::GetClassData() const { return &_class_data_; }
+
+
+void InitRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InitRequest*>(&to_msg);
+  auto& from = static_cast<const InitRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.InitRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.request_id().size() > 0) {
-    _internal_set_request_id(from._internal_request_id());
+  if (!from._internal_request_id().empty()) {
+    _this->_internal_set_request_id(from._internal_request_id());
   }
-  if (from.client_id().size() > 0) {
-    _internal_set_client_id(from._internal_client_id());
+  if (!from._internal_client_id().empty()) {
+    _this->_internal_set_client_id(from._internal_client_id());
   }
-}
-
-void InitRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.InitRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_shared_memory_ring_size() != 0) {
+    _this->_internal_set_shared_memory_ring_size(from._internal_shared_memory_ring_size());
+  }
+  if (from._internal_flow_control() != 0) {
+    _this->_internal_set_flow_control(from._internal_flow_control());
+  }
+  if (from._internal_compression() != 0) {
+    _this->_internal_set_compression(from._internal_compression());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void InitRequest::CopyFrom(const InitRequest& from) {
@@ -1429,129 +2226,151 @@ bool InitRequest::IsInitialized() const {
 
 void InitRequest::InternalSwap(InitRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  request_id_.Swap(&other->request_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  client_id_.Swap(&other->client_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.request_id_, lhs_arena,
+      &other->_impl_.request_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.client_id_, lhs_arena,
+      &other->_impl_.client_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InitRequest, _impl_.compression_)
+      + sizeof(InitRequest::_impl_.compression_)
+      - PROTOBUF_FIELD_OFFSET(InitRequest, _impl_.shared_memory_ring_size_)>(
+          reinterpret_cast<char*>(&_impl_.shared_memory_ring_size_),
+          reinterpret_cast<char*>(&other->_impl_.shared_memory_ring_size_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata InitRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void Scene::InitAsDefaultInstance() {
-}
 class Scene::_Internal {
  public:
 };
 
-Scene::Scene(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Scene::Scene(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:protocol.Scene)
 }
 Scene::Scene(const Scene& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Scene* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_name(),
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:protocol.Scene)
 }
 
-void Scene::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Scene_protocol_2eproto.base);
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Scene::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Scene::~Scene() {
   // @@protoc_insertion_point(destructor:protocol.Scene)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Scene::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Scene::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
 }
 
-void Scene::ArenaDtor(void* object) {
-  Scene* _this = reinterpret_cast< Scene* >(object);
-  (void)_this;
-}
-void Scene::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Scene::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Scene& Scene::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Scene_protocol_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Scene::Clear() {
 // @@protoc_insertion_point(message_clear_start:protocol.Scene)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.name_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Scene::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Scene::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string name = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.Scene.name"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.Scene.name"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Scene::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Scene::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:protocol.Scene)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -1561,7 +2380,7 @@ failure:
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:protocol.Scene)
@@ -1572,58 +2391,39 @@ size_t Scene::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:protocol.Scene)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string name = 1;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Scene::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.Scene)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Scene* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Scene>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.Scene)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.Scene)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Scene::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Scene::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Scene::GetClassData() const { return &_class_data_; }
 
-void Scene::MergeFrom(const Scene& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.Scene)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Scene::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Scene*>(&to_msg);
+  auto& from = static_cast<const Scene&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.Scene)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-}
-
-void Scene::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.Scene)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Scene::CopyFrom(const Scene& from) {
@@ -1639,31 +2439,23 @@ bool Scene::IsInitialized() const {
 
 void Scene::InternalSwap(Scene* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Scene::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void ApplyUpdate::InitAsDefaultInstance() {
-  ::protocol::_ApplyUpdate_default_instance_.create_source_ = const_cast< ::protocol::CreateSource*>(
-      ::protocol::CreateSource::internal_default_instance());
-  ::protocol::_ApplyUpdate_default_instance_.update_source_ = const_cast< ::protocol::UpdateSource*>(
-      ::protocol::UpdateSource::internal_default_instance());
-  ::protocol::_ApplyUpdate_default_instance_.create_scene_ = const_cast< ::protocol::CreateScene*>(
-      ::protocol::CreateScene::internal_default_instance());
-  ::protocol::_ApplyUpdate_default_instance_.append_child_ = const_cast< ::protocol::AppendChild*>(
-      ::protocol::AppendChild::internal_default_instance());
-  ::protocol::_ApplyUpdate_default_instance_.remove_child_ = const_cast< ::protocol::RemoveChild*>(
-      ::protocol::RemoveChild::internal_default_instance());
-  ::protocol::_ApplyUpdate_default_instance_.commit_updates_ = const_cast< ::protocol::CommitUpdates*>(
-      ::protocol::CommitUpdates::internal_default_instance());
-}
 class ApplyUpdate::_Internal {
  public:
   static const ::protocol::CreateSource& create_source(const ApplyUpdate* msg);
@@ -1672,155 +2464,317 @@ class ApplyUpdate::_Internal {
   static const ::protocol::AppendChild& append_child(const ApplyUpdate* msg);
   static const ::protocol::RemoveChild& remove_child(const ApplyUpdate* msg);
   static const ::protocol::CommitUpdates& commit_updates(const ApplyUpdate* msg);
+  static const ::protocol::DefineKey& define_key(const ApplyUpdate* msg);
+  static const ::protocol::DefineString& define_string(const ApplyUpdate* msg);
+  static const ::protocol::SetLayoutValues& set_layout_values(const ApplyUpdate* msg);
+  static const ::protocol::InsertBefore& insert_before(const ApplyUpdate* msg);
+  static const ::protocol::MoveChild& move_child(const ApplyUpdate* msg);
+  static const ::protocol::CreateTree& create_tree(const ApplyUpdate* msg);
 };
 
 const ::protocol::CreateSource&
 ApplyUpdate::_Internal::create_source(const ApplyUpdate* msg) {
-  return *msg->change_.create_source_;
+  return *msg->_impl_.change_.create_source_;
 }
 const ::protocol::UpdateSource&
 ApplyUpdate::_Internal::update_source(const ApplyUpdate* msg) {
-  return *msg->change_.update_source_;
+  return *msg->_impl_.change_.update_source_;
 }
 const ::protocol::CreateScene&
 ApplyUpdate::_Internal::create_scene(const ApplyUpdate* msg) {
-  return *msg->change_.create_scene_;
+  return *msg->_impl_.change_.create_scene_;
 }
 const ::protocol::AppendChild&
 ApplyUpdate::_Internal::append_child(const ApplyUpdate* msg) {
-  return *msg->change_.append_child_;
+  return *msg->_impl_.change_.append_child_;
 }
 const ::protocol::RemoveChild&
 ApplyUpdate::_Internal::remove_child(const ApplyUpdate* msg) {
-  return *msg->change_.remove_child_;
+  return *msg->_impl_.change_.remove_child_;
 }
 const ::protocol::CommitUpdates&
 ApplyUpdate::_Internal::commit_updates(const ApplyUpdate* msg) {
-  return *msg->change_.commit_updates_;
+  return *msg->_impl_.change_.commit_updates_;
+}
+const ::protocol::DefineKey&
+ApplyUpdate::_Internal::define_key(const ApplyUpdate* msg) {
+  return *msg->_impl_.change_.define_key_;
+}
+const ::protocol::DefineString&
+ApplyUpdate::_Internal::define_string(const ApplyUpdate* msg) {
+  return *msg->_impl_.change_.define_string_;
+}
+const ::protocol::SetLayoutValues&
+ApplyUpdate::_Internal::set_layout_values(const ApplyUpdate* msg) {
+  return *msg->_impl_.change_.set_layout_values_;
+}
+const ::protocol::InsertBefore&
+ApplyUpdate::_Internal::insert_before(const ApplyUpdate* msg) {
+  return *msg->_impl_.change_.insert_before_;
+}
+const ::protocol::MoveChild&
+ApplyUpdate::_Internal::move_child(const ApplyUpdate* msg) {
+  return *msg->_impl_.change_.move_child_;
+}
+const ::protocol::CreateTree&
+ApplyUpdate::_Internal::create_tree(const ApplyUpdate* msg) {
+  return *msg->_impl_.change_.create_tree_;
 }
 void ApplyUpdate::set_allocated_create_source(::protocol::CreateSource* create_source) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_change();
   if (create_source) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(create_source);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(create_source);
     if (message_arena != submessage_arena) {
       create_source = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, create_source, submessage_arena);
     }
     set_has_create_source();
-    change_.create_source_ = create_source;
+    _impl_.change_.create_source_ = create_source;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.create_source)
 }
 void ApplyUpdate::set_allocated_update_source(::protocol::UpdateSource* update_source) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_change();
   if (update_source) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(update_source);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update_source);
     if (message_arena != submessage_arena) {
       update_source = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, update_source, submessage_arena);
     }
     set_has_update_source();
-    change_.update_source_ = update_source;
+    _impl_.change_.update_source_ = update_source;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.update_source)
 }
 void ApplyUpdate::set_allocated_create_scene(::protocol::CreateScene* create_scene) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_change();
   if (create_scene) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(create_scene);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(create_scene);
     if (message_arena != submessage_arena) {
       create_scene = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, create_scene, submessage_arena);
     }
     set_has_create_scene();
-    change_.create_scene_ = create_scene;
+    _impl_.change_.create_scene_ = create_scene;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.create_scene)
 }
 void ApplyUpdate::set_allocated_append_child(::protocol::AppendChild* append_child) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_change();
   if (append_child) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(append_child);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(append_child);
     if (message_arena != submessage_arena) {
       append_child = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, append_child, submessage_arena);
     }
     set_has_append_child();
-    change_.append_child_ = append_child;
+    _impl_.change_.append_child_ = append_child;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.append_child)
 }
 void ApplyUpdate::set_allocated_remove_child(::protocol::RemoveChild* remove_child) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_change();
   if (remove_child) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(remove_child);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(remove_child);
     if (message_arena != submessage_arena) {
       remove_child = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, remove_child, submessage_arena);
     }
     set_has_remove_child();
-    change_.remove_child_ = remove_child;
+    _impl_.change_.remove_child_ = remove_child;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.remove_child)
 }
 void ApplyUpdate::set_allocated_commit_updates(::protocol::CommitUpdates* commit_updates) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_change();
   if (commit_updates) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(commit_updates);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(commit_updates);
     if (message_arena != submessage_arena) {
       commit_updates = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, commit_updates, submessage_arena);
     }
     set_has_commit_updates();
-    change_.commit_updates_ = commit_updates;
+    _impl_.change_.commit_updates_ = commit_updates;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.commit_updates)
 }
-ApplyUpdate::ApplyUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+void ApplyUpdate::set_allocated_define_key(::protocol::DefineKey* define_key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_change();
+  if (define_key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(define_key);
+    if (message_arena != submessage_arena) {
+      define_key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, define_key, submessage_arena);
+    }
+    set_has_define_key();
+    _impl_.change_.define_key_ = define_key;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.define_key)
+}
+void ApplyUpdate::set_allocated_define_string(::protocol::DefineString* define_string) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_change();
+  if (define_string) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(define_string);
+    if (message_arena != submessage_arena) {
+      define_string = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, define_string, submessage_arena);
+    }
+    set_has_define_string();
+    _impl_.change_.define_string_ = define_string;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.define_string)
+}
+void ApplyUpdate::set_allocated_set_layout_values(::protocol::SetLayoutValues* set_layout_values) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_change();
+  if (set_layout_values) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(set_layout_values);
+    if (message_arena != submessage_arena) {
+      set_layout_values = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, set_layout_values, submessage_arena);
+    }
+    set_has_set_layout_values();
+    _impl_.change_.set_layout_values_ = set_layout_values;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.set_layout_values)
+}
+void ApplyUpdate::set_allocated_insert_before(::protocol::InsertBefore* insert_before) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_change();
+  if (insert_before) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(insert_before);
+    if (message_arena != submessage_arena) {
+      insert_before = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, insert_before, submessage_arena);
+    }
+    set_has_insert_before();
+    _impl_.change_.insert_before_ = insert_before;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.insert_before)
+}
+void ApplyUpdate::set_allocated_move_child(::protocol::MoveChild* move_child) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_change();
+  if (move_child) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(move_child);
+    if (message_arena != submessage_arena) {
+      move_child = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, move_child, submessage_arena);
+    }
+    set_has_move_child();
+    _impl_.change_.move_child_ = move_child;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.move_child)
+}
+void ApplyUpdate::set_allocated_create_tree(::protocol::CreateTree* create_tree) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_change();
+  if (create_tree) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(create_tree);
+    if (message_arena != submessage_arena) {
+      create_tree = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, create_tree, submessage_arena);
+    }
+    set_has_create_tree();
+    _impl_.change_.create_tree_ = create_tree;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.ApplyUpdate.create_tree)
+}
+ApplyUpdate::ApplyUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:protocol.ApplyUpdate)
 }
 ApplyUpdate::ApplyUpdate(const ApplyUpdate& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ApplyUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.change_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   clear_has_change();
   switch (from.change_case()) {
     case kCreateSource: {
-      _internal_mutable_create_source()->::protocol::CreateSource::MergeFrom(from._internal_create_source());
+      _this->_internal_mutable_create_source()->::protocol::CreateSource::MergeFrom(
+          from._internal_create_source());
       break;
     }
     case kUpdateSource: {
-      _internal_mutable_update_source()->::protocol::UpdateSource::MergeFrom(from._internal_update_source());
+      _this->_internal_mutable_update_source()->::protocol::UpdateSource::MergeFrom(
+          from._internal_update_source());
       break;
     }
     case kCreateScene: {
-      _internal_mutable_create_scene()->::protocol::CreateScene::MergeFrom(from._internal_create_scene());
+      _this->_internal_mutable_create_scene()->::protocol::CreateScene::MergeFrom(
+          from._internal_create_scene());
       break;
     }
     case kAppendChild: {
-      _internal_mutable_append_child()->::protocol::AppendChild::MergeFrom(from._internal_append_child());
+      _this->_internal_mutable_append_child()->::protocol::AppendChild::MergeFrom(
+          from._internal_append_child());
       break;
     }
     case kRemoveChild: {
-      _internal_mutable_remove_child()->::protocol::RemoveChild::MergeFrom(from._internal_remove_child());
+      _this->_internal_mutable_remove_child()->::protocol::RemoveChild::MergeFrom(
+          from._internal_remove_child());
       break;
     }
     case kCommitUpdates: {
-      _internal_mutable_commit_updates()->::protocol::CommitUpdates::MergeFrom(from._internal_commit_updates());
+      _this->_internal_mutable_commit_updates()->::protocol::CommitUpdates::MergeFrom(
+          from._internal_commit_updates());
+      break;
+    }
+    case kDefineKey: {
+      _this->_internal_mutable_define_key()->::protocol::DefineKey::MergeFrom(
+          from._internal_define_key());
+      break;
+    }
+    case kDefineString: {
+      _this->_internal_mutable_define_string()->::protocol::DefineString::MergeFrom(
+          from._internal_define_string());
+      break;
+    }
+    case kSetLayoutValues: {
+      _this->_internal_mutable_set_layout_values()->::protocol::SetLayoutValues::MergeFrom(
+          from._internal_set_layout_values());
+      break;
+    }
+    case kInsertBefore: {
+      _this->_internal_mutable_insert_before()->::protocol::InsertBefore::MergeFrom(
+          from._internal_insert_before());
+      break;
+    }
+    case kMoveChild: {
+      _this->_internal_mutable_move_child()->::protocol::MoveChild::MergeFrom(
+          from._internal_move_child());
+      break;
+    }
+    case kCreateTree: {
+      _this->_internal_mutable_create_tree()->::protocol::CreateTree::MergeFrom(
+          from._internal_create_tree());
       break;
     }
     case CHANGE_NOT_SET: {
@@ -1830,75 +2784,110 @@ ApplyUpdate::ApplyUpdate(const ApplyUpdate& from)
   // @@protoc_insertion_point(copy_constructor:protocol.ApplyUpdate)
 }
 
-void ApplyUpdate::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ApplyUpdate_protocol_2eproto.base);
+inline void ApplyUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.change_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_change();
 }
 
 ApplyUpdate::~ApplyUpdate() {
   // @@protoc_insertion_point(destructor:protocol.ApplyUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ApplyUpdate::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ApplyUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_change()) {
     clear_change();
   }
 }
 
-void ApplyUpdate::ArenaDtor(void* object) {
-  ApplyUpdate* _this = reinterpret_cast< ApplyUpdate* >(object);
-  (void)_this;
-}
-void ApplyUpdate::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ApplyUpdate::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ApplyUpdate& ApplyUpdate::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ApplyUpdate_protocol_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void ApplyUpdate::clear_change() {
 // @@protoc_insertion_point(one_of_clear_start:protocol.ApplyUpdate)
   switch (change_case()) {
     case kCreateSource: {
-      if (GetArena() == nullptr) {
-        delete change_.create_source_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.create_source_;
       }
       break;
     }
     case kUpdateSource: {
-      if (GetArena() == nullptr) {
-        delete change_.update_source_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.update_source_;
       }
       break;
     }
     case kCreateScene: {
-      if (GetArena() == nullptr) {
-        delete change_.create_scene_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.create_scene_;
       }
       break;
     }
     case kAppendChild: {
-      if (GetArena() == nullptr) {
-        delete change_.append_child_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.append_child_;
       }
       break;
     }
     case kRemoveChild: {
-      if (GetArena() == nullptr) {
-        delete change_.remove_child_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.remove_child_;
       }
       break;
     }
     case kCommitUpdates: {
-      if (GetArena() == nullptr) {
-        delete change_.commit_updates_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.commit_updates_;
+      }
+      break;
+    }
+    case kDefineKey: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.define_key_;
+      }
+      break;
+    }
+    case kDefineString: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.define_string_;
+      }
+      break;
+    }
+    case kSetLayoutValues: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.set_layout_values_;
+      }
+      break;
+    }
+    case kInsertBefore: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.insert_before_;
+      }
+      break;
+    }
+    case kMoveChild: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.move_child_;
+      }
+      break;
+    }
+    case kCreateTree: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.change_.create_tree_;
       }
       break;
     }
@@ -1906,13 +2895,13 @@ void ApplyUpdate::clear_change() {
       break;
     }
   }
-  _oneof_case_[0] = CHANGE_NOT_SET;
+  _impl_._oneof_case_[0] = CHANGE_NOT_SET;
 }
 
 
 void ApplyUpdate::Clear() {
 // @@protoc_insertion_point(message_clear_start:protocol.ApplyUpdate)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -1920,134 +2909,223 @@ void ApplyUpdate::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ApplyUpdate::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ApplyUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // .protocol.CreateSource create_source = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ctx->ParseMessage(_internal_mutable_create_source(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .protocol.AppendChild append_child = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_append_child(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .protocol.UpdateSource update_source = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_update_source(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .protocol.RemoveChild remove_child = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr = ctx->ParseMessage(_internal_mutable_remove_child(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .protocol.CreateScene create_scene = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr = ctx->ParseMessage(_internal_mutable_create_scene(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .protocol.CommitUpdates commit_updates = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr = ctx->ParseMessage(_internal_mutable_commit_updates(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.DefineKey define_key = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_define_key(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .protocol.DefineString define_string = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_define_string(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // .protocol.SetLayoutValues set_layout_values = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_set_layout_values(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.InsertBefore insert_before = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_insert_before(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.MoveChild move_child = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_move_child(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.CreateTree create_tree = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_create_tree(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ApplyUpdate::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ApplyUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:protocol.ApplyUpdate)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .protocol.CreateSource create_source = 1;
   if (_internal_has_create_source()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::create_source(this), target, stream);
+      InternalWriteMessage(1, _Internal::create_source(this),
+        _Internal::create_source(this).GetCachedSize(), target, stream);
   }
 
   // .protocol.AppendChild append_child = 2;
   if (_internal_has_append_child()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::append_child(this), target, stream);
+      InternalWriteMessage(2, _Internal::append_child(this),
+        _Internal::append_child(this).GetCachedSize(), target, stream);
   }
 
   // .protocol.UpdateSource update_source = 3;
   if (_internal_has_update_source()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::update_source(this), target, stream);
+      InternalWriteMessage(3, _Internal::update_source(this),
+        _Internal::update_source(this).GetCachedSize(), target, stream);
   }
 
   // .protocol.RemoveChild remove_child = 4;
   if (_internal_has_remove_child()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::remove_child(this), target, stream);
+      InternalWriteMessage(4, _Internal::remove_child(this),
+        _Internal::remove_child(this).GetCachedSize(), target, stream);
   }
 
   // .protocol.CreateScene create_scene = 5;
   if (_internal_has_create_scene()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::create_scene(this), target, stream);
+      InternalWriteMessage(5, _Internal::create_scene(this),
+        _Internal::create_scene(this).GetCachedSize(), target, stream);
   }
 
   // .protocol.CommitUpdates commit_updates = 6;
   if (_internal_has_commit_updates()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::commit_updates(this), target, stream);
+      InternalWriteMessage(6, _Internal::commit_updates(this),
+        _Internal::commit_updates(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.DefineKey define_key = 7;
+  if (_internal_has_define_key()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::define_key(this),
+        _Internal::define_key(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.DefineString define_string = 8;
+  if (_internal_has_define_string()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::define_string(this),
+        _Internal::define_string(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.SetLayoutValues set_layout_values = 9;
+  if (_internal_has_set_layout_values()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::set_layout_values(this),
+        _Internal::set_layout_values(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.InsertBefore insert_before = 10;
+  if (_internal_has_insert_before()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::insert_before(this),
+        _Internal::insert_before(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.MoveChild move_child = 11;
+  if (_internal_has_move_child()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::move_child(this),
+        _Internal::move_child(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.CreateTree create_tree = 12;
+  if (_internal_has_create_tree()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::create_tree(this),
+        _Internal::create_tree(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:protocol.ApplyUpdate)
@@ -2058,7 +3136,7 @@ size_t ApplyUpdate::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:protocol.ApplyUpdate)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -2067,115 +3145,174 @@ size_t ApplyUpdate::ByteSizeLong() const {
     case kCreateSource: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *change_.create_source_);
+          *_impl_.change_.create_source_);
       break;
     }
     // .protocol.UpdateSource update_source = 3;
     case kUpdateSource: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *change_.update_source_);
+          *_impl_.change_.update_source_);
       break;
     }
     // .protocol.CreateScene create_scene = 5;
     case kCreateScene: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *change_.create_scene_);
+          *_impl_.change_.create_scene_);
       break;
     }
     // .protocol.AppendChild append_child = 2;
     case kAppendChild: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *change_.append_child_);
+          *_impl_.change_.append_child_);
       break;
     }
     // .protocol.RemoveChild remove_child = 4;
     case kRemoveChild: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *change_.remove_child_);
+          *_impl_.change_.remove_child_);
       break;
     }
     // .protocol.CommitUpdates commit_updates = 6;
     case kCommitUpdates: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *change_.commit_updates_);
+          *_impl_.change_.commit_updates_);
+      break;
+    }
+    // .protocol.DefineKey define_key = 7;
+    case kDefineKey: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.change_.define_key_);
+      break;
+    }
+    // .protocol.DefineString define_string = 8;
+    case kDefineString: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.change_.define_string_);
+      break;
+    }
+    // .protocol.SetLayoutValues set_layout_values = 9;
+    case kSetLayoutValues: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.change_.set_layout_values_);
+      break;
+    }
+    // .protocol.InsertBefore insert_before = 10;
+    case kInsertBefore: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.change_.insert_before_);
+      break;
+    }
+    // .protocol.MoveChild move_child = 11;
+    case kMoveChild: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.change_.move_child_);
+      break;
+    }
+    // .protocol.CreateTree create_tree = 12;
+    case kCreateTree: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.change_.create_tree_);
       break;
     }
     case CHANGE_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ApplyUpdate::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.ApplyUpdate)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ApplyUpdate* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ApplyUpdate>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ApplyUpdate)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ApplyUpdate)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ApplyUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ApplyUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ApplyUpdate::GetClassData() const { return &_class_data_; }
 
-void ApplyUpdate::MergeFrom(const ApplyUpdate& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ApplyUpdate)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void ApplyUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ApplyUpdate*>(&to_msg);
+  auto& from = static_cast<const ApplyUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.ApplyUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   switch (from.change_case()) {
     case kCreateSource: {
-      _internal_mutable_create_source()->::protocol::CreateSource::MergeFrom(from._internal_create_source());
+      _this->_internal_mutable_create_source()->::protocol::CreateSource::MergeFrom(
+          from._internal_create_source());
       break;
     }
     case kUpdateSource: {
-      _internal_mutable_update_source()->::protocol::UpdateSource::MergeFrom(from._internal_update_source());
+      _this->_internal_mutable_update_source()->::protocol::UpdateSource::MergeFrom(
+          from._internal_update_source());
       break;
     }
     case kCreateScene: {
-      _internal_mutable_create_scene()->::protocol::CreateScene::MergeFrom(from._internal_create_scene());
+      _this->_internal_mutable_create_scene()->::protocol::CreateScene::MergeFrom(
+          from._internal_create_scene());
       break;
     }
     case kAppendChild: {
-      _internal_mutable_append_child()->::protocol::AppendChild::MergeFrom(from._internal_append_child());
+      _this->_internal_mutable_append_child()->::protocol::AppendChild::MergeFrom(
+          from._internal_append_child());
       break;
     }
     case kRemoveChild: {
-      _internal_mutable_remove_child()->::protocol::RemoveChild::MergeFrom(from._internal_remove_child());
+      _this->_internal_mutable_remove_child()->::protocol::RemoveChild::MergeFrom(
+          from._internal_remove_child());
       break;
     }
     case kCommitUpdates: {
-      _internal_mutable_commit_updates()->::protocol::CommitUpdates::MergeFrom(from._internal_commit_updates());
+      _this->_internal_mutable_commit_updates()->::protocol::CommitUpdates::MergeFrom(
+          from._internal_commit_updates());
+      break;
+    }
+    case kDefineKey: {
+      _this->_internal_mutable_define_key()->::protocol::DefineKey::MergeFrom(
+          from._internal_define_key());
+      break;
+    }
+    case kDefineString: {
+      _this->_internal_mutable_define_string()->::protocol::DefineString::MergeFrom(
+          from._internal_define_string());
+      break;
+    }
+    case kSetLayoutValues: {
+      _this->_internal_mutable_set_layout_values()->::protocol::SetLayoutValues::MergeFrom(
+          from._internal_set_layout_values());
+      break;
+    }
+    case kInsertBefore: {
+      _this->_internal_mutable_insert_before()->::protocol::InsertBefore::MergeFrom(
+          from._internal_insert_before());
+      break;
+    }
+    case kMoveChild: {
+      _this->_internal_mutable_move_child()->::protocol::MoveChild::MergeFrom(
+          from._internal_move_child());
+      break;
+    }
+    case kCreateTree: {
+      _this->_internal_mutable_create_tree()->::protocol::CreateTree::MergeFrom(
+          from._internal_create_tree());
       break;
     }
     case CHANGE_NOT_SET: {
       break;
     }
   }
-}
-
-void ApplyUpdate::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.ApplyUpdate)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ApplyUpdate::CopyFrom(const ApplyUpdate& from) {
@@ -2191,163 +3328,386 @@ bool ApplyUpdate::IsInitialized() const {
 
 void ApplyUpdate::InternalSwap(ApplyUpdate* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(change_, other->change_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.change_, other->_impl_.change_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ApplyUpdate::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void FindSourceRequest::InitAsDefaultInstance() {
+class UpdateBatch::_Internal {
+ public:
+};
+
+UpdateBatch::UpdateBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.UpdateBatch)
+}
+UpdateBatch::UpdateBatch(const UpdateBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.updates_){from._impl_.updates_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protocol.UpdateBatch)
+}
+
+inline void UpdateBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.updates_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+UpdateBatch::~UpdateBatch() {
+  // @@protoc_insertion_point(destructor:protocol.UpdateBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UpdateBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.updates_.~RepeatedPtrField();
+}
+
+void UpdateBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UpdateBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.UpdateBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.updates_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpdateBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .protocol.ApplyUpdate updates = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_updates(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UpdateBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.UpdateBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .protocol.ApplyUpdate updates = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_updates_size()); i < n; i++) {
+    const auto& repfield = this->_internal_updates(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.UpdateBatch)
+  return target;
+}
+
+size_t UpdateBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.UpdateBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .protocol.ApplyUpdate updates = 1;
+  total_size += 1UL * this->_internal_updates_size();
+  for (const auto& msg : this->_impl_.updates_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateBatch::GetClassData() const { return &_class_data_; }
+
+
+void UpdateBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateBatch*>(&to_msg);
+  auto& from = static_cast<const UpdateBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.UpdateBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.updates_.MergeFrom(from._impl_.updates_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UpdateBatch::CopyFrom(const UpdateBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.UpdateBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UpdateBatch::IsInitialized() const {
+  return true;
+}
+
+void UpdateBatch::InternalSwap(UpdateBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.updates_.InternalSwap(&other->_impl_.updates_);
 }
+
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[5]);
+}
+
+// ===================================================================
+
 class FindSourceRequest::_Internal {
  public:
 };
 
-FindSourceRequest::FindSourceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+FindSourceRequest::FindSourceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:protocol.FindSourceRequest)
 }
 FindSourceRequest::FindSourceRequest(const FindSourceRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FindSourceRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_id_){}
+    , decltype(_impl_.uid_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  request_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.request_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_request_id().empty()) {
-    request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_request_id(),
-      GetArena());
+    _this->_impl_.request_id_.Set(from._internal_request_id(), 
+      _this->GetArenaForAllocation());
   }
-  uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_uid().empty()) {
-    uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_uid(),
-      GetArena());
+    _this->_impl_.uid_.Set(from._internal_uid(), 
+      _this->GetArenaForAllocation());
   }
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_name().empty()) {
-    name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_name(),
-      GetArena());
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.handle_ = from._impl_.handle_;
   // @@protoc_insertion_point(copy_constructor:protocol.FindSourceRequest)
 }
 
-void FindSourceRequest::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_FindSourceRequest_protocol_2eproto.base);
-  request_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void FindSourceRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_id_){}
+    , decltype(_impl_.uid_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.request_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 FindSourceRequest::~FindSourceRequest() {
   // @@protoc_insertion_point(destructor:protocol.FindSourceRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void FindSourceRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  request_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void FindSourceRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.request_id_.Destroy();
+  _impl_.uid_.Destroy();
+  _impl_.name_.Destroy();
 }
 
-void FindSourceRequest::ArenaDtor(void* object) {
-  FindSourceRequest* _this = reinterpret_cast< FindSourceRequest* >(object);
-  (void)_this;
-}
-void FindSourceRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void FindSourceRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const FindSourceRequest& FindSourceRequest::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_FindSourceRequest_protocol_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void FindSourceRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:protocol.FindSourceRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  request_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.request_id_.ClearToEmpty();
+  _impl_.uid_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  _impl_.handle_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* FindSourceRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* FindSourceRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string request_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_request_id();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.FindSourceRequest.request_id"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.FindSourceRequest.request_id"));
+        } else
+          goto handle_unusual;
         continue;
       // string uid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.FindSourceRequest.uid"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.FindSourceRequest.uid"));
+        } else
+          goto handle_unusual;
         continue;
       // string name = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.FindSourceRequest.name"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.FindSourceRequest.name"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint32 handle = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* FindSourceRequest::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* FindSourceRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:protocol.FindSourceRequest)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string request_id = 1;
-  if (this->request_id().size() > 0) {
+  if (!this->_internal_request_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_request_id().data(), static_cast<int>(this->_internal_request_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2357,7 +3717,7 @@ failure:
   }
 
   // string uid = 2;
-  if (this->uid().size() > 0) {
+  if (!this->_internal_uid().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_uid().data(), static_cast<int>(this->_internal_uid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2367,7 +3727,7 @@ failure:
   }
 
   // string name = 3;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2376,8 +3736,14 @@ failure:
         3, this->_internal_name(), target);
   }
 
+  // uint32 handle = 4;
+  if (this->_internal_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_handle(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:protocol.FindSourceRequest)
@@ -2388,78 +3754,67 @@ size_t FindSourceRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:protocol.FindSourceRequest)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string request_id = 1;
-  if (this->request_id().size() > 0) {
+  if (!this->_internal_request_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_request_id());
   }
 
   // string uid = 2;
-  if (this->uid().size() > 0) {
+  if (!this->_internal_uid().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_uid());
   }
 
   // string name = 3;
-  if (this->name().size() > 0) {
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 handle = 4;
+  if (this->_internal_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_handle());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void FindSourceRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.FindSourceRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const FindSourceRequest* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<FindSourceRequest>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.FindSourceRequest)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.FindSourceRequest)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void FindSourceRequest::MergeFrom(const FindSourceRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.FindSourceRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FindSourceRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FindSourceRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FindSourceRequest::GetClassData() const { return &_class_data_; }
+
+
+void FindSourceRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FindSourceRequest*>(&to_msg);
+  auto& from = static_cast<const FindSourceRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.FindSourceRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.request_id().size() > 0) {
-    _internal_set_request_id(from._internal_request_id());
+  if (!from._internal_request_id().empty()) {
+    _this->_internal_set_request_id(from._internal_request_id());
   }
-  if (from.uid().size() > 0) {
-    _internal_set_uid(from._internal_uid());
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
   }
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-}
-
-void FindSourceRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.FindSourceRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_handle() != 0) {
+    _this->_internal_set_handle(from._internal_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void FindSourceRequest::CopyFrom(const FindSourceRequest& from) {
@@ -2475,140 +3830,232 @@ bool FindSourceRequest::IsInitialized() const {
 
 void FindSourceRequest::InternalSwap(FindSourceRequest* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  request_id_.Swap(&other->request_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  uid_.Swap(&other->uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.request_id_, lhs_arena,
+      &other->_impl_.request_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uid_, lhs_arena,
+      &other->_impl_.uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.handle_, other->_impl_.handle_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata FindSourceRequest::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void Response::InitAsDefaultInstance() {
-}
 class Response::_Internal {
  public:
+  static const ::protocol::SharedMemoryTransport& shared_memory(const Response* msg);
+  static const ::protocol::FrameCompression& compression(const Response* msg);
 };
 
-Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+const ::protocol::SharedMemoryTransport&
+Response::_Internal::shared_memory(const Response* msg) {
+  return *msg->_impl_.shared_memory_;
+}
+const ::protocol::FrameCompression&
+Response::_Internal::compression(const Response* msg) {
+  return *msg->_impl_.compression_;
+}
+Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:protocol.Response)
 }
 Response::Response(const Response& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_id_){}
+    , decltype(_impl_.shared_memory_){nullptr}
+    , decltype(_impl_.compression_){nullptr}
+    , decltype(_impl_.update_credits_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.session_resumed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  request_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.request_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_request_id().empty()) {
-    request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_request_id(),
-      GetArena());
+    _this->_impl_.request_id_.Set(from._internal_request_id(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_shared_memory()) {
+    _this->_impl_.shared_memory_ = new ::protocol::SharedMemoryTransport(*from._impl_.shared_memory_);
   }
-  success_ = from.success_;
+  if (from._internal_has_compression()) {
+    _this->_impl_.compression_ = new ::protocol::FrameCompression(*from._impl_.compression_);
+  }
+  ::memcpy(&_impl_.update_credits_, &from._impl_.update_credits_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.session_resumed_) -
+    reinterpret_cast<char*>(&_impl_.update_credits_)) + sizeof(_impl_.session_resumed_));
   // @@protoc_insertion_point(copy_constructor:protocol.Response)
 }
 
-void Response::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Response_protocol_2eproto.base);
-  request_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  success_ = false;
+inline void Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_id_){}
+    , decltype(_impl_.shared_memory_){nullptr}
+    , decltype(_impl_.compression_){nullptr}
+    , decltype(_impl_.update_credits_){0u}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.session_resumed_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.request_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Response::~Response() {
   // @@protoc_insertion_point(destructor:protocol.Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Response::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  request_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.request_id_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.shared_memory_;
+  if (this != internal_default_instance()) delete _impl_.compression_;
 }
 
-void Response::ArenaDtor(void* object) {
-  Response* _this = reinterpret_cast< Response* >(object);
-  (void)_this;
-}
-void Response::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Response::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Response& Response::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Response_protocol_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Response::Clear() {
 // @@protoc_insertion_point(message_clear_start:protocol.Response)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  request_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  success_ = false;
+  _impl_.request_id_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.shared_memory_ != nullptr) {
+    delete _impl_.shared_memory_;
+  }
+  _impl_.shared_memory_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.compression_ != nullptr) {
+    delete _impl_.compression_;
+  }
+  _impl_.compression_ = nullptr;
+  ::memset(&_impl_.update_credits_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.session_resumed_) -
+      reinterpret_cast<char*>(&_impl_.update_credits_)) + sizeof(_impl_.session_resumed_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Response::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string request_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_request_id();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.Response.request_id"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.Response.request_id"));
+        } else
+          goto handle_unusual;
         continue;
       // bool success = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // .protocol.SharedMemoryTransport shared_memory = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shared_memory(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 update_credits = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.update_credits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.FrameCompression compression = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_compression(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool session_resumed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.session_resumed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Response::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:protocol.Response)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string request_id = 1;
-  if (this->request_id().size() > 0) {
+  if (!this->_internal_request_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_request_id().data(), static_cast<int>(this->_internal_request_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -2618,13 +4065,39 @@ failure:
   }
 
   // bool success = 2;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
+  }
+
+  // .protocol.SharedMemoryTransport shared_memory = 3;
+  if (this->_internal_has_shared_memory()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::shared_memory(this),
+        _Internal::shared_memory(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 update_credits = 4;
+  if (this->_internal_update_credits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_update_credits(), target);
+  }
+
+  // .protocol.FrameCompression compression = 5;
+  if (this->_internal_has_compression()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::compression(this),
+        _Internal::compression(this).GetCachedSize(), target, stream);
+  }
+
+  // bool session_resumed = 6;
+  if (this->_internal_session_resumed() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(2, this->_internal_success(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_session_resumed(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:protocol.Response)
@@ -2635,66 +4108,85 @@ size_t Response::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:protocol.Response)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string request_id = 1;
-  if (this->request_id().size() > 0) {
+  if (!this->_internal_request_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_request_id());
   }
 
+  // .protocol.SharedMemoryTransport shared_memory = 3;
+  if (this->_internal_has_shared_memory()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.shared_memory_);
+  }
+
+  // .protocol.FrameCompression compression = 5;
+  if (this->_internal_has_compression()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.compression_);
+  }
+
+  // uint32 update_credits = 4;
+  if (this->_internal_update_credits() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_update_credits());
+  }
+
   // bool success = 2;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // bool session_resumed = 6;
+  if (this->_internal_session_resumed() != 0) {
+    total_size += 1 + 1;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void Response::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.Response)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Response* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Response>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.Response)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.Response)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Response::MergeFrom(const Response& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.Response)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Response::GetClassData() const { return &_class_data_; }
+
+
+void Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Response*>(&to_msg);
+  auto& from = static_cast<const Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.request_id().size() > 0) {
-    _internal_set_request_id(from._internal_request_id());
+  if (!from._internal_request_id().empty()) {
+    _this->_internal_set_request_id(from._internal_request_id());
   }
-  if (from.success() != 0) {
-    _internal_set_success(from._internal_success());
+  if (from._internal_has_shared_memory()) {
+    _this->_internal_mutable_shared_memory()->::protocol::SharedMemoryTransport::MergeFrom(
+        from._internal_shared_memory());
   }
-}
-
-void Response::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.Response)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_has_compression()) {
+    _this->_internal_mutable_compression()->::protocol::FrameCompression::MergeFrom(
+        from._internal_compression());
+  }
+  if (from._internal_update_credits() != 0) {
+    _this->_internal_set_update_credits(from._internal_update_credits());
+  }
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_session_resumed() != 0) {
+    _this->_internal_set_session_resumed(from._internal_session_resumed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Response::CopyFrom(const Response& from) {
@@ -2710,1680 +4202,6154 @@ bool Response::IsInitialized() const {
 
 void Response::InternalSwap(Response* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  request_id_.Swap(&other->request_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(success_, other->success_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.request_id_, lhs_arena,
+      &other->_impl_.request_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Response, _impl_.session_resumed_)
+      + sizeof(Response::_impl_.session_resumed_)
+      - PROTOBUF_FIELD_OFFSET(Response, _impl_.shared_memory_)>(
+          reinterpret_cast<char*>(&_impl_.shared_memory_),
+          reinterpret_cast<char*>(&other->_impl_.shared_memory_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Response::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void CreateSource::InitAsDefaultInstance() {
-  ::protocol::_CreateSource_default_instance_._instance.get_mutable()->settings_ = const_cast< ::protocol::ObjectValue*>(
-      ::protocol::ObjectValue::internal_default_instance());
-}
-class CreateSource::_Internal {
+class SharedMemoryTransport::_Internal {
  public:
-  static const ::protocol::ObjectValue& settings(const CreateSource* msg);
 };
 
-const ::protocol::ObjectValue&
-CreateSource::_Internal::settings(const CreateSource* msg) {
-  return *msg->settings_;
-}
-CreateSource::CreateSource(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:protocol.CreateSource)
+SharedMemoryTransport::SharedMemoryTransport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.SharedMemoryTransport)
 }
-CreateSource::CreateSource(const CreateSource& from)
+SharedMemoryTransport::SharedMemoryTransport(const SharedMemoryTransport& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SharedMemoryTransport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ring_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_uid().empty()) {
-    uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_uid(),
-      GetArena());
-  }
-  id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_id().empty()) {
-    id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_id(),
-      GetArena());
-  }
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_name().empty()) {
-    name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_name(),
-      GetArena());
+  _this->_impl_.ring_size_ = from._impl_.ring_size_;
+  // @@protoc_insertion_point(copy_constructor:protocol.SharedMemoryTransport)
+}
+
+inline void SharedMemoryTransport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ring_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SharedMemoryTransport::~SharedMemoryTransport() {
+  // @@protoc_insertion_point(destructor:protocol.SharedMemoryTransport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  container_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_container_uid().empty()) {
-    container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_container_uid(),
-      GetArena());
-  }
-  if (from._internal_has_settings()) {
-    settings_ = new ::protocol::ObjectValue(*from.settings_);
-  } else {
-    settings_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:protocol.CreateSource)
-}
-
-void CreateSource::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_CreateSource_protocol_2eproto.base);
-  uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  container_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  settings_ = nullptr;
-}
-
-CreateSource::~CreateSource() {
-  // @@protoc_insertion_point(destructor:protocol.CreateSource)
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CreateSource::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  container_uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete settings_;
+inline void SharedMemoryTransport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void CreateSource::ArenaDtor(void* object) {
-  CreateSource* _this = reinterpret_cast< CreateSource* >(object);
-  (void)_this;
-}
-void CreateSource::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void SharedMemoryTransport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-void CreateSource::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const CreateSource& CreateSource::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_CreateSource_protocol_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void CreateSource::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.CreateSource)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void SharedMemoryTransport::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.SharedMemoryTransport)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  container_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && settings_ != nullptr) {
-    delete settings_;
-  }
-  settings_ = nullptr;
+  _impl_.ring_size_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CreateSource::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SharedMemoryTransport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string uid = 1;
+      // uint32 ring_size = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.CreateSource.uid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string id = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_id();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.CreateSource.id"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string name = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.CreateSource.name"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .protocol.ObjectValue settings = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_settings(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ring_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string container_uid = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          auto str = _internal_mutable_container_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.CreateSource.container_uid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* CreateSource::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.CreateSource)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* SharedMemoryTransport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.SharedMemoryTransport)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string uid = 1;
-  if (this->uid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_uid().data(), static_cast<int>(this->_internal_uid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.CreateSource.uid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_uid(), target);
-  }
-
-  // string id = 2;
-  if (this->id().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.CreateSource.id");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_id(), target);
-  }
-
-  // string name = 3;
-  if (this->name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.CreateSource.name");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_name(), target);
-  }
-
-  // .protocol.ObjectValue settings = 4;
-  if (this->has_settings()) {
+  // uint32 ring_size = 1;
+  if (this->_internal_ring_size() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::settings(this), target, stream);
-  }
-
-  // string container_uid = 5;
-  if (this->container_uid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_container_uid().data(), static_cast<int>(this->_internal_container_uid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.CreateSource.container_uid");
-    target = stream->WriteStringMaybeAliased(
-        5, this->_internal_container_uid(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_ring_size(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.CreateSource)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.SharedMemoryTransport)
   return target;
 }
 
-size_t CreateSource::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.CreateSource)
+size_t SharedMemoryTransport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.SharedMemoryTransport)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uid = 1;
-  if (this->uid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_uid());
-  }
-
-  // string id = 2;
-  if (this->id().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_id());
-  }
-
-  // string name = 3;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
-  }
-
-  // string container_uid = 5;
-  if (this->container_uid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_container_uid());
-  }
-
-  // .protocol.ObjectValue settings = 4;
-  if (this->has_settings()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *settings_);
+  // uint32 ring_size = 1;
+  if (this->_internal_ring_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ring_size());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CreateSource::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.CreateSource)
-  GOOGLE_DCHECK_NE(&from, this);
-  const CreateSource* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CreateSource>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.CreateSource)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.CreateSource)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SharedMemoryTransport::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SharedMemoryTransport::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SharedMemoryTransport::GetClassData() const { return &_class_data_; }
 
-void CreateSource::MergeFrom(const CreateSource& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.CreateSource)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void SharedMemoryTransport::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SharedMemoryTransport*>(&to_msg);
+  auto& from = static_cast<const SharedMemoryTransport&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.SharedMemoryTransport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.uid().size() > 0) {
-    _internal_set_uid(from._internal_uid());
-  }
-  if (from.id().size() > 0) {
-    _internal_set_id(from._internal_id());
-  }
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
+  if (from._internal_ring_size() != 0) {
+    _this->_internal_set_ring_size(from._internal_ring_size());
   }
-  if (from.container_uid().size() > 0) {
-    _internal_set_container_uid(from._internal_container_uid());
-  }
-  if (from.has_settings()) {
-    _internal_mutable_settings()->::protocol::ObjectValue::MergeFrom(from._internal_settings());
-  }
-}
-
-void CreateSource::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.CreateSource)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CreateSource::CopyFrom(const CreateSource& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.CreateSource)
+void SharedMemoryTransport::CopyFrom(const SharedMemoryTransport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.SharedMemoryTransport)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CreateSource::IsInitialized() const {
+bool SharedMemoryTransport::IsInitialized() const {
   return true;
 }
 
-void CreateSource::InternalSwap(CreateSource* other) {
+void SharedMemoryTransport::InternalSwap(SharedMemoryTransport* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  uid_.Swap(&other->uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  id_.Swap(&other->id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  container_uid_.Swap(&other->container_uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(settings_, other->settings_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.ring_size_, other->_impl_.ring_size_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata CreateSource::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata SharedMemoryTransport::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void UpdateSource::InitAsDefaultInstance() {
-  ::protocol::_UpdateSource_default_instance_._instance.get_mutable()->changed_props_ = const_cast< ::protocol::ObjectValue*>(
-      ::protocol::ObjectValue::internal_default_instance());
-}
-class UpdateSource::_Internal {
+class FrameCompression::_Internal {
  public:
-  static const ::protocol::ObjectValue& changed_props(const UpdateSource* msg);
 };
 
-const ::protocol::ObjectValue&
-UpdateSource::_Internal::changed_props(const UpdateSource* msg) {
-  return *msg->changed_props_;
-}
-UpdateSource::UpdateSource(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:protocol.UpdateSource)
+FrameCompression::FrameCompression(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.FrameCompression)
 }
-UpdateSource::UpdateSource(const UpdateSource& from)
+FrameCompression::FrameCompression(const FrameCompression& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FrameCompression* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dictionary_){}
+    , decltype(_impl_.algorithm_){}
+    , decltype(_impl_.threshold_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_uid().empty()) {
-    uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_uid(),
-      GetArena());
-  }
-  if (from._internal_has_changed_props()) {
-    changed_props_ = new ::protocol::ObjectValue(*from.changed_props_);
-  } else {
-    changed_props_ = nullptr;
+  _impl_.dictionary_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dictionary_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_dictionary().empty()) {
+    _this->_impl_.dictionary_.Set(from._internal_dictionary(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.algorithm_, &from._impl_.algorithm_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.threshold_) -
+    reinterpret_cast<char*>(&_impl_.algorithm_)) + sizeof(_impl_.threshold_));
+  // @@protoc_insertion_point(copy_constructor:protocol.FrameCompression)
+}
+
+inline void FrameCompression::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dictionary_){}
+    , decltype(_impl_.algorithm_){0}
+    , decltype(_impl_.threshold_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.dictionary_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dictionary_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FrameCompression::~FrameCompression() {
+  // @@protoc_insertion_point(destructor:protocol.FrameCompression)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  // @@protoc_insertion_point(copy_constructor:protocol.UpdateSource)
-}
-
-void UpdateSource::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_UpdateSource_protocol_2eproto.base);
-  uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  changed_props_ = nullptr;
-}
-
-UpdateSource::~UpdateSource() {
-  // @@protoc_insertion_point(destructor:protocol.UpdateSource)
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void UpdateSource::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete changed_props_;
+inline void FrameCompression::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dictionary_.Destroy();
 }
 
-void UpdateSource::ArenaDtor(void* object) {
-  UpdateSource* _this = reinterpret_cast< UpdateSource* >(object);
-  (void)_this;
-}
-void UpdateSource::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void UpdateSource::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const UpdateSource& UpdateSource::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_UpdateSource_protocol_2eproto.base);
-  return *internal_default_instance();
+void FrameCompression::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void UpdateSource::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.UpdateSource)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void FrameCompression::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.FrameCompression)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && changed_props_ != nullptr) {
-    delete changed_props_;
-  }
-  changed_props_ = nullptr;
+  _impl_.dictionary_.ClearToEmpty();
+  ::memset(&_impl_.algorithm_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.threshold_) -
+      reinterpret_cast<char*>(&_impl_.algorithm_)) + sizeof(_impl_.threshold_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UpdateSource::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* FrameCompression::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string uid = 2;
+      // .protocol.Compression algorithm = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_algorithm(static_cast<::protocol::Compression>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 threshold = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.UpdateSource.uid"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .protocol.ObjectValue changed_props = 3;
+      // bytes dictionary = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_changed_props(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_dictionary();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* UpdateSource::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.UpdateSource)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* FrameCompression::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.FrameCompression)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string uid = 2;
-  if (this->uid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_uid().data(), static_cast<int>(this->_internal_uid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.UpdateSource.uid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_uid(), target);
+  // .protocol.Compression algorithm = 1;
+  if (this->_internal_algorithm() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_algorithm(), target);
   }
 
-  // .protocol.ObjectValue changed_props = 3;
-  if (this->has_changed_props()) {
+  // uint32 threshold = 2;
+  if (this->_internal_threshold() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::changed_props(this), target, stream);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_threshold(), target);
+  }
+
+  // bytes dictionary = 3;
+  if (!this->_internal_dictionary().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_dictionary(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.UpdateSource)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.FrameCompression)
   return target;
 }
 
-size_t UpdateSource::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.UpdateSource)
+size_t FrameCompression::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.FrameCompression)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uid = 2;
-  if (this->uid().size() > 0) {
+  // bytes dictionary = 3;
+  if (!this->_internal_dictionary().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_uid());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_dictionary());
   }
 
-  // .protocol.ObjectValue changed_props = 3;
-  if (this->has_changed_props()) {
+  // .protocol.Compression algorithm = 1;
+  if (this->_internal_algorithm() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *changed_props_);
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_algorithm());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // uint32 threshold = 2;
+  if (this->_internal_threshold() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_threshold());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void UpdateSource::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.UpdateSource)
-  GOOGLE_DCHECK_NE(&from, this);
-  const UpdateSource* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<UpdateSource>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.UpdateSource)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.UpdateSource)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void UpdateSource::MergeFrom(const UpdateSource& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.UpdateSource)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FrameCompression::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FrameCompression::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FrameCompression::GetClassData() const { return &_class_data_; }
+
+
+void FrameCompression::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FrameCompression*>(&to_msg);
+  auto& from = static_cast<const FrameCompression&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.FrameCompression)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.uid().size() > 0) {
-    _internal_set_uid(from._internal_uid());
+  if (!from._internal_dictionary().empty()) {
+    _this->_internal_set_dictionary(from._internal_dictionary());
   }
-  if (from.has_changed_props()) {
-    _internal_mutable_changed_props()->::protocol::ObjectValue::MergeFrom(from._internal_changed_props());
+  if (from._internal_algorithm() != 0) {
+    _this->_internal_set_algorithm(from._internal_algorithm());
   }
+  if (from._internal_threshold() != 0) {
+    _this->_internal_set_threshold(from._internal_threshold());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UpdateSource::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.UpdateSource)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void UpdateSource::CopyFrom(const UpdateSource& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.UpdateSource)
+void FrameCompression::CopyFrom(const FrameCompression& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.FrameCompression)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UpdateSource::IsInitialized() const {
+bool FrameCompression::IsInitialized() const {
   return true;
 }
 
-void UpdateSource::InternalSwap(UpdateSource* other) {
+void FrameCompression::InternalSwap(FrameCompression* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  uid_.Swap(&other->uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(changed_props_, other->changed_props_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.dictionary_, lhs_arena,
+      &other->_impl_.dictionary_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrameCompression, _impl_.threshold_)
+      + sizeof(FrameCompression::_impl_.threshold_)
+      - PROTOBUF_FIELD_OFFSET(FrameCompression, _impl_.algorithm_)>(
+          reinterpret_cast<char*>(&_impl_.algorithm_),
+          reinterpret_cast<char*>(&other->_impl_.algorithm_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FrameCompression::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[9]);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata UpdateSource::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
 // ===================================================================
 
-void CreateScene::InitAsDefaultInstance() {
-  ::protocol::_CreateScene_default_instance_._instance.get_mutable()->props_ = const_cast< ::protocol::ObjectValue*>(
-      ::protocol::ObjectValue::internal_default_instance());
-}
-class CreateScene::_Internal {
+class UpdateCredits::_Internal {
  public:
-  static const ::protocol::ObjectValue& props(const CreateScene* msg);
 };
 
-const ::protocol::ObjectValue&
-CreateScene::_Internal::props(const CreateScene* msg) {
-  return *msg->props_;
-}
-CreateScene::CreateScene(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:protocol.CreateScene)
+UpdateCredits::UpdateCredits(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.UpdateCredits)
 }
-CreateScene::CreateScene(const CreateScene& from)
+UpdateCredits::UpdateCredits(const UpdateCredits& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateCredits* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.credits_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_uid().empty()) {
-    uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_uid(),
-      GetArena());
-  }
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_name().empty()) {
-    name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_name(),
-      GetArena());
-  }
-  container_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_container_uid().empty()) {
-    container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_container_uid(),
-      GetArena());
-  }
-  if (from._internal_has_props()) {
-    props_ = new ::protocol::ObjectValue(*from.props_);
-  } else {
-    props_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:protocol.CreateScene)
+  _this->_impl_.credits_ = from._impl_.credits_;
+  // @@protoc_insertion_point(copy_constructor:protocol.UpdateCredits)
 }
 
-void CreateScene::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_CreateScene_protocol_2eproto.base);
-  uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  container_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  props_ = nullptr;
+inline void UpdateCredits::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.credits_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-CreateScene::~CreateScene() {
-  // @@protoc_insertion_point(destructor:protocol.CreateScene)
+UpdateCredits::~UpdateCredits() {
+  // @@protoc_insertion_point(destructor:protocol.UpdateCredits)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CreateScene::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  container_uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete props_;
+inline void UpdateCredits::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void CreateScene::ArenaDtor(void* object) {
-  CreateScene* _this = reinterpret_cast< CreateScene* >(object);
-  (void)_this;
-}
-void CreateScene::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void CreateScene::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void UpdateCredits::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const CreateScene& CreateScene::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_CreateScene_protocol_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void CreateScene::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.CreateScene)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void UpdateCredits::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.UpdateCredits)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  container_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  if (GetArena() == nullptr && props_ != nullptr) {
-    delete props_;
-  }
-  props_ = nullptr;
+  _impl_.credits_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CreateScene::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* UpdateCredits::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string uid = 1;
+      // uint32 credits = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.CreateScene.uid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string name = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_name();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.CreateScene.name"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.credits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .protocol.ObjectValue props = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_props(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string container_uid = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          auto str = _internal_mutable_container_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.CreateScene.container_uid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* CreateScene::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.CreateScene)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* UpdateCredits::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.UpdateCredits)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string uid = 1;
-  if (this->uid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_uid().data(), static_cast<int>(this->_internal_uid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.CreateScene.uid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_uid(), target);
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.CreateScene.name");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_name(), target);
-  }
-
-  // .protocol.ObjectValue props = 3;
-  if (this->has_props()) {
+  // uint32 credits = 1;
+  if (this->_internal_credits() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::props(this), target, stream);
-  }
-
-  // string container_uid = 4;
-  if (this->container_uid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_container_uid().data(), static_cast<int>(this->_internal_container_uid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.CreateScene.container_uid");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_container_uid(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_credits(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.CreateScene)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.UpdateCredits)
   return target;
 }
 
-size_t CreateScene::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.CreateScene)
+size_t UpdateCredits::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.UpdateCredits)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uid = 1;
-  if (this->uid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_uid());
-  }
-
-  // string name = 2;
-  if (this->name().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
-  }
-
-  // string container_uid = 4;
-  if (this->container_uid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_container_uid());
-  }
-
-  // .protocol.ObjectValue props = 3;
-  if (this->has_props()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *props_);
+  // uint32 credits = 1;
+  if (this->_internal_credits() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_credits());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CreateScene::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.CreateScene)
-  GOOGLE_DCHECK_NE(&from, this);
-  const CreateScene* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CreateScene>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.CreateScene)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.CreateScene)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateCredits::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateCredits::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateCredits::GetClassData() const { return &_class_data_; }
 
-void CreateScene::MergeFrom(const CreateScene& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.CreateScene)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void UpdateCredits::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateCredits*>(&to_msg);
+  auto& from = static_cast<const UpdateCredits&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.UpdateCredits)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.uid().size() > 0) {
-    _internal_set_uid(from._internal_uid());
+  if (from._internal_credits() != 0) {
+    _this->_internal_set_credits(from._internal_credits());
   }
-  if (from.name().size() > 0) {
-    _internal_set_name(from._internal_name());
-  }
-  if (from.container_uid().size() > 0) {
-    _internal_set_container_uid(from._internal_container_uid());
-  }
-  if (from.has_props()) {
-    _internal_mutable_props()->::protocol::ObjectValue::MergeFrom(from._internal_props());
-  }
-}
-
-void CreateScene::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.CreateScene)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CreateScene::CopyFrom(const CreateScene& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.CreateScene)
+void UpdateCredits::CopyFrom(const UpdateCredits& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.UpdateCredits)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CreateScene::IsInitialized() const {
+bool UpdateCredits::IsInitialized() const {
   return true;
 }
 
-void CreateScene::InternalSwap(CreateScene* other) {
+void UpdateCredits::InternalSwap(UpdateCredits* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  uid_.Swap(&other->uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  name_.Swap(&other->name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  container_uid_.Swap(&other->container_uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(props_, other->props_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.credits_, other->_impl_.credits_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata CreateScene::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateCredits::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[10]);
 }
 
-
 // ===================================================================
 
-void AppendChild::InitAsDefaultInstance() {
-}
-class AppendChild::_Internal {
+class CreateSource::_Internal {
  public:
+  static const ::protocol::ObjectValue& settings(const CreateSource* msg);
+  static const ::protocol::Style& style(const CreateSource* msg);
 };
 
-AppendChild::AppendChild(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:protocol.AppendChild)
+const ::protocol::ObjectValue&
+CreateSource::_Internal::settings(const CreateSource* msg) {
+  return *msg->_impl_.settings_;
 }
-AppendChild::AppendChild(const AppendChild& from)
+const ::protocol::Style&
+CreateSource::_Internal::style(const CreateSource* msg) {
+  return *msg->_impl_.style_;
+}
+CreateSource::CreateSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.CreateSource)
+}
+CreateSource::CreateSource(const CreateSource& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CreateSource* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uid_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.container_uid_){}
+    , decltype(_impl_.settings_){nullptr}
+    , decltype(_impl_.style_){nullptr}
+    , decltype(_impl_.handle_){}
+    , decltype(_impl_.container_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  parent_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_parent_uid().empty()) {
-    parent_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_parent_uid(),
-      GetArena());
+  _impl_.uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uid().empty()) {
+    _this->_impl_.uid_.Set(from._internal_uid(), 
+      _this->GetArenaForAllocation());
   }
-  child_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_child_uid().empty()) {
-    child_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_child_uid(),
-      GetArena());
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:protocol.AppendChild)
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.container_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.container_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_container_uid().empty()) {
+    _this->_impl_.container_uid_.Set(from._internal_container_uid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_settings()) {
+    _this->_impl_.settings_ = new ::protocol::ObjectValue(*from._impl_.settings_);
+  }
+  if (from._internal_has_style()) {
+    _this->_impl_.style_ = new ::protocol::Style(*from._impl_.style_);
+  }
+  ::memcpy(&_impl_.handle_, &from._impl_.handle_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.container_handle_) -
+    reinterpret_cast<char*>(&_impl_.handle_)) + sizeof(_impl_.container_handle_));
+  // @@protoc_insertion_point(copy_constructor:protocol.CreateSource)
 }
 
-void AppendChild::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_AppendChild_protocol_2eproto.base);
-  parent_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  child_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void CreateSource::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uid_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.container_uid_){}
+    , decltype(_impl_.settings_){nullptr}
+    , decltype(_impl_.style_){nullptr}
+    , decltype(_impl_.handle_){0u}
+    , decltype(_impl_.container_handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.container_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.container_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-AppendChild::~AppendChild() {
-  // @@protoc_insertion_point(destructor:protocol.AppendChild)
+CreateSource::~CreateSource() {
+  // @@protoc_insertion_point(destructor:protocol.CreateSource)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void AppendChild::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  parent_uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  child_uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void CreateSource::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uid_.Destroy();
+  _impl_.id_.Destroy();
+  _impl_.name_.Destroy();
+  _impl_.container_uid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.settings_;
+  if (this != internal_default_instance()) delete _impl_.style_;
 }
 
-void AppendChild::ArenaDtor(void* object) {
-  AppendChild* _this = reinterpret_cast< AppendChild* >(object);
-  (void)_this;
-}
-void AppendChild::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void AppendChild::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const AppendChild& AppendChild::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AppendChild_protocol_2eproto.base);
-  return *internal_default_instance();
+void CreateSource::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void AppendChild::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.AppendChild)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void CreateSource::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.CreateSource)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  parent_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  child_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.uid_.ClearToEmpty();
+  _impl_.id_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  _impl_.container_uid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.settings_ != nullptr) {
+    delete _impl_.settings_;
+  }
+  _impl_.settings_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.style_ != nullptr) {
+    delete _impl_.style_;
+  }
+  _impl_.style_ = nullptr;
+  ::memset(&_impl_.handle_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.container_handle_) -
+      reinterpret_cast<char*>(&_impl_.handle_)) + sizeof(_impl_.container_handle_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AppendChild::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* CreateSource::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string parent_uid = 1;
+      // string uid = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_parent_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.AppendChild.parent_uid"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.CreateSource.uid"));
+        } else
+          goto handle_unusual;
         continue;
-      // string child_uid = 2;
+      // string id = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_child_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.AppendChild.child_uid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.CreateSource.id"));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // string name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.CreateSource.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.ObjectValue settings = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_settings(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string container_uid = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_container_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.CreateSource.container_uid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 handle = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 container_handle = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.container_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Style style = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_style(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* AppendChild::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.AppendChild)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* CreateSource::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.CreateSource)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string parent_uid = 1;
-  if (this->parent_uid().size() > 0) {
+  // string uid = 1;
+  if (!this->_internal_uid().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_parent_uid().data(), static_cast<int>(this->_internal_parent_uid().length()),
+      this->_internal_uid().data(), static_cast<int>(this->_internal_uid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.AppendChild.parent_uid");
+      "protocol.CreateSource.uid");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_parent_uid(), target);
+        1, this->_internal_uid(), target);
   }
 
-  // string child_uid = 2;
-  if (this->child_uid().size() > 0) {
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_child_uid().data(), static_cast<int>(this->_internal_child_uid().length()),
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.AppendChild.child_uid");
+      "protocol.CreateSource.id");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_child_uid(), target);
+        2, this->_internal_id(), target);
+  }
+
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.CreateSource.name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_name(), target);
+  }
+
+  // .protocol.ObjectValue settings = 4;
+  if (this->_internal_has_settings()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::settings(this),
+        _Internal::settings(this).GetCachedSize(), target, stream);
+  }
+
+  // string container_uid = 5;
+  if (!this->_internal_container_uid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_container_uid().data(), static_cast<int>(this->_internal_container_uid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.CreateSource.container_uid");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_container_uid(), target);
+  }
+
+  // uint32 handle = 6;
+  if (this->_internal_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_handle(), target);
+  }
+
+  // uint32 container_handle = 7;
+  if (this->_internal_container_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_container_handle(), target);
+  }
+
+  // .protocol.Style style = 8;
+  if (this->_internal_has_style()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::style(this),
+        _Internal::style(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.AppendChild)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.CreateSource)
   return target;
 }
 
-size_t AppendChild::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.AppendChild)
+size_t CreateSource::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.CreateSource)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string parent_uid = 1;
-  if (this->parent_uid().size() > 0) {
+  // string uid = 1;
+  if (!this->_internal_uid().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_parent_uid());
+        this->_internal_uid());
   }
 
-  // string child_uid = 2;
-  if (this->child_uid().size() > 0) {
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_child_uid());
+        this->_internal_id());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string container_uid = 5;
+  if (!this->_internal_container_uid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_container_uid());
+  }
+
+  // .protocol.ObjectValue settings = 4;
+  if (this->_internal_has_settings()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.settings_);
+  }
+
+  // .protocol.Style style = 8;
+  if (this->_internal_has_style()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.style_);
+  }
+
+  // uint32 handle = 6;
+  if (this->_internal_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_handle());
+  }
+
+  // uint32 container_handle = 7;
+  if (this->_internal_container_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_container_handle());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void AppendChild::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.AppendChild)
-  GOOGLE_DCHECK_NE(&from, this);
-  const AppendChild* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<AppendChild>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.AppendChild)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.AppendChild)
-    MergeFrom(*source);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CreateSource::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CreateSource::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CreateSource::GetClassData() const { return &_class_data_; }
+
+
+void CreateSource::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CreateSource*>(&to_msg);
+  auto& from = static_cast<const CreateSource&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.CreateSource)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_container_uid().empty()) {
+    _this->_internal_set_container_uid(from._internal_container_uid());
+  }
+  if (from._internal_has_settings()) {
+    _this->_internal_mutable_settings()->::protocol::ObjectValue::MergeFrom(
+        from._internal_settings());
+  }
+  if (from._internal_has_style()) {
+    _this->_internal_mutable_style()->::protocol::Style::MergeFrom(
+        from._internal_style());
+  }
+  if (from._internal_handle() != 0) {
+    _this->_internal_set_handle(from._internal_handle());
+  }
+  if (from._internal_container_handle() != 0) {
+    _this->_internal_set_container_handle(from._internal_container_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CreateSource::CopyFrom(const CreateSource& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.CreateSource)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CreateSource::IsInitialized() const {
+  return true;
+}
+
+void CreateSource::InternalSwap(CreateSource* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uid_, lhs_arena,
+      &other->_impl_.uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.container_uid_, lhs_arena,
+      &other->_impl_.container_uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CreateSource, _impl_.container_handle_)
+      + sizeof(CreateSource::_impl_.container_handle_)
+      - PROTOBUF_FIELD_OFFSET(CreateSource, _impl_.settings_)>(
+          reinterpret_cast<char*>(&_impl_.settings_),
+          reinterpret_cast<char*>(&other->_impl_.settings_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CreateSource::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[11]);
+}
+
+// ===================================================================
+
+class UpdateSource::_Internal {
+ public:
+  static const ::protocol::ObjectValue& changed_props(const UpdateSource* msg);
+  static const ::protocol::Style& style(const UpdateSource* msg);
+};
+
+const ::protocol::ObjectValue&
+UpdateSource::_Internal::changed_props(const UpdateSource* msg) {
+  return *msg->_impl_.changed_props_;
+}
+const ::protocol::Style&
+UpdateSource::_Internal::style(const UpdateSource* msg) {
+  return *msg->_impl_.style_;
+}
+UpdateSource::UpdateSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.UpdateSource)
+}
+UpdateSource::UpdateSource(const UpdateSource& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateSource* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uid_){}
+    , decltype(_impl_.changed_props_){nullptr}
+    , decltype(_impl_.style_){nullptr}
+    , decltype(_impl_.handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uid().empty()) {
+    _this->_impl_.uid_.Set(from._internal_uid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_changed_props()) {
+    _this->_impl_.changed_props_ = new ::protocol::ObjectValue(*from._impl_.changed_props_);
+  }
+  if (from._internal_has_style()) {
+    _this->_impl_.style_ = new ::protocol::Style(*from._impl_.style_);
+  }
+  _this->_impl_.handle_ = from._impl_.handle_;
+  // @@protoc_insertion_point(copy_constructor:protocol.UpdateSource)
+}
+
+inline void UpdateSource::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uid_){}
+    , decltype(_impl_.changed_props_){nullptr}
+    , decltype(_impl_.style_){nullptr}
+    , decltype(_impl_.handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UpdateSource::~UpdateSource() {
+  // @@protoc_insertion_point(destructor:protocol.UpdateSource)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UpdateSource::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.changed_props_;
+  if (this != internal_default_instance()) delete _impl_.style_;
+}
+
+void UpdateSource::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UpdateSource::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.UpdateSource)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.changed_props_ != nullptr) {
+    delete _impl_.changed_props_;
+  }
+  _impl_.changed_props_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.style_ != nullptr) {
+    delete _impl_.style_;
+  }
+  _impl_.style_ = nullptr;
+  _impl_.handle_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpdateSource::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string uid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.UpdateSource.uid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.ObjectValue changed_props = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_changed_props(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 handle = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Style style = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_style(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UpdateSource::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.UpdateSource)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string uid = 2;
+  if (!this->_internal_uid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uid().data(), static_cast<int>(this->_internal_uid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.UpdateSource.uid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_uid(), target);
+  }
+
+  // .protocol.ObjectValue changed_props = 3;
+  if (this->_internal_has_changed_props()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::changed_props(this),
+        _Internal::changed_props(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 handle = 4;
+  if (this->_internal_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_handle(), target);
+  }
+
+  // .protocol.Style style = 5;
+  if (this->_internal_has_style()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::style(this),
+        _Internal::style(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.UpdateSource)
+  return target;
+}
+
+size_t UpdateSource::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.UpdateSource)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string uid = 2;
+  if (!this->_internal_uid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uid());
+  }
+
+  // .protocol.ObjectValue changed_props = 3;
+  if (this->_internal_has_changed_props()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.changed_props_);
+  }
+
+  // .protocol.Style style = 5;
+  if (this->_internal_has_style()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.style_);
+  }
+
+  // uint32 handle = 4;
+  if (this->_internal_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_handle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateSource::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateSource::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateSource::GetClassData() const { return &_class_data_; }
+
+
+void UpdateSource::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateSource*>(&to_msg);
+  auto& from = static_cast<const UpdateSource&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.UpdateSource)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (from._internal_has_changed_props()) {
+    _this->_internal_mutable_changed_props()->::protocol::ObjectValue::MergeFrom(
+        from._internal_changed_props());
+  }
+  if (from._internal_has_style()) {
+    _this->_internal_mutable_style()->::protocol::Style::MergeFrom(
+        from._internal_style());
+  }
+  if (from._internal_handle() != 0) {
+    _this->_internal_set_handle(from._internal_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UpdateSource::CopyFrom(const UpdateSource& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.UpdateSource)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UpdateSource::IsInitialized() const {
+  return true;
+}
+
+void UpdateSource::InternalSwap(UpdateSource* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uid_, lhs_arena,
+      &other->_impl_.uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(UpdateSource, _impl_.handle_)
+      + sizeof(UpdateSource::_impl_.handle_)
+      - PROTOBUF_FIELD_OFFSET(UpdateSource, _impl_.changed_props_)>(
+          reinterpret_cast<char*>(&_impl_.changed_props_),
+          reinterpret_cast<char*>(&other->_impl_.changed_props_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateSource::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[12]);
+}
+
+// ===================================================================
+
+class CreateScene::_Internal {
+ public:
+  static const ::protocol::ObjectValue& props(const CreateScene* msg);
+  static const ::protocol::Style& style(const CreateScene* msg);
+};
+
+const ::protocol::ObjectValue&
+CreateScene::_Internal::props(const CreateScene* msg) {
+  return *msg->_impl_.props_;
+}
+const ::protocol::Style&
+CreateScene::_Internal::style(const CreateScene* msg) {
+  return *msg->_impl_.style_;
+}
+CreateScene::CreateScene(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.CreateScene)
+}
+CreateScene::CreateScene(const CreateScene& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CreateScene* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uid_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.container_uid_){}
+    , decltype(_impl_.props_){nullptr}
+    , decltype(_impl_.style_){nullptr}
+    , decltype(_impl_.handle_){}
+    , decltype(_impl_.container_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_uid().empty()) {
+    _this->_impl_.uid_.Set(from._internal_uid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.container_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.container_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_container_uid().empty()) {
+    _this->_impl_.container_uid_.Set(from._internal_container_uid(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_props()) {
+    _this->_impl_.props_ = new ::protocol::ObjectValue(*from._impl_.props_);
+  }
+  if (from._internal_has_style()) {
+    _this->_impl_.style_ = new ::protocol::Style(*from._impl_.style_);
+  }
+  ::memcpy(&_impl_.handle_, &from._impl_.handle_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.container_handle_) -
+    reinterpret_cast<char*>(&_impl_.handle_)) + sizeof(_impl_.container_handle_));
+  // @@protoc_insertion_point(copy_constructor:protocol.CreateScene)
+}
+
+inline void CreateScene::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.uid_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.container_uid_){}
+    , decltype(_impl_.props_){nullptr}
+    , decltype(_impl_.style_){nullptr}
+    , decltype(_impl_.handle_){0u}
+    , decltype(_impl_.container_handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.container_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.container_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CreateScene::~CreateScene() {
+  // @@protoc_insertion_point(destructor:protocol.CreateScene)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CreateScene::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uid_.Destroy();
+  _impl_.name_.Destroy();
+  _impl_.container_uid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.props_;
+  if (this != internal_default_instance()) delete _impl_.style_;
+}
+
+void CreateScene::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CreateScene::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.CreateScene)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uid_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  _impl_.container_uid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.props_ != nullptr) {
+    delete _impl_.props_;
+  }
+  _impl_.props_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.style_ != nullptr) {
+    delete _impl_.style_;
+  }
+  _impl_.style_ = nullptr;
+  ::memset(&_impl_.handle_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.container_handle_) -
+      reinterpret_cast<char*>(&_impl_.handle_)) + sizeof(_impl_.container_handle_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CreateScene::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string uid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.CreateScene.uid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.CreateScene.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.ObjectValue props = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_props(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string container_uid = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_container_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.CreateScene.container_uid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 handle = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 container_handle = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.container_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Style style = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_style(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CreateScene::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.CreateScene)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string uid = 1;
+  if (!this->_internal_uid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uid().data(), static_cast<int>(this->_internal_uid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.CreateScene.uid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_uid(), target);
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.CreateScene.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  // .protocol.ObjectValue props = 3;
+  if (this->_internal_has_props()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::props(this),
+        _Internal::props(this).GetCachedSize(), target, stream);
+  }
+
+  // string container_uid = 4;
+  if (!this->_internal_container_uid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_container_uid().data(), static_cast<int>(this->_internal_container_uid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.CreateScene.container_uid");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_container_uid(), target);
+  }
+
+  // uint32 handle = 5;
+  if (this->_internal_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_handle(), target);
+  }
+
+  // uint32 container_handle = 6;
+  if (this->_internal_container_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_container_handle(), target);
+  }
+
+  // .protocol.Style style = 7;
+  if (this->_internal_has_style()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::style(this),
+        _Internal::style(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.CreateScene)
+  return target;
+}
+
+size_t CreateScene::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.CreateScene)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string uid = 1;
+  if (!this->_internal_uid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uid());
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string container_uid = 4;
+  if (!this->_internal_container_uid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_container_uid());
+  }
+
+  // .protocol.ObjectValue props = 3;
+  if (this->_internal_has_props()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.props_);
+  }
+
+  // .protocol.Style style = 7;
+  if (this->_internal_has_style()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.style_);
+  }
+
+  // uint32 handle = 5;
+  if (this->_internal_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_handle());
+  }
+
+  // uint32 container_handle = 6;
+  if (this->_internal_container_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_container_handle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CreateScene::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CreateScene::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CreateScene::GetClassData() const { return &_class_data_; }
+
+
+void CreateScene::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CreateScene*>(&to_msg);
+  auto& from = static_cast<const CreateScene&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.CreateScene)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uid().empty()) {
+    _this->_internal_set_uid(from._internal_uid());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_container_uid().empty()) {
+    _this->_internal_set_container_uid(from._internal_container_uid());
+  }
+  if (from._internal_has_props()) {
+    _this->_internal_mutable_props()->::protocol::ObjectValue::MergeFrom(
+        from._internal_props());
+  }
+  if (from._internal_has_style()) {
+    _this->_internal_mutable_style()->::protocol::Style::MergeFrom(
+        from._internal_style());
+  }
+  if (from._internal_handle() != 0) {
+    _this->_internal_set_handle(from._internal_handle());
+  }
+  if (from._internal_container_handle() != 0) {
+    _this->_internal_set_container_handle(from._internal_container_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CreateScene::CopyFrom(const CreateScene& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.CreateScene)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CreateScene::IsInitialized() const {
+  return true;
+}
+
+void CreateScene::InternalSwap(CreateScene* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uid_, lhs_arena,
+      &other->_impl_.uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.container_uid_, lhs_arena,
+      &other->_impl_.container_uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CreateScene, _impl_.container_handle_)
+      + sizeof(CreateScene::_impl_.container_handle_)
+      - PROTOBUF_FIELD_OFFSET(CreateScene, _impl_.props_)>(
+          reinterpret_cast<char*>(&_impl_.props_),
+          reinterpret_cast<char*>(&other->_impl_.props_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CreateScene::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[13]);
+}
+
+// ===================================================================
+
+class AppendChild::_Internal {
+ public:
+};
+
+AppendChild::AppendChild(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.AppendChild)
+}
+AppendChild::AppendChild(const AppendChild& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AppendChild* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_uid_){}
+    , decltype(_impl_.child_uid_){}
+    , decltype(_impl_.parent_handle_){}
+    , decltype(_impl_.child_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.parent_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.parent_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_parent_uid().empty()) {
+    _this->_impl_.parent_uid_.Set(from._internal_parent_uid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.child_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.child_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_child_uid().empty()) {
+    _this->_impl_.child_uid_.Set(from._internal_child_uid(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.parent_handle_, &from._impl_.parent_handle_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.child_handle_) -
+    reinterpret_cast<char*>(&_impl_.parent_handle_)) + sizeof(_impl_.child_handle_));
+  // @@protoc_insertion_point(copy_constructor:protocol.AppendChild)
+}
+
+inline void AppendChild::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_uid_){}
+    , decltype(_impl_.child_uid_){}
+    , decltype(_impl_.parent_handle_){0u}
+    , decltype(_impl_.child_handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.parent_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.parent_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.child_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.child_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AppendChild::~AppendChild() {
+  // @@protoc_insertion_point(destructor:protocol.AppendChild)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AppendChild::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.parent_uid_.Destroy();
+  _impl_.child_uid_.Destroy();
+}
+
+void AppendChild::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AppendChild::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.AppendChild)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.parent_uid_.ClearToEmpty();
+  _impl_.child_uid_.ClearToEmpty();
+  ::memset(&_impl_.parent_handle_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.child_handle_) -
+      reinterpret_cast<char*>(&_impl_.parent_handle_)) + sizeof(_impl_.child_handle_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AppendChild::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string parent_uid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_parent_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.AppendChild.parent_uid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string child_uid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_child_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.AppendChild.child_uid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 parent_handle = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.parent_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 child_handle = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.child_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AppendChild::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.AppendChild)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string parent_uid = 1;
+  if (!this->_internal_parent_uid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_parent_uid().data(), static_cast<int>(this->_internal_parent_uid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.AppendChild.parent_uid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_parent_uid(), target);
+  }
+
+  // string child_uid = 2;
+  if (!this->_internal_child_uid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_child_uid().data(), static_cast<int>(this->_internal_child_uid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.AppendChild.child_uid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_child_uid(), target);
+  }
+
+  // uint32 parent_handle = 3;
+  if (this->_internal_parent_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_parent_handle(), target);
+  }
+
+  // uint32 child_handle = 4;
+  if (this->_internal_child_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_child_handle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.AppendChild)
+  return target;
+}
+
+size_t AppendChild::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.AppendChild)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string parent_uid = 1;
+  if (!this->_internal_parent_uid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_parent_uid());
+  }
+
+  // string child_uid = 2;
+  if (!this->_internal_child_uid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_child_uid());
+  }
+
+  // uint32 parent_handle = 3;
+  if (this->_internal_parent_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parent_handle());
+  }
+
+  // uint32 child_handle = 4;
+  if (this->_internal_child_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_child_handle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AppendChild::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AppendChild::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AppendChild::GetClassData() const { return &_class_data_; }
+
+
+void AppendChild::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AppendChild*>(&to_msg);
+  auto& from = static_cast<const AppendChild&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.AppendChild)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_parent_uid().empty()) {
+    _this->_internal_set_parent_uid(from._internal_parent_uid());
+  }
+  if (!from._internal_child_uid().empty()) {
+    _this->_internal_set_child_uid(from._internal_child_uid());
+  }
+  if (from._internal_parent_handle() != 0) {
+    _this->_internal_set_parent_handle(from._internal_parent_handle());
+  }
+  if (from._internal_child_handle() != 0) {
+    _this->_internal_set_child_handle(from._internal_child_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AppendChild::CopyFrom(const AppendChild& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.AppendChild)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AppendChild::IsInitialized() const {
+  return true;
+}
+
+void AppendChild::InternalSwap(AppendChild* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.parent_uid_, lhs_arena,
+      &other->_impl_.parent_uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.child_uid_, lhs_arena,
+      &other->_impl_.child_uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AppendChild, _impl_.child_handle_)
+      + sizeof(AppendChild::_impl_.child_handle_)
+      - PROTOBUF_FIELD_OFFSET(AppendChild, _impl_.parent_handle_)>(
+          reinterpret_cast<char*>(&_impl_.parent_handle_),
+          reinterpret_cast<char*>(&other->_impl_.parent_handle_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AppendChild::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[14]);
+}
+
+// ===================================================================
+
+class RemoveChild::_Internal {
+ public:
+};
+
+RemoveChild::RemoveChild(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.RemoveChild)
+}
+RemoveChild::RemoveChild(const RemoveChild& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RemoveChild* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_uid_){}
+    , decltype(_impl_.child_uid_){}
+    , decltype(_impl_.parent_handle_){}
+    , decltype(_impl_.child_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.parent_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.parent_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_parent_uid().empty()) {
+    _this->_impl_.parent_uid_.Set(from._internal_parent_uid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.child_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.child_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_child_uid().empty()) {
+    _this->_impl_.child_uid_.Set(from._internal_child_uid(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.parent_handle_, &from._impl_.parent_handle_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.child_handle_) -
+    reinterpret_cast<char*>(&_impl_.parent_handle_)) + sizeof(_impl_.child_handle_));
+  // @@protoc_insertion_point(copy_constructor:protocol.RemoveChild)
+}
+
+inline void RemoveChild::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_uid_){}
+    , decltype(_impl_.child_uid_){}
+    , decltype(_impl_.parent_handle_){0u}
+    , decltype(_impl_.child_handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.parent_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.parent_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.child_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.child_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RemoveChild::~RemoveChild() {
+  // @@protoc_insertion_point(destructor:protocol.RemoveChild)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RemoveChild::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.parent_uid_.Destroy();
+  _impl_.child_uid_.Destroy();
+}
+
+void RemoveChild::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RemoveChild::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.RemoveChild)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.parent_uid_.ClearToEmpty();
+  _impl_.child_uid_.ClearToEmpty();
+  ::memset(&_impl_.parent_handle_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.child_handle_) -
+      reinterpret_cast<char*>(&_impl_.parent_handle_)) + sizeof(_impl_.child_handle_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RemoveChild::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string parent_uid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_parent_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.RemoveChild.parent_uid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string child_uid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_child_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.RemoveChild.child_uid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 parent_handle = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.parent_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 child_handle = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.child_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RemoveChild::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.RemoveChild)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string parent_uid = 1;
+  if (!this->_internal_parent_uid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_parent_uid().data(), static_cast<int>(this->_internal_parent_uid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.RemoveChild.parent_uid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_parent_uid(), target);
+  }
+
+  // string child_uid = 2;
+  if (!this->_internal_child_uid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_child_uid().data(), static_cast<int>(this->_internal_child_uid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.RemoveChild.child_uid");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_child_uid(), target);
+  }
+
+  // uint32 parent_handle = 3;
+  if (this->_internal_parent_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_parent_handle(), target);
+  }
+
+  // uint32 child_handle = 4;
+  if (this->_internal_child_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_child_handle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.RemoveChild)
+  return target;
+}
+
+size_t RemoveChild::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.RemoveChild)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string parent_uid = 1;
+  if (!this->_internal_parent_uid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_parent_uid());
+  }
+
+  // string child_uid = 2;
+  if (!this->_internal_child_uid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_child_uid());
+  }
+
+  // uint32 parent_handle = 3;
+  if (this->_internal_parent_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parent_handle());
+  }
+
+  // uint32 child_handle = 4;
+  if (this->_internal_child_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_child_handle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RemoveChild::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RemoveChild::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RemoveChild::GetClassData() const { return &_class_data_; }
+
+
+void RemoveChild::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RemoveChild*>(&to_msg);
+  auto& from = static_cast<const RemoveChild&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.RemoveChild)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_parent_uid().empty()) {
+    _this->_internal_set_parent_uid(from._internal_parent_uid());
+  }
+  if (!from._internal_child_uid().empty()) {
+    _this->_internal_set_child_uid(from._internal_child_uid());
+  }
+  if (from._internal_parent_handle() != 0) {
+    _this->_internal_set_parent_handle(from._internal_parent_handle());
+  }
+  if (from._internal_child_handle() != 0) {
+    _this->_internal_set_child_handle(from._internal_child_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RemoveChild::CopyFrom(const RemoveChild& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.RemoveChild)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RemoveChild::IsInitialized() const {
+  return true;
+}
+
+void RemoveChild::InternalSwap(RemoveChild* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.parent_uid_, lhs_arena,
+      &other->_impl_.parent_uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.child_uid_, lhs_arena,
+      &other->_impl_.child_uid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RemoveChild, _impl_.child_handle_)
+      + sizeof(RemoveChild::_impl_.child_handle_)
+      - PROTOBUF_FIELD_OFFSET(RemoveChild, _impl_.parent_handle_)>(
+          reinterpret_cast<char*>(&_impl_.parent_handle_),
+          reinterpret_cast<char*>(&other->_impl_.parent_handle_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RemoveChild::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[15]);
+}
+
+// ===================================================================
+
+class CreateTree::_Internal {
+ public:
+};
+
+CreateTree::CreateTree(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.CreateTree)
+}
+CreateTree::CreateTree(const CreateTree& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CreateTree* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roots_){from._impl_.roots_}
+    , decltype(_impl_.parent_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.parent_handle_ = from._impl_.parent_handle_;
+  // @@protoc_insertion_point(copy_constructor:protocol.CreateTree)
+}
+
+inline void CreateTree::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.roots_){arena}
+    , decltype(_impl_.parent_handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CreateTree::~CreateTree() {
+  // @@protoc_insertion_point(destructor:protocol.CreateTree)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CreateTree::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.roots_.~RepeatedPtrField();
+}
+
+void CreateTree::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CreateTree::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.CreateTree)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.roots_.Clear();
+  _impl_.parent_handle_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CreateTree::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 parent_handle = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.parent_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .protocol.TreeNode roots = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_roots(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CreateTree::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.CreateTree)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 parent_handle = 1;
+  if (this->_internal_parent_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_parent_handle(), target);
+  }
+
+  // repeated .protocol.TreeNode roots = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_roots_size()); i < n; i++) {
+    const auto& repfield = this->_internal_roots(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.CreateTree)
+  return target;
+}
+
+size_t CreateTree::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.CreateTree)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .protocol.TreeNode roots = 2;
+  total_size += 1UL * this->_internal_roots_size();
+  for (const auto& msg : this->_impl_.roots_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint32 parent_handle = 1;
+  if (this->_internal_parent_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parent_handle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CreateTree::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CreateTree::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CreateTree::GetClassData() const { return &_class_data_; }
+
+
+void CreateTree::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CreateTree*>(&to_msg);
+  auto& from = static_cast<const CreateTree&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.CreateTree)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.roots_.MergeFrom(from._impl_.roots_);
+  if (from._internal_parent_handle() != 0) {
+    _this->_internal_set_parent_handle(from._internal_parent_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CreateTree::CopyFrom(const CreateTree& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.CreateTree)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CreateTree::IsInitialized() const {
+  return true;
+}
+
+void CreateTree::InternalSwap(CreateTree* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.roots_.InternalSwap(&other->_impl_.roots_);
+  swap(_impl_.parent_handle_, other->_impl_.parent_handle_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CreateTree::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[16]);
+}
+
+// ===================================================================
+
+class TreeNode::_Internal {
+ public:
+  static const ::protocol::CreateSource& source(const TreeNode* msg);
+  static const ::protocol::CreateScene& scene(const TreeNode* msg);
+};
+
+const ::protocol::CreateSource&
+TreeNode::_Internal::source(const TreeNode* msg) {
+  return *msg->_impl_.node_.source_;
+}
+const ::protocol::CreateScene&
+TreeNode::_Internal::scene(const TreeNode* msg) {
+  return *msg->_impl_.node_.scene_;
+}
+void TreeNode::set_allocated_source(::protocol::CreateSource* source) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_node();
+  if (source) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(source);
+    if (message_arena != submessage_arena) {
+      source = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, source, submessage_arena);
+    }
+    set_has_source();
+    _impl_.node_.source_ = source;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.TreeNode.source)
+}
+void TreeNode::set_allocated_scene(::protocol::CreateScene* scene) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_node();
+  if (scene) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(scene);
+    if (message_arena != submessage_arena) {
+      scene = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, scene, submessage_arena);
+    }
+    set_has_scene();
+    _impl_.node_.scene_ = scene;
+  }
+  // @@protoc_insertion_point(field_set_allocated:protocol.TreeNode.scene)
+}
+TreeNode::TreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.TreeNode)
+}
+TreeNode::TreeNode(const TreeNode& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TreeNode* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.children_){from._impl_.children_}
+    , decltype(_impl_.node_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_node();
+  switch (from.node_case()) {
+    case kSource: {
+      _this->_internal_mutable_source()->::protocol::CreateSource::MergeFrom(
+          from._internal_source());
+      break;
+    }
+    case kScene: {
+      _this->_internal_mutable_scene()->::protocol::CreateScene::MergeFrom(
+          from._internal_scene());
+      break;
+    }
+    case NODE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:protocol.TreeNode)
+}
+
+inline void TreeNode::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.children_){arena}
+    , decltype(_impl_.node_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_node();
+}
+
+TreeNode::~TreeNode() {
+  // @@protoc_insertion_point(destructor:protocol.TreeNode)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TreeNode::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.children_.~RepeatedPtrField();
+  if (has_node()) {
+    clear_node();
+  }
+}
+
+void TreeNode::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TreeNode::clear_node() {
+// @@protoc_insertion_point(one_of_clear_start:protocol.TreeNode)
+  switch (node_case()) {
+    case kSource: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.node_.source_;
+      }
+      break;
+    }
+    case kScene: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.node_.scene_;
+      }
+      break;
+    }
+    case NODE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = NODE_NOT_SET;
+}
+
+
+void TreeNode::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.TreeNode)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.children_.Clear();
+  clear_node();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TreeNode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .protocol.CreateSource source = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_source(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.CreateScene scene = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_scene(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .protocol.TreeNode children = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_children(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TreeNode::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.TreeNode)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .protocol.CreateSource source = 1;
+  if (_internal_has_source()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::source(this),
+        _Internal::source(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.CreateScene scene = 2;
+  if (_internal_has_scene()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::scene(this),
+        _Internal::scene(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .protocol.TreeNode children = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_children_size()); i < n; i++) {
+    const auto& repfield = this->_internal_children(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.TreeNode)
+  return target;
+}
+
+size_t TreeNode::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.TreeNode)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .protocol.TreeNode children = 3;
+  total_size += 1UL * this->_internal_children_size();
+  for (const auto& msg : this->_impl_.children_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  switch (node_case()) {
+    // .protocol.CreateSource source = 1;
+    case kSource: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.node_.source_);
+      break;
+    }
+    // .protocol.CreateScene scene = 2;
+    case kScene: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.node_.scene_);
+      break;
+    }
+    case NODE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TreeNode::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TreeNode::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TreeNode::GetClassData() const { return &_class_data_; }
+
+
+void TreeNode::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TreeNode*>(&to_msg);
+  auto& from = static_cast<const TreeNode&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.TreeNode)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.children_.MergeFrom(from._impl_.children_);
+  switch (from.node_case()) {
+    case kSource: {
+      _this->_internal_mutable_source()->::protocol::CreateSource::MergeFrom(
+          from._internal_source());
+      break;
+    }
+    case kScene: {
+      _this->_internal_mutable_scene()->::protocol::CreateScene::MergeFrom(
+          from._internal_scene());
+      break;
+    }
+    case NODE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TreeNode::CopyFrom(const TreeNode& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.TreeNode)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TreeNode::IsInitialized() const {
+  return true;
+}
+
+void TreeNode::InternalSwap(TreeNode* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.children_.InternalSwap(&other->_impl_.children_);
+  swap(_impl_.node_, other->_impl_.node_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TreeNode::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[17]);
+}
+
+// ===================================================================
+
+class InsertBefore::_Internal {
+ public:
+};
+
+InsertBefore::InsertBefore(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.InsertBefore)
+}
+InsertBefore::InsertBefore(const InsertBefore& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  InsertBefore* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_handle_){}
+    , decltype(_impl_.child_handle_){}
+    , decltype(_impl_.before_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.parent_handle_, &from._impl_.parent_handle_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.before_handle_) -
+    reinterpret_cast<char*>(&_impl_.parent_handle_)) + sizeof(_impl_.before_handle_));
+  // @@protoc_insertion_point(copy_constructor:protocol.InsertBefore)
+}
+
+inline void InsertBefore::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_handle_){0u}
+    , decltype(_impl_.child_handle_){0u}
+    , decltype(_impl_.before_handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+InsertBefore::~InsertBefore() {
+  // @@protoc_insertion_point(destructor:protocol.InsertBefore)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InsertBefore::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void InsertBefore::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InsertBefore::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.InsertBefore)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.parent_handle_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.before_handle_) -
+      reinterpret_cast<char*>(&_impl_.parent_handle_)) + sizeof(_impl_.before_handle_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* InsertBefore::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 parent_handle = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.parent_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 child_handle = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.child_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 before_handle = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.before_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InsertBefore::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.InsertBefore)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 parent_handle = 1;
+  if (this->_internal_parent_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_parent_handle(), target);
+  }
+
+  // uint32 child_handle = 2;
+  if (this->_internal_child_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_child_handle(), target);
+  }
+
+  // uint32 before_handle = 3;
+  if (this->_internal_before_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_before_handle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.InsertBefore)
+  return target;
+}
+
+size_t InsertBefore::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.InsertBefore)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 parent_handle = 1;
+  if (this->_internal_parent_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parent_handle());
+  }
+
+  // uint32 child_handle = 2;
+  if (this->_internal_child_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_child_handle());
+  }
+
+  // uint32 before_handle = 3;
+  if (this->_internal_before_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_before_handle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData InsertBefore::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    InsertBefore::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*InsertBefore::GetClassData() const { return &_class_data_; }
+
+
+void InsertBefore::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<InsertBefore*>(&to_msg);
+  auto& from = static_cast<const InsertBefore&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.InsertBefore)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_parent_handle() != 0) {
+    _this->_internal_set_parent_handle(from._internal_parent_handle());
+  }
+  if (from._internal_child_handle() != 0) {
+    _this->_internal_set_child_handle(from._internal_child_handle());
+  }
+  if (from._internal_before_handle() != 0) {
+    _this->_internal_set_before_handle(from._internal_before_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void InsertBefore::CopyFrom(const InsertBefore& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.InsertBefore)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InsertBefore::IsInitialized() const {
+  return true;
+}
+
+void InsertBefore::InternalSwap(InsertBefore* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InsertBefore, _impl_.before_handle_)
+      + sizeof(InsertBefore::_impl_.before_handle_)
+      - PROTOBUF_FIELD_OFFSET(InsertBefore, _impl_.parent_handle_)>(
+          reinterpret_cast<char*>(&_impl_.parent_handle_),
+          reinterpret_cast<char*>(&other->_impl_.parent_handle_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata InsertBefore::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[18]);
+}
+
+// ===================================================================
+
+class MoveChild::_Internal {
+ public:
+};
+
+MoveChild::MoveChild(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.MoveChild)
+}
+MoveChild::MoveChild(const MoveChild& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MoveChild* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_handle_){}
+    , decltype(_impl_.child_handle_){}
+    , decltype(_impl_.before_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.parent_handle_, &from._impl_.parent_handle_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.before_handle_) -
+    reinterpret_cast<char*>(&_impl_.parent_handle_)) + sizeof(_impl_.before_handle_));
+  // @@protoc_insertion_point(copy_constructor:protocol.MoveChild)
+}
+
+inline void MoveChild::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parent_handle_){0u}
+    , decltype(_impl_.child_handle_){0u}
+    , decltype(_impl_.before_handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MoveChild::~MoveChild() {
+  // @@protoc_insertion_point(destructor:protocol.MoveChild)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MoveChild::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MoveChild::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MoveChild::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.MoveChild)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.parent_handle_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.before_handle_) -
+      reinterpret_cast<char*>(&_impl_.parent_handle_)) + sizeof(_impl_.before_handle_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MoveChild::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 parent_handle = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.parent_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 child_handle = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.child_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 before_handle = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.before_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MoveChild::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.MoveChild)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 parent_handle = 1;
+  if (this->_internal_parent_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_parent_handle(), target);
+  }
+
+  // uint32 child_handle = 2;
+  if (this->_internal_child_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_child_handle(), target);
+  }
+
+  // uint32 before_handle = 3;
+  if (this->_internal_before_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_before_handle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.MoveChild)
+  return target;
+}
+
+size_t MoveChild::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.MoveChild)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 parent_handle = 1;
+  if (this->_internal_parent_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parent_handle());
+  }
+
+  // uint32 child_handle = 2;
+  if (this->_internal_child_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_child_handle());
+  }
+
+  // uint32 before_handle = 3;
+  if (this->_internal_before_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_before_handle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MoveChild::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MoveChild::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MoveChild::GetClassData() const { return &_class_data_; }
+
+
+void MoveChild::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MoveChild*>(&to_msg);
+  auto& from = static_cast<const MoveChild&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.MoveChild)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_parent_handle() != 0) {
+    _this->_internal_set_parent_handle(from._internal_parent_handle());
+  }
+  if (from._internal_child_handle() != 0) {
+    _this->_internal_set_child_handle(from._internal_child_handle());
+  }
+  if (from._internal_before_handle() != 0) {
+    _this->_internal_set_before_handle(from._internal_before_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MoveChild::CopyFrom(const MoveChild& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.MoveChild)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MoveChild::IsInitialized() const {
+  return true;
+}
+
+void MoveChild::InternalSwap(MoveChild* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MoveChild, _impl_.before_handle_)
+      + sizeof(MoveChild::_impl_.before_handle_)
+      - PROTOBUF_FIELD_OFFSET(MoveChild, _impl_.parent_handle_)>(
+          reinterpret_cast<char*>(&_impl_.parent_handle_),
+          reinterpret_cast<char*>(&other->_impl_.parent_handle_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MoveChild::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[19]);
+}
+
+// ===================================================================
+
+class CommitUpdates::_Internal {
+ public:
+};
+
+CommitUpdates::CommitUpdates(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.CommitUpdates)
+}
+CommitUpdates::CommitUpdates(const CommitUpdates& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CommitUpdates* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.container_uid_){}
+    , decltype(_impl_.container_handle_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.container_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.container_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_container_uid().empty()) {
+    _this->_impl_.container_uid_.Set(from._internal_container_uid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.container_handle_ = from._impl_.container_handle_;
+  // @@protoc_insertion_point(copy_constructor:protocol.CommitUpdates)
+}
+
+inline void CommitUpdates::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.container_uid_){}
+    , decltype(_impl_.container_handle_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.container_uid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.container_uid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CommitUpdates::~CommitUpdates() {
+  // @@protoc_insertion_point(destructor:protocol.CommitUpdates)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CommitUpdates::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.container_uid_.Destroy();
+}
+
+void CommitUpdates::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CommitUpdates::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.CommitUpdates)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.container_uid_.ClearToEmpty();
+  _impl_.container_handle_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CommitUpdates::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string container_uid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_container_uid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.CommitUpdates.container_uid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 container_handle = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.container_handle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CommitUpdates::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.CommitUpdates)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string container_uid = 1;
+  if (!this->_internal_container_uid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_container_uid().data(), static_cast<int>(this->_internal_container_uid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.CommitUpdates.container_uid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_container_uid(), target);
+  }
+
+  // uint32 container_handle = 2;
+  if (this->_internal_container_handle() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_container_handle(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.CommitUpdates)
+  return target;
+}
+
+size_t CommitUpdates::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.CommitUpdates)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string container_uid = 1;
+  if (!this->_internal_container_uid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_container_uid());
+  }
+
+  // uint32 container_handle = 2;
+  if (this->_internal_container_handle() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_container_handle());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CommitUpdates::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CommitUpdates::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CommitUpdates::GetClassData() const { return &_class_data_; }
+
+
+void CommitUpdates::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CommitUpdates*>(&to_msg);
+  auto& from = static_cast<const CommitUpdates&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.CommitUpdates)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_container_uid().empty()) {
+    _this->_internal_set_container_uid(from._internal_container_uid());
+  }
+  if (from._internal_container_handle() != 0) {
+    _this->_internal_set_container_handle(from._internal_container_handle());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CommitUpdates::CopyFrom(const CommitUpdates& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.CommitUpdates)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CommitUpdates::IsInitialized() const {
+  return true;
+}
+
+void CommitUpdates::InternalSwap(CommitUpdates* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.container_uid_, lhs_arena,
+      &other->_impl_.container_uid_, rhs_arena
+  );
+  swap(_impl_.container_handle_, other->_impl_.container_handle_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CommitUpdates::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[20]);
+}
+
+// ===================================================================
+
+class DefineKey::_Internal {
+ public:
+};
+
+DefineKey::DefineKey(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.DefineKey)
+}
+DefineKey::DefineKey(const DefineKey& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DefineKey* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:protocol.DefineKey)
+}
+
+inline void DefineKey::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DefineKey::~DefineKey() {
+  // @@protoc_insertion_point(destructor:protocol.DefineKey)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DefineKey::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+}
+
+void DefineKey::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DefineKey::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.DefineKey)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DefineKey::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.DefineKey.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DefineKey::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.DefineKey)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // string key = 2;
+  if (!this->_internal_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.DefineKey.key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_key(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.DefineKey)
+  return target;
+}
+
+size_t DefineKey::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.DefineKey)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string key = 2;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_key());
+  }
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DefineKey::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DefineKey::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DefineKey::GetClassData() const { return &_class_data_; }
+
+
+void DefineKey::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DefineKey*>(&to_msg);
+  auto& from = static_cast<const DefineKey&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.DefineKey)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DefineKey::CopyFrom(const DefineKey& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.DefineKey)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DefineKey::IsInitialized() const {
+  return true;
+}
+
+void DefineKey::InternalSwap(DefineKey* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  swap(_impl_.id_, other->_impl_.id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DefineKey::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[21]);
+}
+
+// ===================================================================
+
+class DefineString::_Internal {
+ public:
+};
+
+DefineString::DefineString(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.DefineString)
+}
+DefineString::DefineString(const DefineString& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DefineString* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.id_ = from._impl_.id_;
+  // @@protoc_insertion_point(copy_constructor:protocol.DefineString)
+}
+
+inline void DefineString::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DefineString::~DefineString() {
+  // @@protoc_insertion_point(destructor:protocol.DefineString)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DefineString::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
+}
+
+void DefineString::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DefineString::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.DefineString)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.ClearToEmpty();
+  _impl_.id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DefineString::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.DefineString.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DefineString::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.DefineString)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
+  }
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "protocol.DefineString.value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.DefineString)
+  return target;
+}
+
+size_t DefineString::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.DefineString)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  // uint32 id = 1;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DefineString::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DefineString::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DefineString::GetClassData() const { return &_class_data_; }
+
+
+void DefineString::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DefineString*>(&to_msg);
+  auto& from = static_cast<const DefineString&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.DefineString)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DefineString::CopyFrom(const DefineString& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.DefineString)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DefineString::IsInitialized() const {
+  return true;
+}
+
+void DefineString::InternalSwap(DefineString* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.id_, other->_impl_.id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DefineString::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[22]);
+}
+
+// ===================================================================
+
+class Style::_Internal {
+ public:
+  static const ::protocol::Dimension& flex_basis(const Style* msg);
+  static const ::protocol::Dimension& top(const Style* msg);
+  static const ::protocol::Dimension& left(const Style* msg);
+  static const ::protocol::Dimension& right(const Style* msg);
+  static const ::protocol::Dimension& bottom(const Style* msg);
+  static const ::protocol::Dimension& margin_top(const Style* msg);
+  static const ::protocol::Dimension& margin_left(const Style* msg);
+  static const ::protocol::Dimension& margin_right(const Style* msg);
+  static const ::protocol::Dimension& margin_bottom(const Style* msg);
+  static const ::protocol::Dimension& padding_top(const Style* msg);
+  static const ::protocol::Dimension& padding_left(const Style* msg);
+  static const ::protocol::Dimension& padding_right(const Style* msg);
+  static const ::protocol::Dimension& padding_bottom(const Style* msg);
+  static const ::protocol::Dimension& width(const Style* msg);
+  static const ::protocol::Dimension& height(const Style* msg);
+  static const ::protocol::Dimension& min_width(const Style* msg);
+  static const ::protocol::Dimension& max_width(const Style* msg);
+  static const ::protocol::Dimension& min_height(const Style* msg);
+  static const ::protocol::Dimension& max_height(const Style* msg);
+};
+
+const ::protocol::Dimension&
+Style::_Internal::flex_basis(const Style* msg) {
+  return *msg->_impl_.flex_basis_;
+}
+const ::protocol::Dimension&
+Style::_Internal::top(const Style* msg) {
+  return *msg->_impl_.top_;
+}
+const ::protocol::Dimension&
+Style::_Internal::left(const Style* msg) {
+  return *msg->_impl_.left_;
+}
+const ::protocol::Dimension&
+Style::_Internal::right(const Style* msg) {
+  return *msg->_impl_.right_;
+}
+const ::protocol::Dimension&
+Style::_Internal::bottom(const Style* msg) {
+  return *msg->_impl_.bottom_;
+}
+const ::protocol::Dimension&
+Style::_Internal::margin_top(const Style* msg) {
+  return *msg->_impl_.margin_top_;
+}
+const ::protocol::Dimension&
+Style::_Internal::margin_left(const Style* msg) {
+  return *msg->_impl_.margin_left_;
+}
+const ::protocol::Dimension&
+Style::_Internal::margin_right(const Style* msg) {
+  return *msg->_impl_.margin_right_;
+}
+const ::protocol::Dimension&
+Style::_Internal::margin_bottom(const Style* msg) {
+  return *msg->_impl_.margin_bottom_;
+}
+const ::protocol::Dimension&
+Style::_Internal::padding_top(const Style* msg) {
+  return *msg->_impl_.padding_top_;
+}
+const ::protocol::Dimension&
+Style::_Internal::padding_left(const Style* msg) {
+  return *msg->_impl_.padding_left_;
+}
+const ::protocol::Dimension&
+Style::_Internal::padding_right(const Style* msg) {
+  return *msg->_impl_.padding_right_;
+}
+const ::protocol::Dimension&
+Style::_Internal::padding_bottom(const Style* msg) {
+  return *msg->_impl_.padding_bottom_;
+}
+const ::protocol::Dimension&
+Style::_Internal::width(const Style* msg) {
+  return *msg->_impl_.width_;
+}
+const ::protocol::Dimension&
+Style::_Internal::height(const Style* msg) {
+  return *msg->_impl_.height_;
+}
+const ::protocol::Dimension&
+Style::_Internal::min_width(const Style* msg) {
+  return *msg->_impl_.min_width_;
+}
+const ::protocol::Dimension&
+Style::_Internal::max_width(const Style* msg) {
+  return *msg->_impl_.max_width_;
+}
+const ::protocol::Dimension&
+Style::_Internal::min_height(const Style* msg) {
+  return *msg->_impl_.min_height_;
+}
+const ::protocol::Dimension&
+Style::_Internal::max_height(const Style* msg) {
+  return *msg->_impl_.max_height_;
+}
+Style::Style(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.Style)
+}
+Style::Style(const Style& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Style* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.flex_basis_){nullptr}
+    , decltype(_impl_.top_){nullptr}
+    , decltype(_impl_.left_){nullptr}
+    , decltype(_impl_.right_){nullptr}
+    , decltype(_impl_.bottom_){nullptr}
+    , decltype(_impl_.margin_top_){nullptr}
+    , decltype(_impl_.margin_left_){nullptr}
+    , decltype(_impl_.margin_right_){nullptr}
+    , decltype(_impl_.margin_bottom_){nullptr}
+    , decltype(_impl_.padding_top_){nullptr}
+    , decltype(_impl_.padding_left_){nullptr}
+    , decltype(_impl_.padding_right_){nullptr}
+    , decltype(_impl_.padding_bottom_){nullptr}
+    , decltype(_impl_.width_){nullptr}
+    , decltype(_impl_.height_){nullptr}
+    , decltype(_impl_.min_width_){nullptr}
+    , decltype(_impl_.max_width_){nullptr}
+    , decltype(_impl_.min_height_){nullptr}
+    , decltype(_impl_.max_height_){nullptr}
+    , decltype(_impl_.present_){}
+    , decltype(_impl_.flex_direction_){}
+    , decltype(_impl_.direction_){}
+    , decltype(_impl_.justify_content_){}
+    , decltype(_impl_.align_content_){}
+    , decltype(_impl_.align_items_){}
+    , decltype(_impl_.align_self_){}
+    , decltype(_impl_.position_){}
+    , decltype(_impl_.flex_wrap_){}
+    , decltype(_impl_.overflow_){}
+    , decltype(_impl_.display_){}
+    , decltype(_impl_.flex_grow_){}
+    , decltype(_impl_.flex_shrink_){}
+    , decltype(_impl_.aspect_ratio_){}
+    , decltype(_impl_.patch_){}
+    , decltype(_impl_.unset_){}
+    , decltype(_impl_.z_index_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_flex_basis()) {
+    _this->_impl_.flex_basis_ = new ::protocol::Dimension(*from._impl_.flex_basis_);
+  }
+  if (from._internal_has_top()) {
+    _this->_impl_.top_ = new ::protocol::Dimension(*from._impl_.top_);
+  }
+  if (from._internal_has_left()) {
+    _this->_impl_.left_ = new ::protocol::Dimension(*from._impl_.left_);
+  }
+  if (from._internal_has_right()) {
+    _this->_impl_.right_ = new ::protocol::Dimension(*from._impl_.right_);
+  }
+  if (from._internal_has_bottom()) {
+    _this->_impl_.bottom_ = new ::protocol::Dimension(*from._impl_.bottom_);
+  }
+  if (from._internal_has_margin_top()) {
+    _this->_impl_.margin_top_ = new ::protocol::Dimension(*from._impl_.margin_top_);
+  }
+  if (from._internal_has_margin_left()) {
+    _this->_impl_.margin_left_ = new ::protocol::Dimension(*from._impl_.margin_left_);
+  }
+  if (from._internal_has_margin_right()) {
+    _this->_impl_.margin_right_ = new ::protocol::Dimension(*from._impl_.margin_right_);
+  }
+  if (from._internal_has_margin_bottom()) {
+    _this->_impl_.margin_bottom_ = new ::protocol::Dimension(*from._impl_.margin_bottom_);
+  }
+  if (from._internal_has_padding_top()) {
+    _this->_impl_.padding_top_ = new ::protocol::Dimension(*from._impl_.padding_top_);
+  }
+  if (from._internal_has_padding_left()) {
+    _this->_impl_.padding_left_ = new ::protocol::Dimension(*from._impl_.padding_left_);
+  }
+  if (from._internal_has_padding_right()) {
+    _this->_impl_.padding_right_ = new ::protocol::Dimension(*from._impl_.padding_right_);
+  }
+  if (from._internal_has_padding_bottom()) {
+    _this->_impl_.padding_bottom_ = new ::protocol::Dimension(*from._impl_.padding_bottom_);
+  }
+  if (from._internal_has_width()) {
+    _this->_impl_.width_ = new ::protocol::Dimension(*from._impl_.width_);
+  }
+  if (from._internal_has_height()) {
+    _this->_impl_.height_ = new ::protocol::Dimension(*from._impl_.height_);
+  }
+  if (from._internal_has_min_width()) {
+    _this->_impl_.min_width_ = new ::protocol::Dimension(*from._impl_.min_width_);
+  }
+  if (from._internal_has_max_width()) {
+    _this->_impl_.max_width_ = new ::protocol::Dimension(*from._impl_.max_width_);
+  }
+  if (from._internal_has_min_height()) {
+    _this->_impl_.min_height_ = new ::protocol::Dimension(*from._impl_.min_height_);
+  }
+  if (from._internal_has_max_height()) {
+    _this->_impl_.max_height_ = new ::protocol::Dimension(*from._impl_.max_height_);
+  }
+  ::memcpy(&_impl_.present_, &from._impl_.present_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.z_index_) -
+    reinterpret_cast<char*>(&_impl_.present_)) + sizeof(_impl_.z_index_));
+  // @@protoc_insertion_point(copy_constructor:protocol.Style)
+}
+
+inline void Style::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.flex_basis_){nullptr}
+    , decltype(_impl_.top_){nullptr}
+    , decltype(_impl_.left_){nullptr}
+    , decltype(_impl_.right_){nullptr}
+    , decltype(_impl_.bottom_){nullptr}
+    , decltype(_impl_.margin_top_){nullptr}
+    , decltype(_impl_.margin_left_){nullptr}
+    , decltype(_impl_.margin_right_){nullptr}
+    , decltype(_impl_.margin_bottom_){nullptr}
+    , decltype(_impl_.padding_top_){nullptr}
+    , decltype(_impl_.padding_left_){nullptr}
+    , decltype(_impl_.padding_right_){nullptr}
+    , decltype(_impl_.padding_bottom_){nullptr}
+    , decltype(_impl_.width_){nullptr}
+    , decltype(_impl_.height_){nullptr}
+    , decltype(_impl_.min_width_){nullptr}
+    , decltype(_impl_.max_width_){nullptr}
+    , decltype(_impl_.min_height_){nullptr}
+    , decltype(_impl_.max_height_){nullptr}
+    , decltype(_impl_.present_){uint64_t{0u}}
+    , decltype(_impl_.flex_direction_){0}
+    , decltype(_impl_.direction_){0}
+    , decltype(_impl_.justify_content_){0}
+    , decltype(_impl_.align_content_){0}
+    , decltype(_impl_.align_items_){0}
+    , decltype(_impl_.align_self_){0}
+    , decltype(_impl_.position_){0}
+    , decltype(_impl_.flex_wrap_){0}
+    , decltype(_impl_.overflow_){0}
+    , decltype(_impl_.display_){0}
+    , decltype(_impl_.flex_grow_){0}
+    , decltype(_impl_.flex_shrink_){0}
+    , decltype(_impl_.aspect_ratio_){0}
+    , decltype(_impl_.patch_){false}
+    , decltype(_impl_.unset_){uint64_t{0u}}
+    , decltype(_impl_.z_index_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Style::~Style() {
+  // @@protoc_insertion_point(destructor:protocol.Style)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Style::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.flex_basis_;
+  if (this != internal_default_instance()) delete _impl_.top_;
+  if (this != internal_default_instance()) delete _impl_.left_;
+  if (this != internal_default_instance()) delete _impl_.right_;
+  if (this != internal_default_instance()) delete _impl_.bottom_;
+  if (this != internal_default_instance()) delete _impl_.margin_top_;
+  if (this != internal_default_instance()) delete _impl_.margin_left_;
+  if (this != internal_default_instance()) delete _impl_.margin_right_;
+  if (this != internal_default_instance()) delete _impl_.margin_bottom_;
+  if (this != internal_default_instance()) delete _impl_.padding_top_;
+  if (this != internal_default_instance()) delete _impl_.padding_left_;
+  if (this != internal_default_instance()) delete _impl_.padding_right_;
+  if (this != internal_default_instance()) delete _impl_.padding_bottom_;
+  if (this != internal_default_instance()) delete _impl_.width_;
+  if (this != internal_default_instance()) delete _impl_.height_;
+  if (this != internal_default_instance()) delete _impl_.min_width_;
+  if (this != internal_default_instance()) delete _impl_.max_width_;
+  if (this != internal_default_instance()) delete _impl_.min_height_;
+  if (this != internal_default_instance()) delete _impl_.max_height_;
+}
+
+void Style::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Style::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.Style)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.flex_basis_ != nullptr) {
+    delete _impl_.flex_basis_;
+  }
+  _impl_.flex_basis_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.top_ != nullptr) {
+    delete _impl_.top_;
+  }
+  _impl_.top_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.left_ != nullptr) {
+    delete _impl_.left_;
+  }
+  _impl_.left_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.right_ != nullptr) {
+    delete _impl_.right_;
+  }
+  _impl_.right_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.bottom_ != nullptr) {
+    delete _impl_.bottom_;
+  }
+  _impl_.bottom_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.margin_top_ != nullptr) {
+    delete _impl_.margin_top_;
+  }
+  _impl_.margin_top_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.margin_left_ != nullptr) {
+    delete _impl_.margin_left_;
+  }
+  _impl_.margin_left_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.margin_right_ != nullptr) {
+    delete _impl_.margin_right_;
+  }
+  _impl_.margin_right_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.margin_bottom_ != nullptr) {
+    delete _impl_.margin_bottom_;
+  }
+  _impl_.margin_bottom_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.padding_top_ != nullptr) {
+    delete _impl_.padding_top_;
+  }
+  _impl_.padding_top_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.padding_left_ != nullptr) {
+    delete _impl_.padding_left_;
+  }
+  _impl_.padding_left_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.padding_right_ != nullptr) {
+    delete _impl_.padding_right_;
+  }
+  _impl_.padding_right_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.padding_bottom_ != nullptr) {
+    delete _impl_.padding_bottom_;
+  }
+  _impl_.padding_bottom_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.width_ != nullptr) {
+    delete _impl_.width_;
+  }
+  _impl_.width_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.height_ != nullptr) {
+    delete _impl_.height_;
+  }
+  _impl_.height_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.min_width_ != nullptr) {
+    delete _impl_.min_width_;
+  }
+  _impl_.min_width_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.max_width_ != nullptr) {
+    delete _impl_.max_width_;
+  }
+  _impl_.max_width_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.min_height_ != nullptr) {
+    delete _impl_.min_height_;
+  }
+  _impl_.min_height_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.max_height_ != nullptr) {
+    delete _impl_.max_height_;
+  }
+  _impl_.max_height_ = nullptr;
+  ::memset(&_impl_.present_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.z_index_) -
+      reinterpret_cast<char*>(&_impl_.present_)) + sizeof(_impl_.z_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Style::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 present = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.present_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.FlexDirection flex_direction = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_flex_direction(static_cast<::protocol::FlexDirection>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Direction direction = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_direction(static_cast<::protocol::Direction>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Justify justify_content = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_justify_content(static_cast<::protocol::Justify>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Align align_content = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_align_content(static_cast<::protocol::Align>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Align align_items = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_align_items(static_cast<::protocol::Align>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Align align_self = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_align_self(static_cast<::protocol::Align>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.PositionType position = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_position(static_cast<::protocol::PositionType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Wrap flex_wrap = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_flex_wrap(static_cast<::protocol::Wrap>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Overflow overflow = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_overflow(static_cast<::protocol::Overflow>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Display display = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_display(static_cast<::protocol::Display>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // float flex_grow = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 101)) {
+          _impl_.flex_grow_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float flex_shrink = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 109)) {
+          _impl_.flex_shrink_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension flex_basis = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_flex_basis(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension top = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_top(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension left = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_left(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension right = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_right(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension bottom = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bottom(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension margin_top = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_margin_top(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension margin_left = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ctx->ParseMessage(_internal_mutable_margin_left(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension margin_right = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr = ctx->ParseMessage(_internal_mutable_margin_right(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension margin_bottom = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr = ctx->ParseMessage(_internal_mutable_margin_bottom(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension padding_top = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 186)) {
+          ptr = ctx->ParseMessage(_internal_mutable_padding_top(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension padding_left = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          ptr = ctx->ParseMessage(_internal_mutable_padding_left(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension padding_right = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 202)) {
+          ptr = ctx->ParseMessage(_internal_mutable_padding_right(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension padding_bottom = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 210)) {
+          ptr = ctx->ParseMessage(_internal_mutable_padding_bottom(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float aspect_ratio = 27;
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 221)) {
+          _impl_.aspect_ratio_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension width = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 226)) {
+          ptr = ctx->ParseMessage(_internal_mutable_width(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension height = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 234)) {
+          ptr = ctx->ParseMessage(_internal_mutable_height(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension min_width = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
+          ptr = ctx->ParseMessage(_internal_mutable_min_width(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension max_width = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 250)) {
+          ptr = ctx->ParseMessage(_internal_mutable_max_width(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension min_height = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          ptr = ctx->ParseMessage(_internal_mutable_min_height(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .protocol.Dimension max_height = 33;
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_max_height(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool patch = 34;
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.patch_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 unset = 35;
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.unset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 z_index = 36;
+      case 36:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.z_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Style::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.Style)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 present = 1;
+  if (this->_internal_present() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_present(), target);
+  }
+
+  // .protocol.FlexDirection flex_direction = 2;
+  if (this->_internal_flex_direction() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_flex_direction(), target);
+  }
+
+  // .protocol.Direction direction = 3;
+  if (this->_internal_direction() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_direction(), target);
+  }
+
+  // .protocol.Justify justify_content = 4;
+  if (this->_internal_justify_content() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_justify_content(), target);
+  }
+
+  // .protocol.Align align_content = 5;
+  if (this->_internal_align_content() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_align_content(), target);
+  }
+
+  // .protocol.Align align_items = 6;
+  if (this->_internal_align_items() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_align_items(), target);
+  }
+
+  // .protocol.Align align_self = 7;
+  if (this->_internal_align_self() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_align_self(), target);
+  }
+
+  // .protocol.PositionType position = 8;
+  if (this->_internal_position() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_position(), target);
+  }
+
+  // .protocol.Wrap flex_wrap = 9;
+  if (this->_internal_flex_wrap() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      9, this->_internal_flex_wrap(), target);
+  }
+
+  // .protocol.Overflow overflow = 10;
+  if (this->_internal_overflow() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      10, this->_internal_overflow(), target);
+  }
+
+  // .protocol.Display display = 11;
+  if (this->_internal_display() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      11, this->_internal_display(), target);
+  }
+
+  // float flex_grow = 12;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_flex_grow = this->_internal_flex_grow();
+  uint32_t raw_flex_grow;
+  memcpy(&raw_flex_grow, &tmp_flex_grow, sizeof(tmp_flex_grow));
+  if (raw_flex_grow != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(12, this->_internal_flex_grow(), target);
+  }
+
+  // float flex_shrink = 13;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_flex_shrink = this->_internal_flex_shrink();
+  uint32_t raw_flex_shrink;
+  memcpy(&raw_flex_shrink, &tmp_flex_shrink, sizeof(tmp_flex_shrink));
+  if (raw_flex_shrink != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(13, this->_internal_flex_shrink(), target);
+  }
+
+  // .protocol.Dimension flex_basis = 14;
+  if (this->_internal_has_flex_basis()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::flex_basis(this),
+        _Internal::flex_basis(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension top = 15;
+  if (this->_internal_has_top()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, _Internal::top(this),
+        _Internal::top(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension left = 16;
+  if (this->_internal_has_left()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(16, _Internal::left(this),
+        _Internal::left(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension right = 17;
+  if (this->_internal_has_right()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, _Internal::right(this),
+        _Internal::right(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension bottom = 18;
+  if (this->_internal_has_bottom()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::bottom(this),
+        _Internal::bottom(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension margin_top = 19;
+  if (this->_internal_has_margin_top()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, _Internal::margin_top(this),
+        _Internal::margin_top(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension margin_left = 20;
+  if (this->_internal_has_margin_left()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(20, _Internal::margin_left(this),
+        _Internal::margin_left(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension margin_right = 21;
+  if (this->_internal_has_margin_right()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(21, _Internal::margin_right(this),
+        _Internal::margin_right(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension margin_bottom = 22;
+  if (this->_internal_has_margin_bottom()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(22, _Internal::margin_bottom(this),
+        _Internal::margin_bottom(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension padding_top = 23;
+  if (this->_internal_has_padding_top()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(23, _Internal::padding_top(this),
+        _Internal::padding_top(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension padding_left = 24;
+  if (this->_internal_has_padding_left()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(24, _Internal::padding_left(this),
+        _Internal::padding_left(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension padding_right = 25;
+  if (this->_internal_has_padding_right()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(25, _Internal::padding_right(this),
+        _Internal::padding_right(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension padding_bottom = 26;
+  if (this->_internal_has_padding_bottom()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(26, _Internal::padding_bottom(this),
+        _Internal::padding_bottom(this).GetCachedSize(), target, stream);
+  }
+
+  // float aspect_ratio = 27;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_aspect_ratio = this->_internal_aspect_ratio();
+  uint32_t raw_aspect_ratio;
+  memcpy(&raw_aspect_ratio, &tmp_aspect_ratio, sizeof(tmp_aspect_ratio));
+  if (raw_aspect_ratio != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(27, this->_internal_aspect_ratio(), target);
+  }
+
+  // .protocol.Dimension width = 28;
+  if (this->_internal_has_width()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(28, _Internal::width(this),
+        _Internal::width(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension height = 29;
+  if (this->_internal_has_height()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(29, _Internal::height(this),
+        _Internal::height(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension min_width = 30;
+  if (this->_internal_has_min_width()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(30, _Internal::min_width(this),
+        _Internal::min_width(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension max_width = 31;
+  if (this->_internal_has_max_width()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(31, _Internal::max_width(this),
+        _Internal::max_width(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension min_height = 32;
+  if (this->_internal_has_min_height()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(32, _Internal::min_height(this),
+        _Internal::min_height(this).GetCachedSize(), target, stream);
+  }
+
+  // .protocol.Dimension max_height = 33;
+  if (this->_internal_has_max_height()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(33, _Internal::max_height(this),
+        _Internal::max_height(this).GetCachedSize(), target, stream);
+  }
+
+  // bool patch = 34;
+  if (this->_internal_patch() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(34, this->_internal_patch(), target);
+  }
+
+  // uint64 unset = 35;
+  if (this->_internal_unset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(35, this->_internal_unset(), target);
+  }
+
+  // int32 z_index = 36;
+  if (this->_internal_z_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(36, this->_internal_z_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.Style)
+  return target;
+}
+
+size_t Style::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.Style)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .protocol.Dimension flex_basis = 14;
+  if (this->_internal_has_flex_basis()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.flex_basis_);
+  }
+
+  // .protocol.Dimension top = 15;
+  if (this->_internal_has_top()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.top_);
+  }
+
+  // .protocol.Dimension left = 16;
+  if (this->_internal_has_left()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.left_);
+  }
+
+  // .protocol.Dimension right = 17;
+  if (this->_internal_has_right()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.right_);
+  }
+
+  // .protocol.Dimension bottom = 18;
+  if (this->_internal_has_bottom()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.bottom_);
+  }
+
+  // .protocol.Dimension margin_top = 19;
+  if (this->_internal_has_margin_top()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.margin_top_);
+  }
+
+  // .protocol.Dimension margin_left = 20;
+  if (this->_internal_has_margin_left()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.margin_left_);
+  }
+
+  // .protocol.Dimension margin_right = 21;
+  if (this->_internal_has_margin_right()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.margin_right_);
+  }
+
+  // .protocol.Dimension margin_bottom = 22;
+  if (this->_internal_has_margin_bottom()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.margin_bottom_);
+  }
+
+  // .protocol.Dimension padding_top = 23;
+  if (this->_internal_has_padding_top()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.padding_top_);
+  }
+
+  // .protocol.Dimension padding_left = 24;
+  if (this->_internal_has_padding_left()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.padding_left_);
+  }
+
+  // .protocol.Dimension padding_right = 25;
+  if (this->_internal_has_padding_right()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.padding_right_);
+  }
+
+  // .protocol.Dimension padding_bottom = 26;
+  if (this->_internal_has_padding_bottom()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.padding_bottom_);
+  }
+
+  // .protocol.Dimension width = 28;
+  if (this->_internal_has_width()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.width_);
+  }
+
+  // .protocol.Dimension height = 29;
+  if (this->_internal_has_height()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.height_);
+  }
+
+  // .protocol.Dimension min_width = 30;
+  if (this->_internal_has_min_width()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.min_width_);
+  }
+
+  // .protocol.Dimension max_width = 31;
+  if (this->_internal_has_max_width()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.max_width_);
+  }
+
+  // .protocol.Dimension min_height = 32;
+  if (this->_internal_has_min_height()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.min_height_);
+  }
+
+  // .protocol.Dimension max_height = 33;
+  if (this->_internal_has_max_height()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.max_height_);
+  }
+
+  // uint64 present = 1;
+  if (this->_internal_present() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_present());
+  }
+
+  // .protocol.FlexDirection flex_direction = 2;
+  if (this->_internal_flex_direction() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_flex_direction());
+  }
+
+  // .protocol.Direction direction = 3;
+  if (this->_internal_direction() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_direction());
+  }
+
+  // .protocol.Justify justify_content = 4;
+  if (this->_internal_justify_content() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_justify_content());
+  }
+
+  // .protocol.Align align_content = 5;
+  if (this->_internal_align_content() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_align_content());
+  }
+
+  // .protocol.Align align_items = 6;
+  if (this->_internal_align_items() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_align_items());
+  }
+
+  // .protocol.Align align_self = 7;
+  if (this->_internal_align_self() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_align_self());
+  }
+
+  // .protocol.PositionType position = 8;
+  if (this->_internal_position() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_position());
+  }
+
+  // .protocol.Wrap flex_wrap = 9;
+  if (this->_internal_flex_wrap() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_flex_wrap());
+  }
+
+  // .protocol.Overflow overflow = 10;
+  if (this->_internal_overflow() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_overflow());
+  }
+
+  // .protocol.Display display = 11;
+  if (this->_internal_display() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_display());
+  }
+
+  // float flex_grow = 12;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_flex_grow = this->_internal_flex_grow();
+  uint32_t raw_flex_grow;
+  memcpy(&raw_flex_grow, &tmp_flex_grow, sizeof(tmp_flex_grow));
+  if (raw_flex_grow != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float flex_shrink = 13;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_flex_shrink = this->_internal_flex_shrink();
+  uint32_t raw_flex_shrink;
+  memcpy(&raw_flex_shrink, &tmp_flex_shrink, sizeof(tmp_flex_shrink));
+  if (raw_flex_shrink != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float aspect_ratio = 27;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_aspect_ratio = this->_internal_aspect_ratio();
+  uint32_t raw_aspect_ratio;
+  memcpy(&raw_aspect_ratio, &tmp_aspect_ratio, sizeof(tmp_aspect_ratio));
+  if (raw_aspect_ratio != 0) {
+    total_size += 2 + 4;
+  }
+
+  // bool patch = 34;
+  if (this->_internal_patch() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // uint64 unset = 35;
+  if (this->_internal_unset() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_unset());
+  }
+
+  // int32 z_index = 36;
+  if (this->_internal_z_index() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_z_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Style::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Style::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Style::GetClassData() const { return &_class_data_; }
+
+
+void Style::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Style*>(&to_msg);
+  auto& from = static_cast<const Style&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.Style)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_flex_basis()) {
+    _this->_internal_mutable_flex_basis()->::protocol::Dimension::MergeFrom(
+        from._internal_flex_basis());
+  }
+  if (from._internal_has_top()) {
+    _this->_internal_mutable_top()->::protocol::Dimension::MergeFrom(
+        from._internal_top());
+  }
+  if (from._internal_has_left()) {
+    _this->_internal_mutable_left()->::protocol::Dimension::MergeFrom(
+        from._internal_left());
+  }
+  if (from._internal_has_right()) {
+    _this->_internal_mutable_right()->::protocol::Dimension::MergeFrom(
+        from._internal_right());
+  }
+  if (from._internal_has_bottom()) {
+    _this->_internal_mutable_bottom()->::protocol::Dimension::MergeFrom(
+        from._internal_bottom());
+  }
+  if (from._internal_has_margin_top()) {
+    _this->_internal_mutable_margin_top()->::protocol::Dimension::MergeFrom(
+        from._internal_margin_top());
+  }
+  if (from._internal_has_margin_left()) {
+    _this->_internal_mutable_margin_left()->::protocol::Dimension::MergeFrom(
+        from._internal_margin_left());
+  }
+  if (from._internal_has_margin_right()) {
+    _this->_internal_mutable_margin_right()->::protocol::Dimension::MergeFrom(
+        from._internal_margin_right());
+  }
+  if (from._internal_has_margin_bottom()) {
+    _this->_internal_mutable_margin_bottom()->::protocol::Dimension::MergeFrom(
+        from._internal_margin_bottom());
+  }
+  if (from._internal_has_padding_top()) {
+    _this->_internal_mutable_padding_top()->::protocol::Dimension::MergeFrom(
+        from._internal_padding_top());
+  }
+  if (from._internal_has_padding_left()) {
+    _this->_internal_mutable_padding_left()->::protocol::Dimension::MergeFrom(
+        from._internal_padding_left());
+  }
+  if (from._internal_has_padding_right()) {
+    _this->_internal_mutable_padding_right()->::protocol::Dimension::MergeFrom(
+        from._internal_padding_right());
+  }
+  if (from._internal_has_padding_bottom()) {
+    _this->_internal_mutable_padding_bottom()->::protocol::Dimension::MergeFrom(
+        from._internal_padding_bottom());
+  }
+  if (from._internal_has_width()) {
+    _this->_internal_mutable_width()->::protocol::Dimension::MergeFrom(
+        from._internal_width());
+  }
+  if (from._internal_has_height()) {
+    _this->_internal_mutable_height()->::protocol::Dimension::MergeFrom(
+        from._internal_height());
+  }
+  if (from._internal_has_min_width()) {
+    _this->_internal_mutable_min_width()->::protocol::Dimension::MergeFrom(
+        from._internal_min_width());
+  }
+  if (from._internal_has_max_width()) {
+    _this->_internal_mutable_max_width()->::protocol::Dimension::MergeFrom(
+        from._internal_max_width());
+  }
+  if (from._internal_has_min_height()) {
+    _this->_internal_mutable_min_height()->::protocol::Dimension::MergeFrom(
+        from._internal_min_height());
+  }
+  if (from._internal_has_max_height()) {
+    _this->_internal_mutable_max_height()->::protocol::Dimension::MergeFrom(
+        from._internal_max_height());
+  }
+  if (from._internal_present() != 0) {
+    _this->_internal_set_present(from._internal_present());
+  }
+  if (from._internal_flex_direction() != 0) {
+    _this->_internal_set_flex_direction(from._internal_flex_direction());
+  }
+  if (from._internal_direction() != 0) {
+    _this->_internal_set_direction(from._internal_direction());
+  }
+  if (from._internal_justify_content() != 0) {
+    _this->_internal_set_justify_content(from._internal_justify_content());
+  }
+  if (from._internal_align_content() != 0) {
+    _this->_internal_set_align_content(from._internal_align_content());
+  }
+  if (from._internal_align_items() != 0) {
+    _this->_internal_set_align_items(from._internal_align_items());
+  }
+  if (from._internal_align_self() != 0) {
+    _this->_internal_set_align_self(from._internal_align_self());
+  }
+  if (from._internal_position() != 0) {
+    _this->_internal_set_position(from._internal_position());
+  }
+  if (from._internal_flex_wrap() != 0) {
+    _this->_internal_set_flex_wrap(from._internal_flex_wrap());
+  }
+  if (from._internal_overflow() != 0) {
+    _this->_internal_set_overflow(from._internal_overflow());
+  }
+  if (from._internal_display() != 0) {
+    _this->_internal_set_display(from._internal_display());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_flex_grow = from._internal_flex_grow();
+  uint32_t raw_flex_grow;
+  memcpy(&raw_flex_grow, &tmp_flex_grow, sizeof(tmp_flex_grow));
+  if (raw_flex_grow != 0) {
+    _this->_internal_set_flex_grow(from._internal_flex_grow());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_flex_shrink = from._internal_flex_shrink();
+  uint32_t raw_flex_shrink;
+  memcpy(&raw_flex_shrink, &tmp_flex_shrink, sizeof(tmp_flex_shrink));
+  if (raw_flex_shrink != 0) {
+    _this->_internal_set_flex_shrink(from._internal_flex_shrink());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_aspect_ratio = from._internal_aspect_ratio();
+  uint32_t raw_aspect_ratio;
+  memcpy(&raw_aspect_ratio, &tmp_aspect_ratio, sizeof(tmp_aspect_ratio));
+  if (raw_aspect_ratio != 0) {
+    _this->_internal_set_aspect_ratio(from._internal_aspect_ratio());
+  }
+  if (from._internal_patch() != 0) {
+    _this->_internal_set_patch(from._internal_patch());
   }
-}
-
-void AppendChild::MergeFrom(const AppendChild& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.AppendChild)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.parent_uid().size() > 0) {
-    _internal_set_parent_uid(from._internal_parent_uid());
+  if (from._internal_unset() != 0) {
+    _this->_internal_set_unset(from._internal_unset());
   }
-  if (from.child_uid().size() > 0) {
-    _internal_set_child_uid(from._internal_child_uid());
+  if (from._internal_z_index() != 0) {
+    _this->_internal_set_z_index(from._internal_z_index());
   }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AppendChild::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.AppendChild)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void AppendChild::CopyFrom(const AppendChild& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.AppendChild)
+void Style::CopyFrom(const Style& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.Style)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AppendChild::IsInitialized() const {
+bool Style::IsInitialized() const {
   return true;
 }
 
-void AppendChild::InternalSwap(AppendChild* other) {
+void Style::InternalSwap(Style* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  parent_uid_.Swap(&other->parent_uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  child_uid_.Swap(&other->child_uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Style, _impl_.z_index_)
+      + sizeof(Style::_impl_.z_index_)
+      - PROTOBUF_FIELD_OFFSET(Style, _impl_.flex_basis_)>(
+          reinterpret_cast<char*>(&_impl_.flex_basis_),
+          reinterpret_cast<char*>(&other->_impl_.flex_basis_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AppendChild::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Style::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[23]);
 }
 
-
 // ===================================================================
 
-void RemoveChild::InitAsDefaultInstance() {
-}
-class RemoveChild::_Internal {
+class SetLayoutValues::_Internal {
  public:
 };
 
-RemoveChild::RemoveChild(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:protocol.RemoveChild)
+SetLayoutValues::SetLayoutValues(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.SetLayoutValues)
 }
-RemoveChild::RemoveChild(const RemoveChild& from)
+SetLayoutValues::SetLayoutValues(const SetLayoutValues& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetLayoutValues* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.handles_){from._impl_.handles_}
+    , /*decltype(_impl_._handles_cached_byte_size_)*/{0}
+    , decltype(_impl_.prop_ids_){from._impl_.prop_ids_}
+    , /*decltype(_impl_._prop_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.values_){from._impl_.values_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  parent_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_parent_uid().empty()) {
-    parent_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_parent_uid(),
-      GetArena());
-  }
-  child_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_child_uid().empty()) {
-    child_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_child_uid(),
-      GetArena());
-  }
-  // @@protoc_insertion_point(copy_constructor:protocol.RemoveChild)
+  // @@protoc_insertion_point(copy_constructor:protocol.SetLayoutValues)
 }
 
-void RemoveChild::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_RemoveChild_protocol_2eproto.base);
-  parent_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  child_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SetLayoutValues::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.handles_){arena}
+    , /*decltype(_impl_._handles_cached_byte_size_)*/{0}
+    , decltype(_impl_.prop_ids_){arena}
+    , /*decltype(_impl_._prop_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.values_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-RemoveChild::~RemoveChild() {
-  // @@protoc_insertion_point(destructor:protocol.RemoveChild)
+SetLayoutValues::~SetLayoutValues() {
+  // @@protoc_insertion_point(destructor:protocol.SetLayoutValues)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void RemoveChild::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  parent_uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  child_uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void SetLayoutValues::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.handles_.~RepeatedField();
+  _impl_.prop_ids_.~RepeatedField();
+  _impl_.values_.~RepeatedField();
 }
 
-void RemoveChild::ArenaDtor(void* object) {
-  RemoveChild* _this = reinterpret_cast< RemoveChild* >(object);
-  (void)_this;
-}
-void RemoveChild::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void RemoveChild::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void SetLayoutValues::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-const RemoveChild& RemoveChild::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_RemoveChild_protocol_2eproto.base);
-  return *internal_default_instance();
-}
-
 
-void RemoveChild::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.RemoveChild)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void SetLayoutValues::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.SetLayoutValues)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  parent_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  child_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.handles_.Clear();
+  _impl_.prop_ids_.Clear();
+  _impl_.values_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* RemoveChild::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* SetLayoutValues::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string parent_uid = 1;
+      // repeated uint32 handles = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_parent_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.RemoveChild.parent_uid"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_handles(), ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_handles(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      // string child_uid = 2;
+      // repeated uint32 prop_ids = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_child_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.RemoveChild.child_uid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_prop_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_prop_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // repeated float values = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_values(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 29) {
+          _internal_add_values(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* RemoveChild::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.RemoveChild)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* SetLayoutValues::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.SetLayoutValues)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string parent_uid = 1;
-  if (this->parent_uid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_parent_uid().data(), static_cast<int>(this->_internal_parent_uid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.RemoveChild.parent_uid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_parent_uid(), target);
+  // repeated uint32 handles = 1;
+  {
+    int byte_size = _impl_._handles_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_handles(), byte_size, target);
+    }
   }
 
-  // string child_uid = 2;
-  if (this->child_uid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_child_uid().data(), static_cast<int>(this->_internal_child_uid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.RemoveChild.child_uid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_child_uid(), target);
+  // repeated uint32 prop_ids = 2;
+  {
+    int byte_size = _impl_._prop_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_prop_ids(), byte_size, target);
+    }
+  }
+
+  // repeated float values = 3;
+  if (this->_internal_values_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_values(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.RemoveChild)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.SetLayoutValues)
   return target;
 }
 
-size_t RemoveChild::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.RemoveChild)
+size_t SetLayoutValues::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.SetLayoutValues)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string parent_uid = 1;
-  if (this->parent_uid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_parent_uid());
+  // repeated uint32 handles = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.handles_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._handles_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  // string child_uid = 2;
-  if (this->child_uid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_child_uid());
+  // repeated uint32 prop_ids = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.prop_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._prop_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // repeated float values = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_values_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void RemoveChild::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.RemoveChild)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RemoveChild* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<RemoveChild>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.RemoveChild)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.RemoveChild)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RemoveChild::MergeFrom(const RemoveChild& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.RemoveChild)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetLayoutValues::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetLayoutValues::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetLayoutValues::GetClassData() const { return &_class_data_; }
 
-  if (from.parent_uid().size() > 0) {
-    _internal_set_parent_uid(from._internal_parent_uid());
-  }
-  if (from.child_uid().size() > 0) {
-    _internal_set_child_uid(from._internal_child_uid());
-  }
-}
 
-void RemoveChild::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.RemoveChild)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+void SetLayoutValues::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetLayoutValues*>(&to_msg);
+  auto& from = static_cast<const SetLayoutValues&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.SetLayoutValues)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.handles_.MergeFrom(from._impl_.handles_);
+  _this->_impl_.prop_ids_.MergeFrom(from._impl_.prop_ids_);
+  _this->_impl_.values_.MergeFrom(from._impl_.values_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void RemoveChild::CopyFrom(const RemoveChild& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.RemoveChild)
+void SetLayoutValues::CopyFrom(const SetLayoutValues& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.SetLayoutValues)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool RemoveChild::IsInitialized() const {
+bool SetLayoutValues::IsInitialized() const {
   return true;
 }
 
-void RemoveChild::InternalSwap(RemoveChild* other) {
+void SetLayoutValues::InternalSwap(SetLayoutValues* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  parent_uid_.Swap(&other->parent_uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  child_uid_.Swap(&other->child_uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.handles_.InternalSwap(&other->_impl_.handles_);
+  _impl_.prop_ids_.InternalSwap(&other->_impl_.prop_ids_);
+  _impl_.values_.InternalSwap(&other->_impl_.values_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata RemoveChild::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata SetLayoutValues::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[24]);
 }
 
-
 // ===================================================================
 
-void CommitUpdates::InitAsDefaultInstance() {
-}
-class CommitUpdates::_Internal {
+class Dimension::_Internal {
  public:
 };
 
-CommitUpdates::CommitUpdates(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:protocol.CommitUpdates)
+Dimension::Dimension(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:protocol.Dimension)
 }
-CommitUpdates::CommitUpdates(const CommitUpdates& from)
+Dimension::Dimension(const Dimension& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Dimension* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , decltype(_impl_.unit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  container_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_container_uid().empty()) {
-    container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_container_uid(),
-      GetArena());
-  }
-  // @@protoc_insertion_point(copy_constructor:protocol.CommitUpdates)
+  ::memcpy(&_impl_.value_, &from._impl_.value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unit_) -
+    reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.unit_));
+  // @@protoc_insertion_point(copy_constructor:protocol.Dimension)
 }
 
-void CommitUpdates::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_CommitUpdates_protocol_2eproto.base);
-  container_uid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Dimension::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){0}
+    , decltype(_impl_.unit_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
-CommitUpdates::~CommitUpdates() {
-  // @@protoc_insertion_point(destructor:protocol.CommitUpdates)
+Dimension::~Dimension() {
+  // @@protoc_insertion_point(destructor:protocol.Dimension)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void CommitUpdates::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  container_uid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Dimension::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void CommitUpdates::ArenaDtor(void* object) {
-  CommitUpdates* _this = reinterpret_cast< CommitUpdates* >(object);
-  (void)_this;
-}
-void CommitUpdates::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void CommitUpdates::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const CommitUpdates& CommitUpdates::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_CommitUpdates_protocol_2eproto.base);
-  return *internal_default_instance();
+void Dimension::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void CommitUpdates::Clear() {
-// @@protoc_insertion_point(message_clear_start:protocol.CommitUpdates)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+void Dimension::Clear() {
+// @@protoc_insertion_point(message_clear_start:protocol.Dimension)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  container_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::memset(&_impl_.value_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.unit_) -
+      reinterpret_cast<char*>(&_impl_.value_)) + sizeof(_impl_.unit_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* CommitUpdates::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Dimension::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string container_uid = 1;
+      // float value = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_container_uid();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.CommitUpdates.container_uid"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // .protocol.Unit unit = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_unit(static_cast<::protocol::Unit>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* CommitUpdates::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:protocol.CommitUpdates)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+uint8_t* Dimension::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protocol.Dimension)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string container_uid = 1;
-  if (this->container_uid().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_container_uid().data(), static_cast<int>(this->_internal_container_uid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "protocol.CommitUpdates.container_uid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_container_uid(), target);
+  // float value = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_value = this->_internal_value();
+  uint32_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_value(), target);
+  }
+
+  // .protocol.Unit unit = 2;
+  if (this->_internal_unit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_unit(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:protocol.CommitUpdates)
+  // @@protoc_insertion_point(serialize_to_array_end:protocol.Dimension)
   return target;
 }
 
-size_t CommitUpdates::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:protocol.CommitUpdates)
+size_t Dimension::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protocol.Dimension)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string container_uid = 1;
-  if (this->container_uid().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_container_uid());
+  // float value = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_value = this->_internal_value();
+  uint32_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    total_size += 1 + 4;
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
+  // .protocol.Unit unit = 2;
+  if (this->_internal_unit() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_unit());
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
 
-void CommitUpdates::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.CommitUpdates)
-  GOOGLE_DCHECK_NE(&from, this);
-  const CommitUpdates* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<CommitUpdates>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.CommitUpdates)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.CommitUpdates)
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CommitUpdates::MergeFrom(const CommitUpdates& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.CommitUpdates)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Dimension::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Dimension::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Dimension::GetClassData() const { return &_class_data_; }
+
+
+void Dimension::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Dimension*>(&to_msg);
+  auto& from = static_cast<const Dimension&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.Dimension)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.container_uid().size() > 0) {
-    _internal_set_container_uid(from._internal_container_uid());
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_value = from._internal_value();
+  uint32_t raw_value;
+  memcpy(&raw_value, &tmp_value, sizeof(tmp_value));
+  if (raw_value != 0) {
+    _this->_internal_set_value(from._internal_value());
   }
+  if (from._internal_unit() != 0) {
+    _this->_internal_set_unit(from._internal_unit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void CommitUpdates::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.CommitUpdates)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void CommitUpdates::CopyFrom(const CommitUpdates& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:protocol.CommitUpdates)
+void Dimension::CopyFrom(const Dimension& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protocol.Dimension)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool CommitUpdates::IsInitialized() const {
+bool Dimension::IsInitialized() const {
   return true;
 }
 
-void CommitUpdates::InternalSwap(CommitUpdates* other) {
+void Dimension::InternalSwap(Dimension* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  container_uid_.Swap(&other->container_uid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Dimension, _impl_.unit_)
+      + sizeof(Dimension::_impl_.unit_)
+      - PROTOBUF_FIELD_OFFSET(Dimension, _impl_.value_)>(
+          reinterpret_cast<char*>(&_impl_.value_),
+          reinterpret_cast<char*>(&other->_impl_.value_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata CommitUpdates::GetMetadata() const {
-  return GetMetadataStatic();
+::PROTOBUF_NAMESPACE_ID::Metadata Dimension::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[25]);
 }
 
-
 // ===================================================================
 
-void Prop::InitAsDefaultInstance() {
-  ::protocol::_Prop_default_instance_.string_value_.UnsafeSetDefault(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::protocol::_Prop_default_instance_.int_value_ = PROTOBUF_LONGLONG(0);
-  ::protocol::_Prop_default_instance_.float_value_ = 0;
-  ::protocol::_Prop_default_instance_.bool_value_ = false;
-  ::protocol::_Prop_default_instance_.object_value_ = const_cast< ::protocol::ObjectValue*>(
-      ::protocol::ObjectValue::internal_default_instance());
-  ::protocol::_Prop_default_instance_.undefined_ = false;
-}
 class Prop::_Internal {
  public:
   static const ::protocol::ObjectValue& object_value(const Prop* msg);
@@ -4391,61 +10357,78 @@ class Prop::_Internal {
 
 const ::protocol::ObjectValue&
 Prop::_Internal::object_value(const Prop* msg) {
-  return *msg->value_.object_value_;
+  return *msg->_impl_.value_.object_value_;
 }
 void Prop::set_allocated_object_value(::protocol::ObjectValue* object_value) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_value();
   if (object_value) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(object_value);
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(object_value);
     if (message_arena != submessage_arena) {
       object_value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, object_value, submessage_arena);
     }
     set_has_object_value();
-    value_.object_value_ = object_value;
+    _impl_.value_.object_value_ = object_value;
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.Prop.object_value)
 }
-Prop::Prop(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+Prop::Prop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:protocol.Prop)
 }
 Prop::Prop(const Prop& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Prop* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.key_id_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_key().empty()) {
-    key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_key(),
-      GetArena());
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.key_id_ = from._impl_.key_id_;
   clear_has_value();
   switch (from.value_case()) {
     case kStringValue: {
-      _internal_set_string_value(from._internal_string_value());
+      _this->_internal_set_string_value(from._internal_string_value());
       break;
     }
     case kIntValue: {
-      _internal_set_int_value(from._internal_int_value());
+      _this->_internal_set_int_value(from._internal_int_value());
       break;
     }
     case kFloatValue: {
-      _internal_set_float_value(from._internal_float_value());
+      _this->_internal_set_float_value(from._internal_float_value());
       break;
     }
     case kBoolValue: {
-      _internal_set_bool_value(from._internal_bool_value());
+      _this->_internal_set_bool_value(from._internal_bool_value());
       break;
     }
     case kObjectValue: {
-      _internal_mutable_object_value()->::protocol::ObjectValue::MergeFrom(from._internal_object_value());
+      _this->_internal_mutable_object_value()->::protocol::ObjectValue::MergeFrom(
+          from._internal_object_value());
       break;
     }
     case kUndefined: {
-      _internal_set_undefined(from._internal_undefined());
+      _this->_internal_set_undefined(from._internal_undefined());
+      break;
+    }
+    case kStringId: {
+      _this->_internal_set_string_id(from._internal_string_id());
       break;
     }
     case VALUE_NOT_SET: {
@@ -4455,46 +10438,50 @@ Prop::Prop(const Prop& from)
   // @@protoc_insertion_point(copy_constructor:protocol.Prop)
 }
 
-void Prop::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ObjectValue_protocol_2eproto.base);
-  key_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Prop::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.key_id_){0u}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   clear_has_value();
 }
 
 Prop::~Prop() {
   // @@protoc_insertion_point(destructor:protocol.Prop)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Prop::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  key_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+inline void Prop::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
   if (has_value()) {
     clear_value();
   }
 }
 
-void Prop::ArenaDtor(void* object) {
-  Prop* _this = reinterpret_cast< Prop* >(object);
-  (void)_this;
-}
-void Prop::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void Prop::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const Prop& Prop::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ObjectValue_protocol_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void Prop::clear_value() {
 // @@protoc_insertion_point(one_of_clear_start:protocol.Prop)
   switch (value_case()) {
     case kStringValue: {
-      value_.string_value_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+      _impl_.value_.string_value_.Destroy();
       break;
     }
     case kIntValue: {
@@ -4510,8 +10497,8 @@ void Prop::clear_value() {
       break;
     }
     case kObjectValue: {
-      if (GetArena() == nullptr) {
-        delete value_.object_value_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.object_value_;
       }
       break;
     }
@@ -4519,116 +10506,143 @@ void Prop::clear_value() {
       // No need to clear
       break;
     }
+    case kStringId: {
+      // No need to clear
+      break;
+    }
     case VALUE_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = VALUE_NOT_SET;
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
 }
 
 
 void Prop::Clear() {
 // @@protoc_insertion_point(message_clear_start:protocol.Prop)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
+  _impl_.key_id_ = 0u;
   clear_value();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Prop::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Prop::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // string key = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_key();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.Prop.key"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.Prop.key"));
+        } else
+          goto handle_unusual;
         continue;
       // string string_value = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_string_value();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "protocol.Prop.string_value"));
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-        } else goto handle_unusual;
+          CHK_(::_pbi::VerifyUTF8(str, "protocol.Prop.string_value"));
+        } else
+          goto handle_unusual;
         continue;
       // int64 int_value = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
           _internal_set_int_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // double float_value = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 33)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
           _internal_set_float_value(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
           ptr += sizeof(double);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool bool_value = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
           _internal_set_bool_value(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .protocol.ObjectValue object_value = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr = ctx->ParseMessage(_internal_mutable_object_value(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // bool undefined = 7;
       case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
           _internal_set_undefined(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 key_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.key_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // uint32 string_id = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _internal_set_string_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Prop::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* Prop::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:protocol.Prop)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
@@ -4650,37 +10664,48 @@ failure:
   // int64 int_value = 3;
   if (_internal_has_int_value()) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(3, this->_internal_int_value(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_int_value(), target);
   }
 
   // double float_value = 4;
   if (_internal_has_float_value()) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(4, this->_internal_float_value(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_float_value(), target);
   }
 
   // bool bool_value = 5;
   if (_internal_has_bool_value()) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(5, this->_internal_bool_value(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_bool_value(), target);
   }
 
   // .protocol.ObjectValue object_value = 6;
   if (_internal_has_object_value()) {
-    target = stream->EnsureSpace(target);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::object_value(this), target, stream);
+      InternalWriteMessage(6, _Internal::object_value(this),
+        _Internal::object_value(this).GetCachedSize(), target, stream);
   }
 
   // bool undefined = 7;
   if (_internal_has_undefined()) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(7, this->_internal_undefined(), target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_undefined(), target);
+  }
+
+  // uint32 key_id = 8;
+  if (this->_internal_key_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_key_id(), target);
+  }
+
+  // uint32 string_id = 9;
+  if (_internal_has_string_id()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_string_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:protocol.Prop)
@@ -4691,17 +10716,22 @@ size_t Prop::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:protocol.Prop)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // string key = 1;
-  if (this->key().size() > 0) {
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_key());
   }
 
+  // uint32 key_id = 8;
+  if (this->_internal_key_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_key_id());
+  }
+
   switch (value_case()) {
     // string string_value = 2;
     case kStringValue: {
@@ -4712,9 +10742,7 @@ size_t Prop::ByteSizeLong() const {
     }
     // int64 int_value = 3;
     case kIntValue: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
-          this->_internal_int_value());
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_int_value());
       break;
     }
     // double float_value = 4;
@@ -4731,7 +10759,7 @@ size_t Prop::ByteSizeLong() const {
     case kObjectValue: {
       total_size += 1 +
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *value_.object_value_);
+          *_impl_.value_.object_value_);
       break;
     }
     // bool undefined = 7;
@@ -4739,80 +10767,74 @@ size_t Prop::ByteSizeLong() const {
       total_size += 1 + 1;
       break;
     }
+    // uint32 string_id = 9;
+    case kStringId: {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_string_id());
+      break;
+    }
     case VALUE_NOT_SET: {
       break;
     }
   }
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Prop::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.Prop)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Prop* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Prop>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.Prop)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.Prop)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Prop::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Prop::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Prop::GetClassData() const { return &_class_data_; }
 
-void Prop::MergeFrom(const Prop& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.Prop)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+
+void Prop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Prop*>(&to_msg);
+  auto& from = static_cast<const Prop&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.Prop)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.key().size() > 0) {
-    _internal_set_key(from._internal_key());
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_key_id() != 0) {
+    _this->_internal_set_key_id(from._internal_key_id());
   }
   switch (from.value_case()) {
     case kStringValue: {
-      _internal_set_string_value(from._internal_string_value());
+      _this->_internal_set_string_value(from._internal_string_value());
       break;
     }
     case kIntValue: {
-      _internal_set_int_value(from._internal_int_value());
+      _this->_internal_set_int_value(from._internal_int_value());
       break;
     }
     case kFloatValue: {
-      _internal_set_float_value(from._internal_float_value());
+      _this->_internal_set_float_value(from._internal_float_value());
       break;
     }
     case kBoolValue: {
-      _internal_set_bool_value(from._internal_bool_value());
+      _this->_internal_set_bool_value(from._internal_bool_value());
       break;
     }
     case kObjectValue: {
-      _internal_mutable_object_value()->::protocol::ObjectValue::MergeFrom(from._internal_object_value());
+      _this->_internal_mutable_object_value()->::protocol::ObjectValue::MergeFrom(
+          from._internal_object_value());
       break;
     }
     case kUndefined: {
-      _internal_set_undefined(from._internal_undefined());
+      _this->_internal_set_undefined(from._internal_undefined());
+      break;
+    }
+    case kStringId: {
+      _this->_internal_set_string_id(from._internal_string_id());
       break;
     }
     case VALUE_NOT_SET: {
       break;
     }
   }
-}
-
-void Prop::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.Prop)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Prop::CopyFrom(const Prop& from) {
@@ -4828,89 +10850,94 @@ bool Prop::IsInitialized() const {
 
 void Prop::InternalSwap(Prop* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  key_.Swap(&other->key_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(value_, other->value_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  swap(_impl_.key_id_, other->_impl_.key_id_);
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Prop::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[26]);
 }
 
-
 // ===================================================================
 
-void ObjectValue::InitAsDefaultInstance() {
-}
 class ObjectValue::_Internal {
  public:
 };
 
-ObjectValue::ObjectValue(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  props_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+ObjectValue::ObjectValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:protocol.ObjectValue)
 }
 ObjectValue::ObjectValue(const ObjectValue& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      props_(from.props_) {
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ObjectValue* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.props_){from._impl_.props_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:protocol.ObjectValue)
 }
 
-void ObjectValue::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ObjectValue_protocol_2eproto.base);
+inline void ObjectValue::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.props_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ObjectValue::~ObjectValue() {
   // @@protoc_insertion_point(destructor:protocol.ObjectValue)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void ObjectValue::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ObjectValue::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.props_.~RepeatedPtrField();
 }
 
-void ObjectValue::ArenaDtor(void* object) {
-  ObjectValue* _this = reinterpret_cast< ObjectValue* >(object);
-  (void)_this;
-}
-void ObjectValue::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ObjectValue::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ObjectValue& ObjectValue::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ObjectValue_protocol_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void ObjectValue::Clear() {
 // @@protoc_insertion_point(message_clear_start:protocol.ObjectValue)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  props_.Clear();
+  _impl_.props_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ObjectValue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ObjectValue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated .protocol.Prop props = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -4918,46 +10945,48 @@ const char* ObjectValue::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ObjectValue::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ObjectValue::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:protocol.ObjectValue)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .protocol.Prop props = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_props_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_props_size()); i < n; i++) {
+    const auto& repfield = this->_internal_props(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_props(i), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:protocol.ObjectValue)
@@ -4968,56 +10997,37 @@ size_t ObjectValue::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:protocol.ObjectValue)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .protocol.Prop props = 1;
   total_size += 1UL * this->_internal_props_size();
-  for (const auto& msg : this->props_) {
+  for (const auto& msg : this->_impl_.props_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void ObjectValue::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:protocol.ObjectValue)
-  GOOGLE_DCHECK_NE(&from, this);
-  const ObjectValue* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<ObjectValue>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:protocol.ObjectValue)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:protocol.ObjectValue)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ObjectValue::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ObjectValue::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ObjectValue::GetClassData() const { return &_class_data_; }
 
-void ObjectValue::MergeFrom(const ObjectValue& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:protocol.ObjectValue)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  props_.MergeFrom(from.props_);
-}
+void ObjectValue::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ObjectValue*>(&to_msg);
+  auto& from = static_cast<const ObjectValue&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:protocol.ObjectValue)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void ObjectValue::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:protocol.ObjectValue)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.props_.MergeFrom(from._impl_.props_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void ObjectValue::CopyFrom(const ObjectValue& from) {
@@ -5033,61 +11043,129 @@ bool ObjectValue::IsInitialized() const {
 
 void ObjectValue::InternalSwap(ObjectValue* other) {
   using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  props_.InternalSwap(&other->props_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.props_.InternalSwap(&other->_impl_.props_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ObjectValue::GetMetadata() const {
-  return GetMetadataStatic();
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_protocol_2eproto_getter, &descriptor_table_protocol_2eproto_once,
+      file_level_metadata_protocol_2eproto[27]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace protocol
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::protocol::ClientMessage* Arena::CreateMaybeMessage< ::protocol::ClientMessage >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::ClientMessage*
+Arena::CreateMaybeMessage< ::protocol::ClientMessage >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::ClientMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::ServerMessage* Arena::CreateMaybeMessage< ::protocol::ServerMessage >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::ServerMessage*
+Arena::CreateMaybeMessage< ::protocol::ServerMessage >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::ServerMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::InitRequest* Arena::CreateMaybeMessage< ::protocol::InitRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::InitRequest*
+Arena::CreateMaybeMessage< ::protocol::InitRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::InitRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::Scene* Arena::CreateMaybeMessage< ::protocol::Scene >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::Scene*
+Arena::CreateMaybeMessage< ::protocol::Scene >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::Scene >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::ApplyUpdate* Arena::CreateMaybeMessage< ::protocol::ApplyUpdate >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::ApplyUpdate*
+Arena::CreateMaybeMessage< ::protocol::ApplyUpdate >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::ApplyUpdate >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::FindSourceRequest* Arena::CreateMaybeMessage< ::protocol::FindSourceRequest >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::UpdateBatch*
+Arena::CreateMaybeMessage< ::protocol::UpdateBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::UpdateBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::FindSourceRequest*
+Arena::CreateMaybeMessage< ::protocol::FindSourceRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::FindSourceRequest >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::Response* Arena::CreateMaybeMessage< ::protocol::Response >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::Response*
+Arena::CreateMaybeMessage< ::protocol::Response >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::Response >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::CreateSource* Arena::CreateMaybeMessage< ::protocol::CreateSource >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::SharedMemoryTransport*
+Arena::CreateMaybeMessage< ::protocol::SharedMemoryTransport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::SharedMemoryTransport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::FrameCompression*
+Arena::CreateMaybeMessage< ::protocol::FrameCompression >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::FrameCompression >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::UpdateCredits*
+Arena::CreateMaybeMessage< ::protocol::UpdateCredits >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::UpdateCredits >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::CreateSource*
+Arena::CreateMaybeMessage< ::protocol::CreateSource >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::CreateSource >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::UpdateSource* Arena::CreateMaybeMessage< ::protocol::UpdateSource >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::UpdateSource*
+Arena::CreateMaybeMessage< ::protocol::UpdateSource >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::UpdateSource >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::CreateScene* Arena::CreateMaybeMessage< ::protocol::CreateScene >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::CreateScene*
+Arena::CreateMaybeMessage< ::protocol::CreateScene >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::CreateScene >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::AppendChild* Arena::CreateMaybeMessage< ::protocol::AppendChild >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::AppendChild*
+Arena::CreateMaybeMessage< ::protocol::AppendChild >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::AppendChild >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::RemoveChild* Arena::CreateMaybeMessage< ::protocol::RemoveChild >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::RemoveChild*
+Arena::CreateMaybeMessage< ::protocol::RemoveChild >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::RemoveChild >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::CommitUpdates* Arena::CreateMaybeMessage< ::protocol::CommitUpdates >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::CreateTree*
+Arena::CreateMaybeMessage< ::protocol::CreateTree >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::CreateTree >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::TreeNode*
+Arena::CreateMaybeMessage< ::protocol::TreeNode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::TreeNode >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::InsertBefore*
+Arena::CreateMaybeMessage< ::protocol::InsertBefore >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::InsertBefore >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::MoveChild*
+Arena::CreateMaybeMessage< ::protocol::MoveChild >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::MoveChild >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::CommitUpdates*
+Arena::CreateMaybeMessage< ::protocol::CommitUpdates >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::CommitUpdates >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::Prop* Arena::CreateMaybeMessage< ::protocol::Prop >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::DefineKey*
+Arena::CreateMaybeMessage< ::protocol::DefineKey >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::DefineKey >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::DefineString*
+Arena::CreateMaybeMessage< ::protocol::DefineString >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::DefineString >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::Style*
+Arena::CreateMaybeMessage< ::protocol::Style >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::Style >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::SetLayoutValues*
+Arena::CreateMaybeMessage< ::protocol::SetLayoutValues >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::SetLayoutValues >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::Dimension*
+Arena::CreateMaybeMessage< ::protocol::Dimension >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::protocol::Dimension >(arena);
+}
+template<> PROTOBUF_NOINLINE ::protocol::Prop*
+Arena::CreateMaybeMessage< ::protocol::Prop >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::Prop >(arena);
 }
-template<> PROTOBUF_NOINLINE ::protocol::ObjectValue* Arena::CreateMaybeMessage< ::protocol::ObjectValue >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::protocol::ObjectValue*
+Arena::CreateMaybeMessage< ::protocol::ObjectValue >(Arena* arena) {
   return Arena::CreateMessageInternal< ::protocol::ObjectValue >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3013000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3013000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,14 +23,13 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
@@ -43,62 +42,93 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_protocol_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[15]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_protocol_2eproto;
 namespace protocol {
 class AppendChild;
-class AppendChildDefaultTypeInternal;
+struct AppendChildDefaultTypeInternal;
 extern AppendChildDefaultTypeInternal _AppendChild_default_instance_;
 class ApplyUpdate;
-class ApplyUpdateDefaultTypeInternal;
+struct ApplyUpdateDefaultTypeInternal;
 extern ApplyUpdateDefaultTypeInternal _ApplyUpdate_default_instance_;
 class ClientMessage;
-class ClientMessageDefaultTypeInternal;
+struct ClientMessageDefaultTypeInternal;
 extern ClientMessageDefaultTypeInternal _ClientMessage_default_instance_;
 class CommitUpdates;
-class CommitUpdatesDefaultTypeInternal;
+struct CommitUpdatesDefaultTypeInternal;
 extern CommitUpdatesDefaultTypeInternal _CommitUpdates_default_instance_;
 class CreateScene;
-class CreateSceneDefaultTypeInternal;
+struct CreateSceneDefaultTypeInternal;
 extern CreateSceneDefaultTypeInternal _CreateScene_default_instance_;
 class CreateSource;
-class CreateSourceDefaultTypeInternal;
+struct CreateSourceDefaultTypeInternal;
 extern CreateSourceDefaultTypeInternal _CreateSource_default_instance_;
+class CreateTree;
+struct CreateTreeDefaultTypeInternal;
+extern CreateTreeDefaultTypeInternal _CreateTree_default_instance_;
+class DefineKey;
+struct DefineKeyDefaultTypeInternal;
+extern DefineKeyDefaultTypeInternal _DefineKey_default_instance_;
+class DefineString;
+struct DefineStringDefaultTypeInternal;
+extern DefineStringDefaultTypeInternal _DefineString_default_instance_;
+class Dimension;
+struct DimensionDefaultTypeInternal;
+extern DimensionDefaultTypeInternal _Dimension_default_instance_;
 class FindSourceRequest;
-class FindSourceRequestDefaultTypeInternal;
+struct FindSourceRequestDefaultTypeInternal;
 extern FindSourceRequestDefaultTypeInternal _FindSourceRequest_default_instance_;
+class FrameCompression;
+struct FrameCompressionDefaultTypeInternal;
+extern FrameCompressionDefaultTypeInternal _FrameCompression_default_instance_;
 class InitRequest;
-class InitRequestDefaultTypeInternal;
+struct InitRequestDefaultTypeInternal;
 extern InitRequestDefaultTypeInternal _InitRequest_default_instance_;
+class InsertBefore;
+struct InsertBeforeDefaultTypeInternal;
+extern InsertBeforeDefaultTypeInternal _InsertBefore_default_instance_;
+class MoveChild;
+struct MoveChildDefaultTypeInternal;
+extern MoveChildDefaultTypeInternal _MoveChild_default_instance_;
 class ObjectValue;
-class ObjectValueDefaultTypeInternal;
+struct ObjectValueDefaultTypeInternal;
 extern ObjectValueDefaultTypeInternal _ObjectValue_default_instance_;
 class Prop;
-class PropDefaultTypeInternal;
+struct PropDefaultTypeInternal;
 extern PropDefaultTypeInternal _Prop_default_instance_;
 class RemoveChild;
-class RemoveChildDefaultTypeInternal;
+struct RemoveChildDefaultTypeInternal;
 extern RemoveChildDefaultTypeInternal _RemoveChild_default_instance_;
 class Response;
-class ResponseDefaultTypeInternal;
+struct ResponseDefaultTypeInternal;
 extern ResponseDefaultTypeInternal _Response_default_instance_;
 class Scene;
-class SceneDefaultTypeInternal;
+struct SceneDefaultTypeInternal;
 extern SceneDefaultTypeInternal _Scene_default_instance_;
 class ServerMessage;
-class ServerMessageDefaultTypeInternal;
+struct ServerMessageDefaultTypeInternal;
 extern ServerMessageDefaultTypeInternal _ServerMessage_default_instance_;
+class SetLayoutValues;
+struct SetLayoutValuesDefaultTypeInternal;
+extern SetLayoutValuesDefaultTypeInternal _SetLayoutValues_default_instance_;
+class SharedMemoryTransport;
+struct SharedMemoryTransportDefaultTypeInternal;
+extern SharedMemoryTransportDefaultTypeInternal _SharedMemoryTransport_default_instance_;
+class Style;
+struct StyleDefaultTypeInternal;
+extern StyleDefaultTypeInternal _Style_default_instance_;
+class TreeNode;
+struct TreeNodeDefaultTypeInternal;
+extern TreeNodeDefaultTypeInternal _TreeNode_default_instance_;
+class UpdateBatch;
+struct UpdateBatchDefaultTypeInternal;
+extern UpdateBatchDefaultTypeInternal _UpdateBatch_default_instance_;
+class UpdateCredits;
+struct UpdateCreditsDefaultTypeInternal;
+extern UpdateCreditsDefaultTypeInternal _UpdateCredits_default_instance_;
 class UpdateSource;
-class UpdateSourceDefaultTypeInternal;
+struct UpdateSourceDefaultTypeInternal;
 extern UpdateSourceDefaultTypeInternal _UpdateSource_default_instance_;
 }  // namespace protocol
 PROTOBUF_NAMESPACE_OPEN
@@ -108,25 +138,331 @@ template<> ::protocol::ClientMessage* Arena::CreateMaybeMessage<::protocol::Clie
 template<> ::protocol::CommitUpdates* Arena::CreateMaybeMessage<::protocol::CommitUpdates>(Arena*);
 template<> ::protocol::CreateScene* Arena::CreateMaybeMessage<::protocol::CreateScene>(Arena*);
 template<> ::protocol::CreateSource* Arena::CreateMaybeMessage<::protocol::CreateSource>(Arena*);
+template<> ::protocol::CreateTree* Arena::CreateMaybeMessage<::protocol::CreateTree>(Arena*);
+template<> ::protocol::DefineKey* Arena::CreateMaybeMessage<::protocol::DefineKey>(Arena*);
+template<> ::protocol::DefineString* Arena::CreateMaybeMessage<::protocol::DefineString>(Arena*);
+template<> ::protocol::Dimension* Arena::CreateMaybeMessage<::protocol::Dimension>(Arena*);
 template<> ::protocol::FindSourceRequest* Arena::CreateMaybeMessage<::protocol::FindSourceRequest>(Arena*);
+template<> ::protocol::FrameCompression* Arena::CreateMaybeMessage<::protocol::FrameCompression>(Arena*);
 template<> ::protocol::InitRequest* Arena::CreateMaybeMessage<::protocol::InitRequest>(Arena*);
+template<> ::protocol::InsertBefore* Arena::CreateMaybeMessage<::protocol::InsertBefore>(Arena*);
+template<> ::protocol::MoveChild* Arena::CreateMaybeMessage<::protocol::MoveChild>(Arena*);
 template<> ::protocol::ObjectValue* Arena::CreateMaybeMessage<::protocol::ObjectValue>(Arena*);
 template<> ::protocol::Prop* Arena::CreateMaybeMessage<::protocol::Prop>(Arena*);
 template<> ::protocol::RemoveChild* Arena::CreateMaybeMessage<::protocol::RemoveChild>(Arena*);
 template<> ::protocol::Response* Arena::CreateMaybeMessage<::protocol::Response>(Arena*);
 template<> ::protocol::Scene* Arena::CreateMaybeMessage<::protocol::Scene>(Arena*);
 template<> ::protocol::ServerMessage* Arena::CreateMaybeMessage<::protocol::ServerMessage>(Arena*);
+template<> ::protocol::SetLayoutValues* Arena::CreateMaybeMessage<::protocol::SetLayoutValues>(Arena*);
+template<> ::protocol::SharedMemoryTransport* Arena::CreateMaybeMessage<::protocol::SharedMemoryTransport>(Arena*);
+template<> ::protocol::Style* Arena::CreateMaybeMessage<::protocol::Style>(Arena*);
+template<> ::protocol::TreeNode* Arena::CreateMaybeMessage<::protocol::TreeNode>(Arena*);
+template<> ::protocol::UpdateBatch* Arena::CreateMaybeMessage<::protocol::UpdateBatch>(Arena*);
+template<> ::protocol::UpdateCredits* Arena::CreateMaybeMessage<::protocol::UpdateCredits>(Arena*);
 template<> ::protocol::UpdateSource* Arena::CreateMaybeMessage<::protocol::UpdateSource>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace protocol {
 
+enum Compression : int {
+  COMPRESSION_NONE = 0,
+  COMPRESSION_DEFLATE = 1,
+  Compression_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Compression_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Compression_IsValid(int value);
+constexpr Compression Compression_MIN = COMPRESSION_NONE;
+constexpr Compression Compression_MAX = COMPRESSION_DEFLATE;
+constexpr int Compression_ARRAYSIZE = Compression_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Compression_descriptor();
+template<typename T>
+inline const std::string& Compression_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Compression>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Compression_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Compression_descriptor(), enum_t_value);
+}
+inline bool Compression_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Compression* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Compression>(
+    Compression_descriptor(), name, value);
+}
+enum LayoutValueFlags : int {
+  LAYOUT_VALUE_POINT = 0,
+  LAYOUT_VALUE_PERCENT = 256,
+  LayoutValueFlags_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  LayoutValueFlags_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool LayoutValueFlags_IsValid(int value);
+constexpr LayoutValueFlags LayoutValueFlags_MIN = LAYOUT_VALUE_POINT;
+constexpr LayoutValueFlags LayoutValueFlags_MAX = LAYOUT_VALUE_PERCENT;
+constexpr int LayoutValueFlags_ARRAYSIZE = LayoutValueFlags_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* LayoutValueFlags_descriptor();
+template<typename T>
+inline const std::string& LayoutValueFlags_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, LayoutValueFlags>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function LayoutValueFlags_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    LayoutValueFlags_descriptor(), enum_t_value);
+}
+inline bool LayoutValueFlags_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, LayoutValueFlags* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<LayoutValueFlags>(
+    LayoutValueFlags_descriptor(), name, value);
+}
+enum Unit : int {
+  UNIT_POINT = 0,
+  UNIT_PERCENT = 1,
+  UNIT_AUTO = 2,
+  Unit_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Unit_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Unit_IsValid(int value);
+constexpr Unit Unit_MIN = UNIT_POINT;
+constexpr Unit Unit_MAX = UNIT_AUTO;
+constexpr int Unit_ARRAYSIZE = Unit_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Unit_descriptor();
+template<typename T>
+inline const std::string& Unit_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Unit>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Unit_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Unit_descriptor(), enum_t_value);
+}
+inline bool Unit_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Unit* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Unit>(
+    Unit_descriptor(), name, value);
+}
+enum FlexDirection : int {
+  FLEX_DIRECTION_COLUMN = 0,
+  FLEX_DIRECTION_COLUMN_REVERSE = 1,
+  FLEX_DIRECTION_ROW = 2,
+  FLEX_DIRECTION_ROW_REVERSE = 3,
+  FlexDirection_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  FlexDirection_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool FlexDirection_IsValid(int value);
+constexpr FlexDirection FlexDirection_MIN = FLEX_DIRECTION_COLUMN;
+constexpr FlexDirection FlexDirection_MAX = FLEX_DIRECTION_ROW_REVERSE;
+constexpr int FlexDirection_ARRAYSIZE = FlexDirection_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* FlexDirection_descriptor();
+template<typename T>
+inline const std::string& FlexDirection_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, FlexDirection>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function FlexDirection_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    FlexDirection_descriptor(), enum_t_value);
+}
+inline bool FlexDirection_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, FlexDirection* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<FlexDirection>(
+    FlexDirection_descriptor(), name, value);
+}
+enum Direction : int {
+  DIRECTION_INHERIT = 0,
+  DIRECTION_LTR = 1,
+  DIRECTION_RTL = 2,
+  Direction_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Direction_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Direction_IsValid(int value);
+constexpr Direction Direction_MIN = DIRECTION_INHERIT;
+constexpr Direction Direction_MAX = DIRECTION_RTL;
+constexpr int Direction_ARRAYSIZE = Direction_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Direction_descriptor();
+template<typename T>
+inline const std::string& Direction_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Direction>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Direction_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Direction_descriptor(), enum_t_value);
+}
+inline bool Direction_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Direction* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Direction>(
+    Direction_descriptor(), name, value);
+}
+enum Justify : int {
+  JUSTIFY_FLEX_START = 0,
+  JUSTIFY_CENTER = 1,
+  JUSTIFY_FLEX_END = 2,
+  JUSTIFY_SPACE_BETWEEN = 3,
+  JUSTIFY_SPACE_AROUND = 4,
+  JUSTIFY_SPACE_EVENLY = 5,
+  Justify_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Justify_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Justify_IsValid(int value);
+constexpr Justify Justify_MIN = JUSTIFY_FLEX_START;
+constexpr Justify Justify_MAX = JUSTIFY_SPACE_EVENLY;
+constexpr int Justify_ARRAYSIZE = Justify_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Justify_descriptor();
+template<typename T>
+inline const std::string& Justify_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Justify>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Justify_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Justify_descriptor(), enum_t_value);
+}
+inline bool Justify_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Justify* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Justify>(
+    Justify_descriptor(), name, value);
+}
+enum Align : int {
+  ALIGN_AUTO = 0,
+  ALIGN_FLEX_START = 1,
+  ALIGN_CENTER = 2,
+  ALIGN_FLEX_END = 3,
+  ALIGN_STRETCH = 4,
+  ALIGN_BASELINE = 5,
+  ALIGN_SPACE_BETWEEN = 6,
+  ALIGN_SPACE_AROUND = 7,
+  Align_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Align_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Align_IsValid(int value);
+constexpr Align Align_MIN = ALIGN_AUTO;
+constexpr Align Align_MAX = ALIGN_SPACE_AROUND;
+constexpr int Align_ARRAYSIZE = Align_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Align_descriptor();
+template<typename T>
+inline const std::string& Align_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Align>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Align_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Align_descriptor(), enum_t_value);
+}
+inline bool Align_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Align* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Align>(
+    Align_descriptor(), name, value);
+}
+enum PositionType : int {
+  POSITION_TYPE_STATIC = 0,
+  POSITION_TYPE_RELATIVE = 1,
+  POSITION_TYPE_ABSOLUTE = 2,
+  PositionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PositionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PositionType_IsValid(int value);
+constexpr PositionType PositionType_MIN = POSITION_TYPE_STATIC;
+constexpr PositionType PositionType_MAX = POSITION_TYPE_ABSOLUTE;
+constexpr int PositionType_ARRAYSIZE = PositionType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PositionType_descriptor();
+template<typename T>
+inline const std::string& PositionType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PositionType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PositionType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PositionType_descriptor(), enum_t_value);
+}
+inline bool PositionType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PositionType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PositionType>(
+    PositionType_descriptor(), name, value);
+}
+enum Wrap : int {
+  WRAP_NO_WRAP = 0,
+  WRAP_WRAP = 1,
+  WRAP_WRAP_REVERSE = 2,
+  Wrap_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Wrap_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Wrap_IsValid(int value);
+constexpr Wrap Wrap_MIN = WRAP_NO_WRAP;
+constexpr Wrap Wrap_MAX = WRAP_WRAP_REVERSE;
+constexpr int Wrap_ARRAYSIZE = Wrap_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Wrap_descriptor();
+template<typename T>
+inline const std::string& Wrap_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Wrap>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Wrap_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Wrap_descriptor(), enum_t_value);
+}
+inline bool Wrap_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Wrap* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Wrap>(
+    Wrap_descriptor(), name, value);
+}
+enum Overflow : int {
+  OVERFLOW_VISIBLE = 0,
+  OVERFLOW_HIDDEN = 1,
+  OVERFLOW_SCROLL = 2,
+  Overflow_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Overflow_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Overflow_IsValid(int value);
+constexpr Overflow Overflow_MIN = OVERFLOW_VISIBLE;
+constexpr Overflow Overflow_MAX = OVERFLOW_SCROLL;
+constexpr int Overflow_ARRAYSIZE = Overflow_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Overflow_descriptor();
+template<typename T>
+inline const std::string& Overflow_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Overflow>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Overflow_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Overflow_descriptor(), enum_t_value);
+}
+inline bool Overflow_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Overflow* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Overflow>(
+    Overflow_descriptor(), name, value);
+}
+enum Display : int {
+  DISPLAY_FLEX = 0,
+  DISPLAY_NONE = 1,
+  Display_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Display_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Display_IsValid(int value);
+constexpr Display Display_MIN = DISPLAY_FLEX;
+constexpr Display Display_MAX = DISPLAY_NONE;
+constexpr int Display_ARRAYSIZE = Display_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Display_descriptor();
+template<typename T>
+inline const std::string& Display_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Display>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Display_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Display_descriptor(), enum_t_value);
+}
+inline bool Display_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Display* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Display>(
+    Display_descriptor(), name, value);
+}
 // ===================================================================
 
-class ClientMessage PROTOBUF_FINAL :
+class ClientMessage final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.ClientMessage) */ {
  public:
   inline ClientMessage() : ClientMessage(nullptr) {}
-  virtual ~ClientMessage();
+  ~ClientMessage() override;
+  explicit PROTOBUF_CONSTEXPR ClientMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ClientMessage(const ClientMessage& from);
   ClientMessage(ClientMessage&& from) noexcept
@@ -139,8 +475,13 @@ class ClientMessage PROTOBUF_FINAL :
     return *this;
   }
   inline ClientMessage& operator=(ClientMessage&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -151,21 +492,22 @@ class ClientMessage PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientMessage& default_instance() {
+    return *internal_default_instance();
   }
-  static const ClientMessage& default_instance();
-
   enum MessageCase {
     kInitRequest = 1,
     kApplyUpdate = 2,
     kFindSource = 3,
+    kUpdateBatch = 4,
     MESSAGE_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ClientMessage* internal_default_instance() {
     return reinterpret_cast<const ClientMessage*>(
                &_ClientMessage_default_instance_);
@@ -178,7 +520,12 @@ class ClientMessage PROTOBUF_FINAL :
   }
   inline void Swap(ClientMessage* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -186,56 +533,53 @@ class ClientMessage PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ClientMessage* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ClientMessage* New() const final {
-    return CreateMaybeMessage<ClientMessage>(nullptr);
-  }
-
-  ClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ClientMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ClientMessage>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ClientMessage& from);
-  void MergeFrom(const ClientMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClientMessage& from) {
+    ClientMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ClientMessage* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "protocol.ClientMessage";
   }
   protected:
-  explicit ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ClientMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -245,6 +589,7 @@ class ClientMessage PROTOBUF_FINAL :
     kInitRequestFieldNumber = 1,
     kApplyUpdateFieldNumber = 2,
     kFindSourceFieldNumber = 3,
+    kUpdateBatchFieldNumber = 4,
   };
   // .protocol.InitRequest init_request = 1;
   bool has_init_request() const;
@@ -253,7 +598,7 @@ class ClientMessage PROTOBUF_FINAL :
   public:
   void clear_init_request();
   const ::protocol::InitRequest& init_request() const;
-  ::protocol::InitRequest* release_init_request();
+  PROTOBUF_NODISCARD ::protocol::InitRequest* release_init_request();
   ::protocol::InitRequest* mutable_init_request();
   void set_allocated_init_request(::protocol::InitRequest* init_request);
   private:
@@ -271,7 +616,7 @@ class ClientMessage PROTOBUF_FINAL :
   public:
   void clear_apply_update();
   const ::protocol::ApplyUpdate& apply_update() const;
-  ::protocol::ApplyUpdate* release_apply_update();
+  PROTOBUF_NODISCARD ::protocol::ApplyUpdate* release_apply_update();
   ::protocol::ApplyUpdate* mutable_apply_update();
   void set_allocated_apply_update(::protocol::ApplyUpdate* apply_update);
   private:
@@ -289,7 +634,7 @@ class ClientMessage PROTOBUF_FINAL :
   public:
   void clear_find_source();
   const ::protocol::FindSourceRequest& find_source() const;
-  ::protocol::FindSourceRequest* release_find_source();
+  PROTOBUF_NODISCARD ::protocol::FindSourceRequest* release_find_source();
   ::protocol::FindSourceRequest* mutable_find_source();
   void set_allocated_find_source(::protocol::FindSourceRequest* find_source);
   private:
@@ -300,6 +645,24 @@ class ClientMessage PROTOBUF_FINAL :
       ::protocol::FindSourceRequest* find_source);
   ::protocol::FindSourceRequest* unsafe_arena_release_find_source();
 
+  // .protocol.UpdateBatch update_batch = 4;
+  bool has_update_batch() const;
+  private:
+  bool _internal_has_update_batch() const;
+  public:
+  void clear_update_batch();
+  const ::protocol::UpdateBatch& update_batch() const;
+  PROTOBUF_NODISCARD ::protocol::UpdateBatch* release_update_batch();
+  ::protocol::UpdateBatch* mutable_update_batch();
+  void set_allocated_update_batch(::protocol::UpdateBatch* update_batch);
+  private:
+  const ::protocol::UpdateBatch& _internal_update_batch() const;
+  ::protocol::UpdateBatch* _internal_mutable_update_batch();
+  public:
+  void unsafe_arena_set_allocated_update_batch(
+      ::protocol::UpdateBatch* update_batch);
+  ::protocol::UpdateBatch* unsafe_arena_release_update_batch();
+
   void clear_message();
   MessageCase message_case() const;
   // @@protoc_insertion_point(class_scope:protocol.ClientMessage)
@@ -308,6 +671,7 @@ class ClientMessage PROTOBUF_FINAL :
   void set_has_init_request();
   void set_has_apply_update();
   void set_has_find_source();
+  void set_has_update_batch();
 
   inline bool has_message() const;
   inline void clear_has_message();
@@ -315,24 +679,30 @@ class ClientMessage PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  union MessageUnion {
-    MessageUnion() {}
-    ::protocol::InitRequest* init_request_;
-    ::protocol::ApplyUpdate* apply_update_;
-    ::protocol::FindSourceRequest* find_source_;
-  } message_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    union MessageUnion {
+      constexpr MessageUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::protocol::InitRequest* init_request_;
+      ::protocol::ApplyUpdate* apply_update_;
+      ::protocol::FindSourceRequest* find_source_;
+      ::protocol::UpdateBatch* update_batch_;
+    } message_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ServerMessage PROTOBUF_FINAL :
+class ServerMessage final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.ServerMessage) */ {
  public:
   inline ServerMessage() : ServerMessage(nullptr) {}
-  virtual ~ServerMessage();
+  ~ServerMessage() override;
+  explicit PROTOBUF_CONSTEXPR ServerMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ServerMessage(const ServerMessage& from);
   ServerMessage(ServerMessage&& from) noexcept
@@ -345,8 +715,13 @@ class ServerMessage PROTOBUF_FINAL :
     return *this;
   }
   inline ServerMessage& operator=(ServerMessage&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -357,19 +732,20 @@ class ServerMessage PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerMessage& default_instance() {
+    return *internal_default_instance();
   }
-  static const ServerMessage& default_instance();
-
   enum MessageCase {
     kResponse = 1,
+    kUpdateCredits = 2,
     MESSAGE_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ServerMessage* internal_default_instance() {
     return reinterpret_cast<const ServerMessage*>(
                &_ServerMessage_default_instance_);
@@ -382,7 +758,12 @@ class ServerMessage PROTOBUF_FINAL :
   }
   inline void Swap(ServerMessage* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -390,56 +771,53 @@ class ServerMessage PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ServerMessage* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ServerMessage* New() const final {
-    return CreateMaybeMessage<ServerMessage>(nullptr);
-  }
-
-  ServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ServerMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ServerMessage>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ServerMessage& from);
-  void MergeFrom(const ServerMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerMessage& from) {
+    ServerMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ServerMessage* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "protocol.ServerMessage";
   }
   protected:
-  explicit ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ServerMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -447,6 +825,7 @@ class ServerMessage PROTOBUF_FINAL :
 
   enum : int {
     kResponseFieldNumber = 1,
+    kUpdateCreditsFieldNumber = 2,
   };
   // .protocol.Response response = 1;
   bool has_response() const;
@@ -455,7 +834,7 @@ class ServerMessage PROTOBUF_FINAL :
   public:
   void clear_response();
   const ::protocol::Response& response() const;
-  ::protocol::Response* release_response();
+  PROTOBUF_NODISCARD ::protocol::Response* release_response();
   ::protocol::Response* mutable_response();
   void set_allocated_response(::protocol::Response* response);
   private:
@@ -466,12 +845,31 @@ class ServerMessage PROTOBUF_FINAL :
       ::protocol::Response* response);
   ::protocol::Response* unsafe_arena_release_response();
 
+  // .protocol.UpdateCredits update_credits = 2;
+  bool has_update_credits() const;
+  private:
+  bool _internal_has_update_credits() const;
+  public:
+  void clear_update_credits();
+  const ::protocol::UpdateCredits& update_credits() const;
+  PROTOBUF_NODISCARD ::protocol::UpdateCredits* release_update_credits();
+  ::protocol::UpdateCredits* mutable_update_credits();
+  void set_allocated_update_credits(::protocol::UpdateCredits* update_credits);
+  private:
+  const ::protocol::UpdateCredits& _internal_update_credits() const;
+  ::protocol::UpdateCredits* _internal_mutable_update_credits();
+  public:
+  void unsafe_arena_set_allocated_update_credits(
+      ::protocol::UpdateCredits* update_credits);
+  ::protocol::UpdateCredits* unsafe_arena_release_update_credits();
+
   void clear_message();
   MessageCase message_case() const;
   // @@protoc_insertion_point(class_scope:protocol.ServerMessage)
  private:
   class _Internal;
   void set_has_response();
+  void set_has_update_credits();
 
   inline bool has_message() const;
   inline void clear_has_message();
@@ -479,22 +877,28 @@ class ServerMessage PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  union MessageUnion {
-    MessageUnion() {}
-    ::protocol::Response* response_;
-  } message_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    union MessageUnion {
+      constexpr MessageUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::protocol::Response* response_;
+      ::protocol::UpdateCredits* update_credits_;
+    } message_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
 
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class InitRequest PROTOBUF_FINAL :
+class InitRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.InitRequest) */ {
  public:
   inline InitRequest() : InitRequest(nullptr) {}
-  virtual ~InitRequest();
+  ~InitRequest() override;
+  explicit PROTOBUF_CONSTEXPR InitRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   InitRequest(const InitRequest& from);
   InitRequest(InitRequest&& from) noexcept
@@ -507,8 +911,13 @@ class InitRequest PROTOBUF_FINAL :
     return *this;
   }
   inline InitRequest& operator=(InitRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -519,14 +928,14 @@ class InitRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InitRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const InitRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const InitRequest* internal_default_instance() {
     return reinterpret_cast<const InitRequest*>(
                &_InitRequest_default_instance_);
@@ -539,7 +948,12 @@ class InitRequest PROTOBUF_FINAL :
   }
   inline void Swap(InitRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -547,56 +961,53 @@ class InitRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(InitRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline InitRequest* New() const final {
-    return CreateMaybeMessage<InitRequest>(nullptr);
-  }
-
-  InitRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  InitRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<InitRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const InitRequest& from);
-  void MergeFrom(const InitRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InitRequest& from) {
+    InitRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(InitRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "protocol.InitRequest";
   }
   protected:
-  explicit InitRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit InitRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -605,39 +1016,65 @@ class InitRequest PROTOBUF_FINAL :
   enum : int {
     kRequestIdFieldNumber = 1,
     kClientIdFieldNumber = 2,
+    kSharedMemoryRingSizeFieldNumber = 3,
+    kFlowControlFieldNumber = 4,
+    kCompressionFieldNumber = 5,
   };
   // string request_id = 1;
   void clear_request_id();
   const std::string& request_id() const;
-  void set_request_id(const std::string& value);
-  void set_request_id(std::string&& value);
-  void set_request_id(const char* value);
-  void set_request_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_request_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_request_id();
-  std::string* release_request_id();
+  PROTOBUF_NODISCARD std::string* release_request_id();
   void set_allocated_request_id(std::string* request_id);
   private:
   const std::string& _internal_request_id() const;
-  void _internal_set_request_id(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_request_id(const std::string& value);
   std::string* _internal_mutable_request_id();
   public:
 
   // string client_id = 2;
   void clear_client_id();
   const std::string& client_id() const;
-  void set_client_id(const std::string& value);
-  void set_client_id(std::string&& value);
-  void set_client_id(const char* value);
-  void set_client_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_client_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_client_id();
-  std::string* release_client_id();
+  PROTOBUF_NODISCARD std::string* release_client_id();
   void set_allocated_client_id(std::string* client_id);
   private:
   const std::string& _internal_client_id() const;
-  void _internal_set_client_id(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_client_id(const std::string& value);
   std::string* _internal_mutable_client_id();
   public:
 
+  // uint32 shared_memory_ring_size = 3;
+  void clear_shared_memory_ring_size();
+  uint32_t shared_memory_ring_size() const;
+  void set_shared_memory_ring_size(uint32_t value);
+  private:
+  uint32_t _internal_shared_memory_ring_size() const;
+  void _internal_set_shared_memory_ring_size(uint32_t value);
+  public:
+
+  // bool flow_control = 4;
+  void clear_flow_control();
+  bool flow_control() const;
+  void set_flow_control(bool value);
+  private:
+  bool _internal_flow_control() const;
+  void _internal_set_flow_control(bool value);
+  public:
+
+  // .protocol.Compression compression = 5;
+  void clear_compression();
+  ::protocol::Compression compression() const;
+  void set_compression(::protocol::Compression value);
+  private:
+  ::protocol::Compression _internal_compression() const;
+  void _internal_set_compression(::protocol::Compression value);
+  public:
+
   // @@protoc_insertion_point(class_scope:protocol.InitRequest)
  private:
   class _Internal;
@@ -645,18 +1082,25 @@ class InitRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr client_id_;
+    uint32_t shared_memory_ring_size_;
+    bool flow_control_;
+    int compression_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Scene PROTOBUF_FINAL :
+class Scene final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.Scene) */ {
  public:
   inline Scene() : Scene(nullptr) {}
-  virtual ~Scene();
+  ~Scene() override;
+  explicit PROTOBUF_CONSTEXPR Scene(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Scene(const Scene& from);
   Scene(Scene&& from) noexcept
@@ -669,8 +1113,13 @@ class Scene PROTOBUF_FINAL :
     return *this;
   }
   inline Scene& operator=(Scene&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -681,14 +1130,14 @@ class Scene PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Scene& default_instance() {
+    return *internal_default_instance();
   }
-  static const Scene& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Scene* internal_default_instance() {
     return reinterpret_cast<const Scene*>(
                &_Scene_default_instance_);
@@ -701,7 +1150,12 @@ class Scene PROTOBUF_FINAL :
   }
   inline void Swap(Scene* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -709,56 +1163,53 @@ class Scene PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Scene* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Scene* New() const final {
-    return CreateMaybeMessage<Scene>(nullptr);
-  }
-
-  Scene* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Scene* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Scene>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Scene& from);
-  void MergeFrom(const Scene& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Scene& from) {
+    Scene::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Scene* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "protocol.Scene";
   }
   protected:
-  explicit Scene(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Scene(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -770,16 +1221,14 @@ class Scene PROTOBUF_FINAL :
   // string name = 1;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
@@ -790,17 +1239,21 @@ class Scene PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ApplyUpdate PROTOBUF_FINAL :
+class ApplyUpdate final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.ApplyUpdate) */ {
  public:
   inline ApplyUpdate() : ApplyUpdate(nullptr) {}
-  virtual ~ApplyUpdate();
+  ~ApplyUpdate() override;
+  explicit PROTOBUF_CONSTEXPR ApplyUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ApplyUpdate(const ApplyUpdate& from);
   ApplyUpdate(ApplyUpdate&& from) noexcept
@@ -813,8 +1266,13 @@ class ApplyUpdate PROTOBUF_FINAL :
     return *this;
   }
   inline ApplyUpdate& operator=(ApplyUpdate&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -825,13 +1283,14 @@ class ApplyUpdate PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ApplyUpdate& default_instance() {
+    return *internal_default_instance();
   }
-  static const ApplyUpdate& default_instance();
-
   enum ChangeCase {
     kCreateSource = 1,
     kUpdateSource = 3,
@@ -839,10 +1298,15 @@ class ApplyUpdate PROTOBUF_FINAL :
     kAppendChild = 2,
     kRemoveChild = 4,
     kCommitUpdates = 6,
+    kDefineKey = 7,
+    kDefineString = 8,
+    kSetLayoutValues = 9,
+    kInsertBefore = 10,
+    kMoveChild = 11,
+    kCreateTree = 12,
     CHANGE_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const ApplyUpdate* internal_default_instance() {
     return reinterpret_cast<const ApplyUpdate*>(
                &_ApplyUpdate_default_instance_);
@@ -855,7 +1319,12 @@ class ApplyUpdate PROTOBUF_FINAL :
   }
   inline void Swap(ApplyUpdate* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -863,56 +1332,53 @@ class ApplyUpdate PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ApplyUpdate* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ApplyUpdate* New() const final {
-    return CreateMaybeMessage<ApplyUpdate>(nullptr);
-  }
-
-  ApplyUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ApplyUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ApplyUpdate>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ApplyUpdate& from);
-  void MergeFrom(const ApplyUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ApplyUpdate& from) {
+    ApplyUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(ApplyUpdate* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "protocol.ApplyUpdate";
   }
   protected:
-  explicit ApplyUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ApplyUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -925,6 +1391,12 @@ class ApplyUpdate PROTOBUF_FINAL :
     kAppendChildFieldNumber = 2,
     kRemoveChildFieldNumber = 4,
     kCommitUpdatesFieldNumber = 6,
+    kDefineKeyFieldNumber = 7,
+    kDefineStringFieldNumber = 8,
+    kSetLayoutValuesFieldNumber = 9,
+    kInsertBeforeFieldNumber = 10,
+    kMoveChildFieldNumber = 11,
+    kCreateTreeFieldNumber = 12,
   };
   // .protocol.CreateSource create_source = 1;
   bool has_create_source() const;
@@ -933,7 +1405,7 @@ class ApplyUpdate PROTOBUF_FINAL :
   public:
   void clear_create_source();
   const ::protocol::CreateSource& create_source() const;
-  ::protocol::CreateSource* release_create_source();
+  PROTOBUF_NODISCARD ::protocol::CreateSource* release_create_source();
   ::protocol::CreateSource* mutable_create_source();
   void set_allocated_create_source(::protocol::CreateSource* create_source);
   private:
@@ -951,7 +1423,7 @@ class ApplyUpdate PROTOBUF_FINAL :
   public:
   void clear_update_source();
   const ::protocol::UpdateSource& update_source() const;
-  ::protocol::UpdateSource* release_update_source();
+  PROTOBUF_NODISCARD ::protocol::UpdateSource* release_update_source();
   ::protocol::UpdateSource* mutable_update_source();
   void set_allocated_update_source(::protocol::UpdateSource* update_source);
   private:
@@ -969,7 +1441,7 @@ class ApplyUpdate PROTOBUF_FINAL :
   public:
   void clear_create_scene();
   const ::protocol::CreateScene& create_scene() const;
-  ::protocol::CreateScene* release_create_scene();
+  PROTOBUF_NODISCARD ::protocol::CreateScene* release_create_scene();
   ::protocol::CreateScene* mutable_create_scene();
   void set_allocated_create_scene(::protocol::CreateScene* create_scene);
   private:
@@ -987,7 +1459,7 @@ class ApplyUpdate PROTOBUF_FINAL :
   public:
   void clear_append_child();
   const ::protocol::AppendChild& append_child() const;
-  ::protocol::AppendChild* release_append_child();
+  PROTOBUF_NODISCARD ::protocol::AppendChild* release_append_child();
   ::protocol::AppendChild* mutable_append_child();
   void set_allocated_append_child(::protocol::AppendChild* append_child);
   private:
@@ -1005,7 +1477,7 @@ class ApplyUpdate PROTOBUF_FINAL :
   public:
   void clear_remove_child();
   const ::protocol::RemoveChild& remove_child() const;
-  ::protocol::RemoveChild* release_remove_child();
+  PROTOBUF_NODISCARD ::protocol::RemoveChild* release_remove_child();
   ::protocol::RemoveChild* mutable_remove_child();
   void set_allocated_remove_child(::protocol::RemoveChild* remove_child);
   private:
@@ -1023,7 +1495,7 @@ class ApplyUpdate PROTOBUF_FINAL :
   public:
   void clear_commit_updates();
   const ::protocol::CommitUpdates& commit_updates() const;
-  ::protocol::CommitUpdates* release_commit_updates();
+  PROTOBUF_NODISCARD ::protocol::CommitUpdates* release_commit_updates();
   ::protocol::CommitUpdates* mutable_commit_updates();
   void set_allocated_commit_updates(::protocol::CommitUpdates* commit_updates);
   private:
@@ -1034,6 +1506,114 @@ class ApplyUpdate PROTOBUF_FINAL :
       ::protocol::CommitUpdates* commit_updates);
   ::protocol::CommitUpdates* unsafe_arena_release_commit_updates();
 
+  // .protocol.DefineKey define_key = 7;
+  bool has_define_key() const;
+  private:
+  bool _internal_has_define_key() const;
+  public:
+  void clear_define_key();
+  const ::protocol::DefineKey& define_key() const;
+  PROTOBUF_NODISCARD ::protocol::DefineKey* release_define_key();
+  ::protocol::DefineKey* mutable_define_key();
+  void set_allocated_define_key(::protocol::DefineKey* define_key);
+  private:
+  const ::protocol::DefineKey& _internal_define_key() const;
+  ::protocol::DefineKey* _internal_mutable_define_key();
+  public:
+  void unsafe_arena_set_allocated_define_key(
+      ::protocol::DefineKey* define_key);
+  ::protocol::DefineKey* unsafe_arena_release_define_key();
+
+  // .protocol.DefineString define_string = 8;
+  bool has_define_string() const;
+  private:
+  bool _internal_has_define_string() const;
+  public:
+  void clear_define_string();
+  const ::protocol::DefineString& define_string() const;
+  PROTOBUF_NODISCARD ::protocol::DefineString* release_define_string();
+  ::protocol::DefineString* mutable_define_string();
+  void set_allocated_define_string(::protocol::DefineString* define_string);
+  private:
+  const ::protocol::DefineString& _internal_define_string() const;
+  ::protocol::DefineString* _internal_mutable_define_string();
+  public:
+  void unsafe_arena_set_allocated_define_string(
+      ::protocol::DefineString* define_string);
+  ::protocol::DefineString* unsafe_arena_release_define_string();
+
+  // .protocol.SetLayoutValues set_layout_values = 9;
+  bool has_set_layout_values() const;
+  private:
+  bool _internal_has_set_layout_values() const;
+  public:
+  void clear_set_layout_values();
+  const ::protocol::SetLayoutValues& set_layout_values() const;
+  PROTOBUF_NODISCARD ::protocol::SetLayoutValues* release_set_layout_values();
+  ::protocol::SetLayoutValues* mutable_set_layout_values();
+  void set_allocated_set_layout_values(::protocol::SetLayoutValues* set_layout_values);
+  private:
+  const ::protocol::SetLayoutValues& _internal_set_layout_values() const;
+  ::protocol::SetLayoutValues* _internal_mutable_set_layout_values();
+  public:
+  void unsafe_arena_set_allocated_set_layout_values(
+      ::protocol::SetLayoutValues* set_layout_values);
+  ::protocol::SetLayoutValues* unsafe_arena_release_set_layout_values();
+
+  // .protocol.InsertBefore insert_before = 10;
+  bool has_insert_before() const;
+  private:
+  bool _internal_has_insert_before() const;
+  public:
+  void clear_insert_before();
+  const ::protocol::InsertBefore& insert_before() const;
+  PROTOBUF_NODISCARD ::protocol::InsertBefore* release_insert_before();
+  ::protocol::InsertBefore* mutable_insert_before();
+  void set_allocated_insert_before(::protocol::InsertBefore* insert_before);
+  private:
+  const ::protocol::InsertBefore& _internal_insert_before() const;
+  ::protocol::InsertBefore* _internal_mutable_insert_before();
+  public:
+  void unsafe_arena_set_allocated_insert_before(
+      ::protocol::InsertBefore* insert_before);
+  ::protocol::InsertBefore* unsafe_arena_release_insert_before();
+
+  // .protocol.MoveChild move_child = 11;
+  bool has_move_child() const;
+  private:
+  bool _internal_has_move_child() const;
+  public:
+  void clear_move_child();
+  const ::protocol::MoveChild& move_child() const;
+  PROTOBUF_NODISCARD ::protocol::MoveChild* release_move_child();
+  ::protocol::MoveChild* mutable_move_child();
+  void set_allocated_move_child(::protocol::MoveChild* move_child);
+  private:
+  const ::protocol::MoveChild& _internal_move_child() const;
+  ::protocol::MoveChild* _internal_mutable_move_child();
+  public:
+  void unsafe_arena_set_allocated_move_child(
+      ::protocol::MoveChild* move_child);
+  ::protocol::MoveChild* unsafe_arena_release_move_child();
+
+  // .protocol.CreateTree create_tree = 12;
+  bool has_create_tree() const;
+  private:
+  bool _internal_has_create_tree() const;
+  public:
+  void clear_create_tree();
+  const ::protocol::CreateTree& create_tree() const;
+  PROTOBUF_NODISCARD ::protocol::CreateTree* release_create_tree();
+  ::protocol::CreateTree* mutable_create_tree();
+  void set_allocated_create_tree(::protocol::CreateTree* create_tree);
+  private:
+  const ::protocol::CreateTree& _internal_create_tree() const;
+  ::protocol::CreateTree* _internal_mutable_create_tree();
+  public:
+  void unsafe_arena_set_allocated_create_tree(
+      ::protocol::CreateTree* create_tree);
+  ::protocol::CreateTree* unsafe_arena_release_create_tree();
+
   void clear_change();
   ChangeCase change_case() const;
   // @@protoc_insertion_point(class_scope:protocol.ApplyUpdate)
@@ -1045,6 +1625,12 @@ class ApplyUpdate PROTOBUF_FINAL :
   void set_has_append_child();
   void set_has_remove_child();
   void set_has_commit_updates();
+  void set_has_define_key();
+  void set_has_define_string();
+  void set_has_set_layout_values();
+  void set_has_insert_before();
+  void set_has_move_child();
+  void set_has_create_tree();
 
   inline bool has_change() const;
   inline void clear_has_change();
@@ -1052,27 +1638,195 @@ class ApplyUpdate PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  union ChangeUnion {
-    ChangeUnion() {}
-    ::protocol::CreateSource* create_source_;
-    ::protocol::UpdateSource* update_source_;
-    ::protocol::CreateScene* create_scene_;
-    ::protocol::AppendChild* append_child_;
-    ::protocol::RemoveChild* remove_child_;
-    ::protocol::CommitUpdates* commit_updates_;
-  } change_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
+  struct Impl_ {
+    union ChangeUnion {
+      constexpr ChangeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::protocol::CreateSource* create_source_;
+      ::protocol::UpdateSource* update_source_;
+      ::protocol::CreateScene* create_scene_;
+      ::protocol::AppendChild* append_child_;
+      ::protocol::RemoveChild* remove_child_;
+      ::protocol::CommitUpdates* commit_updates_;
+      ::protocol::DefineKey* define_key_;
+      ::protocol::DefineString* define_string_;
+      ::protocol::SetLayoutValues* set_layout_values_;
+      ::protocol::InsertBefore* insert_before_;
+      ::protocol::MoveChild* move_child_;
+      ::protocol::CreateTree* create_tree_;
+    } change_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UpdateBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.UpdateBatch) */ {
+ public:
+  inline UpdateBatch() : UpdateBatch(nullptr) {}
+  ~UpdateBatch() override;
+  explicit PROTOBUF_CONSTEXPR UpdateBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UpdateBatch(const UpdateBatch& from);
+  UpdateBatch(UpdateBatch&& from) noexcept
+    : UpdateBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline UpdateBatch& operator=(const UpdateBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UpdateBatch& operator=(UpdateBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UpdateBatch* internal_default_instance() {
+    return reinterpret_cast<const UpdateBatch*>(
+               &_UpdateBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(UpdateBatch& a, UpdateBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UpdateBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UpdateBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpdateBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateBatch& from) {
+    UpdateBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UpdateBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.UpdateBatch";
+  }
+  protected:
+  explicit UpdateBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUpdatesFieldNumber = 1,
+  };
+  // repeated .protocol.ApplyUpdate updates = 1;
+  int updates_size() const;
+  private:
+  int _internal_updates_size() const;
+  public:
+  void clear_updates();
+  ::protocol::ApplyUpdate* mutable_updates(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::ApplyUpdate >*
+      mutable_updates();
+  private:
+  const ::protocol::ApplyUpdate& _internal_updates(int index) const;
+  ::protocol::ApplyUpdate* _internal_add_updates();
+  public:
+  const ::protocol::ApplyUpdate& updates(int index) const;
+  ::protocol::ApplyUpdate* add_updates();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::ApplyUpdate >&
+      updates() const;
+
+  // @@protoc_insertion_point(class_scope:protocol.UpdateBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::ApplyUpdate > updates_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class FindSourceRequest PROTOBUF_FINAL :
+class FindSourceRequest final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.FindSourceRequest) */ {
  public:
   inline FindSourceRequest() : FindSourceRequest(nullptr) {}
-  virtual ~FindSourceRequest();
+  ~FindSourceRequest() override;
+  explicit PROTOBUF_CONSTEXPR FindSourceRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   FindSourceRequest(const FindSourceRequest& from);
   FindSourceRequest(FindSourceRequest&& from) noexcept
@@ -1085,8 +1839,13 @@ class FindSourceRequest PROTOBUF_FINAL :
     return *this;
   }
   inline FindSourceRequest& operator=(FindSourceRequest&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1097,27 +1856,32 @@ class FindSourceRequest PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FindSourceRequest& default_instance() {
+    return *internal_default_instance();
   }
-  static const FindSourceRequest& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const FindSourceRequest* internal_default_instance() {
     return reinterpret_cast<const FindSourceRequest*>(
                &_FindSourceRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
   friend void swap(FindSourceRequest& a, FindSourceRequest& b) {
     a.Swap(&b);
   }
   inline void Swap(FindSourceRequest* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1125,56 +1889,53 @@ class FindSourceRequest PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(FindSourceRequest* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline FindSourceRequest* New() const final {
-    return CreateMaybeMessage<FindSourceRequest>(nullptr);
-  }
-
-  FindSourceRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  FindSourceRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<FindSourceRequest>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const FindSourceRequest& from);
-  void MergeFrom(const FindSourceRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FindSourceRequest& from) {
+    FindSourceRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(FindSourceRequest* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "protocol.FindSourceRequest";
   }
   protected:
-  explicit FindSourceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit FindSourceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1184,55 +1945,59 @@ class FindSourceRequest PROTOBUF_FINAL :
     kRequestIdFieldNumber = 1,
     kUidFieldNumber = 2,
     kNameFieldNumber = 3,
+    kHandleFieldNumber = 4,
   };
   // string request_id = 1;
   void clear_request_id();
   const std::string& request_id() const;
-  void set_request_id(const std::string& value);
-  void set_request_id(std::string&& value);
-  void set_request_id(const char* value);
-  void set_request_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_request_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_request_id();
-  std::string* release_request_id();
+  PROTOBUF_NODISCARD std::string* release_request_id();
   void set_allocated_request_id(std::string* request_id);
   private:
   const std::string& _internal_request_id() const;
-  void _internal_set_request_id(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_request_id(const std::string& value);
   std::string* _internal_mutable_request_id();
   public:
 
   // string uid = 2;
   void clear_uid();
   const std::string& uid() const;
-  void set_uid(const std::string& value);
-  void set_uid(std::string&& value);
-  void set_uid(const char* value);
-  void set_uid(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uid(ArgT0&& arg0, ArgT... args);
   std::string* mutable_uid();
-  std::string* release_uid();
+  PROTOBUF_NODISCARD std::string* release_uid();
   void set_allocated_uid(std::string* uid);
   private:
   const std::string& _internal_uid() const;
-  void _internal_set_uid(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uid(const std::string& value);
   std::string* _internal_mutable_uid();
   public:
 
   // string name = 3;
   void clear_name();
   const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
   std::string* mutable_name();
-  std::string* release_name();
+  PROTOBUF_NODISCARD std::string* release_name();
   void set_allocated_name(std::string* name);
   private:
   const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
   std::string* _internal_mutable_name();
   public:
 
+  // uint32 handle = 4;
+  void clear_handle();
+  uint32_t handle() const;
+  void set_handle(uint32_t value);
+  private:
+  uint32_t _internal_handle() const;
+  void _internal_set_handle(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:protocol.FindSourceRequest)
  private:
   class _Internal;
@@ -1240,19 +2005,24 @@ class FindSourceRequest PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Response PROTOBUF_FINAL :
+class Response final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.Response) */ {
  public:
   inline Response() : Response(nullptr) {}
-  virtual ~Response();
+  ~Response() override;
+  explicit PROTOBUF_CONSTEXPR Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Response(const Response& from);
   Response(Response&& from) noexcept
@@ -1265,8 +2035,13 @@ class Response PROTOBUF_FINAL :
     return *this;
   }
   inline Response& operator=(Response&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1277,27 +2052,32 @@ class Response PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response& default_instance() {
+    return *internal_default_instance();
   }
-  static const Response& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const Response* internal_default_instance() {
     return reinterpret_cast<const Response*>(
                &_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
   friend void swap(Response& a, Response& b) {
     a.Swap(&b);
   }
   inline void Swap(Response* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -1305,56 +2085,53 @@ class Response PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(Response* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Response* New() const final {
-    return CreateMaybeMessage<Response>(nullptr);
-  }
-
-  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Response>(arena);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Response& from);
-  void MergeFrom(const Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response& from) {
+    Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Response* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "protocol.Response";
   }
   protected:
-  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
@@ -1362,24 +2139,71 @@ class Response PROTOBUF_FINAL :
 
   enum : int {
     kRequestIdFieldNumber = 1,
+    kSharedMemoryFieldNumber = 3,
+    kCompressionFieldNumber = 5,
+    kUpdateCreditsFieldNumber = 4,
     kSuccessFieldNumber = 2,
+    kSessionResumedFieldNumber = 6,
   };
   // string request_id = 1;
   void clear_request_id();
   const std::string& request_id() const;
-  void set_request_id(const std::string& value);
-  void set_request_id(std::string&& value);
-  void set_request_id(const char* value);
-  void set_request_id(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_request_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_request_id();
-  std::string* release_request_id();
+  PROTOBUF_NODISCARD std::string* release_request_id();
   void set_allocated_request_id(std::string* request_id);
   private:
   const std::string& _internal_request_id() const;
-  void _internal_set_request_id(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_request_id(const std::string& value);
   std::string* _internal_mutable_request_id();
   public:
 
+  // .protocol.SharedMemoryTransport shared_memory = 3;
+  bool has_shared_memory() const;
+  private:
+  bool _internal_has_shared_memory() const;
+  public:
+  void clear_shared_memory();
+  const ::protocol::SharedMemoryTransport& shared_memory() const;
+  PROTOBUF_NODISCARD ::protocol::SharedMemoryTransport* release_shared_memory();
+  ::protocol::SharedMemoryTransport* mutable_shared_memory();
+  void set_allocated_shared_memory(::protocol::SharedMemoryTransport* shared_memory);
+  private:
+  const ::protocol::SharedMemoryTransport& _internal_shared_memory() const;
+  ::protocol::SharedMemoryTransport* _internal_mutable_shared_memory();
+  public:
+  void unsafe_arena_set_allocated_shared_memory(
+      ::protocol::SharedMemoryTransport* shared_memory);
+  ::protocol::SharedMemoryTransport* unsafe_arena_release_shared_memory();
+
+  // .protocol.FrameCompression compression = 5;
+  bool has_compression() const;
+  private:
+  bool _internal_has_compression() const;
+  public:
+  void clear_compression();
+  const ::protocol::FrameCompression& compression() const;
+  PROTOBUF_NODISCARD ::protocol::FrameCompression* release_compression();
+  ::protocol::FrameCompression* mutable_compression();
+  void set_allocated_compression(::protocol::FrameCompression* compression);
+  private:
+  const ::protocol::FrameCompression& _internal_compression() const;
+  ::protocol::FrameCompression* _internal_mutable_compression();
+  public:
+  void unsafe_arena_set_allocated_compression(
+      ::protocol::FrameCompression* compression);
+  ::protocol::FrameCompression* unsafe_arena_release_compression();
+
+  // uint32 update_credits = 4;
+  void clear_update_credits();
+  uint32_t update_credits() const;
+  void set_update_credits(uint32_t value);
+  private:
+  uint32_t _internal_update_credits() const;
+  void _internal_set_update_credits(uint32_t value);
+  public:
+
   // bool success = 2;
   void clear_success();
   bool success() const;
@@ -1389,6 +2213,15 @@ class Response PROTOBUF_FINAL :
   void _internal_set_success(bool value);
   public:
 
+  // bool session_resumed = 6;
+  void clear_session_resumed();
+  bool session_resumed() const;
+  void set_session_resumed(bool value);
+  private:
+  bool _internal_session_resumed() const;
+  void _internal_set_session_resumed(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:protocol.Response)
  private:
   class _Internal;
@@ -1396,32 +2229,45 @@ class Response PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
-  bool success_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr request_id_;
+    ::protocol::SharedMemoryTransport* shared_memory_;
+    ::protocol::FrameCompression* compression_;
+    uint32_t update_credits_;
+    bool success_;
+    bool session_resumed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CreateSource PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.CreateSource) */ {
+class SharedMemoryTransport final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.SharedMemoryTransport) */ {
  public:
-  inline CreateSource() : CreateSource(nullptr) {}
-  virtual ~CreateSource();
+  inline SharedMemoryTransport() : SharedMemoryTransport(nullptr) {}
+  ~SharedMemoryTransport() override;
+  explicit PROTOBUF_CONSTEXPR SharedMemoryTransport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CreateSource(const CreateSource& from);
-  CreateSource(CreateSource&& from) noexcept
-    : CreateSource() {
+  SharedMemoryTransport(const SharedMemoryTransport& from);
+  SharedMemoryTransport(SharedMemoryTransport&& from) noexcept
+    : SharedMemoryTransport() {
     *this = ::std::move(from);
   }
 
-  inline CreateSource& operator=(const CreateSource& from) {
+  inline SharedMemoryTransport& operator=(const SharedMemoryTransport& from) {
     CopyFrom(from);
     return *this;
   }
-  inline CreateSource& operator=(CreateSource&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline SharedMemoryTransport& operator=(SharedMemoryTransport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1432,214 +2278,144 @@ class CreateSource PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const CreateSource& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const CreateSource* internal_default_instance() {
-    return reinterpret_cast<const CreateSource*>(
-               &_CreateSource_default_instance_);
+  static const SharedMemoryTransport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SharedMemoryTransport* internal_default_instance() {
+    return reinterpret_cast<const SharedMemoryTransport*>(
+               &_SharedMemoryTransport_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
-  friend void swap(CreateSource& a, CreateSource& b) {
+  friend void swap(SharedMemoryTransport& a, SharedMemoryTransport& b) {
     a.Swap(&b);
   }
-  inline void Swap(CreateSource* other) {
+  inline void Swap(SharedMemoryTransport* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(CreateSource* other) {
+  void UnsafeArenaSwap(SharedMemoryTransport* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CreateSource* New() const final {
-    return CreateMaybeMessage<CreateSource>(nullptr);
+  SharedMemoryTransport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SharedMemoryTransport>(arena);
   }
-
-  CreateSource* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<CreateSource>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SharedMemoryTransport& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SharedMemoryTransport& from) {
+    SharedMemoryTransport::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const CreateSource& from);
-  void MergeFrom(const CreateSource& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(CreateSource* other);
+  void InternalSwap(SharedMemoryTransport* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "protocol.CreateSource";
+    return "protocol.SharedMemoryTransport";
   }
   protected:
-  explicit CreateSource(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit SharedMemoryTransport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUidFieldNumber = 1,
-    kIdFieldNumber = 2,
-    kNameFieldNumber = 3,
-    kContainerUidFieldNumber = 5,
-    kSettingsFieldNumber = 4,
+    kRingSizeFieldNumber = 1,
   };
-  // string uid = 1;
-  void clear_uid();
-  const std::string& uid() const;
-  void set_uid(const std::string& value);
-  void set_uid(std::string&& value);
-  void set_uid(const char* value);
-  void set_uid(const char* value, size_t size);
-  std::string* mutable_uid();
-  std::string* release_uid();
-  void set_allocated_uid(std::string* uid);
-  private:
-  const std::string& _internal_uid() const;
-  void _internal_set_uid(const std::string& value);
-  std::string* _internal_mutable_uid();
-  public:
-
-  // string id = 2;
-  void clear_id();
-  const std::string& id() const;
-  void set_id(const std::string& value);
-  void set_id(std::string&& value);
-  void set_id(const char* value);
-  void set_id(const char* value, size_t size);
-  std::string* mutable_id();
-  std::string* release_id();
-  void set_allocated_id(std::string* id);
-  private:
-  const std::string& _internal_id() const;
-  void _internal_set_id(const std::string& value);
-  std::string* _internal_mutable_id();
-  public:
-
-  // string name = 3;
-  void clear_name();
-  const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  std::string* mutable_name();
-  std::string* release_name();
-  void set_allocated_name(std::string* name);
-  private:
-  const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
-  std::string* _internal_mutable_name();
-  public:
-
-  // string container_uid = 5;
-  void clear_container_uid();
-  const std::string& container_uid() const;
-  void set_container_uid(const std::string& value);
-  void set_container_uid(std::string&& value);
-  void set_container_uid(const char* value);
-  void set_container_uid(const char* value, size_t size);
-  std::string* mutable_container_uid();
-  std::string* release_container_uid();
-  void set_allocated_container_uid(std::string* container_uid);
+  // uint32 ring_size = 1;
+  void clear_ring_size();
+  uint32_t ring_size() const;
+  void set_ring_size(uint32_t value);
   private:
-  const std::string& _internal_container_uid() const;
-  void _internal_set_container_uid(const std::string& value);
-  std::string* _internal_mutable_container_uid();
-  public:
-
-  // .protocol.ObjectValue settings = 4;
-  bool has_settings() const;
-  private:
-  bool _internal_has_settings() const;
-  public:
-  void clear_settings();
-  const ::protocol::ObjectValue& settings() const;
-  ::protocol::ObjectValue* release_settings();
-  ::protocol::ObjectValue* mutable_settings();
-  void set_allocated_settings(::protocol::ObjectValue* settings);
-  private:
-  const ::protocol::ObjectValue& _internal_settings() const;
-  ::protocol::ObjectValue* _internal_mutable_settings();
+  uint32_t _internal_ring_size() const;
+  void _internal_set_ring_size(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_settings(
-      ::protocol::ObjectValue* settings);
-  ::protocol::ObjectValue* unsafe_arena_release_settings();
 
-  // @@protoc_insertion_point(class_scope:protocol.CreateSource)
+  // @@protoc_insertion_point(class_scope:protocol.SharedMemoryTransport)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr container_uid_;
-  ::protocol::ObjectValue* settings_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t ring_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class UpdateSource PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.UpdateSource) */ {
+class FrameCompression final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.FrameCompression) */ {
  public:
-  inline UpdateSource() : UpdateSource(nullptr) {}
-  virtual ~UpdateSource();
+  inline FrameCompression() : FrameCompression(nullptr) {}
+  ~FrameCompression() override;
+  explicit PROTOBUF_CONSTEXPR FrameCompression(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UpdateSource(const UpdateSource& from);
-  UpdateSource(UpdateSource&& from) noexcept
-    : UpdateSource() {
+  FrameCompression(const FrameCompression& from);
+  FrameCompression(FrameCompression&& from) noexcept
+    : FrameCompression() {
     *this = ::std::move(from);
   }
 
-  inline UpdateSource& operator=(const UpdateSource& from) {
+  inline FrameCompression& operator=(const FrameCompression& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UpdateSource& operator=(UpdateSource&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline FrameCompression& operator=(FrameCompression&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1650,160 +2426,171 @@ class UpdateSource PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const UpdateSource& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const UpdateSource* internal_default_instance() {
-    return reinterpret_cast<const UpdateSource*>(
-               &_UpdateSource_default_instance_);
+  static const FrameCompression& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FrameCompression* internal_default_instance() {
+    return reinterpret_cast<const FrameCompression*>(
+               &_FrameCompression_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
-  friend void swap(UpdateSource& a, UpdateSource& b) {
+  friend void swap(FrameCompression& a, FrameCompression& b) {
     a.Swap(&b);
   }
-  inline void Swap(UpdateSource* other) {
+  inline void Swap(FrameCompression* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(UpdateSource* other) {
+  void UnsafeArenaSwap(FrameCompression* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline UpdateSource* New() const final {
-    return CreateMaybeMessage<UpdateSource>(nullptr);
+  FrameCompression* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FrameCompression>(arena);
   }
-
-  UpdateSource* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<UpdateSource>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FrameCompression& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FrameCompression& from) {
+    FrameCompression::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const UpdateSource& from);
-  void MergeFrom(const UpdateSource& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(UpdateSource* other);
+  void InternalSwap(FrameCompression* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "protocol.UpdateSource";
+    return "protocol.FrameCompression";
   }
   protected:
-  explicit UpdateSource(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit FrameCompression(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUidFieldNumber = 2,
-    kChangedPropsFieldNumber = 3,
+    kDictionaryFieldNumber = 3,
+    kAlgorithmFieldNumber = 1,
+    kThresholdFieldNumber = 2,
   };
-  // string uid = 2;
-  void clear_uid();
-  const std::string& uid() const;
-  void set_uid(const std::string& value);
-  void set_uid(std::string&& value);
-  void set_uid(const char* value);
-  void set_uid(const char* value, size_t size);
-  std::string* mutable_uid();
-  std::string* release_uid();
-  void set_allocated_uid(std::string* uid);
+  // bytes dictionary = 3;
+  void clear_dictionary();
+  const std::string& dictionary() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dictionary(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_dictionary();
+  PROTOBUF_NODISCARD std::string* release_dictionary();
+  void set_allocated_dictionary(std::string* dictionary);
   private:
-  const std::string& _internal_uid() const;
-  void _internal_set_uid(const std::string& value);
-  std::string* _internal_mutable_uid();
+  const std::string& _internal_dictionary() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dictionary(const std::string& value);
+  std::string* _internal_mutable_dictionary();
   public:
 
-  // .protocol.ObjectValue changed_props = 3;
-  bool has_changed_props() const;
+  // .protocol.Compression algorithm = 1;
+  void clear_algorithm();
+  ::protocol::Compression algorithm() const;
+  void set_algorithm(::protocol::Compression value);
   private:
-  bool _internal_has_changed_props() const;
+  ::protocol::Compression _internal_algorithm() const;
+  void _internal_set_algorithm(::protocol::Compression value);
   public:
-  void clear_changed_props();
-  const ::protocol::ObjectValue& changed_props() const;
-  ::protocol::ObjectValue* release_changed_props();
-  ::protocol::ObjectValue* mutable_changed_props();
-  void set_allocated_changed_props(::protocol::ObjectValue* changed_props);
+
+  // uint32 threshold = 2;
+  void clear_threshold();
+  uint32_t threshold() const;
+  void set_threshold(uint32_t value);
   private:
-  const ::protocol::ObjectValue& _internal_changed_props() const;
-  ::protocol::ObjectValue* _internal_mutable_changed_props();
+  uint32_t _internal_threshold() const;
+  void _internal_set_threshold(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_changed_props(
-      ::protocol::ObjectValue* changed_props);
-  ::protocol::ObjectValue* unsafe_arena_release_changed_props();
 
-  // @@protoc_insertion_point(class_scope:protocol.UpdateSource)
+  // @@protoc_insertion_point(class_scope:protocol.FrameCompression)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uid_;
-  ::protocol::ObjectValue* changed_props_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dictionary_;
+    int algorithm_;
+    uint32_t threshold_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CreateScene PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.CreateScene) */ {
+class UpdateCredits final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.UpdateCredits) */ {
  public:
-  inline CreateScene() : CreateScene(nullptr) {}
-  virtual ~CreateScene();
+  inline UpdateCredits() : UpdateCredits(nullptr) {}
+  ~UpdateCredits() override;
+  explicit PROTOBUF_CONSTEXPR UpdateCredits(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CreateScene(const CreateScene& from);
-  CreateScene(CreateScene&& from) noexcept
-    : CreateScene() {
+  UpdateCredits(const UpdateCredits& from);
+  UpdateCredits(UpdateCredits&& from) noexcept
+    : UpdateCredits() {
     *this = ::std::move(from);
   }
 
-  inline CreateScene& operator=(const CreateScene& from) {
+  inline UpdateCredits& operator=(const UpdateCredits& from) {
     CopyFrom(from);
     return *this;
   }
-  inline CreateScene& operator=(CreateScene&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline UpdateCredits& operator=(UpdateCredits&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -1814,196 +2601,144 @@ class CreateScene PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const CreateScene& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const CreateScene* internal_default_instance() {
-    return reinterpret_cast<const CreateScene*>(
-               &_CreateScene_default_instance_);
+  static const UpdateCredits& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UpdateCredits* internal_default_instance() {
+    return reinterpret_cast<const UpdateCredits*>(
+               &_UpdateCredits_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    10;
 
-  friend void swap(CreateScene& a, CreateScene& b) {
+  friend void swap(UpdateCredits& a, UpdateCredits& b) {
     a.Swap(&b);
   }
-  inline void Swap(CreateScene* other) {
+  inline void Swap(UpdateCredits* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(CreateScene* other) {
+  void UnsafeArenaSwap(UpdateCredits* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CreateScene* New() const final {
-    return CreateMaybeMessage<CreateScene>(nullptr);
+  UpdateCredits* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateCredits>(arena);
   }
-
-  CreateScene* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<CreateScene>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpdateCredits& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateCredits& from) {
+    UpdateCredits::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const CreateScene& from);
-  void MergeFrom(const CreateScene& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(CreateScene* other);
+  void InternalSwap(UpdateCredits* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "protocol.CreateScene";
+    return "protocol.UpdateCredits";
   }
   protected:
-  explicit CreateScene(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit UpdateCredits(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUidFieldNumber = 1,
-    kNameFieldNumber = 2,
-    kContainerUidFieldNumber = 4,
-    kPropsFieldNumber = 3,
+    kCreditsFieldNumber = 1,
   };
-  // string uid = 1;
-  void clear_uid();
-  const std::string& uid() const;
-  void set_uid(const std::string& value);
-  void set_uid(std::string&& value);
-  void set_uid(const char* value);
-  void set_uid(const char* value, size_t size);
-  std::string* mutable_uid();
-  std::string* release_uid();
-  void set_allocated_uid(std::string* uid);
-  private:
-  const std::string& _internal_uid() const;
-  void _internal_set_uid(const std::string& value);
-  std::string* _internal_mutable_uid();
-  public:
-
-  // string name = 2;
-  void clear_name();
-  const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  std::string* mutable_name();
-  std::string* release_name();
-  void set_allocated_name(std::string* name);
+  // uint32 credits = 1;
+  void clear_credits();
+  uint32_t credits() const;
+  void set_credits(uint32_t value);
   private:
-  const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
-  std::string* _internal_mutable_name();
-  public:
-
-  // string container_uid = 4;
-  void clear_container_uid();
-  const std::string& container_uid() const;
-  void set_container_uid(const std::string& value);
-  void set_container_uid(std::string&& value);
-  void set_container_uid(const char* value);
-  void set_container_uid(const char* value, size_t size);
-  std::string* mutable_container_uid();
-  std::string* release_container_uid();
-  void set_allocated_container_uid(std::string* container_uid);
-  private:
-  const std::string& _internal_container_uid() const;
-  void _internal_set_container_uid(const std::string& value);
-  std::string* _internal_mutable_container_uid();
-  public:
-
-  // .protocol.ObjectValue props = 3;
-  bool has_props() const;
-  private:
-  bool _internal_has_props() const;
-  public:
-  void clear_props();
-  const ::protocol::ObjectValue& props() const;
-  ::protocol::ObjectValue* release_props();
-  ::protocol::ObjectValue* mutable_props();
-  void set_allocated_props(::protocol::ObjectValue* props);
-  private:
-  const ::protocol::ObjectValue& _internal_props() const;
-  ::protocol::ObjectValue* _internal_mutable_props();
+  uint32_t _internal_credits() const;
+  void _internal_set_credits(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_props(
-      ::protocol::ObjectValue* props);
-  ::protocol::ObjectValue* unsafe_arena_release_props();
 
-  // @@protoc_insertion_point(class_scope:protocol.CreateScene)
+  // @@protoc_insertion_point(class_scope:protocol.UpdateCredits)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr container_uid_;
-  ::protocol::ObjectValue* props_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint32_t credits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AppendChild PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.AppendChild) */ {
+class CreateSource final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.CreateSource) */ {
  public:
-  inline AppendChild() : AppendChild(nullptr) {}
-  virtual ~AppendChild();
+  inline CreateSource() : CreateSource(nullptr) {}
+  ~CreateSource() override;
+  explicit PROTOBUF_CONSTEXPR CreateSource(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  AppendChild(const AppendChild& from);
-  AppendChild(AppendChild&& from) noexcept
-    : AppendChild() {
+  CreateSource(const CreateSource& from);
+  CreateSource(CreateSource&& from) noexcept
+    : CreateSource() {
     *this = ::std::move(from);
   }
 
-  inline AppendChild& operator=(const AppendChild& from) {
+  inline CreateSource& operator=(const CreateSource& from) {
     CopyFrom(from);
     return *this;
   }
-  inline AppendChild& operator=(AppendChild&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline CreateSource& operator=(CreateSource&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2014,158 +2749,259 @@ class AppendChild PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const AppendChild& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const AppendChild* internal_default_instance() {
-    return reinterpret_cast<const AppendChild*>(
-               &_AppendChild_default_instance_);
+  static const CreateSource& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateSource* internal_default_instance() {
+    return reinterpret_cast<const CreateSource*>(
+               &_CreateSource_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
-  friend void swap(AppendChild& a, AppendChild& b) {
+  friend void swap(CreateSource& a, CreateSource& b) {
     a.Swap(&b);
   }
-  inline void Swap(AppendChild* other) {
+  inline void Swap(CreateSource* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(AppendChild* other) {
+  void UnsafeArenaSwap(CreateSource* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AppendChild* New() const final {
-    return CreateMaybeMessage<AppendChild>(nullptr);
+  CreateSource* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateSource>(arena);
   }
-
-  AppendChild* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<AppendChild>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateSource& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateSource& from) {
+    CreateSource::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const AppendChild& from);
-  void MergeFrom(const AppendChild& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(AppendChild* other);
+  void InternalSwap(CreateSource* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "protocol.AppendChild";
+    return "protocol.CreateSource";
   }
   protected:
-  explicit AppendChild(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit CreateSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kParentUidFieldNumber = 1,
-    kChildUidFieldNumber = 2,
+    kUidFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kNameFieldNumber = 3,
+    kContainerUidFieldNumber = 5,
+    kSettingsFieldNumber = 4,
+    kStyleFieldNumber = 8,
+    kHandleFieldNumber = 6,
+    kContainerHandleFieldNumber = 7,
   };
-  // string parent_uid = 1;
-  void clear_parent_uid();
-  const std::string& parent_uid() const;
-  void set_parent_uid(const std::string& value);
-  void set_parent_uid(std::string&& value);
-  void set_parent_uid(const char* value);
-  void set_parent_uid(const char* value, size_t size);
-  std::string* mutable_parent_uid();
-  std::string* release_parent_uid();
-  void set_allocated_parent_uid(std::string* parent_uid);
+  // string uid = 1;
+  void clear_uid();
+  const std::string& uid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uid();
+  PROTOBUF_NODISCARD std::string* release_uid();
+  void set_allocated_uid(std::string* uid);
   private:
-  const std::string& _internal_parent_uid() const;
-  void _internal_set_parent_uid(const std::string& value);
-  std::string* _internal_mutable_parent_uid();
+  const std::string& _internal_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uid(const std::string& value);
+  std::string* _internal_mutable_uid();
   public:
 
-  // string child_uid = 2;
-  void clear_child_uid();
-  const std::string& child_uid() const;
-  void set_child_uid(const std::string& value);
-  void set_child_uid(std::string&& value);
-  void set_child_uid(const char* value);
-  void set_child_uid(const char* value, size_t size);
-  std::string* mutable_child_uid();
-  std::string* release_child_uid();
-  void set_allocated_child_uid(std::string* child_uid);
+  // string id = 2;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
   private:
-  const std::string& _internal_child_uid() const;
-  void _internal_set_child_uid(const std::string& value);
-  std::string* _internal_mutable_child_uid();
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:protocol.AppendChild)
+  // string name = 3;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string container_uid = 5;
+  void clear_container_uid();
+  const std::string& container_uid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_container_uid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_container_uid();
+  PROTOBUF_NODISCARD std::string* release_container_uid();
+  void set_allocated_container_uid(std::string* container_uid);
+  private:
+  const std::string& _internal_container_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_container_uid(const std::string& value);
+  std::string* _internal_mutable_container_uid();
+  public:
+
+  // .protocol.ObjectValue settings = 4;
+  bool has_settings() const;
+  private:
+  bool _internal_has_settings() const;
+  public:
+  void clear_settings();
+  const ::protocol::ObjectValue& settings() const;
+  PROTOBUF_NODISCARD ::protocol::ObjectValue* release_settings();
+  ::protocol::ObjectValue* mutable_settings();
+  void set_allocated_settings(::protocol::ObjectValue* settings);
+  private:
+  const ::protocol::ObjectValue& _internal_settings() const;
+  ::protocol::ObjectValue* _internal_mutable_settings();
+  public:
+  void unsafe_arena_set_allocated_settings(
+      ::protocol::ObjectValue* settings);
+  ::protocol::ObjectValue* unsafe_arena_release_settings();
+
+  // .protocol.Style style = 8;
+  bool has_style() const;
+  private:
+  bool _internal_has_style() const;
+  public:
+  void clear_style();
+  const ::protocol::Style& style() const;
+  PROTOBUF_NODISCARD ::protocol::Style* release_style();
+  ::protocol::Style* mutable_style();
+  void set_allocated_style(::protocol::Style* style);
+  private:
+  const ::protocol::Style& _internal_style() const;
+  ::protocol::Style* _internal_mutable_style();
+  public:
+  void unsafe_arena_set_allocated_style(
+      ::protocol::Style* style);
+  ::protocol::Style* unsafe_arena_release_style();
+
+  // uint32 handle = 6;
+  void clear_handle();
+  uint32_t handle() const;
+  void set_handle(uint32_t value);
+  private:
+  uint32_t _internal_handle() const;
+  void _internal_set_handle(uint32_t value);
+  public:
+
+  // uint32 container_handle = 7;
+  void clear_container_handle();
+  uint32_t container_handle() const;
+  void set_container_handle(uint32_t value);
+  private:
+  uint32_t _internal_container_handle() const;
+  void _internal_set_container_handle(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.CreateSource)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_uid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr child_uid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr container_uid_;
+    ::protocol::ObjectValue* settings_;
+    ::protocol::Style* style_;
+    uint32_t handle_;
+    uint32_t container_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RemoveChild PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.RemoveChild) */ {
+class UpdateSource final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.UpdateSource) */ {
  public:
-  inline RemoveChild() : RemoveChild(nullptr) {}
-  virtual ~RemoveChild();
+  inline UpdateSource() : UpdateSource(nullptr) {}
+  ~UpdateSource() override;
+  explicit PROTOBUF_CONSTEXPR UpdateSource(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  RemoveChild(const RemoveChild& from);
-  RemoveChild(RemoveChild&& from) noexcept
-    : RemoveChild() {
+  UpdateSource(const UpdateSource& from);
+  UpdateSource(UpdateSource&& from) noexcept
+    : UpdateSource() {
     *this = ::std::move(from);
   }
 
-  inline RemoveChild& operator=(const RemoveChild& from) {
+  inline UpdateSource& operator=(const UpdateSource& from) {
     CopyFrom(from);
     return *this;
   }
-  inline RemoveChild& operator=(RemoveChild&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline UpdateSource& operator=(UpdateSource&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2176,158 +3012,200 @@ class RemoveChild PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const RemoveChild& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const RemoveChild* internal_default_instance() {
-    return reinterpret_cast<const RemoveChild*>(
-               &_RemoveChild_default_instance_);
+  static const UpdateSource& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UpdateSource* internal_default_instance() {
+    return reinterpret_cast<const UpdateSource*>(
+               &_UpdateSource_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
-  friend void swap(RemoveChild& a, RemoveChild& b) {
+  friend void swap(UpdateSource& a, UpdateSource& b) {
     a.Swap(&b);
   }
-  inline void Swap(RemoveChild* other) {
+  inline void Swap(UpdateSource* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(RemoveChild* other) {
+  void UnsafeArenaSwap(UpdateSource* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline RemoveChild* New() const final {
-    return CreateMaybeMessage<RemoveChild>(nullptr);
+  UpdateSource* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateSource>(arena);
   }
-
-  RemoveChild* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<RemoveChild>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpdateSource& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateSource& from) {
+    UpdateSource::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const RemoveChild& from);
-  void MergeFrom(const RemoveChild& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(RemoveChild* other);
+  void InternalSwap(UpdateSource* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "protocol.RemoveChild";
+    return "protocol.UpdateSource";
   }
   protected:
-  explicit RemoveChild(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit UpdateSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kParentUidFieldNumber = 1,
-    kChildUidFieldNumber = 2,
+    kUidFieldNumber = 2,
+    kChangedPropsFieldNumber = 3,
+    kStyleFieldNumber = 5,
+    kHandleFieldNumber = 4,
   };
-  // string parent_uid = 1;
-  void clear_parent_uid();
-  const std::string& parent_uid() const;
-  void set_parent_uid(const std::string& value);
-  void set_parent_uid(std::string&& value);
-  void set_parent_uid(const char* value);
-  void set_parent_uid(const char* value, size_t size);
-  std::string* mutable_parent_uid();
-  std::string* release_parent_uid();
-  void set_allocated_parent_uid(std::string* parent_uid);
+  // string uid = 2;
+  void clear_uid();
+  const std::string& uid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uid();
+  PROTOBUF_NODISCARD std::string* release_uid();
+  void set_allocated_uid(std::string* uid);
   private:
-  const std::string& _internal_parent_uid() const;
-  void _internal_set_parent_uid(const std::string& value);
-  std::string* _internal_mutable_parent_uid();
+  const std::string& _internal_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uid(const std::string& value);
+  std::string* _internal_mutable_uid();
   public:
 
-  // string child_uid = 2;
-  void clear_child_uid();
-  const std::string& child_uid() const;
-  void set_child_uid(const std::string& value);
-  void set_child_uid(std::string&& value);
-  void set_child_uid(const char* value);
-  void set_child_uid(const char* value, size_t size);
-  std::string* mutable_child_uid();
-  std::string* release_child_uid();
-  void set_allocated_child_uid(std::string* child_uid);
+  // .protocol.ObjectValue changed_props = 3;
+  bool has_changed_props() const;
   private:
-  const std::string& _internal_child_uid() const;
-  void _internal_set_child_uid(const std::string& value);
-  std::string* _internal_mutable_child_uid();
+  bool _internal_has_changed_props() const;
+  public:
+  void clear_changed_props();
+  const ::protocol::ObjectValue& changed_props() const;
+  PROTOBUF_NODISCARD ::protocol::ObjectValue* release_changed_props();
+  ::protocol::ObjectValue* mutable_changed_props();
+  void set_allocated_changed_props(::protocol::ObjectValue* changed_props);
+  private:
+  const ::protocol::ObjectValue& _internal_changed_props() const;
+  ::protocol::ObjectValue* _internal_mutable_changed_props();
   public:
+  void unsafe_arena_set_allocated_changed_props(
+      ::protocol::ObjectValue* changed_props);
+  ::protocol::ObjectValue* unsafe_arena_release_changed_props();
 
-  // @@protoc_insertion_point(class_scope:protocol.RemoveChild)
+  // .protocol.Style style = 5;
+  bool has_style() const;
+  private:
+  bool _internal_has_style() const;
+  public:
+  void clear_style();
+  const ::protocol::Style& style() const;
+  PROTOBUF_NODISCARD ::protocol::Style* release_style();
+  ::protocol::Style* mutable_style();
+  void set_allocated_style(::protocol::Style* style);
+  private:
+  const ::protocol::Style& _internal_style() const;
+  ::protocol::Style* _internal_mutable_style();
+  public:
+  void unsafe_arena_set_allocated_style(
+      ::protocol::Style* style);
+  ::protocol::Style* unsafe_arena_release_style();
+
+  // uint32 handle = 4;
+  void clear_handle();
+  uint32_t handle() const;
+  void set_handle(uint32_t value);
+  private:
+  uint32_t _internal_handle() const;
+  void _internal_set_handle(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.UpdateSource)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_uid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr child_uid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uid_;
+    ::protocol::ObjectValue* changed_props_;
+    ::protocol::Style* style_;
+    uint32_t handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CommitUpdates PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.CommitUpdates) */ {
+class CreateScene final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.CreateScene) */ {
  public:
-  inline CommitUpdates() : CommitUpdates(nullptr) {}
-  virtual ~CommitUpdates();
+  inline CreateScene() : CreateScene(nullptr) {}
+  ~CreateScene() override;
+  explicit PROTOBUF_CONSTEXPR CreateScene(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  CommitUpdates(const CommitUpdates& from);
-  CommitUpdates(CommitUpdates&& from) noexcept
-    : CommitUpdates() {
+  CreateScene(const CreateScene& from);
+  CreateScene(CreateScene&& from) noexcept
+    : CreateScene() {
     *this = ::std::move(from);
   }
 
-  inline CommitUpdates& operator=(const CommitUpdates& from) {
+  inline CreateScene& operator=(const CreateScene& from) {
     CopyFrom(from);
     return *this;
   }
-  inline CommitUpdates& operator=(CommitUpdates&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline CreateScene& operator=(CreateScene&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2338,140 +3216,243 @@ class CommitUpdates PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const CommitUpdates& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const CommitUpdates* internal_default_instance() {
-    return reinterpret_cast<const CommitUpdates*>(
-               &_CommitUpdates_default_instance_);
+  static const CreateScene& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateScene* internal_default_instance() {
+    return reinterpret_cast<const CreateScene*>(
+               &_CreateScene_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
-  friend void swap(CommitUpdates& a, CommitUpdates& b) {
+  friend void swap(CreateScene& a, CreateScene& b) {
     a.Swap(&b);
   }
-  inline void Swap(CommitUpdates* other) {
+  inline void Swap(CreateScene* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(CommitUpdates* other) {
+  void UnsafeArenaSwap(CreateScene* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline CommitUpdates* New() const final {
-    return CreateMaybeMessage<CommitUpdates>(nullptr);
+  CreateScene* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateScene>(arena);
   }
-
-  CommitUpdates* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<CommitUpdates>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateScene& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateScene& from) {
+    CreateScene::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const CommitUpdates& from);
-  void MergeFrom(const CommitUpdates& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(CommitUpdates* other);
+  void InternalSwap(CreateScene* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "protocol.CommitUpdates";
+    return "protocol.CreateScene";
   }
   protected:
-  explicit CommitUpdates(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit CreateScene(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kContainerUidFieldNumber = 1,
+    kUidFieldNumber = 1,
+    kNameFieldNumber = 2,
+    kContainerUidFieldNumber = 4,
+    kPropsFieldNumber = 3,
+    kStyleFieldNumber = 7,
+    kHandleFieldNumber = 5,
+    kContainerHandleFieldNumber = 6,
   };
-  // string container_uid = 1;
+  // string uid = 1;
+  void clear_uid();
+  const std::string& uid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uid();
+  PROTOBUF_NODISCARD std::string* release_uid();
+  void set_allocated_uid(std::string* uid);
+  private:
+  const std::string& _internal_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uid(const std::string& value);
+  std::string* _internal_mutable_uid();
+  public:
+
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string container_uid = 4;
   void clear_container_uid();
   const std::string& container_uid() const;
-  void set_container_uid(const std::string& value);
-  void set_container_uid(std::string&& value);
-  void set_container_uid(const char* value);
-  void set_container_uid(const char* value, size_t size);
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_container_uid(ArgT0&& arg0, ArgT... args);
   std::string* mutable_container_uid();
-  std::string* release_container_uid();
+  PROTOBUF_NODISCARD std::string* release_container_uid();
   void set_allocated_container_uid(std::string* container_uid);
   private:
   const std::string& _internal_container_uid() const;
-  void _internal_set_container_uid(const std::string& value);
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_container_uid(const std::string& value);
   std::string* _internal_mutable_container_uid();
   public:
 
-  // @@protoc_insertion_point(class_scope:protocol.CommitUpdates)
+  // .protocol.ObjectValue props = 3;
+  bool has_props() const;
+  private:
+  bool _internal_has_props() const;
+  public:
+  void clear_props();
+  const ::protocol::ObjectValue& props() const;
+  PROTOBUF_NODISCARD ::protocol::ObjectValue* release_props();
+  ::protocol::ObjectValue* mutable_props();
+  void set_allocated_props(::protocol::ObjectValue* props);
+  private:
+  const ::protocol::ObjectValue& _internal_props() const;
+  ::protocol::ObjectValue* _internal_mutable_props();
+  public:
+  void unsafe_arena_set_allocated_props(
+      ::protocol::ObjectValue* props);
+  ::protocol::ObjectValue* unsafe_arena_release_props();
+
+  // .protocol.Style style = 7;
+  bool has_style() const;
+  private:
+  bool _internal_has_style() const;
+  public:
+  void clear_style();
+  const ::protocol::Style& style() const;
+  PROTOBUF_NODISCARD ::protocol::Style* release_style();
+  ::protocol::Style* mutable_style();
+  void set_allocated_style(::protocol::Style* style);
+  private:
+  const ::protocol::Style& _internal_style() const;
+  ::protocol::Style* _internal_mutable_style();
+  public:
+  void unsafe_arena_set_allocated_style(
+      ::protocol::Style* style);
+  ::protocol::Style* unsafe_arena_release_style();
+
+  // uint32 handle = 5;
+  void clear_handle();
+  uint32_t handle() const;
+  void set_handle(uint32_t value);
+  private:
+  uint32_t _internal_handle() const;
+  void _internal_set_handle(uint32_t value);
+  public:
+
+  // uint32 container_handle = 6;
+  void clear_container_handle();
+  uint32_t container_handle() const;
+  void set_container_handle(uint32_t value);
+  private:
+  uint32_t _internal_container_handle() const;
+  void _internal_set_container_handle(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.CreateScene)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr container_uid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr container_uid_;
+    ::protocol::ObjectValue* props_;
+    ::protocol::Style* style_;
+    uint32_t handle_;
+    uint32_t container_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Prop PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.Prop) */ {
+class AppendChild final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.AppendChild) */ {
  public:
-  inline Prop() : Prop(nullptr) {}
-  virtual ~Prop();
+  inline AppendChild() : AppendChild(nullptr) {}
+  ~AppendChild() override;
+  explicit PROTOBUF_CONSTEXPR AppendChild(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Prop(const Prop& from);
-  Prop(Prop&& from) noexcept
-    : Prop() {
+  AppendChild(const AppendChild& from);
+  AppendChild(AppendChild&& from) noexcept
+    : AppendChild() {
     *this = ::std::move(from);
   }
 
-  inline Prop& operator=(const Prop& from) {
+  inline AppendChild& operator=(const AppendChild& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Prop& operator=(Prop&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline AppendChild& operator=(AppendChild&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2482,263 +3463,187 @@ class Prop PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const Prop& default_instance();
-
-  enum ValueCase {
-    kStringValue = 2,
-    kIntValue = 3,
-    kFloatValue = 4,
-    kBoolValue = 5,
-    kObjectValue = 6,
-    kUndefined = 7,
-    VALUE_NOT_SET = 0,
-  };
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Prop* internal_default_instance() {
-    return reinterpret_cast<const Prop*>(
-               &_Prop_default_instance_);
+  static const AppendChild& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AppendChild* internal_default_instance() {
+    return reinterpret_cast<const AppendChild*>(
+               &_AppendChild_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    14;
 
-  friend void swap(Prop& a, Prop& b) {
+  friend void swap(AppendChild& a, AppendChild& b) {
     a.Swap(&b);
   }
-  inline void Swap(Prop* other) {
+  inline void Swap(AppendChild* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Prop* other) {
+  void UnsafeArenaSwap(AppendChild* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline Prop* New() const final {
-    return CreateMaybeMessage<Prop>(nullptr);
+  AppendChild* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AppendChild>(arena);
   }
-
-  Prop* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Prop>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AppendChild& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AppendChild& from) {
+    AppendChild::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Prop& from);
-  void MergeFrom(const Prop& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Prop* other);
+  void InternalSwap(AppendChild* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "protocol.Prop";
+    return "protocol.AppendChild";
   }
   protected:
-  explicit Prop(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AppendChild(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kKeyFieldNumber = 1,
-    kStringValueFieldNumber = 2,
-    kIntValueFieldNumber = 3,
-    kFloatValueFieldNumber = 4,
-    kBoolValueFieldNumber = 5,
-    kObjectValueFieldNumber = 6,
-    kUndefinedFieldNumber = 7,
+    kParentUidFieldNumber = 1,
+    kChildUidFieldNumber = 2,
+    kParentHandleFieldNumber = 3,
+    kChildHandleFieldNumber = 4,
   };
-  // string key = 1;
-  void clear_key();
-  const std::string& key() const;
-  void set_key(const std::string& value);
-  void set_key(std::string&& value);
-  void set_key(const char* value);
-  void set_key(const char* value, size_t size);
-  std::string* mutable_key();
-  std::string* release_key();
-  void set_allocated_key(std::string* key);
-  private:
-  const std::string& _internal_key() const;
-  void _internal_set_key(const std::string& value);
-  std::string* _internal_mutable_key();
-  public:
-
-  // string string_value = 2;
-  private:
-  bool _internal_has_string_value() const;
-  public:
-  void clear_string_value();
-  const std::string& string_value() const;
-  void set_string_value(const std::string& value);
-  void set_string_value(std::string&& value);
-  void set_string_value(const char* value);
-  void set_string_value(const char* value, size_t size);
-  std::string* mutable_string_value();
-  std::string* release_string_value();
-  void set_allocated_string_value(std::string* string_value);
-  private:
-  const std::string& _internal_string_value() const;
-  void _internal_set_string_value(const std::string& value);
-  std::string* _internal_mutable_string_value();
-  public:
-
-  // int64 int_value = 3;
-  private:
-  bool _internal_has_int_value() const;
-  public:
-  void clear_int_value();
-  ::PROTOBUF_NAMESPACE_ID::int64 int_value() const;
-  void set_int_value(::PROTOBUF_NAMESPACE_ID::int64 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int64 _internal_int_value() const;
-  void _internal_set_int_value(::PROTOBUF_NAMESPACE_ID::int64 value);
-  public:
-
-  // double float_value = 4;
-  private:
-  bool _internal_has_float_value() const;
-  public:
-  void clear_float_value();
-  double float_value() const;
-  void set_float_value(double value);
+  // string parent_uid = 1;
+  void clear_parent_uid();
+  const std::string& parent_uid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_parent_uid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_parent_uid();
+  PROTOBUF_NODISCARD std::string* release_parent_uid();
+  void set_allocated_parent_uid(std::string* parent_uid);
   private:
-  double _internal_float_value() const;
-  void _internal_set_float_value(double value);
+  const std::string& _internal_parent_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_parent_uid(const std::string& value);
+  std::string* _internal_mutable_parent_uid();
   public:
 
-  // bool bool_value = 5;
-  private:
-  bool _internal_has_bool_value() const;
-  public:
-  void clear_bool_value();
-  bool bool_value() const;
-  void set_bool_value(bool value);
+  // string child_uid = 2;
+  void clear_child_uid();
+  const std::string& child_uid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_child_uid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_child_uid();
+  PROTOBUF_NODISCARD std::string* release_child_uid();
+  void set_allocated_child_uid(std::string* child_uid);
   private:
-  bool _internal_bool_value() const;
-  void _internal_set_bool_value(bool value);
+  const std::string& _internal_child_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_child_uid(const std::string& value);
+  std::string* _internal_mutable_child_uid();
   public:
 
-  // .protocol.ObjectValue object_value = 6;
-  bool has_object_value() const;
-  private:
-  bool _internal_has_object_value() const;
-  public:
-  void clear_object_value();
-  const ::protocol::ObjectValue& object_value() const;
-  ::protocol::ObjectValue* release_object_value();
-  ::protocol::ObjectValue* mutable_object_value();
-  void set_allocated_object_value(::protocol::ObjectValue* object_value);
+  // uint32 parent_handle = 3;
+  void clear_parent_handle();
+  uint32_t parent_handle() const;
+  void set_parent_handle(uint32_t value);
   private:
-  const ::protocol::ObjectValue& _internal_object_value() const;
-  ::protocol::ObjectValue* _internal_mutable_object_value();
+  uint32_t _internal_parent_handle() const;
+  void _internal_set_parent_handle(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_object_value(
-      ::protocol::ObjectValue* object_value);
-  ::protocol::ObjectValue* unsafe_arena_release_object_value();
 
-  // bool undefined = 7;
-  private:
-  bool _internal_has_undefined() const;
-  public:
-  void clear_undefined();
-  bool undefined() const;
-  void set_undefined(bool value);
+  // uint32 child_handle = 4;
+  void clear_child_handle();
+  uint32_t child_handle() const;
+  void set_child_handle(uint32_t value);
   private:
-  bool _internal_undefined() const;
-  void _internal_set_undefined(bool value);
+  uint32_t _internal_child_handle() const;
+  void _internal_set_child_handle(uint32_t value);
   public:
 
-  void clear_value();
-  ValueCase value_case() const;
-  // @@protoc_insertion_point(class_scope:protocol.Prop)
+  // @@protoc_insertion_point(class_scope:protocol.AppendChild)
  private:
   class _Internal;
-  void set_has_string_value();
-  void set_has_int_value();
-  void set_has_float_value();
-  void set_has_bool_value();
-  void set_has_object_value();
-  void set_has_undefined();
-
-  inline bool has_value() const;
-  inline void clear_has_value();
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-  union ValueUnion {
-    ValueUnion() {}
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_value_;
-    ::PROTOBUF_NAMESPACE_ID::int64 int_value_;
-    double float_value_;
-    bool bool_value_;
-    ::protocol::ObjectValue* object_value_;
-    bool undefined_;
-  } value_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 _oneof_case_[1];
-
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_uid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr child_uid_;
+    uint32_t parent_handle_;
+    uint32_t child_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ObjectValue PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.ObjectValue) */ {
+class RemoveChild final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.RemoveChild) */ {
  public:
-  inline ObjectValue() : ObjectValue(nullptr) {}
-  virtual ~ObjectValue();
+  inline RemoveChild() : RemoveChild(nullptr) {}
+  ~RemoveChild() override;
+  explicit PROTOBUF_CONSTEXPR RemoveChild(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ObjectValue(const ObjectValue& from);
-  ObjectValue(ObjectValue&& from) noexcept
-    : ObjectValue() {
+  RemoveChild(const RemoveChild& from);
+  RemoveChild(RemoveChild&& from) noexcept
+    : RemoveChild() {
     *this = ::std::move(from);
   }
 
-  inline ObjectValue& operator=(const ObjectValue& from) {
+  inline RemoveChild& operator=(const RemoveChild& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ObjectValue& operator=(ObjectValue&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+  inline RemoveChild& operator=(RemoveChild&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
@@ -2749,2444 +3654,9361 @@ class ObjectValue PROTOBUF_FINAL :
     return GetDescriptor();
   }
   static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
+    return default_instance().GetMetadata().descriptor;
   }
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
+    return default_instance().GetMetadata().reflection;
   }
-  static const ObjectValue& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const ObjectValue* internal_default_instance() {
-    return reinterpret_cast<const ObjectValue*>(
-               &_ObjectValue_default_instance_);
+  static const RemoveChild& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RemoveChild* internal_default_instance() {
+    return reinterpret_cast<const RemoveChild*>(
+               &_RemoveChild_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    15;
 
-  friend void swap(ObjectValue& a, ObjectValue& b) {
+  friend void swap(RemoveChild& a, RemoveChild& b) {
     a.Swap(&b);
   }
-  inline void Swap(ObjectValue* other) {
+  inline void Swap(RemoveChild* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ObjectValue* other) {
+  void UnsafeArenaSwap(RemoveChild* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ObjectValue* New() const final {
-    return CreateMaybeMessage<ObjectValue>(nullptr);
+  RemoveChild* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RemoveChild>(arena);
   }
-
-  ObjectValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ObjectValue>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RemoveChild& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RemoveChild& from) {
+    RemoveChild::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const ObjectValue& from);
-  void MergeFrom(const ObjectValue& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ObjectValue* other);
+  void InternalSwap(RemoveChild* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "protocol.ObjectValue";
+    return "protocol.RemoveChild";
   }
   protected:
-  explicit ObjectValue(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit RemoveChild(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_protocol_2eproto);
-    return ::descriptor_table_protocol_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
 
-  public:
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPropsFieldNumber = 1,
+    kParentUidFieldNumber = 1,
+    kChildUidFieldNumber = 2,
+    kParentHandleFieldNumber = 3,
+    kChildHandleFieldNumber = 4,
   };
-  // repeated .protocol.Prop props = 1;
-  int props_size() const;
+  // string parent_uid = 1;
+  void clear_parent_uid();
+  const std::string& parent_uid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_parent_uid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_parent_uid();
+  PROTOBUF_NODISCARD std::string* release_parent_uid();
+  void set_allocated_parent_uid(std::string* parent_uid);
   private:
-  int _internal_props_size() const;
+  const std::string& _internal_parent_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_parent_uid(const std::string& value);
+  std::string* _internal_mutable_parent_uid();
   public:
-  void clear_props();
-  ::protocol::Prop* mutable_props(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::Prop >*
-      mutable_props();
+
+  // string child_uid = 2;
+  void clear_child_uid();
+  const std::string& child_uid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_child_uid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_child_uid();
+  PROTOBUF_NODISCARD std::string* release_child_uid();
+  void set_allocated_child_uid(std::string* child_uid);
   private:
-  const ::protocol::Prop& _internal_props(int index) const;
-  ::protocol::Prop* _internal_add_props();
+  const std::string& _internal_child_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_child_uid(const std::string& value);
+  std::string* _internal_mutable_child_uid();
   public:
-  const ::protocol::Prop& props(int index) const;
-  ::protocol::Prop* add_props();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::Prop >&
-      props() const;
 
-  // @@protoc_insertion_point(class_scope:protocol.ObjectValue)
+  // uint32 parent_handle = 3;
+  void clear_parent_handle();
+  uint32_t parent_handle() const;
+  void set_parent_handle(uint32_t value);
+  private:
+  uint32_t _internal_parent_handle() const;
+  void _internal_set_parent_handle(uint32_t value);
+  public:
+
+  // uint32 child_handle = 4;
+  void clear_child_handle();
+  uint32_t child_handle() const;
+  void set_child_handle(uint32_t value);
+  private:
+  uint32_t _internal_child_handle() const;
+  void _internal_set_child_handle(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.RemoveChild)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::Prop > props_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_uid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr child_uid_;
+    uint32_t parent_handle_;
+    uint32_t child_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_protocol_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class CreateTree final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.CreateTree) */ {
+ public:
+  inline CreateTree() : CreateTree(nullptr) {}
+  ~CreateTree() override;
+  explicit PROTOBUF_CONSTEXPR CreateTree(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// ClientMessage
+  CreateTree(const CreateTree& from);
+  CreateTree(CreateTree&& from) noexcept
+    : CreateTree() {
+    *this = ::std::move(from);
+  }
 
-// .protocol.InitRequest init_request = 1;
-inline bool ClientMessage::_internal_has_init_request() const {
-  return message_case() == kInitRequest;
-}
-inline bool ClientMessage::has_init_request() const {
-  return _internal_has_init_request();
-}
-inline void ClientMessage::set_has_init_request() {
-  _oneof_case_[0] = kInitRequest;
-}
-inline void ClientMessage::clear_init_request() {
-  if (_internal_has_init_request()) {
-    if (GetArena() == nullptr) {
-      delete message_.init_request_;
-    }
-    clear_has_message();
+  inline CreateTree& operator=(const CreateTree& from) {
+    CopyFrom(from);
+    return *this;
   }
-}
-inline ::protocol::InitRequest* ClientMessage::release_init_request() {
-  // @@protoc_insertion_point(field_release:protocol.ClientMessage.init_request)
-  if (_internal_has_init_request()) {
-    clear_has_message();
-      ::protocol::InitRequest* temp = message_.init_request_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  inline CreateTree& operator=(CreateTree&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
     }
-    message_.init_request_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
+    return *this;
   }
-}
-inline const ::protocol::InitRequest& ClientMessage::_internal_init_request() const {
-  return _internal_has_init_request()
-      ? *message_.init_request_
-      : *reinterpret_cast< ::protocol::InitRequest*>(&::protocol::_InitRequest_default_instance_);
-}
-inline const ::protocol::InitRequest& ClientMessage::init_request() const {
-  // @@protoc_insertion_point(field_get:protocol.ClientMessage.init_request)
-  return _internal_init_request();
-}
-inline ::protocol::InitRequest* ClientMessage::unsafe_arena_release_init_request() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ClientMessage.init_request)
-  if (_internal_has_init_request()) {
-    clear_has_message();
-    ::protocol::InitRequest* temp = message_.init_request_;
-    message_.init_request_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-}
-inline void ClientMessage::unsafe_arena_set_allocated_init_request(::protocol::InitRequest* init_request) {
-  clear_message();
-  if (init_request) {
-    set_has_init_request();
-    message_.init_request_ = init_request;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ClientMessage.init_request)
-}
-inline ::protocol::InitRequest* ClientMessage::_internal_mutable_init_request() {
-  if (!_internal_has_init_request()) {
-    clear_message();
-    set_has_init_request();
-    message_.init_request_ = CreateMaybeMessage< ::protocol::InitRequest >(GetArena());
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  return message_.init_request_;
-}
-inline ::protocol::InitRequest* ClientMessage::mutable_init_request() {
-  // @@protoc_insertion_point(field_mutable:protocol.ClientMessage.init_request)
-  return _internal_mutable_init_request();
-}
+  static const CreateTree& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateTree* internal_default_instance() {
+    return reinterpret_cast<const CreateTree*>(
+               &_CreateTree_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
 
-// .protocol.ApplyUpdate apply_update = 2;
-inline bool ClientMessage::_internal_has_apply_update() const {
-  return message_case() == kApplyUpdate;
-}
-inline bool ClientMessage::has_apply_update() const {
-  return _internal_has_apply_update();
-}
-inline void ClientMessage::set_has_apply_update() {
-  _oneof_case_[0] = kApplyUpdate;
-}
-inline void ClientMessage::clear_apply_update() {
-  if (_internal_has_apply_update()) {
-    if (GetArena() == nullptr) {
-      delete message_.apply_update_;
-    }
-    clear_has_message();
+  friend void swap(CreateTree& a, CreateTree& b) {
+    a.Swap(&b);
   }
-}
-inline ::protocol::ApplyUpdate* ClientMessage::release_apply_update() {
-  // @@protoc_insertion_point(field_release:protocol.ClientMessage.apply_update)
-  if (_internal_has_apply_update()) {
-    clear_has_message();
-      ::protocol::ApplyUpdate* temp = message_.apply_update_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  inline void Swap(CreateTree* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
-    message_.apply_update_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
   }
-}
-inline const ::protocol::ApplyUpdate& ClientMessage::_internal_apply_update() const {
-  return _internal_has_apply_update()
-      ? *message_.apply_update_
-      : *reinterpret_cast< ::protocol::ApplyUpdate*>(&::protocol::_ApplyUpdate_default_instance_);
-}
-inline const ::protocol::ApplyUpdate& ClientMessage::apply_update() const {
-  // @@protoc_insertion_point(field_get:protocol.ClientMessage.apply_update)
-  return _internal_apply_update();
-}
-inline ::protocol::ApplyUpdate* ClientMessage::unsafe_arena_release_apply_update() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ClientMessage.apply_update)
-  if (_internal_has_apply_update()) {
-    clear_has_message();
-    ::protocol::ApplyUpdate* temp = message_.apply_update_;
-    message_.apply_update_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
+  void UnsafeArenaSwap(CreateTree* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-}
-inline void ClientMessage::unsafe_arena_set_allocated_apply_update(::protocol::ApplyUpdate* apply_update) {
-  clear_message();
-  if (apply_update) {
-    set_has_apply_update();
-    message_.apply_update_ = apply_update;
+
+  // implements Message ----------------------------------------------
+
+  CreateTree* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateTree>(arena);
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ClientMessage.apply_update)
-}
-inline ::protocol::ApplyUpdate* ClientMessage::_internal_mutable_apply_update() {
-  if (!_internal_has_apply_update()) {
-    clear_message();
-    set_has_apply_update();
-    message_.apply_update_ = CreateMaybeMessage< ::protocol::ApplyUpdate >(GetArena());
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateTree& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateTree& from) {
+    CreateTree::MergeImpl(*this, from);
   }
-  return message_.apply_update_;
-}
-inline ::protocol::ApplyUpdate* ClientMessage::mutable_apply_update() {
-  // @@protoc_insertion_point(field_mutable:protocol.ClientMessage.apply_update)
-  return _internal_mutable_apply_update();
-}
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// .protocol.FindSourceRequest find_source = 3;
-inline bool ClientMessage::_internal_has_find_source() const {
-  return message_case() == kFindSource;
-}
-inline bool ClientMessage::has_find_source() const {
-  return _internal_has_find_source();
-}
-inline void ClientMessage::set_has_find_source() {
-  _oneof_case_[0] = kFindSource;
-}
-inline void ClientMessage::clear_find_source() {
-  if (_internal_has_find_source()) {
-    if (GetArena() == nullptr) {
-      delete message_.find_source_;
-    }
-    clear_has_message();
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CreateTree* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.CreateTree";
   }
-}
-inline ::protocol::FindSourceRequest* ClientMessage::release_find_source() {
-  // @@protoc_insertion_point(field_release:protocol.ClientMessage.find_source)
-  if (_internal_has_find_source()) {
-    clear_has_message();
-      ::protocol::FindSourceRequest* temp = message_.find_source_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    message_.find_source_ = nullptr;
-    return temp;
-  } else {
+  protected:
+  explicit CreateTree(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRootsFieldNumber = 2,
+    kParentHandleFieldNumber = 1,
+  };
+  // repeated .protocol.TreeNode roots = 2;
+  int roots_size() const;
+  private:
+  int _internal_roots_size() const;
+  public:
+  void clear_roots();
+  ::protocol::TreeNode* mutable_roots(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode >*
+      mutable_roots();
+  private:
+  const ::protocol::TreeNode& _internal_roots(int index) const;
+  ::protocol::TreeNode* _internal_add_roots();
+  public:
+  const ::protocol::TreeNode& roots(int index) const;
+  ::protocol::TreeNode* add_roots();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode >&
+      roots() const;
+
+  // uint32 parent_handle = 1;
+  void clear_parent_handle();
+  uint32_t parent_handle() const;
+  void set_parent_handle(uint32_t value);
+  private:
+  uint32_t _internal_parent_handle() const;
+  void _internal_set_parent_handle(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.CreateTree)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode > roots_;
+    uint32_t parent_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TreeNode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.TreeNode) */ {
+ public:
+  inline TreeNode() : TreeNode(nullptr) {}
+  ~TreeNode() override;
+  explicit PROTOBUF_CONSTEXPR TreeNode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TreeNode(const TreeNode& from);
+  TreeNode(TreeNode&& from) noexcept
+    : TreeNode() {
+    *this = ::std::move(from);
+  }
+
+  inline TreeNode& operator=(const TreeNode& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TreeNode& operator=(TreeNode&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TreeNode& default_instance() {
+    return *internal_default_instance();
+  }
+  enum NodeCase {
+    kSource = 1,
+    kScene = 2,
+    NODE_NOT_SET = 0,
+  };
+
+  static inline const TreeNode* internal_default_instance() {
+    return reinterpret_cast<const TreeNode*>(
+               &_TreeNode_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(TreeNode& a, TreeNode& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TreeNode* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TreeNode* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TreeNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TreeNode>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TreeNode& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TreeNode& from) {
+    TreeNode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TreeNode* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.TreeNode";
+  }
+  protected:
+  explicit TreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChildrenFieldNumber = 3,
+    kSourceFieldNumber = 1,
+    kSceneFieldNumber = 2,
+  };
+  // repeated .protocol.TreeNode children = 3;
+  int children_size() const;
+  private:
+  int _internal_children_size() const;
+  public:
+  void clear_children();
+  ::protocol::TreeNode* mutable_children(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode >*
+      mutable_children();
+  private:
+  const ::protocol::TreeNode& _internal_children(int index) const;
+  ::protocol::TreeNode* _internal_add_children();
+  public:
+  const ::protocol::TreeNode& children(int index) const;
+  ::protocol::TreeNode* add_children();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode >&
+      children() const;
+
+  // .protocol.CreateSource source = 1;
+  bool has_source() const;
+  private:
+  bool _internal_has_source() const;
+  public:
+  void clear_source();
+  const ::protocol::CreateSource& source() const;
+  PROTOBUF_NODISCARD ::protocol::CreateSource* release_source();
+  ::protocol::CreateSource* mutable_source();
+  void set_allocated_source(::protocol::CreateSource* source);
+  private:
+  const ::protocol::CreateSource& _internal_source() const;
+  ::protocol::CreateSource* _internal_mutable_source();
+  public:
+  void unsafe_arena_set_allocated_source(
+      ::protocol::CreateSource* source);
+  ::protocol::CreateSource* unsafe_arena_release_source();
+
+  // .protocol.CreateScene scene = 2;
+  bool has_scene() const;
+  private:
+  bool _internal_has_scene() const;
+  public:
+  void clear_scene();
+  const ::protocol::CreateScene& scene() const;
+  PROTOBUF_NODISCARD ::protocol::CreateScene* release_scene();
+  ::protocol::CreateScene* mutable_scene();
+  void set_allocated_scene(::protocol::CreateScene* scene);
+  private:
+  const ::protocol::CreateScene& _internal_scene() const;
+  ::protocol::CreateScene* _internal_mutable_scene();
+  public:
+  void unsafe_arena_set_allocated_scene(
+      ::protocol::CreateScene* scene);
+  ::protocol::CreateScene* unsafe_arena_release_scene();
+
+  void clear_node();
+  NodeCase node_case() const;
+  // @@protoc_insertion_point(class_scope:protocol.TreeNode)
+ private:
+  class _Internal;
+  void set_has_source();
+  void set_has_scene();
+
+  inline bool has_node() const;
+  inline void clear_has_node();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode > children_;
+    union NodeUnion {
+      constexpr NodeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::protocol::CreateSource* source_;
+      ::protocol::CreateScene* scene_;
+    } node_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InsertBefore final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.InsertBefore) */ {
+ public:
+  inline InsertBefore() : InsertBefore(nullptr) {}
+  ~InsertBefore() override;
+  explicit PROTOBUF_CONSTEXPR InsertBefore(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InsertBefore(const InsertBefore& from);
+  InsertBefore(InsertBefore&& from) noexcept
+    : InsertBefore() {
+    *this = ::std::move(from);
+  }
+
+  inline InsertBefore& operator=(const InsertBefore& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InsertBefore& operator=(InsertBefore&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const InsertBefore& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InsertBefore* internal_default_instance() {
+    return reinterpret_cast<const InsertBefore*>(
+               &_InsertBefore_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(InsertBefore& a, InsertBefore& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InsertBefore* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InsertBefore* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InsertBefore* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InsertBefore>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const InsertBefore& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const InsertBefore& from) {
+    InsertBefore::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(InsertBefore* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.InsertBefore";
+  }
+  protected:
+  explicit InsertBefore(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParentHandleFieldNumber = 1,
+    kChildHandleFieldNumber = 2,
+    kBeforeHandleFieldNumber = 3,
+  };
+  // uint32 parent_handle = 1;
+  void clear_parent_handle();
+  uint32_t parent_handle() const;
+  void set_parent_handle(uint32_t value);
+  private:
+  uint32_t _internal_parent_handle() const;
+  void _internal_set_parent_handle(uint32_t value);
+  public:
+
+  // uint32 child_handle = 2;
+  void clear_child_handle();
+  uint32_t child_handle() const;
+  void set_child_handle(uint32_t value);
+  private:
+  uint32_t _internal_child_handle() const;
+  void _internal_set_child_handle(uint32_t value);
+  public:
+
+  // uint32 before_handle = 3;
+  void clear_before_handle();
+  uint32_t before_handle() const;
+  void set_before_handle(uint32_t value);
+  private:
+  uint32_t _internal_before_handle() const;
+  void _internal_set_before_handle(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.InsertBefore)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t parent_handle_;
+    uint32_t child_handle_;
+    uint32_t before_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MoveChild final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.MoveChild) */ {
+ public:
+  inline MoveChild() : MoveChild(nullptr) {}
+  ~MoveChild() override;
+  explicit PROTOBUF_CONSTEXPR MoveChild(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MoveChild(const MoveChild& from);
+  MoveChild(MoveChild&& from) noexcept
+    : MoveChild() {
+    *this = ::std::move(from);
+  }
+
+  inline MoveChild& operator=(const MoveChild& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MoveChild& operator=(MoveChild&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MoveChild& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MoveChild* internal_default_instance() {
+    return reinterpret_cast<const MoveChild*>(
+               &_MoveChild_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(MoveChild& a, MoveChild& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MoveChild* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MoveChild* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MoveChild* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MoveChild>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MoveChild& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MoveChild& from) {
+    MoveChild::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MoveChild* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.MoveChild";
+  }
+  protected:
+  explicit MoveChild(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParentHandleFieldNumber = 1,
+    kChildHandleFieldNumber = 2,
+    kBeforeHandleFieldNumber = 3,
+  };
+  // uint32 parent_handle = 1;
+  void clear_parent_handle();
+  uint32_t parent_handle() const;
+  void set_parent_handle(uint32_t value);
+  private:
+  uint32_t _internal_parent_handle() const;
+  void _internal_set_parent_handle(uint32_t value);
+  public:
+
+  // uint32 child_handle = 2;
+  void clear_child_handle();
+  uint32_t child_handle() const;
+  void set_child_handle(uint32_t value);
+  private:
+  uint32_t _internal_child_handle() const;
+  void _internal_set_child_handle(uint32_t value);
+  public:
+
+  // uint32 before_handle = 3;
+  void clear_before_handle();
+  uint32_t before_handle() const;
+  void set_before_handle(uint32_t value);
+  private:
+  uint32_t _internal_before_handle() const;
+  void _internal_set_before_handle(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.MoveChild)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t parent_handle_;
+    uint32_t child_handle_;
+    uint32_t before_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CommitUpdates final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.CommitUpdates) */ {
+ public:
+  inline CommitUpdates() : CommitUpdates(nullptr) {}
+  ~CommitUpdates() override;
+  explicit PROTOBUF_CONSTEXPR CommitUpdates(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CommitUpdates(const CommitUpdates& from);
+  CommitUpdates(CommitUpdates&& from) noexcept
+    : CommitUpdates() {
+    *this = ::std::move(from);
+  }
+
+  inline CommitUpdates& operator=(const CommitUpdates& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CommitUpdates& operator=(CommitUpdates&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CommitUpdates& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CommitUpdates* internal_default_instance() {
+    return reinterpret_cast<const CommitUpdates*>(
+               &_CommitUpdates_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(CommitUpdates& a, CommitUpdates& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CommitUpdates* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CommitUpdates* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CommitUpdates* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CommitUpdates>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CommitUpdates& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CommitUpdates& from) {
+    CommitUpdates::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CommitUpdates* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.CommitUpdates";
+  }
+  protected:
+  explicit CommitUpdates(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContainerUidFieldNumber = 1,
+    kContainerHandleFieldNumber = 2,
+  };
+  // string container_uid = 1;
+  void clear_container_uid();
+  const std::string& container_uid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_container_uid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_container_uid();
+  PROTOBUF_NODISCARD std::string* release_container_uid();
+  void set_allocated_container_uid(std::string* container_uid);
+  private:
+  const std::string& _internal_container_uid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_container_uid(const std::string& value);
+  std::string* _internal_mutable_container_uid();
+  public:
+
+  // uint32 container_handle = 2;
+  void clear_container_handle();
+  uint32_t container_handle() const;
+  void set_container_handle(uint32_t value);
+  private:
+  uint32_t _internal_container_handle() const;
+  void _internal_set_container_handle(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.CommitUpdates)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr container_uid_;
+    uint32_t container_handle_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DefineKey final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.DefineKey) */ {
+ public:
+  inline DefineKey() : DefineKey(nullptr) {}
+  ~DefineKey() override;
+  explicit PROTOBUF_CONSTEXPR DefineKey(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DefineKey(const DefineKey& from);
+  DefineKey(DefineKey&& from) noexcept
+    : DefineKey() {
+    *this = ::std::move(from);
+  }
+
+  inline DefineKey& operator=(const DefineKey& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DefineKey& operator=(DefineKey&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DefineKey& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DefineKey* internal_default_instance() {
+    return reinterpret_cast<const DefineKey*>(
+               &_DefineKey_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(DefineKey& a, DefineKey& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DefineKey* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DefineKey* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DefineKey* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DefineKey>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DefineKey& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DefineKey& from) {
+    DefineKey::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DefineKey* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.DefineKey";
+  }
+  protected:
+  explicit DefineKey(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // string key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.DefineKey)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DefineString final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.DefineString) */ {
+ public:
+  inline DefineString() : DefineString(nullptr) {}
+  ~DefineString() override;
+  explicit PROTOBUF_CONSTEXPR DefineString(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DefineString(const DefineString& from);
+  DefineString(DefineString&& from) noexcept
+    : DefineString() {
+    *this = ::std::move(from);
+  }
+
+  inline DefineString& operator=(const DefineString& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DefineString& operator=(DefineString&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DefineString& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DefineString* internal_default_instance() {
+    return reinterpret_cast<const DefineString*>(
+               &_DefineString_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(DefineString& a, DefineString& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DefineString* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DefineString* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DefineString* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DefineString>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DefineString& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DefineString& from) {
+    DefineString::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DefineString* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.DefineString";
+  }
+  protected:
+  explicit DefineString(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // string value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // uint32 id = 1;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.DefineString)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Style final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.Style) */ {
+ public:
+  inline Style() : Style(nullptr) {}
+  ~Style() override;
+  explicit PROTOBUF_CONSTEXPR Style(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Style(const Style& from);
+  Style(Style&& from) noexcept
+    : Style() {
+    *this = ::std::move(from);
+  }
+
+  inline Style& operator=(const Style& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Style& operator=(Style&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Style& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Style* internal_default_instance() {
+    return reinterpret_cast<const Style*>(
+               &_Style_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(Style& a, Style& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Style* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Style* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Style* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Style>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Style& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Style& from) {
+    Style::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Style* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.Style";
+  }
+  protected:
+  explicit Style(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFlexBasisFieldNumber = 14,
+    kTopFieldNumber = 15,
+    kLeftFieldNumber = 16,
+    kRightFieldNumber = 17,
+    kBottomFieldNumber = 18,
+    kMarginTopFieldNumber = 19,
+    kMarginLeftFieldNumber = 20,
+    kMarginRightFieldNumber = 21,
+    kMarginBottomFieldNumber = 22,
+    kPaddingTopFieldNumber = 23,
+    kPaddingLeftFieldNumber = 24,
+    kPaddingRightFieldNumber = 25,
+    kPaddingBottomFieldNumber = 26,
+    kWidthFieldNumber = 28,
+    kHeightFieldNumber = 29,
+    kMinWidthFieldNumber = 30,
+    kMaxWidthFieldNumber = 31,
+    kMinHeightFieldNumber = 32,
+    kMaxHeightFieldNumber = 33,
+    kPresentFieldNumber = 1,
+    kFlexDirectionFieldNumber = 2,
+    kDirectionFieldNumber = 3,
+    kJustifyContentFieldNumber = 4,
+    kAlignContentFieldNumber = 5,
+    kAlignItemsFieldNumber = 6,
+    kAlignSelfFieldNumber = 7,
+    kPositionFieldNumber = 8,
+    kFlexWrapFieldNumber = 9,
+    kOverflowFieldNumber = 10,
+    kDisplayFieldNumber = 11,
+    kFlexGrowFieldNumber = 12,
+    kFlexShrinkFieldNumber = 13,
+    kAspectRatioFieldNumber = 27,
+    kPatchFieldNumber = 34,
+    kUnsetFieldNumber = 35,
+    kZIndexFieldNumber = 36,
+  };
+  // .protocol.Dimension flex_basis = 14;
+  bool has_flex_basis() const;
+  private:
+  bool _internal_has_flex_basis() const;
+  public:
+  void clear_flex_basis();
+  const ::protocol::Dimension& flex_basis() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_flex_basis();
+  ::protocol::Dimension* mutable_flex_basis();
+  void set_allocated_flex_basis(::protocol::Dimension* flex_basis);
+  private:
+  const ::protocol::Dimension& _internal_flex_basis() const;
+  ::protocol::Dimension* _internal_mutable_flex_basis();
+  public:
+  void unsafe_arena_set_allocated_flex_basis(
+      ::protocol::Dimension* flex_basis);
+  ::protocol::Dimension* unsafe_arena_release_flex_basis();
+
+  // .protocol.Dimension top = 15;
+  bool has_top() const;
+  private:
+  bool _internal_has_top() const;
+  public:
+  void clear_top();
+  const ::protocol::Dimension& top() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_top();
+  ::protocol::Dimension* mutable_top();
+  void set_allocated_top(::protocol::Dimension* top);
+  private:
+  const ::protocol::Dimension& _internal_top() const;
+  ::protocol::Dimension* _internal_mutable_top();
+  public:
+  void unsafe_arena_set_allocated_top(
+      ::protocol::Dimension* top);
+  ::protocol::Dimension* unsafe_arena_release_top();
+
+  // .protocol.Dimension left = 16;
+  bool has_left() const;
+  private:
+  bool _internal_has_left() const;
+  public:
+  void clear_left();
+  const ::protocol::Dimension& left() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_left();
+  ::protocol::Dimension* mutable_left();
+  void set_allocated_left(::protocol::Dimension* left);
+  private:
+  const ::protocol::Dimension& _internal_left() const;
+  ::protocol::Dimension* _internal_mutable_left();
+  public:
+  void unsafe_arena_set_allocated_left(
+      ::protocol::Dimension* left);
+  ::protocol::Dimension* unsafe_arena_release_left();
+
+  // .protocol.Dimension right = 17;
+  bool has_right() const;
+  private:
+  bool _internal_has_right() const;
+  public:
+  void clear_right();
+  const ::protocol::Dimension& right() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_right();
+  ::protocol::Dimension* mutable_right();
+  void set_allocated_right(::protocol::Dimension* right);
+  private:
+  const ::protocol::Dimension& _internal_right() const;
+  ::protocol::Dimension* _internal_mutable_right();
+  public:
+  void unsafe_arena_set_allocated_right(
+      ::protocol::Dimension* right);
+  ::protocol::Dimension* unsafe_arena_release_right();
+
+  // .protocol.Dimension bottom = 18;
+  bool has_bottom() const;
+  private:
+  bool _internal_has_bottom() const;
+  public:
+  void clear_bottom();
+  const ::protocol::Dimension& bottom() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_bottom();
+  ::protocol::Dimension* mutable_bottom();
+  void set_allocated_bottom(::protocol::Dimension* bottom);
+  private:
+  const ::protocol::Dimension& _internal_bottom() const;
+  ::protocol::Dimension* _internal_mutable_bottom();
+  public:
+  void unsafe_arena_set_allocated_bottom(
+      ::protocol::Dimension* bottom);
+  ::protocol::Dimension* unsafe_arena_release_bottom();
+
+  // .protocol.Dimension margin_top = 19;
+  bool has_margin_top() const;
+  private:
+  bool _internal_has_margin_top() const;
+  public:
+  void clear_margin_top();
+  const ::protocol::Dimension& margin_top() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_margin_top();
+  ::protocol::Dimension* mutable_margin_top();
+  void set_allocated_margin_top(::protocol::Dimension* margin_top);
+  private:
+  const ::protocol::Dimension& _internal_margin_top() const;
+  ::protocol::Dimension* _internal_mutable_margin_top();
+  public:
+  void unsafe_arena_set_allocated_margin_top(
+      ::protocol::Dimension* margin_top);
+  ::protocol::Dimension* unsafe_arena_release_margin_top();
+
+  // .protocol.Dimension margin_left = 20;
+  bool has_margin_left() const;
+  private:
+  bool _internal_has_margin_left() const;
+  public:
+  void clear_margin_left();
+  const ::protocol::Dimension& margin_left() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_margin_left();
+  ::protocol::Dimension* mutable_margin_left();
+  void set_allocated_margin_left(::protocol::Dimension* margin_left);
+  private:
+  const ::protocol::Dimension& _internal_margin_left() const;
+  ::protocol::Dimension* _internal_mutable_margin_left();
+  public:
+  void unsafe_arena_set_allocated_margin_left(
+      ::protocol::Dimension* margin_left);
+  ::protocol::Dimension* unsafe_arena_release_margin_left();
+
+  // .protocol.Dimension margin_right = 21;
+  bool has_margin_right() const;
+  private:
+  bool _internal_has_margin_right() const;
+  public:
+  void clear_margin_right();
+  const ::protocol::Dimension& margin_right() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_margin_right();
+  ::protocol::Dimension* mutable_margin_right();
+  void set_allocated_margin_right(::protocol::Dimension* margin_right);
+  private:
+  const ::protocol::Dimension& _internal_margin_right() const;
+  ::protocol::Dimension* _internal_mutable_margin_right();
+  public:
+  void unsafe_arena_set_allocated_margin_right(
+      ::protocol::Dimension* margin_right);
+  ::protocol::Dimension* unsafe_arena_release_margin_right();
+
+  // .protocol.Dimension margin_bottom = 22;
+  bool has_margin_bottom() const;
+  private:
+  bool _internal_has_margin_bottom() const;
+  public:
+  void clear_margin_bottom();
+  const ::protocol::Dimension& margin_bottom() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_margin_bottom();
+  ::protocol::Dimension* mutable_margin_bottom();
+  void set_allocated_margin_bottom(::protocol::Dimension* margin_bottom);
+  private:
+  const ::protocol::Dimension& _internal_margin_bottom() const;
+  ::protocol::Dimension* _internal_mutable_margin_bottom();
+  public:
+  void unsafe_arena_set_allocated_margin_bottom(
+      ::protocol::Dimension* margin_bottom);
+  ::protocol::Dimension* unsafe_arena_release_margin_bottom();
+
+  // .protocol.Dimension padding_top = 23;
+  bool has_padding_top() const;
+  private:
+  bool _internal_has_padding_top() const;
+  public:
+  void clear_padding_top();
+  const ::protocol::Dimension& padding_top() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_padding_top();
+  ::protocol::Dimension* mutable_padding_top();
+  void set_allocated_padding_top(::protocol::Dimension* padding_top);
+  private:
+  const ::protocol::Dimension& _internal_padding_top() const;
+  ::protocol::Dimension* _internal_mutable_padding_top();
+  public:
+  void unsafe_arena_set_allocated_padding_top(
+      ::protocol::Dimension* padding_top);
+  ::protocol::Dimension* unsafe_arena_release_padding_top();
+
+  // .protocol.Dimension padding_left = 24;
+  bool has_padding_left() const;
+  private:
+  bool _internal_has_padding_left() const;
+  public:
+  void clear_padding_left();
+  const ::protocol::Dimension& padding_left() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_padding_left();
+  ::protocol::Dimension* mutable_padding_left();
+  void set_allocated_padding_left(::protocol::Dimension* padding_left);
+  private:
+  const ::protocol::Dimension& _internal_padding_left() const;
+  ::protocol::Dimension* _internal_mutable_padding_left();
+  public:
+  void unsafe_arena_set_allocated_padding_left(
+      ::protocol::Dimension* padding_left);
+  ::protocol::Dimension* unsafe_arena_release_padding_left();
+
+  // .protocol.Dimension padding_right = 25;
+  bool has_padding_right() const;
+  private:
+  bool _internal_has_padding_right() const;
+  public:
+  void clear_padding_right();
+  const ::protocol::Dimension& padding_right() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_padding_right();
+  ::protocol::Dimension* mutable_padding_right();
+  void set_allocated_padding_right(::protocol::Dimension* padding_right);
+  private:
+  const ::protocol::Dimension& _internal_padding_right() const;
+  ::protocol::Dimension* _internal_mutable_padding_right();
+  public:
+  void unsafe_arena_set_allocated_padding_right(
+      ::protocol::Dimension* padding_right);
+  ::protocol::Dimension* unsafe_arena_release_padding_right();
+
+  // .protocol.Dimension padding_bottom = 26;
+  bool has_padding_bottom() const;
+  private:
+  bool _internal_has_padding_bottom() const;
+  public:
+  void clear_padding_bottom();
+  const ::protocol::Dimension& padding_bottom() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_padding_bottom();
+  ::protocol::Dimension* mutable_padding_bottom();
+  void set_allocated_padding_bottom(::protocol::Dimension* padding_bottom);
+  private:
+  const ::protocol::Dimension& _internal_padding_bottom() const;
+  ::protocol::Dimension* _internal_mutable_padding_bottom();
+  public:
+  void unsafe_arena_set_allocated_padding_bottom(
+      ::protocol::Dimension* padding_bottom);
+  ::protocol::Dimension* unsafe_arena_release_padding_bottom();
+
+  // .protocol.Dimension width = 28;
+  bool has_width() const;
+  private:
+  bool _internal_has_width() const;
+  public:
+  void clear_width();
+  const ::protocol::Dimension& width() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_width();
+  ::protocol::Dimension* mutable_width();
+  void set_allocated_width(::protocol::Dimension* width);
+  private:
+  const ::protocol::Dimension& _internal_width() const;
+  ::protocol::Dimension* _internal_mutable_width();
+  public:
+  void unsafe_arena_set_allocated_width(
+      ::protocol::Dimension* width);
+  ::protocol::Dimension* unsafe_arena_release_width();
+
+  // .protocol.Dimension height = 29;
+  bool has_height() const;
+  private:
+  bool _internal_has_height() const;
+  public:
+  void clear_height();
+  const ::protocol::Dimension& height() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_height();
+  ::protocol::Dimension* mutable_height();
+  void set_allocated_height(::protocol::Dimension* height);
+  private:
+  const ::protocol::Dimension& _internal_height() const;
+  ::protocol::Dimension* _internal_mutable_height();
+  public:
+  void unsafe_arena_set_allocated_height(
+      ::protocol::Dimension* height);
+  ::protocol::Dimension* unsafe_arena_release_height();
+
+  // .protocol.Dimension min_width = 30;
+  bool has_min_width() const;
+  private:
+  bool _internal_has_min_width() const;
+  public:
+  void clear_min_width();
+  const ::protocol::Dimension& min_width() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_min_width();
+  ::protocol::Dimension* mutable_min_width();
+  void set_allocated_min_width(::protocol::Dimension* min_width);
+  private:
+  const ::protocol::Dimension& _internal_min_width() const;
+  ::protocol::Dimension* _internal_mutable_min_width();
+  public:
+  void unsafe_arena_set_allocated_min_width(
+      ::protocol::Dimension* min_width);
+  ::protocol::Dimension* unsafe_arena_release_min_width();
+
+  // .protocol.Dimension max_width = 31;
+  bool has_max_width() const;
+  private:
+  bool _internal_has_max_width() const;
+  public:
+  void clear_max_width();
+  const ::protocol::Dimension& max_width() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_max_width();
+  ::protocol::Dimension* mutable_max_width();
+  void set_allocated_max_width(::protocol::Dimension* max_width);
+  private:
+  const ::protocol::Dimension& _internal_max_width() const;
+  ::protocol::Dimension* _internal_mutable_max_width();
+  public:
+  void unsafe_arena_set_allocated_max_width(
+      ::protocol::Dimension* max_width);
+  ::protocol::Dimension* unsafe_arena_release_max_width();
+
+  // .protocol.Dimension min_height = 32;
+  bool has_min_height() const;
+  private:
+  bool _internal_has_min_height() const;
+  public:
+  void clear_min_height();
+  const ::protocol::Dimension& min_height() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_min_height();
+  ::protocol::Dimension* mutable_min_height();
+  void set_allocated_min_height(::protocol::Dimension* min_height);
+  private:
+  const ::protocol::Dimension& _internal_min_height() const;
+  ::protocol::Dimension* _internal_mutable_min_height();
+  public:
+  void unsafe_arena_set_allocated_min_height(
+      ::protocol::Dimension* min_height);
+  ::protocol::Dimension* unsafe_arena_release_min_height();
+
+  // .protocol.Dimension max_height = 33;
+  bool has_max_height() const;
+  private:
+  bool _internal_has_max_height() const;
+  public:
+  void clear_max_height();
+  const ::protocol::Dimension& max_height() const;
+  PROTOBUF_NODISCARD ::protocol::Dimension* release_max_height();
+  ::protocol::Dimension* mutable_max_height();
+  void set_allocated_max_height(::protocol::Dimension* max_height);
+  private:
+  const ::protocol::Dimension& _internal_max_height() const;
+  ::protocol::Dimension* _internal_mutable_max_height();
+  public:
+  void unsafe_arena_set_allocated_max_height(
+      ::protocol::Dimension* max_height);
+  ::protocol::Dimension* unsafe_arena_release_max_height();
+
+  // uint64 present = 1;
+  void clear_present();
+  uint64_t present() const;
+  void set_present(uint64_t value);
+  private:
+  uint64_t _internal_present() const;
+  void _internal_set_present(uint64_t value);
+  public:
+
+  // .protocol.FlexDirection flex_direction = 2;
+  void clear_flex_direction();
+  ::protocol::FlexDirection flex_direction() const;
+  void set_flex_direction(::protocol::FlexDirection value);
+  private:
+  ::protocol::FlexDirection _internal_flex_direction() const;
+  void _internal_set_flex_direction(::protocol::FlexDirection value);
+  public:
+
+  // .protocol.Direction direction = 3;
+  void clear_direction();
+  ::protocol::Direction direction() const;
+  void set_direction(::protocol::Direction value);
+  private:
+  ::protocol::Direction _internal_direction() const;
+  void _internal_set_direction(::protocol::Direction value);
+  public:
+
+  // .protocol.Justify justify_content = 4;
+  void clear_justify_content();
+  ::protocol::Justify justify_content() const;
+  void set_justify_content(::protocol::Justify value);
+  private:
+  ::protocol::Justify _internal_justify_content() const;
+  void _internal_set_justify_content(::protocol::Justify value);
+  public:
+
+  // .protocol.Align align_content = 5;
+  void clear_align_content();
+  ::protocol::Align align_content() const;
+  void set_align_content(::protocol::Align value);
+  private:
+  ::protocol::Align _internal_align_content() const;
+  void _internal_set_align_content(::protocol::Align value);
+  public:
+
+  // .protocol.Align align_items = 6;
+  void clear_align_items();
+  ::protocol::Align align_items() const;
+  void set_align_items(::protocol::Align value);
+  private:
+  ::protocol::Align _internal_align_items() const;
+  void _internal_set_align_items(::protocol::Align value);
+  public:
+
+  // .protocol.Align align_self = 7;
+  void clear_align_self();
+  ::protocol::Align align_self() const;
+  void set_align_self(::protocol::Align value);
+  private:
+  ::protocol::Align _internal_align_self() const;
+  void _internal_set_align_self(::protocol::Align value);
+  public:
+
+  // .protocol.PositionType position = 8;
+  void clear_position();
+  ::protocol::PositionType position() const;
+  void set_position(::protocol::PositionType value);
+  private:
+  ::protocol::PositionType _internal_position() const;
+  void _internal_set_position(::protocol::PositionType value);
+  public:
+
+  // .protocol.Wrap flex_wrap = 9;
+  void clear_flex_wrap();
+  ::protocol::Wrap flex_wrap() const;
+  void set_flex_wrap(::protocol::Wrap value);
+  private:
+  ::protocol::Wrap _internal_flex_wrap() const;
+  void _internal_set_flex_wrap(::protocol::Wrap value);
+  public:
+
+  // .protocol.Overflow overflow = 10;
+  void clear_overflow();
+  ::protocol::Overflow overflow() const;
+  void set_overflow(::protocol::Overflow value);
+  private:
+  ::protocol::Overflow _internal_overflow() const;
+  void _internal_set_overflow(::protocol::Overflow value);
+  public:
+
+  // .protocol.Display display = 11;
+  void clear_display();
+  ::protocol::Display display() const;
+  void set_display(::protocol::Display value);
+  private:
+  ::protocol::Display _internal_display() const;
+  void _internal_set_display(::protocol::Display value);
+  public:
+
+  // float flex_grow = 12;
+  void clear_flex_grow();
+  float flex_grow() const;
+  void set_flex_grow(float value);
+  private:
+  float _internal_flex_grow() const;
+  void _internal_set_flex_grow(float value);
+  public:
+
+  // float flex_shrink = 13;
+  void clear_flex_shrink();
+  float flex_shrink() const;
+  void set_flex_shrink(float value);
+  private:
+  float _internal_flex_shrink() const;
+  void _internal_set_flex_shrink(float value);
+  public:
+
+  // float aspect_ratio = 27;
+  void clear_aspect_ratio();
+  float aspect_ratio() const;
+  void set_aspect_ratio(float value);
+  private:
+  float _internal_aspect_ratio() const;
+  void _internal_set_aspect_ratio(float value);
+  public:
+
+  // bool patch = 34;
+  void clear_patch();
+  bool patch() const;
+  void set_patch(bool value);
+  private:
+  bool _internal_patch() const;
+  void _internal_set_patch(bool value);
+  public:
+
+  // uint64 unset = 35;
+  void clear_unset();
+  uint64_t unset() const;
+  void set_unset(uint64_t value);
+  private:
+  uint64_t _internal_unset() const;
+  void _internal_set_unset(uint64_t value);
+  public:
+
+  // int32 z_index = 36;
+  void clear_z_index();
+  int32_t z_index() const;
+  void set_z_index(int32_t value);
+  private:
+  int32_t _internal_z_index() const;
+  void _internal_set_z_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.Style)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::protocol::Dimension* flex_basis_;
+    ::protocol::Dimension* top_;
+    ::protocol::Dimension* left_;
+    ::protocol::Dimension* right_;
+    ::protocol::Dimension* bottom_;
+    ::protocol::Dimension* margin_top_;
+    ::protocol::Dimension* margin_left_;
+    ::protocol::Dimension* margin_right_;
+    ::protocol::Dimension* margin_bottom_;
+    ::protocol::Dimension* padding_top_;
+    ::protocol::Dimension* padding_left_;
+    ::protocol::Dimension* padding_right_;
+    ::protocol::Dimension* padding_bottom_;
+    ::protocol::Dimension* width_;
+    ::protocol::Dimension* height_;
+    ::protocol::Dimension* min_width_;
+    ::protocol::Dimension* max_width_;
+    ::protocol::Dimension* min_height_;
+    ::protocol::Dimension* max_height_;
+    uint64_t present_;
+    int flex_direction_;
+    int direction_;
+    int justify_content_;
+    int align_content_;
+    int align_items_;
+    int align_self_;
+    int position_;
+    int flex_wrap_;
+    int overflow_;
+    int display_;
+    float flex_grow_;
+    float flex_shrink_;
+    float aspect_ratio_;
+    bool patch_;
+    uint64_t unset_;
+    int32_t z_index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetLayoutValues final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.SetLayoutValues) */ {
+ public:
+  inline SetLayoutValues() : SetLayoutValues(nullptr) {}
+  ~SetLayoutValues() override;
+  explicit PROTOBUF_CONSTEXPR SetLayoutValues(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetLayoutValues(const SetLayoutValues& from);
+  SetLayoutValues(SetLayoutValues&& from) noexcept
+    : SetLayoutValues() {
+    *this = ::std::move(from);
+  }
+
+  inline SetLayoutValues& operator=(const SetLayoutValues& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetLayoutValues& operator=(SetLayoutValues&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetLayoutValues& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetLayoutValues* internal_default_instance() {
+    return reinterpret_cast<const SetLayoutValues*>(
+               &_SetLayoutValues_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(SetLayoutValues& a, SetLayoutValues& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetLayoutValues* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetLayoutValues* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetLayoutValues* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetLayoutValues>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetLayoutValues& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetLayoutValues& from) {
+    SetLayoutValues::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetLayoutValues* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.SetLayoutValues";
+  }
+  protected:
+  explicit SetLayoutValues(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHandlesFieldNumber = 1,
+    kPropIdsFieldNumber = 2,
+    kValuesFieldNumber = 3,
+  };
+  // repeated uint32 handles = 1;
+  int handles_size() const;
+  private:
+  int _internal_handles_size() const;
+  public:
+  void clear_handles();
+  private:
+  uint32_t _internal_handles(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_handles() const;
+  void _internal_add_handles(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_handles();
+  public:
+  uint32_t handles(int index) const;
+  void set_handles(int index, uint32_t value);
+  void add_handles(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      handles() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_handles();
+
+  // repeated uint32 prop_ids = 2;
+  int prop_ids_size() const;
+  private:
+  int _internal_prop_ids_size() const;
+  public:
+  void clear_prop_ids();
+  private:
+  uint32_t _internal_prop_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_prop_ids() const;
+  void _internal_add_prop_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_prop_ids();
+  public:
+  uint32_t prop_ids(int index) const;
+  void set_prop_ids(int index, uint32_t value);
+  void add_prop_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      prop_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_prop_ids();
+
+  // repeated float values = 3;
+  int values_size() const;
+  private:
+  int _internal_values_size() const;
+  public:
+  void clear_values();
+  private:
+  float _internal_values(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_values() const;
+  void _internal_add_values(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_values();
+  public:
+  float values(int index) const;
+  void set_values(int index, float value);
+  void add_values(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      values() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_values();
+
+  // @@protoc_insertion_point(class_scope:protocol.SetLayoutValues)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > handles_;
+    mutable std::atomic<int> _handles_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > prop_ids_;
+    mutable std::atomic<int> _prop_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > values_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Dimension final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.Dimension) */ {
+ public:
+  inline Dimension() : Dimension(nullptr) {}
+  ~Dimension() override;
+  explicit PROTOBUF_CONSTEXPR Dimension(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Dimension(const Dimension& from);
+  Dimension(Dimension&& from) noexcept
+    : Dimension() {
+    *this = ::std::move(from);
+  }
+
+  inline Dimension& operator=(const Dimension& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Dimension& operator=(Dimension&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Dimension& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Dimension* internal_default_instance() {
+    return reinterpret_cast<const Dimension*>(
+               &_Dimension_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(Dimension& a, Dimension& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Dimension* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Dimension* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Dimension* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Dimension>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Dimension& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Dimension& from) {
+    Dimension::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Dimension* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.Dimension";
+  }
+  protected:
+  explicit Dimension(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+    kUnitFieldNumber = 2,
+  };
+  // float value = 1;
+  void clear_value();
+  float value() const;
+  void set_value(float value);
+  private:
+  float _internal_value() const;
+  void _internal_set_value(float value);
+  public:
+
+  // .protocol.Unit unit = 2;
+  void clear_unit();
+  ::protocol::Unit unit() const;
+  void set_unit(::protocol::Unit value);
+  private:
+  ::protocol::Unit _internal_unit() const;
+  void _internal_set_unit(::protocol::Unit value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:protocol.Dimension)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    float value_;
+    int unit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Prop final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.Prop) */ {
+ public:
+  inline Prop() : Prop(nullptr) {}
+  ~Prop() override;
+  explicit PROTOBUF_CONSTEXPR Prop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Prop(const Prop& from);
+  Prop(Prop&& from) noexcept
+    : Prop() {
+    *this = ::std::move(from);
+  }
+
+  inline Prop& operator=(const Prop& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Prop& operator=(Prop&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Prop& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ValueCase {
+    kStringValue = 2,
+    kIntValue = 3,
+    kFloatValue = 4,
+    kBoolValue = 5,
+    kObjectValue = 6,
+    kUndefined = 7,
+    kStringId = 9,
+    VALUE_NOT_SET = 0,
+  };
+
+  static inline const Prop* internal_default_instance() {
+    return reinterpret_cast<const Prop*>(
+               &_Prop_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(Prop& a, Prop& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Prop* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Prop* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Prop* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Prop>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Prop& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Prop& from) {
+    Prop::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Prop* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.Prop";
+  }
+  protected:
+  explicit Prop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kKeyIdFieldNumber = 8,
+    kStringValueFieldNumber = 2,
+    kIntValueFieldNumber = 3,
+    kFloatValueFieldNumber = 4,
+    kBoolValueFieldNumber = 5,
+    kObjectValueFieldNumber = 6,
+    kUndefinedFieldNumber = 7,
+    kStringIdFieldNumber = 9,
+  };
+  // string key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint32 key_id = 8;
+  void clear_key_id();
+  uint32_t key_id() const;
+  void set_key_id(uint32_t value);
+  private:
+  uint32_t _internal_key_id() const;
+  void _internal_set_key_id(uint32_t value);
+  public:
+
+  // string string_value = 2;
+  bool has_string_value() const;
+  private:
+  bool _internal_has_string_value() const;
+  public:
+  void clear_string_value();
+  const std::string& string_value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_string_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_string_value();
+  PROTOBUF_NODISCARD std::string* release_string_value();
+  void set_allocated_string_value(std::string* string_value);
+  private:
+  const std::string& _internal_string_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string_value(const std::string& value);
+  std::string* _internal_mutable_string_value();
+  public:
+
+  // int64 int_value = 3;
+  bool has_int_value() const;
+  private:
+  bool _internal_has_int_value() const;
+  public:
+  void clear_int_value();
+  int64_t int_value() const;
+  void set_int_value(int64_t value);
+  private:
+  int64_t _internal_int_value() const;
+  void _internal_set_int_value(int64_t value);
+  public:
+
+  // double float_value = 4;
+  bool has_float_value() const;
+  private:
+  bool _internal_has_float_value() const;
+  public:
+  void clear_float_value();
+  double float_value() const;
+  void set_float_value(double value);
+  private:
+  double _internal_float_value() const;
+  void _internal_set_float_value(double value);
+  public:
+
+  // bool bool_value = 5;
+  bool has_bool_value() const;
+  private:
+  bool _internal_has_bool_value() const;
+  public:
+  void clear_bool_value();
+  bool bool_value() const;
+  void set_bool_value(bool value);
+  private:
+  bool _internal_bool_value() const;
+  void _internal_set_bool_value(bool value);
+  public:
+
+  // .protocol.ObjectValue object_value = 6;
+  bool has_object_value() const;
+  private:
+  bool _internal_has_object_value() const;
+  public:
+  void clear_object_value();
+  const ::protocol::ObjectValue& object_value() const;
+  PROTOBUF_NODISCARD ::protocol::ObjectValue* release_object_value();
+  ::protocol::ObjectValue* mutable_object_value();
+  void set_allocated_object_value(::protocol::ObjectValue* object_value);
+  private:
+  const ::protocol::ObjectValue& _internal_object_value() const;
+  ::protocol::ObjectValue* _internal_mutable_object_value();
+  public:
+  void unsafe_arena_set_allocated_object_value(
+      ::protocol::ObjectValue* object_value);
+  ::protocol::ObjectValue* unsafe_arena_release_object_value();
+
+  // bool undefined = 7;
+  bool has_undefined() const;
+  private:
+  bool _internal_has_undefined() const;
+  public:
+  void clear_undefined();
+  bool undefined() const;
+  void set_undefined(bool value);
+  private:
+  bool _internal_undefined() const;
+  void _internal_set_undefined(bool value);
+  public:
+
+  // uint32 string_id = 9;
+  bool has_string_id() const;
+  private:
+  bool _internal_has_string_id() const;
+  public:
+  void clear_string_id();
+  uint32_t string_id() const;
+  void set_string_id(uint32_t value);
+  private:
+  uint32_t _internal_string_id() const;
+  void _internal_set_string_id(uint32_t value);
+  public:
+
+  void clear_value();
+  ValueCase value_case() const;
+  // @@protoc_insertion_point(class_scope:protocol.Prop)
+ private:
+  class _Internal;
+  void set_has_string_value();
+  void set_has_int_value();
+  void set_has_float_value();
+  void set_has_bool_value();
+  void set_has_object_value();
+  void set_has_undefined();
+  void set_has_string_id();
+
+  inline bool has_value() const;
+  inline void clear_has_value();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint32_t key_id_;
+    union ValueUnion {
+      constexpr ValueUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_value_;
+      int64_t int_value_;
+      double float_value_;
+      bool bool_value_;
+      ::protocol::ObjectValue* object_value_;
+      bool undefined_;
+      uint32_t string_id_;
+    } value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ObjectValue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:protocol.ObjectValue) */ {
+ public:
+  inline ObjectValue() : ObjectValue(nullptr) {}
+  ~ObjectValue() override;
+  explicit PROTOBUF_CONSTEXPR ObjectValue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ObjectValue(const ObjectValue& from);
+  ObjectValue(ObjectValue&& from) noexcept
+    : ObjectValue() {
+    *this = ::std::move(from);
+  }
+
+  inline ObjectValue& operator=(const ObjectValue& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ObjectValue& operator=(ObjectValue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ObjectValue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ObjectValue* internal_default_instance() {
+    return reinterpret_cast<const ObjectValue*>(
+               &_ObjectValue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(ObjectValue& a, ObjectValue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ObjectValue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ObjectValue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ObjectValue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ObjectValue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ObjectValue& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ObjectValue& from) {
+    ObjectValue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ObjectValue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "protocol.ObjectValue";
+  }
+  protected:
+  explicit ObjectValue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPropsFieldNumber = 1,
+  };
+  // repeated .protocol.Prop props = 1;
+  int props_size() const;
+  private:
+  int _internal_props_size() const;
+  public:
+  void clear_props();
+  ::protocol::Prop* mutable_props(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::Prop >*
+      mutable_props();
+  private:
+  const ::protocol::Prop& _internal_props(int index) const;
+  ::protocol::Prop* _internal_add_props();
+  public:
+  const ::protocol::Prop& props(int index) const;
+  ::protocol::Prop* add_props();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::Prop >&
+      props() const;
+
+  // @@protoc_insertion_point(class_scope:protocol.ObjectValue)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::Prop > props_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_protocol_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// ClientMessage
+
+// .protocol.InitRequest init_request = 1;
+inline bool ClientMessage::_internal_has_init_request() const {
+  return message_case() == kInitRequest;
+}
+inline bool ClientMessage::has_init_request() const {
+  return _internal_has_init_request();
+}
+inline void ClientMessage::set_has_init_request() {
+  _impl_._oneof_case_[0] = kInitRequest;
+}
+inline void ClientMessage::clear_init_request() {
+  if (_internal_has_init_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_.init_request_;
+    }
+    clear_has_message();
+  }
+}
+inline ::protocol::InitRequest* ClientMessage::release_init_request() {
+  // @@protoc_insertion_point(field_release:protocol.ClientMessage.init_request)
+  if (_internal_has_init_request()) {
+    clear_has_message();
+    ::protocol::InitRequest* temp = _impl_.message_.init_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_.init_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::InitRequest& ClientMessage::_internal_init_request() const {
+  return _internal_has_init_request()
+      ? *_impl_.message_.init_request_
+      : reinterpret_cast< ::protocol::InitRequest&>(::protocol::_InitRequest_default_instance_);
+}
+inline const ::protocol::InitRequest& ClientMessage::init_request() const {
+  // @@protoc_insertion_point(field_get:protocol.ClientMessage.init_request)
+  return _internal_init_request();
+}
+inline ::protocol::InitRequest* ClientMessage::unsafe_arena_release_init_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ClientMessage.init_request)
+  if (_internal_has_init_request()) {
+    clear_has_message();
+    ::protocol::InitRequest* temp = _impl_.message_.init_request_;
+    _impl_.message_.init_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ClientMessage::unsafe_arena_set_allocated_init_request(::protocol::InitRequest* init_request) {
+  clear_message();
+  if (init_request) {
+    set_has_init_request();
+    _impl_.message_.init_request_ = init_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ClientMessage.init_request)
+}
+inline ::protocol::InitRequest* ClientMessage::_internal_mutable_init_request() {
+  if (!_internal_has_init_request()) {
+    clear_message();
+    set_has_init_request();
+    _impl_.message_.init_request_ = CreateMaybeMessage< ::protocol::InitRequest >(GetArenaForAllocation());
+  }
+  return _impl_.message_.init_request_;
+}
+inline ::protocol::InitRequest* ClientMessage::mutable_init_request() {
+  ::protocol::InitRequest* _msg = _internal_mutable_init_request();
+  // @@protoc_insertion_point(field_mutable:protocol.ClientMessage.init_request)
+  return _msg;
+}
+
+// .protocol.ApplyUpdate apply_update = 2;
+inline bool ClientMessage::_internal_has_apply_update() const {
+  return message_case() == kApplyUpdate;
+}
+inline bool ClientMessage::has_apply_update() const {
+  return _internal_has_apply_update();
+}
+inline void ClientMessage::set_has_apply_update() {
+  _impl_._oneof_case_[0] = kApplyUpdate;
+}
+inline void ClientMessage::clear_apply_update() {
+  if (_internal_has_apply_update()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_.apply_update_;
+    }
+    clear_has_message();
+  }
+}
+inline ::protocol::ApplyUpdate* ClientMessage::release_apply_update() {
+  // @@protoc_insertion_point(field_release:protocol.ClientMessage.apply_update)
+  if (_internal_has_apply_update()) {
+    clear_has_message();
+    ::protocol::ApplyUpdate* temp = _impl_.message_.apply_update_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_.apply_update_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::ApplyUpdate& ClientMessage::_internal_apply_update() const {
+  return _internal_has_apply_update()
+      ? *_impl_.message_.apply_update_
+      : reinterpret_cast< ::protocol::ApplyUpdate&>(::protocol::_ApplyUpdate_default_instance_);
+}
+inline const ::protocol::ApplyUpdate& ClientMessage::apply_update() const {
+  // @@protoc_insertion_point(field_get:protocol.ClientMessage.apply_update)
+  return _internal_apply_update();
+}
+inline ::protocol::ApplyUpdate* ClientMessage::unsafe_arena_release_apply_update() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ClientMessage.apply_update)
+  if (_internal_has_apply_update()) {
+    clear_has_message();
+    ::protocol::ApplyUpdate* temp = _impl_.message_.apply_update_;
+    _impl_.message_.apply_update_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ClientMessage::unsafe_arena_set_allocated_apply_update(::protocol::ApplyUpdate* apply_update) {
+  clear_message();
+  if (apply_update) {
+    set_has_apply_update();
+    _impl_.message_.apply_update_ = apply_update;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ClientMessage.apply_update)
+}
+inline ::protocol::ApplyUpdate* ClientMessage::_internal_mutable_apply_update() {
+  if (!_internal_has_apply_update()) {
+    clear_message();
+    set_has_apply_update();
+    _impl_.message_.apply_update_ = CreateMaybeMessage< ::protocol::ApplyUpdate >(GetArenaForAllocation());
+  }
+  return _impl_.message_.apply_update_;
+}
+inline ::protocol::ApplyUpdate* ClientMessage::mutable_apply_update() {
+  ::protocol::ApplyUpdate* _msg = _internal_mutable_apply_update();
+  // @@protoc_insertion_point(field_mutable:protocol.ClientMessage.apply_update)
+  return _msg;
+}
+
+// .protocol.FindSourceRequest find_source = 3;
+inline bool ClientMessage::_internal_has_find_source() const {
+  return message_case() == kFindSource;
+}
+inline bool ClientMessage::has_find_source() const {
+  return _internal_has_find_source();
+}
+inline void ClientMessage::set_has_find_source() {
+  _impl_._oneof_case_[0] = kFindSource;
+}
+inline void ClientMessage::clear_find_source() {
+  if (_internal_has_find_source()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_.find_source_;
+    }
+    clear_has_message();
+  }
+}
+inline ::protocol::FindSourceRequest* ClientMessage::release_find_source() {
+  // @@protoc_insertion_point(field_release:protocol.ClientMessage.find_source)
+  if (_internal_has_find_source()) {
+    clear_has_message();
+    ::protocol::FindSourceRequest* temp = _impl_.message_.find_source_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_.find_source_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::FindSourceRequest& ClientMessage::_internal_find_source() const {
+  return _internal_has_find_source()
+      ? *_impl_.message_.find_source_
+      : reinterpret_cast< ::protocol::FindSourceRequest&>(::protocol::_FindSourceRequest_default_instance_);
+}
+inline const ::protocol::FindSourceRequest& ClientMessage::find_source() const {
+  // @@protoc_insertion_point(field_get:protocol.ClientMessage.find_source)
+  return _internal_find_source();
+}
+inline ::protocol::FindSourceRequest* ClientMessage::unsafe_arena_release_find_source() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ClientMessage.find_source)
+  if (_internal_has_find_source()) {
+    clear_has_message();
+    ::protocol::FindSourceRequest* temp = _impl_.message_.find_source_;
+    _impl_.message_.find_source_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ClientMessage::unsafe_arena_set_allocated_find_source(::protocol::FindSourceRequest* find_source) {
+  clear_message();
+  if (find_source) {
+    set_has_find_source();
+    _impl_.message_.find_source_ = find_source;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ClientMessage.find_source)
+}
+inline ::protocol::FindSourceRequest* ClientMessage::_internal_mutable_find_source() {
+  if (!_internal_has_find_source()) {
+    clear_message();
+    set_has_find_source();
+    _impl_.message_.find_source_ = CreateMaybeMessage< ::protocol::FindSourceRequest >(GetArenaForAllocation());
+  }
+  return _impl_.message_.find_source_;
+}
+inline ::protocol::FindSourceRequest* ClientMessage::mutable_find_source() {
+  ::protocol::FindSourceRequest* _msg = _internal_mutable_find_source();
+  // @@protoc_insertion_point(field_mutable:protocol.ClientMessage.find_source)
+  return _msg;
+}
+
+// .protocol.UpdateBatch update_batch = 4;
+inline bool ClientMessage::_internal_has_update_batch() const {
+  return message_case() == kUpdateBatch;
+}
+inline bool ClientMessage::has_update_batch() const {
+  return _internal_has_update_batch();
+}
+inline void ClientMessage::set_has_update_batch() {
+  _impl_._oneof_case_[0] = kUpdateBatch;
+}
+inline void ClientMessage::clear_update_batch() {
+  if (_internal_has_update_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_.update_batch_;
+    }
+    clear_has_message();
+  }
+}
+inline ::protocol::UpdateBatch* ClientMessage::release_update_batch() {
+  // @@protoc_insertion_point(field_release:protocol.ClientMessage.update_batch)
+  if (_internal_has_update_batch()) {
+    clear_has_message();
+    ::protocol::UpdateBatch* temp = _impl_.message_.update_batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_.update_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::UpdateBatch& ClientMessage::_internal_update_batch() const {
+  return _internal_has_update_batch()
+      ? *_impl_.message_.update_batch_
+      : reinterpret_cast< ::protocol::UpdateBatch&>(::protocol::_UpdateBatch_default_instance_);
+}
+inline const ::protocol::UpdateBatch& ClientMessage::update_batch() const {
+  // @@protoc_insertion_point(field_get:protocol.ClientMessage.update_batch)
+  return _internal_update_batch();
+}
+inline ::protocol::UpdateBatch* ClientMessage::unsafe_arena_release_update_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ClientMessage.update_batch)
+  if (_internal_has_update_batch()) {
+    clear_has_message();
+    ::protocol::UpdateBatch* temp = _impl_.message_.update_batch_;
+    _impl_.message_.update_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ClientMessage::unsafe_arena_set_allocated_update_batch(::protocol::UpdateBatch* update_batch) {
+  clear_message();
+  if (update_batch) {
+    set_has_update_batch();
+    _impl_.message_.update_batch_ = update_batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ClientMessage.update_batch)
+}
+inline ::protocol::UpdateBatch* ClientMessage::_internal_mutable_update_batch() {
+  if (!_internal_has_update_batch()) {
+    clear_message();
+    set_has_update_batch();
+    _impl_.message_.update_batch_ = CreateMaybeMessage< ::protocol::UpdateBatch >(GetArenaForAllocation());
+  }
+  return _impl_.message_.update_batch_;
+}
+inline ::protocol::UpdateBatch* ClientMessage::mutable_update_batch() {
+  ::protocol::UpdateBatch* _msg = _internal_mutable_update_batch();
+  // @@protoc_insertion_point(field_mutable:protocol.ClientMessage.update_batch)
+  return _msg;
+}
+
+inline bool ClientMessage::has_message() const {
+  return message_case() != MESSAGE_NOT_SET;
+}
+inline void ClientMessage::clear_has_message() {
+  _impl_._oneof_case_[0] = MESSAGE_NOT_SET;
+}
+inline ClientMessage::MessageCase ClientMessage::message_case() const {
+  return ClientMessage::MessageCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ServerMessage
+
+// .protocol.Response response = 1;
+inline bool ServerMessage::_internal_has_response() const {
+  return message_case() == kResponse;
+}
+inline bool ServerMessage::has_response() const {
+  return _internal_has_response();
+}
+inline void ServerMessage::set_has_response() {
+  _impl_._oneof_case_[0] = kResponse;
+}
+inline void ServerMessage::clear_response() {
+  if (_internal_has_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_.response_;
+    }
+    clear_has_message();
+  }
+}
+inline ::protocol::Response* ServerMessage::release_response() {
+  // @@protoc_insertion_point(field_release:protocol.ServerMessage.response)
+  if (_internal_has_response()) {
+    clear_has_message();
+    ::protocol::Response* temp = _impl_.message_.response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_.response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::Response& ServerMessage::_internal_response() const {
+  return _internal_has_response()
+      ? *_impl_.message_.response_
+      : reinterpret_cast< ::protocol::Response&>(::protocol::_Response_default_instance_);
+}
+inline const ::protocol::Response& ServerMessage::response() const {
+  // @@protoc_insertion_point(field_get:protocol.ServerMessage.response)
+  return _internal_response();
+}
+inline ::protocol::Response* ServerMessage::unsafe_arena_release_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ServerMessage.response)
+  if (_internal_has_response()) {
+    clear_has_message();
+    ::protocol::Response* temp = _impl_.message_.response_;
+    _impl_.message_.response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ServerMessage::unsafe_arena_set_allocated_response(::protocol::Response* response) {
+  clear_message();
+  if (response) {
+    set_has_response();
+    _impl_.message_.response_ = response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ServerMessage.response)
+}
+inline ::protocol::Response* ServerMessage::_internal_mutable_response() {
+  if (!_internal_has_response()) {
+    clear_message();
+    set_has_response();
+    _impl_.message_.response_ = CreateMaybeMessage< ::protocol::Response >(GetArenaForAllocation());
+  }
+  return _impl_.message_.response_;
+}
+inline ::protocol::Response* ServerMessage::mutable_response() {
+  ::protocol::Response* _msg = _internal_mutable_response();
+  // @@protoc_insertion_point(field_mutable:protocol.ServerMessage.response)
+  return _msg;
+}
+
+// .protocol.UpdateCredits update_credits = 2;
+inline bool ServerMessage::_internal_has_update_credits() const {
+  return message_case() == kUpdateCredits;
+}
+inline bool ServerMessage::has_update_credits() const {
+  return _internal_has_update_credits();
+}
+inline void ServerMessage::set_has_update_credits() {
+  _impl_._oneof_case_[0] = kUpdateCredits;
+}
+inline void ServerMessage::clear_update_credits() {
+  if (_internal_has_update_credits()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.message_.update_credits_;
+    }
+    clear_has_message();
+  }
+}
+inline ::protocol::UpdateCredits* ServerMessage::release_update_credits() {
+  // @@protoc_insertion_point(field_release:protocol.ServerMessage.update_credits)
+  if (_internal_has_update_credits()) {
+    clear_has_message();
+    ::protocol::UpdateCredits* temp = _impl_.message_.update_credits_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.message_.update_credits_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::UpdateCredits& ServerMessage::_internal_update_credits() const {
+  return _internal_has_update_credits()
+      ? *_impl_.message_.update_credits_
+      : reinterpret_cast< ::protocol::UpdateCredits&>(::protocol::_UpdateCredits_default_instance_);
+}
+inline const ::protocol::UpdateCredits& ServerMessage::update_credits() const {
+  // @@protoc_insertion_point(field_get:protocol.ServerMessage.update_credits)
+  return _internal_update_credits();
+}
+inline ::protocol::UpdateCredits* ServerMessage::unsafe_arena_release_update_credits() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ServerMessage.update_credits)
+  if (_internal_has_update_credits()) {
+    clear_has_message();
+    ::protocol::UpdateCredits* temp = _impl_.message_.update_credits_;
+    _impl_.message_.update_credits_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ServerMessage::unsafe_arena_set_allocated_update_credits(::protocol::UpdateCredits* update_credits) {
+  clear_message();
+  if (update_credits) {
+    set_has_update_credits();
+    _impl_.message_.update_credits_ = update_credits;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ServerMessage.update_credits)
+}
+inline ::protocol::UpdateCredits* ServerMessage::_internal_mutable_update_credits() {
+  if (!_internal_has_update_credits()) {
+    clear_message();
+    set_has_update_credits();
+    _impl_.message_.update_credits_ = CreateMaybeMessage< ::protocol::UpdateCredits >(GetArenaForAllocation());
+  }
+  return _impl_.message_.update_credits_;
+}
+inline ::protocol::UpdateCredits* ServerMessage::mutable_update_credits() {
+  ::protocol::UpdateCredits* _msg = _internal_mutable_update_credits();
+  // @@protoc_insertion_point(field_mutable:protocol.ServerMessage.update_credits)
+  return _msg;
+}
+
+inline bool ServerMessage::has_message() const {
+  return message_case() != MESSAGE_NOT_SET;
+}
+inline void ServerMessage::clear_has_message() {
+  _impl_._oneof_case_[0] = MESSAGE_NOT_SET;
+}
+inline ServerMessage::MessageCase ServerMessage::message_case() const {
+  return ServerMessage::MessageCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// InitRequest
+
+// string request_id = 1;
+inline void InitRequest::clear_request_id() {
+  _impl_.request_id_.ClearToEmpty();
+}
+inline const std::string& InitRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:protocol.InitRequest.request_id)
+  return _internal_request_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InitRequest::set_request_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.request_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.InitRequest.request_id)
+}
+inline std::string* InitRequest::mutable_request_id() {
+  std::string* _s = _internal_mutable_request_id();
+  // @@protoc_insertion_point(field_mutable:protocol.InitRequest.request_id)
+  return _s;
+}
+inline const std::string& InitRequest::_internal_request_id() const {
+  return _impl_.request_id_.Get();
+}
+inline void InitRequest::_internal_set_request_id(const std::string& value) {
+  
+  _impl_.request_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InitRequest::_internal_mutable_request_id() {
+  
+  return _impl_.request_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InitRequest::release_request_id() {
+  // @@protoc_insertion_point(field_release:protocol.InitRequest.request_id)
+  return _impl_.request_id_.Release();
+}
+inline void InitRequest::set_allocated_request_id(std::string* request_id) {
+  if (request_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.request_id_.SetAllocated(request_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.request_id_.IsDefault()) {
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.InitRequest.request_id)
+}
+
+// string client_id = 2;
+inline void InitRequest::clear_client_id() {
+  _impl_.client_id_.ClearToEmpty();
+}
+inline const std::string& InitRequest::client_id() const {
+  // @@protoc_insertion_point(field_get:protocol.InitRequest.client_id)
+  return _internal_client_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void InitRequest::set_client_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.client_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.InitRequest.client_id)
+}
+inline std::string* InitRequest::mutable_client_id() {
+  std::string* _s = _internal_mutable_client_id();
+  // @@protoc_insertion_point(field_mutable:protocol.InitRequest.client_id)
+  return _s;
+}
+inline const std::string& InitRequest::_internal_client_id() const {
+  return _impl_.client_id_.Get();
+}
+inline void InitRequest::_internal_set_client_id(const std::string& value) {
+  
+  _impl_.client_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* InitRequest::_internal_mutable_client_id() {
+  
+  return _impl_.client_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* InitRequest::release_client_id() {
+  // @@protoc_insertion_point(field_release:protocol.InitRequest.client_id)
+  return _impl_.client_id_.Release();
+}
+inline void InitRequest::set_allocated_client_id(std::string* client_id) {
+  if (client_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.client_id_.SetAllocated(client_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.client_id_.IsDefault()) {
+    _impl_.client_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.InitRequest.client_id)
+}
+
+// uint32 shared_memory_ring_size = 3;
+inline void InitRequest::clear_shared_memory_ring_size() {
+  _impl_.shared_memory_ring_size_ = 0u;
+}
+inline uint32_t InitRequest::_internal_shared_memory_ring_size() const {
+  return _impl_.shared_memory_ring_size_;
+}
+inline uint32_t InitRequest::shared_memory_ring_size() const {
+  // @@protoc_insertion_point(field_get:protocol.InitRequest.shared_memory_ring_size)
+  return _internal_shared_memory_ring_size();
+}
+inline void InitRequest::_internal_set_shared_memory_ring_size(uint32_t value) {
+  
+  _impl_.shared_memory_ring_size_ = value;
+}
+inline void InitRequest::set_shared_memory_ring_size(uint32_t value) {
+  _internal_set_shared_memory_ring_size(value);
+  // @@protoc_insertion_point(field_set:protocol.InitRequest.shared_memory_ring_size)
+}
+
+// bool flow_control = 4;
+inline void InitRequest::clear_flow_control() {
+  _impl_.flow_control_ = false;
+}
+inline bool InitRequest::_internal_flow_control() const {
+  return _impl_.flow_control_;
+}
+inline bool InitRequest::flow_control() const {
+  // @@protoc_insertion_point(field_get:protocol.InitRequest.flow_control)
+  return _internal_flow_control();
+}
+inline void InitRequest::_internal_set_flow_control(bool value) {
+  
+  _impl_.flow_control_ = value;
+}
+inline void InitRequest::set_flow_control(bool value) {
+  _internal_set_flow_control(value);
+  // @@protoc_insertion_point(field_set:protocol.InitRequest.flow_control)
+}
+
+// .protocol.Compression compression = 5;
+inline void InitRequest::clear_compression() {
+  _impl_.compression_ = 0;
+}
+inline ::protocol::Compression InitRequest::_internal_compression() const {
+  return static_cast< ::protocol::Compression >(_impl_.compression_);
+}
+inline ::protocol::Compression InitRequest::compression() const {
+  // @@protoc_insertion_point(field_get:protocol.InitRequest.compression)
+  return _internal_compression();
+}
+inline void InitRequest::_internal_set_compression(::protocol::Compression value) {
+  
+  _impl_.compression_ = value;
+}
+inline void InitRequest::set_compression(::protocol::Compression value) {
+  _internal_set_compression(value);
+  // @@protoc_insertion_point(field_set:protocol.InitRequest.compression)
+}
+
+// -------------------------------------------------------------------
+
+// Scene
+
+// string name = 1;
+inline void Scene::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Scene::name() const {
+  // @@protoc_insertion_point(field_get:protocol.Scene.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Scene::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.Scene.name)
+}
+inline std::string* Scene::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:protocol.Scene.name)
+  return _s;
+}
+inline const std::string& Scene::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Scene::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Scene::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Scene::release_name() {
+  // @@protoc_insertion_point(field_release:protocol.Scene.name)
+  return _impl_.name_.Release();
+}
+inline void Scene::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.Scene.name)
+}
+
+// -------------------------------------------------------------------
+
+// ApplyUpdate
+
+// .protocol.CreateSource create_source = 1;
+inline bool ApplyUpdate::_internal_has_create_source() const {
+  return change_case() == kCreateSource;
+}
+inline bool ApplyUpdate::has_create_source() const {
+  return _internal_has_create_source();
+}
+inline void ApplyUpdate::set_has_create_source() {
+  _impl_._oneof_case_[0] = kCreateSource;
+}
+inline void ApplyUpdate::clear_create_source() {
+  if (_internal_has_create_source()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.create_source_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::CreateSource* ApplyUpdate::release_create_source() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.create_source)
+  if (_internal_has_create_source()) {
+    clear_has_change();
+    ::protocol::CreateSource* temp = _impl_.change_.create_source_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.create_source_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::CreateSource& ApplyUpdate::_internal_create_source() const {
+  return _internal_has_create_source()
+      ? *_impl_.change_.create_source_
+      : reinterpret_cast< ::protocol::CreateSource&>(::protocol::_CreateSource_default_instance_);
+}
+inline const ::protocol::CreateSource& ApplyUpdate::create_source() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.create_source)
+  return _internal_create_source();
+}
+inline ::protocol::CreateSource* ApplyUpdate::unsafe_arena_release_create_source() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.create_source)
+  if (_internal_has_create_source()) {
+    clear_has_change();
+    ::protocol::CreateSource* temp = _impl_.change_.create_source_;
+    _impl_.change_.create_source_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_create_source(::protocol::CreateSource* create_source) {
+  clear_change();
+  if (create_source) {
+    set_has_create_source();
+    _impl_.change_.create_source_ = create_source;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.create_source)
+}
+inline ::protocol::CreateSource* ApplyUpdate::_internal_mutable_create_source() {
+  if (!_internal_has_create_source()) {
+    clear_change();
+    set_has_create_source();
+    _impl_.change_.create_source_ = CreateMaybeMessage< ::protocol::CreateSource >(GetArenaForAllocation());
+  }
+  return _impl_.change_.create_source_;
+}
+inline ::protocol::CreateSource* ApplyUpdate::mutable_create_source() {
+  ::protocol::CreateSource* _msg = _internal_mutable_create_source();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.create_source)
+  return _msg;
+}
+
+// .protocol.UpdateSource update_source = 3;
+inline bool ApplyUpdate::_internal_has_update_source() const {
+  return change_case() == kUpdateSource;
+}
+inline bool ApplyUpdate::has_update_source() const {
+  return _internal_has_update_source();
+}
+inline void ApplyUpdate::set_has_update_source() {
+  _impl_._oneof_case_[0] = kUpdateSource;
+}
+inline void ApplyUpdate::clear_update_source() {
+  if (_internal_has_update_source()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.update_source_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::UpdateSource* ApplyUpdate::release_update_source() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.update_source)
+  if (_internal_has_update_source()) {
+    clear_has_change();
+    ::protocol::UpdateSource* temp = _impl_.change_.update_source_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.update_source_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::UpdateSource& ApplyUpdate::_internal_update_source() const {
+  return _internal_has_update_source()
+      ? *_impl_.change_.update_source_
+      : reinterpret_cast< ::protocol::UpdateSource&>(::protocol::_UpdateSource_default_instance_);
+}
+inline const ::protocol::UpdateSource& ApplyUpdate::update_source() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.update_source)
+  return _internal_update_source();
+}
+inline ::protocol::UpdateSource* ApplyUpdate::unsafe_arena_release_update_source() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.update_source)
+  if (_internal_has_update_source()) {
+    clear_has_change();
+    ::protocol::UpdateSource* temp = _impl_.change_.update_source_;
+    _impl_.change_.update_source_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_update_source(::protocol::UpdateSource* update_source) {
+  clear_change();
+  if (update_source) {
+    set_has_update_source();
+    _impl_.change_.update_source_ = update_source;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.update_source)
+}
+inline ::protocol::UpdateSource* ApplyUpdate::_internal_mutable_update_source() {
+  if (!_internal_has_update_source()) {
+    clear_change();
+    set_has_update_source();
+    _impl_.change_.update_source_ = CreateMaybeMessage< ::protocol::UpdateSource >(GetArenaForAllocation());
+  }
+  return _impl_.change_.update_source_;
+}
+inline ::protocol::UpdateSource* ApplyUpdate::mutable_update_source() {
+  ::protocol::UpdateSource* _msg = _internal_mutable_update_source();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.update_source)
+  return _msg;
+}
+
+// .protocol.CreateScene create_scene = 5;
+inline bool ApplyUpdate::_internal_has_create_scene() const {
+  return change_case() == kCreateScene;
+}
+inline bool ApplyUpdate::has_create_scene() const {
+  return _internal_has_create_scene();
+}
+inline void ApplyUpdate::set_has_create_scene() {
+  _impl_._oneof_case_[0] = kCreateScene;
+}
+inline void ApplyUpdate::clear_create_scene() {
+  if (_internal_has_create_scene()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.create_scene_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::CreateScene* ApplyUpdate::release_create_scene() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.create_scene)
+  if (_internal_has_create_scene()) {
+    clear_has_change();
+    ::protocol::CreateScene* temp = _impl_.change_.create_scene_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.create_scene_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::CreateScene& ApplyUpdate::_internal_create_scene() const {
+  return _internal_has_create_scene()
+      ? *_impl_.change_.create_scene_
+      : reinterpret_cast< ::protocol::CreateScene&>(::protocol::_CreateScene_default_instance_);
+}
+inline const ::protocol::CreateScene& ApplyUpdate::create_scene() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.create_scene)
+  return _internal_create_scene();
+}
+inline ::protocol::CreateScene* ApplyUpdate::unsafe_arena_release_create_scene() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.create_scene)
+  if (_internal_has_create_scene()) {
+    clear_has_change();
+    ::protocol::CreateScene* temp = _impl_.change_.create_scene_;
+    _impl_.change_.create_scene_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_create_scene(::protocol::CreateScene* create_scene) {
+  clear_change();
+  if (create_scene) {
+    set_has_create_scene();
+    _impl_.change_.create_scene_ = create_scene;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.create_scene)
+}
+inline ::protocol::CreateScene* ApplyUpdate::_internal_mutable_create_scene() {
+  if (!_internal_has_create_scene()) {
+    clear_change();
+    set_has_create_scene();
+    _impl_.change_.create_scene_ = CreateMaybeMessage< ::protocol::CreateScene >(GetArenaForAllocation());
+  }
+  return _impl_.change_.create_scene_;
+}
+inline ::protocol::CreateScene* ApplyUpdate::mutable_create_scene() {
+  ::protocol::CreateScene* _msg = _internal_mutable_create_scene();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.create_scene)
+  return _msg;
+}
+
+// .protocol.AppendChild append_child = 2;
+inline bool ApplyUpdate::_internal_has_append_child() const {
+  return change_case() == kAppendChild;
+}
+inline bool ApplyUpdate::has_append_child() const {
+  return _internal_has_append_child();
+}
+inline void ApplyUpdate::set_has_append_child() {
+  _impl_._oneof_case_[0] = kAppendChild;
+}
+inline void ApplyUpdate::clear_append_child() {
+  if (_internal_has_append_child()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.append_child_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::AppendChild* ApplyUpdate::release_append_child() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.append_child)
+  if (_internal_has_append_child()) {
+    clear_has_change();
+    ::protocol::AppendChild* temp = _impl_.change_.append_child_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.append_child_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::AppendChild& ApplyUpdate::_internal_append_child() const {
+  return _internal_has_append_child()
+      ? *_impl_.change_.append_child_
+      : reinterpret_cast< ::protocol::AppendChild&>(::protocol::_AppendChild_default_instance_);
+}
+inline const ::protocol::AppendChild& ApplyUpdate::append_child() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.append_child)
+  return _internal_append_child();
+}
+inline ::protocol::AppendChild* ApplyUpdate::unsafe_arena_release_append_child() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.append_child)
+  if (_internal_has_append_child()) {
+    clear_has_change();
+    ::protocol::AppendChild* temp = _impl_.change_.append_child_;
+    _impl_.change_.append_child_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_append_child(::protocol::AppendChild* append_child) {
+  clear_change();
+  if (append_child) {
+    set_has_append_child();
+    _impl_.change_.append_child_ = append_child;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.append_child)
+}
+inline ::protocol::AppendChild* ApplyUpdate::_internal_mutable_append_child() {
+  if (!_internal_has_append_child()) {
+    clear_change();
+    set_has_append_child();
+    _impl_.change_.append_child_ = CreateMaybeMessage< ::protocol::AppendChild >(GetArenaForAllocation());
+  }
+  return _impl_.change_.append_child_;
+}
+inline ::protocol::AppendChild* ApplyUpdate::mutable_append_child() {
+  ::protocol::AppendChild* _msg = _internal_mutable_append_child();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.append_child)
+  return _msg;
+}
+
+// .protocol.RemoveChild remove_child = 4;
+inline bool ApplyUpdate::_internal_has_remove_child() const {
+  return change_case() == kRemoveChild;
+}
+inline bool ApplyUpdate::has_remove_child() const {
+  return _internal_has_remove_child();
+}
+inline void ApplyUpdate::set_has_remove_child() {
+  _impl_._oneof_case_[0] = kRemoveChild;
+}
+inline void ApplyUpdate::clear_remove_child() {
+  if (_internal_has_remove_child()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.remove_child_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::RemoveChild* ApplyUpdate::release_remove_child() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.remove_child)
+  if (_internal_has_remove_child()) {
+    clear_has_change();
+    ::protocol::RemoveChild* temp = _impl_.change_.remove_child_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.remove_child_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::RemoveChild& ApplyUpdate::_internal_remove_child() const {
+  return _internal_has_remove_child()
+      ? *_impl_.change_.remove_child_
+      : reinterpret_cast< ::protocol::RemoveChild&>(::protocol::_RemoveChild_default_instance_);
+}
+inline const ::protocol::RemoveChild& ApplyUpdate::remove_child() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.remove_child)
+  return _internal_remove_child();
+}
+inline ::protocol::RemoveChild* ApplyUpdate::unsafe_arena_release_remove_child() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.remove_child)
+  if (_internal_has_remove_child()) {
+    clear_has_change();
+    ::protocol::RemoveChild* temp = _impl_.change_.remove_child_;
+    _impl_.change_.remove_child_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_remove_child(::protocol::RemoveChild* remove_child) {
+  clear_change();
+  if (remove_child) {
+    set_has_remove_child();
+    _impl_.change_.remove_child_ = remove_child;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.remove_child)
+}
+inline ::protocol::RemoveChild* ApplyUpdate::_internal_mutable_remove_child() {
+  if (!_internal_has_remove_child()) {
+    clear_change();
+    set_has_remove_child();
+    _impl_.change_.remove_child_ = CreateMaybeMessage< ::protocol::RemoveChild >(GetArenaForAllocation());
+  }
+  return _impl_.change_.remove_child_;
+}
+inline ::protocol::RemoveChild* ApplyUpdate::mutable_remove_child() {
+  ::protocol::RemoveChild* _msg = _internal_mutable_remove_child();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.remove_child)
+  return _msg;
+}
+
+// .protocol.CommitUpdates commit_updates = 6;
+inline bool ApplyUpdate::_internal_has_commit_updates() const {
+  return change_case() == kCommitUpdates;
+}
+inline bool ApplyUpdate::has_commit_updates() const {
+  return _internal_has_commit_updates();
+}
+inline void ApplyUpdate::set_has_commit_updates() {
+  _impl_._oneof_case_[0] = kCommitUpdates;
+}
+inline void ApplyUpdate::clear_commit_updates() {
+  if (_internal_has_commit_updates()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.commit_updates_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::CommitUpdates* ApplyUpdate::release_commit_updates() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.commit_updates)
+  if (_internal_has_commit_updates()) {
+    clear_has_change();
+    ::protocol::CommitUpdates* temp = _impl_.change_.commit_updates_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.commit_updates_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::CommitUpdates& ApplyUpdate::_internal_commit_updates() const {
+  return _internal_has_commit_updates()
+      ? *_impl_.change_.commit_updates_
+      : reinterpret_cast< ::protocol::CommitUpdates&>(::protocol::_CommitUpdates_default_instance_);
+}
+inline const ::protocol::CommitUpdates& ApplyUpdate::commit_updates() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.commit_updates)
+  return _internal_commit_updates();
+}
+inline ::protocol::CommitUpdates* ApplyUpdate::unsafe_arena_release_commit_updates() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.commit_updates)
+  if (_internal_has_commit_updates()) {
+    clear_has_change();
+    ::protocol::CommitUpdates* temp = _impl_.change_.commit_updates_;
+    _impl_.change_.commit_updates_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_commit_updates(::protocol::CommitUpdates* commit_updates) {
+  clear_change();
+  if (commit_updates) {
+    set_has_commit_updates();
+    _impl_.change_.commit_updates_ = commit_updates;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.commit_updates)
+}
+inline ::protocol::CommitUpdates* ApplyUpdate::_internal_mutable_commit_updates() {
+  if (!_internal_has_commit_updates()) {
+    clear_change();
+    set_has_commit_updates();
+    _impl_.change_.commit_updates_ = CreateMaybeMessage< ::protocol::CommitUpdates >(GetArenaForAllocation());
+  }
+  return _impl_.change_.commit_updates_;
+}
+inline ::protocol::CommitUpdates* ApplyUpdate::mutable_commit_updates() {
+  ::protocol::CommitUpdates* _msg = _internal_mutable_commit_updates();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.commit_updates)
+  return _msg;
+}
+
+// .protocol.DefineKey define_key = 7;
+inline bool ApplyUpdate::_internal_has_define_key() const {
+  return change_case() == kDefineKey;
+}
+inline bool ApplyUpdate::has_define_key() const {
+  return _internal_has_define_key();
+}
+inline void ApplyUpdate::set_has_define_key() {
+  _impl_._oneof_case_[0] = kDefineKey;
+}
+inline void ApplyUpdate::clear_define_key() {
+  if (_internal_has_define_key()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.define_key_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::DefineKey* ApplyUpdate::release_define_key() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.define_key)
+  if (_internal_has_define_key()) {
+    clear_has_change();
+    ::protocol::DefineKey* temp = _impl_.change_.define_key_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.define_key_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::DefineKey& ApplyUpdate::_internal_define_key() const {
+  return _internal_has_define_key()
+      ? *_impl_.change_.define_key_
+      : reinterpret_cast< ::protocol::DefineKey&>(::protocol::_DefineKey_default_instance_);
+}
+inline const ::protocol::DefineKey& ApplyUpdate::define_key() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.define_key)
+  return _internal_define_key();
+}
+inline ::protocol::DefineKey* ApplyUpdate::unsafe_arena_release_define_key() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.define_key)
+  if (_internal_has_define_key()) {
+    clear_has_change();
+    ::protocol::DefineKey* temp = _impl_.change_.define_key_;
+    _impl_.change_.define_key_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_define_key(::protocol::DefineKey* define_key) {
+  clear_change();
+  if (define_key) {
+    set_has_define_key();
+    _impl_.change_.define_key_ = define_key;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.define_key)
+}
+inline ::protocol::DefineKey* ApplyUpdate::_internal_mutable_define_key() {
+  if (!_internal_has_define_key()) {
+    clear_change();
+    set_has_define_key();
+    _impl_.change_.define_key_ = CreateMaybeMessage< ::protocol::DefineKey >(GetArenaForAllocation());
+  }
+  return _impl_.change_.define_key_;
+}
+inline ::protocol::DefineKey* ApplyUpdate::mutable_define_key() {
+  ::protocol::DefineKey* _msg = _internal_mutable_define_key();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.define_key)
+  return _msg;
+}
+
+// .protocol.DefineString define_string = 8;
+inline bool ApplyUpdate::_internal_has_define_string() const {
+  return change_case() == kDefineString;
+}
+inline bool ApplyUpdate::has_define_string() const {
+  return _internal_has_define_string();
+}
+inline void ApplyUpdate::set_has_define_string() {
+  _impl_._oneof_case_[0] = kDefineString;
+}
+inline void ApplyUpdate::clear_define_string() {
+  if (_internal_has_define_string()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.define_string_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::DefineString* ApplyUpdate::release_define_string() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.define_string)
+  if (_internal_has_define_string()) {
+    clear_has_change();
+    ::protocol::DefineString* temp = _impl_.change_.define_string_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.define_string_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::DefineString& ApplyUpdate::_internal_define_string() const {
+  return _internal_has_define_string()
+      ? *_impl_.change_.define_string_
+      : reinterpret_cast< ::protocol::DefineString&>(::protocol::_DefineString_default_instance_);
+}
+inline const ::protocol::DefineString& ApplyUpdate::define_string() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.define_string)
+  return _internal_define_string();
+}
+inline ::protocol::DefineString* ApplyUpdate::unsafe_arena_release_define_string() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.define_string)
+  if (_internal_has_define_string()) {
+    clear_has_change();
+    ::protocol::DefineString* temp = _impl_.change_.define_string_;
+    _impl_.change_.define_string_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_define_string(::protocol::DefineString* define_string) {
+  clear_change();
+  if (define_string) {
+    set_has_define_string();
+    _impl_.change_.define_string_ = define_string;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.define_string)
+}
+inline ::protocol::DefineString* ApplyUpdate::_internal_mutable_define_string() {
+  if (!_internal_has_define_string()) {
+    clear_change();
+    set_has_define_string();
+    _impl_.change_.define_string_ = CreateMaybeMessage< ::protocol::DefineString >(GetArenaForAllocation());
+  }
+  return _impl_.change_.define_string_;
+}
+inline ::protocol::DefineString* ApplyUpdate::mutable_define_string() {
+  ::protocol::DefineString* _msg = _internal_mutable_define_string();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.define_string)
+  return _msg;
+}
+
+// .protocol.SetLayoutValues set_layout_values = 9;
+inline bool ApplyUpdate::_internal_has_set_layout_values() const {
+  return change_case() == kSetLayoutValues;
+}
+inline bool ApplyUpdate::has_set_layout_values() const {
+  return _internal_has_set_layout_values();
+}
+inline void ApplyUpdate::set_has_set_layout_values() {
+  _impl_._oneof_case_[0] = kSetLayoutValues;
+}
+inline void ApplyUpdate::clear_set_layout_values() {
+  if (_internal_has_set_layout_values()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.set_layout_values_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::SetLayoutValues* ApplyUpdate::release_set_layout_values() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.set_layout_values)
+  if (_internal_has_set_layout_values()) {
+    clear_has_change();
+    ::protocol::SetLayoutValues* temp = _impl_.change_.set_layout_values_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.set_layout_values_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::SetLayoutValues& ApplyUpdate::_internal_set_layout_values() const {
+  return _internal_has_set_layout_values()
+      ? *_impl_.change_.set_layout_values_
+      : reinterpret_cast< ::protocol::SetLayoutValues&>(::protocol::_SetLayoutValues_default_instance_);
+}
+inline const ::protocol::SetLayoutValues& ApplyUpdate::set_layout_values() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.set_layout_values)
+  return _internal_set_layout_values();
+}
+inline ::protocol::SetLayoutValues* ApplyUpdate::unsafe_arena_release_set_layout_values() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.set_layout_values)
+  if (_internal_has_set_layout_values()) {
+    clear_has_change();
+    ::protocol::SetLayoutValues* temp = _impl_.change_.set_layout_values_;
+    _impl_.change_.set_layout_values_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_set_layout_values(::protocol::SetLayoutValues* set_layout_values) {
+  clear_change();
+  if (set_layout_values) {
+    set_has_set_layout_values();
+    _impl_.change_.set_layout_values_ = set_layout_values;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.set_layout_values)
+}
+inline ::protocol::SetLayoutValues* ApplyUpdate::_internal_mutable_set_layout_values() {
+  if (!_internal_has_set_layout_values()) {
+    clear_change();
+    set_has_set_layout_values();
+    _impl_.change_.set_layout_values_ = CreateMaybeMessage< ::protocol::SetLayoutValues >(GetArenaForAllocation());
+  }
+  return _impl_.change_.set_layout_values_;
+}
+inline ::protocol::SetLayoutValues* ApplyUpdate::mutable_set_layout_values() {
+  ::protocol::SetLayoutValues* _msg = _internal_mutable_set_layout_values();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.set_layout_values)
+  return _msg;
+}
+
+// .protocol.InsertBefore insert_before = 10;
+inline bool ApplyUpdate::_internal_has_insert_before() const {
+  return change_case() == kInsertBefore;
+}
+inline bool ApplyUpdate::has_insert_before() const {
+  return _internal_has_insert_before();
+}
+inline void ApplyUpdate::set_has_insert_before() {
+  _impl_._oneof_case_[0] = kInsertBefore;
+}
+inline void ApplyUpdate::clear_insert_before() {
+  if (_internal_has_insert_before()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.insert_before_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::InsertBefore* ApplyUpdate::release_insert_before() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.insert_before)
+  if (_internal_has_insert_before()) {
+    clear_has_change();
+    ::protocol::InsertBefore* temp = _impl_.change_.insert_before_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.insert_before_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::InsertBefore& ApplyUpdate::_internal_insert_before() const {
+  return _internal_has_insert_before()
+      ? *_impl_.change_.insert_before_
+      : reinterpret_cast< ::protocol::InsertBefore&>(::protocol::_InsertBefore_default_instance_);
+}
+inline const ::protocol::InsertBefore& ApplyUpdate::insert_before() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.insert_before)
+  return _internal_insert_before();
+}
+inline ::protocol::InsertBefore* ApplyUpdate::unsafe_arena_release_insert_before() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.insert_before)
+  if (_internal_has_insert_before()) {
+    clear_has_change();
+    ::protocol::InsertBefore* temp = _impl_.change_.insert_before_;
+    _impl_.change_.insert_before_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_insert_before(::protocol::InsertBefore* insert_before) {
+  clear_change();
+  if (insert_before) {
+    set_has_insert_before();
+    _impl_.change_.insert_before_ = insert_before;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.insert_before)
+}
+inline ::protocol::InsertBefore* ApplyUpdate::_internal_mutable_insert_before() {
+  if (!_internal_has_insert_before()) {
+    clear_change();
+    set_has_insert_before();
+    _impl_.change_.insert_before_ = CreateMaybeMessage< ::protocol::InsertBefore >(GetArenaForAllocation());
+  }
+  return _impl_.change_.insert_before_;
+}
+inline ::protocol::InsertBefore* ApplyUpdate::mutable_insert_before() {
+  ::protocol::InsertBefore* _msg = _internal_mutable_insert_before();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.insert_before)
+  return _msg;
+}
+
+// .protocol.MoveChild move_child = 11;
+inline bool ApplyUpdate::_internal_has_move_child() const {
+  return change_case() == kMoveChild;
+}
+inline bool ApplyUpdate::has_move_child() const {
+  return _internal_has_move_child();
+}
+inline void ApplyUpdate::set_has_move_child() {
+  _impl_._oneof_case_[0] = kMoveChild;
+}
+inline void ApplyUpdate::clear_move_child() {
+  if (_internal_has_move_child()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.move_child_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::MoveChild* ApplyUpdate::release_move_child() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.move_child)
+  if (_internal_has_move_child()) {
+    clear_has_change();
+    ::protocol::MoveChild* temp = _impl_.change_.move_child_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.move_child_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::MoveChild& ApplyUpdate::_internal_move_child() const {
+  return _internal_has_move_child()
+      ? *_impl_.change_.move_child_
+      : reinterpret_cast< ::protocol::MoveChild&>(::protocol::_MoveChild_default_instance_);
+}
+inline const ::protocol::MoveChild& ApplyUpdate::move_child() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.move_child)
+  return _internal_move_child();
+}
+inline ::protocol::MoveChild* ApplyUpdate::unsafe_arena_release_move_child() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.move_child)
+  if (_internal_has_move_child()) {
+    clear_has_change();
+    ::protocol::MoveChild* temp = _impl_.change_.move_child_;
+    _impl_.change_.move_child_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_move_child(::protocol::MoveChild* move_child) {
+  clear_change();
+  if (move_child) {
+    set_has_move_child();
+    _impl_.change_.move_child_ = move_child;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.move_child)
+}
+inline ::protocol::MoveChild* ApplyUpdate::_internal_mutable_move_child() {
+  if (!_internal_has_move_child()) {
+    clear_change();
+    set_has_move_child();
+    _impl_.change_.move_child_ = CreateMaybeMessage< ::protocol::MoveChild >(GetArenaForAllocation());
+  }
+  return _impl_.change_.move_child_;
+}
+inline ::protocol::MoveChild* ApplyUpdate::mutable_move_child() {
+  ::protocol::MoveChild* _msg = _internal_mutable_move_child();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.move_child)
+  return _msg;
+}
+
+// .protocol.CreateTree create_tree = 12;
+inline bool ApplyUpdate::_internal_has_create_tree() const {
+  return change_case() == kCreateTree;
+}
+inline bool ApplyUpdate::has_create_tree() const {
+  return _internal_has_create_tree();
+}
+inline void ApplyUpdate::set_has_create_tree() {
+  _impl_._oneof_case_[0] = kCreateTree;
+}
+inline void ApplyUpdate::clear_create_tree() {
+  if (_internal_has_create_tree()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.change_.create_tree_;
+    }
+    clear_has_change();
+  }
+}
+inline ::protocol::CreateTree* ApplyUpdate::release_create_tree() {
+  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.create_tree)
+  if (_internal_has_create_tree()) {
+    clear_has_change();
+    ::protocol::CreateTree* temp = _impl_.change_.create_tree_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.change_.create_tree_ = nullptr;
+    return temp;
+  } else {
     return nullptr;
   }
 }
-inline const ::protocol::FindSourceRequest& ClientMessage::_internal_find_source() const {
-  return _internal_has_find_source()
-      ? *message_.find_source_
-      : *reinterpret_cast< ::protocol::FindSourceRequest*>(&::protocol::_FindSourceRequest_default_instance_);
+inline const ::protocol::CreateTree& ApplyUpdate::_internal_create_tree() const {
+  return _internal_has_create_tree()
+      ? *_impl_.change_.create_tree_
+      : reinterpret_cast< ::protocol::CreateTree&>(::protocol::_CreateTree_default_instance_);
+}
+inline const ::protocol::CreateTree& ApplyUpdate::create_tree() const {
+  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.create_tree)
+  return _internal_create_tree();
+}
+inline ::protocol::CreateTree* ApplyUpdate::unsafe_arena_release_create_tree() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.create_tree)
+  if (_internal_has_create_tree()) {
+    clear_has_change();
+    ::protocol::CreateTree* temp = _impl_.change_.create_tree_;
+    _impl_.change_.create_tree_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void ApplyUpdate::unsafe_arena_set_allocated_create_tree(::protocol::CreateTree* create_tree) {
+  clear_change();
+  if (create_tree) {
+    set_has_create_tree();
+    _impl_.change_.create_tree_ = create_tree;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.create_tree)
+}
+inline ::protocol::CreateTree* ApplyUpdate::_internal_mutable_create_tree() {
+  if (!_internal_has_create_tree()) {
+    clear_change();
+    set_has_create_tree();
+    _impl_.change_.create_tree_ = CreateMaybeMessage< ::protocol::CreateTree >(GetArenaForAllocation());
+  }
+  return _impl_.change_.create_tree_;
+}
+inline ::protocol::CreateTree* ApplyUpdate::mutable_create_tree() {
+  ::protocol::CreateTree* _msg = _internal_mutable_create_tree();
+  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.create_tree)
+  return _msg;
+}
+
+inline bool ApplyUpdate::has_change() const {
+  return change_case() != CHANGE_NOT_SET;
+}
+inline void ApplyUpdate::clear_has_change() {
+  _impl_._oneof_case_[0] = CHANGE_NOT_SET;
+}
+inline ApplyUpdate::ChangeCase ApplyUpdate::change_case() const {
+  return ApplyUpdate::ChangeCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// UpdateBatch
+
+// repeated .protocol.ApplyUpdate updates = 1;
+inline int UpdateBatch::_internal_updates_size() const {
+  return _impl_.updates_.size();
+}
+inline int UpdateBatch::updates_size() const {
+  return _internal_updates_size();
+}
+inline void UpdateBatch::clear_updates() {
+  _impl_.updates_.Clear();
+}
+inline ::protocol::ApplyUpdate* UpdateBatch::mutable_updates(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.UpdateBatch.updates)
+  return _impl_.updates_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::ApplyUpdate >*
+UpdateBatch::mutable_updates() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.UpdateBatch.updates)
+  return &_impl_.updates_;
+}
+inline const ::protocol::ApplyUpdate& UpdateBatch::_internal_updates(int index) const {
+  return _impl_.updates_.Get(index);
+}
+inline const ::protocol::ApplyUpdate& UpdateBatch::updates(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.UpdateBatch.updates)
+  return _internal_updates(index);
+}
+inline ::protocol::ApplyUpdate* UpdateBatch::_internal_add_updates() {
+  return _impl_.updates_.Add();
+}
+inline ::protocol::ApplyUpdate* UpdateBatch::add_updates() {
+  ::protocol::ApplyUpdate* _add = _internal_add_updates();
+  // @@protoc_insertion_point(field_add:protocol.UpdateBatch.updates)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::ApplyUpdate >&
+UpdateBatch::updates() const {
+  // @@protoc_insertion_point(field_list:protocol.UpdateBatch.updates)
+  return _impl_.updates_;
+}
+
+// -------------------------------------------------------------------
+
+// FindSourceRequest
+
+// string request_id = 1;
+inline void FindSourceRequest::clear_request_id() {
+  _impl_.request_id_.ClearToEmpty();
+}
+inline const std::string& FindSourceRequest::request_id() const {
+  // @@protoc_insertion_point(field_get:protocol.FindSourceRequest.request_id)
+  return _internal_request_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FindSourceRequest::set_request_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.request_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.FindSourceRequest.request_id)
+}
+inline std::string* FindSourceRequest::mutable_request_id() {
+  std::string* _s = _internal_mutable_request_id();
+  // @@protoc_insertion_point(field_mutable:protocol.FindSourceRequest.request_id)
+  return _s;
+}
+inline const std::string& FindSourceRequest::_internal_request_id() const {
+  return _impl_.request_id_.Get();
+}
+inline void FindSourceRequest::_internal_set_request_id(const std::string& value) {
+  
+  _impl_.request_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FindSourceRequest::_internal_mutable_request_id() {
+  
+  return _impl_.request_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FindSourceRequest::release_request_id() {
+  // @@protoc_insertion_point(field_release:protocol.FindSourceRequest.request_id)
+  return _impl_.request_id_.Release();
+}
+inline void FindSourceRequest::set_allocated_request_id(std::string* request_id) {
+  if (request_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.request_id_.SetAllocated(request_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.request_id_.IsDefault()) {
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.FindSourceRequest.request_id)
+}
+
+// string uid = 2;
+inline void FindSourceRequest::clear_uid() {
+  _impl_.uid_.ClearToEmpty();
+}
+inline const std::string& FindSourceRequest::uid() const {
+  // @@protoc_insertion_point(field_get:protocol.FindSourceRequest.uid)
+  return _internal_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FindSourceRequest::set_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.FindSourceRequest.uid)
+}
+inline std::string* FindSourceRequest::mutable_uid() {
+  std::string* _s = _internal_mutable_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.FindSourceRequest.uid)
+  return _s;
+}
+inline const std::string& FindSourceRequest::_internal_uid() const {
+  return _impl_.uid_.Get();
+}
+inline void FindSourceRequest::_internal_set_uid(const std::string& value) {
+  
+  _impl_.uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FindSourceRequest::_internal_mutable_uid() {
+  
+  return _impl_.uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FindSourceRequest::release_uid() {
+  // @@protoc_insertion_point(field_release:protocol.FindSourceRequest.uid)
+  return _impl_.uid_.Release();
+}
+inline void FindSourceRequest::set_allocated_uid(std::string* uid) {
+  if (uid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uid_.SetAllocated(uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uid_.IsDefault()) {
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.FindSourceRequest.uid)
+}
+
+// string name = 3;
+inline void FindSourceRequest::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& FindSourceRequest::name() const {
+  // @@protoc_insertion_point(field_get:protocol.FindSourceRequest.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FindSourceRequest::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.FindSourceRequest.name)
+}
+inline std::string* FindSourceRequest::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:protocol.FindSourceRequest.name)
+  return _s;
+}
+inline const std::string& FindSourceRequest::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void FindSourceRequest::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FindSourceRequest::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FindSourceRequest::release_name() {
+  // @@protoc_insertion_point(field_release:protocol.FindSourceRequest.name)
+  return _impl_.name_.Release();
+}
+inline void FindSourceRequest::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.FindSourceRequest.name)
+}
+
+// uint32 handle = 4;
+inline void FindSourceRequest::clear_handle() {
+  _impl_.handle_ = 0u;
+}
+inline uint32_t FindSourceRequest::_internal_handle() const {
+  return _impl_.handle_;
+}
+inline uint32_t FindSourceRequest::handle() const {
+  // @@protoc_insertion_point(field_get:protocol.FindSourceRequest.handle)
+  return _internal_handle();
+}
+inline void FindSourceRequest::_internal_set_handle(uint32_t value) {
+  
+  _impl_.handle_ = value;
+}
+inline void FindSourceRequest::set_handle(uint32_t value) {
+  _internal_set_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.FindSourceRequest.handle)
+}
+
+// -------------------------------------------------------------------
+
+// Response
+
+// string request_id = 1;
+inline void Response::clear_request_id() {
+  _impl_.request_id_.ClearToEmpty();
+}
+inline const std::string& Response::request_id() const {
+  // @@protoc_insertion_point(field_get:protocol.Response.request_id)
+  return _internal_request_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_request_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.request_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.Response.request_id)
+}
+inline std::string* Response::mutable_request_id() {
+  std::string* _s = _internal_mutable_request_id();
+  // @@protoc_insertion_point(field_mutable:protocol.Response.request_id)
+  return _s;
+}
+inline const std::string& Response::_internal_request_id() const {
+  return _impl_.request_id_.Get();
+}
+inline void Response::_internal_set_request_id(const std::string& value) {
+  
+  _impl_.request_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_request_id() {
+  
+  return _impl_.request_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_request_id() {
+  // @@protoc_insertion_point(field_release:protocol.Response.request_id)
+  return _impl_.request_id_.Release();
+}
+inline void Response::set_allocated_request_id(std::string* request_id) {
+  if (request_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.request_id_.SetAllocated(request_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.request_id_.IsDefault()) {
+    _impl_.request_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.Response.request_id)
+}
+
+// bool success = 2;
+inline void Response::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool Response::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool Response::success() const {
+  // @@protoc_insertion_point(field_get:protocol.Response.success)
+  return _internal_success();
+}
+inline void Response::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void Response::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:protocol.Response.success)
+}
+
+// .protocol.SharedMemoryTransport shared_memory = 3;
+inline bool Response::_internal_has_shared_memory() const {
+  return this != internal_default_instance() && _impl_.shared_memory_ != nullptr;
+}
+inline bool Response::has_shared_memory() const {
+  return _internal_has_shared_memory();
+}
+inline void Response::clear_shared_memory() {
+  if (GetArenaForAllocation() == nullptr && _impl_.shared_memory_ != nullptr) {
+    delete _impl_.shared_memory_;
+  }
+  _impl_.shared_memory_ = nullptr;
+}
+inline const ::protocol::SharedMemoryTransport& Response::_internal_shared_memory() const {
+  const ::protocol::SharedMemoryTransport* p = _impl_.shared_memory_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::SharedMemoryTransport&>(
+      ::protocol::_SharedMemoryTransport_default_instance_);
+}
+inline const ::protocol::SharedMemoryTransport& Response::shared_memory() const {
+  // @@protoc_insertion_point(field_get:protocol.Response.shared_memory)
+  return _internal_shared_memory();
+}
+inline void Response::unsafe_arena_set_allocated_shared_memory(
+    ::protocol::SharedMemoryTransport* shared_memory) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.shared_memory_);
+  }
+  _impl_.shared_memory_ = shared_memory;
+  if (shared_memory) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Response.shared_memory)
+}
+inline ::protocol::SharedMemoryTransport* Response::release_shared_memory() {
+  
+  ::protocol::SharedMemoryTransport* temp = _impl_.shared_memory_;
+  _impl_.shared_memory_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::protocol::SharedMemoryTransport* Response::unsafe_arena_release_shared_memory() {
+  // @@protoc_insertion_point(field_release:protocol.Response.shared_memory)
+  
+  ::protocol::SharedMemoryTransport* temp = _impl_.shared_memory_;
+  _impl_.shared_memory_ = nullptr;
+  return temp;
+}
+inline ::protocol::SharedMemoryTransport* Response::_internal_mutable_shared_memory() {
+  
+  if (_impl_.shared_memory_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::SharedMemoryTransport>(GetArenaForAllocation());
+    _impl_.shared_memory_ = p;
+  }
+  return _impl_.shared_memory_;
+}
+inline ::protocol::SharedMemoryTransport* Response::mutable_shared_memory() {
+  ::protocol::SharedMemoryTransport* _msg = _internal_mutable_shared_memory();
+  // @@protoc_insertion_point(field_mutable:protocol.Response.shared_memory)
+  return _msg;
+}
+inline void Response::set_allocated_shared_memory(::protocol::SharedMemoryTransport* shared_memory) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.shared_memory_;
+  }
+  if (shared_memory) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(shared_memory);
+    if (message_arena != submessage_arena) {
+      shared_memory = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, shared_memory, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.shared_memory_ = shared_memory;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Response.shared_memory)
+}
+
+// uint32 update_credits = 4;
+inline void Response::clear_update_credits() {
+  _impl_.update_credits_ = 0u;
+}
+inline uint32_t Response::_internal_update_credits() const {
+  return _impl_.update_credits_;
+}
+inline uint32_t Response::update_credits() const {
+  // @@protoc_insertion_point(field_get:protocol.Response.update_credits)
+  return _internal_update_credits();
+}
+inline void Response::_internal_set_update_credits(uint32_t value) {
+  
+  _impl_.update_credits_ = value;
+}
+inline void Response::set_update_credits(uint32_t value) {
+  _internal_set_update_credits(value);
+  // @@protoc_insertion_point(field_set:protocol.Response.update_credits)
+}
+
+// .protocol.FrameCompression compression = 5;
+inline bool Response::_internal_has_compression() const {
+  return this != internal_default_instance() && _impl_.compression_ != nullptr;
+}
+inline bool Response::has_compression() const {
+  return _internal_has_compression();
+}
+inline void Response::clear_compression() {
+  if (GetArenaForAllocation() == nullptr && _impl_.compression_ != nullptr) {
+    delete _impl_.compression_;
+  }
+  _impl_.compression_ = nullptr;
+}
+inline const ::protocol::FrameCompression& Response::_internal_compression() const {
+  const ::protocol::FrameCompression* p = _impl_.compression_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::FrameCompression&>(
+      ::protocol::_FrameCompression_default_instance_);
+}
+inline const ::protocol::FrameCompression& Response::compression() const {
+  // @@protoc_insertion_point(field_get:protocol.Response.compression)
+  return _internal_compression();
+}
+inline void Response::unsafe_arena_set_allocated_compression(
+    ::protocol::FrameCompression* compression) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.compression_);
+  }
+  _impl_.compression_ = compression;
+  if (compression) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Response.compression)
+}
+inline ::protocol::FrameCompression* Response::release_compression() {
+  
+  ::protocol::FrameCompression* temp = _impl_.compression_;
+  _impl_.compression_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::protocol::FrameCompression* Response::unsafe_arena_release_compression() {
+  // @@protoc_insertion_point(field_release:protocol.Response.compression)
+  
+  ::protocol::FrameCompression* temp = _impl_.compression_;
+  _impl_.compression_ = nullptr;
+  return temp;
+}
+inline ::protocol::FrameCompression* Response::_internal_mutable_compression() {
+  
+  if (_impl_.compression_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::FrameCompression>(GetArenaForAllocation());
+    _impl_.compression_ = p;
+  }
+  return _impl_.compression_;
+}
+inline ::protocol::FrameCompression* Response::mutable_compression() {
+  ::protocol::FrameCompression* _msg = _internal_mutable_compression();
+  // @@protoc_insertion_point(field_mutable:protocol.Response.compression)
+  return _msg;
+}
+inline void Response::set_allocated_compression(::protocol::FrameCompression* compression) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.compression_;
+  }
+  if (compression) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(compression);
+    if (message_arena != submessage_arena) {
+      compression = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, compression, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.compression_ = compression;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Response.compression)
+}
+
+// bool session_resumed = 6;
+inline void Response::clear_session_resumed() {
+  _impl_.session_resumed_ = false;
+}
+inline bool Response::_internal_session_resumed() const {
+  return _impl_.session_resumed_;
+}
+inline bool Response::session_resumed() const {
+  // @@protoc_insertion_point(field_get:protocol.Response.session_resumed)
+  return _internal_session_resumed();
+}
+inline void Response::_internal_set_session_resumed(bool value) {
+  
+  _impl_.session_resumed_ = value;
+}
+inline void Response::set_session_resumed(bool value) {
+  _internal_set_session_resumed(value);
+  // @@protoc_insertion_point(field_set:protocol.Response.session_resumed)
+}
+
+// -------------------------------------------------------------------
+
+// SharedMemoryTransport
+
+// uint32 ring_size = 1;
+inline void SharedMemoryTransport::clear_ring_size() {
+  _impl_.ring_size_ = 0u;
+}
+inline uint32_t SharedMemoryTransport::_internal_ring_size() const {
+  return _impl_.ring_size_;
+}
+inline uint32_t SharedMemoryTransport::ring_size() const {
+  // @@protoc_insertion_point(field_get:protocol.SharedMemoryTransport.ring_size)
+  return _internal_ring_size();
+}
+inline void SharedMemoryTransport::_internal_set_ring_size(uint32_t value) {
+  
+  _impl_.ring_size_ = value;
+}
+inline void SharedMemoryTransport::set_ring_size(uint32_t value) {
+  _internal_set_ring_size(value);
+  // @@protoc_insertion_point(field_set:protocol.SharedMemoryTransport.ring_size)
+}
+
+// -------------------------------------------------------------------
+
+// FrameCompression
+
+// .protocol.Compression algorithm = 1;
+inline void FrameCompression::clear_algorithm() {
+  _impl_.algorithm_ = 0;
+}
+inline ::protocol::Compression FrameCompression::_internal_algorithm() const {
+  return static_cast< ::protocol::Compression >(_impl_.algorithm_);
+}
+inline ::protocol::Compression FrameCompression::algorithm() const {
+  // @@protoc_insertion_point(field_get:protocol.FrameCompression.algorithm)
+  return _internal_algorithm();
+}
+inline void FrameCompression::_internal_set_algorithm(::protocol::Compression value) {
+  
+  _impl_.algorithm_ = value;
+}
+inline void FrameCompression::set_algorithm(::protocol::Compression value) {
+  _internal_set_algorithm(value);
+  // @@protoc_insertion_point(field_set:protocol.FrameCompression.algorithm)
+}
+
+// uint32 threshold = 2;
+inline void FrameCompression::clear_threshold() {
+  _impl_.threshold_ = 0u;
+}
+inline uint32_t FrameCompression::_internal_threshold() const {
+  return _impl_.threshold_;
+}
+inline uint32_t FrameCompression::threshold() const {
+  // @@protoc_insertion_point(field_get:protocol.FrameCompression.threshold)
+  return _internal_threshold();
+}
+inline void FrameCompression::_internal_set_threshold(uint32_t value) {
+  
+  _impl_.threshold_ = value;
+}
+inline void FrameCompression::set_threshold(uint32_t value) {
+  _internal_set_threshold(value);
+  // @@protoc_insertion_point(field_set:protocol.FrameCompression.threshold)
+}
+
+// bytes dictionary = 3;
+inline void FrameCompression::clear_dictionary() {
+  _impl_.dictionary_.ClearToEmpty();
+}
+inline const std::string& FrameCompression::dictionary() const {
+  // @@protoc_insertion_point(field_get:protocol.FrameCompression.dictionary)
+  return _internal_dictionary();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FrameCompression::set_dictionary(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.dictionary_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.FrameCompression.dictionary)
+}
+inline std::string* FrameCompression::mutable_dictionary() {
+  std::string* _s = _internal_mutable_dictionary();
+  // @@protoc_insertion_point(field_mutable:protocol.FrameCompression.dictionary)
+  return _s;
+}
+inline const std::string& FrameCompression::_internal_dictionary() const {
+  return _impl_.dictionary_.Get();
+}
+inline void FrameCompression::_internal_set_dictionary(const std::string& value) {
+  
+  _impl_.dictionary_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FrameCompression::_internal_mutable_dictionary() {
+  
+  return _impl_.dictionary_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FrameCompression::release_dictionary() {
+  // @@protoc_insertion_point(field_release:protocol.FrameCompression.dictionary)
+  return _impl_.dictionary_.Release();
+}
+inline void FrameCompression::set_allocated_dictionary(std::string* dictionary) {
+  if (dictionary != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.dictionary_.SetAllocated(dictionary, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.dictionary_.IsDefault()) {
+    _impl_.dictionary_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.FrameCompression.dictionary)
+}
+
+// -------------------------------------------------------------------
+
+// UpdateCredits
+
+// uint32 credits = 1;
+inline void UpdateCredits::clear_credits() {
+  _impl_.credits_ = 0u;
+}
+inline uint32_t UpdateCredits::_internal_credits() const {
+  return _impl_.credits_;
+}
+inline uint32_t UpdateCredits::credits() const {
+  // @@protoc_insertion_point(field_get:protocol.UpdateCredits.credits)
+  return _internal_credits();
+}
+inline void UpdateCredits::_internal_set_credits(uint32_t value) {
+  
+  _impl_.credits_ = value;
+}
+inline void UpdateCredits::set_credits(uint32_t value) {
+  _internal_set_credits(value);
+  // @@protoc_insertion_point(field_set:protocol.UpdateCredits.credits)
+}
+
+// -------------------------------------------------------------------
+
+// CreateSource
+
+// string uid = 1;
+inline void CreateSource::clear_uid() {
+  _impl_.uid_.ClearToEmpty();
+}
+inline const std::string& CreateSource::uid() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateSource.uid)
+  return _internal_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateSource::set_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.CreateSource.uid)
+}
+inline std::string* CreateSource::mutable_uid() {
+  std::string* _s = _internal_mutable_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.uid)
+  return _s;
+}
+inline const std::string& CreateSource::_internal_uid() const {
+  return _impl_.uid_.Get();
+}
+inline void CreateSource::_internal_set_uid(const std::string& value) {
+  
+  _impl_.uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateSource::_internal_mutable_uid() {
+  
+  return _impl_.uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateSource::release_uid() {
+  // @@protoc_insertion_point(field_release:protocol.CreateSource.uid)
+  return _impl_.uid_.Release();
+}
+inline void CreateSource::set_allocated_uid(std::string* uid) {
+  if (uid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uid_.SetAllocated(uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uid_.IsDefault()) {
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.uid)
+}
+
+// string container_uid = 5;
+inline void CreateSource::clear_container_uid() {
+  _impl_.container_uid_.ClearToEmpty();
+}
+inline const std::string& CreateSource::container_uid() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateSource.container_uid)
+  return _internal_container_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateSource::set_container_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.container_uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.CreateSource.container_uid)
+}
+inline std::string* CreateSource::mutable_container_uid() {
+  std::string* _s = _internal_mutable_container_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.container_uid)
+  return _s;
+}
+inline const std::string& CreateSource::_internal_container_uid() const {
+  return _impl_.container_uid_.Get();
+}
+inline void CreateSource::_internal_set_container_uid(const std::string& value) {
+  
+  _impl_.container_uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateSource::_internal_mutable_container_uid() {
+  
+  return _impl_.container_uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateSource::release_container_uid() {
+  // @@protoc_insertion_point(field_release:protocol.CreateSource.container_uid)
+  return _impl_.container_uid_.Release();
+}
+inline void CreateSource::set_allocated_container_uid(std::string* container_uid) {
+  if (container_uid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.container_uid_.SetAllocated(container_uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.container_uid_.IsDefault()) {
+    _impl_.container_uid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.container_uid)
+}
+
+// string id = 2;
+inline void CreateSource::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& CreateSource::id() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateSource.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateSource::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.CreateSource.id)
+}
+inline std::string* CreateSource::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.id)
+  return _s;
+}
+inline const std::string& CreateSource::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void CreateSource::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateSource::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateSource::release_id() {
+  // @@protoc_insertion_point(field_release:protocol.CreateSource.id)
+  return _impl_.id_.Release();
+}
+inline void CreateSource::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.id)
+}
+
+// string name = 3;
+inline void CreateSource::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& CreateSource::name() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateSource.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateSource::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.CreateSource.name)
+}
+inline std::string* CreateSource::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.name)
+  return _s;
+}
+inline const std::string& CreateSource::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CreateSource::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateSource::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateSource::release_name() {
+  // @@protoc_insertion_point(field_release:protocol.CreateSource.name)
+  return _impl_.name_.Release();
+}
+inline void CreateSource::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.name)
+}
+
+// .protocol.ObjectValue settings = 4;
+inline bool CreateSource::_internal_has_settings() const {
+  return this != internal_default_instance() && _impl_.settings_ != nullptr;
+}
+inline bool CreateSource::has_settings() const {
+  return _internal_has_settings();
+}
+inline void CreateSource::clear_settings() {
+  if (GetArenaForAllocation() == nullptr && _impl_.settings_ != nullptr) {
+    delete _impl_.settings_;
+  }
+  _impl_.settings_ = nullptr;
+}
+inline const ::protocol::ObjectValue& CreateSource::_internal_settings() const {
+  const ::protocol::ObjectValue* p = _impl_.settings_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::ObjectValue&>(
+      ::protocol::_ObjectValue_default_instance_);
+}
+inline const ::protocol::ObjectValue& CreateSource::settings() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateSource.settings)
+  return _internal_settings();
+}
+inline void CreateSource::unsafe_arena_set_allocated_settings(
+    ::protocol::ObjectValue* settings) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.settings_);
+  }
+  _impl_.settings_ = settings;
+  if (settings) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.CreateSource.settings)
+}
+inline ::protocol::ObjectValue* CreateSource::release_settings() {
+  
+  ::protocol::ObjectValue* temp = _impl_.settings_;
+  _impl_.settings_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::protocol::ObjectValue* CreateSource::unsafe_arena_release_settings() {
+  // @@protoc_insertion_point(field_release:protocol.CreateSource.settings)
+  
+  ::protocol::ObjectValue* temp = _impl_.settings_;
+  _impl_.settings_ = nullptr;
+  return temp;
+}
+inline ::protocol::ObjectValue* CreateSource::_internal_mutable_settings() {
+  
+  if (_impl_.settings_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::ObjectValue>(GetArenaForAllocation());
+    _impl_.settings_ = p;
+  }
+  return _impl_.settings_;
+}
+inline ::protocol::ObjectValue* CreateSource::mutable_settings() {
+  ::protocol::ObjectValue* _msg = _internal_mutable_settings();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.settings)
+  return _msg;
+}
+inline void CreateSource::set_allocated_settings(::protocol::ObjectValue* settings) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.settings_;
+  }
+  if (settings) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(settings);
+    if (message_arena != submessage_arena) {
+      settings = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, settings, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.settings_ = settings;
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.settings)
+}
+
+// uint32 handle = 6;
+inline void CreateSource::clear_handle() {
+  _impl_.handle_ = 0u;
+}
+inline uint32_t CreateSource::_internal_handle() const {
+  return _impl_.handle_;
+}
+inline uint32_t CreateSource::handle() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateSource.handle)
+  return _internal_handle();
+}
+inline void CreateSource::_internal_set_handle(uint32_t value) {
+  
+  _impl_.handle_ = value;
+}
+inline void CreateSource::set_handle(uint32_t value) {
+  _internal_set_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.CreateSource.handle)
+}
+
+// uint32 container_handle = 7;
+inline void CreateSource::clear_container_handle() {
+  _impl_.container_handle_ = 0u;
+}
+inline uint32_t CreateSource::_internal_container_handle() const {
+  return _impl_.container_handle_;
+}
+inline uint32_t CreateSource::container_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateSource.container_handle)
+  return _internal_container_handle();
+}
+inline void CreateSource::_internal_set_container_handle(uint32_t value) {
+  
+  _impl_.container_handle_ = value;
+}
+inline void CreateSource::set_container_handle(uint32_t value) {
+  _internal_set_container_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.CreateSource.container_handle)
+}
+
+// .protocol.Style style = 8;
+inline bool CreateSource::_internal_has_style() const {
+  return this != internal_default_instance() && _impl_.style_ != nullptr;
+}
+inline bool CreateSource::has_style() const {
+  return _internal_has_style();
+}
+inline void CreateSource::clear_style() {
+  if (GetArenaForAllocation() == nullptr && _impl_.style_ != nullptr) {
+    delete _impl_.style_;
+  }
+  _impl_.style_ = nullptr;
+}
+inline const ::protocol::Style& CreateSource::_internal_style() const {
+  const ::protocol::Style* p = _impl_.style_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Style&>(
+      ::protocol::_Style_default_instance_);
+}
+inline const ::protocol::Style& CreateSource::style() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateSource.style)
+  return _internal_style();
+}
+inline void CreateSource::unsafe_arena_set_allocated_style(
+    ::protocol::Style* style) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.style_);
+  }
+  _impl_.style_ = style;
+  if (style) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.CreateSource.style)
+}
+inline ::protocol::Style* CreateSource::release_style() {
+  
+  ::protocol::Style* temp = _impl_.style_;
+  _impl_.style_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::protocol::Style* CreateSource::unsafe_arena_release_style() {
+  // @@protoc_insertion_point(field_release:protocol.CreateSource.style)
+  
+  ::protocol::Style* temp = _impl_.style_;
+  _impl_.style_ = nullptr;
+  return temp;
+}
+inline ::protocol::Style* CreateSource::_internal_mutable_style() {
+  
+  if (_impl_.style_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Style>(GetArenaForAllocation());
+    _impl_.style_ = p;
+  }
+  return _impl_.style_;
+}
+inline ::protocol::Style* CreateSource::mutable_style() {
+  ::protocol::Style* _msg = _internal_mutable_style();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.style)
+  return _msg;
+}
+inline void CreateSource::set_allocated_style(::protocol::Style* style) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.style_;
+  }
+  if (style) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(style);
+    if (message_arena != submessage_arena) {
+      style = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, style, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.style_ = style;
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.style)
+}
+
+// -------------------------------------------------------------------
+
+// UpdateSource
+
+// string uid = 2;
+inline void UpdateSource::clear_uid() {
+  _impl_.uid_.ClearToEmpty();
+}
+inline const std::string& UpdateSource::uid() const {
+  // @@protoc_insertion_point(field_get:protocol.UpdateSource.uid)
+  return _internal_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdateSource::set_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.UpdateSource.uid)
+}
+inline std::string* UpdateSource::mutable_uid() {
+  std::string* _s = _internal_mutable_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.UpdateSource.uid)
+  return _s;
+}
+inline const std::string& UpdateSource::_internal_uid() const {
+  return _impl_.uid_.Get();
+}
+inline void UpdateSource::_internal_set_uid(const std::string& value) {
+  
+  _impl_.uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpdateSource::_internal_mutable_uid() {
+  
+  return _impl_.uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpdateSource::release_uid() {
+  // @@protoc_insertion_point(field_release:protocol.UpdateSource.uid)
+  return _impl_.uid_.Release();
+}
+inline void UpdateSource::set_allocated_uid(std::string* uid) {
+  if (uid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uid_.SetAllocated(uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uid_.IsDefault()) {
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.UpdateSource.uid)
+}
+
+// .protocol.ObjectValue changed_props = 3;
+inline bool UpdateSource::_internal_has_changed_props() const {
+  return this != internal_default_instance() && _impl_.changed_props_ != nullptr;
+}
+inline bool UpdateSource::has_changed_props() const {
+  return _internal_has_changed_props();
+}
+inline void UpdateSource::clear_changed_props() {
+  if (GetArenaForAllocation() == nullptr && _impl_.changed_props_ != nullptr) {
+    delete _impl_.changed_props_;
+  }
+  _impl_.changed_props_ = nullptr;
+}
+inline const ::protocol::ObjectValue& UpdateSource::_internal_changed_props() const {
+  const ::protocol::ObjectValue* p = _impl_.changed_props_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::ObjectValue&>(
+      ::protocol::_ObjectValue_default_instance_);
+}
+inline const ::protocol::ObjectValue& UpdateSource::changed_props() const {
+  // @@protoc_insertion_point(field_get:protocol.UpdateSource.changed_props)
+  return _internal_changed_props();
+}
+inline void UpdateSource::unsafe_arena_set_allocated_changed_props(
+    ::protocol::ObjectValue* changed_props) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.changed_props_);
+  }
+  _impl_.changed_props_ = changed_props;
+  if (changed_props) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.UpdateSource.changed_props)
+}
+inline ::protocol::ObjectValue* UpdateSource::release_changed_props() {
+  
+  ::protocol::ObjectValue* temp = _impl_.changed_props_;
+  _impl_.changed_props_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::protocol::ObjectValue* UpdateSource::unsafe_arena_release_changed_props() {
+  // @@protoc_insertion_point(field_release:protocol.UpdateSource.changed_props)
+  
+  ::protocol::ObjectValue* temp = _impl_.changed_props_;
+  _impl_.changed_props_ = nullptr;
+  return temp;
+}
+inline ::protocol::ObjectValue* UpdateSource::_internal_mutable_changed_props() {
+  
+  if (_impl_.changed_props_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::ObjectValue>(GetArenaForAllocation());
+    _impl_.changed_props_ = p;
+  }
+  return _impl_.changed_props_;
+}
+inline ::protocol::ObjectValue* UpdateSource::mutable_changed_props() {
+  ::protocol::ObjectValue* _msg = _internal_mutable_changed_props();
+  // @@protoc_insertion_point(field_mutable:protocol.UpdateSource.changed_props)
+  return _msg;
+}
+inline void UpdateSource::set_allocated_changed_props(::protocol::ObjectValue* changed_props) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.changed_props_;
+  }
+  if (changed_props) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(changed_props);
+    if (message_arena != submessage_arena) {
+      changed_props = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, changed_props, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.changed_props_ = changed_props;
+  // @@protoc_insertion_point(field_set_allocated:protocol.UpdateSource.changed_props)
+}
+
+// uint32 handle = 4;
+inline void UpdateSource::clear_handle() {
+  _impl_.handle_ = 0u;
+}
+inline uint32_t UpdateSource::_internal_handle() const {
+  return _impl_.handle_;
+}
+inline uint32_t UpdateSource::handle() const {
+  // @@protoc_insertion_point(field_get:protocol.UpdateSource.handle)
+  return _internal_handle();
+}
+inline void UpdateSource::_internal_set_handle(uint32_t value) {
+  
+  _impl_.handle_ = value;
+}
+inline void UpdateSource::set_handle(uint32_t value) {
+  _internal_set_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.UpdateSource.handle)
+}
+
+// .protocol.Style style = 5;
+inline bool UpdateSource::_internal_has_style() const {
+  return this != internal_default_instance() && _impl_.style_ != nullptr;
+}
+inline bool UpdateSource::has_style() const {
+  return _internal_has_style();
+}
+inline void UpdateSource::clear_style() {
+  if (GetArenaForAllocation() == nullptr && _impl_.style_ != nullptr) {
+    delete _impl_.style_;
+  }
+  _impl_.style_ = nullptr;
+}
+inline const ::protocol::Style& UpdateSource::_internal_style() const {
+  const ::protocol::Style* p = _impl_.style_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Style&>(
+      ::protocol::_Style_default_instance_);
+}
+inline const ::protocol::Style& UpdateSource::style() const {
+  // @@protoc_insertion_point(field_get:protocol.UpdateSource.style)
+  return _internal_style();
+}
+inline void UpdateSource::unsafe_arena_set_allocated_style(
+    ::protocol::Style* style) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.style_);
+  }
+  _impl_.style_ = style;
+  if (style) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.UpdateSource.style)
+}
+inline ::protocol::Style* UpdateSource::release_style() {
+  
+  ::protocol::Style* temp = _impl_.style_;
+  _impl_.style_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::protocol::Style* UpdateSource::unsafe_arena_release_style() {
+  // @@protoc_insertion_point(field_release:protocol.UpdateSource.style)
+  
+  ::protocol::Style* temp = _impl_.style_;
+  _impl_.style_ = nullptr;
+  return temp;
+}
+inline ::protocol::Style* UpdateSource::_internal_mutable_style() {
+  
+  if (_impl_.style_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Style>(GetArenaForAllocation());
+    _impl_.style_ = p;
+  }
+  return _impl_.style_;
+}
+inline ::protocol::Style* UpdateSource::mutable_style() {
+  ::protocol::Style* _msg = _internal_mutable_style();
+  // @@protoc_insertion_point(field_mutable:protocol.UpdateSource.style)
+  return _msg;
+}
+inline void UpdateSource::set_allocated_style(::protocol::Style* style) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.style_;
+  }
+  if (style) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(style);
+    if (message_arena != submessage_arena) {
+      style = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, style, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.style_ = style;
+  // @@protoc_insertion_point(field_set_allocated:protocol.UpdateSource.style)
+}
+
+// -------------------------------------------------------------------
+
+// CreateScene
+
+// string uid = 1;
+inline void CreateScene::clear_uid() {
+  _impl_.uid_.ClearToEmpty();
+}
+inline const std::string& CreateScene::uid() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateScene.uid)
+  return _internal_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateScene::set_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.CreateScene.uid)
+}
+inline std::string* CreateScene::mutable_uid() {
+  std::string* _s = _internal_mutable_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateScene.uid)
+  return _s;
+}
+inline const std::string& CreateScene::_internal_uid() const {
+  return _impl_.uid_.Get();
+}
+inline void CreateScene::_internal_set_uid(const std::string& value) {
+  
+  _impl_.uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateScene::_internal_mutable_uid() {
+  
+  return _impl_.uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateScene::release_uid() {
+  // @@protoc_insertion_point(field_release:protocol.CreateScene.uid)
+  return _impl_.uid_.Release();
+}
+inline void CreateScene::set_allocated_uid(std::string* uid) {
+  if (uid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uid_.SetAllocated(uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uid_.IsDefault()) {
+    _impl_.uid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateScene.uid)
+}
+
+// string container_uid = 4;
+inline void CreateScene::clear_container_uid() {
+  _impl_.container_uid_.ClearToEmpty();
+}
+inline const std::string& CreateScene::container_uid() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateScene.container_uid)
+  return _internal_container_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateScene::set_container_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.container_uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.CreateScene.container_uid)
+}
+inline std::string* CreateScene::mutable_container_uid() {
+  std::string* _s = _internal_mutable_container_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateScene.container_uid)
+  return _s;
+}
+inline const std::string& CreateScene::_internal_container_uid() const {
+  return _impl_.container_uid_.Get();
+}
+inline void CreateScene::_internal_set_container_uid(const std::string& value) {
+  
+  _impl_.container_uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateScene::_internal_mutable_container_uid() {
+  
+  return _impl_.container_uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateScene::release_container_uid() {
+  // @@protoc_insertion_point(field_release:protocol.CreateScene.container_uid)
+  return _impl_.container_uid_.Release();
+}
+inline void CreateScene::set_allocated_container_uid(std::string* container_uid) {
+  if (container_uid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.container_uid_.SetAllocated(container_uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.container_uid_.IsDefault()) {
+    _impl_.container_uid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateScene.container_uid)
+}
+
+// string name = 2;
+inline void CreateScene::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& CreateScene::name() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateScene.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CreateScene::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.CreateScene.name)
+}
+inline std::string* CreateScene::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateScene.name)
+  return _s;
+}
+inline const std::string& CreateScene::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CreateScene::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CreateScene::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CreateScene::release_name() {
+  // @@protoc_insertion_point(field_release:protocol.CreateScene.name)
+  return _impl_.name_.Release();
+}
+inline void CreateScene::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateScene.name)
+}
+
+// .protocol.ObjectValue props = 3;
+inline bool CreateScene::_internal_has_props() const {
+  return this != internal_default_instance() && _impl_.props_ != nullptr;
+}
+inline bool CreateScene::has_props() const {
+  return _internal_has_props();
+}
+inline void CreateScene::clear_props() {
+  if (GetArenaForAllocation() == nullptr && _impl_.props_ != nullptr) {
+    delete _impl_.props_;
+  }
+  _impl_.props_ = nullptr;
+}
+inline const ::protocol::ObjectValue& CreateScene::_internal_props() const {
+  const ::protocol::ObjectValue* p = _impl_.props_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::ObjectValue&>(
+      ::protocol::_ObjectValue_default_instance_);
+}
+inline const ::protocol::ObjectValue& CreateScene::props() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateScene.props)
+  return _internal_props();
+}
+inline void CreateScene::unsafe_arena_set_allocated_props(
+    ::protocol::ObjectValue* props) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.props_);
+  }
+  _impl_.props_ = props;
+  if (props) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.CreateScene.props)
+}
+inline ::protocol::ObjectValue* CreateScene::release_props() {
+  
+  ::protocol::ObjectValue* temp = _impl_.props_;
+  _impl_.props_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::protocol::ObjectValue* CreateScene::unsafe_arena_release_props() {
+  // @@protoc_insertion_point(field_release:protocol.CreateScene.props)
+  
+  ::protocol::ObjectValue* temp = _impl_.props_;
+  _impl_.props_ = nullptr;
+  return temp;
+}
+inline ::protocol::ObjectValue* CreateScene::_internal_mutable_props() {
+  
+  if (_impl_.props_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::ObjectValue>(GetArenaForAllocation());
+    _impl_.props_ = p;
+  }
+  return _impl_.props_;
+}
+inline ::protocol::ObjectValue* CreateScene::mutable_props() {
+  ::protocol::ObjectValue* _msg = _internal_mutable_props();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateScene.props)
+  return _msg;
+}
+inline void CreateScene::set_allocated_props(::protocol::ObjectValue* props) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.props_;
+  }
+  if (props) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(props);
+    if (message_arena != submessage_arena) {
+      props = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, props, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.props_ = props;
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateScene.props)
+}
+
+// uint32 handle = 5;
+inline void CreateScene::clear_handle() {
+  _impl_.handle_ = 0u;
+}
+inline uint32_t CreateScene::_internal_handle() const {
+  return _impl_.handle_;
+}
+inline uint32_t CreateScene::handle() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateScene.handle)
+  return _internal_handle();
+}
+inline void CreateScene::_internal_set_handle(uint32_t value) {
+  
+  _impl_.handle_ = value;
+}
+inline void CreateScene::set_handle(uint32_t value) {
+  _internal_set_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.CreateScene.handle)
+}
+
+// uint32 container_handle = 6;
+inline void CreateScene::clear_container_handle() {
+  _impl_.container_handle_ = 0u;
+}
+inline uint32_t CreateScene::_internal_container_handle() const {
+  return _impl_.container_handle_;
+}
+inline uint32_t CreateScene::container_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateScene.container_handle)
+  return _internal_container_handle();
+}
+inline void CreateScene::_internal_set_container_handle(uint32_t value) {
+  
+  _impl_.container_handle_ = value;
+}
+inline void CreateScene::set_container_handle(uint32_t value) {
+  _internal_set_container_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.CreateScene.container_handle)
+}
+
+// .protocol.Style style = 7;
+inline bool CreateScene::_internal_has_style() const {
+  return this != internal_default_instance() && _impl_.style_ != nullptr;
+}
+inline bool CreateScene::has_style() const {
+  return _internal_has_style();
+}
+inline void CreateScene::clear_style() {
+  if (GetArenaForAllocation() == nullptr && _impl_.style_ != nullptr) {
+    delete _impl_.style_;
+  }
+  _impl_.style_ = nullptr;
+}
+inline const ::protocol::Style& CreateScene::_internal_style() const {
+  const ::protocol::Style* p = _impl_.style_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Style&>(
+      ::protocol::_Style_default_instance_);
+}
+inline const ::protocol::Style& CreateScene::style() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateScene.style)
+  return _internal_style();
+}
+inline void CreateScene::unsafe_arena_set_allocated_style(
+    ::protocol::Style* style) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.style_);
+  }
+  _impl_.style_ = style;
+  if (style) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.CreateScene.style)
+}
+inline ::protocol::Style* CreateScene::release_style() {
+  
+  ::protocol::Style* temp = _impl_.style_;
+  _impl_.style_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::protocol::Style* CreateScene::unsafe_arena_release_style() {
+  // @@protoc_insertion_point(field_release:protocol.CreateScene.style)
+  
+  ::protocol::Style* temp = _impl_.style_;
+  _impl_.style_ = nullptr;
+  return temp;
+}
+inline ::protocol::Style* CreateScene::_internal_mutable_style() {
+  
+  if (_impl_.style_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Style>(GetArenaForAllocation());
+    _impl_.style_ = p;
+  }
+  return _impl_.style_;
+}
+inline ::protocol::Style* CreateScene::mutable_style() {
+  ::protocol::Style* _msg = _internal_mutable_style();
+  // @@protoc_insertion_point(field_mutable:protocol.CreateScene.style)
+  return _msg;
+}
+inline void CreateScene::set_allocated_style(::protocol::Style* style) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.style_;
+  }
+  if (style) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(style);
+    if (message_arena != submessage_arena) {
+      style = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, style, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.style_ = style;
+  // @@protoc_insertion_point(field_set_allocated:protocol.CreateScene.style)
+}
+
+// -------------------------------------------------------------------
+
+// AppendChild
+
+// string parent_uid = 1;
+inline void AppendChild::clear_parent_uid() {
+  _impl_.parent_uid_.ClearToEmpty();
+}
+inline const std::string& AppendChild::parent_uid() const {
+  // @@protoc_insertion_point(field_get:protocol.AppendChild.parent_uid)
+  return _internal_parent_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AppendChild::set_parent_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.parent_uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.AppendChild.parent_uid)
+}
+inline std::string* AppendChild::mutable_parent_uid() {
+  std::string* _s = _internal_mutable_parent_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.AppendChild.parent_uid)
+  return _s;
+}
+inline const std::string& AppendChild::_internal_parent_uid() const {
+  return _impl_.parent_uid_.Get();
+}
+inline void AppendChild::_internal_set_parent_uid(const std::string& value) {
+  
+  _impl_.parent_uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AppendChild::_internal_mutable_parent_uid() {
+  
+  return _impl_.parent_uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AppendChild::release_parent_uid() {
+  // @@protoc_insertion_point(field_release:protocol.AppendChild.parent_uid)
+  return _impl_.parent_uid_.Release();
+}
+inline void AppendChild::set_allocated_parent_uid(std::string* parent_uid) {
+  if (parent_uid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.parent_uid_.SetAllocated(parent_uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.parent_uid_.IsDefault()) {
+    _impl_.parent_uid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.AppendChild.parent_uid)
+}
+
+// string child_uid = 2;
+inline void AppendChild::clear_child_uid() {
+  _impl_.child_uid_.ClearToEmpty();
+}
+inline const std::string& AppendChild::child_uid() const {
+  // @@protoc_insertion_point(field_get:protocol.AppendChild.child_uid)
+  return _internal_child_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AppendChild::set_child_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.child_uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.AppendChild.child_uid)
+}
+inline std::string* AppendChild::mutable_child_uid() {
+  std::string* _s = _internal_mutable_child_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.AppendChild.child_uid)
+  return _s;
+}
+inline const std::string& AppendChild::_internal_child_uid() const {
+  return _impl_.child_uid_.Get();
+}
+inline void AppendChild::_internal_set_child_uid(const std::string& value) {
+  
+  _impl_.child_uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AppendChild::_internal_mutable_child_uid() {
+  
+  return _impl_.child_uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AppendChild::release_child_uid() {
+  // @@protoc_insertion_point(field_release:protocol.AppendChild.child_uid)
+  return _impl_.child_uid_.Release();
+}
+inline void AppendChild::set_allocated_child_uid(std::string* child_uid) {
+  if (child_uid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.child_uid_.SetAllocated(child_uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.child_uid_.IsDefault()) {
+    _impl_.child_uid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.AppendChild.child_uid)
+}
+
+// uint32 parent_handle = 3;
+inline void AppendChild::clear_parent_handle() {
+  _impl_.parent_handle_ = 0u;
+}
+inline uint32_t AppendChild::_internal_parent_handle() const {
+  return _impl_.parent_handle_;
+}
+inline uint32_t AppendChild::parent_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.AppendChild.parent_handle)
+  return _internal_parent_handle();
+}
+inline void AppendChild::_internal_set_parent_handle(uint32_t value) {
+  
+  _impl_.parent_handle_ = value;
+}
+inline void AppendChild::set_parent_handle(uint32_t value) {
+  _internal_set_parent_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.AppendChild.parent_handle)
+}
+
+// uint32 child_handle = 4;
+inline void AppendChild::clear_child_handle() {
+  _impl_.child_handle_ = 0u;
+}
+inline uint32_t AppendChild::_internal_child_handle() const {
+  return _impl_.child_handle_;
+}
+inline uint32_t AppendChild::child_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.AppendChild.child_handle)
+  return _internal_child_handle();
+}
+inline void AppendChild::_internal_set_child_handle(uint32_t value) {
+  
+  _impl_.child_handle_ = value;
+}
+inline void AppendChild::set_child_handle(uint32_t value) {
+  _internal_set_child_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.AppendChild.child_handle)
+}
+
+// -------------------------------------------------------------------
+
+// RemoveChild
+
+// string parent_uid = 1;
+inline void RemoveChild::clear_parent_uid() {
+  _impl_.parent_uid_.ClearToEmpty();
+}
+inline const std::string& RemoveChild::parent_uid() const {
+  // @@protoc_insertion_point(field_get:protocol.RemoveChild.parent_uid)
+  return _internal_parent_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemoveChild::set_parent_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.parent_uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.RemoveChild.parent_uid)
 }
-inline const ::protocol::FindSourceRequest& ClientMessage::find_source() const {
-  // @@protoc_insertion_point(field_get:protocol.ClientMessage.find_source)
-  return _internal_find_source();
+inline std::string* RemoveChild::mutable_parent_uid() {
+  std::string* _s = _internal_mutable_parent_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.RemoveChild.parent_uid)
+  return _s;
 }
-inline ::protocol::FindSourceRequest* ClientMessage::unsafe_arena_release_find_source() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ClientMessage.find_source)
-  if (_internal_has_find_source()) {
-    clear_has_message();
-    ::protocol::FindSourceRequest* temp = message_.find_source_;
-    message_.find_source_ = nullptr;
-    return temp;
+inline const std::string& RemoveChild::_internal_parent_uid() const {
+  return _impl_.parent_uid_.Get();
+}
+inline void RemoveChild::_internal_set_parent_uid(const std::string& value) {
+  
+  _impl_.parent_uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RemoveChild::_internal_mutable_parent_uid() {
+  
+  return _impl_.parent_uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RemoveChild::release_parent_uid() {
+  // @@protoc_insertion_point(field_release:protocol.RemoveChild.parent_uid)
+  return _impl_.parent_uid_.Release();
+}
+inline void RemoveChild::set_allocated_parent_uid(std::string* parent_uid) {
+  if (parent_uid != nullptr) {
+    
   } else {
-    return nullptr;
+    
   }
-}
-inline void ClientMessage::unsafe_arena_set_allocated_find_source(::protocol::FindSourceRequest* find_source) {
-  clear_message();
-  if (find_source) {
-    set_has_find_source();
-    message_.find_source_ = find_source;
+  _impl_.parent_uid_.SetAllocated(parent_uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.parent_uid_.IsDefault()) {
+    _impl_.parent_uid_.Set("", GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ClientMessage.find_source)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.RemoveChild.parent_uid)
 }
-inline ::protocol::FindSourceRequest* ClientMessage::_internal_mutable_find_source() {
-  if (!_internal_has_find_source()) {
-    clear_message();
-    set_has_find_source();
-    message_.find_source_ = CreateMaybeMessage< ::protocol::FindSourceRequest >(GetArena());
+
+// string child_uid = 2;
+inline void RemoveChild::clear_child_uid() {
+  _impl_.child_uid_.ClearToEmpty();
+}
+inline const std::string& RemoveChild::child_uid() const {
+  // @@protoc_insertion_point(field_get:protocol.RemoveChild.child_uid)
+  return _internal_child_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RemoveChild::set_child_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.child_uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.RemoveChild.child_uid)
+}
+inline std::string* RemoveChild::mutable_child_uid() {
+  std::string* _s = _internal_mutable_child_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.RemoveChild.child_uid)
+  return _s;
+}
+inline const std::string& RemoveChild::_internal_child_uid() const {
+  return _impl_.child_uid_.Get();
+}
+inline void RemoveChild::_internal_set_child_uid(const std::string& value) {
+  
+  _impl_.child_uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RemoveChild::_internal_mutable_child_uid() {
+  
+  return _impl_.child_uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RemoveChild::release_child_uid() {
+  // @@protoc_insertion_point(field_release:protocol.RemoveChild.child_uid)
+  return _impl_.child_uid_.Release();
+}
+inline void RemoveChild::set_allocated_child_uid(std::string* child_uid) {
+  if (child_uid != nullptr) {
+    
+  } else {
+    
   }
-  return message_.find_source_;
+  _impl_.child_uid_.SetAllocated(child_uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.child_uid_.IsDefault()) {
+    _impl_.child_uid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.RemoveChild.child_uid)
 }
-inline ::protocol::FindSourceRequest* ClientMessage::mutable_find_source() {
-  // @@protoc_insertion_point(field_mutable:protocol.ClientMessage.find_source)
-  return _internal_mutable_find_source();
+
+// uint32 parent_handle = 3;
+inline void RemoveChild::clear_parent_handle() {
+  _impl_.parent_handle_ = 0u;
+}
+inline uint32_t RemoveChild::_internal_parent_handle() const {
+  return _impl_.parent_handle_;
+}
+inline uint32_t RemoveChild::parent_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.RemoveChild.parent_handle)
+  return _internal_parent_handle();
+}
+inline void RemoveChild::_internal_set_parent_handle(uint32_t value) {
+  
+  _impl_.parent_handle_ = value;
+}
+inline void RemoveChild::set_parent_handle(uint32_t value) {
+  _internal_set_parent_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.RemoveChild.parent_handle)
 }
 
-inline bool ClientMessage::has_message() const {
-  return message_case() != MESSAGE_NOT_SET;
+// uint32 child_handle = 4;
+inline void RemoveChild::clear_child_handle() {
+  _impl_.child_handle_ = 0u;
 }
-inline void ClientMessage::clear_has_message() {
-  _oneof_case_[0] = MESSAGE_NOT_SET;
+inline uint32_t RemoveChild::_internal_child_handle() const {
+  return _impl_.child_handle_;
 }
-inline ClientMessage::MessageCase ClientMessage::message_case() const {
-  return ClientMessage::MessageCase(_oneof_case_[0]);
+inline uint32_t RemoveChild::child_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.RemoveChild.child_handle)
+  return _internal_child_handle();
+}
+inline void RemoveChild::_internal_set_child_handle(uint32_t value) {
+  
+  _impl_.child_handle_ = value;
 }
+inline void RemoveChild::set_child_handle(uint32_t value) {
+  _internal_set_child_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.RemoveChild.child_handle)
+}
+
 // -------------------------------------------------------------------
 
-// ServerMessage
+// CreateTree
 
-// .protocol.Response response = 1;
-inline bool ServerMessage::_internal_has_response() const {
-  return message_case() == kResponse;
+// uint32 parent_handle = 1;
+inline void CreateTree::clear_parent_handle() {
+  _impl_.parent_handle_ = 0u;
 }
-inline bool ServerMessage::has_response() const {
-  return _internal_has_response();
+inline uint32_t CreateTree::_internal_parent_handle() const {
+  return _impl_.parent_handle_;
 }
-inline void ServerMessage::set_has_response() {
-  _oneof_case_[0] = kResponse;
+inline uint32_t CreateTree::parent_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.CreateTree.parent_handle)
+  return _internal_parent_handle();
 }
-inline void ServerMessage::clear_response() {
-  if (_internal_has_response()) {
-    if (GetArena() == nullptr) {
-      delete message_.response_;
+inline void CreateTree::_internal_set_parent_handle(uint32_t value) {
+  
+  _impl_.parent_handle_ = value;
+}
+inline void CreateTree::set_parent_handle(uint32_t value) {
+  _internal_set_parent_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.CreateTree.parent_handle)
+}
+
+// repeated .protocol.TreeNode roots = 2;
+inline int CreateTree::_internal_roots_size() const {
+  return _impl_.roots_.size();
+}
+inline int CreateTree::roots_size() const {
+  return _internal_roots_size();
+}
+inline void CreateTree::clear_roots() {
+  _impl_.roots_.Clear();
+}
+inline ::protocol::TreeNode* CreateTree::mutable_roots(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.CreateTree.roots)
+  return _impl_.roots_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode >*
+CreateTree::mutable_roots() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.CreateTree.roots)
+  return &_impl_.roots_;
+}
+inline const ::protocol::TreeNode& CreateTree::_internal_roots(int index) const {
+  return _impl_.roots_.Get(index);
+}
+inline const ::protocol::TreeNode& CreateTree::roots(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.CreateTree.roots)
+  return _internal_roots(index);
+}
+inline ::protocol::TreeNode* CreateTree::_internal_add_roots() {
+  return _impl_.roots_.Add();
+}
+inline ::protocol::TreeNode* CreateTree::add_roots() {
+  ::protocol::TreeNode* _add = _internal_add_roots();
+  // @@protoc_insertion_point(field_add:protocol.CreateTree.roots)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode >&
+CreateTree::roots() const {
+  // @@protoc_insertion_point(field_list:protocol.CreateTree.roots)
+  return _impl_.roots_;
+}
+
+// -------------------------------------------------------------------
+
+// TreeNode
+
+// .protocol.CreateSource source = 1;
+inline bool TreeNode::_internal_has_source() const {
+  return node_case() == kSource;
+}
+inline bool TreeNode::has_source() const {
+  return _internal_has_source();
+}
+inline void TreeNode::set_has_source() {
+  _impl_._oneof_case_[0] = kSource;
+}
+inline void TreeNode::clear_source() {
+  if (_internal_has_source()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.node_.source_;
     }
-    clear_has_message();
+    clear_has_node();
   }
 }
-inline ::protocol::Response* ServerMessage::release_response() {
-  // @@protoc_insertion_point(field_release:protocol.ServerMessage.response)
-  if (_internal_has_response()) {
-    clear_has_message();
-      ::protocol::Response* temp = message_.response_;
-    if (GetArena() != nullptr) {
+inline ::protocol::CreateSource* TreeNode::release_source() {
+  // @@protoc_insertion_point(field_release:protocol.TreeNode.source)
+  if (_internal_has_source()) {
+    clear_has_node();
+    ::protocol::CreateSource* temp = _impl_.node_.source_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    message_.response_ = nullptr;
+    _impl_.node_.source_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::protocol::Response& ServerMessage::_internal_response() const {
-  return _internal_has_response()
-      ? *message_.response_
-      : *reinterpret_cast< ::protocol::Response*>(&::protocol::_Response_default_instance_);
+inline const ::protocol::CreateSource& TreeNode::_internal_source() const {
+  return _internal_has_source()
+      ? *_impl_.node_.source_
+      : reinterpret_cast< ::protocol::CreateSource&>(::protocol::_CreateSource_default_instance_);
 }
-inline const ::protocol::Response& ServerMessage::response() const {
-  // @@protoc_insertion_point(field_get:protocol.ServerMessage.response)
-  return _internal_response();
+inline const ::protocol::CreateSource& TreeNode::source() const {
+  // @@protoc_insertion_point(field_get:protocol.TreeNode.source)
+  return _internal_source();
 }
-inline ::protocol::Response* ServerMessage::unsafe_arena_release_response() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ServerMessage.response)
-  if (_internal_has_response()) {
-    clear_has_message();
-    ::protocol::Response* temp = message_.response_;
-    message_.response_ = nullptr;
+inline ::protocol::CreateSource* TreeNode::unsafe_arena_release_source() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.TreeNode.source)
+  if (_internal_has_source()) {
+    clear_has_node();
+    ::protocol::CreateSource* temp = _impl_.node_.source_;
+    _impl_.node_.source_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_source(::protocol::CreateSource* source) {
+  clear_node();
+  if (source) {
+    set_has_source();
+    _impl_.node_.source_ = source;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.TreeNode.source)
+}
+inline ::protocol::CreateSource* TreeNode::_internal_mutable_source() {
+  if (!_internal_has_source()) {
+    clear_node();
+    set_has_source();
+    _impl_.node_.source_ = CreateMaybeMessage< ::protocol::CreateSource >(GetArenaForAllocation());
+  }
+  return _impl_.node_.source_;
+}
+inline ::protocol::CreateSource* TreeNode::mutable_source() {
+  ::protocol::CreateSource* _msg = _internal_mutable_source();
+  // @@protoc_insertion_point(field_mutable:protocol.TreeNode.source)
+  return _msg;
+}
+
+// .protocol.CreateScene scene = 2;
+inline bool TreeNode::_internal_has_scene() const {
+  return node_case() == kScene;
+}
+inline bool TreeNode::has_scene() const {
+  return _internal_has_scene();
+}
+inline void TreeNode::set_has_scene() {
+  _impl_._oneof_case_[0] = kScene;
+}
+inline void TreeNode::clear_scene() {
+  if (_internal_has_scene()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.node_.scene_;
+    }
+    clear_has_node();
+  }
+}
+inline ::protocol::CreateScene* TreeNode::release_scene() {
+  // @@protoc_insertion_point(field_release:protocol.TreeNode.scene)
+  if (_internal_has_scene()) {
+    clear_has_node();
+    ::protocol::CreateScene* temp = _impl_.node_.scene_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.node_.scene_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::protocol::CreateScene& TreeNode::_internal_scene() const {
+  return _internal_has_scene()
+      ? *_impl_.node_.scene_
+      : reinterpret_cast< ::protocol::CreateScene&>(::protocol::_CreateScene_default_instance_);
+}
+inline const ::protocol::CreateScene& TreeNode::scene() const {
+  // @@protoc_insertion_point(field_get:protocol.TreeNode.scene)
+  return _internal_scene();
+}
+inline ::protocol::CreateScene* TreeNode::unsafe_arena_release_scene() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.TreeNode.scene)
+  if (_internal_has_scene()) {
+    clear_has_node();
+    ::protocol::CreateScene* temp = _impl_.node_.scene_;
+    _impl_.node_.scene_ = nullptr;
     return temp;
   } else {
-    return nullptr;
+    return nullptr;
+  }
+}
+inline void TreeNode::unsafe_arena_set_allocated_scene(::protocol::CreateScene* scene) {
+  clear_node();
+  if (scene) {
+    set_has_scene();
+    _impl_.node_.scene_ = scene;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.TreeNode.scene)
+}
+inline ::protocol::CreateScene* TreeNode::_internal_mutable_scene() {
+  if (!_internal_has_scene()) {
+    clear_node();
+    set_has_scene();
+    _impl_.node_.scene_ = CreateMaybeMessage< ::protocol::CreateScene >(GetArenaForAllocation());
+  }
+  return _impl_.node_.scene_;
+}
+inline ::protocol::CreateScene* TreeNode::mutable_scene() {
+  ::protocol::CreateScene* _msg = _internal_mutable_scene();
+  // @@protoc_insertion_point(field_mutable:protocol.TreeNode.scene)
+  return _msg;
+}
+
+// repeated .protocol.TreeNode children = 3;
+inline int TreeNode::_internal_children_size() const {
+  return _impl_.children_.size();
+}
+inline int TreeNode::children_size() const {
+  return _internal_children_size();
+}
+inline void TreeNode::clear_children() {
+  _impl_.children_.Clear();
+}
+inline ::protocol::TreeNode* TreeNode::mutable_children(int index) {
+  // @@protoc_insertion_point(field_mutable:protocol.TreeNode.children)
+  return _impl_.children_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode >*
+TreeNode::mutable_children() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.TreeNode.children)
+  return &_impl_.children_;
+}
+inline const ::protocol::TreeNode& TreeNode::_internal_children(int index) const {
+  return _impl_.children_.Get(index);
+}
+inline const ::protocol::TreeNode& TreeNode::children(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.TreeNode.children)
+  return _internal_children(index);
+}
+inline ::protocol::TreeNode* TreeNode::_internal_add_children() {
+  return _impl_.children_.Add();
+}
+inline ::protocol::TreeNode* TreeNode::add_children() {
+  ::protocol::TreeNode* _add = _internal_add_children();
+  // @@protoc_insertion_point(field_add:protocol.TreeNode.children)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::TreeNode >&
+TreeNode::children() const {
+  // @@protoc_insertion_point(field_list:protocol.TreeNode.children)
+  return _impl_.children_;
+}
+
+inline bool TreeNode::has_node() const {
+  return node_case() != NODE_NOT_SET;
+}
+inline void TreeNode::clear_has_node() {
+  _impl_._oneof_case_[0] = NODE_NOT_SET;
+}
+inline TreeNode::NodeCase TreeNode::node_case() const {
+  return TreeNode::NodeCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// InsertBefore
+
+// uint32 parent_handle = 1;
+inline void InsertBefore::clear_parent_handle() {
+  _impl_.parent_handle_ = 0u;
+}
+inline uint32_t InsertBefore::_internal_parent_handle() const {
+  return _impl_.parent_handle_;
+}
+inline uint32_t InsertBefore::parent_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.InsertBefore.parent_handle)
+  return _internal_parent_handle();
+}
+inline void InsertBefore::_internal_set_parent_handle(uint32_t value) {
+  
+  _impl_.parent_handle_ = value;
+}
+inline void InsertBefore::set_parent_handle(uint32_t value) {
+  _internal_set_parent_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.InsertBefore.parent_handle)
+}
+
+// uint32 child_handle = 2;
+inline void InsertBefore::clear_child_handle() {
+  _impl_.child_handle_ = 0u;
+}
+inline uint32_t InsertBefore::_internal_child_handle() const {
+  return _impl_.child_handle_;
+}
+inline uint32_t InsertBefore::child_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.InsertBefore.child_handle)
+  return _internal_child_handle();
+}
+inline void InsertBefore::_internal_set_child_handle(uint32_t value) {
+  
+  _impl_.child_handle_ = value;
+}
+inline void InsertBefore::set_child_handle(uint32_t value) {
+  _internal_set_child_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.InsertBefore.child_handle)
+}
+
+// uint32 before_handle = 3;
+inline void InsertBefore::clear_before_handle() {
+  _impl_.before_handle_ = 0u;
+}
+inline uint32_t InsertBefore::_internal_before_handle() const {
+  return _impl_.before_handle_;
+}
+inline uint32_t InsertBefore::before_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.InsertBefore.before_handle)
+  return _internal_before_handle();
+}
+inline void InsertBefore::_internal_set_before_handle(uint32_t value) {
+  
+  _impl_.before_handle_ = value;
+}
+inline void InsertBefore::set_before_handle(uint32_t value) {
+  _internal_set_before_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.InsertBefore.before_handle)
+}
+
+// -------------------------------------------------------------------
+
+// MoveChild
+
+// uint32 parent_handle = 1;
+inline void MoveChild::clear_parent_handle() {
+  _impl_.parent_handle_ = 0u;
+}
+inline uint32_t MoveChild::_internal_parent_handle() const {
+  return _impl_.parent_handle_;
+}
+inline uint32_t MoveChild::parent_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.MoveChild.parent_handle)
+  return _internal_parent_handle();
+}
+inline void MoveChild::_internal_set_parent_handle(uint32_t value) {
+  
+  _impl_.parent_handle_ = value;
+}
+inline void MoveChild::set_parent_handle(uint32_t value) {
+  _internal_set_parent_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.MoveChild.parent_handle)
+}
+
+// uint32 child_handle = 2;
+inline void MoveChild::clear_child_handle() {
+  _impl_.child_handle_ = 0u;
+}
+inline uint32_t MoveChild::_internal_child_handle() const {
+  return _impl_.child_handle_;
+}
+inline uint32_t MoveChild::child_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.MoveChild.child_handle)
+  return _internal_child_handle();
+}
+inline void MoveChild::_internal_set_child_handle(uint32_t value) {
+  
+  _impl_.child_handle_ = value;
+}
+inline void MoveChild::set_child_handle(uint32_t value) {
+  _internal_set_child_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.MoveChild.child_handle)
+}
+
+// uint32 before_handle = 3;
+inline void MoveChild::clear_before_handle() {
+  _impl_.before_handle_ = 0u;
+}
+inline uint32_t MoveChild::_internal_before_handle() const {
+  return _impl_.before_handle_;
+}
+inline uint32_t MoveChild::before_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.MoveChild.before_handle)
+  return _internal_before_handle();
+}
+inline void MoveChild::_internal_set_before_handle(uint32_t value) {
+  
+  _impl_.before_handle_ = value;
+}
+inline void MoveChild::set_before_handle(uint32_t value) {
+  _internal_set_before_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.MoveChild.before_handle)
+}
+
+// -------------------------------------------------------------------
+
+// CommitUpdates
+
+// string container_uid = 1;
+inline void CommitUpdates::clear_container_uid() {
+  _impl_.container_uid_.ClearToEmpty();
+}
+inline const std::string& CommitUpdates::container_uid() const {
+  // @@protoc_insertion_point(field_get:protocol.CommitUpdates.container_uid)
+  return _internal_container_uid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CommitUpdates::set_container_uid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.container_uid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.CommitUpdates.container_uid)
+}
+inline std::string* CommitUpdates::mutable_container_uid() {
+  std::string* _s = _internal_mutable_container_uid();
+  // @@protoc_insertion_point(field_mutable:protocol.CommitUpdates.container_uid)
+  return _s;
+}
+inline const std::string& CommitUpdates::_internal_container_uid() const {
+  return _impl_.container_uid_.Get();
+}
+inline void CommitUpdates::_internal_set_container_uid(const std::string& value) {
+  
+  _impl_.container_uid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CommitUpdates::_internal_mutable_container_uid() {
+  
+  return _impl_.container_uid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CommitUpdates::release_container_uid() {
+  // @@protoc_insertion_point(field_release:protocol.CommitUpdates.container_uid)
+  return _impl_.container_uid_.Release();
+}
+inline void CommitUpdates::set_allocated_container_uid(std::string* container_uid) {
+  if (container_uid != nullptr) {
+    
+  } else {
+    
   }
-}
-inline void ServerMessage::unsafe_arena_set_allocated_response(::protocol::Response* response) {
-  clear_message();
-  if (response) {
-    set_has_response();
-    message_.response_ = response;
+  _impl_.container_uid_.SetAllocated(container_uid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.container_uid_.IsDefault()) {
+    _impl_.container_uid_.Set("", GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ServerMessage.response)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.CommitUpdates.container_uid)
 }
-inline ::protocol::Response* ServerMessage::_internal_mutable_response() {
-  if (!_internal_has_response()) {
-    clear_message();
-    set_has_response();
-    message_.response_ = CreateMaybeMessage< ::protocol::Response >(GetArena());
-  }
-  return message_.response_;
+
+// uint32 container_handle = 2;
+inline void CommitUpdates::clear_container_handle() {
+  _impl_.container_handle_ = 0u;
 }
-inline ::protocol::Response* ServerMessage::mutable_response() {
-  // @@protoc_insertion_point(field_mutable:protocol.ServerMessage.response)
-  return _internal_mutable_response();
+inline uint32_t CommitUpdates::_internal_container_handle() const {
+  return _impl_.container_handle_;
 }
-
-inline bool ServerMessage::has_message() const {
-  return message_case() != MESSAGE_NOT_SET;
+inline uint32_t CommitUpdates::container_handle() const {
+  // @@protoc_insertion_point(field_get:protocol.CommitUpdates.container_handle)
+  return _internal_container_handle();
 }
-inline void ServerMessage::clear_has_message() {
-  _oneof_case_[0] = MESSAGE_NOT_SET;
+inline void CommitUpdates::_internal_set_container_handle(uint32_t value) {
+  
+  _impl_.container_handle_ = value;
 }
-inline ServerMessage::MessageCase ServerMessage::message_case() const {
-  return ServerMessage::MessageCase(_oneof_case_[0]);
+inline void CommitUpdates::set_container_handle(uint32_t value) {
+  _internal_set_container_handle(value);
+  // @@protoc_insertion_point(field_set:protocol.CommitUpdates.container_handle)
 }
+
 // -------------------------------------------------------------------
 
-// InitRequest
+// DefineKey
 
-// string request_id = 1;
-inline void InitRequest::clear_request_id() {
-  request_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// uint32 id = 1;
+inline void DefineKey::clear_id() {
+  _impl_.id_ = 0u;
 }
-inline const std::string& InitRequest::request_id() const {
-  // @@protoc_insertion_point(field_get:protocol.InitRequest.request_id)
-  return _internal_request_id();
+inline uint32_t DefineKey::_internal_id() const {
+  return _impl_.id_;
 }
-inline void InitRequest::set_request_id(const std::string& value) {
-  _internal_set_request_id(value);
-  // @@protoc_insertion_point(field_set:protocol.InitRequest.request_id)
+inline uint32_t DefineKey::id() const {
+  // @@protoc_insertion_point(field_get:protocol.DefineKey.id)
+  return _internal_id();
 }
-inline std::string* InitRequest::mutable_request_id() {
-  // @@protoc_insertion_point(field_mutable:protocol.InitRequest.request_id)
-  return _internal_mutable_request_id();
+inline void DefineKey::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
 }
-inline const std::string& InitRequest::_internal_request_id() const {
-  return request_id_.Get();
+inline void DefineKey::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:protocol.DefineKey.id)
 }
-inline void InitRequest::_internal_set_request_id(const std::string& value) {
-  
-  request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// string key = 2;
+inline void DefineKey::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline void InitRequest::set_request_id(std::string&& value) {
-  
-  request_id_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.InitRequest.request_id)
+inline const std::string& DefineKey::key() const {
+  // @@protoc_insertion_point(field_get:protocol.DefineKey.key)
+  return _internal_key();
 }
-inline void InitRequest::set_request_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.InitRequest.request_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DefineKey::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.DefineKey.key)
+}
+inline std::string* DefineKey::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:protocol.DefineKey.key)
+  return _s;
 }
-inline void InitRequest::set_request_id(const char* value,
-    size_t size) {
+inline const std::string& DefineKey::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void DefineKey::_internal_set_key(const std::string& value) {
   
-  request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.InitRequest.request_id)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* InitRequest::_internal_mutable_request_id() {
+inline std::string* DefineKey::_internal_mutable_key() {
   
-  return request_id_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* InitRequest::release_request_id() {
-  // @@protoc_insertion_point(field_release:protocol.InitRequest.request_id)
-  return request_id_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* DefineKey::release_key() {
+  // @@protoc_insertion_point(field_release:protocol.DefineKey.key)
+  return _impl_.key_.Release();
 }
-inline void InitRequest::set_allocated_request_id(std::string* request_id) {
-  if (request_id != nullptr) {
+inline void DefineKey::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
     
   } else {
     
   }
-  request_id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), request_id,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.InitRequest.request_id)
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.DefineKey.key)
 }
 
-// string client_id = 2;
-inline void InitRequest::clear_client_id() {
-  client_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// -------------------------------------------------------------------
+
+// DefineString
+
+// uint32 id = 1;
+inline void DefineString::clear_id() {
+  _impl_.id_ = 0u;
 }
-inline const std::string& InitRequest::client_id() const {
-  // @@protoc_insertion_point(field_get:protocol.InitRequest.client_id)
-  return _internal_client_id();
+inline uint32_t DefineString::_internal_id() const {
+  return _impl_.id_;
 }
-inline void InitRequest::set_client_id(const std::string& value) {
-  _internal_set_client_id(value);
-  // @@protoc_insertion_point(field_set:protocol.InitRequest.client_id)
+inline uint32_t DefineString::id() const {
+  // @@protoc_insertion_point(field_get:protocol.DefineString.id)
+  return _internal_id();
 }
-inline std::string* InitRequest::mutable_client_id() {
-  // @@protoc_insertion_point(field_mutable:protocol.InitRequest.client_id)
-  return _internal_mutable_client_id();
+inline void DefineString::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
 }
-inline const std::string& InitRequest::_internal_client_id() const {
-  return client_id_.Get();
+inline void DefineString::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:protocol.DefineString.id)
 }
-inline void InitRequest::_internal_set_client_id(const std::string& value) {
-  
-  client_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// string value = 2;
+inline void DefineString::clear_value() {
+  _impl_.value_.ClearToEmpty();
 }
-inline void InitRequest::set_client_id(std::string&& value) {
-  
-  client_id_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.InitRequest.client_id)
+inline const std::string& DefineString::value() const {
+  // @@protoc_insertion_point(field_get:protocol.DefineString.value)
+  return _internal_value();
 }
-inline void InitRequest::set_client_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  client_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.InitRequest.client_id)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DefineString::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:protocol.DefineString.value)
+}
+inline std::string* DefineString::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:protocol.DefineString.value)
+  return _s;
 }
-inline void InitRequest::set_client_id(const char* value,
-    size_t size) {
+inline const std::string& DefineString::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void DefineString::_internal_set_value(const std::string& value) {
   
-  client_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.InitRequest.client_id)
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline std::string* InitRequest::_internal_mutable_client_id() {
+inline std::string* DefineString::_internal_mutable_value() {
   
-  return client_id_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline std::string* InitRequest::release_client_id() {
-  // @@protoc_insertion_point(field_release:protocol.InitRequest.client_id)
-  return client_id_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* DefineString::release_value() {
+  // @@protoc_insertion_point(field_release:protocol.DefineString.value)
+  return _impl_.value_.Release();
 }
-inline void InitRequest::set_allocated_client_id(std::string* client_id) {
-  if (client_id != nullptr) {
+inline void DefineString::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  client_id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), client_id,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.InitRequest.client_id)
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:protocol.DefineString.value)
 }
 
 // -------------------------------------------------------------------
 
-// Scene
+// Style
 
-// string name = 1;
-inline void Scene::clear_name() {
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// uint64 present = 1;
+inline void Style::clear_present() {
+  _impl_.present_ = uint64_t{0u};
 }
-inline const std::string& Scene::name() const {
-  // @@protoc_insertion_point(field_get:protocol.Scene.name)
-  return _internal_name();
+inline uint64_t Style::_internal_present() const {
+  return _impl_.present_;
 }
-inline void Scene::set_name(const std::string& value) {
-  _internal_set_name(value);
-  // @@protoc_insertion_point(field_set:protocol.Scene.name)
+inline uint64_t Style::present() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.present)
+  return _internal_present();
 }
-inline std::string* Scene::mutable_name() {
-  // @@protoc_insertion_point(field_mutable:protocol.Scene.name)
-  return _internal_mutable_name();
+inline void Style::_internal_set_present(uint64_t value) {
+  
+  _impl_.present_ = value;
 }
-inline const std::string& Scene::_internal_name() const {
-  return name_.Get();
+inline void Style::set_present(uint64_t value) {
+  _internal_set_present(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.present)
 }
-inline void Scene::_internal_set_name(const std::string& value) {
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// bool patch = 34;
+inline void Style::clear_patch() {
+  _impl_.patch_ = false;
 }
-inline void Scene::set_name(std::string&& value) {
-  
-  name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.Scene.name)
+inline bool Style::_internal_patch() const {
+  return _impl_.patch_;
 }
-inline void Scene::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.Scene.name)
+inline bool Style::patch() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.patch)
+  return _internal_patch();
 }
-inline void Scene::set_name(const char* value,
-    size_t size) {
+inline void Style::_internal_set_patch(bool value) {
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.Scene.name)
+  _impl_.patch_ = value;
 }
-inline std::string* Scene::_internal_mutable_name() {
-  
-  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void Style::set_patch(bool value) {
+  _internal_set_patch(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.patch)
 }
-inline std::string* Scene::release_name() {
-  // @@protoc_insertion_point(field_release:protocol.Scene.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+
+// uint64 unset = 35;
+inline void Style::clear_unset() {
+  _impl_.unset_ = uint64_t{0u};
 }
-inline void Scene::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.Scene.name)
+inline uint64_t Style::_internal_unset() const {
+  return _impl_.unset_;
+}
+inline uint64_t Style::unset() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.unset)
+  return _internal_unset();
+}
+inline void Style::_internal_set_unset(uint64_t value) {
+  
+  _impl_.unset_ = value;
+}
+inline void Style::set_unset(uint64_t value) {
+  _internal_set_unset(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.unset)
 }
 
-// -------------------------------------------------------------------
+// .protocol.FlexDirection flex_direction = 2;
+inline void Style::clear_flex_direction() {
+  _impl_.flex_direction_ = 0;
+}
+inline ::protocol::FlexDirection Style::_internal_flex_direction() const {
+  return static_cast< ::protocol::FlexDirection >(_impl_.flex_direction_);
+}
+inline ::protocol::FlexDirection Style::flex_direction() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.flex_direction)
+  return _internal_flex_direction();
+}
+inline void Style::_internal_set_flex_direction(::protocol::FlexDirection value) {
+  
+  _impl_.flex_direction_ = value;
+}
+inline void Style::set_flex_direction(::protocol::FlexDirection value) {
+  _internal_set_flex_direction(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.flex_direction)
+}
 
-// ApplyUpdate
+// .protocol.Direction direction = 3;
+inline void Style::clear_direction() {
+  _impl_.direction_ = 0;
+}
+inline ::protocol::Direction Style::_internal_direction() const {
+  return static_cast< ::protocol::Direction >(_impl_.direction_);
+}
+inline ::protocol::Direction Style::direction() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.direction)
+  return _internal_direction();
+}
+inline void Style::_internal_set_direction(::protocol::Direction value) {
+  
+  _impl_.direction_ = value;
+}
+inline void Style::set_direction(::protocol::Direction value) {
+  _internal_set_direction(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.direction)
+}
 
-// .protocol.CreateSource create_source = 1;
-inline bool ApplyUpdate::_internal_has_create_source() const {
-  return change_case() == kCreateSource;
+// .protocol.Justify justify_content = 4;
+inline void Style::clear_justify_content() {
+  _impl_.justify_content_ = 0;
 }
-inline bool ApplyUpdate::has_create_source() const {
-  return _internal_has_create_source();
+inline ::protocol::Justify Style::_internal_justify_content() const {
+  return static_cast< ::protocol::Justify >(_impl_.justify_content_);
 }
-inline void ApplyUpdate::set_has_create_source() {
-  _oneof_case_[0] = kCreateSource;
+inline ::protocol::Justify Style::justify_content() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.justify_content)
+  return _internal_justify_content();
 }
-inline void ApplyUpdate::clear_create_source() {
-  if (_internal_has_create_source()) {
-    if (GetArena() == nullptr) {
-      delete change_.create_source_;
-    }
-    clear_has_change();
-  }
+inline void Style::_internal_set_justify_content(::protocol::Justify value) {
+  
+  _impl_.justify_content_ = value;
 }
-inline ::protocol::CreateSource* ApplyUpdate::release_create_source() {
-  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.create_source)
-  if (_internal_has_create_source()) {
-    clear_has_change();
-      ::protocol::CreateSource* temp = change_.create_source_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    change_.create_source_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void Style::set_justify_content(::protocol::Justify value) {
+  _internal_set_justify_content(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.justify_content)
 }
-inline const ::protocol::CreateSource& ApplyUpdate::_internal_create_source() const {
-  return _internal_has_create_source()
-      ? *change_.create_source_
-      : *reinterpret_cast< ::protocol::CreateSource*>(&::protocol::_CreateSource_default_instance_);
+
+// .protocol.Align align_content = 5;
+inline void Style::clear_align_content() {
+  _impl_.align_content_ = 0;
 }
-inline const ::protocol::CreateSource& ApplyUpdate::create_source() const {
-  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.create_source)
-  return _internal_create_source();
+inline ::protocol::Align Style::_internal_align_content() const {
+  return static_cast< ::protocol::Align >(_impl_.align_content_);
 }
-inline ::protocol::CreateSource* ApplyUpdate::unsafe_arena_release_create_source() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.create_source)
-  if (_internal_has_create_source()) {
-    clear_has_change();
-    ::protocol::CreateSource* temp = change_.create_source_;
-    change_.create_source_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline ::protocol::Align Style::align_content() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.align_content)
+  return _internal_align_content();
 }
-inline void ApplyUpdate::unsafe_arena_set_allocated_create_source(::protocol::CreateSource* create_source) {
-  clear_change();
-  if (create_source) {
-    set_has_create_source();
-    change_.create_source_ = create_source;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.create_source)
+inline void Style::_internal_set_align_content(::protocol::Align value) {
+  
+  _impl_.align_content_ = value;
 }
-inline ::protocol::CreateSource* ApplyUpdate::_internal_mutable_create_source() {
-  if (!_internal_has_create_source()) {
-    clear_change();
-    set_has_create_source();
-    change_.create_source_ = CreateMaybeMessage< ::protocol::CreateSource >(GetArena());
-  }
-  return change_.create_source_;
+inline void Style::set_align_content(::protocol::Align value) {
+  _internal_set_align_content(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.align_content)
 }
-inline ::protocol::CreateSource* ApplyUpdate::mutable_create_source() {
-  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.create_source)
-  return _internal_mutable_create_source();
+
+// .protocol.Align align_items = 6;
+inline void Style::clear_align_items() {
+  _impl_.align_items_ = 0;
+}
+inline ::protocol::Align Style::_internal_align_items() const {
+  return static_cast< ::protocol::Align >(_impl_.align_items_);
+}
+inline ::protocol::Align Style::align_items() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.align_items)
+  return _internal_align_items();
+}
+inline void Style::_internal_set_align_items(::protocol::Align value) {
+  
+  _impl_.align_items_ = value;
+}
+inline void Style::set_align_items(::protocol::Align value) {
+  _internal_set_align_items(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.align_items)
 }
 
-// .protocol.UpdateSource update_source = 3;
-inline bool ApplyUpdate::_internal_has_update_source() const {
-  return change_case() == kUpdateSource;
+// .protocol.Align align_self = 7;
+inline void Style::clear_align_self() {
+  _impl_.align_self_ = 0;
 }
-inline bool ApplyUpdate::has_update_source() const {
-  return _internal_has_update_source();
+inline ::protocol::Align Style::_internal_align_self() const {
+  return static_cast< ::protocol::Align >(_impl_.align_self_);
 }
-inline void ApplyUpdate::set_has_update_source() {
-  _oneof_case_[0] = kUpdateSource;
+inline ::protocol::Align Style::align_self() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.align_self)
+  return _internal_align_self();
 }
-inline void ApplyUpdate::clear_update_source() {
-  if (_internal_has_update_source()) {
-    if (GetArena() == nullptr) {
-      delete change_.update_source_;
-    }
-    clear_has_change();
-  }
+inline void Style::_internal_set_align_self(::protocol::Align value) {
+  
+  _impl_.align_self_ = value;
 }
-inline ::protocol::UpdateSource* ApplyUpdate::release_update_source() {
-  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.update_source)
-  if (_internal_has_update_source()) {
-    clear_has_change();
-      ::protocol::UpdateSource* temp = change_.update_source_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    change_.update_source_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void Style::set_align_self(::protocol::Align value) {
+  _internal_set_align_self(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.align_self)
 }
-inline const ::protocol::UpdateSource& ApplyUpdate::_internal_update_source() const {
-  return _internal_has_update_source()
-      ? *change_.update_source_
-      : *reinterpret_cast< ::protocol::UpdateSource*>(&::protocol::_UpdateSource_default_instance_);
+
+// .protocol.PositionType position = 8;
+inline void Style::clear_position() {
+  _impl_.position_ = 0;
 }
-inline const ::protocol::UpdateSource& ApplyUpdate::update_source() const {
-  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.update_source)
-  return _internal_update_source();
+inline ::protocol::PositionType Style::_internal_position() const {
+  return static_cast< ::protocol::PositionType >(_impl_.position_);
 }
-inline ::protocol::UpdateSource* ApplyUpdate::unsafe_arena_release_update_source() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.update_source)
-  if (_internal_has_update_source()) {
-    clear_has_change();
-    ::protocol::UpdateSource* temp = change_.update_source_;
-    change_.update_source_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline ::protocol::PositionType Style::position() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.position)
+  return _internal_position();
 }
-inline void ApplyUpdate::unsafe_arena_set_allocated_update_source(::protocol::UpdateSource* update_source) {
-  clear_change();
-  if (update_source) {
-    set_has_update_source();
-    change_.update_source_ = update_source;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.update_source)
+inline void Style::_internal_set_position(::protocol::PositionType value) {
+  
+  _impl_.position_ = value;
 }
-inline ::protocol::UpdateSource* ApplyUpdate::_internal_mutable_update_source() {
-  if (!_internal_has_update_source()) {
-    clear_change();
-    set_has_update_source();
-    change_.update_source_ = CreateMaybeMessage< ::protocol::UpdateSource >(GetArena());
-  }
-  return change_.update_source_;
+inline void Style::set_position(::protocol::PositionType value) {
+  _internal_set_position(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.position)
 }
-inline ::protocol::UpdateSource* ApplyUpdate::mutable_update_source() {
-  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.update_source)
-  return _internal_mutable_update_source();
+
+// .protocol.Wrap flex_wrap = 9;
+inline void Style::clear_flex_wrap() {
+  _impl_.flex_wrap_ = 0;
+}
+inline ::protocol::Wrap Style::_internal_flex_wrap() const {
+  return static_cast< ::protocol::Wrap >(_impl_.flex_wrap_);
+}
+inline ::protocol::Wrap Style::flex_wrap() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.flex_wrap)
+  return _internal_flex_wrap();
+}
+inline void Style::_internal_set_flex_wrap(::protocol::Wrap value) {
+  
+  _impl_.flex_wrap_ = value;
+}
+inline void Style::set_flex_wrap(::protocol::Wrap value) {
+  _internal_set_flex_wrap(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.flex_wrap)
 }
 
-// .protocol.CreateScene create_scene = 5;
-inline bool ApplyUpdate::_internal_has_create_scene() const {
-  return change_case() == kCreateScene;
+// .protocol.Overflow overflow = 10;
+inline void Style::clear_overflow() {
+  _impl_.overflow_ = 0;
 }
-inline bool ApplyUpdate::has_create_scene() const {
-  return _internal_has_create_scene();
+inline ::protocol::Overflow Style::_internal_overflow() const {
+  return static_cast< ::protocol::Overflow >(_impl_.overflow_);
+}
+inline ::protocol::Overflow Style::overflow() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.overflow)
+  return _internal_overflow();
+}
+inline void Style::_internal_set_overflow(::protocol::Overflow value) {
+  
+  _impl_.overflow_ = value;
+}
+inline void Style::set_overflow(::protocol::Overflow value) {
+  _internal_set_overflow(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.overflow)
+}
+
+// .protocol.Display display = 11;
+inline void Style::clear_display() {
+  _impl_.display_ = 0;
 }
-inline void ApplyUpdate::set_has_create_scene() {
-  _oneof_case_[0] = kCreateScene;
+inline ::protocol::Display Style::_internal_display() const {
+  return static_cast< ::protocol::Display >(_impl_.display_);
 }
-inline void ApplyUpdate::clear_create_scene() {
-  if (_internal_has_create_scene()) {
-    if (GetArena() == nullptr) {
-      delete change_.create_scene_;
-    }
-    clear_has_change();
-  }
+inline ::protocol::Display Style::display() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.display)
+  return _internal_display();
 }
-inline ::protocol::CreateScene* ApplyUpdate::release_create_scene() {
-  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.create_scene)
-  if (_internal_has_create_scene()) {
-    clear_has_change();
-      ::protocol::CreateScene* temp = change_.create_scene_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    change_.create_scene_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void Style::_internal_set_display(::protocol::Display value) {
+  
+  _impl_.display_ = value;
 }
-inline const ::protocol::CreateScene& ApplyUpdate::_internal_create_scene() const {
-  return _internal_has_create_scene()
-      ? *change_.create_scene_
-      : *reinterpret_cast< ::protocol::CreateScene*>(&::protocol::_CreateScene_default_instance_);
+inline void Style::set_display(::protocol::Display value) {
+  _internal_set_display(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.display)
 }
-inline const ::protocol::CreateScene& ApplyUpdate::create_scene() const {
-  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.create_scene)
-  return _internal_create_scene();
+
+// float flex_grow = 12;
+inline void Style::clear_flex_grow() {
+  _impl_.flex_grow_ = 0;
 }
-inline ::protocol::CreateScene* ApplyUpdate::unsafe_arena_release_create_scene() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.create_scene)
-  if (_internal_has_create_scene()) {
-    clear_has_change();
-    ::protocol::CreateScene* temp = change_.create_scene_;
-    change_.create_scene_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline float Style::_internal_flex_grow() const {
+  return _impl_.flex_grow_;
 }
-inline void ApplyUpdate::unsafe_arena_set_allocated_create_scene(::protocol::CreateScene* create_scene) {
-  clear_change();
-  if (create_scene) {
-    set_has_create_scene();
-    change_.create_scene_ = create_scene;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.create_scene)
+inline float Style::flex_grow() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.flex_grow)
+  return _internal_flex_grow();
 }
-inline ::protocol::CreateScene* ApplyUpdate::_internal_mutable_create_scene() {
-  if (!_internal_has_create_scene()) {
-    clear_change();
-    set_has_create_scene();
-    change_.create_scene_ = CreateMaybeMessage< ::protocol::CreateScene >(GetArena());
-  }
-  return change_.create_scene_;
+inline void Style::_internal_set_flex_grow(float value) {
+  
+  _impl_.flex_grow_ = value;
 }
-inline ::protocol::CreateScene* ApplyUpdate::mutable_create_scene() {
-  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.create_scene)
-  return _internal_mutable_create_scene();
+inline void Style::set_flex_grow(float value) {
+  _internal_set_flex_grow(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.flex_grow)
 }
 
-// .protocol.AppendChild append_child = 2;
-inline bool ApplyUpdate::_internal_has_append_child() const {
-  return change_case() == kAppendChild;
+// float flex_shrink = 13;
+inline void Style::clear_flex_shrink() {
+  _impl_.flex_shrink_ = 0;
 }
-inline bool ApplyUpdate::has_append_child() const {
-  return _internal_has_append_child();
+inline float Style::_internal_flex_shrink() const {
+  return _impl_.flex_shrink_;
 }
-inline void ApplyUpdate::set_has_append_child() {
-  _oneof_case_[0] = kAppendChild;
+inline float Style::flex_shrink() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.flex_shrink)
+  return _internal_flex_shrink();
 }
-inline void ApplyUpdate::clear_append_child() {
-  if (_internal_has_append_child()) {
-    if (GetArena() == nullptr) {
-      delete change_.append_child_;
-    }
-    clear_has_change();
-  }
+inline void Style::_internal_set_flex_shrink(float value) {
+  
+  _impl_.flex_shrink_ = value;
 }
-inline ::protocol::AppendChild* ApplyUpdate::release_append_child() {
-  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.append_child)
-  if (_internal_has_append_child()) {
-    clear_has_change();
-      ::protocol::AppendChild* temp = change_.append_child_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-    }
-    change_.append_child_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
-  }
+inline void Style::set_flex_shrink(float value) {
+  _internal_set_flex_shrink(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.flex_shrink)
 }
-inline const ::protocol::AppendChild& ApplyUpdate::_internal_append_child() const {
-  return _internal_has_append_child()
-      ? *change_.append_child_
-      : *reinterpret_cast< ::protocol::AppendChild*>(&::protocol::_AppendChild_default_instance_);
+
+// .protocol.Dimension flex_basis = 14;
+inline bool Style::_internal_has_flex_basis() const {
+  return this != internal_default_instance() && _impl_.flex_basis_ != nullptr;
 }
-inline const ::protocol::AppendChild& ApplyUpdate::append_child() const {
-  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.append_child)
-  return _internal_append_child();
+inline bool Style::has_flex_basis() const {
+  return _internal_has_flex_basis();
 }
-inline ::protocol::AppendChild* ApplyUpdate::unsafe_arena_release_append_child() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.append_child)
-  if (_internal_has_append_child()) {
-    clear_has_change();
-    ::protocol::AppendChild* temp = change_.append_child_;
-    change_.append_child_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
+inline void Style::clear_flex_basis() {
+  if (GetArenaForAllocation() == nullptr && _impl_.flex_basis_ != nullptr) {
+    delete _impl_.flex_basis_;
   }
+  _impl_.flex_basis_ = nullptr;
 }
-inline void ApplyUpdate::unsafe_arena_set_allocated_append_child(::protocol::AppendChild* append_child) {
-  clear_change();
-  if (append_child) {
-    set_has_append_child();
-    change_.append_child_ = append_child;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.append_child)
+inline const ::protocol::Dimension& Style::_internal_flex_basis() const {
+  const ::protocol::Dimension* p = _impl_.flex_basis_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline ::protocol::AppendChild* ApplyUpdate::_internal_mutable_append_child() {
-  if (!_internal_has_append_child()) {
-    clear_change();
-    set_has_append_child();
-    change_.append_child_ = CreateMaybeMessage< ::protocol::AppendChild >(GetArena());
+inline const ::protocol::Dimension& Style::flex_basis() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.flex_basis)
+  return _internal_flex_basis();
+}
+inline void Style::unsafe_arena_set_allocated_flex_basis(
+    ::protocol::Dimension* flex_basis) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.flex_basis_);
+  }
+  _impl_.flex_basis_ = flex_basis;
+  if (flex_basis) {
+    
+  } else {
+    
   }
-  return change_.append_child_;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.flex_basis)
 }
-inline ::protocol::AppendChild* ApplyUpdate::mutable_append_child() {
-  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.append_child)
-  return _internal_mutable_append_child();
+inline ::protocol::Dimension* Style::release_flex_basis() {
+  
+  ::protocol::Dimension* temp = _impl_.flex_basis_;
+  _impl_.flex_basis_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-
-// .protocol.RemoveChild remove_child = 4;
-inline bool ApplyUpdate::_internal_has_remove_child() const {
-  return change_case() == kRemoveChild;
+inline ::protocol::Dimension* Style::unsafe_arena_release_flex_basis() {
+  // @@protoc_insertion_point(field_release:protocol.Style.flex_basis)
+  
+  ::protocol::Dimension* temp = _impl_.flex_basis_;
+  _impl_.flex_basis_ = nullptr;
+  return temp;
 }
-inline bool ApplyUpdate::has_remove_child() const {
-  return _internal_has_remove_child();
+inline ::protocol::Dimension* Style::_internal_mutable_flex_basis() {
+  
+  if (_impl_.flex_basis_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.flex_basis_ = p;
+  }
+  return _impl_.flex_basis_;
 }
-inline void ApplyUpdate::set_has_remove_child() {
-  _oneof_case_[0] = kRemoveChild;
+inline ::protocol::Dimension* Style::mutable_flex_basis() {
+  ::protocol::Dimension* _msg = _internal_mutable_flex_basis();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.flex_basis)
+  return _msg;
 }
-inline void ApplyUpdate::clear_remove_child() {
-  if (_internal_has_remove_child()) {
-    if (GetArena() == nullptr) {
-      delete change_.remove_child_;
-    }
-    clear_has_change();
+inline void Style::set_allocated_flex_basis(::protocol::Dimension* flex_basis) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.flex_basis_;
   }
-}
-inline ::protocol::RemoveChild* ApplyUpdate::release_remove_child() {
-  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.remove_child)
-  if (_internal_has_remove_child()) {
-    clear_has_change();
-      ::protocol::RemoveChild* temp = change_.remove_child_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (flex_basis) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(flex_basis);
+    if (message_arena != submessage_arena) {
+      flex_basis = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, flex_basis, submessage_arena);
     }
-    change_.remove_child_ = nullptr;
-    return temp;
+    
   } else {
-    return nullptr;
+    
   }
+  _impl_.flex_basis_ = flex_basis;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.flex_basis)
 }
-inline const ::protocol::RemoveChild& ApplyUpdate::_internal_remove_child() const {
-  return _internal_has_remove_child()
-      ? *change_.remove_child_
-      : *reinterpret_cast< ::protocol::RemoveChild*>(&::protocol::_RemoveChild_default_instance_);
+
+// .protocol.Dimension top = 15;
+inline bool Style::_internal_has_top() const {
+  return this != internal_default_instance() && _impl_.top_ != nullptr;
 }
-inline const ::protocol::RemoveChild& ApplyUpdate::remove_child() const {
-  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.remove_child)
-  return _internal_remove_child();
+inline bool Style::has_top() const {
+  return _internal_has_top();
 }
-inline ::protocol::RemoveChild* ApplyUpdate::unsafe_arena_release_remove_child() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.remove_child)
-  if (_internal_has_remove_child()) {
-    clear_has_change();
-    ::protocol::RemoveChild* temp = change_.remove_child_;
-    change_.remove_child_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
+inline void Style::clear_top() {
+  if (GetArenaForAllocation() == nullptr && _impl_.top_ != nullptr) {
+    delete _impl_.top_;
   }
+  _impl_.top_ = nullptr;
 }
-inline void ApplyUpdate::unsafe_arena_set_allocated_remove_child(::protocol::RemoveChild* remove_child) {
-  clear_change();
-  if (remove_child) {
-    set_has_remove_child();
-    change_.remove_child_ = remove_child;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.remove_child)
+inline const ::protocol::Dimension& Style::_internal_top() const {
+  const ::protocol::Dimension* p = _impl_.top_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline ::protocol::RemoveChild* ApplyUpdate::_internal_mutable_remove_child() {
-  if (!_internal_has_remove_child()) {
-    clear_change();
-    set_has_remove_child();
-    change_.remove_child_ = CreateMaybeMessage< ::protocol::RemoveChild >(GetArena());
+inline const ::protocol::Dimension& Style::top() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.top)
+  return _internal_top();
+}
+inline void Style::unsafe_arena_set_allocated_top(
+    ::protocol::Dimension* top) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.top_);
+  }
+  _impl_.top_ = top;
+  if (top) {
+    
+  } else {
+    
   }
-  return change_.remove_child_;
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.top)
 }
-inline ::protocol::RemoveChild* ApplyUpdate::mutable_remove_child() {
-  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.remove_child)
-  return _internal_mutable_remove_child();
+inline ::protocol::Dimension* Style::release_top() {
+  
+  ::protocol::Dimension* temp = _impl_.top_;
+  _impl_.top_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-
-// .protocol.CommitUpdates commit_updates = 6;
-inline bool ApplyUpdate::_internal_has_commit_updates() const {
-  return change_case() == kCommitUpdates;
+inline ::protocol::Dimension* Style::unsafe_arena_release_top() {
+  // @@protoc_insertion_point(field_release:protocol.Style.top)
+  
+  ::protocol::Dimension* temp = _impl_.top_;
+  _impl_.top_ = nullptr;
+  return temp;
 }
-inline bool ApplyUpdate::has_commit_updates() const {
-  return _internal_has_commit_updates();
+inline ::protocol::Dimension* Style::_internal_mutable_top() {
+  
+  if (_impl_.top_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.top_ = p;
+  }
+  return _impl_.top_;
 }
-inline void ApplyUpdate::set_has_commit_updates() {
-  _oneof_case_[0] = kCommitUpdates;
+inline ::protocol::Dimension* Style::mutable_top() {
+  ::protocol::Dimension* _msg = _internal_mutable_top();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.top)
+  return _msg;
 }
-inline void ApplyUpdate::clear_commit_updates() {
-  if (_internal_has_commit_updates()) {
-    if (GetArena() == nullptr) {
-      delete change_.commit_updates_;
-    }
-    clear_has_change();
+inline void Style::set_allocated_top(::protocol::Dimension* top) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.top_;
   }
-}
-inline ::protocol::CommitUpdates* ApplyUpdate::release_commit_updates() {
-  // @@protoc_insertion_point(field_release:protocol.ApplyUpdate.commit_updates)
-  if (_internal_has_commit_updates()) {
-    clear_has_change();
-      ::protocol::CommitUpdates* temp = change_.commit_updates_;
-    if (GetArena() != nullptr) {
-      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (top) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(top);
+    if (message_arena != submessage_arena) {
+      top = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, top, submessage_arena);
     }
-    change_.commit_updates_ = nullptr;
-    return temp;
+    
   } else {
-    return nullptr;
+    
   }
+  _impl_.top_ = top;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.top)
 }
-inline const ::protocol::CommitUpdates& ApplyUpdate::_internal_commit_updates() const {
-  return _internal_has_commit_updates()
-      ? *change_.commit_updates_
-      : *reinterpret_cast< ::protocol::CommitUpdates*>(&::protocol::_CommitUpdates_default_instance_);
+
+// .protocol.Dimension left = 16;
+inline bool Style::_internal_has_left() const {
+  return this != internal_default_instance() && _impl_.left_ != nullptr;
 }
-inline const ::protocol::CommitUpdates& ApplyUpdate::commit_updates() const {
-  // @@protoc_insertion_point(field_get:protocol.ApplyUpdate.commit_updates)
-  return _internal_commit_updates();
+inline bool Style::has_left() const {
+  return _internal_has_left();
 }
-inline ::protocol::CommitUpdates* ApplyUpdate::unsafe_arena_release_commit_updates() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:protocol.ApplyUpdate.commit_updates)
-  if (_internal_has_commit_updates()) {
-    clear_has_change();
-    ::protocol::CommitUpdates* temp = change_.commit_updates_;
-    change_.commit_updates_ = nullptr;
-    return temp;
-  } else {
-    return nullptr;
+inline void Style::clear_left() {
+  if (GetArenaForAllocation() == nullptr && _impl_.left_ != nullptr) {
+    delete _impl_.left_;
   }
+  _impl_.left_ = nullptr;
 }
-inline void ApplyUpdate::unsafe_arena_set_allocated_commit_updates(::protocol::CommitUpdates* commit_updates) {
-  clear_change();
-  if (commit_updates) {
-    set_has_commit_updates();
-    change_.commit_updates_ = commit_updates;
+inline const ::protocol::Dimension& Style::_internal_left() const {
+  const ::protocol::Dimension* p = _impl_.left_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
+}
+inline const ::protocol::Dimension& Style::left() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.left)
+  return _internal_left();
+}
+inline void Style::unsafe_arena_set_allocated_left(
+    ::protocol::Dimension* left) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.left_);
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.ApplyUpdate.commit_updates)
+  _impl_.left_ = left;
+  if (left) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.left)
 }
-inline ::protocol::CommitUpdates* ApplyUpdate::_internal_mutable_commit_updates() {
-  if (!_internal_has_commit_updates()) {
-    clear_change();
-    set_has_commit_updates();
-    change_.commit_updates_ = CreateMaybeMessage< ::protocol::CommitUpdates >(GetArena());
+inline ::protocol::Dimension* Style::release_left() {
+  
+  ::protocol::Dimension* temp = _impl_.left_;
+  _impl_.left_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
-  return change_.commit_updates_;
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::protocol::CommitUpdates* ApplyUpdate::mutable_commit_updates() {
-  // @@protoc_insertion_point(field_mutable:protocol.ApplyUpdate.commit_updates)
-  return _internal_mutable_commit_updates();
+inline ::protocol::Dimension* Style::unsafe_arena_release_left() {
+  // @@protoc_insertion_point(field_release:protocol.Style.left)
+  
+  ::protocol::Dimension* temp = _impl_.left_;
+  _impl_.left_ = nullptr;
+  return temp;
 }
-
-inline bool ApplyUpdate::has_change() const {
-  return change_case() != CHANGE_NOT_SET;
+inline ::protocol::Dimension* Style::_internal_mutable_left() {
+  
+  if (_impl_.left_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.left_ = p;
+  }
+  return _impl_.left_;
 }
-inline void ApplyUpdate::clear_has_change() {
-  _oneof_case_[0] = CHANGE_NOT_SET;
+inline ::protocol::Dimension* Style::mutable_left() {
+  ::protocol::Dimension* _msg = _internal_mutable_left();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.left)
+  return _msg;
 }
-inline ApplyUpdate::ChangeCase ApplyUpdate::change_case() const {
-  return ApplyUpdate::ChangeCase(_oneof_case_[0]);
+inline void Style::set_allocated_left(::protocol::Dimension* left) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.left_;
+  }
+  if (left) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(left);
+    if (message_arena != submessage_arena) {
+      left = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, left, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.left_ = left;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.left)
 }
-// -------------------------------------------------------------------
 
-// FindSourceRequest
-
-// string request_id = 1;
-inline void FindSourceRequest::clear_request_id() {
-  request_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// .protocol.Dimension right = 17;
+inline bool Style::_internal_has_right() const {
+  return this != internal_default_instance() && _impl_.right_ != nullptr;
 }
-inline const std::string& FindSourceRequest::request_id() const {
-  // @@protoc_insertion_point(field_get:protocol.FindSourceRequest.request_id)
-  return _internal_request_id();
-}
-inline void FindSourceRequest::set_request_id(const std::string& value) {
-  _internal_set_request_id(value);
-  // @@protoc_insertion_point(field_set:protocol.FindSourceRequest.request_id)
+inline bool Style::has_right() const {
+  return _internal_has_right();
 }
-inline std::string* FindSourceRequest::mutable_request_id() {
-  // @@protoc_insertion_point(field_mutable:protocol.FindSourceRequest.request_id)
-  return _internal_mutable_request_id();
+inline void Style::clear_right() {
+  if (GetArenaForAllocation() == nullptr && _impl_.right_ != nullptr) {
+    delete _impl_.right_;
+  }
+  _impl_.right_ = nullptr;
 }
-inline const std::string& FindSourceRequest::_internal_request_id() const {
-  return request_id_.Get();
+inline const ::protocol::Dimension& Style::_internal_right() const {
+  const ::protocol::Dimension* p = _impl_.right_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void FindSourceRequest::_internal_set_request_id(const std::string& value) {
-  
-  request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::right() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.right)
+  return _internal_right();
 }
-inline void FindSourceRequest::set_request_id(std::string&& value) {
-  
-  request_id_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.FindSourceRequest.request_id)
+inline void Style::unsafe_arena_set_allocated_right(
+    ::protocol::Dimension* right) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.right_);
+  }
+  _impl_.right_ = right;
+  if (right) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.right)
 }
-inline void FindSourceRequest::set_request_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_right() {
   
-  request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.FindSourceRequest.request_id)
+  ::protocol::Dimension* temp = _impl_.right_;
+  _impl_.right_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void FindSourceRequest::set_request_id(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_right() {
+  // @@protoc_insertion_point(field_release:protocol.Style.right)
   
-  request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.FindSourceRequest.request_id)
+  ::protocol::Dimension* temp = _impl_.right_;
+  _impl_.right_ = nullptr;
+  return temp;
 }
-inline std::string* FindSourceRequest::_internal_mutable_request_id() {
+inline ::protocol::Dimension* Style::_internal_mutable_right() {
   
-  return request_id_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.right_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.right_ = p;
+  }
+  return _impl_.right_;
 }
-inline std::string* FindSourceRequest::release_request_id() {
-  // @@protoc_insertion_point(field_release:protocol.FindSourceRequest.request_id)
-  return request_id_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_right() {
+  ::protocol::Dimension* _msg = _internal_mutable_right();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.right)
+  return _msg;
 }
-inline void FindSourceRequest::set_allocated_request_id(std::string* request_id) {
-  if (request_id != nullptr) {
+inline void Style::set_allocated_right(::protocol::Dimension* right) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.right_;
+  }
+  if (right) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(right);
+    if (message_arena != submessage_arena) {
+      right = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, right, submessage_arena);
+    }
     
   } else {
     
   }
-  request_id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), request_id,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.FindSourceRequest.request_id)
+  _impl_.right_ = right;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.right)
 }
 
-// string uid = 2;
-inline void FindSourceRequest::clear_uid() {
-  uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& FindSourceRequest::uid() const {
-  // @@protoc_insertion_point(field_get:protocol.FindSourceRequest.uid)
-  return _internal_uid();
+// .protocol.Dimension bottom = 18;
+inline bool Style::_internal_has_bottom() const {
+  return this != internal_default_instance() && _impl_.bottom_ != nullptr;
 }
-inline void FindSourceRequest::set_uid(const std::string& value) {
-  _internal_set_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.FindSourceRequest.uid)
+inline bool Style::has_bottom() const {
+  return _internal_has_bottom();
 }
-inline std::string* FindSourceRequest::mutable_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.FindSourceRequest.uid)
-  return _internal_mutable_uid();
+inline void Style::clear_bottom() {
+  if (GetArenaForAllocation() == nullptr && _impl_.bottom_ != nullptr) {
+    delete _impl_.bottom_;
+  }
+  _impl_.bottom_ = nullptr;
 }
-inline const std::string& FindSourceRequest::_internal_uid() const {
-  return uid_.Get();
+inline const ::protocol::Dimension& Style::_internal_bottom() const {
+  const ::protocol::Dimension* p = _impl_.bottom_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void FindSourceRequest::_internal_set_uid(const std::string& value) {
-  
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::bottom() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.bottom)
+  return _internal_bottom();
 }
-inline void FindSourceRequest::set_uid(std::string&& value) {
-  
-  uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.FindSourceRequest.uid)
+inline void Style::unsafe_arena_set_allocated_bottom(
+    ::protocol::Dimension* bottom) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bottom_);
+  }
+  _impl_.bottom_ = bottom;
+  if (bottom) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.bottom)
 }
-inline void FindSourceRequest::set_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_bottom() {
   
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.FindSourceRequest.uid)
+  ::protocol::Dimension* temp = _impl_.bottom_;
+  _impl_.bottom_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void FindSourceRequest::set_uid(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_bottom() {
+  // @@protoc_insertion_point(field_release:protocol.Style.bottom)
   
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.FindSourceRequest.uid)
+  ::protocol::Dimension* temp = _impl_.bottom_;
+  _impl_.bottom_ = nullptr;
+  return temp;
 }
-inline std::string* FindSourceRequest::_internal_mutable_uid() {
+inline ::protocol::Dimension* Style::_internal_mutable_bottom() {
   
-  return uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.bottom_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.bottom_ = p;
+  }
+  return _impl_.bottom_;
 }
-inline std::string* FindSourceRequest::release_uid() {
-  // @@protoc_insertion_point(field_release:protocol.FindSourceRequest.uid)
-  return uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_bottom() {
+  ::protocol::Dimension* _msg = _internal_mutable_bottom();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.bottom)
+  return _msg;
 }
-inline void FindSourceRequest::set_allocated_uid(std::string* uid) {
-  if (uid != nullptr) {
+inline void Style::set_allocated_bottom(::protocol::Dimension* bottom) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.bottom_;
+  }
+  if (bottom) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bottom);
+    if (message_arena != submessage_arena) {
+      bottom = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bottom, submessage_arena);
+    }
     
   } else {
     
   }
-  uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.FindSourceRequest.uid)
+  _impl_.bottom_ = bottom;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.bottom)
 }
 
-// string name = 3;
-inline void FindSourceRequest::clear_name() {
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& FindSourceRequest::name() const {
-  // @@protoc_insertion_point(field_get:protocol.FindSourceRequest.name)
-  return _internal_name();
+// .protocol.Dimension margin_top = 19;
+inline bool Style::_internal_has_margin_top() const {
+  return this != internal_default_instance() && _impl_.margin_top_ != nullptr;
 }
-inline void FindSourceRequest::set_name(const std::string& value) {
-  _internal_set_name(value);
-  // @@protoc_insertion_point(field_set:protocol.FindSourceRequest.name)
+inline bool Style::has_margin_top() const {
+  return _internal_has_margin_top();
 }
-inline std::string* FindSourceRequest::mutable_name() {
-  // @@protoc_insertion_point(field_mutable:protocol.FindSourceRequest.name)
-  return _internal_mutable_name();
+inline void Style::clear_margin_top() {
+  if (GetArenaForAllocation() == nullptr && _impl_.margin_top_ != nullptr) {
+    delete _impl_.margin_top_;
+  }
+  _impl_.margin_top_ = nullptr;
 }
-inline const std::string& FindSourceRequest::_internal_name() const {
-  return name_.Get();
+inline const ::protocol::Dimension& Style::_internal_margin_top() const {
+  const ::protocol::Dimension* p = _impl_.margin_top_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void FindSourceRequest::_internal_set_name(const std::string& value) {
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::margin_top() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.margin_top)
+  return _internal_margin_top();
 }
-inline void FindSourceRequest::set_name(std::string&& value) {
-  
-  name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.FindSourceRequest.name)
+inline void Style::unsafe_arena_set_allocated_margin_top(
+    ::protocol::Dimension* margin_top) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.margin_top_);
+  }
+  _impl_.margin_top_ = margin_top;
+  if (margin_top) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.margin_top)
 }
-inline void FindSourceRequest::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_margin_top() {
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.FindSourceRequest.name)
+  ::protocol::Dimension* temp = _impl_.margin_top_;
+  _impl_.margin_top_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void FindSourceRequest::set_name(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_margin_top() {
+  // @@protoc_insertion_point(field_release:protocol.Style.margin_top)
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.FindSourceRequest.name)
+  ::protocol::Dimension* temp = _impl_.margin_top_;
+  _impl_.margin_top_ = nullptr;
+  return temp;
 }
-inline std::string* FindSourceRequest::_internal_mutable_name() {
+inline ::protocol::Dimension* Style::_internal_mutable_margin_top() {
   
-  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.margin_top_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.margin_top_ = p;
+  }
+  return _impl_.margin_top_;
 }
-inline std::string* FindSourceRequest::release_name() {
-  // @@protoc_insertion_point(field_release:protocol.FindSourceRequest.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_margin_top() {
+  ::protocol::Dimension* _msg = _internal_mutable_margin_top();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.margin_top)
+  return _msg;
 }
-inline void FindSourceRequest::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void Style::set_allocated_margin_top(::protocol::Dimension* margin_top) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.margin_top_;
+  }
+  if (margin_top) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(margin_top);
+    if (message_arena != submessage_arena) {
+      margin_top = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, margin_top, submessage_arena);
+    }
     
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.FindSourceRequest.name)
+  _impl_.margin_top_ = margin_top;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.margin_top)
 }
 
-// -------------------------------------------------------------------
-
-// Response
-
-// string request_id = 1;
-inline void Response::clear_request_id() {
-  request_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& Response::request_id() const {
-  // @@protoc_insertion_point(field_get:protocol.Response.request_id)
-  return _internal_request_id();
+// .protocol.Dimension margin_left = 20;
+inline bool Style::_internal_has_margin_left() const {
+  return this != internal_default_instance() && _impl_.margin_left_ != nullptr;
 }
-inline void Response::set_request_id(const std::string& value) {
-  _internal_set_request_id(value);
-  // @@protoc_insertion_point(field_set:protocol.Response.request_id)
+inline bool Style::has_margin_left() const {
+  return _internal_has_margin_left();
 }
-inline std::string* Response::mutable_request_id() {
-  // @@protoc_insertion_point(field_mutable:protocol.Response.request_id)
-  return _internal_mutable_request_id();
+inline void Style::clear_margin_left() {
+  if (GetArenaForAllocation() == nullptr && _impl_.margin_left_ != nullptr) {
+    delete _impl_.margin_left_;
+  }
+  _impl_.margin_left_ = nullptr;
 }
-inline const std::string& Response::_internal_request_id() const {
-  return request_id_.Get();
+inline const ::protocol::Dimension& Style::_internal_margin_left() const {
+  const ::protocol::Dimension* p = _impl_.margin_left_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void Response::_internal_set_request_id(const std::string& value) {
-  
-  request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::margin_left() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.margin_left)
+  return _internal_margin_left();
 }
-inline void Response::set_request_id(std::string&& value) {
-  
-  request_id_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.Response.request_id)
+inline void Style::unsafe_arena_set_allocated_margin_left(
+    ::protocol::Dimension* margin_left) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.margin_left_);
+  }
+  _impl_.margin_left_ = margin_left;
+  if (margin_left) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.margin_left)
 }
-inline void Response::set_request_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_margin_left() {
   
-  request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.Response.request_id)
+  ::protocol::Dimension* temp = _impl_.margin_left_;
+  _impl_.margin_left_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void Response::set_request_id(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_margin_left() {
+  // @@protoc_insertion_point(field_release:protocol.Style.margin_left)
   
-  request_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.Response.request_id)
+  ::protocol::Dimension* temp = _impl_.margin_left_;
+  _impl_.margin_left_ = nullptr;
+  return temp;
 }
-inline std::string* Response::_internal_mutable_request_id() {
+inline ::protocol::Dimension* Style::_internal_mutable_margin_left() {
   
-  return request_id_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.margin_left_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.margin_left_ = p;
+  }
+  return _impl_.margin_left_;
 }
-inline std::string* Response::release_request_id() {
-  // @@protoc_insertion_point(field_release:protocol.Response.request_id)
-  return request_id_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_margin_left() {
+  ::protocol::Dimension* _msg = _internal_mutable_margin_left();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.margin_left)
+  return _msg;
 }
-inline void Response::set_allocated_request_id(std::string* request_id) {
-  if (request_id != nullptr) {
+inline void Style::set_allocated_margin_left(::protocol::Dimension* margin_left) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.margin_left_;
+  }
+  if (margin_left) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(margin_left);
+    if (message_arena != submessage_arena) {
+      margin_left = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, margin_left, submessage_arena);
+    }
     
   } else {
     
   }
-  request_id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), request_id,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.Response.request_id)
-}
-
-// bool success = 2;
-inline void Response::clear_success() {
-  success_ = false;
-}
-inline bool Response::_internal_success() const {
-  return success_;
-}
-inline bool Response::success() const {
-  // @@protoc_insertion_point(field_get:protocol.Response.success)
-  return _internal_success();
+  _impl_.margin_left_ = margin_left;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.margin_left)
 }
-inline void Response::_internal_set_success(bool value) {
-  
-  success_ = value;
-}
-inline void Response::set_success(bool value) {
-  _internal_set_success(value);
-  // @@protoc_insertion_point(field_set:protocol.Response.success)
-}
-
-// -------------------------------------------------------------------
-
-// CreateSource
 
-// string uid = 1;
-inline void CreateSource::clear_uid() {
-  uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& CreateSource::uid() const {
-  // @@protoc_insertion_point(field_get:protocol.CreateSource.uid)
-  return _internal_uid();
+// .protocol.Dimension margin_right = 21;
+inline bool Style::_internal_has_margin_right() const {
+  return this != internal_default_instance() && _impl_.margin_right_ != nullptr;
 }
-inline void CreateSource::set_uid(const std::string& value) {
-  _internal_set_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.CreateSource.uid)
+inline bool Style::has_margin_right() const {
+  return _internal_has_margin_right();
 }
-inline std::string* CreateSource::mutable_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.uid)
-  return _internal_mutable_uid();
+inline void Style::clear_margin_right() {
+  if (GetArenaForAllocation() == nullptr && _impl_.margin_right_ != nullptr) {
+    delete _impl_.margin_right_;
+  }
+  _impl_.margin_right_ = nullptr;
 }
-inline const std::string& CreateSource::_internal_uid() const {
-  return uid_.Get();
+inline const ::protocol::Dimension& Style::_internal_margin_right() const {
+  const ::protocol::Dimension* p = _impl_.margin_right_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void CreateSource::_internal_set_uid(const std::string& value) {
-  
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::margin_right() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.margin_right)
+  return _internal_margin_right();
 }
-inline void CreateSource::set_uid(std::string&& value) {
-  
-  uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.CreateSource.uid)
+inline void Style::unsafe_arena_set_allocated_margin_right(
+    ::protocol::Dimension* margin_right) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.margin_right_);
+  }
+  _impl_.margin_right_ = margin_right;
+  if (margin_right) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.margin_right)
 }
-inline void CreateSource::set_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_margin_right() {
   
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.CreateSource.uid)
+  ::protocol::Dimension* temp = _impl_.margin_right_;
+  _impl_.margin_right_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CreateSource::set_uid(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_margin_right() {
+  // @@protoc_insertion_point(field_release:protocol.Style.margin_right)
   
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.CreateSource.uid)
+  ::protocol::Dimension* temp = _impl_.margin_right_;
+  _impl_.margin_right_ = nullptr;
+  return temp;
 }
-inline std::string* CreateSource::_internal_mutable_uid() {
+inline ::protocol::Dimension* Style::_internal_mutable_margin_right() {
   
-  return uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.margin_right_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.margin_right_ = p;
+  }
+  return _impl_.margin_right_;
 }
-inline std::string* CreateSource::release_uid() {
-  // @@protoc_insertion_point(field_release:protocol.CreateSource.uid)
-  return uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_margin_right() {
+  ::protocol::Dimension* _msg = _internal_mutable_margin_right();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.margin_right)
+  return _msg;
 }
-inline void CreateSource::set_allocated_uid(std::string* uid) {
-  if (uid != nullptr) {
+inline void Style::set_allocated_margin_right(::protocol::Dimension* margin_right) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.margin_right_;
+  }
+  if (margin_right) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(margin_right);
+    if (message_arena != submessage_arena) {
+      margin_right = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, margin_right, submessage_arena);
+    }
     
   } else {
     
   }
-  uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.uid)
+  _impl_.margin_right_ = margin_right;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.margin_right)
 }
 
-// string container_uid = 5;
-inline void CreateSource::clear_container_uid() {
-  container_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// .protocol.Dimension margin_bottom = 22;
+inline bool Style::_internal_has_margin_bottom() const {
+  return this != internal_default_instance() && _impl_.margin_bottom_ != nullptr;
 }
-inline const std::string& CreateSource::container_uid() const {
-  // @@protoc_insertion_point(field_get:protocol.CreateSource.container_uid)
-  return _internal_container_uid();
-}
-inline void CreateSource::set_container_uid(const std::string& value) {
-  _internal_set_container_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.CreateSource.container_uid)
+inline bool Style::has_margin_bottom() const {
+  return _internal_has_margin_bottom();
 }
-inline std::string* CreateSource::mutable_container_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.container_uid)
-  return _internal_mutable_container_uid();
+inline void Style::clear_margin_bottom() {
+  if (GetArenaForAllocation() == nullptr && _impl_.margin_bottom_ != nullptr) {
+    delete _impl_.margin_bottom_;
+  }
+  _impl_.margin_bottom_ = nullptr;
 }
-inline const std::string& CreateSource::_internal_container_uid() const {
-  return container_uid_.Get();
+inline const ::protocol::Dimension& Style::_internal_margin_bottom() const {
+  const ::protocol::Dimension* p = _impl_.margin_bottom_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void CreateSource::_internal_set_container_uid(const std::string& value) {
-  
-  container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::margin_bottom() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.margin_bottom)
+  return _internal_margin_bottom();
 }
-inline void CreateSource::set_container_uid(std::string&& value) {
-  
-  container_uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.CreateSource.container_uid)
+inline void Style::unsafe_arena_set_allocated_margin_bottom(
+    ::protocol::Dimension* margin_bottom) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.margin_bottom_);
+  }
+  _impl_.margin_bottom_ = margin_bottom;
+  if (margin_bottom) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.margin_bottom)
 }
-inline void CreateSource::set_container_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_margin_bottom() {
   
-  container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.CreateSource.container_uid)
+  ::protocol::Dimension* temp = _impl_.margin_bottom_;
+  _impl_.margin_bottom_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CreateSource::set_container_uid(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_margin_bottom() {
+  // @@protoc_insertion_point(field_release:protocol.Style.margin_bottom)
   
-  container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.CreateSource.container_uid)
+  ::protocol::Dimension* temp = _impl_.margin_bottom_;
+  _impl_.margin_bottom_ = nullptr;
+  return temp;
 }
-inline std::string* CreateSource::_internal_mutable_container_uid() {
+inline ::protocol::Dimension* Style::_internal_mutable_margin_bottom() {
   
-  return container_uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.margin_bottom_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.margin_bottom_ = p;
+  }
+  return _impl_.margin_bottom_;
 }
-inline std::string* CreateSource::release_container_uid() {
-  // @@protoc_insertion_point(field_release:protocol.CreateSource.container_uid)
-  return container_uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_margin_bottom() {
+  ::protocol::Dimension* _msg = _internal_mutable_margin_bottom();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.margin_bottom)
+  return _msg;
 }
-inline void CreateSource::set_allocated_container_uid(std::string* container_uid) {
-  if (container_uid != nullptr) {
+inline void Style::set_allocated_margin_bottom(::protocol::Dimension* margin_bottom) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.margin_bottom_;
+  }
+  if (margin_bottom) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(margin_bottom);
+    if (message_arena != submessage_arena) {
+      margin_bottom = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, margin_bottom, submessage_arena);
+    }
     
   } else {
     
   }
-  container_uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), container_uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.container_uid)
+  _impl_.margin_bottom_ = margin_bottom;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.margin_bottom)
 }
 
-// string id = 2;
-inline void CreateSource::clear_id() {
-  id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& CreateSource::id() const {
-  // @@protoc_insertion_point(field_get:protocol.CreateSource.id)
-  return _internal_id();
+// .protocol.Dimension padding_top = 23;
+inline bool Style::_internal_has_padding_top() const {
+  return this != internal_default_instance() && _impl_.padding_top_ != nullptr;
 }
-inline void CreateSource::set_id(const std::string& value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:protocol.CreateSource.id)
+inline bool Style::has_padding_top() const {
+  return _internal_has_padding_top();
 }
-inline std::string* CreateSource::mutable_id() {
-  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.id)
-  return _internal_mutable_id();
+inline void Style::clear_padding_top() {
+  if (GetArenaForAllocation() == nullptr && _impl_.padding_top_ != nullptr) {
+    delete _impl_.padding_top_;
+  }
+  _impl_.padding_top_ = nullptr;
 }
-inline const std::string& CreateSource::_internal_id() const {
-  return id_.Get();
+inline const ::protocol::Dimension& Style::_internal_padding_top() const {
+  const ::protocol::Dimension* p = _impl_.padding_top_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void CreateSource::_internal_set_id(const std::string& value) {
-  
-  id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::padding_top() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.padding_top)
+  return _internal_padding_top();
 }
-inline void CreateSource::set_id(std::string&& value) {
-  
-  id_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.CreateSource.id)
+inline void Style::unsafe_arena_set_allocated_padding_top(
+    ::protocol::Dimension* padding_top) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.padding_top_);
+  }
+  _impl_.padding_top_ = padding_top;
+  if (padding_top) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.padding_top)
 }
-inline void CreateSource::set_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_padding_top() {
   
-  id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.CreateSource.id)
+  ::protocol::Dimension* temp = _impl_.padding_top_;
+  _impl_.padding_top_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CreateSource::set_id(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_padding_top() {
+  // @@protoc_insertion_point(field_release:protocol.Style.padding_top)
   
-  id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.CreateSource.id)
+  ::protocol::Dimension* temp = _impl_.padding_top_;
+  _impl_.padding_top_ = nullptr;
+  return temp;
 }
-inline std::string* CreateSource::_internal_mutable_id() {
+inline ::protocol::Dimension* Style::_internal_mutable_padding_top() {
   
-  return id_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* CreateSource::release_id() {
-  // @@protoc_insertion_point(field_release:protocol.CreateSource.id)
-  return id_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.padding_top_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.padding_top_ = p;
+  }
+  return _impl_.padding_top_;
 }
-inline void CreateSource::set_allocated_id(std::string* id) {
-  if (id != nullptr) {
+inline ::protocol::Dimension* Style::mutable_padding_top() {
+  ::protocol::Dimension* _msg = _internal_mutable_padding_top();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.padding_top)
+  return _msg;
+}
+inline void Style::set_allocated_padding_top(::protocol::Dimension* padding_top) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.padding_top_;
+  }
+  if (padding_top) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(padding_top);
+    if (message_arena != submessage_arena) {
+      padding_top = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, padding_top, submessage_arena);
+    }
     
   } else {
     
   }
-  id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), id,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.id)
+  _impl_.padding_top_ = padding_top;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.padding_top)
 }
 
-// string name = 3;
-inline void CreateSource::clear_name() {
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& CreateSource::name() const {
-  // @@protoc_insertion_point(field_get:protocol.CreateSource.name)
-  return _internal_name();
+// .protocol.Dimension padding_left = 24;
+inline bool Style::_internal_has_padding_left() const {
+  return this != internal_default_instance() && _impl_.padding_left_ != nullptr;
 }
-inline void CreateSource::set_name(const std::string& value) {
-  _internal_set_name(value);
-  // @@protoc_insertion_point(field_set:protocol.CreateSource.name)
+inline bool Style::has_padding_left() const {
+  return _internal_has_padding_left();
 }
-inline std::string* CreateSource::mutable_name() {
-  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.name)
-  return _internal_mutable_name();
+inline void Style::clear_padding_left() {
+  if (GetArenaForAllocation() == nullptr && _impl_.padding_left_ != nullptr) {
+    delete _impl_.padding_left_;
+  }
+  _impl_.padding_left_ = nullptr;
 }
-inline const std::string& CreateSource::_internal_name() const {
-  return name_.Get();
+inline const ::protocol::Dimension& Style::_internal_padding_left() const {
+  const ::protocol::Dimension* p = _impl_.padding_left_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void CreateSource::_internal_set_name(const std::string& value) {
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::padding_left() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.padding_left)
+  return _internal_padding_left();
 }
-inline void CreateSource::set_name(std::string&& value) {
-  
-  name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.CreateSource.name)
+inline void Style::unsafe_arena_set_allocated_padding_left(
+    ::protocol::Dimension* padding_left) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.padding_left_);
+  }
+  _impl_.padding_left_ = padding_left;
+  if (padding_left) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.padding_left)
 }
-inline void CreateSource::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_padding_left() {
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.CreateSource.name)
+  ::protocol::Dimension* temp = _impl_.padding_left_;
+  _impl_.padding_left_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CreateSource::set_name(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_padding_left() {
+  // @@protoc_insertion_point(field_release:protocol.Style.padding_left)
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.CreateSource.name)
+  ::protocol::Dimension* temp = _impl_.padding_left_;
+  _impl_.padding_left_ = nullptr;
+  return temp;
 }
-inline std::string* CreateSource::_internal_mutable_name() {
+inline ::protocol::Dimension* Style::_internal_mutable_padding_left() {
   
-  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.padding_left_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.padding_left_ = p;
+  }
+  return _impl_.padding_left_;
 }
-inline std::string* CreateSource::release_name() {
-  // @@protoc_insertion_point(field_release:protocol.CreateSource.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_padding_left() {
+  ::protocol::Dimension* _msg = _internal_mutable_padding_left();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.padding_left)
+  return _msg;
 }
-inline void CreateSource::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void Style::set_allocated_padding_left(::protocol::Dimension* padding_left) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.padding_left_;
+  }
+  if (padding_left) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(padding_left);
+    if (message_arena != submessage_arena) {
+      padding_left = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, padding_left, submessage_arena);
+    }
     
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.name)
+  _impl_.padding_left_ = padding_left;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.padding_left)
 }
 
-// .protocol.ObjectValue settings = 4;
-inline bool CreateSource::_internal_has_settings() const {
-  return this != internal_default_instance() && settings_ != nullptr;
+// .protocol.Dimension padding_right = 25;
+inline bool Style::_internal_has_padding_right() const {
+  return this != internal_default_instance() && _impl_.padding_right_ != nullptr;
 }
-inline bool CreateSource::has_settings() const {
-  return _internal_has_settings();
+inline bool Style::has_padding_right() const {
+  return _internal_has_padding_right();
 }
-inline void CreateSource::clear_settings() {
-  if (GetArena() == nullptr && settings_ != nullptr) {
-    delete settings_;
+inline void Style::clear_padding_right() {
+  if (GetArenaForAllocation() == nullptr && _impl_.padding_right_ != nullptr) {
+    delete _impl_.padding_right_;
   }
-  settings_ = nullptr;
+  _impl_.padding_right_ = nullptr;
 }
-inline const ::protocol::ObjectValue& CreateSource::_internal_settings() const {
-  const ::protocol::ObjectValue* p = settings_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::protocol::ObjectValue*>(
-      &::protocol::_ObjectValue_default_instance_);
+inline const ::protocol::Dimension& Style::_internal_padding_right() const {
+  const ::protocol::Dimension* p = _impl_.padding_right_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline const ::protocol::ObjectValue& CreateSource::settings() const {
-  // @@protoc_insertion_point(field_get:protocol.CreateSource.settings)
-  return _internal_settings();
+inline const ::protocol::Dimension& Style::padding_right() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.padding_right)
+  return _internal_padding_right();
 }
-inline void CreateSource::unsafe_arena_set_allocated_settings(
-    ::protocol::ObjectValue* settings) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(settings_);
+inline void Style::unsafe_arena_set_allocated_padding_right(
+    ::protocol::Dimension* padding_right) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.padding_right_);
   }
-  settings_ = settings;
-  if (settings) {
+  _impl_.padding_right_ = padding_right;
+  if (padding_right) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.CreateSource.settings)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.padding_right)
 }
-inline ::protocol::ObjectValue* CreateSource::release_settings() {
+inline ::protocol::Dimension* Style::release_padding_right() {
   
-  ::protocol::ObjectValue* temp = settings_;
-  settings_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::protocol::Dimension* temp = _impl_.padding_right_;
+  _impl_.padding_right_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::protocol::ObjectValue* CreateSource::unsafe_arena_release_settings() {
-  // @@protoc_insertion_point(field_release:protocol.CreateSource.settings)
+inline ::protocol::Dimension* Style::unsafe_arena_release_padding_right() {
+  // @@protoc_insertion_point(field_release:protocol.Style.padding_right)
   
-  ::protocol::ObjectValue* temp = settings_;
-  settings_ = nullptr;
+  ::protocol::Dimension* temp = _impl_.padding_right_;
+  _impl_.padding_right_ = nullptr;
   return temp;
 }
-inline ::protocol::ObjectValue* CreateSource::_internal_mutable_settings() {
+inline ::protocol::Dimension* Style::_internal_mutable_padding_right() {
   
-  if (settings_ == nullptr) {
-    auto* p = CreateMaybeMessage<::protocol::ObjectValue>(GetArena());
-    settings_ = p;
+  if (_impl_.padding_right_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.padding_right_ = p;
   }
-  return settings_;
+  return _impl_.padding_right_;
 }
-inline ::protocol::ObjectValue* CreateSource::mutable_settings() {
-  // @@protoc_insertion_point(field_mutable:protocol.CreateSource.settings)
-  return _internal_mutable_settings();
+inline ::protocol::Dimension* Style::mutable_padding_right() {
+  ::protocol::Dimension* _msg = _internal_mutable_padding_right();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.padding_right)
+  return _msg;
 }
-inline void CreateSource::set_allocated_settings(::protocol::ObjectValue* settings) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+inline void Style::set_allocated_padding_right(::protocol::Dimension* padding_right) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete settings_;
+    delete _impl_.padding_right_;
   }
-  if (settings) {
+  if (padding_right) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(settings);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(padding_right);
     if (message_arena != submessage_arena) {
-      settings = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, settings, submessage_arena);
+      padding_right = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, padding_right, submessage_arena);
     }
     
   } else {
     
   }
-  settings_ = settings;
-  // @@protoc_insertion_point(field_set_allocated:protocol.CreateSource.settings)
+  _impl_.padding_right_ = padding_right;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.padding_right)
 }
 
-// -------------------------------------------------------------------
-
-// UpdateSource
-
-// string uid = 2;
-inline void UpdateSource::clear_uid() {
-  uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// .protocol.Dimension padding_bottom = 26;
+inline bool Style::_internal_has_padding_bottom() const {
+  return this != internal_default_instance() && _impl_.padding_bottom_ != nullptr;
 }
-inline const std::string& UpdateSource::uid() const {
-  // @@protoc_insertion_point(field_get:protocol.UpdateSource.uid)
-  return _internal_uid();
-}
-inline void UpdateSource::set_uid(const std::string& value) {
-  _internal_set_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.UpdateSource.uid)
+inline bool Style::has_padding_bottom() const {
+  return _internal_has_padding_bottom();
 }
-inline std::string* UpdateSource::mutable_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.UpdateSource.uid)
-  return _internal_mutable_uid();
+inline void Style::clear_padding_bottom() {
+  if (GetArenaForAllocation() == nullptr && _impl_.padding_bottom_ != nullptr) {
+    delete _impl_.padding_bottom_;
+  }
+  _impl_.padding_bottom_ = nullptr;
 }
-inline const std::string& UpdateSource::_internal_uid() const {
-  return uid_.Get();
+inline const ::protocol::Dimension& Style::_internal_padding_bottom() const {
+  const ::protocol::Dimension* p = _impl_.padding_bottom_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void UpdateSource::_internal_set_uid(const std::string& value) {
-  
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::padding_bottom() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.padding_bottom)
+  return _internal_padding_bottom();
 }
-inline void UpdateSource::set_uid(std::string&& value) {
-  
-  uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.UpdateSource.uid)
+inline void Style::unsafe_arena_set_allocated_padding_bottom(
+    ::protocol::Dimension* padding_bottom) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.padding_bottom_);
+  }
+  _impl_.padding_bottom_ = padding_bottom;
+  if (padding_bottom) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.padding_bottom)
 }
-inline void UpdateSource::set_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_padding_bottom() {
   
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.UpdateSource.uid)
+  ::protocol::Dimension* temp = _impl_.padding_bottom_;
+  _impl_.padding_bottom_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void UpdateSource::set_uid(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_padding_bottom() {
+  // @@protoc_insertion_point(field_release:protocol.Style.padding_bottom)
   
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.UpdateSource.uid)
+  ::protocol::Dimension* temp = _impl_.padding_bottom_;
+  _impl_.padding_bottom_ = nullptr;
+  return temp;
 }
-inline std::string* UpdateSource::_internal_mutable_uid() {
+inline ::protocol::Dimension* Style::_internal_mutable_padding_bottom() {
   
-  return uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.padding_bottom_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.padding_bottom_ = p;
+  }
+  return _impl_.padding_bottom_;
 }
-inline std::string* UpdateSource::release_uid() {
-  // @@protoc_insertion_point(field_release:protocol.UpdateSource.uid)
-  return uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_padding_bottom() {
+  ::protocol::Dimension* _msg = _internal_mutable_padding_bottom();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.padding_bottom)
+  return _msg;
 }
-inline void UpdateSource::set_allocated_uid(std::string* uid) {
-  if (uid != nullptr) {
+inline void Style::set_allocated_padding_bottom(::protocol::Dimension* padding_bottom) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.padding_bottom_;
+  }
+  if (padding_bottom) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(padding_bottom);
+    if (message_arena != submessage_arena) {
+      padding_bottom = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, padding_bottom, submessage_arena);
+    }
     
   } else {
     
   }
-  uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.UpdateSource.uid)
+  _impl_.padding_bottom_ = padding_bottom;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.padding_bottom)
 }
 
-// .protocol.ObjectValue changed_props = 3;
-inline bool UpdateSource::_internal_has_changed_props() const {
-  return this != internal_default_instance() && changed_props_ != nullptr;
+// float aspect_ratio = 27;
+inline void Style::clear_aspect_ratio() {
+  _impl_.aspect_ratio_ = 0;
 }
-inline bool UpdateSource::has_changed_props() const {
-  return _internal_has_changed_props();
+inline float Style::_internal_aspect_ratio() const {
+  return _impl_.aspect_ratio_;
 }
-inline void UpdateSource::clear_changed_props() {
-  if (GetArena() == nullptr && changed_props_ != nullptr) {
-    delete changed_props_;
+inline float Style::aspect_ratio() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.aspect_ratio)
+  return _internal_aspect_ratio();
+}
+inline void Style::_internal_set_aspect_ratio(float value) {
+  
+  _impl_.aspect_ratio_ = value;
+}
+inline void Style::set_aspect_ratio(float value) {
+  _internal_set_aspect_ratio(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.aspect_ratio)
+}
+
+// .protocol.Dimension width = 28;
+inline bool Style::_internal_has_width() const {
+  return this != internal_default_instance() && _impl_.width_ != nullptr;
+}
+inline bool Style::has_width() const {
+  return _internal_has_width();
+}
+inline void Style::clear_width() {
+  if (GetArenaForAllocation() == nullptr && _impl_.width_ != nullptr) {
+    delete _impl_.width_;
   }
-  changed_props_ = nullptr;
+  _impl_.width_ = nullptr;
 }
-inline const ::protocol::ObjectValue& UpdateSource::_internal_changed_props() const {
-  const ::protocol::ObjectValue* p = changed_props_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::protocol::ObjectValue*>(
-      &::protocol::_ObjectValue_default_instance_);
+inline const ::protocol::Dimension& Style::_internal_width() const {
+  const ::protocol::Dimension* p = _impl_.width_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline const ::protocol::ObjectValue& UpdateSource::changed_props() const {
-  // @@protoc_insertion_point(field_get:protocol.UpdateSource.changed_props)
-  return _internal_changed_props();
+inline const ::protocol::Dimension& Style::width() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.width)
+  return _internal_width();
 }
-inline void UpdateSource::unsafe_arena_set_allocated_changed_props(
-    ::protocol::ObjectValue* changed_props) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(changed_props_);
+inline void Style::unsafe_arena_set_allocated_width(
+    ::protocol::Dimension* width) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.width_);
   }
-  changed_props_ = changed_props;
-  if (changed_props) {
+  _impl_.width_ = width;
+  if (width) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.UpdateSource.changed_props)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.width)
 }
-inline ::protocol::ObjectValue* UpdateSource::release_changed_props() {
+inline ::protocol::Dimension* Style::release_width() {
   
-  ::protocol::ObjectValue* temp = changed_props_;
-  changed_props_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::protocol::Dimension* temp = _impl_.width_;
+  _impl_.width_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::protocol::ObjectValue* UpdateSource::unsafe_arena_release_changed_props() {
-  // @@protoc_insertion_point(field_release:protocol.UpdateSource.changed_props)
+inline ::protocol::Dimension* Style::unsafe_arena_release_width() {
+  // @@protoc_insertion_point(field_release:protocol.Style.width)
   
-  ::protocol::ObjectValue* temp = changed_props_;
-  changed_props_ = nullptr;
+  ::protocol::Dimension* temp = _impl_.width_;
+  _impl_.width_ = nullptr;
   return temp;
 }
-inline ::protocol::ObjectValue* UpdateSource::_internal_mutable_changed_props() {
+inline ::protocol::Dimension* Style::_internal_mutable_width() {
   
-  if (changed_props_ == nullptr) {
-    auto* p = CreateMaybeMessage<::protocol::ObjectValue>(GetArena());
-    changed_props_ = p;
+  if (_impl_.width_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.width_ = p;
   }
-  return changed_props_;
+  return _impl_.width_;
 }
-inline ::protocol::ObjectValue* UpdateSource::mutable_changed_props() {
-  // @@protoc_insertion_point(field_mutable:protocol.UpdateSource.changed_props)
-  return _internal_mutable_changed_props();
+inline ::protocol::Dimension* Style::mutable_width() {
+  ::protocol::Dimension* _msg = _internal_mutable_width();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.width)
+  return _msg;
 }
-inline void UpdateSource::set_allocated_changed_props(::protocol::ObjectValue* changed_props) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+inline void Style::set_allocated_width(::protocol::Dimension* width) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete changed_props_;
+    delete _impl_.width_;
   }
-  if (changed_props) {
+  if (width) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(changed_props);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(width);
     if (message_arena != submessage_arena) {
-      changed_props = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, changed_props, submessage_arena);
+      width = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, width, submessage_arena);
     }
     
   } else {
     
   }
-  changed_props_ = changed_props;
-  // @@protoc_insertion_point(field_set_allocated:protocol.UpdateSource.changed_props)
+  _impl_.width_ = width;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.width)
 }
 
-// -------------------------------------------------------------------
-
-// CreateScene
-
-// string uid = 1;
-inline void CreateScene::clear_uid() {
-  uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& CreateScene::uid() const {
-  // @@protoc_insertion_point(field_get:protocol.CreateScene.uid)
-  return _internal_uid();
+// .protocol.Dimension height = 29;
+inline bool Style::_internal_has_height() const {
+  return this != internal_default_instance() && _impl_.height_ != nullptr;
 }
-inline void CreateScene::set_uid(const std::string& value) {
-  _internal_set_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.CreateScene.uid)
+inline bool Style::has_height() const {
+  return _internal_has_height();
 }
-inline std::string* CreateScene::mutable_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.CreateScene.uid)
-  return _internal_mutable_uid();
+inline void Style::clear_height() {
+  if (GetArenaForAllocation() == nullptr && _impl_.height_ != nullptr) {
+    delete _impl_.height_;
+  }
+  _impl_.height_ = nullptr;
 }
-inline const std::string& CreateScene::_internal_uid() const {
-  return uid_.Get();
+inline const ::protocol::Dimension& Style::_internal_height() const {
+  const ::protocol::Dimension* p = _impl_.height_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void CreateScene::_internal_set_uid(const std::string& value) {
-  
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::height() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.height)
+  return _internal_height();
 }
-inline void CreateScene::set_uid(std::string&& value) {
-  
-  uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.CreateScene.uid)
+inline void Style::unsafe_arena_set_allocated_height(
+    ::protocol::Dimension* height) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.height_);
+  }
+  _impl_.height_ = height;
+  if (height) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.height)
 }
-inline void CreateScene::set_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_height() {
   
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.CreateScene.uid)
+  ::protocol::Dimension* temp = _impl_.height_;
+  _impl_.height_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CreateScene::set_uid(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_height() {
+  // @@protoc_insertion_point(field_release:protocol.Style.height)
   
-  uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.CreateScene.uid)
+  ::protocol::Dimension* temp = _impl_.height_;
+  _impl_.height_ = nullptr;
+  return temp;
 }
-inline std::string* CreateScene::_internal_mutable_uid() {
+inline ::protocol::Dimension* Style::_internal_mutable_height() {
   
-  return uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.height_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.height_ = p;
+  }
+  return _impl_.height_;
 }
-inline std::string* CreateScene::release_uid() {
-  // @@protoc_insertion_point(field_release:protocol.CreateScene.uid)
-  return uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_height() {
+  ::protocol::Dimension* _msg = _internal_mutable_height();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.height)
+  return _msg;
 }
-inline void CreateScene::set_allocated_uid(std::string* uid) {
-  if (uid != nullptr) {
+inline void Style::set_allocated_height(::protocol::Dimension* height) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.height_;
+  }
+  if (height) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(height);
+    if (message_arena != submessage_arena) {
+      height = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, height, submessage_arena);
+    }
     
   } else {
     
   }
-  uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.CreateScene.uid)
+  _impl_.height_ = height;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.height)
 }
 
-// string container_uid = 4;
-inline void CreateScene::clear_container_uid() {
-  container_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& CreateScene::container_uid() const {
-  // @@protoc_insertion_point(field_get:protocol.CreateScene.container_uid)
-  return _internal_container_uid();
+// .protocol.Dimension min_width = 30;
+inline bool Style::_internal_has_min_width() const {
+  return this != internal_default_instance() && _impl_.min_width_ != nullptr;
 }
-inline void CreateScene::set_container_uid(const std::string& value) {
-  _internal_set_container_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.CreateScene.container_uid)
+inline bool Style::has_min_width() const {
+  return _internal_has_min_width();
 }
-inline std::string* CreateScene::mutable_container_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.CreateScene.container_uid)
-  return _internal_mutable_container_uid();
+inline void Style::clear_min_width() {
+  if (GetArenaForAllocation() == nullptr && _impl_.min_width_ != nullptr) {
+    delete _impl_.min_width_;
+  }
+  _impl_.min_width_ = nullptr;
 }
-inline const std::string& CreateScene::_internal_container_uid() const {
-  return container_uid_.Get();
+inline const ::protocol::Dimension& Style::_internal_min_width() const {
+  const ::protocol::Dimension* p = _impl_.min_width_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void CreateScene::_internal_set_container_uid(const std::string& value) {
-  
-  container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::min_width() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.min_width)
+  return _internal_min_width();
 }
-inline void CreateScene::set_container_uid(std::string&& value) {
-  
-  container_uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.CreateScene.container_uid)
+inline void Style::unsafe_arena_set_allocated_min_width(
+    ::protocol::Dimension* min_width) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.min_width_);
+  }
+  _impl_.min_width_ = min_width;
+  if (min_width) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.min_width)
 }
-inline void CreateScene::set_container_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_min_width() {
   
-  container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.CreateScene.container_uid)
+  ::protocol::Dimension* temp = _impl_.min_width_;
+  _impl_.min_width_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CreateScene::set_container_uid(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_min_width() {
+  // @@protoc_insertion_point(field_release:protocol.Style.min_width)
   
-  container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.CreateScene.container_uid)
+  ::protocol::Dimension* temp = _impl_.min_width_;
+  _impl_.min_width_ = nullptr;
+  return temp;
 }
-inline std::string* CreateScene::_internal_mutable_container_uid() {
+inline ::protocol::Dimension* Style::_internal_mutable_min_width() {
   
-  return container_uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.min_width_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.min_width_ = p;
+  }
+  return _impl_.min_width_;
 }
-inline std::string* CreateScene::release_container_uid() {
-  // @@protoc_insertion_point(field_release:protocol.CreateScene.container_uid)
-  return container_uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_min_width() {
+  ::protocol::Dimension* _msg = _internal_mutable_min_width();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.min_width)
+  return _msg;
 }
-inline void CreateScene::set_allocated_container_uid(std::string* container_uid) {
-  if (container_uid != nullptr) {
+inline void Style::set_allocated_min_width(::protocol::Dimension* min_width) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.min_width_;
+  }
+  if (min_width) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(min_width);
+    if (message_arena != submessage_arena) {
+      min_width = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, min_width, submessage_arena);
+    }
     
   } else {
     
   }
-  container_uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), container_uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.CreateScene.container_uid)
+  _impl_.min_width_ = min_width;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.min_width)
 }
 
-// string name = 2;
-inline void CreateScene::clear_name() {
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& CreateScene::name() const {
-  // @@protoc_insertion_point(field_get:protocol.CreateScene.name)
-  return _internal_name();
+// .protocol.Dimension max_width = 31;
+inline bool Style::_internal_has_max_width() const {
+  return this != internal_default_instance() && _impl_.max_width_ != nullptr;
 }
-inline void CreateScene::set_name(const std::string& value) {
-  _internal_set_name(value);
-  // @@protoc_insertion_point(field_set:protocol.CreateScene.name)
+inline bool Style::has_max_width() const {
+  return _internal_has_max_width();
 }
-inline std::string* CreateScene::mutable_name() {
-  // @@protoc_insertion_point(field_mutable:protocol.CreateScene.name)
-  return _internal_mutable_name();
+inline void Style::clear_max_width() {
+  if (GetArenaForAllocation() == nullptr && _impl_.max_width_ != nullptr) {
+    delete _impl_.max_width_;
+  }
+  _impl_.max_width_ = nullptr;
 }
-inline const std::string& CreateScene::_internal_name() const {
-  return name_.Get();
+inline const ::protocol::Dimension& Style::_internal_max_width() const {
+  const ::protocol::Dimension* p = _impl_.max_width_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void CreateScene::_internal_set_name(const std::string& value) {
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::max_width() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.max_width)
+  return _internal_max_width();
 }
-inline void CreateScene::set_name(std::string&& value) {
-  
-  name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.CreateScene.name)
+inline void Style::unsafe_arena_set_allocated_max_width(
+    ::protocol::Dimension* max_width) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.max_width_);
+  }
+  _impl_.max_width_ = max_width;
+  if (max_width) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.max_width)
 }
-inline void CreateScene::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_max_width() {
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.CreateScene.name)
+  ::protocol::Dimension* temp = _impl_.max_width_;
+  _impl_.max_width_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void CreateScene::set_name(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_max_width() {
+  // @@protoc_insertion_point(field_release:protocol.Style.max_width)
   
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.CreateScene.name)
+  ::protocol::Dimension* temp = _impl_.max_width_;
+  _impl_.max_width_ = nullptr;
+  return temp;
 }
-inline std::string* CreateScene::_internal_mutable_name() {
+inline ::protocol::Dimension* Style::_internal_mutable_max_width() {
   
-  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.max_width_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.max_width_ = p;
+  }
+  return _impl_.max_width_;
 }
-inline std::string* CreateScene::release_name() {
-  // @@protoc_insertion_point(field_release:protocol.CreateScene.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_max_width() {
+  ::protocol::Dimension* _msg = _internal_mutable_max_width();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.max_width)
+  return _msg;
 }
-inline void CreateScene::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void Style::set_allocated_max_width(::protocol::Dimension* max_width) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.max_width_;
+  }
+  if (max_width) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(max_width);
+    if (message_arena != submessage_arena) {
+      max_width = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, max_width, submessage_arena);
+    }
     
   } else {
     
   }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.CreateScene.name)
+  _impl_.max_width_ = max_width;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.max_width)
 }
 
-// .protocol.ObjectValue props = 3;
-inline bool CreateScene::_internal_has_props() const {
-  return this != internal_default_instance() && props_ != nullptr;
+// .protocol.Dimension min_height = 32;
+inline bool Style::_internal_has_min_height() const {
+  return this != internal_default_instance() && _impl_.min_height_ != nullptr;
 }
-inline bool CreateScene::has_props() const {
-  return _internal_has_props();
+inline bool Style::has_min_height() const {
+  return _internal_has_min_height();
 }
-inline void CreateScene::clear_props() {
-  if (GetArena() == nullptr && props_ != nullptr) {
-    delete props_;
+inline void Style::clear_min_height() {
+  if (GetArenaForAllocation() == nullptr && _impl_.min_height_ != nullptr) {
+    delete _impl_.min_height_;
   }
-  props_ = nullptr;
+  _impl_.min_height_ = nullptr;
 }
-inline const ::protocol::ObjectValue& CreateScene::_internal_props() const {
-  const ::protocol::ObjectValue* p = props_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::protocol::ObjectValue*>(
-      &::protocol::_ObjectValue_default_instance_);
+inline const ::protocol::Dimension& Style::_internal_min_height() const {
+  const ::protocol::Dimension* p = _impl_.min_height_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline const ::protocol::ObjectValue& CreateScene::props() const {
-  // @@protoc_insertion_point(field_get:protocol.CreateScene.props)
-  return _internal_props();
+inline const ::protocol::Dimension& Style::min_height() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.min_height)
+  return _internal_min_height();
 }
-inline void CreateScene::unsafe_arena_set_allocated_props(
-    ::protocol::ObjectValue* props) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(props_);
+inline void Style::unsafe_arena_set_allocated_min_height(
+    ::protocol::Dimension* min_height) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.min_height_);
   }
-  props_ = props;
-  if (props) {
+  _impl_.min_height_ = min_height;
+  if (min_height) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.CreateScene.props)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.min_height)
 }
-inline ::protocol::ObjectValue* CreateScene::release_props() {
+inline ::protocol::Dimension* Style::release_min_height() {
   
-  ::protocol::ObjectValue* temp = props_;
-  props_ = nullptr;
-  if (GetArena() != nullptr) {
+  ::protocol::Dimension* temp = _impl_.min_height_;
+  _impl_.min_height_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::protocol::ObjectValue* CreateScene::unsafe_arena_release_props() {
-  // @@protoc_insertion_point(field_release:protocol.CreateScene.props)
+inline ::protocol::Dimension* Style::unsafe_arena_release_min_height() {
+  // @@protoc_insertion_point(field_release:protocol.Style.min_height)
   
-  ::protocol::ObjectValue* temp = props_;
-  props_ = nullptr;
+  ::protocol::Dimension* temp = _impl_.min_height_;
+  _impl_.min_height_ = nullptr;
   return temp;
 }
-inline ::protocol::ObjectValue* CreateScene::_internal_mutable_props() {
+inline ::protocol::Dimension* Style::_internal_mutable_min_height() {
   
-  if (props_ == nullptr) {
-    auto* p = CreateMaybeMessage<::protocol::ObjectValue>(GetArena());
-    props_ = p;
+  if (_impl_.min_height_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.min_height_ = p;
   }
-  return props_;
+  return _impl_.min_height_;
 }
-inline ::protocol::ObjectValue* CreateScene::mutable_props() {
-  // @@protoc_insertion_point(field_mutable:protocol.CreateScene.props)
-  return _internal_mutable_props();
+inline ::protocol::Dimension* Style::mutable_min_height() {
+  ::protocol::Dimension* _msg = _internal_mutable_min_height();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.min_height)
+  return _msg;
 }
-inline void CreateScene::set_allocated_props(::protocol::ObjectValue* props) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+inline void Style::set_allocated_min_height(::protocol::Dimension* min_height) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete props_;
+    delete _impl_.min_height_;
   }
-  if (props) {
+  if (min_height) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(props);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(min_height);
     if (message_arena != submessage_arena) {
-      props = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, props, submessage_arena);
+      min_height = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, min_height, submessage_arena);
     }
     
   } else {
     
   }
-  props_ = props;
-  // @@protoc_insertion_point(field_set_allocated:protocol.CreateScene.props)
+  _impl_.min_height_ = min_height;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.min_height)
 }
 
-// -------------------------------------------------------------------
-
-// AppendChild
-
-// string parent_uid = 1;
-inline void AppendChild::clear_parent_uid() {
-  parent_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& AppendChild::parent_uid() const {
-  // @@protoc_insertion_point(field_get:protocol.AppendChild.parent_uid)
-  return _internal_parent_uid();
+// .protocol.Dimension max_height = 33;
+inline bool Style::_internal_has_max_height() const {
+  return this != internal_default_instance() && _impl_.max_height_ != nullptr;
 }
-inline void AppendChild::set_parent_uid(const std::string& value) {
-  _internal_set_parent_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.AppendChild.parent_uid)
+inline bool Style::has_max_height() const {
+  return _internal_has_max_height();
 }
-inline std::string* AppendChild::mutable_parent_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.AppendChild.parent_uid)
-  return _internal_mutable_parent_uid();
+inline void Style::clear_max_height() {
+  if (GetArenaForAllocation() == nullptr && _impl_.max_height_ != nullptr) {
+    delete _impl_.max_height_;
+  }
+  _impl_.max_height_ = nullptr;
 }
-inline const std::string& AppendChild::_internal_parent_uid() const {
-  return parent_uid_.Get();
+inline const ::protocol::Dimension& Style::_internal_max_height() const {
+  const ::protocol::Dimension* p = _impl_.max_height_;
+  return p != nullptr ? *p : reinterpret_cast<const ::protocol::Dimension&>(
+      ::protocol::_Dimension_default_instance_);
 }
-inline void AppendChild::_internal_set_parent_uid(const std::string& value) {
-  
-  parent_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::protocol::Dimension& Style::max_height() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.max_height)
+  return _internal_max_height();
 }
-inline void AppendChild::set_parent_uid(std::string&& value) {
-  
-  parent_uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.AppendChild.parent_uid)
+inline void Style::unsafe_arena_set_allocated_max_height(
+    ::protocol::Dimension* max_height) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.max_height_);
+  }
+  _impl_.max_height_ = max_height;
+  if (max_height) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Style.max_height)
 }
-inline void AppendChild::set_parent_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
+inline ::protocol::Dimension* Style::release_max_height() {
   
-  parent_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.AppendChild.parent_uid)
+  ::protocol::Dimension* temp = _impl_.max_height_;
+  _impl_.max_height_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void AppendChild::set_parent_uid(const char* value,
-    size_t size) {
+inline ::protocol::Dimension* Style::unsafe_arena_release_max_height() {
+  // @@protoc_insertion_point(field_release:protocol.Style.max_height)
   
-  parent_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.AppendChild.parent_uid)
+  ::protocol::Dimension* temp = _impl_.max_height_;
+  _impl_.max_height_ = nullptr;
+  return temp;
 }
-inline std::string* AppendChild::_internal_mutable_parent_uid() {
+inline ::protocol::Dimension* Style::_internal_mutable_max_height() {
   
-  return parent_uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (_impl_.max_height_ == nullptr) {
+    auto* p = CreateMaybeMessage<::protocol::Dimension>(GetArenaForAllocation());
+    _impl_.max_height_ = p;
+  }
+  return _impl_.max_height_;
 }
-inline std::string* AppendChild::release_parent_uid() {
-  // @@protoc_insertion_point(field_release:protocol.AppendChild.parent_uid)
-  return parent_uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Dimension* Style::mutable_max_height() {
+  ::protocol::Dimension* _msg = _internal_mutable_max_height();
+  // @@protoc_insertion_point(field_mutable:protocol.Style.max_height)
+  return _msg;
 }
-inline void AppendChild::set_allocated_parent_uid(std::string* parent_uid) {
-  if (parent_uid != nullptr) {
+inline void Style::set_allocated_max_height(::protocol::Dimension* max_height) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.max_height_;
+  }
+  if (max_height) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(max_height);
+    if (message_arena != submessage_arena) {
+      max_height = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, max_height, submessage_arena);
+    }
     
   } else {
     
   }
-  parent_uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), parent_uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.AppendChild.parent_uid)
+  _impl_.max_height_ = max_height;
+  // @@protoc_insertion_point(field_set_allocated:protocol.Style.max_height)
 }
 
-// string child_uid = 2;
-inline void AppendChild::clear_child_uid() {
-  child_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// int32 z_index = 36;
+inline void Style::clear_z_index() {
+  _impl_.z_index_ = 0;
 }
-inline const std::string& AppendChild::child_uid() const {
-  // @@protoc_insertion_point(field_get:protocol.AppendChild.child_uid)
-  return _internal_child_uid();
+inline int32_t Style::_internal_z_index() const {
+  return _impl_.z_index_;
 }
-inline void AppendChild::set_child_uid(const std::string& value) {
-  _internal_set_child_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.AppendChild.child_uid)
+inline int32_t Style::z_index() const {
+  // @@protoc_insertion_point(field_get:protocol.Style.z_index)
+  return _internal_z_index();
 }
-inline std::string* AppendChild::mutable_child_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.AppendChild.child_uid)
-  return _internal_mutable_child_uid();
+inline void Style::_internal_set_z_index(int32_t value) {
+  
+  _impl_.z_index_ = value;
 }
-inline const std::string& AppendChild::_internal_child_uid() const {
-  return child_uid_.Get();
+inline void Style::set_z_index(int32_t value) {
+  _internal_set_z_index(value);
+  // @@protoc_insertion_point(field_set:protocol.Style.z_index)
 }
-inline void AppendChild::_internal_set_child_uid(const std::string& value) {
-  
-  child_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+
+// -------------------------------------------------------------------
+
+// SetLayoutValues
+
+// repeated uint32 handles = 1;
+inline int SetLayoutValues::_internal_handles_size() const {
+  return _impl_.handles_.size();
 }
-inline void AppendChild::set_child_uid(std::string&& value) {
-  
-  child_uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.AppendChild.child_uid)
+inline int SetLayoutValues::handles_size() const {
+  return _internal_handles_size();
 }
-inline void AppendChild::set_child_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  child_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.AppendChild.child_uid)
+inline void SetLayoutValues::clear_handles() {
+  _impl_.handles_.Clear();
 }
-inline void AppendChild::set_child_uid(const char* value,
-    size_t size) {
-  
-  child_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.AppendChild.child_uid)
+inline uint32_t SetLayoutValues::_internal_handles(int index) const {
+  return _impl_.handles_.Get(index);
 }
-inline std::string* AppendChild::_internal_mutable_child_uid() {
-  
-  return child_uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline uint32_t SetLayoutValues::handles(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.SetLayoutValues.handles)
+  return _internal_handles(index);
 }
-inline std::string* AppendChild::release_child_uid() {
-  // @@protoc_insertion_point(field_release:protocol.AppendChild.child_uid)
-  return child_uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void SetLayoutValues::set_handles(int index, uint32_t value) {
+  _impl_.handles_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protocol.SetLayoutValues.handles)
 }
-inline void AppendChild::set_allocated_child_uid(std::string* child_uid) {
-  if (child_uid != nullptr) {
-    
-  } else {
-    
-  }
-  child_uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), child_uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.AppendChild.child_uid)
+inline void SetLayoutValues::_internal_add_handles(uint32_t value) {
+  _impl_.handles_.Add(value);
+}
+inline void SetLayoutValues::add_handles(uint32_t value) {
+  _internal_add_handles(value);
+  // @@protoc_insertion_point(field_add:protocol.SetLayoutValues.handles)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SetLayoutValues::_internal_handles() const {
+  return _impl_.handles_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SetLayoutValues::handles() const {
+  // @@protoc_insertion_point(field_list:protocol.SetLayoutValues.handles)
+  return _internal_handles();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SetLayoutValues::_internal_mutable_handles() {
+  return &_impl_.handles_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SetLayoutValues::mutable_handles() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.SetLayoutValues.handles)
+  return _internal_mutable_handles();
 }
 
-// -------------------------------------------------------------------
-
-// RemoveChild
-
-// string parent_uid = 1;
-inline void RemoveChild::clear_parent_uid() {
-  parent_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated uint32 prop_ids = 2;
+inline int SetLayoutValues::_internal_prop_ids_size() const {
+  return _impl_.prop_ids_.size();
 }
-inline const std::string& RemoveChild::parent_uid() const {
-  // @@protoc_insertion_point(field_get:protocol.RemoveChild.parent_uid)
-  return _internal_parent_uid();
+inline int SetLayoutValues::prop_ids_size() const {
+  return _internal_prop_ids_size();
 }
-inline void RemoveChild::set_parent_uid(const std::string& value) {
-  _internal_set_parent_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.RemoveChild.parent_uid)
+inline void SetLayoutValues::clear_prop_ids() {
+  _impl_.prop_ids_.Clear();
 }
-inline std::string* RemoveChild::mutable_parent_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.RemoveChild.parent_uid)
-  return _internal_mutable_parent_uid();
+inline uint32_t SetLayoutValues::_internal_prop_ids(int index) const {
+  return _impl_.prop_ids_.Get(index);
 }
-inline const std::string& RemoveChild::_internal_parent_uid() const {
-  return parent_uid_.Get();
+inline uint32_t SetLayoutValues::prop_ids(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.SetLayoutValues.prop_ids)
+  return _internal_prop_ids(index);
 }
-inline void RemoveChild::_internal_set_parent_uid(const std::string& value) {
-  
-  parent_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void SetLayoutValues::set_prop_ids(int index, uint32_t value) {
+  _impl_.prop_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protocol.SetLayoutValues.prop_ids)
 }
-inline void RemoveChild::set_parent_uid(std::string&& value) {
-  
-  parent_uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.RemoveChild.parent_uid)
+inline void SetLayoutValues::_internal_add_prop_ids(uint32_t value) {
+  _impl_.prop_ids_.Add(value);
 }
-inline void RemoveChild::set_parent_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  parent_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.RemoveChild.parent_uid)
+inline void SetLayoutValues::add_prop_ids(uint32_t value) {
+  _internal_add_prop_ids(value);
+  // @@protoc_insertion_point(field_add:protocol.SetLayoutValues.prop_ids)
 }
-inline void RemoveChild::set_parent_uid(const char* value,
-    size_t size) {
-  
-  parent_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.RemoveChild.parent_uid)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SetLayoutValues::_internal_prop_ids() const {
+  return _impl_.prop_ids_;
 }
-inline std::string* RemoveChild::_internal_mutable_parent_uid() {
-  
-  return parent_uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+SetLayoutValues::prop_ids() const {
+  // @@protoc_insertion_point(field_list:protocol.SetLayoutValues.prop_ids)
+  return _internal_prop_ids();
 }
-inline std::string* RemoveChild::release_parent_uid() {
-  // @@protoc_insertion_point(field_release:protocol.RemoveChild.parent_uid)
-  return parent_uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SetLayoutValues::_internal_mutable_prop_ids() {
+  return &_impl_.prop_ids_;
 }
-inline void RemoveChild::set_allocated_parent_uid(std::string* parent_uid) {
-  if (parent_uid != nullptr) {
-    
-  } else {
-    
-  }
-  parent_uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), parent_uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.RemoveChild.parent_uid)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+SetLayoutValues::mutable_prop_ids() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.SetLayoutValues.prop_ids)
+  return _internal_mutable_prop_ids();
 }
 
-// string child_uid = 2;
-inline void RemoveChild::clear_child_uid() {
-  child_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated float values = 3;
+inline int SetLayoutValues::_internal_values_size() const {
+  return _impl_.values_.size();
 }
-inline const std::string& RemoveChild::child_uid() const {
-  // @@protoc_insertion_point(field_get:protocol.RemoveChild.child_uid)
-  return _internal_child_uid();
+inline int SetLayoutValues::values_size() const {
+  return _internal_values_size();
 }
-inline void RemoveChild::set_child_uid(const std::string& value) {
-  _internal_set_child_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.RemoveChild.child_uid)
+inline void SetLayoutValues::clear_values() {
+  _impl_.values_.Clear();
 }
-inline std::string* RemoveChild::mutable_child_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.RemoveChild.child_uid)
-  return _internal_mutable_child_uid();
+inline float SetLayoutValues::_internal_values(int index) const {
+  return _impl_.values_.Get(index);
 }
-inline const std::string& RemoveChild::_internal_child_uid() const {
-  return child_uid_.Get();
+inline float SetLayoutValues::values(int index) const {
+  // @@protoc_insertion_point(field_get:protocol.SetLayoutValues.values)
+  return _internal_values(index);
 }
-inline void RemoveChild::_internal_set_child_uid(const std::string& value) {
-  
-  child_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline void SetLayoutValues::set_values(int index, float value) {
+  _impl_.values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protocol.SetLayoutValues.values)
 }
-inline void RemoveChild::set_child_uid(std::string&& value) {
-  
-  child_uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.RemoveChild.child_uid)
+inline void SetLayoutValues::_internal_add_values(float value) {
+  _impl_.values_.Add(value);
 }
-inline void RemoveChild::set_child_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  child_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.RemoveChild.child_uid)
+inline void SetLayoutValues::add_values(float value) {
+  _internal_add_values(value);
+  // @@protoc_insertion_point(field_add:protocol.SetLayoutValues.values)
 }
-inline void RemoveChild::set_child_uid(const char* value,
-    size_t size) {
-  
-  child_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.RemoveChild.child_uid)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SetLayoutValues::_internal_values() const {
+  return _impl_.values_;
 }
-inline std::string* RemoveChild::_internal_mutable_child_uid() {
-  
-  return child_uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SetLayoutValues::values() const {
+  // @@protoc_insertion_point(field_list:protocol.SetLayoutValues.values)
+  return _internal_values();
 }
-inline std::string* RemoveChild::release_child_uid() {
-  // @@protoc_insertion_point(field_release:protocol.RemoveChild.child_uid)
-  return child_uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SetLayoutValues::_internal_mutable_values() {
+  return &_impl_.values_;
 }
-inline void RemoveChild::set_allocated_child_uid(std::string* child_uid) {
-  if (child_uid != nullptr) {
-    
-  } else {
-    
-  }
-  child_uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), child_uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.RemoveChild.child_uid)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SetLayoutValues::mutable_values() {
+  // @@protoc_insertion_point(field_mutable_list:protocol.SetLayoutValues.values)
+  return _internal_mutable_values();
 }
 
 // -------------------------------------------------------------------
 
-// CommitUpdates
+// Dimension
 
-// string container_uid = 1;
-inline void CommitUpdates::clear_container_uid() {
-  container_uid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// float value = 1;
+inline void Dimension::clear_value() {
+  _impl_.value_ = 0;
 }
-inline const std::string& CommitUpdates::container_uid() const {
-  // @@protoc_insertion_point(field_get:protocol.CommitUpdates.container_uid)
-  return _internal_container_uid();
-}
-inline void CommitUpdates::set_container_uid(const std::string& value) {
-  _internal_set_container_uid(value);
-  // @@protoc_insertion_point(field_set:protocol.CommitUpdates.container_uid)
-}
-inline std::string* CommitUpdates::mutable_container_uid() {
-  // @@protoc_insertion_point(field_mutable:protocol.CommitUpdates.container_uid)
-  return _internal_mutable_container_uid();
+inline float Dimension::_internal_value() const {
+  return _impl_.value_;
 }
-inline const std::string& CommitUpdates::_internal_container_uid() const {
-  return container_uid_.Get();
+inline float Dimension::value() const {
+  // @@protoc_insertion_point(field_get:protocol.Dimension.value)
+  return _internal_value();
 }
-inline void CommitUpdates::_internal_set_container_uid(const std::string& value) {
+inline void Dimension::_internal_set_value(float value) {
   
-  container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  _impl_.value_ = value;
 }
-inline void CommitUpdates::set_container_uid(std::string&& value) {
-  
-  container_uid_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.CommitUpdates.container_uid)
+inline void Dimension::set_value(float value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:protocol.Dimension.value)
 }
-inline void CommitUpdates::set_container_uid(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.CommitUpdates.container_uid)
+
+// .protocol.Unit unit = 2;
+inline void Dimension::clear_unit() {
+  _impl_.unit_ = 0;
 }
-inline void CommitUpdates::set_container_uid(const char* value,
-    size_t size) {
-  
-  container_uid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.CommitUpdates.container_uid)
+inline ::protocol::Unit Dimension::_internal_unit() const {
+  return static_cast< ::protocol::Unit >(_impl_.unit_);
 }
-inline std::string* CommitUpdates::_internal_mutable_container_uid() {
-  
-  return container_uid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline ::protocol::Unit Dimension::unit() const {
+  // @@protoc_insertion_point(field_get:protocol.Dimension.unit)
+  return _internal_unit();
 }
-inline std::string* CommitUpdates::release_container_uid() {
-  // @@protoc_insertion_point(field_release:protocol.CommitUpdates.container_uid)
-  return container_uid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void Dimension::_internal_set_unit(::protocol::Unit value) {
+  
+  _impl_.unit_ = value;
 }
-inline void CommitUpdates::set_allocated_container_uid(std::string* container_uid) {
-  if (container_uid != nullptr) {
-    
-  } else {
-    
-  }
-  container_uid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), container_uid,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:protocol.CommitUpdates.container_uid)
+inline void Dimension::set_unit(::protocol::Unit value) {
+  _internal_set_unit(value);
+  // @@protoc_insertion_point(field_set:protocol.Dimension.unit)
 }
 
 // -------------------------------------------------------------------
@@ -5195,54 +13017,38 @@ inline void CommitUpdates::set_allocated_container_uid(std::string* container_ui
 
 // string key = 1;
 inline void Prop::clear_key() {
-  key_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  _impl_.key_.ClearToEmpty();
 }
 inline const std::string& Prop::key() const {
   // @@protoc_insertion_point(field_get:protocol.Prop.key)
   return _internal_key();
 }
-inline void Prop::set_key(const std::string& value) {
-  _internal_set_key(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Prop::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:protocol.Prop.key)
 }
 inline std::string* Prop::mutable_key() {
+  std::string* _s = _internal_mutable_key();
   // @@protoc_insertion_point(field_mutable:protocol.Prop.key)
-  return _internal_mutable_key();
+  return _s;
 }
 inline const std::string& Prop::_internal_key() const {
-  return key_.Get();
+  return _impl_.key_.Get();
 }
 inline void Prop::_internal_set_key(const std::string& value) {
   
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void Prop::set_key(std::string&& value) {
-  
-  key_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.Prop.key)
-}
-inline void Prop::set_key(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.Prop.key)
-}
-inline void Prop::set_key(const char* value,
-    size_t size) {
-  
-  key_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.Prop.key)
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Prop::_internal_mutable_key() {
   
-  return key_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Prop::release_key() {
   // @@protoc_insertion_point(field_release:protocol.Prop.key)
-  return key_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.key_.Release();
 }
 inline void Prop::set_allocated_key(std::string* key) {
   if (key != nullptr) {
@@ -5250,21 +13056,48 @@ inline void Prop::set_allocated_key(std::string* key) {
   } else {
     
   }
-  key_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), key,
-      GetArena());
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:protocol.Prop.key)
 }
 
+// uint32 key_id = 8;
+inline void Prop::clear_key_id() {
+  _impl_.key_id_ = 0u;
+}
+inline uint32_t Prop::_internal_key_id() const {
+  return _impl_.key_id_;
+}
+inline uint32_t Prop::key_id() const {
+  // @@protoc_insertion_point(field_get:protocol.Prop.key_id)
+  return _internal_key_id();
+}
+inline void Prop::_internal_set_key_id(uint32_t value) {
+  
+  _impl_.key_id_ = value;
+}
+inline void Prop::set_key_id(uint32_t value) {
+  _internal_set_key_id(value);
+  // @@protoc_insertion_point(field_set:protocol.Prop.key_id)
+}
+
 // string string_value = 2;
 inline bool Prop::_internal_has_string_value() const {
   return value_case() == kStringValue;
 }
+inline bool Prop::has_string_value() const {
+  return _internal_has_string_value();
+}
 inline void Prop::set_has_string_value() {
-  _oneof_case_[0] = kStringValue;
+  _impl_._oneof_case_[0] = kStringValue;
 }
 inline void Prop::clear_string_value() {
   if (_internal_has_string_value()) {
-    value_.string_value_.Destroy(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+    _impl_.value_.string_value_.Destroy();
     clear_has_value();
   }
 }
@@ -5272,76 +13105,48 @@ inline const std::string& Prop::string_value() const {
   // @@protoc_insertion_point(field_get:protocol.Prop.string_value)
   return _internal_string_value();
 }
-inline void Prop::set_string_value(const std::string& value) {
-  _internal_set_string_value(value);
+template <typename ArgT0, typename... ArgT>
+inline void Prop::set_string_value(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_string_value()) {
+    clear_value();
+    set_has_string_value();
+    _impl_.value_.string_value_.InitDefault();
+  }
+  _impl_.value_.string_value_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:protocol.Prop.string_value)
 }
 inline std::string* Prop::mutable_string_value() {
+  std::string* _s = _internal_mutable_string_value();
   // @@protoc_insertion_point(field_mutable:protocol.Prop.string_value)
-  return _internal_mutable_string_value();
+  return _s;
 }
 inline const std::string& Prop::_internal_string_value() const {
   if (_internal_has_string_value()) {
-    return value_.string_value_.Get();
+    return _impl_.value_.string_value_.Get();
   }
-  return *&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
 }
 inline void Prop::_internal_set_string_value(const std::string& value) {
   if (!_internal_has_string_value()) {
     clear_value();
     set_has_string_value();
-    value_.string_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  value_.string_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void Prop::set_string_value(std::string&& value) {
-  // @@protoc_insertion_point(field_set:protocol.Prop.string_value)
-  if (!_internal_has_string_value()) {
-    clear_value();
-    set_has_string_value();
-    value_.string_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  value_.string_value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:protocol.Prop.string_value)
-}
-inline void Prop::set_string_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  if (!_internal_has_string_value()) {
-    clear_value();
-    set_has_string_value();
-    value_.string_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.string_value_.InitDefault();
   }
-  value_.string_value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:protocol.Prop.string_value)
-}
-inline void Prop::set_string_value(const char* value,
-                             size_t size) {
-  if (!_internal_has_string_value()) {
-    clear_value();
-    set_has_string_value();
-    value_.string_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  }
-  value_.string_value_.Set(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size),
-      GetArena());
-  // @@protoc_insertion_point(field_set_pointer:protocol.Prop.string_value)
+  _impl_.value_.string_value_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Prop::_internal_mutable_string_value() {
   if (!_internal_has_string_value()) {
     clear_value();
     set_has_string_value();
-    value_.string_value_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+    _impl_.value_.string_value_.InitDefault();
   }
-  return value_.string_value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return _impl_.value_.string_value_.Mutable(      GetArenaForAllocation());
 }
 inline std::string* Prop::release_string_value() {
   // @@protoc_insertion_point(field_release:protocol.Prop.string_value)
   if (_internal_has_string_value()) {
     clear_has_value();
-    return value_.string_value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+    return _impl_.value_.string_value_.Release();
   } else {
     return nullptr;
   }
@@ -5352,11 +13157,7 @@ inline void Prop::set_allocated_string_value(std::string* string_value) {
   }
   if (string_value != nullptr) {
     set_has_string_value();
-    value_.string_value_.UnsafeSetDefault(string_value);
-    ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena();
-    if (arena != nullptr) {
-      arena->Own(string_value);
-    }
+    _impl_.value_.string_value_.InitAllocated(string_value, GetArenaForAllocation());
   }
   // @@protoc_insertion_point(field_set_allocated:protocol.Prop.string_value)
 }
@@ -5365,33 +13166,36 @@ inline void Prop::set_allocated_string_value(std::string* string_value) {
 inline bool Prop::_internal_has_int_value() const {
   return value_case() == kIntValue;
 }
+inline bool Prop::has_int_value() const {
+  return _internal_has_int_value();
+}
 inline void Prop::set_has_int_value() {
-  _oneof_case_[0] = kIntValue;
+  _impl_._oneof_case_[0] = kIntValue;
 }
 inline void Prop::clear_int_value() {
   if (_internal_has_int_value()) {
-    value_.int_value_ = PROTOBUF_LONGLONG(0);
+    _impl_.value_.int_value_ = int64_t{0};
     clear_has_value();
   }
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 Prop::_internal_int_value() const {
+inline int64_t Prop::_internal_int_value() const {
   if (_internal_has_int_value()) {
-    return value_.int_value_;
+    return _impl_.value_.int_value_;
   }
-  return PROTOBUF_LONGLONG(0);
+  return int64_t{0};
 }
-inline void Prop::_internal_set_int_value(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void Prop::_internal_set_int_value(int64_t value) {
   if (!_internal_has_int_value()) {
     clear_value();
     set_has_int_value();
   }
-  value_.int_value_ = value;
+  _impl_.value_.int_value_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int64 Prop::int_value() const {
+inline int64_t Prop::int_value() const {
   // @@protoc_insertion_point(field_get:protocol.Prop.int_value)
   return _internal_int_value();
 }
-inline void Prop::set_int_value(::PROTOBUF_NAMESPACE_ID::int64 value) {
+inline void Prop::set_int_value(int64_t value) {
   _internal_set_int_value(value);
   // @@protoc_insertion_point(field_set:protocol.Prop.int_value)
 }
@@ -5400,18 +13204,21 @@ inline void Prop::set_int_value(::PROTOBUF_NAMESPACE_ID::int64 value) {
 inline bool Prop::_internal_has_float_value() const {
   return value_case() == kFloatValue;
 }
+inline bool Prop::has_float_value() const {
+  return _internal_has_float_value();
+}
 inline void Prop::set_has_float_value() {
-  _oneof_case_[0] = kFloatValue;
+  _impl_._oneof_case_[0] = kFloatValue;
 }
 inline void Prop::clear_float_value() {
   if (_internal_has_float_value()) {
-    value_.float_value_ = 0;
+    _impl_.value_.float_value_ = 0;
     clear_has_value();
   }
 }
 inline double Prop::_internal_float_value() const {
   if (_internal_has_float_value()) {
-    return value_.float_value_;
+    return _impl_.value_.float_value_;
   }
   return 0;
 }
@@ -5420,7 +13227,7 @@ inline void Prop::_internal_set_float_value(double value) {
     clear_value();
     set_has_float_value();
   }
-  value_.float_value_ = value;
+  _impl_.value_.float_value_ = value;
 }
 inline double Prop::float_value() const {
   // @@protoc_insertion_point(field_get:protocol.Prop.float_value)
@@ -5435,18 +13242,21 @@ inline void Prop::set_float_value(double value) {
 inline bool Prop::_internal_has_bool_value() const {
   return value_case() == kBoolValue;
 }
+inline bool Prop::has_bool_value() const {
+  return _internal_has_bool_value();
+}
 inline void Prop::set_has_bool_value() {
-  _oneof_case_[0] = kBoolValue;
+  _impl_._oneof_case_[0] = kBoolValue;
 }
 inline void Prop::clear_bool_value() {
   if (_internal_has_bool_value()) {
-    value_.bool_value_ = false;
+    _impl_.value_.bool_value_ = false;
     clear_has_value();
   }
 }
 inline bool Prop::_internal_bool_value() const {
   if (_internal_has_bool_value()) {
-    return value_.bool_value_;
+    return _impl_.value_.bool_value_;
   }
   return false;
 }
@@ -5455,7 +13265,7 @@ inline void Prop::_internal_set_bool_value(bool value) {
     clear_value();
     set_has_bool_value();
   }
-  value_.bool_value_ = value;
+  _impl_.value_.bool_value_ = value;
 }
 inline bool Prop::bool_value() const {
   // @@protoc_insertion_point(field_get:protocol.Prop.bool_value)
@@ -5474,12 +13284,12 @@ inline bool Prop::has_object_value() const {
   return _internal_has_object_value();
 }
 inline void Prop::set_has_object_value() {
-  _oneof_case_[0] = kObjectValue;
+  _impl_._oneof_case_[0] = kObjectValue;
 }
 inline void Prop::clear_object_value() {
   if (_internal_has_object_value()) {
-    if (GetArena() == nullptr) {
-      delete value_.object_value_;
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.value_.object_value_;
     }
     clear_has_value();
   }
@@ -5488,11 +13298,11 @@ inline ::protocol::ObjectValue* Prop::release_object_value() {
   // @@protoc_insertion_point(field_release:protocol.Prop.object_value)
   if (_internal_has_object_value()) {
     clear_has_value();
-      ::protocol::ObjectValue* temp = value_.object_value_;
-    if (GetArena() != nullptr) {
+    ::protocol::ObjectValue* temp = _impl_.value_.object_value_;
+    if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    value_.object_value_ = nullptr;
+    _impl_.value_.object_value_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -5500,8 +13310,8 @@ inline ::protocol::ObjectValue* Prop::release_object_value() {
 }
 inline const ::protocol::ObjectValue& Prop::_internal_object_value() const {
   return _internal_has_object_value()
-      ? *value_.object_value_
-      : *reinterpret_cast< ::protocol::ObjectValue*>(&::protocol::_ObjectValue_default_instance_);
+      ? *_impl_.value_.object_value_
+      : reinterpret_cast< ::protocol::ObjectValue&>(::protocol::_ObjectValue_default_instance_);
 }
 inline const ::protocol::ObjectValue& Prop::object_value() const {
   // @@protoc_insertion_point(field_get:protocol.Prop.object_value)
@@ -5511,8 +13321,8 @@ inline ::protocol::ObjectValue* Prop::unsafe_arena_release_object_value() {
   // @@protoc_insertion_point(field_unsafe_arena_release:protocol.Prop.object_value)
   if (_internal_has_object_value()) {
     clear_has_value();
-    ::protocol::ObjectValue* temp = value_.object_value_;
-    value_.object_value_ = nullptr;
+    ::protocol::ObjectValue* temp = _impl_.value_.object_value_;
+    _impl_.value_.object_value_ = nullptr;
     return temp;
   } else {
     return nullptr;
@@ -5522,7 +13332,7 @@ inline void Prop::unsafe_arena_set_allocated_object_value(::protocol::ObjectValu
   clear_value();
   if (object_value) {
     set_has_object_value();
-    value_.object_value_ = object_value;
+    _impl_.value_.object_value_ = object_value;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protocol.Prop.object_value)
 }
@@ -5530,31 +13340,35 @@ inline ::protocol::ObjectValue* Prop::_internal_mutable_object_value() {
   if (!_internal_has_object_value()) {
     clear_value();
     set_has_object_value();
-    value_.object_value_ = CreateMaybeMessage< ::protocol::ObjectValue >(GetArena());
+    _impl_.value_.object_value_ = CreateMaybeMessage< ::protocol::ObjectValue >(GetArenaForAllocation());
   }
-  return value_.object_value_;
+  return _impl_.value_.object_value_;
 }
 inline ::protocol::ObjectValue* Prop::mutable_object_value() {
+  ::protocol::ObjectValue* _msg = _internal_mutable_object_value();
   // @@protoc_insertion_point(field_mutable:protocol.Prop.object_value)
-  return _internal_mutable_object_value();
+  return _msg;
 }
 
 // bool undefined = 7;
 inline bool Prop::_internal_has_undefined() const {
   return value_case() == kUndefined;
 }
+inline bool Prop::has_undefined() const {
+  return _internal_has_undefined();
+}
 inline void Prop::set_has_undefined() {
-  _oneof_case_[0] = kUndefined;
+  _impl_._oneof_case_[0] = kUndefined;
 }
 inline void Prop::clear_undefined() {
   if (_internal_has_undefined()) {
-    value_.undefined_ = false;
+    _impl_.value_.undefined_ = false;
     clear_has_value();
   }
 }
 inline bool Prop::_internal_undefined() const {
   if (_internal_has_undefined()) {
-    return value_.undefined_;
+    return _impl_.value_.undefined_;
   }
   return false;
 }
@@ -5563,7 +13377,7 @@ inline void Prop::_internal_set_undefined(bool value) {
     clear_value();
     set_has_undefined();
   }
-  value_.undefined_ = value;
+  _impl_.value_.undefined_ = value;
 }
 inline bool Prop::undefined() const {
   // @@protoc_insertion_point(field_get:protocol.Prop.undefined)
@@ -5574,14 +13388,52 @@ inline void Prop::set_undefined(bool value) {
   // @@protoc_insertion_point(field_set:protocol.Prop.undefined)
 }
 
+// uint32 string_id = 9;
+inline bool Prop::_internal_has_string_id() const {
+  return value_case() == kStringId;
+}
+inline bool Prop::has_string_id() const {
+  return _internal_has_string_id();
+}
+inline void Prop::set_has_string_id() {
+  _impl_._oneof_case_[0] = kStringId;
+}
+inline void Prop::clear_string_id() {
+  if (_internal_has_string_id()) {
+    _impl_.value_.string_id_ = 0u;
+    clear_has_value();
+  }
+}
+inline uint32_t Prop::_internal_string_id() const {
+  if (_internal_has_string_id()) {
+    return _impl_.value_.string_id_;
+  }
+  return 0u;
+}
+inline void Prop::_internal_set_string_id(uint32_t value) {
+  if (!_internal_has_string_id()) {
+    clear_value();
+    set_has_string_id();
+  }
+  _impl_.value_.string_id_ = value;
+}
+inline uint32_t Prop::string_id() const {
+  // @@protoc_insertion_point(field_get:protocol.Prop.string_id)
+  return _internal_string_id();
+}
+inline void Prop::set_string_id(uint32_t value) {
+  _internal_set_string_id(value);
+  // @@protoc_insertion_point(field_set:protocol.Prop.string_id)
+}
+
 inline bool Prop::has_value() const {
   return value_case() != VALUE_NOT_SET;
 }
 inline void Prop::clear_has_value() {
-  _oneof_case_[0] = VALUE_NOT_SET;
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
 }
 inline Prop::ValueCase Prop::value_case() const {
-  return Prop::ValueCase(_oneof_case_[0]);
+  return Prop::ValueCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -5589,41 +13441,42 @@ inline Prop::ValueCase Prop::value_case() const {
 
 // repeated .protocol.Prop props = 1;
 inline int ObjectValue::_internal_props_size() const {
-  return props_.size();
+  return _impl_.props_.size();
 }
 inline int ObjectValue::props_size() const {
   return _internal_props_size();
 }
 inline void ObjectValue::clear_props() {
-  props_.Clear();
+  _impl_.props_.Clear();
 }
 inline ::protocol::Prop* ObjectValue::mutable_props(int index) {
   // @@protoc_insertion_point(field_mutable:protocol.ObjectValue.props)
-  return props_.Mutable(index);
+  return _impl_.props_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::Prop >*
 ObjectValue::mutable_props() {
   // @@protoc_insertion_point(field_mutable_list:protocol.ObjectValue.props)
-  return &props_;
+  return &_impl_.props_;
 }
 inline const ::protocol::Prop& ObjectValue::_internal_props(int index) const {
-  return props_.Get(index);
+  return _impl_.props_.Get(index);
 }
 inline const ::protocol::Prop& ObjectValue::props(int index) const {
   // @@protoc_insertion_point(field_get:protocol.ObjectValue.props)
   return _internal_props(index);
 }
 inline ::protocol::Prop* ObjectValue::_internal_add_props() {
-  return props_.Add();
+  return _impl_.props_.Add();
 }
 inline ::protocol::Prop* ObjectValue::add_props() {
+  ::protocol::Prop* _add = _internal_add_props();
   // @@protoc_insertion_point(field_add:protocol.ObjectValue.props)
-  return _internal_add_props();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::protocol::Prop >&
 ObjectValue::props() const {
   // @@protoc_insertion_point(field_list:protocol.ObjectValue.props)
-  return props_;
+  return _impl_.props_;
 }
 
 #ifdef __GNUC__
@@ -5657,11 +13510,97 @@ ObjectValue::props() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace protocol
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::protocol::Compression> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::Compression>() {
+  return ::protocol::Compression_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::LayoutValueFlags> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::LayoutValueFlags>() {
+  return ::protocol::LayoutValueFlags_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::Unit> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::Unit>() {
+  return ::protocol::Unit_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::FlexDirection> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::FlexDirection>() {
+  return ::protocol::FlexDirection_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::Direction> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::Direction>() {
+  return ::protocol::Direction_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::Justify> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::Justify>() {
+  return ::protocol::Justify_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::Align> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::Align>() {
+  return ::protocol::Align_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::PositionType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::PositionType>() {
+  return ::protocol::PositionType_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::Wrap> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::Wrap>() {
+  return ::protocol::Wrap_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::Overflow> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::Overflow>() {
+  return ::protocol::Overflow_descriptor();
+}
+template <> struct is_proto_enum< ::protocol::Display> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::protocol::Display>() {
+  return ::protocol::Display_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -0,0 +1,159 @@
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+
+// Prop keys and string values interned by a session (see `DefineKey` in
+// protocol.proto). Ids index flat arrays, so resolving one neither hashes nor
+// allocates. Only used under `render_mutex`, like the rest of the session.
+
+// Keeps a misbehaving client from growing the tables without bounds
+static constexpr uint32_t max_interned_id = 1 << 16;
+
+class InternTable {
+    // A deque, so that growing it keeps the strings `key_ids` points into
+    std::deque<std::string> keys;
+    std::vector<std::string> strings;
+
+    // Resolves a key to its id once per lookup, so props are compared by id.
+    // Every entry views the string of the id it maps to.
+    std::unordered_map<std::string_view, uint32_t> key_ids;
+
+    // Set once a key has been interned under two ids at the same time, after
+    // which comparing ids is not enough to tell whether two keys are equal
+    bool has_duplicate_keys = false;
+
+    static bool is_valid_id(uint32_t id) {
+        if (id == 0 || id >= max_interned_id) {
+            blog(LOG_ERROR, "[react-obs] Interned id %u is out of range", id);
+            return false;
+        }
+
+        return true;
+    }
+
+    template <class T>
+    static const std::string* lookup(const T &entries, uint32_t id) {
+        if (id == 0 || id >= entries.size()) {
+            return nullptr;
+        }
+
+        return &entries[id];
+    }
+
+    void check_prop(const protocol::Prop &prop) const {
+        if (prop.key_id() != 0 && !lookup(keys, prop.key_id())) {
+            blog(LOG_WARNING, "[react-obs] Prop key id %u has not been defined, ignoring the prop", prop.key_id());
+        }
+
+        switch (prop.value_case()) {
+            case protocol::Prop::ValueCase::kStringId:
+                if (!lookup(strings, prop.string_id())) {
+                    blog(LOG_WARNING, "[react-obs] String id %u has not been defined, ignoring the value", prop.string_id());
+                }
+                break;
+
+            case protocol::Prop::ValueCase::kObjectValue:
+                check_ids(prop.object_value());
+                break;
+
+            default:
+                break;
+        }
+    }
+
+public:
+    // Redefining a key keeps only its latest id
+    bool define_key(uint32_t id, const std::string &key) {
+        if (!is_valid_id(id)) {
+            return false;
+        }
+
+        if (keys.size() <= id) {
+            keys.resize(id + 1);
+        }
+
+        auto previous = key_ids.find(keys[id]);
+
+        if (previous != key_ids.end() && previous->second == id) {
+            key_ids.erase(previous);
+        }
+
+        // Replaced rather than assigned, as its view is of the other id's key
+        auto existing = key_ids.find(key);
+
+        if (existing != key_ids.end()) {
+            has_duplicate_keys = true;
+            key_ids.erase(existing);
+        }
+
+        keys[id] = key;
+        key_ids.emplace(keys[id], id);
+
+        return true;
+    }
+
+    bool define_string(uint32_t id, const std::string &value) {
+        if (!is_valid_id(id)) {
+            return false;
+        }
+
+        if (strings.size() <= id) {
+            strings.resize(id + 1);
+        }
+
+        strings[id] = value;
+
+        return true;
+    }
+
+    // Logs every id in the props which has not been defined. Called once when
+    // the props arrive, lookups treat such ids as missing without logging.
+    void check_ids(const protocol::ObjectValue &object) const {
+        for (const auto &prop : object.props()) {
+            check_prop(prop);
+        }
+    }
+
+    // The id a key has been interned with, 0 if none
+    uint32_t key_id(std::string_view key) const {
+        auto it = key_ids.find(key);
+
+        return it != key_ids.end() ? it->second : 0;
+    }
+
+    // Whether props with different key ids always have different keys
+    bool key_ids_are_unique() const {
+        return !has_duplicate_keys;
+    }
+
+    // The key of a prop, whether sent inline or interned. Props with an
+    // undefined key id get an empty key, which matches nothing.
+    const std::string& key(const protocol::Prop &prop) const {
+        static const std::string undefined_key;
+
+        if (prop.key_id() == 0) {
+            return prop.key();
+        }
+
+        auto key = lookup(keys, prop.key_id());
+
+        return key ? *key : undefined_key;
+    }
+
+    // The string value of a prop, or nullptr if it does not have one
+    const std::string* string(const protocol::Prop &prop) const {
+        switch (prop.value_case()) {
+            case protocol::Prop::ValueCase::kStringValue:
+                return &prop.string_value();
+
+            case protocol::Prop::ValueCase::kStringId:
+                return lookup(strings, prop.string_id());
+
+            default:
+                return nullptr;
+        }
+    }
+};
+
+// For prop maps which do not belong to a session, e.g. an empty style
+static const InternTable no_interned_values;
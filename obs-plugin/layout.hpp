@@ -7,10 +7,11 @@ void check_source_dimensions(ShadowSource* shadow) {
         shadow->previous_height = height;
 
         if (DEBUG_LAYOUT) {
-            blog(LOG_DEBUG, "[react-obs] [layout] Node %s changed dimensions to %i x %i", shadow->uid.c_str(), width, height);
+            blog(LOG_DEBUG, "[react-obs] [layout] Node %s changed dimensions to %i x %i", node_name(shadow->handle, shadow->uid).c_str(), width, height);
         }
 
         YGNodeMarkDirty(shadow->yoga_node);
+        queue_layout(shadow);
     }
 }
 
@@ -41,7 +42,7 @@ YGSize yoga_measure_function(
     auto measured_height = (float)obs_source_get_height(shadow->source);
 
     if (DEBUG_LAYOUT) {
-        blog(LOG_DEBUG, "[react-obs] [layout] Measuring %s to %f x %f . Params were %f x %f", shadow->uid.c_str(), measured_width, measured_height, width, height);
+        blog(LOG_DEBUG, "[react-obs] [layout] Measuring %s to %f x %f . Params were %f x %f", node_name(shadow->handle, shadow->uid).c_str(), measured_width, measured_height, width, height);
     }
 
     return YGSize {
@@ -58,7 +59,7 @@ void perform_layout(ShadowSource* container) {
     }
 
     if (DEBUG_LAYOUT) {
-        blog(LOG_DEBUG, "[react-obs] [layout] Performing layout on %s...", container->uid.c_str());
+        blog(LOG_DEBUG, "[react-obs] [layout] Performing layout on %s...", node_name(container->handle, container->uid).c_str());
     }
 
     YGNodeCalculateLayout(yoga_node, YGUndefined, YGUndefined, YGDirectionLTR);
@@ -92,7 +93,7 @@ void perform_layout(ShadowSource* container) {
         };
 
         if (DEBUG_LAYOUT) {
-            blog(LOG_DEBUG, "[react-obs] [layout] Node %s set to %f x %f", shadow->uid.c_str(), bounds.x, bounds.y);
+            blog(LOG_DEBUG, "[react-obs] [layout] Node %s set to %f x %f", node_name(shadow->handle, shadow->uid).c_str(), bounds.x, bounds.y);
         }
 
         obs_sceneitem_defer_update_begin(sceneitem);
@@ -107,7 +108,7 @@ void perform_layout(ShadowSource* container) {
     }
 }
 
-YGAlign stringToYogaAlign(const std::string &value) {
+YGAlign stringToYogaAlign(std::string_view value) {
     if (value == "auto") {
         return YGAlignAuto;
     } else if (value == "center") {
@@ -129,25 +130,42 @@ YGAlign stringToYogaAlign(const std::string &value) {
     }
 }
 
-void update_layout_props(const std::string &uid, const protocol::ObjectValue &propsObject) {
-    auto props = as_prop_map(propsObject.props());
-    auto shadow = get_shadow_source(uid);
+// The draw order of the parent is fixed up in the next video tick
+void set_z_index(ShadowSource* shadow, int32_t z_index) {
+    if (shadow->z_index == z_index) {
+        return;
+    }
+
+    shadow->z_index = z_index;
+
+    auto owner = YGNodeGetOwner(shadow->yoga_node);
+    auto parent = owner ? (ShadowSource*)YGNodeGetContext(owner) : nullptr;
+
+    if (parent) {
+        parent->has_z_indexed_children = true;
+        queue_draw_order(parent);
+    }
+}
+
+void update_layout_props(ShadowSource* shadow, const protocol::ObjectValue &propsObject) {
+    const auto &interned = shadow->session->interned;
+    auto props = as_prop_map(propsObject.props(), interned);
     auto yoga_node = shadow->yoga_node;
 
     // TODO: Set aspect ratio based on some heuristic?
 
     auto styleFind = props.find("style");
-    if (styleFind == props.end()) {
+    if (!styleFind) {
         return;
     }
 
-    auto styleValue = styleFind->second;
-    std::unordered_map<std::string, protocol::Prop> style;
+    const auto &styleValue = *styleFind;
+    PropMap style;
 
     if (styleValue.undefined()) {
         // Nothing to do, style is empty as it should
     } else {
-        auto styleOptional = as_object(styleValue);
+        auto styleOptional = as_object(interned, styleValue);
 
         if (!styleOptional.has_value()) {
             blog(LOG_ERROR, "[react-obs] Property styles must be an object, was %i", styleValue.value_case());
@@ -157,7 +175,7 @@ void update_layout_props(const std::string &uid, const protocol::ObjectValue &pr
         style = std::move(*styleOptional);
     }
 
-    assign_prop_default<std::string>(style, "flexDirection", as_string, "column", [yoga_node](auto value) {
+    assign_prop_default<std::string_view>(style, "flexDirection", as_string, "column", [yoga_node](auto value) {
         if (value == "row") {
             YGNodeStyleSetFlexDirection(yoga_node, YGFlexDirectionRow);
         } else if (value == "column") {
@@ -169,7 +187,7 @@ void update_layout_props(const std::string &uid, const protocol::ObjectValue &pr
         }
     });
 
-    assign_prop_default<std::string>(style, "direction", as_string, "inherit", [yoga_node](auto value) {
+    assign_prop_default<std::string_view>(style, "direction", as_string, "inherit", [yoga_node](auto value) {
         if (value == "ltr") {
             YGNodeStyleSetDirection(yoga_node, YGDirectionLTR);
         } else if (value == "rtl") {
@@ -179,7 +197,7 @@ void update_layout_props(const std::string &uid, const protocol::ObjectValue &pr
         }
     });
 
-    assign_prop_default<std::string>(style, "justifyContent", as_string, "flex-start", [yoga_node](auto value) {
+    assign_prop_default<std::string_view>(style, "justifyContent", as_string, "flex-start", [yoga_node](auto value) {
         if (value == "center") {
             YGNodeStyleSetJustifyContent(yoga_node, YGJustifyCenter);
         } else if (value == "flex-start") {
@@ -195,21 +213,21 @@ void update_layout_props(const std::string &uid, const protocol::ObjectValue &pr
         }
     });
 
-    assign_prop_default<std::string>(style, "alignContent", as_string, "flex-start", [yoga_node](auto value) {
+    assign_prop_default<std::string_view>(style, "alignContent", as_string, "flex-start", [yoga_node](auto value) {
         YGNodeStyleSetAlignContent(yoga_node, stringToYogaAlign(value));
     });
 
-    assign_prop_default<std::string>(style, "alignItems", as_string, "stretch", [yoga_node](auto value) {
+    assign_prop_default<std::string_view>(style, "alignItems", as_string, "stretch", [yoga_node](auto value) {
         YGNodeStyleSetAlignItems(yoga_node, stringToYogaAlign(value));
     });
 
-    assign_prop<std::string>(style, "alignSelf", as_string, [yoga_node](auto value) {
+    assign_prop<std::string_view>(style, "alignSelf", as_string, [yoga_node](auto value) {
         YGNodeStyleSetAlignSelf(yoga_node, stringToYogaAlign(value));
     }, [yoga_node]() {
         YGNodeStyleSetAlignSelf(yoga_node, YGAlignStretch);
     });
 
-    assign_prop_default<std::string>(style, "position", as_string, "static", [yoga_node](auto value) {
+    assign_prop_default<std::string_view>(style, "position", as_string, "static", [yoga_node](auto value) {
         if (value == "static") {
             YGNodeStyleSetPositionType(yoga_node, YGPositionTypeStatic);
         } else if (value == "relative") {
@@ -219,7 +237,7 @@ void update_layout_props(const std::string &uid, const protocol::ObjectValue &pr
         }
     });
 
-    assign_prop_default<std::string>(style, "flexWrap", as_string, "no-wrap", [yoga_node](auto value) {
+    assign_prop_default<std::string_view>(style, "flexWrap", as_string, "no-wrap", [yoga_node](auto value) {
         if (value == "no-wrap") {
             YGNodeStyleSetFlexWrap(yoga_node, YGWrapNoWrap);
         } else if (value == "wrap") {
@@ -230,7 +248,7 @@ void update_layout_props(const std::string &uid, const protocol::ObjectValue &pr
     });
 
     // TODO: This is not supported currently
-    assign_prop_default<std::string>(style, "overflow", as_string, "visible", [yoga_node](auto value) {
+    assign_prop_default<std::string_view>(style, "overflow", as_string, "visible", [yoga_node](auto value) {
         if (value == "hidden") {
             YGNodeStyleSetOverflow(yoga_node, YGOverflowHidden);
         } else if (value == "scroll") {
@@ -241,7 +259,7 @@ void update_layout_props(const std::string &uid, const protocol::ObjectValue &pr
     });
 
     // TODO: Setting display to "none" is not supported
-    assign_prop_default<std::string>(style, "display", as_string, "flex", [yoga_node](auto value) {
+    assign_prop_default<std::string_view>(style, "display", as_string, "flex", [yoga_node](auto value) {
         if (value == "none") {
             YGNodeStyleSetDisplay(yoga_node, YGDisplayNone);
         } else if (value == "flex") {
@@ -478,4 +496,382 @@ void update_layout_props(const std::string &uid, const protocol::ObjectValue &pr
     }, [yoga_node]() {
         YGNodeStyleSetMaxHeight(yoga_node, YGUndefined);
     });
+
+    assign_prop<int64_t>(style, "zIndex", as_int, [shadow](auto value) {
+        set_z_index(shadow, (int32_t)value);
+    }, [shadow]() {
+        set_z_index(shadow, 0);
+    });
+}
+
+//
+// Typed styles
+//
+
+// The proto enums are cast to the Yoga ones, so both have to span the same
+// range of values
+static_assert(protocol::FlexDirection_MIN == (int)YGFlexDirectionColumn && protocol::FlexDirection_MAX == (int)YGFlexDirectionRowReverse);
+static_assert(protocol::Direction_MIN == (int)YGDirectionInherit && protocol::Direction_MAX == (int)YGDirectionRTL);
+static_assert(protocol::Justify_MIN == (int)YGJustifyFlexStart && protocol::Justify_MAX == (int)YGJustifySpaceEvenly);
+static_assert(protocol::Align_MIN == (int)YGAlignAuto && protocol::Align_MAX == (int)YGAlignSpaceAround);
+static_assert(protocol::PositionType_MIN == (int)YGPositionTypeStatic && protocol::PositionType_MAX == (int)YGPositionTypeAbsolute);
+static_assert(protocol::Wrap_MIN == (int)YGWrapNoWrap && protocol::Wrap_MAX == (int)YGWrapWrapReverse);
+static_assert(protocol::Overflow_MIN == (int)YGOverflowVisible && protocol::Overflow_MAX == (int)YGOverflowScroll);
+static_assert(protocol::Display_MIN == (int)YGDisplayFlex && protocol::Display_MAX == (int)YGDisplayNone);
+
+typedef void (*SetStyleValue)(YGNodeRef, float);
+typedef void (*SetStyleAuto)(YGNodeRef);
+typedef void (*SetEdgeValue)(YGNodeRef, YGEdge, float);
+typedef void (*SetEdgeAuto)(YGNodeRef, YGEdge);
+
+bool has_style_field(const protocol::Style &style, int field_number) {
+    return style.present() & (1ull << field_number);
+}
+
+// A missing dimension is reset with `set_auto` if there is one, like "auto"
+void apply_dimension(
+    YGNodeRef yoga_node,
+    bool present,
+    const protocol::Dimension &dimension,
+    SetStyleValue set,
+    SetStyleValue set_percent,
+    SetStyleAuto set_auto
+) {
+    if (!present || dimension.unit() == protocol::UNIT_AUTO) {
+        if (set_auto) {
+            set_auto(yoga_node);
+        } else {
+            set(yoga_node, YGUndefined);
+        }
+    } else if (dimension.unit() == protocol::UNIT_PERCENT) {
+        set_percent(yoga_node, dimension.value());
+    } else {
+        set(yoga_node, dimension.value());
+    }
+}
+
+// A missing dimension is reset to undefined
+void apply_edge_dimension(
+    YGNodeRef yoga_node,
+    bool present,
+    const protocol::Dimension &dimension,
+    YGEdge edge,
+    SetEdgeValue set,
+    SetEdgeValue set_percent,
+    SetEdgeAuto set_auto
+) {
+    if (!present) {
+        set(yoga_node, edge, YGUndefined);
+    } else if (dimension.unit() == protocol::UNIT_AUTO) {
+        if (set_auto) {
+            set_auto(yoga_node, edge);
+        } else {
+            set(yoga_node, edge, YGUndefined);
+        }
+    } else if (dimension.unit() == protocol::UNIT_PERCENT) {
+        set_percent(yoga_node, edge, dimension.value());
+    } else {
+        set(yoga_node, edge, dimension.value());
+    }
+}
+
+// Enum values are cast to Yoga's, which are the same for every value the
+// protocol defines. Unknown values are ignored, like malformed sizes.
+bool is_valid_style_enum(bool (*is_valid)(int), int value, const char* field_name) {
+    if (is_valid(value)) {
+        return true;
+    }
+
+    blog(LOG_WARNING, "[react-obs] Style field %s has an unknown value %i, ignoring it", field_name, value);
+    return false;
+}
+
+// Sets one field of a style, or resets it to the same default as
+// `update_layout_props` if it is not present
+void apply_style_field(ShadowSource* shadow, const protocol::Style &style, int field_number, bool present) {
+    typedef protocol::Style S;
+
+    auto yoga_node = shadow->yoga_node;
+
+    switch (field_number) {
+        case S::kFlexDirectionFieldNumber:
+            if (present && !is_valid_style_enum(protocol::FlexDirection_IsValid, style.flex_direction(), "flex_direction")) {
+                break;
+            }
+
+            YGNodeStyleSetFlexDirection(yoga_node, present ? (YGFlexDirection)style.flex_direction() : YGFlexDirectionColumn);
+            break;
+
+        case S::kDirectionFieldNumber:
+            if (present && !is_valid_style_enum(protocol::Direction_IsValid, style.direction(), "direction")) {
+                break;
+            }
+
+            YGNodeStyleSetDirection(yoga_node, present ? (YGDirection)style.direction() : YGDirectionInherit);
+            break;
+
+        case S::kJustifyContentFieldNumber:
+            if (present && !is_valid_style_enum(protocol::Justify_IsValid, style.justify_content(), "justify_content")) {
+                break;
+            }
+
+            YGNodeStyleSetJustifyContent(yoga_node, present ? (YGJustify)style.justify_content() : YGJustifyFlexStart);
+            break;
+
+        case S::kAlignContentFieldNumber:
+            if (present && !is_valid_style_enum(protocol::Align_IsValid, style.align_content(), "align_content")) {
+                break;
+            }
+
+            YGNodeStyleSetAlignContent(yoga_node, present ? (YGAlign)style.align_content() : YGAlignFlexStart);
+            break;
+
+        case S::kAlignItemsFieldNumber:
+            if (present && !is_valid_style_enum(protocol::Align_IsValid, style.align_items(), "align_items")) {
+                break;
+            }
+
+            YGNodeStyleSetAlignItems(yoga_node, present ? (YGAlign)style.align_items() : YGAlignStretch);
+            break;
+
+        case S::kAlignSelfFieldNumber:
+            if (present && !is_valid_style_enum(protocol::Align_IsValid, style.align_self(), "align_self")) {
+                break;
+            }
+
+            YGNodeStyleSetAlignSelf(yoga_node, present ? (YGAlign)style.align_self() : YGAlignStretch);
+            break;
+
+        case S::kPositionFieldNumber:
+            if (present && !is_valid_style_enum(protocol::PositionType_IsValid, style.position(), "position")) {
+                break;
+            }
+
+            YGNodeStyleSetPositionType(yoga_node, present ? (YGPositionType)style.position() : YGPositionTypeStatic);
+            break;
+
+        case S::kFlexWrapFieldNumber:
+            if (present && !is_valid_style_enum(protocol::Wrap_IsValid, style.flex_wrap(), "flex_wrap")) {
+                break;
+            }
+
+            YGNodeStyleSetFlexWrap(yoga_node, present ? (YGWrap)style.flex_wrap() : YGWrapNoWrap);
+            break;
+
+        case S::kOverflowFieldNumber:
+            if (present && !is_valid_style_enum(protocol::Overflow_IsValid, style.overflow(), "overflow")) {
+                break;
+            }
+
+            YGNodeStyleSetOverflow(yoga_node, present ? (YGOverflow)style.overflow() : YGOverflowVisible);
+            break;
+
+        case S::kDisplayFieldNumber:
+            if (present && !is_valid_style_enum(protocol::Display_IsValid, style.display(), "display")) {
+                break;
+            }
+
+            YGNodeStyleSetDisplay(yoga_node, present ? (YGDisplay)style.display() : YGDisplayFlex);
+            break;
+
+        case S::kFlexGrowFieldNumber:
+            YGNodeStyleSetFlexGrow(yoga_node, present ? style.flex_grow() : YGUndefined);
+            break;
+
+        case S::kFlexShrinkFieldNumber:
+            YGNodeStyleSetFlexShrink(yoga_node, present ? style.flex_shrink() : YGUndefined);
+            break;
+
+        case S::kFlexBasisFieldNumber:
+            apply_dimension(yoga_node, present, style.flex_basis(), YGNodeStyleSetFlexBasis, YGNodeStyleSetFlexBasisPercent, YGNodeStyleSetFlexBasisAuto);
+            break;
+
+        case S::kTopFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.top(), YGEdgeTop, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent, nullptr);
+            break;
+
+        case S::kLeftFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.left(), YGEdgeLeft, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent, nullptr);
+            break;
+
+        case S::kRightFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.right(), YGEdgeRight, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent, nullptr);
+            break;
+
+        case S::kBottomFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.bottom(), YGEdgeBottom, YGNodeStyleSetPosition, YGNodeStyleSetPositionPercent, nullptr);
+            break;
+
+        case S::kMarginTopFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.margin_top(), YGEdgeTop, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+            break;
+
+        case S::kMarginLeftFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.margin_left(), YGEdgeLeft, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+            break;
+
+        case S::kMarginRightFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.margin_right(), YGEdgeRight, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+            break;
+
+        case S::kMarginBottomFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.margin_bottom(), YGEdgeBottom, YGNodeStyleSetMargin, YGNodeStyleSetMarginPercent, YGNodeStyleSetMarginAuto);
+            break;
+
+        case S::kPaddingTopFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.padding_top(), YGEdgeTop, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent, nullptr);
+            break;
+
+        case S::kPaddingLeftFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.padding_left(), YGEdgeLeft, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent, nullptr);
+            break;
+
+        case S::kPaddingRightFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.padding_right(), YGEdgeRight, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent, nullptr);
+            break;
+
+        case S::kPaddingBottomFieldNumber:
+            apply_edge_dimension(yoga_node, present, style.padding_bottom(), YGEdgeBottom, YGNodeStyleSetPadding, YGNodeStyleSetPaddingPercent, nullptr);
+            break;
+
+        case S::kAspectRatioFieldNumber:
+            YGNodeStyleSetAspectRatio(yoga_node, present ? style.aspect_ratio() : YGUndefined);
+            break;
+
+        case S::kWidthFieldNumber:
+            apply_dimension(yoga_node, present, style.width(), YGNodeStyleSetWidth, YGNodeStyleSetWidthPercent, YGNodeStyleSetWidthAuto);
+            break;
+
+        case S::kHeightFieldNumber:
+            apply_dimension(yoga_node, present, style.height(), YGNodeStyleSetHeight, YGNodeStyleSetHeightPercent, YGNodeStyleSetHeightAuto);
+            break;
+
+        case S::kMinWidthFieldNumber:
+            apply_dimension(yoga_node, present, style.min_width(), YGNodeStyleSetMinWidth, YGNodeStyleSetMinWidthPercent, nullptr);
+            break;
+
+        case S::kMaxWidthFieldNumber:
+            apply_dimension(yoga_node, present, style.max_width(), YGNodeStyleSetMaxWidth, YGNodeStyleSetMaxWidthPercent, nullptr);
+            break;
+
+        case S::kMinHeightFieldNumber:
+            apply_dimension(yoga_node, present, style.min_height(), YGNodeStyleSetMinHeight, YGNodeStyleSetMinHeightPercent, nullptr);
+            break;
+
+        case S::kMaxHeightFieldNumber:
+            apply_dimension(yoga_node, present, style.max_height(), YGNodeStyleSetMaxHeight, YGNodeStyleSetMaxHeightPercent, nullptr);
+            break;
+
+        case S::kZIndexFieldNumber:
+            set_z_index(shadow, present ? style.z_index() : 0);
+            break;
+    }
+}
+
+static constexpr int first_style_field = protocol::Style::kFlexDirectionFieldNumber;
+static constexpr int last_style_field = protocol::Style::kZIndexFieldNumber;
+
+// Bits of all style fields in `present` and `unset`
+static constexpr uint64_t style_field_mask = ((1ull << (last_style_field + 1)) - 1) & ~((1ull << first_style_field) - 1);
+
+// Replaces the whole style, or with `patch` only touches the fields which are
+// present or unset, so the cost scales with the number of changed fields
+void apply_style(ShadowSource* shadow, const protocol::Style &style) {
+    if (!style.patch()) {
+        for (int field_number = first_style_field; field_number <= last_style_field; field_number++) {
+            apply_style_field(shadow, style, field_number, has_style_field(style, field_number));
+        }
+
+        return;
+    }
+
+    auto fields = (style.present() | style.unset()) & style_field_mask;
+
+    while (fields) {
+        auto field_number = __builtin_ctzll(fields);
+        fields &= fields - 1;
+
+        apply_style_field(shadow, style, field_number, has_style_field(style, field_number));
+    }
+}
+
+//
+// Packed layout values
+//
+
+// Sets one value of a `SetLayoutValues` message. Returns false for unknown ids.
+inline bool set_layout_value(YGNodeRef yoga_node, uint32_t prop_id, float value) {
+    typedef protocol::Style S;
+
+    bool percent = prop_id & protocol::LAYOUT_VALUE_PERCENT;
+
+    switch (prop_id & ~(uint32_t)protocol::LAYOUT_VALUE_PERCENT) {
+        case S::kFlexGrowFieldNumber: YGNodeStyleSetFlexGrow(yoga_node, value); break;
+        case S::kFlexShrinkFieldNumber: YGNodeStyleSetFlexShrink(yoga_node, value); break;
+        case S::kFlexBasisFieldNumber: (percent ? YGNodeStyleSetFlexBasisPercent : YGNodeStyleSetFlexBasis)(yoga_node, value); break;
+
+        case S::kTopFieldNumber: (percent ? YGNodeStyleSetPositionPercent : YGNodeStyleSetPosition)(yoga_node, YGEdgeTop, value); break;
+        case S::kLeftFieldNumber: (percent ? YGNodeStyleSetPositionPercent : YGNodeStyleSetPosition)(yoga_node, YGEdgeLeft, value); break;
+        case S::kRightFieldNumber: (percent ? YGNodeStyleSetPositionPercent : YGNodeStyleSetPosition)(yoga_node, YGEdgeRight, value); break;
+        case S::kBottomFieldNumber: (percent ? YGNodeStyleSetPositionPercent : YGNodeStyleSetPosition)(yoga_node, YGEdgeBottom, value); break;
+
+        case S::kMarginTopFieldNumber: (percent ? YGNodeStyleSetMarginPercent : YGNodeStyleSetMargin)(yoga_node, YGEdgeTop, value); break;
+        case S::kMarginLeftFieldNumber: (percent ? YGNodeStyleSetMarginPercent : YGNodeStyleSetMargin)(yoga_node, YGEdgeLeft, value); break;
+        case S::kMarginRightFieldNumber: (percent ? YGNodeStyleSetMarginPercent : YGNodeStyleSetMargin)(yoga_node, YGEdgeRight, value); break;
+        case S::kMarginBottomFieldNumber: (percent ? YGNodeStyleSetMarginPercent : YGNodeStyleSetMargin)(yoga_node, YGEdgeBottom, value); break;
+
+        case S::kPaddingTopFieldNumber: (percent ? YGNodeStyleSetPaddingPercent : YGNodeStyleSetPadding)(yoga_node, YGEdgeTop, value); break;
+        case S::kPaddingLeftFieldNumber: (percent ? YGNodeStyleSetPaddingPercent : YGNodeStyleSetPadding)(yoga_node, YGEdgeLeft, value); break;
+        case S::kPaddingRightFieldNumber: (percent ? YGNodeStyleSetPaddingPercent : YGNodeStyleSetPadding)(yoga_node, YGEdgeRight, value); break;
+        case S::kPaddingBottomFieldNumber: (percent ? YGNodeStyleSetPaddingPercent : YGNodeStyleSetPadding)(yoga_node, YGEdgeBottom, value); break;
+
+        case S::kAspectRatioFieldNumber: YGNodeStyleSetAspectRatio(yoga_node, value); break;
+
+        case S::kWidthFieldNumber: (percent ? YGNodeStyleSetWidthPercent : YGNodeStyleSetWidth)(yoga_node, value); break;
+        case S::kHeightFieldNumber: (percent ? YGNodeStyleSetHeightPercent : YGNodeStyleSetHeight)(yoga_node, value); break;
+        case S::kMinWidthFieldNumber: (percent ? YGNodeStyleSetMinWidthPercent : YGNodeStyleSetMinWidth)(yoga_node, value); break;
+        case S::kMaxWidthFieldNumber: (percent ? YGNodeStyleSetMaxWidthPercent : YGNodeStyleSetMaxWidth)(yoga_node, value); break;
+        case S::kMinHeightFieldNumber: (percent ? YGNodeStyleSetMinHeightPercent : YGNodeStyleSetMinHeight)(yoga_node, value); break;
+        case S::kMaxHeightFieldNumber: (percent ? YGNodeStyleSetMaxHeightPercent : YGNodeStyleSetMaxHeight)(yoga_node, value); break;
+
+        default: return false;
+    }
+
+    return true;
+}
+
+// Writes the values straight into the Yoga nodes, without building any
+// intermediate messages. Must be called under `render_mutex`.
+void set_layout_values(Session &session, const protocol::SetLayoutValues &message) {
+    auto count = message.handles_size();
+
+    if (message.prop_ids_size() != count || message.values_size() != count) {
+        blog(LOG_ERROR, "[react-obs] Layout values have %i handles, %i ids and %i values",
+             count, message.prop_ids_size(), message.values_size());
+        return;
+    }
+
+    const auto* handles = message.handles().data();
+    const auto* prop_ids = message.prop_ids().data();
+    const auto* values = message.values().data();
+
+    const auto &node_table = session.node_table;
+    auto table_size = node_table.size();
+    int invalid = 0;
+
+    for (int i = 0; i < count; i++) {
+        auto handle = handles[i];
+        auto shadow = handle < table_size ? node_table[handle] : nullptr;
+
+        if (!shadow || !set_layout_value(shadow->yoga_node, prop_ids[i], values[i])) {
+            invalid++;
+            continue;
+        }
+
+        queue_layout(shadow);
+    }
+
+    if (invalid > 0) {
+        blog(LOG_ERROR, "[react-obs] Skipped %i of %i layout values with unknown nodes or ids", invalid, count);
+    }
 }
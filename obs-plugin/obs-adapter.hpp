@@ -1,19 +1,20 @@
 // TODO: Exclude props which are used elsewhere (e.g. styling, name)
 void update_settings(
     obs_data_t* settings,
-    const protocol::ObjectValue& object
+    const protocol::ObjectValue& object,
+    const InternTable &interned
 ) {
-    auto props = object.props();
+    const auto &props = object.props();
 
-    for (int i = 0; i < props.size(); i++) {
-        protocol::Prop prop = props[i];
+    for (const auto &prop : props) {
+        const auto &prop_key = interned.key(prop);
 
         // TODO: Smarter exclusions
-        if (prop.key() == "style") {
+        if (prop_key.empty() || prop_key == "style") {
             continue;
         }
 
-        const char* key = prop.key().c_str();
+        const char* key = prop_key.c_str();
 
         switch (prop.value_case()) {
             case protocol::Prop::ValueCase::kUndefined:
@@ -33,8 +34,13 @@ void update_settings(
                 break;
 
             case protocol::Prop::ValueCase::kStringValue:
-                obs_data_set_string(settings, key, prop.string_value().c_str());
+            case protocol::Prop::ValueCase::kStringId: {
+                auto value = interned.string(prop);
+                if (value) {
+                    obs_data_set_string(settings, key, value->c_str());
+                }
                 break;
+            }
 
             case protocol::Prop::ValueCase::kObjectValue: {
                 auto object = obs_data_get_obj(settings, key);
@@ -44,7 +50,7 @@ void update_settings(
                     obs_data_release(object);
                 }
 
-                update_settings(object, prop.object_value());
+                update_settings(object, prop.object_value(), interned);
                 break;
             }
 
@@ -54,15 +60,17 @@ void update_settings(
     }
 }
 
-void create_source(const protocol::CreateSource &create_source) {
-    blog(LOG_DEBUG, "[react-obs] Creating source: id=%s, container=%s, name=%s, uid=%s",
+ShadowSource* create_source(Session &session, const protocol::CreateSource &create_source) {
+    blog(LOG_DEBUG, "[react-obs] Creating source: id=%s, container=%s, name=%s, node=%s",
          create_source.id().c_str(),
-         create_source.container_uid().c_str(),
+         node_name(create_source.container_handle(), create_source.container_uid()).c_str(),
          create_source.name().c_str(),
-         create_source.uid().c_str());
+         node_name(create_source.handle(), create_source.uid()).c_str());
+
+    session.interned.check_ids(create_source.settings());
 
     auto settings = obs_data_create();
-    update_settings(settings, create_source.settings());
+    update_settings(settings, create_source.settings(), session.interned);
 
     // TODO: private or non-private?
     auto source = obs_source_create_private(
@@ -73,29 +81,40 @@ void create_source(const protocol::CreateSource &create_source) {
 
     obs_data_release(settings);
 
-    auto uid = create_source.uid();
+    const auto &uid = create_source.uid();
 
     // Only scenes should not be measured, and these are created with create_scene
     bool is_measured = true;
 
-    auto container_shadow = get_shadow_source(create_source.container_uid());
+    auto container_shadow = get_shadow_source(session, create_source.container_handle(), create_source.container_uid());
 
     if (!container_shadow) {
         blog(LOG_ERROR, "[react-obs] Tried to create source %s in an unregistered container %s",
-             uid.c_str(),
-             create_source.container_uid().c_str());
+             node_name(create_source.handle(), uid).c_str(),
+             node_name(create_source.container_handle(), create_source.container_uid()).c_str());
 
         obs_source_release(source);
 
-        return;
+        return nullptr;
     }
 
-    add_shadow_source(uid, source, true, is_measured, container_shadow);
+    auto shadow = add_shadow_source(session, create_source.handle(), uid, source, true, is_measured, container_shadow);
 
-    update_layout_props(uid, create_source.settings());
+    if (!shadow) {
+        obs_source_release(source);
+        return nullptr;
+    }
+
+    if (create_source.has_style()) {
+        apply_style(shadow, create_source.style());
+    } else {
+        update_layout_props(shadow, create_source.settings());
+    }
+
+    return shadow;
 }
 
-bool register_unmanaged_source(const std::string &uid, const std::string &name) {
+bool register_unmanaged_source(Session &session, uint32_t handle, const std::string &uid, const std::string &name) {
     auto source = obs_get_source_by_name(name.c_str());
     if (!source) {
         blog(LOG_ERROR, "[react-obs] Could not find source with name %s", name.c_str());
@@ -105,7 +124,12 @@ bool register_unmanaged_source(const std::string &uid, const std::string &name)
     auto is_scene = !!obs_scene_from_source(source);
     bool is_measured = !is_scene;
 
-    auto shadow = add_shadow_source(uid, source, false, is_measured, nullptr);
+    auto shadow = add_shadow_source(session, handle, uid, source, false, is_measured, nullptr);
+
+    if (!shadow) {
+        obs_source_release(source);
+        return false;
+    }
 
     if (is_scene) {
         auto source_width = obs_source_get_width(source);
@@ -114,19 +138,207 @@ bool register_unmanaged_source(const std::string &uid, const std::string &name)
         auto yoga_node = shadow->yoga_node;
         YGNodeStyleSetWidth(yoga_node, source_width);
         YGNodeStyleSetHeight(yoga_node, source_height);
+        queue_layout(shadow);
     }
 
     return true;
 }
 
-void append_child(const protocol::AppendChild &append_child) {
+// Index of `child` among the layout children of `parent`, or -1
+int yoga_child_index(YGNodeRef parent, YGNodeRef child) {
+    auto count = YGNodeGetChildCount(parent);
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (YGNodeGetChild(parent, i) == child) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+// Whether `child` has been added to the scene of `parent`
+bool is_child_of(ShadowSource* parent, obs_scene_t* scene, ShadowSource* child) {
+    return child->sceneitem &&
+        obs_sceneitem_get_scene(child->sceneitem) == scene &&
+        YGNodeGetOwner(child->yoga_node) == parent->yoga_node;
+}
+
+// Children with a zIndex are put in place by the next video tick
+void child_order_changed(ShadowSource* parent, ShadowSource* child) {
+    if (child->z_index != 0) {
+        parent->has_z_indexed_children = true;
+    }
+
+    if (parent->has_z_indexed_children) {
+        queue_draw_order(parent);
+    }
+}
+
+// Moves a sceneitem right above or below another one of the same scene
+void move_sceneitem(obs_sceneitem_t* item, obs_sceneitem_t* anchor, bool above) {
+    auto position = obs_sceneitem_get_order_position(item);
+    auto target_position = draw_order_target(position, obs_sceneitem_get_order_position(anchor), above);
+
+    if (position != target_position) {
+        obs_sceneitem_set_order_position(item, target_position);
+    }
+}
+
+// Adds the child to the end of the parent's scene
+void add_child(ShadowSource* parent, obs_scene_t* scene, ShadowSource* child) {
+    auto item = obs_scene_add(scene, child->source);
+
+    obs_sceneitem_addref(item);
+    child->sceneitem = item;
+
+    YGNodeInsertChild(
+        parent->yoga_node,
+        child->yoga_node,
+        YGNodeGetChildCount(parent->yoga_node)
+    );
+
+    child_order_changed(parent, child);
+    queue_layout(parent);
+}
+
+// Places a child of the parent right before `before`, or at the end if it is
+// nullptr. Later children are drawn on top, so the sceneitem goes right below
+// the one of `before`. Its transform and settings are kept.
+void place_child(ShadowSource* parent, ShadowSource* child, ShadowSource* before) {
+    YGNodeRemoveChild(parent->yoga_node, child->yoga_node);
+
+    if (!before) {
+        YGNodeInsertChild(parent->yoga_node, child->yoga_node, YGNodeGetChildCount(parent->yoga_node));
+        obs_sceneitem_set_order(child->sceneitem, OBS_ORDER_MOVE_TOP);
+    } else {
+        YGNodeInsertChild(parent->yoga_node, child->yoga_node, yoga_child_index(parent->yoga_node, before->yoga_node));
+        move_sceneitem(child->sceneitem, before->sceneitem, false);
+    }
+
+    child_order_changed(parent, child);
+    queue_layout(parent);
+}
+
+// Brings the draw order of the parent's scene in line with its children,
+// ordered by zIndex and then by child order. Only the sceneitems outside a
+// longest increasing subsequence of the current order are moved.
+void reconcile_draw_order(ShadowSource* parent) {
+    auto scene = obs_scene_from_source(parent->source);
+    if (!scene) {
+        return;
+    }
+
+    std::vector<ShadowSource*> children;
+    auto child_count = YGNodeGetChildCount(parent->yoga_node);
+
+    children.reserve(child_count);
+
+    for (uint32_t i = 0; i < child_count; i++) {
+        auto child = (ShadowSource*)YGNodeGetContext(YGNodeGetChild(parent->yoga_node, i));
+
+        if (child && child->sceneitem) {
+            children.push_back(child);
+        }
+    }
+
+    std::stable_sort(children.begin(), children.end(), [](ShadowSource* a, ShadowSource* b) {
+        return a->z_index < b->z_index;
+    });
+
+    // Current positions, from a single walk over the scene
+    std::unordered_map<obs_sceneitem_t*, int> positions_by_item;
+
+    obs_scene_enum_items(scene, [](obs_scene_t*, obs_sceneitem_t* item, void* param) {
+        auto positions = (std::unordered_map<obs_sceneitem_t*, int>*)param;
+        positions->emplace(item, (int)positions->size());
+        return true;
+    }, &positions_by_item);
+
+    std::vector<int> positions;
+    positions.reserve(children.size());
+
+    for (auto child : children) {
+        auto position = positions_by_item.find(child->sceneitem);
+
+        if (position == positions_by_item.end()) {
+            blog(LOG_ERROR, "[react-obs] Sceneitem of %s is not in the scene of its parent", node_name(child->handle, child->uid).c_str());
+            return;
+        }
+
+        positions.push_back(position->second);
+    }
+
+    auto moves = plan_draw_order(positions);
+
+    for (const auto &move : moves) {
+        move_sceneitem(children[move.item]->sceneitem, children[move.anchor]->sceneitem, move.above);
+    }
+
+    if (DEBUG_UPDATE) {
+        blog(LOG_DEBUG, "[react-obs] Reordered %zu of %zu sceneitems", moves.size(), children.size());
+    }
+}
+
+// The parent, child and (optional) sibling of an InsertBefore or MoveChild,
+// or nullptr for the parent if any of them is invalid
+struct ChildPlacement {
+    ShadowSource* parent;
+    obs_scene_t* scene;
+    ShadowSource* child;
+    ShadowSource* before;
+};
+
+ChildPlacement resolve_child_placement(Session &session, uint32_t parent_handle, uint32_t child_handle, uint32_t before_handle) {
+    ChildPlacement placement {};
+
+    auto parent = get_shadow_source(session, parent_handle, "");
+    if (!parent) {
+        blog(LOG_ERROR, "[react-obs] Cannot find parent source %s", node_name(parent_handle, "").c_str());
+        return placement;
+    }
+
+    auto scene = obs_scene_from_source(parent->source);
+    if (!scene) {
+        blog(LOG_ERROR, "[react-obs] Parent source %s is not a scene", node_name(parent_handle, "").c_str());
+        return placement;
+    }
+
+    auto child = get_shadow_source(session, child_handle, "");
+    if (!child) {
+        blog(LOG_ERROR, "[react-obs] Cannot find child source %s", node_name(child_handle, "").c_str());
+        return placement;
+    }
+
+    ShadowSource* before = nullptr;
+
+    if (before_handle != 0) {
+        before = get_shadow_source(session, before_handle, "");
+
+        if (!before || before == child || !is_child_of(parent, scene, before)) {
+            blog(LOG_ERROR, "[react-obs] Source %s is not a child of %s",
+                 node_name(before_handle, "").c_str(),
+                 node_name(parent_handle, "").c_str());
+            return placement;
+        }
+    }
+
+    placement.parent = parent;
+    placement.scene = scene;
+    placement.child = child;
+    placement.before = before;
+
+    return placement;
+}
+
+void append_child(Session &session, const protocol::AppendChild &append_child) {
     blog(LOG_DEBUG, "[react-obs] Appending %s to %s",
-         append_child.child_uid().c_str(),
-         append_child.parent_uid().c_str());
+         node_name(append_child.child_handle(), append_child.child_uid()).c_str(),
+         node_name(append_child.parent_handle(), append_child.parent_uid()).c_str());
 
-    auto parent = get_shadow_source(append_child.parent_uid());
+    auto parent = get_shadow_source(session, append_child.parent_handle(), append_child.parent_uid());
     if (!parent) {
-        blog(LOG_ERROR, "[react-obs] Cannot find parent source with uid %s", append_child.parent_uid().c_str());
+        blog(LOG_ERROR, "[react-obs] Cannot find parent source %s", node_name(append_child.parent_handle(), append_child.parent_uid()).c_str());
         return;
     }
 
@@ -137,92 +349,241 @@ void append_child(const protocol::AppendChild &append_child) {
 
     auto scene = obs_scene_from_source(parent->source);
     if (!scene) {
-        blog(LOG_ERROR, "[react-obs] Parent source %s is not a scene", append_child.parent_uid().c_str());
+        blog(LOG_ERROR, "[react-obs] Parent source %s is not a scene", node_name(append_child.parent_handle(), append_child.parent_uid()).c_str());
         return;
     }
 
-    auto child = get_shadow_source(append_child.child_uid());
+    auto child = get_shadow_source(session, append_child.child_handle(), append_child.child_uid());
     if (!child) {
-        blog(LOG_ERROR, "[react-obs] Cannot find child source with uid %s", append_child.child_uid().c_str());
+        blog(LOG_ERROR, "[react-obs] Cannot find child source %s", node_name(append_child.child_handle(), append_child.child_uid()).c_str());
         return;
     }
 
-    auto item = obs_scene_add(scene, child->source);
+    // Appending a child which is there already moves it to the end
+    if (is_child_of(parent, scene, child)) {
+        place_child(parent, child, nullptr);
+        return;
+    }
 
-    obs_sceneitem_addref(item);
-    child->sceneitem = item;
+    add_child(parent, scene, child);
+}
 
-    YGNodeInsertChild(
-        parent->yoga_node,
-        child->yoga_node,
-        YGNodeGetChildCount(parent->yoga_node)
-    );
+void insert_before(Session &session, const protocol::InsertBefore &insert) {
+    blog(LOG_DEBUG, "[react-obs] Inserting %s before %s",
+         node_name(insert.child_handle(), "").c_str(),
+         node_name(insert.before_handle(), "").c_str());
+
+    auto placement = resolve_child_placement(session, insert.parent_handle(), insert.child_handle(), insert.before_handle());
+    if (!placement.parent) {
+        return;
+    }
+
+    auto child = placement.child;
+
+    if (!is_child_of(placement.parent, placement.scene, child)) {
+        if (child->sceneitem) {
+            blog(LOG_ERROR, "[react-obs] Source %s already added to another scene", node_name(insert.child_handle(), "").c_str());
+            return;
+        }
+
+        add_child(placement.parent, placement.scene, child);
+    }
+
+    place_child(placement.parent, child, placement.before);
+}
+
+void move_child(Session &session, const protocol::MoveChild &move) {
+    if (DEBUG_UPDATE) {
+        blog(LOG_DEBUG, "[react-obs] Moving %s before %s",
+             node_name(move.child_handle(), "").c_str(),
+             node_name(move.before_handle(), "").c_str());
+    }
+
+    auto placement = resolve_child_placement(session, move.parent_handle(), move.child_handle(), move.before_handle());
+    if (!placement.parent) {
+        return;
+    }
+
+    if (!is_child_of(placement.parent, placement.scene, placement.child)) {
+        blog(LOG_ERROR, "[react-obs] Cannot move %s, it is not a child of %s",
+             node_name(move.child_handle(), "").c_str(),
+             node_name(move.parent_handle(), "").c_str());
+        return;
+    }
+
+    place_child(placement.parent, placement.child, placement.before);
 }
 
-void update_source(const protocol::UpdateSource &update) {
+void update_source(Session &session, const protocol::UpdateSource &update) {
     if (DEBUG_UPDATE) {
-        blog(LOG_DEBUG, "[react-obs] Updating source %s", update.uid().c_str());
+        blog(LOG_DEBUG, "[react-obs] Updating source %s", node_name(update.handle(), update.uid()).c_str());
     }
 
-    auto shadow_source = get_shadow_source(update.uid());
+    auto shadow_source = get_shadow_source(session, update.handle(), update.uid());
     if (!shadow_source) {
-        blog(LOG_ERROR, "[react-obs] Cannot find source %s", update.uid().c_str());
+        blog(LOG_ERROR, "[react-obs] Cannot find source %s", node_name(update.handle(), update.uid()).c_str());
         return;
     }
     auto source = shadow_source->source;
 
     auto settings = obs_source_get_settings(source);
     if (!settings) {
-        blog(LOG_ERROR, "[react-obs] Source %s does not have settings object, WTF", update.uid().c_str());
+        blog(LOG_ERROR, "[react-obs] Source %s does not have settings object, WTF", node_name(update.handle(), update.uid()).c_str());
         return;
     }
 
-    update_settings(settings, update.changed_props());
+    session.interned.check_ids(update.changed_props());
+    update_settings(settings, update.changed_props(), session.interned);
 
     // NOTE: This is deferred - actual updates are performed on the next tick
     obs_source_update(source, settings);
-    update_layout_props(shadow_source->uid, update.changed_props());
+
+    if (update.has_style()) {
+        apply_style(shadow_source, update.style());
+    } else {
+        update_layout_props(shadow_source, update.changed_props());
+    }
+
+    queue_layout(shadow_source);
 }
 
-void create_scene(const protocol::CreateScene &create_scene) {
+ShadowSource* create_scene(Session &session, const protocol::CreateScene &create_scene) {
+    session.interned.check_ids(create_scene.props());
+
     auto scene = obs_scene_create_private(create_scene.name().c_str());
     auto source = obs_scene_get_source(scene);
 
-    auto uid = create_scene.uid();
-    auto container_shadow = get_shadow_source(create_scene.container_uid());
+    const auto &uid = create_scene.uid();
+    auto container_shadow = get_shadow_source(session, create_scene.container_handle(), create_scene.container_uid());
 
     if (!container_shadow) {
         blog(LOG_ERROR, "[react-obs] Tried to create scene %s in an unregistered container %s",
-             uid.c_str(),
-             create_scene.container_uid().c_str());
+             node_name(create_scene.handle(), uid).c_str(),
+             node_name(create_scene.container_handle(), create_scene.container_uid()).c_str());
 
         obs_source_release(source);
 
-        return;
+        return nullptr;
     }
 
-    add_shadow_source(uid, source, true, false, container_shadow);
-    update_layout_props(uid, create_scene.props());
+    auto shadow = add_shadow_source(session, create_scene.handle(), uid, source, true, false, container_shadow);
+
+    if (!shadow) {
+        obs_source_release(source);
+        return nullptr;
+    }
+
+    if (create_scene.has_style()) {
+        apply_style(shadow, create_scene.style());
+    } else {
+        update_layout_props(shadow, create_scene.props());
+    }
+
+    return shadow;
+}
+
+// Creates the node and its subtree, attaching every child to its parent right
+// away. Children of nodes which could not be created are skipped.
+ShadowSource* create_tree_node(Session &session, const protocol::TreeNode &node, size_t &count) {
+    ShadowSource* shadow = nullptr;
+
+    switch (node.node_case()) {
+        case protocol::TreeNode::NodeCase::kSource:
+            shadow = create_source(session, node.source());
+            break;
+
+        case protocol::TreeNode::NodeCase::kScene:
+            shadow = create_scene(session, node.scene());
+            break;
+
+        case protocol::TreeNode::NodeCase::NODE_NOT_SET:
+            blog(LOG_ERROR, "[react-obs] Received tree node with no source");
+            break;
+    }
+
+    if (!shadow) {
+        return nullptr;
+    }
+
+    count++;
+
+    if (node.children_size() == 0) {
+        return shadow;
+    }
+
+    auto scene = obs_scene_from_source(shadow->source);
+    if (!scene) {
+        blog(LOG_ERROR, "[react-obs] Source %s is not a scene and cannot have children", node_name(shadow->handle, shadow->uid).c_str());
+        return shadow;
+    }
+
+    for (const auto &child_node : node.children()) {
+        auto child = create_tree_node(session, child_node, count);
+
+        if (child) {
+            add_child(shadow, scene, child);
+        }
+    }
+
+    return shadow;
+}
+
+// Builds the subtrees completely before attaching their roots, so the parent
+// never holds a partial tree
+void create_tree(Session &session, const protocol::CreateTree &create_tree) {
+    ShadowSource* parent = nullptr;
+    obs_scene_t* scene = nullptr;
+
+    if (create_tree.parent_handle() != 0) {
+        parent = get_shadow_source(session, create_tree.parent_handle(), "");
+        scene = parent ? obs_scene_from_source(parent->source) : nullptr;
+
+        if (!scene) {
+            blog(LOG_ERROR, "[react-obs] Cannot create tree in %s, it is not a scene", node_name(create_tree.parent_handle(), "").c_str());
+            return;
+        }
+    }
+
+    std::vector<ShadowSource*> roots;
+    size_t count = 0;
+
+    roots.reserve(create_tree.roots_size());
+
+    for (const auto &root : create_tree.roots()) {
+        auto shadow = create_tree_node(session, root, count);
+
+        if (shadow) {
+            roots.push_back(shadow);
+        }
+    }
+
+    if (parent) {
+        for (auto root : roots) {
+            add_child(parent, scene, root);
+        }
+    }
+
+    blog(LOG_DEBUG, "[react-obs] Created tree of %zu nodes in %s", count, node_name(create_tree.parent_handle(), "").c_str());
 }
 
-void remove_child(const protocol::RemoveChild &remove) {
-    blog(LOG_DEBUG, "[react-obs] Removing child %s", remove.child_uid().c_str());
+void remove_child(Session &session, const protocol::RemoveChild &remove) {
+    blog(LOG_DEBUG, "[react-obs] Removing child %s", node_name(remove.child_handle(), remove.child_uid()).c_str());
 
-    auto parent = get_shadow_source(remove.parent_uid());
+    auto parent = get_shadow_source(session, remove.parent_handle(), remove.parent_uid());
     if (!parent) {
-        blog(LOG_ERROR, "[react-obs] Cannot find parent source with uid %s", remove.parent_uid().c_str());
+        blog(LOG_ERROR, "[react-obs] Cannot find parent source %s", node_name(remove.parent_handle(), remove.parent_uid()).c_str());
         return;
     }
 
     auto scene = obs_scene_from_source(parent->source);
     if (!scene) {
-        blog(LOG_ERROR, "[react-obs] Parent source %s is not a scene", remove.parent_uid().c_str());
+        blog(LOG_ERROR, "[react-obs] Parent source %s is not a scene", node_name(remove.parent_handle(), remove.parent_uid()).c_str());
         return;
     }
 
-    auto child = get_shadow_source(remove.child_uid());
+    auto child = get_shadow_source(session, remove.child_handle(), remove.child_uid());
     if (!child) {
-        blog(LOG_ERROR, "[react-obs] Cannot find child source with uid %s", remove.child_uid().c_str());
+        blog(LOG_ERROR, "[react-obs] Cannot find child source %s", node_name(remove.child_handle(), remove.child_uid()).c_str());
         return;
     }
 
@@ -243,9 +604,14 @@ void remove_child(const protocol::RemoveChild &remove) {
     child->sceneitem = nullptr;
 
     YGNodeRemoveChild(parent->yoga_node, child->yoga_node);
+    queue_layout(parent);
+
+    // React never adds a removed instance again, unlike unmanaged sources
+    if (child->managed) {
+        auto count = release_shadow_subtree(child);
 
-    // TODO: Should we GC the child node? Can it be added again in the future?
-    // obs_source_remove(child.source);
-    //
-    // obs_source_release(child.source);
+        if (DEBUG_UPDATE) {
+            blog(LOG_DEBUG, "[react-obs] Released %zu removed nodes", count);
+        }
+    }
 }
@@ -0,0 +1,160 @@
+#include <deque>
+#include <mutex>
+
+enum class OverflowPolicy {
+    // Drop the oldest queued event to make room
+    DropOldest,
+
+    // Replace the queued event with the same key, otherwise drop the oldest
+    Coalesce,
+
+    // Close the connection
+    Disconnect
+};
+
+struct OutboundQueueStats {
+    size_t depth;
+    size_t max_depth;
+    uint64_t dropped;
+    uint64_t coalesced;
+};
+
+struct OutboundMessage {
+    // Length header followed by the serialized message
+    std::vector<unsigned char> frame;
+
+    // Events with the same non-zero key replace each other under `Coalesce`
+    uint64_t key;
+
+    // Responses are never dropped or coalesced, and do not count towards the capacity
+    bool is_event;
+
+    // Carries the shared memory file descriptors (see `ClientConnection::enable_shared_memory`)
+    bool attach_shared_memory_fds;
+};
+
+// Bounded queue of frames waiting to be written to a client. Producers are
+// any threads sending messages, the consumer is the server's writer thread.
+//
+// Frame buffers are recycled, so once the queue has warmed up, queueing a
+// message does not allocate.
+class OutboundQueue {
+    size_t capacity;
+    OverflowPolicy policy;
+
+    std::mutex mutex;
+    std::deque<OutboundMessage> messages;
+    std::vector<std::vector<unsigned char>> spare_frames;
+    size_t event_count = 0;
+
+    size_t max_depth = 0;
+    uint64_t dropped = 0;
+    uint64_t coalesced = 0;
+
+public:
+    enum class PushResult {
+        Queued,
+        Overflow
+    };
+
+    OutboundQueue(size_t _capacity, OverflowPolicy _policy)
+        : capacity(std::max<size_t>(_capacity, 1)), policy(_policy) {}
+
+    std::vector<unsigned char> take_spare_frame() {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (spare_frames.empty()) {
+            return {};
+        }
+
+        auto frame = std::move(spare_frames.back());
+        spare_frames.pop_back();
+
+        return frame;
+    }
+
+    void return_spare_frame(std::vector<unsigned char> frame) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        spare_frames.push_back(std::move(frame));
+    }
+
+    PushResult push(OutboundMessage message) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (message.is_event) {
+            if (policy == OverflowPolicy::Coalesce && message.key != 0) {
+                for (auto &queued : messages) {
+                    if (queued.is_event && queued.key == message.key) {
+                        queued.frame.swap(message.frame);
+                        spare_frames.push_back(std::move(message.frame));
+                        coalesced++;
+
+                        return PushResult::Queued;
+                    }
+                }
+            }
+
+            if (event_count >= capacity) {
+                if (policy == OverflowPolicy::Disconnect) {
+                    dropped++;
+                    spare_frames.push_back(std::move(message.frame));
+
+                    return PushResult::Overflow;
+                }
+
+                drop_oldest_event();
+            }
+
+            event_count++;
+        }
+
+        messages.push_back(std::move(message));
+        max_depth = std::max(max_depth, messages.size());
+
+        return PushResult::Queued;
+    }
+
+    bool pop(OutboundMessage &message) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (messages.empty()) {
+            return false;
+        }
+
+        message = std::move(messages.front());
+        messages.pop_front();
+
+        if (message.is_event) {
+            event_count--;
+        }
+
+        return true;
+    }
+
+    OutboundQueueStats stats() {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return OutboundQueueStats {
+            .depth = messages.size(),
+            .max_depth = max_depth,
+            .dropped = dropped,
+            .coalesced = coalesced
+        };
+    }
+
+private:
+    void drop_oldest_event() {
+        for (auto it = messages.begin(); it != messages.end(); ++it) {
+            if (it->is_event) {
+                spare_frames.push_back(std::move(it->frame));
+                messages.erase(it);
+
+                event_count--;
+                dropped++;
+
+                return;
+            }
+        }
+    }
+};
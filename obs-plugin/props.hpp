@@ -1,29 +1,63 @@
-using PropMap = std::unordered_map<std::string, protocol::Prop>;
+// Lookup by key into the props of a message, which must outlive the map.
+// Objects only have a handful of props, so a linear search is cheaper than
+// building a hash map, and nothing is copied or allocated. Interned keys and
+// strings are resolved through the session's table.
+class PropMap {
+    const google::protobuf::RepeatedPtrField<protocol::Prop>* props = nullptr;
+    const InternTable* interned = &no_interned_values;
+
+public:
+    PropMap() = default;
+
+    PropMap(
+        const google::protobuf::RepeatedPtrField<protocol::Prop> &_props,
+        const InternTable &_interned
+    ) : props(&_props), interned(&_interned) {}
+
+    // If a key is repeated, the last value wins. Interned keys are compared
+    // by id, unless the client has interned a key twice.
+    const protocol::Prop* find(std::string_view key) const {
+        if (!props) {
+            return nullptr;
+        }
 
-template <class T>
-PropMap as_prop_map(
-    const T &props
-) {
-    std::unordered_map<std::string, protocol::Prop> result;
+        auto key_id = interned->key_id(key);
+        auto compare_ids = interned->key_ids_are_unique();
 
-    for (int i = 0; i < props.size(); i++) {
-        auto prop = props[i];
+        for (int i = props->size() - 1; i >= 0; i--) {
+            const auto &prop = props->Get(i);
 
-        result[prop.key()] = prop;
+            if (prop.key_id() != 0 && compare_ids ? prop.key_id() == key_id : interned->key(prop) == key) {
+                return &prop;
+            }
+        }
+
+        return nullptr;
     }
 
-    return result;
+    const InternTable& interned_values() const {
+        return *interned;
+    }
+};
+
+PropMap as_prop_map(
+    const google::protobuf::RepeatedPtrField<protocol::Prop> &props,
+    const InternTable &interned
+) {
+    return PropMap(props, interned);
 }
 
-std::optional<std::string> as_string(const protocol::Prop &prop) {
-    if (prop.value_case() != protocol::Prop::ValueCase::kStringValue) {
+std::optional<std::string_view> as_string(const InternTable &interned, const protocol::Prop &prop) {
+    auto value = interned.string(prop);
+
+    if (!value) {
         return {};
     }
 
-    return prop.string_value();
+    return *value;
 }
 
-std::optional<int64_t> as_int(const protocol::Prop &prop) {
+std::optional<int64_t> as_int(const InternTable&, const protocol::Prop &prop) {
     if (prop.value_case() != protocol::Prop::ValueCase::kIntValue) {
         return {};
     }
@@ -31,7 +65,7 @@ std::optional<int64_t> as_int(const protocol::Prop &prop) {
     return prop.int_value();
 }
 
-std::optional<float> as_float(const protocol::Prop &prop) {
+std::optional<float> as_float(const InternTable&, const protocol::Prop &prop) {
     if (prop.value_case() == protocol::Prop::ValueCase::kIntValue) {
         return (float)prop.int_value();
     }
@@ -48,7 +82,7 @@ struct Size {
     float value;
 };
 
-std::optional<Size> as_size(const protocol::Prop &prop) {
+std::optional<Size> as_size(const InternTable &interned, const protocol::Prop &prop) {
     switch (prop.value_case()) {
         case protocol::Prop::ValueCase::kIntValue:
             return Size {
@@ -62,11 +96,18 @@ std::optional<Size> as_size(const protocol::Prop &prop) {
                 .value = (float)prop.float_value()
             };
 
-        case protocol::Prop::ValueCase::kStringValue: {
+        case protocol::Prop::ValueCase::kStringValue:
+        case protocol::Prop::ValueCase::kStringId: {
+            auto string_value = interned.string(prop);
+
+            if (!string_value) {
+                return {};
+            }
+
             float value;
             std::string unit;
 
-            std::istringstream parser(prop.string_value());
+            std::istringstream parser(*string_value);
 
             parser >> value >> unit;
 
@@ -93,30 +134,30 @@ std::optional<Size> as_size(const protocol::Prop &prop) {
     }
 }
 
-std::optional<std::unordered_map<std::string, protocol::Prop>> as_object(const protocol::Prop &prop) {
+std::optional<PropMap> as_object(const InternTable &interned, const protocol::Prop &prop) {
     if (prop.value_case() != protocol::Prop::ValueCase::kObjectValue) {
         return {};
     }
 
-    return as_prop_map(prop.object_value().props());
+    return as_prop_map(prop.object_value().props(), interned);
 }
 
 template <class T>
 void assign_prop(
     const PropMap &props,
     const char* name,
-    std::function<std::optional<T>(const protocol::Prop &prop)> converter,
+    std::function<std::optional<T>(const InternTable &interned, const protocol::Prop &prop)> converter,
     std::function<void(const T&)> apply,
     std::function<void()> reset
 ) {
     auto propFind = props.find(name);
-    if (propFind == props.end()) {
+    if (!propFind) {
         reset();
         return;
     }
 
-    auto prop = propFind->second;
-    auto value = converter(prop);
+    const auto &prop = *propFind;
+    auto value = converter(props.interned_values(), prop);
 
     if (value.has_value()) {
         apply(*value);
@@ -129,18 +170,18 @@ template <class T>
 void assign_prop_default(
     const PropMap &props,
     const char* name,
-    std::function<std::optional<T>(const protocol::Prop &prop)> converter,
+    std::function<std::optional<T>(const InternTable &interned, const protocol::Prop &prop)> converter,
     T default_value,
     std::function<void(const T&)> apply
 ) {
     auto propFind = props.find(name);
-    if (propFind == props.end()) {
+    if (!propFind) {
         apply(default_value);
         return;
     }
 
-    auto prop = propFind->second;
-    auto value = converter(prop);
+    const auto &prop = *propFind;
+    auto value = converter(props.interned_values(), prop);
 
     if (value.has_value()) {
         apply(*value);
@@ -12,6 +12,7 @@
 #include <functional>
 #include <unordered_map>
 #include <sstream>
+#include <string_view>
 
 OBS_DECLARE_MODULE()
 OBS_MODULE_USE_DEFAULT_LOCALE("react-obs", "en-US")
@@ -19,66 +20,76 @@ OBS_MODULE_USE_DEFAULT_LOCALE("react-obs", "en-US")
 #define DEBUG_LAYOUT false
 #define DEBUG_UPDATE false
 
+// Held by the video tick while it changes shadow state. Worker threads only
+// queue updates for it (see update-queue.hpp).
 static pthread_mutex_t render_mutex = PTHREAD_MUTEX_INITIALIZER;
 
 #include "api-server.hpp"
+#include "settings.hpp"
+#include "flow-control.hpp"
 #include "yoga-logger.hpp"
+#include "interning.hpp"
 #include "shadow-sources.hpp"
+#include "update-queue.hpp"
+#include "sessions.hpp"
 #include "props.hpp"
 #include "layout.hpp"
+#include "draw-order.hpp"
 #include "obs-adapter.hpp"
 #include "experiments.hpp"
 
-void on_tick_callback(void* context, float elapsed_seconds) {
-    UNUSED_PARAMETER(context);
-    UNUSED_PARAMETER(elapsed_seconds);
-
-    pthread_mutex_lock(&render_mutex);
-    pthread_mutex_lock(&shadow_sources_mutex);
-
-    for (auto shadow : shadow_sources) {
-        if (shadow->measured_externally) {
-            check_source_dimensions(shadow);
-        }
-    }
-
-    for (auto container : containers) {
-        perform_layout(container);
-    }
-
-    pthread_mutex_unlock(&shadow_sources_mutex);
-    pthread_mutex_unlock(&render_mutex);
-}
-
 //
 // Server API
 //
 
-void apply_updates(protocol::ApplyUpdate &update) {
+void apply_updates(Session &session, const protocol::ApplyUpdate &update) {
     switch (update.change_case()) {
         case protocol::ApplyUpdate::ChangeCase::kCreateSource:
-            create_source(update.create_source());
+            create_source(session, update.create_source());
             break;
 
         case protocol::ApplyUpdate::ChangeCase::kUpdateSource:
-            update_source(update.update_source());
+            update_source(session, update.update_source());
             break;
 
         case protocol::ApplyUpdate::ChangeCase::kCreateScene:
-            create_scene(update.create_scene());
+            create_scene(session, update.create_scene());
             break;
 
         case protocol::ApplyUpdate::ChangeCase::kAppendChild:
-            append_child(update.append_child());
+            append_child(session, update.append_child());
             break;
 
         case protocol::ApplyUpdate::ChangeCase::kRemoveChild:
-            remove_child(update.remove_child());
+            remove_child(session, update.remove_child());
             break;
 
         case protocol::ApplyUpdate::ChangeCase::kCommitUpdates:
-            // Nothing to do here, layout is now performed in the video tick
-            // commit_updates(update.commit_updates());
+            // The staged updates have been applied, see `stage_update`
+            break;
+
+        case protocol::ApplyUpdate::ChangeCase::kDefineKey:
+            session.interned.define_key(update.define_key().id(), update.define_key().key());
+            break;
+
+        case protocol::ApplyUpdate::ChangeCase::kDefineString:
+            session.interned.define_string(update.define_string().id(), update.define_string().value());
+            break;
+
+        case protocol::ApplyUpdate::ChangeCase::kSetLayoutValues:
+            set_layout_values(session, update.set_layout_values());
+            break;
+
+        case protocol::ApplyUpdate::ChangeCase::kInsertBefore:
+            insert_before(session, update.insert_before());
+            break;
+
+        case protocol::ApplyUpdate::ChangeCase::kMoveChild:
+            move_child(session, update.move_child());
+            break;
+
+        case protocol::ApplyUpdate::ChangeCase::kCreateTree:
+            create_tree(session, update.create_tree());
             break;
 
         case protocol::ApplyUpdate::ChangeCase::CHANGE_NOT_SET:
@@ -87,59 +98,227 @@ void apply_updates(protocol::ApplyUpdate &update) {
     }
 }
 
-void message_received_from_client(
-    ClientConnection& client,
-    const protocol::ClientMessage& message
-) {
-    switch (message.message_case()) {
-        case protocol::ClientMessage::MessageCase::kInitRequest: {
-            auto init_request = message.init_request();
+// Keeps a client which never commits from staging updates without bounds.
+// Each staged message keeps the batch it was read in.
+static constexpr size_t max_staged_updates = 1 << 16;
+static constexpr size_t max_staged_messages = 1024;
 
-            blog(LOG_DEBUG, "[react-obs] Received init request from %s", init_request.client_id().c_str());
+void apply_staged_updates(Session &session) {
+    for (auto update : session.staged_updates) {
+        apply_updates(session, *update);
+    }
 
-            protocol::ServerMessage message;
-            auto response = message.mutable_response();
-            response->set_request_id(init_request.request_id());
-            response->set_success(true);
+    release_staged_updates(session);
+}
 
-            client.send(message);
+// Updates are staged until the CommitUpdates of their container arrives, then
+// applied together, so the tick never lays out a partly built tree. React
+// commits one container at a time, so everything staged belongs to the
+// container being committed.
+void stage_update(QueuedUpdate &queued, const protocol::ApplyUpdate &update) {
+    auto &client = *queued.client;
+    auto &session = *queued.session;
+
+    if (!update.has_commit_updates()) {
+        session.staged_updates.push_back(&update);
+
+        // The updates of a message are staged one after another
+        if (session.staged_messages.empty() || session.staged_messages.back() != &queued) {
+            queued.references++;
+            session.staged_messages.push_back(&queued);
+        }
 
-            break;
+        if (session.staged_updates.size() >= max_staged_updates || session.staged_messages.size() >= max_staged_messages) {
+            blog(LOG_WARNING, "[react-obs] Session %s sent %zu updates without a commit, applying them", session.client_id.c_str(), session.staged_updates.size());
+            apply_staged_updates(session);
         }
 
+        return;
+    }
+
+    auto start_time = os_gettime_ns();
+    auto update_count = session.staged_updates.size() + 1;
+
+    apply_staged_updates(session);
+    apply_updates(session, update);
+
+    auto apply_time = os_gettime_ns() - start_time;
+
+    blog(LOG_DEBUG, "[react-obs] Applied commit of %zu updates in %.3f ms", update_count, apply_time / 1000000.0);
+
+    update_credits.batch_committed(client);
+}
+
+// Applies a queued message, or releases a session. Called from the video
+// tick, under `render_mutex`.
+void apply_queued_update(QueuedUpdate &queued) {
+    if (queued.kind == QueuedUpdate::Kind::ReleaseSession) {
+        destroy_session(queued.session);
+        return;
+    }
+
+    auto &client = *queued.client;
+    auto &session = *queued.session;
+    auto &message = *queued.message;
+
+    switch (message.message_case()) {
         case protocol::ClientMessage::MessageCase::kApplyUpdate: {
-            auto command = message.apply_update();
+            const auto &command = message.apply_update();
 
             if (DEBUG_UPDATE) {
                 blog(LOG_DEBUG, "[react-obs] Received update request: %s", command.DebugString().c_str());
             }
 
-            pthread_mutex_lock(&render_mutex);
-            apply_updates(command);
-            pthread_mutex_unlock(&render_mutex);
+            stage_update(queued, command);
 
             break;
         }
 
+        case protocol::ClientMessage::MessageCase::kUpdateBatch: {
+            const auto &batch = message.update_batch();
+
+            if (DEBUG_UPDATE) {
+                blog(LOG_DEBUG, "[react-obs] Received batch of %i updates (%zu bytes)", batch.updates_size(), batch.ByteSizeLong());
+            }
+
+            for (const auto &update : batch.updates()) {
+                stage_update(queued, update);
+            }
+
+            break;
+        }
+
+        // Not staged: the client waits for the response before it sends any
+        // update using the handle, so the source is always registered before
+        // those updates are applied
         case protocol::ClientMessage::MessageCase::kFindSource: {
-            auto command = message.find_source();
+            const auto &command = message.find_source();
 
             if (DEBUG_UPDATE) {
                 blog(LOG_DEBUG, "[react-obs] Received find source request for name %s", command.name().c_str());
             }
 
-            auto success = register_unmanaged_source(command.uid(), command.name());
+            auto success = register_unmanaged_source(session, command.handle(), command.uid(), command.name());
 
-            protocol::ServerMessage message;
-            auto response = message.mutable_response();
+            protocol::ServerMessage response_message;
+            auto response = response_message.mutable_response();
             response->set_request_id(command.request_id());
             response->set_success(success);
 
+            client.send(response_message);
+
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+uint64_t update_budget_ns = 0;
+
+// Applies queued updates until the budget is used up, leaving the rest for the
+// next tick. Whole messages are applied, and updates only take effect with
+// their commit, so a frame never shows a partly applied commit. Called from
+// the video tick, under `render_mutex`.
+void drain_update_queue() {
+    auto start_time = os_gettime_ns();
+    size_t applied = 0;
+
+    while (auto queued = update_queue.pop()) {
+        queued->references = 1;
+
+        apply_queued_update(*queued);
+        release_queued_update(queued);
+        applied++;
+
+        if (update_budget_ns > 0 && os_gettime_ns() - start_time >= update_budget_ns) {
+            break;
+        }
+    }
+
+    if (!update_queue.empty()) {
+        blog(LOG_DEBUG, "[react-obs] Update budget used up after %zu messages, deferring the rest", applied);
+    }
+}
+
+// Drops queued messages, but still releases the sessions queued for it.
+// Called on shutdown, under `render_mutex`.
+void discard_update_queue() {
+    while (auto queued = update_queue.pop()) {
+        if (queued->kind == QueuedUpdate::Kind::ReleaseSession) {
+            destroy_session(queued->session);
+        }
+
+        queued_update_pool.release(queued);
+    }
+}
+
+void message_received_from_client(
+    ClientConnection& client,
+    const protocol::ClientMessage& message
+) {
+    switch (message.message_case()) {
+        case protocol::ClientMessage::MessageCase::kInitRequest: {
+            const auto &init_request = message.init_request();
+
+            blog(LOG_DEBUG, "[react-obs] Received init request from %s", init_request.client_id().c_str());
+
+            bool resumed;
+            attach_session(client, init_request.client_id(), resumed);
+
+            protocol::ServerMessage message;
+            auto response = message.mutable_response();
+            response->set_request_id(init_request.request_id());
+            response->set_success(true);
+            response->set_session_resumed(resumed);
+
+            if (init_request.shared_memory_ring_size() > 0) {
+                auto ring_size = client.enable_shared_memory(init_request.shared_memory_ring_size());
+
+                if (ring_size > 0) {
+                    response->mutable_shared_memory()->set_ring_size(ring_size);
+                }
+            }
+
+            if (init_request.compression() != protocol::COMPRESSION_NONE) {
+                auto algorithm = client.enable_compression(init_request.compression());
+
+                if (algorithm != protocol::COMPRESSION_NONE) {
+                    auto compression = response->mutable_compression();
+                    compression->set_algorithm(algorithm);
+                    compression->set_threshold(client.get_compression_threshold());
+
+                    if (client.uses_compression_dictionary()) {
+                        compression->set_dictionary(compression_dictionary, sizeof(compression_dictionary) - 1);
+                    }
+                }
+            }
+
+            if (init_request.flow_control()) {
+                response->set_update_credits(update_credits.add_client(client));
+            }
+
             client.send(message);
 
             break;
         }
 
+        case protocol::ClientMessage::MessageCase::kApplyUpdate:
+        case protocol::ClientMessage::MessageCase::kUpdateBatch:
+        case protocol::ClientMessage::MessageCase::kFindSource: {
+            auto session = require_session(client);
+
+            if (!session) {
+                break;
+            }
+
+            // Applied by the next video tick, see `drain_update_queue`
+            queue_message(client, session, message);
+
+            break;
+        }
+
         case protocol::ClientMessage::MessageCase::MESSAGE_NOT_SET:
             blog(LOG_ERROR, "[react-obs] Empty message with no cases received");
             client.disconnect();
@@ -152,7 +331,56 @@ void message_received_from_client(
     }
 }
 
-ApiServer api_server(6666, message_received_from_client);
+void connection_closed(ClientConnection& client) {
+    detach_session(client);
+}
+
+ApiServer api_server(message_received_from_client, connection_closed);
+
+//
+// Video tick
+//
+
+void on_tick_callback(void* context, float elapsed_seconds) {
+    UNUSED_PARAMETER(context);
+    UNUSED_PARAMETER(elapsed_seconds);
+
+    // Shadow state only changes on the tick, so with nothing queued, measured
+    // or waiting to expire, there is nothing to do and nothing to lock
+    if (update_queue.empty() && measured_sources.empty() && disconnected_sessions == 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&render_mutex);
+
+    drain_update_queue();
+
+    // Only does work for what changed since the last tick
+    for (auto shadow : measured_sources) {
+        check_source_dimensions(shadow);
+    }
+
+    for (auto parent : draw_order_queue) {
+        parent->draw_order_queued = false;
+        reconcile_draw_order(parent);
+    }
+
+    draw_order_queue.clear();
+
+    for (auto root : layout_queue) {
+        root->layout_queued = false;
+        perform_layout(root);
+    }
+
+    layout_queue.clear();
+
+    expire_sessions();
+
+    // Everything committed so far has been rendered
+    update_credits.replenish();
+
+    pthread_mutex_unlock(&render_mutex);
+}
 
 //
 // Plugin API
@@ -163,7 +391,12 @@ void initialize() {
 
     YGConfigSetLogger(yoga_config, yoga_logger);
 
-    api_server.start();
+    auto settings = load_settings();
+    update_credits.set_window(settings.update_credit_window);
+    session_grace_period_ns = settings.session_grace_period_ms * 1000000ULL;
+    update_budget_ns = settings.update_budget_ms * 1000000ULL;
+
+    api_server.start(settings.api_server);
     obs_add_tick_callback(on_tick_callback, nullptr);
 
     // log_scene_names();
@@ -172,7 +405,19 @@ void initialize() {
 }
 
 void shutdown() {
+    // The tick sends to connections, so it has to stop before they close
+    obs_remove_tick_callback(on_tick_callback, nullptr);
+
+    // Closes every connection and detaches its session
     api_server.stop();
+
+    // Nothing can be queued or ticked anymore
+    pthread_mutex_lock(&render_mutex);
+
+    discard_update_queue();
+    release_all_sessions();
+
+    pthread_mutex_unlock(&render_mutex);
 }
 
 //
@@ -0,0 +1,196 @@
+#include <cerrno>
+#include <vector>
+#include <unistd.h>
+#include <fcntl.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#else
+#include <poll.h>
+#endif
+
+struct ReactorEvent {
+    int fd;
+    bool readable;
+    bool writable;
+    bool closed;
+};
+
+// Readiness notifications for a set of non-blocking file descriptors.
+//
+// Uses epoll on Linux and falls back to poll(2) elsewhere (macOS). All methods
+// except `wake` must be called from the thread running `wait`.
+class Reactor {
+    int wake_read_fd = -1;
+    int wake_write_fd = -1;
+
+#ifdef __linux__
+    int epoll_fd = -1;
+    std::vector<epoll_event> epoll_events;
+#else
+    std::vector<pollfd> poll_fds;
+#endif
+
+public:
+    Reactor() = default;
+
+    Reactor(const Reactor&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+
+    ~Reactor() {
+        close();
+    }
+
+    bool open() {
+        int wake_fds[2];
+
+        if (pipe(wake_fds) != 0) {
+            blog(LOG_ERROR, "[react-obs] Cannot create reactor wake pipe");
+            return false;
+        }
+
+        wake_read_fd = wake_fds[0];
+        wake_write_fd = wake_fds[1];
+
+        fcntl(wake_read_fd, F_SETFL, fcntl(wake_read_fd, F_GETFL) | O_NONBLOCK);
+        fcntl(wake_write_fd, F_SETFL, fcntl(wake_write_fd, F_GETFL) | O_NONBLOCK);
+
+#ifdef __linux__
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+
+        if (epoll_fd < 0) {
+            blog(LOG_ERROR, "[react-obs] Cannot create epoll instance");
+            close();
+            return false;
+        }
+
+        epoll_events.resize(64);
+#endif
+
+        return add(wake_read_fd);
+    }
+
+    void close() {
+#ifdef __linux__
+        if (epoll_fd >= 0) {
+            ::close(epoll_fd);
+            epoll_fd = -1;
+        }
+#else
+        poll_fds.clear();
+#endif
+
+        if (wake_read_fd >= 0) {
+            ::close(wake_read_fd);
+            wake_read_fd = -1;
+        }
+
+        if (wake_write_fd >= 0) {
+            ::close(wake_write_fd);
+            wake_write_fd = -1;
+        }
+    }
+
+    // Watches for incoming data, or for room to write if `writable` is set
+    bool add(int fd, bool writable = false) {
+#ifdef __linux__
+        epoll_event event {};
+        event.events = writable ? EPOLLOUT : (EPOLLIN | EPOLLRDHUP);
+        event.data.fd = fd;
+
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            blog(LOG_ERROR, "[react-obs] Cannot add fd %i to epoll: %i", fd, errno);
+            return false;
+        }
+#else
+        poll_fds.push_back(pollfd { fd, (short)(writable ? POLLOUT : POLLIN), 0 });
+#endif
+
+        return true;
+    }
+
+    void remove(int fd) {
+#ifdef __linux__
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+#else
+        for (auto it = poll_fds.begin(); it != poll_fds.end(); ++it) {
+            if (it->fd == fd) {
+                poll_fds.erase(it);
+                break;
+            }
+        }
+#endif
+    }
+
+    // Can be called from any thread to interrupt a blocked `wait`
+    void wake() {
+        char byte = 1;
+        auto written = write(wake_write_fd, &byte, 1);
+
+        // A full pipe already guarantees a wakeup
+        UNUSED_PARAMETER(written);
+    }
+
+    // Blocks until at least one fd is ready or `wake` is called. Wakeups are
+    // not reported as events, so `events` may be empty on return.
+    bool wait(std::vector<ReactorEvent> &events, int timeout_ms = -1) {
+        events.clear();
+
+#ifdef __linux__
+        int count = epoll_wait(epoll_fd, epoll_events.data(), (int)epoll_events.size(), timeout_ms);
+
+        if (count < 0) {
+            return errno == EINTR;
+        }
+
+        for (int i = 0; i < count; i++) {
+            auto &event = epoll_events[i];
+
+            if (event.data.fd == wake_read_fd) {
+                drain_wake_pipe();
+                continue;
+            }
+
+            events.push_back(ReactorEvent {
+                .fd = event.data.fd,
+                .readable = (event.events & EPOLLIN) != 0,
+                .writable = (event.events & EPOLLOUT) != 0,
+                .closed = (event.events & (EPOLLHUP | EPOLLERR | EPOLLRDHUP)) != 0
+            });
+        }
+#else
+        int count = poll(poll_fds.data(), (nfds_t)poll_fds.size(), timeout_ms);
+
+        if (count < 0) {
+            return errno == EINTR;
+        }
+
+        for (auto &poll_fd : poll_fds) {
+            if (!poll_fd.revents) {
+                continue;
+            }
+
+            if (poll_fd.fd == wake_read_fd) {
+                drain_wake_pipe();
+                continue;
+            }
+
+            events.push_back(ReactorEvent {
+                .fd = poll_fd.fd,
+                .readable = (poll_fd.revents & POLLIN) != 0,
+                .writable = (poll_fd.revents & POLLOUT) != 0,
+                .closed = (poll_fd.revents & (POLLHUP | POLLERR | POLLNVAL)) != 0
+            });
+        }
+#endif
+
+        return true;
+    }
+
+private:
+    void drain_wake_pipe() {
+        char buffer[64];
+
+        while (read(wake_read_fd, buffer, sizeof(buffer)) > 0) {}
+    }
+};
@@ -0,0 +1,226 @@
+// Controllers are identified by the client id in their init request. All
+// sources, sceneitems and layout nodes a controller creates belong to its
+// session, and are released once its connection closes. With a grace period,
+// a controller reconnecting with the same client id in time gets its session
+// back instead. A connection using the client id of a connected session takes
+// it over, and the previous connection is closed.
+//
+// `sessions_mutex` is never held while taking another lock.
+static pthread_mutex_t sessions_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+std::unordered_map<std::string, Session*> sessions;
+uint64_t session_grace_period_ns = 0;
+
+// Sessions waiting out their grace period, so the tick can skip
+// `expire_sessions` without locking
+std::atomic<size_t> disconnected_sessions = 0;
+
+// Sets `resumed` if the client id already had a session
+Session* attach_session(ClientConnection &client, const std::string &client_id, bool &resumed) {
+    auto attached = (Session*)client.get_context();
+
+    if (attached) {
+        blog(LOG_WARNING, "[react-obs] Connection %zu already belongs to session %s", client.get_id(), attached->client_id.c_str());
+        resumed = true;
+        return attached;
+    }
+
+    std::shared_ptr<ClientConnection> previous_connection;
+
+    pthread_mutex_lock(&sessions_mutex);
+
+    auto &session = sessions[client_id];
+    resumed = session != nullptr;
+
+    if (!session) {
+        session = new Session {
+            .client_id = client_id,
+            .nodes = {},
+            .node_table = {},
+            .shadow_sources_by_uid = {},
+            .interned = {},
+            .staged_updates = {},
+            .staged_messages = {},
+            .connection_id = client.get_id(),
+            .connection = client.shared_from_this(),
+            .connected = true,
+            .disconnected_at_ns = 0,
+            .attached_connections = 1,
+            .released = false
+        };
+
+        blog(LOG_INFO, "[react-obs] Started session %s", client_id.c_str());
+    } else {
+        blog(
+            LOG_INFO,
+            session->connected ? "[react-obs] Session %s taken over by a new connection" : "[react-obs] Resumed session %s",
+            client_id.c_str()
+        );
+
+        if (session->connected) {
+            previous_connection = session->connection.lock();
+        } else {
+            disconnected_sessions--;
+        }
+
+        session->connection_id = client.get_id();
+        session->connection = client.shared_from_this();
+        session->connected = true;
+        session->attached_connections++;
+    }
+
+    auto attached_session = session;
+
+    pthread_mutex_unlock(&sessions_mutex);
+
+    client.set_context(attached_session);
+
+    // Only one controller can drive a session. The previous connection keeps
+    // its context until it has closed, as its worker may still be using it.
+    if (previous_connection) {
+        previous_connection->disconnect();
+    }
+
+    return attached_session;
+}
+
+// The session of a connection, which must have sent its init request first
+Session* require_session(ClientConnection &client) {
+    auto session = (Session*)client.get_context();
+
+    if (!session) {
+        blog(LOG_ERROR, "[react-obs] Received a request before the init request");
+        client.disconnect();
+    }
+
+    return session;
+}
+
+// Drops the staged updates, and gives back the messages they are in. Called
+// from the video tick, under `render_mutex`.
+void release_staged_updates(Session &session) {
+    for (auto queued : session.staged_messages) {
+        release_queued_update(queued);
+    }
+
+    session.staged_updates.clear();
+    session.staged_messages.clear();
+}
+
+// Must be called under `render_mutex`
+void destroy_session(Session* session) {
+    // Updates which were never committed are dropped with the session
+    release_staged_updates(*session);
+
+    auto count = release_session_sources(*session);
+
+    blog(LOG_INFO, "[react-obs] Released session %s with %zu sources", session->client_id.c_str(), count);
+
+    delete session;
+}
+
+// Called once a connection has closed and all of its messages have been queued
+void detach_session(ClientConnection &client) {
+    auto session = (Session*)client.get_context();
+
+    if (!session) {
+        return;
+    }
+
+    client.set_context(nullptr);
+
+    pthread_mutex_lock(&sessions_mutex);
+
+    session->attached_connections--;
+
+    // Otherwise another connection has taken the session over
+    auto was_connected = session->connected && session->connection_id == client.get_id();
+
+    if (was_connected) {
+        session->connected = false;
+        session->disconnected_at_ns = os_gettime_ns();
+
+        if (session_grace_period_ns == 0) {
+            sessions.erase(session->client_id);
+            session->released = true;
+        } else {
+            disconnected_sessions++;
+        }
+    }
+
+    // The last connection to close queues the release, after all the updates
+    // any of them sent
+    auto release_now = session->released && session->attached_connections == 0;
+
+    pthread_mutex_unlock(&sessions_mutex);
+
+    if (release_now) {
+        queue_session_release(session);
+    } else if (was_connected && session_grace_period_ns != 0) {
+        blog(LOG_INFO, "[react-obs] Session %s disconnected, keeping it for the grace period", session->client_id.c_str());
+    }
+}
+
+// Releases every session, including those waiting out their grace period.
+// Called on shutdown, under `render_mutex`.
+void release_all_sessions() {
+    std::vector<Session*> released;
+
+    pthread_mutex_lock(&sessions_mutex);
+
+    for (auto &entry : sessions) {
+        released.push_back(entry.second);
+    }
+
+    sessions.clear();
+    disconnected_sessions = 0;
+
+    pthread_mutex_unlock(&sessions_mutex);
+
+    for (auto session : released) {
+        destroy_session(session);
+    }
+}
+
+// Releases sessions whose grace period is over. Called from the video tick,
+// under `render_mutex`.
+void expire_sessions() {
+    if (disconnected_sessions == 0) {
+        return;
+    }
+
+    // Updates of an expired session may still be queued if the tick ran out of
+    // budget, they have to be applied first
+    if (!update_queue.empty()) {
+        return;
+    }
+
+    std::vector<Session*> expired;
+    auto now = os_gettime_ns();
+
+    pthread_mutex_lock(&sessions_mutex);
+
+    for (auto it = sessions.begin(); it != sessions.end();) {
+        auto session = it->second;
+
+        // A connection it was taken over from may still be queueing updates
+        if (
+            session->connected ||
+            session->attached_connections > 0 ||
+            now - session->disconnected_at_ns < session_grace_period_ns
+        ) {
+            ++it;
+            continue;
+        }
+
+        expired.push_back(session);
+        it = sessions.erase(it);
+        disconnected_sessions--;
+    }
+
+    pthread_mutex_unlock(&sessions_mutex);
+
+    for (auto session : expired) {
+        destroy_session(session);
+    }
+}
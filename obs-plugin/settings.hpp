@@ -0,0 +1,93 @@
+OverflowPolicy parse_overflow_policy(const char* name) {
+    if (strcmp(name, "coalesce") == 0) {
+        return OverflowPolicy::Coalesce;
+    }
+
+    if (strcmp(name, "disconnect") == 0) {
+        return OverflowPolicy::Disconnect;
+    }
+
+    if (strcmp(name, "drop-oldest") != 0) {
+        blog(LOG_WARNING, "[react-obs] Unknown outbound overflow policy '%s', using 'drop-oldest'", name);
+    }
+
+    return OverflowPolicy::DropOldest;
+}
+
+static constexpr uint16_t default_tcp_port = 6666;
+
+uint16_t parse_tcp_port(long long port) {
+    if (port < 1 || port > UINT16_MAX) {
+        blog(LOG_WARNING, "[react-obs] TCP port %lld is out of range, using %u", port, default_tcp_port);
+        return default_tcp_port;
+    }
+
+    return (uint16_t)port;
+}
+
+struct PluginSettings {
+    ApiServerSettings api_server;
+
+    // Update batches a flow controlled client may have in flight
+    uint32_t update_credit_window;
+
+    // How long the sources of a disconnected controller are kept for it to reconnect
+    uint64_t session_grace_period_ms;
+
+    // Time each video tick may spend applying queued updates, 0 for no limit
+    uint64_t update_budget_ms;
+};
+
+// Settings are read from `settings.json` in the plugin's config directory
+// (e.g. `~/.config/obs-studio/plugin_config/react-obs/settings.json`).
+// Missing keys fall back to the defaults below.
+PluginSettings load_settings() {
+    auto path = obs_module_config_path("settings.json");
+    auto data = obs_data_create_from_json_file_safe(path, "bak");
+
+    if (!data) {
+        data = obs_data_create();
+    }
+
+    obs_data_set_default_bool(data, "tcp_enabled", true);
+    obs_data_set_default_int(data, "tcp_port", default_tcp_port);
+    obs_data_set_default_bool(data, "unix_socket_enabled", true);
+    obs_data_set_default_string(data, "unix_socket_path", "/tmp/react-obs.sock");
+    obs_data_set_default_int(data, "max_frame_size", 16 * 1024 * 1024);
+    obs_data_set_default_int(data, "outbound_queue_capacity", 256);
+    obs_data_set_default_string(data, "outbound_overflow_policy", "drop-oldest");
+    obs_data_set_default_bool(data, "compression_enabled", true);
+    obs_data_set_default_int(data, "compression_threshold", 1024);
+    obs_data_set_default_bool(data, "compression_dictionary", true);
+    obs_data_set_default_int(data, "update_credit_window", 2);
+    obs_data_set_default_int(data, "session_grace_period_ms", 0);
+    obs_data_set_default_int(data, "update_budget_ms", 4);
+
+    PluginSettings settings {
+        .api_server = ApiServerSettings {
+            .tcp_enabled = obs_data_get_bool(data, "tcp_enabled"),
+            .tcp_port = parse_tcp_port(obs_data_get_int(data, "tcp_port")),
+
+            .unix_socket_enabled = obs_data_get_bool(data, "unix_socket_enabled"),
+            .unix_socket_path = obs_data_get_string(data, "unix_socket_path"),
+
+            .max_frame_size = (size_t)obs_data_get_int(data, "max_frame_size"),
+
+            .outbound_queue_capacity = (size_t)obs_data_get_int(data, "outbound_queue_capacity"),
+            .outbound_overflow_policy = parse_overflow_policy(obs_data_get_string(data, "outbound_overflow_policy")),
+
+            .compression_enabled = obs_data_get_bool(data, "compression_enabled"),
+            .compression_threshold = (size_t)obs_data_get_int(data, "compression_threshold"),
+            .use_compression_dictionary = obs_data_get_bool(data, "compression_dictionary")
+        },
+
+        .update_credit_window = (uint32_t)obs_data_get_int(data, "update_credit_window"),
+        .session_grace_period_ms = (uint64_t)obs_data_get_int(data, "session_grace_period_ms"),
+        .update_budget_ms = (uint64_t)obs_data_get_int(data, "update_budget_ms")
+    };
+
+    obs_data_release(data);
+    bfree(path);
+
+    return settings;
+}
@@ -1,5 +1,16 @@
+struct Session;
+struct QueuedUpdate;
+
 struct ShadowSource {
+    // Either a session-local handle, or a uid string for older clients
+    uint32_t handle;
     std::string uid;
+
+    Session* session;
+
+    // Position in `Session::nodes`
+    size_t node_index;
+
     obs_source_t* source;
     YGNodeRef yoga_node;
     ShadowSource* container;
@@ -11,39 +22,146 @@ struct ShadowSource {
 
     uint32_t previous_width;
     uint32_t previous_height;
+
+    // Children are drawn in child order, unless some have a zIndex
+    int32_t z_index;
+    bool has_z_indexed_children;
+
+    // Whether the node is in `layout_queue` or `draw_order_queue`
+    bool layout_queued;
+    bool draw_order_queued;
 };
 
-static pthread_mutex_t shadow_sources_mutex = PTHREAD_MUTEX_INITIALIZER;
+// Everything a controller has created (see sessions.hpp for the lifecycle).
+// Apart from the connection state, only used by the video tick, under
+// `render_mutex`.
+struct Session {
+    std::string client_id;
+
+    // Owns the nodes
+    std::vector<ShadowSource*> nodes;
+
+    // Indexed by handle, so looking a node up does not hash anything
+    std::vector<ShadowSource*> node_table;
+    std::unordered_map<std::string, ShadowSource*> shadow_sources_by_uid;
+
+    InternTable interned;
+
+    // Updates received since the last CommitUpdates, applied once it arrives.
+    // They are not copied, the session keeps the messages they are in.
+    std::vector<const protocol::ApplyUpdate*> staged_updates;
+    std::vector<QueuedUpdate*> staged_messages;
+
+    // Connection currently using the session
+    size_t connection_id;
+    std::weak_ptr<ClientConnection> connection;
+    bool connected;
+    uint64_t disconnected_at_ns;
+
+    // Connections whose context is the session, including one it has been
+    // taken over from until that has closed. The session is only freed once
+    // none are left.
+    size_t attached_connections;
+
+    // Removed from `sessions`, waiting for its connections to close
+    bool released;
+};
 
 auto yoga_config = YGConfigNew();
 
-// TODO: Cleanup when reconnections happen
-std::vector<ShadowSource*> shadow_sources;
-std::set<ShadowSource*> containers;
-std::unordered_map<std::string, ShadowSource*> shadow_sources_by_uid;
+// The shadow tree is only changed and read by the video tick, which applies
+// queued updates before laying anything out (see `drain_update_queue`), so
+// these need no lock of their own, and a node can be freed as soon as it has
+// been removed.
+
+// Sources whose dimensions the video tick checks, as OBS does not signal changes
+std::vector<ShadowSource*> measured_sources;
+
+// Work for the next video tick: layout roots to lay out, and parents whose
+// draw order has to be reconciled
+std::vector<ShadowSource*> layout_queue;
+std::vector<ShadowSource*> draw_order_queue;
+
+// Keeps a misbehaving client from growing the node table without bounds
+static constexpr uint32_t max_node_handle = 1 << 20;
+
+// Formats a node reference for log messages, without allocating
+struct NodeName {
+    char text[48];
+
+    NodeName(uint32_t handle, const std::string &uid) {
+        if (handle != 0) {
+            snprintf(text, sizeof(text), "#%u", handle);
+        } else {
+            snprintf(text, sizeof(text), "%s", uid.c_str());
+        }
+    }
+
+    const char* c_str() const {
+        return text;
+    }
+};
+
+NodeName node_name(uint32_t handle, const std::string &uid) {
+    return NodeName(handle, uid);
+}
+
+// Looks the node up by `handle`, or by `uid` if the handle is 0
+ShadowSource* get_shadow_source(Session &session, uint32_t handle, const std::string &uid) {
+    if (handle != 0) {
+        return handle < session.node_table.size() ? session.node_table[handle] : nullptr;
+    }
 
-ShadowSource* get_shadow_source(const std::string &uid) {
-    pthread_mutex_lock(&shadow_sources_mutex);
-    auto shadow = shadow_sources_by_uid.find(uid);
+    auto shadow = session.shadow_sources_by_uid.find(uid);
 
-    if (shadow == shadow_sources_by_uid.end()) {
-        pthread_mutex_unlock(&shadow_sources_mutex);
+    if (shadow == session.shadow_sources_by_uid.end()) {
         return nullptr;
     }
 
-    pthread_mutex_unlock(&shadow_sources_mutex);
     return shadow->second;
 }
 
-void refresh_containers() {
-    containers.clear();
+// The node whose layout includes the given one: its container, or the root
+// of the layout tree for nodes which do not belong to one
+ShadowSource* layout_root(ShadowSource* shadow) {
+    while (!shadow->container) {
+        auto owner = YGNodeGetOwner(shadow->yoga_node);
 
-    for (size_t i = 0; i < shadow_sources.size(); i++) {
-        auto container = shadow_sources[i]->container;
-
-        if (container) {
-            containers.insert(container);
+        if (!owner) {
+            return shadow;
         }
+
+        shadow = (ShadowSource*)YGNodeGetContext(owner);
+    }
+
+    return shadow->container;
+}
+
+// Has the next video tick lay out the tree of a changed node
+void queue_layout(ShadowSource* shadow) {
+    auto root = layout_root(shadow);
+
+    if (!root->layout_queued) {
+        root->layout_queued = true;
+        layout_queue.push_back(root);
+    }
+}
+
+void queue_draw_order(ShadowSource* parent) {
+    if (!parent->draw_order_queued) {
+        parent->draw_order_queued = true;
+        draw_order_queue.push_back(parent);
+    }
+}
+
+// Drops a node which is about to be freed from the queues
+void dequeue_shadow_source(ShadowSource* shadow) {
+    if (shadow->layout_queued) {
+        layout_queue.erase(std::remove(layout_queue.begin(), layout_queue.end(), shadow), layout_queue.end());
+    }
+
+    if (shadow->draw_order_queued) {
+        draw_order_queue.erase(std::remove(draw_order_queue.begin(), draw_order_queue.end(), shadow), draw_order_queue.end());
     }
 }
 
@@ -55,10 +173,24 @@ YGSize yoga_measure_function(
     YGMeasureMode heightMode
 );
 
-ShadowSource* add_shadow_source(const std::string &uid, obs_source_t* source, bool managed, bool measured_externally, ShadowSource* container) {
+// Returns nullptr if the handle is invalid or already in use
+ShadowSource* add_shadow_source(Session &session, uint32_t handle, const std::string &uid, obs_source_t* source, bool managed, bool measured_externally, ShadowSource* container) {
+    if (handle >= max_node_handle) {
+        blog(LOG_ERROR, "[react-obs] Node handle %u is out of range", handle);
+        return nullptr;
+    }
+
+    if (handle != 0 && get_shadow_source(session, handle, uid)) {
+        blog(LOG_ERROR, "[react-obs] Node handle %u is already in use", handle);
+        return nullptr;
+    }
+
     auto yoga_node = YGNodeNewWithConfig(yoga_config);
     auto shadow = new ShadowSource {
+        .handle = handle,
         .uid = uid,
+        .session = &session,
+        .node_index = session.nodes.size(),
         .source = source,
         .yoga_node = yoga_node,
         .container = container,
@@ -67,20 +199,36 @@ ShadowSource* add_shadow_source(const std::string &uid, obs_source_t* source, bo
         .sceneitem = nullptr,
 
         .previous_width = 0,
-        .previous_height = 0
+        .previous_height = 0,
+
+        .z_index = 0,
+        .has_z_indexed_children = false,
+
+        .layout_queued = false,
+        .draw_order_queued = false
     };
 
     YGNodeSetContext(yoga_node, shadow);
 
-    pthread_mutex_lock(&shadow_sources_mutex);
-    shadow_sources.push_back(shadow);
-    shadow_sources_by_uid[uid] = shadow;
-    refresh_containers();
-    pthread_mutex_unlock(&shadow_sources_mutex);
+    session.nodes.push_back(shadow);
+
+    if (handle != 0) {
+        if (session.node_table.size() <= handle) {
+            session.node_table.resize(handle + 1, nullptr);
+        }
+
+        session.node_table[handle] = shadow;
+    } else {
+        session.shadow_sources_by_uid[uid] = shadow;
+    }
+
+    if (measured_externally) {
+        measured_sources.push_back(shadow);
+    }
 
     if (measured_externally) {
         if (DEBUG_LAYOUT) {
-            blog(LOG_DEBUG, "[react-obs] [layout] Adding externally measured node %s", uid.c_str());
+            blog(LOG_DEBUG, "[react-obs] [layout] Adding externally measured node %s", node_name(handle, uid).c_str());
         }
 
         YGNodeSetMeasureFunc(yoga_node, yoga_measure_function);
@@ -89,23 +237,111 @@ ShadowSource* add_shadow_source(const std::string &uid, obs_source_t* source, bo
     return shadow;
 }
 
-void remove_shadow_source(const std::string &uid) {
-    auto shadow = get_shadow_source(uid);
+// Drops a node from the lookup tables and the tick's lists, in constant time
+// unless it is measured
+void unregister_shadow_source(ShadowSource* shadow) {
+    auto &session = *shadow->session;
 
-    if (!shadow) {
-        return;
+    if (shadow->handle != 0) {
+        session.node_table[shadow->handle] = nullptr;
+    } else {
+        session.shadow_sources_by_uid.erase(shadow->uid);
     }
 
-    pthread_mutex_lock(&shadow_sources_mutex);
-    YGNodeSetContext(shadow->yoga_node, nullptr);
+    // The order of the nodes does not matter
+    auto last = session.nodes.back();
+    session.nodes[shadow->node_index] = last;
+    last->node_index = shadow->node_index;
+    session.nodes.pop_back();
 
-    shadow_sources_by_uid.erase(uid);
+    if (shadow->measured_externally) {
+        measured_sources.erase(std::remove(measured_sources.begin(), measured_sources.end(), shadow), measured_sources.end());
+    }
+
+    dequeue_shadow_source(shadow);
+}
 
-    shadow_sources.erase(std::remove(shadow_sources.begin(), shadow_sources.end(), shadow), shadow_sources.end());
+// Frees a managed node which has been removed from its parent, along with its
+// managed descendants, and returns how many were freed. Unmanaged nodes (see
+// `register_unmanaged_source`) are only detached, the controller may add them
+// again.
+size_t release_shadow_subtree(ShadowSource* root) {
+    std::vector<ShadowSource*> released { root };
+    std::vector<ShadowSource*> detached;
+
+    for (size_t i = 0; i < released.size(); i++) {
+        auto yoga_node = released[i]->yoga_node;
+        auto child_count = YGNodeGetChildCount(yoga_node);
+
+        for (uint32_t j = 0; j < child_count; j++) {
+            auto child = (ShadowSource*)YGNodeGetContext(YGNodeGetChild(yoga_node, j));
+
+            (child->managed ? released : detached).push_back(child);
+        }
+    }
+
+    // Sceneitems go first, while all of the scenes holding them are alive
+    for (auto nodes : { &released, &detached }) {
+        for (auto shadow : *nodes) {
+            if (shadow->sceneitem) {
+                obs_sceneitem_remove(shadow->sceneitem);
+                obs_sceneitem_release(shadow->sceneitem);
+                shadow->sceneitem = nullptr;
+            }
+        }
+    }
+
+    for (auto shadow : detached) {
+        YGNodeRemoveChild(YGNodeGetOwner(shadow->yoga_node), shadow->yoga_node);
+    }
+
+    for (auto shadow : released) {
+        unregister_shadow_source(shadow);
+
+        // Also detaches the node from its parent and its children
+        YGNodeFree(shadow->yoga_node);
+        obs_source_release(shadow->source);
+
+        delete shadow;
+    }
+
+    return released.size();
+}
+
+// Removes every sceneitem the session added, frees its layout nodes and
+// releases its sources. Must be called under `render_mutex`.
+size_t release_session_sources(Session &session) {
+    auto &session_sources = session.nodes;
+    auto count = session_sources.size();
+
+    // Sceneitems go first, while all of the scenes holding them are alive
+    for (auto shadow : session_sources) {
+        if (shadow->sceneitem) {
+            obs_sceneitem_remove(shadow->sceneitem);
+            obs_sceneitem_release(shadow->sceneitem);
+            shadow->sceneitem = nullptr;
+        }
+    }
+
+    auto in_session = [&session](ShadowSource* shadow) {
+        return shadow->session == &session;
+    };
+
+    measured_sources.erase(std::remove_if(measured_sources.begin(), measured_sources.end(), in_session), measured_sources.end());
+    layout_queue.erase(std::remove_if(layout_queue.begin(), layout_queue.end(), in_session), layout_queue.end());
+    draw_order_queue.erase(std::remove_if(draw_order_queue.begin(), draw_order_queue.end(), in_session), draw_order_queue.end());
+
+    for (auto shadow : session_sources) {
+        // Also detaches the node from its parent and its children
+        YGNodeFree(shadow->yoga_node);
+        obs_source_release(shadow->source);
+
+        delete shadow;
+    }
 
-    obs_source_release(shadow->source);
-    delete shadow;
+    session_sources.clear();
+    session.node_table.clear();
+    session.shadow_sources_by_uid.clear();
 
-    refresh_containers();
-    pthread_mutex_unlock(&shadow_sources_mutex);
+    return count;
 }
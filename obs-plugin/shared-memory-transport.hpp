@@ -0,0 +1,297 @@
+// Shared memory transport for controllers running on the same host (Linux only).
+//
+// A memfd holds two single-producer/single-consumer rings, one per direction.
+// Each ring carries exactly the same frames as the socket (a 4-byte big-endian
+// length followed by the serialized message), so sending a message is a
+// memcpy and receiving it is a parse. Wakeups go through eventfds, and only
+// when the reader has announced that it is going to sleep, so a busy stream of
+// messages does not cross into the kernel at all.
+//
+// Memory layout (`ring_size` is negotiated in `InitRequest` and is a power of two):
+//
+//   [SharedRingHeader][ring_size bytes]  client -> server
+//   [SharedRingHeader][ring_size bytes]  server -> client
+//
+// The memfd and the two eventfds (client -> server, server -> client) are
+// passed to the client with SCM_RIGHTS, together with the init response.
+
+#ifdef __linux__
+#define REACT_OBS_SHARED_MEMORY 1
+
+#include <array>
+#include <atomic>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+
+struct SharedRingHeader {
+    alignas(64) std::atomic<uint64_t> write_position;
+    alignas(64) std::atomic<uint64_t> read_position;
+
+    // Set by the reader before it sleeps on the eventfd
+    alignas(64) std::atomic<uint32_t> reader_waiting;
+};
+
+class SharedRing {
+    SharedRingHeader* header = nullptr;
+    unsigned char* data = nullptr;
+    uint64_t capacity = 0;
+
+    // Signalled by the writer whenever it finds the reader waiting
+    int event_fd = -1;
+
+public:
+    SharedRing() = default;
+
+    SharedRing(void* memory, uint64_t _capacity, int _event_fd)
+        : header((SharedRingHeader*)memory),
+          data((unsigned char*)memory + sizeof(SharedRingHeader)),
+          capacity(_capacity),
+          event_fd(_event_fd) {}
+
+    static size_t memory_size(uint64_t capacity) {
+        return sizeof(SharedRingHeader) + capacity;
+    }
+
+    void initialize() {
+        header->write_position.store(0);
+        header->read_position.store(0);
+        header->reader_waiting.store(1);
+    }
+
+    //
+    // Writer side
+    //
+
+    // Returns false if there is not enough free space for the frame
+    bool write_frame(const void* packet, uint32_t packet_size) {
+        uint64_t frame_size = sizeof(uint32_t) + packet_size;
+
+        auto write_position = header->write_position.load(std::memory_order_relaxed);
+        auto read_position = header->read_position.load(std::memory_order_acquire);
+
+        if (capacity - (write_position - read_position) < frame_size) {
+            return false;
+        }
+
+        uint32_t size_header = htonl(packet_size);
+        copy_in(write_position, &size_header, sizeof(uint32_t));
+        copy_in(write_position + sizeof(uint32_t), packet, packet_size);
+
+        header->write_position.store(write_position + frame_size, std::memory_order_release);
+
+        // Pairs with the fence in `prepare_wait`: either the reader sees the
+        // new position, or we see that it is waiting
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (header->reader_waiting.load(std::memory_order_relaxed) && header->reader_waiting.exchange(0)) {
+            uint64_t one = 1;
+            auto written = ::write(event_fd, &one, sizeof(uint64_t));
+
+            UNUSED_PARAMETER(written);
+        }
+
+        return true;
+    }
+
+    uint64_t max_packet_size() const {
+        return capacity - sizeof(uint32_t);
+    }
+
+    //
+    // Reader side
+    //
+
+    // Calls `on_packet(data, size)` for every complete frame. Frames which do
+    // not wrap around the end of the ring are passed without copying.
+    //
+    // The header and the ring are writable by the client, so positions and
+    // sizes are checked before use. Returns false on any inconsistency or if
+    // `on_packet` returns false.
+    template <class F>
+    bool read_frames(std::vector<unsigned char> &scratch, size_t max_frame_size, F on_packet) {
+        auto read_position = header->read_position.load(std::memory_order_relaxed);
+        auto write_position = header->write_position.load(std::memory_order_acquire);
+
+        if (write_position - read_position > capacity) {
+            blog(LOG_ERROR, "[react-obs] Shared memory ring positions are out of range");
+            return false;
+        }
+
+        while (write_position - read_position >= sizeof(uint32_t)) {
+            uint32_t packet_size;
+            copy_out(read_position, &packet_size, sizeof(uint32_t));
+            packet_size = ntohl(packet_size);
+
+            if (packet_size > max_packet_size() || packet_size > max_frame_size) {
+                blog(LOG_ERROR, "[react-obs] Frame of %u bytes exceeds the maximum of %zu", packet_size,
+                     std::min<size_t>(max_packet_size(), max_frame_size));
+                return false;
+            }
+
+            if (write_position - read_position - sizeof(uint32_t) < packet_size) {
+                blog(LOG_ERROR, "[react-obs] Shared memory ring contains a partial frame");
+                return false;
+            }
+
+            auto offset = (read_position + sizeof(uint32_t)) & (capacity - 1);
+            bool success;
+
+            if (offset + packet_size <= capacity) {
+                success = on_packet(&data[offset], packet_size);
+            } else {
+                scratch.resize(packet_size);
+                copy_out(read_position + sizeof(uint32_t), scratch.data(), packet_size);
+
+                success = on_packet(scratch.data(), packet_size);
+            }
+
+            if (!success) {
+                return false;
+            }
+
+            read_position += sizeof(uint32_t) + packet_size;
+        }
+
+        header->read_position.store(read_position, std::memory_order_release);
+
+        return true;
+    }
+
+    // Announces that the reader is going to sleep on the eventfd. Returns false
+    // (and does not sleep) if data arrived in the meantime.
+    bool prepare_wait() {
+        header->reader_waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        auto read_position = header->read_position.load(std::memory_order_relaxed);
+        auto write_position = header->write_position.load(std::memory_order_relaxed);
+
+        if (read_position != write_position) {
+            header->reader_waiting.store(0, std::memory_order_relaxed);
+            return false;
+        }
+
+        return true;
+    }
+
+    void clear_event() {
+        uint64_t count;
+        auto read_size = ::read(event_fd, &count, sizeof(uint64_t));
+
+        UNUSED_PARAMETER(read_size);
+    }
+
+private:
+    void copy_in(uint64_t position, const void* source, size_t size) {
+        auto offset = position & (capacity - 1);
+        auto first_part = std::min<uint64_t>(size, capacity - offset);
+
+        memcpy(&data[offset], source, first_part);
+        memcpy(&data[0], (const unsigned char*)source + first_part, size - first_part);
+    }
+
+    void copy_out(uint64_t position, void* target, size_t size) {
+        auto offset = position & (capacity - 1);
+        auto first_part = std::min<uint64_t>(size, capacity - offset);
+
+        memcpy(target, &data[offset], first_part);
+        memcpy((unsigned char*)target + first_part, &data[0], size - first_part);
+    }
+};
+
+class SharedMemoryChannel {
+    static constexpr uint32_t min_ring_size = 64 * 1024;
+    static constexpr uint32_t max_ring_size = 64 * 1024 * 1024;
+
+    int memory_fd = -1;
+    int inbound_event_fd = -1;
+    int outbound_event_fd = -1;
+
+    void* memory = MAP_FAILED;
+    size_t memory_size = 0;
+    uint32_t ring_size = 0;
+
+public:
+    // Client -> server
+    SharedRing inbound;
+
+    // Server -> client
+    SharedRing outbound;
+
+    SharedMemoryChannel() = default;
+
+    SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+    SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+
+    ~SharedMemoryChannel() {
+        if (memory != MAP_FAILED) {
+            munmap(memory, memory_size);
+        }
+
+        for (auto fd : { memory_fd, inbound_event_fd, outbound_event_fd }) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    static std::unique_ptr<SharedMemoryChannel> create(uint32_t requested_ring_size) {
+        auto channel = std::make_unique<SharedMemoryChannel>();
+
+        uint32_t ring_size = min_ring_size;
+        while (ring_size < requested_ring_size && ring_size < max_ring_size) {
+            ring_size *= 2;
+        }
+
+        auto ring_memory_size = SharedRing::memory_size(ring_size);
+
+        channel->ring_size = ring_size;
+        channel->memory_size = ring_memory_size * 2;
+        channel->memory_fd = memfd_create("react-obs", MFD_CLOEXEC);
+        channel->inbound_event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        channel->outbound_event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+
+        if (channel->memory_fd < 0 || channel->inbound_event_fd < 0 || channel->outbound_event_fd < 0) {
+            blog(LOG_ERROR, "[react-obs] Cannot create shared memory file descriptors: %i", errno);
+            return nullptr;
+        }
+
+        if (ftruncate(channel->memory_fd, channel->memory_size) != 0) {
+            blog(LOG_ERROR, "[react-obs] Cannot resize shared memory to %zu bytes", channel->memory_size);
+            return nullptr;
+        }
+
+        channel->memory = mmap(nullptr, channel->memory_size, PROT_READ | PROT_WRITE, MAP_SHARED, channel->memory_fd, 0);
+
+        if (channel->memory == MAP_FAILED) {
+            blog(LOG_ERROR, "[react-obs] Cannot map shared memory: %i", errno);
+            return nullptr;
+        }
+
+        auto bytes = (unsigned char*)channel->memory;
+
+        channel->inbound = SharedRing(bytes, ring_size, channel->inbound_event_fd);
+        channel->outbound = SharedRing(bytes + ring_memory_size, ring_size, channel->outbound_event_fd);
+
+        channel->inbound.initialize();
+        channel->outbound.initialize();
+
+        return channel;
+    }
+
+    uint32_t get_ring_size() const {
+        return ring_size;
+    }
+
+    // Becomes readable when the client wrote to the inbound ring while we were waiting
+    int inbound_fd() const {
+        return inbound_event_fd;
+    }
+
+    // In the order the client expects them
+    std::array<int, 3> client_fds() const {
+        return { memory_fd, inbound_event_fd, outbound_event_fd };
+    }
+};
+
+#endif
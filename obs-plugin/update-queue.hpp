@@ -0,0 +1,180 @@
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+// Updates received from controllers, waiting for the video tick.
+//
+// Worker threads only parse messages and push them here. The video tick is the
+// single consumer and applies them at its start (see `drain_update_queue`), so
+// a large batch or a slow source creation never holds up a frame from another
+// thread, and pushing never takes a lock.
+//
+// Intrusive multi-producer single-consumer queue after Dmitry Vyukov's design:
+// producers swap themselves in as the head, the consumer follows `next`
+// pointers from the tail.
+struct QueuedUpdate {
+    enum class Kind {
+        // An `ApplyUpdate`, `UpdateBatch` or `FindSource` message
+        Message,
+
+        // The connection of a session closed without a grace period, after
+        // all of its messages were queued
+        ReleaseSession
+    };
+
+    std::atomic<QueuedUpdate*> next;
+
+    Kind kind;
+    std::shared_ptr<ClientConnection> client;
+    Session* session;
+
+    // Parsed on the arena of `batch`, which the update keeps alive until it
+    // has been released
+    const protocol::ClientMessage* message;
+    MessageBatch* batch;
+
+    // Held by the tick while it applies the update, and by a session staging
+    // some of its updates. Only used by the video tick.
+    uint32_t references;
+};
+
+class UpdateQueue {
+    std::atomic<QueuedUpdate*> head;
+
+    // Only used by the consumer
+    QueuedUpdate* tail;
+
+    // Keeps the queue from ever being empty of nodes
+    QueuedUpdate stub;
+
+public:
+    UpdateQueue() : head(&stub), tail(&stub) {
+        stub.next.store(nullptr, std::memory_order_relaxed);
+    }
+
+    // Can be called from any thread
+    void push(QueuedUpdate* update) {
+        update->next.store(nullptr, std::memory_order_relaxed);
+
+        auto previous = head.exchange(update, std::memory_order_acq_rel);
+        previous->next.store(update, std::memory_order_release);
+    }
+
+    // Only called by the consumer. Returns nullptr if the queue is empty, or
+    // if the next update is still being pushed.
+    QueuedUpdate* pop() {
+        auto first = tail;
+        auto next = first->next.load(std::memory_order_acquire);
+
+        if (first == &stub) {
+            if (!next) {
+                return nullptr;
+            }
+
+            tail = next;
+            first = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next) {
+            tail = next;
+            return first;
+        }
+
+        // A producer has swapped in a newer head but not linked it yet
+        if (first != head.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+
+        // `first` is the last update, put the stub behind it so it can be taken
+        push(&stub);
+
+        next = first->next.load(std::memory_order_acquire);
+
+        if (next) {
+            tail = next;
+            return first;
+        }
+
+        return nullptr;
+    }
+
+    // Only called by the consumer. Does not take any lock, an update still
+    // being pushed counts as queued.
+    bool empty() const {
+        return tail == &stub && head.load(std::memory_order_acquire) == &stub;
+    }
+};
+
+UpdateQueue update_queue;
+
+// Updates are recycled once applied, so queueing a message neither allocates
+// nor copies it once the pool has grown to the number of messages in flight
+class QueuedUpdatePool {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<QueuedUpdate>> updates;
+    std::vector<QueuedUpdate*> free_updates;
+
+public:
+    QueuedUpdate* acquire() {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (free_updates.empty()) {
+            updates.push_back(std::make_unique<QueuedUpdate>());
+            return updates.back().get();
+        }
+
+        auto update = free_updates.back();
+        free_updates.pop_back();
+
+        return update;
+    }
+
+    // Gives the message back to its connection and the update to the pool
+    void release(QueuedUpdate* update) {
+        if (update->batch) {
+            update->client->release_batch(update->batch);
+        }
+
+        update->client.reset();
+        update->session = nullptr;
+        update->message = nullptr;
+        update->batch = nullptr;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        free_updates.push_back(update);
+    }
+};
+
+QueuedUpdatePool queued_update_pool;
+
+// Only called by the video tick
+void release_queued_update(QueuedUpdate* update) {
+    if (--update->references == 0) {
+        queued_update_pool.release(update);
+    }
+}
+
+// Hands a message over to the video tick. Only called by the message handler,
+// the message stays on the connection's arena.
+void queue_message(ClientConnection &client, Session* session, const protocol::ClientMessage &message) {
+    auto update = queued_update_pool.acquire();
+
+    update->kind = QueuedUpdate::Kind::Message;
+    update->client = client.shared_from_this();
+    update->session = session;
+    update->message = &message;
+    update->batch = client.retain_handled_batch();
+
+    update_queue.push(update);
+}
+
+// Releases the session once the tick has applied everything queued before
+void queue_session_release(Session* session) {
+    auto update = queued_update_pool.acquire();
+
+    update->kind = QueuedUpdate::Kind::ReleaseSession;
+    update->session = session;
+
+    update_queue.push(update);
+}
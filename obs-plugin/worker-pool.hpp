@@ -0,0 +1,89 @@
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+// A fixed set of threads, each with its own task queue.
+//
+// Tasks posted with the same key always run on the same thread, in the order
+// they were posted. The server keys tasks by connection so that updates from
+// a single controller are never reordered.
+class WorkerPool {
+    struct Worker {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::deque<std::function<void()>> tasks;
+        bool should_keep_running = true;
+    };
+
+    size_t size;
+    std::vector<std::unique_ptr<Worker>> workers;
+
+public:
+    explicit WorkerPool(size_t _size) : size(std::max<size_t>(_size, 1)) {}
+
+    ~WorkerPool() {
+        stop();
+    }
+
+    void start() {
+        for (size_t i = 0; i < size; i++) {
+            auto worker = std::make_unique<Worker>();
+            worker->thread = std::thread(&WorkerPool::run, worker.get());
+
+            workers.push_back(std::move(worker));
+        }
+    }
+
+    // Waits for the tasks that are currently running. Pending tasks are dropped.
+    void stop() {
+        for (auto &worker : workers) {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+
+            worker->should_keep_running = false;
+            worker->tasks.clear();
+            worker->condition.notify_one();
+        }
+
+        for (auto &worker : workers) {
+            worker->thread.join();
+        }
+
+        workers.clear();
+    }
+
+    void post(size_t key, std::function<void()> task) {
+        if (workers.empty()) {
+            return;
+        }
+
+        auto &worker = workers[key % workers.size()];
+
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->tasks.push_back(std::move(task));
+        worker->condition.notify_one();
+    }
+
+private:
+    static void run(Worker* worker) {
+        std::unique_lock<std::mutex> lock(worker->mutex);
+
+        while (true) {
+            worker->condition.wait(lock, [worker]() {
+                return !worker->should_keep_running || !worker->tasks.empty();
+            });
+
+            if (!worker->should_keep_running) {
+                break;
+            }
+
+            auto task = std::move(worker->tasks.front());
+            worker->tasks.pop_front();
+
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+};